@@ -0,0 +1,268 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_gain.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the list and array    **/
+/**                gain table routines.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE               600
+#endif /* _XOPEN_SOURCE */
+#ifndef __USE_XOPEN2K
+#define __USE_XOPEN2K                             /* For POSIX pthread_barrier_t */
+#endif /* __USE_XOPEN2K */
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/gain.h"
+
+#define TESTGAINSUBBITS             4             /* Same as FM methods */
+
+/*
+**  The type and structure definitions.
+*/
+
+/* The gain cell structure. */
+
+typedef struct TestGain_ {
+  GainLink                  linkdat;              /* TRICK: FIRST                             */
+  INT                       gainval;              /* Gain value                               */
+  int                       permnum;              /* Index in permutation array; linked if < nbr */
+} TestGain;
+
+/*************************************/
+/*                                   */
+/* The gain table exercising routine */
+/*                                   */
+/*************************************/
+
+/* This routine performs a random sequence of
+** FM-like operations on the gain table. It
+** checks that the first link is always of
+** smallest gain entry, and that all linked
+** links can be traversed.
+** It returns:
+** - 0   : if test succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testGainRun (
+GainTabl * const            tablptr,
+TestGain * const            nodetab,
+int * const                 permtab,              /* Linked nodes first, then unlinked ones */
+const int                   nodesiz,
+const int                   passnbr,
+const INT                   gainmax)
+{
+  int                 nodenbr;
+  int                 nodenum;
+  int                 passnum;
+
+  for (nodenum = 0; nodenum < nodesiz; nodenum ++) {
+    permtab[nodenum]         = nodenum;
+    nodetab[nodenum].permnum = nodenum;
+  }
+  nodenbr = 0;                                    /* No node linked yet */
+
+  for (passnum = 0; passnum < passnbr; passnum ++) {
+    TestGain *          nodeptr;
+    int                 permnum;
+    int                 permtmp;
+
+    switch (intRandVal (&intranddat, 8)) {
+      case 0 :                                    /* Add node */
+      case 1 :
+      case 2 :                                    /* More additions than deletions on average */
+        if (nodenbr >= nodesiz)
+          break;
+        nodeptr = &nodetab[permtab[nodenbr]];
+        nodeptr->gainval = (INT) intRandVal (&intranddat, (UINT) (2 * gainmax + 1)) - gainmax;
+        gainTablAdd (tablptr, &nodeptr->linkdat, nodeptr->gainval);
+        nodenbr ++;
+        break;
+      case 3 :                                    /* Remove arbitrary node */
+        if (nodenbr <= 0)
+          break;
+        permnum = (int) intRandVal (&intranddat, nodenbr);
+        nodeptr = &nodetab[permtab[permnum]];
+        gainTablDel (tablptr, &nodeptr->linkdat);
+        nodenbr --;
+        permtmp          = permtab[nodenbr];      /* Swap with last linked node */
+        permtab[nodenbr] = permtab[permnum];
+        permtab[permnum] = permtmp;
+        nodetab[permtab[permnum]].permnum = permnum;
+        nodetab[permtab[nodenbr]].permnum = nodenbr;
+        break;
+      case 4 :                                    /* Change gain of arbitrary node */
+      case 5 :
+        if (nodenbr <= 0)
+          break;
+        permnum = (int) intRandVal (&intranddat, nodenbr);
+        nodeptr = &nodetab[permtab[permnum]];
+        gainTablDel (tablptr, &nodeptr->linkdat);
+        nodeptr->gainval = (INT) intRandVal (&intranddat, (UINT) (2 * gainmax + 1)) - gainmax;
+        gainTablAdd (tablptr, &nodeptr->linkdat, nodeptr->gainval);
+        break;
+      case 6 :                                    /* Remove first node */
+        nodeptr = (TestGain *) gainTablFrst (tablptr);
+        if (nodeptr == NULL) {
+          if (nodenbr != 0) {
+            errorPrint ("testGainRun: first node not found");
+            return (1);
+          }
+          break;
+        }
+        for (permnum = 0; permnum < nodenbr; permnum ++) {
+          if (nodetab[permtab[permnum]].linkdat.tabl < nodeptr->linkdat.tabl) {
+            errorPrint ("testGainRun: node is not of minimum gain");
+            return (1);
+          }
+        }
+        gainTablDel (tablptr, &nodeptr->linkdat);
+        permnum = nodeptr->permnum;
+        nodenbr --;
+        permtmp          = permtab[nodenbr];
+        permtab[nodenbr] = permtab[permnum];
+        permtab[permnum] = permtmp;
+        nodetab[permtab[permnum]].permnum = permnum;
+        nodetab[permtab[nodenbr]].permnum = nodenbr;
+        break;
+      case 7 :                                    /* Scan all linked nodes */
+        for (nodeptr = (TestGain *) gainTablFrst (tablptr), permnum = 0;
+             nodeptr != NULL;
+             nodeptr = (TestGain *) gainTablNext (tablptr, &nodeptr->linkdat), permnum ++) {
+          if (nodeptr->permnum >= nodenbr) {      /* If node is not linked */
+            errorPrint ("testGainRun: invalid node");
+            return (1);
+          }
+        }
+        if (permnum != nodenbr) {
+          errorPrint ("testGainRun: invalid number of nodes");
+          return (1);
+        }
+        break;
+    }
+  }
+
+  gainTablFree (tablptr);
+
+  return (gainTablFrst (tablptr) != NULL);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  GainTabl *          tablptr;
+  TestGain *          nodetab;
+  int *               permtab;
+  int                 nodesiz;
+  int                 passnbr;
+  INT                 seedval;
+  INT                 gainmax;
+  int                 typenum;
+
+  static const char *       typenametab[] = { "list", "array" };
+  static const GainTablType typevaltab[]  = { GAINTABLTYPELIST, GAINTABLTYPEARRY };
+
+  errorProg (argv[0]);
+
+  intRandInit (&intranddat);                      /* Initialize random generator */
+
+  nodesiz = 1000;
+  passnbr = -1;
+  seedval = 1;
+  switch (argc) {
+    case 4 :
+      seedval = MAX (0, atoi (argv[3]));
+    case 3 :
+      passnbr = MAX (1, atoi (argv[2]));
+    case 2 :
+      nodesiz = MAX (1, atoi (argv[1]));
+    case 1 :
+      break;
+    default :
+      errorPrint ("usage: %s [nodenbr [passnbr [seed]]]", argv[0]);
+      exit       (EXIT_FAILURE);
+  }
+  if (passnbr < 0)
+    passnbr = 10 * nodesiz;
+  gainmax = 16 * (INT) nodesiz;                   /* Gain range grows with graph size, as in FM methods */
+
+  if (((nodetab = malloc (nodesiz * sizeof (TestGain))) == NULL) ||
+      ((permtab = malloc (nodesiz * sizeof (int)))      == NULL)) {
+    errorPrint ("main: out of memory");
+    exit       (EXIT_FAILURE);
+  }
+
+  for (typenum = 0; typenum < 2; typenum ++) {
+    if ((tablptr = gainTablInit (GAINMAX, TESTGAINSUBBITS, typevaltab[typenum], NULL)) == NULL) {
+      errorPrint ("main: cannot initialize gain table");
+      exit       (EXIT_FAILURE);
+    }
+
+    intRandSeed (&intranddat, seedval);           /* Same sequence of operations for both table types */
+    if (testGainRun (tablptr, nodetab, permtab, nodesiz, passnbr, gainmax) != 0) {
+      errorPrint ("main: invalid %s gain table", typenametab[typenum]);
+      exit       (EXIT_FAILURE);
+    }
+
+    gainTablExit (tablptr);
+  }
+
+  free (permtab);
+  free (nodetab);
+
+  exit (EXIT_SUCCESS);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2019,2021,2024,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021,2024,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 22 jun 2021     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 08 aug 2024     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -88,6 +88,12 @@ char *              argv[])
   SCOTCH_Num              edgecut;
   SCOTCH_Num *            parttab;
   SCOTCH_Num *            peritab;
+#if (SCOTCH_METIS_VERSION == 5)
+  SCOTCH_Num *            vwgttab;                /* Multi-constraint vertex weight array */
+  double                  awgttb2[18];            /* Target part weights for two constraints */
+  SCOTCH_Num              vertnum;
+  SCOTCH_Num              partnum;
+#endif /* (SCOTCH_METIS_VERSION == 5) */
 #if (SCOTCH_METIS_VERSION == 3)
   SCOTCH_Num              fwgtval;
 
@@ -97,7 +103,8 @@ char *              argv[])
 #if (SCOTCH_METIS_VERSION == 5)
   const double              awgttab[9] = { 0.10, 0.10, 0.05, 0.10, 0.20, 0.30, 0.05, 0.05, 0.05 };
   const SCOTCH_Num          nconval = 1;
-  const double              kbaltab[1] = { 0.05 };
+  const SCOTCH_Num          ncontwo = 2;
+  const double              kbaltab[2] = { 0.05, 0.05 };
   SCOTCH_Num                options[METIS_NOPTIONS];
 #endif /* (SCOTCH_METIS_VERSION == 5) */
 
@@ -188,6 +195,26 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+  if ((vwgttab = malloc (vertnbr * 2 * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* First constraint is vertex load, second is vertex degree */
+    vwgttab[2 * vertnum]     = (velotab != NULL) ? velotab[vertnum] : 1;
+    vwgttab[2 * vertnum + 1] = verttab[vertnum + 1] - verttab[vertnum];
+  }
+  for (partnum = 0; partnum < partnbr; partnum ++)
+    awgttb2[2 * partnum] =
+    awgttb2[2 * partnum + 1] = awgttab[partnum];
+
+  if (SCOTCHMETISNAMEC (METIS_PartGraphKway) (&vertnbr, &ncontwo, verttab, edgetab, vwgttab, NULL, edlotab,
+                                              &partnbr, awgttb2, kbaltab, options, &edgecut, parttab) != METIS_OK) {
+    SCOTCH_errorPrint ("main: error in METIS_V5_PartGraphKway (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  free (vwgttab);
+
   if (SCOTCHMETISNAMEC (METIS_NodeND) (&vertnbr, verttab, edgetab, velotab, options, peritab, parttab) != METIS_OK) {
     SCOTCH_errorPrint ("main: error in METIS_V5_NodeND");
     exit (EXIT_FAILURE);
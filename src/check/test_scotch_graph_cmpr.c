@@ -0,0 +1,298 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_cmpr.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operations of     **/
+/**                the SCOTCH_graphCompress() and          **/
+/**                SCOTCH_graphUncompress() routines.      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+/*********************************/
+/*                               */
+/* The graph comparison routine. */
+/*                               */
+/*********************************/
+
+static
+void
+checkGraphEqual (
+const SCOTCH_Graph * const  grf0ptr,
+const SCOTCH_Graph * const  grf1ptr,
+const char * const          nameptr)
+{
+  SCOTCH_Num          baseval[2];
+  SCOTCH_Num          vertnbr[2];
+  SCOTCH_Edge *       verttab[2];
+  SCOTCH_Edge *       vendtab[2];
+  SCOTCH_Num *        velotab[2];
+  SCOTCH_Edge         edgenbr[2];
+  SCOTCH_Num *        edgetab[2];
+  SCOTCH_Num *        edlotab[2];
+  SCOTCH_Num          vertnum;
+
+  SCOTCH_graphData (grf0ptr, &baseval[0], &vertnbr[0], &verttab[0], &vendtab[0], &velotab[0], NULL, &edgenbr[0], &edgetab[0], &edlotab[0]);
+  SCOTCH_graphData (grf1ptr, &baseval[1], &vertnbr[1], &verttab[1], &vendtab[1], &velotab[1], NULL, &edgenbr[1], &edgetab[1], &edlotab[1]);
+
+  if ((baseval[0] != baseval[1]) ||
+      (vertnbr[0] != vertnbr[1]) ||
+      (edgenbr[0] != edgenbr[1]) ||
+      ((velotab[0] == NULL) != (velotab[1] == NULL)) ||
+      ((edlotab[0] == NULL) != (edlotab[1] == NULL))) {
+    SCOTCH_errorPrint ("checkGraphEqual: %s graphs differ (1)", nameptr);
+    exit (EXIT_FAILURE);
+  }
+
+  for (vertnum = 0; vertnum < vertnbr[0]; vertnum ++) {
+    SCOTCH_Edge         edgenum0;
+    SCOTCH_Edge         edgenum1;
+
+    if (((vendtab[0][vertnum] - verttab[0][vertnum]) != (vendtab[1][vertnum] - verttab[1][vertnum])) ||
+        ((velotab[0] != NULL) && (velotab[0][vertnum] != velotab[1][vertnum]))) {
+      SCOTCH_errorPrint ("checkGraphEqual: %s graphs differ (2)", nameptr);
+      exit (EXIT_FAILURE);
+    }
+    for (edgenum0 = verttab[0][vertnum] - baseval[0], edgenum1 = verttab[1][vertnum] - baseval[1];
+         edgenum0 < (vendtab[0][vertnum] - baseval[0]); edgenum0 ++, edgenum1 ++) {
+      if ((edgetab[0][edgenum0] != edgetab[1][edgenum1]) ||
+          ((edlotab[0] != NULL) && (edlotab[0][edgenum0] != edlotab[1][edgenum1]))) {
+        SCOTCH_errorPrint ("checkGraphEqual: %s graphs differ (3)", nameptr);
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        cmpgrafdat;                 /* Compressed graph                   */
+  SCOTCH_Graph        plngrafdat;                 /* Plain graph with sorted adjacency  */
+  SCOTCH_Graph        ind0grafdat;
+  SCOTCH_Graph        ind1grafdat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        matetab;
+  SCOTCH_Num *        multtab;
+  SCOTCH_Num          coarvertnbr;
+  SCOTCH_Num          indvertnbr;
+  SCOTCH_GraphPart2 * parttab;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          diamval;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphInit (&cmpgrafdat) != 0) ||
+      (SCOTCH_graphInit (&plngrafdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize graphs");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (1)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphLoad (&cmpgrafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph (1)");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphLoad (&plngrafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph (2)");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  if (SCOTCH_graphCompress (&cmpgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compress graph (1)");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphData (&cmpgrafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, &edgetab, NULL);
+  if (edgetab != NULL) {
+    SCOTCH_errorPrint ("main: edge array should not be available");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&cmpgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid compressed graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphCompress   (&plngrafdat) != 0) || /* Get plain graph with sorted adjacency */
+      (SCOTCH_graphUncompress (&plngrafdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot compress graph (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&plngrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid uncompressed graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (((parttab = malloc (vertnbr * sizeof (SCOTCH_GraphPart2))) == NULL) ||
+      ((matetab = malloc (vertnbr * 2 * sizeof (SCOTCH_Num)))    == NULL) ||
+      ((multtab = malloc (vertnbr * 2 * sizeof (SCOTCH_Num)))    == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_randomReset ();
+  for (vertnum = 0, indvertnbr = 0; vertnum < vertnbr; vertnum ++) { /* Keep about half of the vertices */
+    parttab[vertnum] = (SCOTCH_GraphPart2) SCOTCH_randomVal (2);
+    indvertnbr      += parttab[vertnum];
+  }
+
+  if ((SCOTCH_graphInit (&ind0grafdat) != 0) ||
+      (SCOTCH_graphInit (&ind1grafdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize induced graphs");
+    exit (EXIT_FAILURE);
+  }
+  if ((SCOTCH_graphInducePart (&cmpgrafdat, indvertnbr, parttab, 1, &ind0grafdat) != 0) ||
+      (SCOTCH_graphInducePart (&plngrafdat, indvertnbr, parttab, 1, &ind1grafdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot induce graphs");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&ind0grafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid induced graph");
+    exit (EXIT_FAILURE);
+  }
+  checkGraphEqual (&ind0grafdat, &ind1grafdat, "induced");
+  SCOTCH_graphExit (&ind1grafdat);
+  SCOTCH_graphExit (&ind0grafdat);
+
+  coarvertnbr = 0;
+  if (SCOTCH_graphCoarsenMatch (&cmpgrafdat, &coarvertnbr, 1.0, SCOTCH_COARSENNOMERGE, matetab) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute matching");
+    exit (EXIT_FAILURE);
+  }
+
+  memcpy (matetab + vertnbr, matetab, vertnbr * sizeof (SCOTCH_Num)); /* Mate array is overwritten by coarsening */
+
+  if ((SCOTCH_graphInit (&ind0grafdat) != 0) ||
+      (SCOTCH_graphInit (&ind1grafdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize coarse graphs");
+    exit (EXIT_FAILURE);
+  }
+  if ((SCOTCH_graphCoarsenBuild (&cmpgrafdat, coarvertnbr, matetab, &ind0grafdat, multtab) != 0) ||
+      (SCOTCH_graphCoarsenBuild (&plngrafdat, coarvertnbr, matetab + vertnbr, &ind1grafdat, multtab) != 0)) {
+    SCOTCH_errorPrint ("main: cannot build coarse graphs");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&ind0grafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid coarse graph");
+    exit (EXIT_FAILURE);
+  }
+  checkGraphEqual (&ind0grafdat, &ind1grafdat, "coarse");
+  SCOTCH_graphExit (&ind1grafdat);
+  SCOTCH_graphExit (&ind0grafdat);
+
+  SCOTCH_randomReset ();                          /* Start from same root vertex */
+  diamval = SCOTCH_graphDiamPV (&cmpgrafdat);
+  SCOTCH_randomReset ();
+  if (diamval != SCOTCH_graphDiamPV (&plngrafdat)) {
+    SCOTCH_errorPrint ("main: compressed and plain graph diameters differ");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphBase (&cmpgrafdat, 1 - baseval);    /* Change base of compressed graph */
+  SCOTCH_graphBase (&plngrafdat, 1 - baseval);
+  if (SCOTCH_graphCheck (&cmpgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid rebased graph");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphBase (&cmpgrafdat, baseval);
+  SCOTCH_graphBase (&plngrafdat, baseval);
+
+  SCOTCH_stratInit (&stradat);
+  if (SCOTCH_graphPart (&cmpgrafdat, 2, &stradat, matetab) == 0) { /* Compressed graphs cannot be partitioned */
+    SCOTCH_errorPrint ("main: compressed graph should not be partitioned");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+
+  if (SCOTCH_graphUncompress (&cmpgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot uncompress graph");
+    exit (EXIT_FAILURE);
+  }
+  checkGraphEqual (&cmpgrafdat, &plngrafdat, "uncompressed");
+
+  free (multtab);
+  free (matetab);
+  free (parttab);
+
+  SCOTCH_graphExit (&plngrafdat);
+  SCOTCH_graphExit (&cmpgrafdat);
+
+  exit (EXIT_SUCCESS);
+}
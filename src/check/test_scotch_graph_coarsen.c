@@ -1,4 +1,4 @@
-/* Copyright 2014,2015,2018,2021,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2014,2015,2018,2021,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 24 jun 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 04 jul 2025     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -157,8 +157,8 @@ const SCOTCH_Graph * const  finegrafptr,
 SCOTCH_Num * const          finematetab)
 {
   SCOTCH_Num * restrict finematetax;
-  SCOTCH_Num *          fineverttax;
-  SCOTCH_Num *          finevendtax;
+  SCOTCH_Edge *         fineverttax;
+  SCOTCH_Edge *         finevendtax;
   SCOTCH_Num            finevertnbr;
   SCOTCH_Num            finevertnnd;
   SCOTCH_Num            finevertnum;
@@ -197,7 +197,7 @@ SCOTCH_Num * const          finematetab)
       }
     }
     else {
-      SCOTCH_Num          fineedgenum;
+      SCOTCH_Edge         fineedgenum;
 
       for (fineedgenum = fineverttax[finevertnum]; /* Find a suitable mate */
            fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
@@ -236,7 +236,7 @@ char *              argv[])
   SCOTCH_Graph            coargrafdat;            /* Coarse graph              */
   SCOTCH_Num *            coarmulttab;            /* Multinode array           */
   SCOTCH_Num              coarvertnbr;            /* Number of coarse vertices */
-  SCOTCH_Num              coaredgenbr;            /* Number of coarse edges    */
+  SCOTCH_Edge             coaredgenbr;            /* Number of coarse edges    */
   FILE *                  fileptr;
 
   SCOTCH_errorProg (argv[0]);
@@ -294,7 +294,7 @@ char *              argv[])
 
   SCOTCH_graphSize (&coargrafdat, &coarvertnbr, &coaredgenbr);
 
-  printf ("Coarse graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_NUMSTRING " edges\n",
+  printf ("Coarse graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_EDGESTRING " edges\n",
           coarvertnbr,
           coaredgenbr);
   printf ("Graph coarsened with a ratio of %lg\n", (double) coarvertnbr / (double) finevertnbr);
@@ -321,7 +321,7 @@ char *              argv[])
   }
 
   SCOTCH_graphSize (&coargrafdat, &coarvertnbr, &coaredgenbr);
-  printf ("Coarse graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_NUMSTRING " edges\n",
+  printf ("Coarse graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_EDGESTRING " edges\n",
           coarvertnbr,
           coaredgenbr);
   printf ("Graph coarsened with a ratio of %lg\n", (double) coarvertnbr / (double) finevertnbr);
@@ -341,7 +341,7 @@ char *              argv[])
   }
 
   SCOTCH_graphSize (&coargrafdat, &coarvertnbr, NULL);
-  printf ("Coarse graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_NUMSTRING " edges\n",
+  printf ("Coarse graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_EDGESTRING " edges\n",
           coarvertnbr,
           coaredgenbr);
   printf ("Graph coarsened with a ratio of %lg\n", (double) coarvertnbr / (double) finevertnbr);
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 06 jan 2012     **/
 /**                                 to   : 22 may 2018     **/
 /**                # Version 7.0  : from : 04 jul 2025     **/
-/**                                 to   : 14 jan 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,6 +61,8 @@
 
 #include "scotch.h"
 
+#define TEST_THRDNBR                4             /* Number of threads of context */
+
 /*************************************/
 /*                                   */
 /* The consistency checking routine. */
@@ -71,16 +73,17 @@ static
 int
 checkColor (
 const SCOTCH_Graph * const  grafptr,
-const SCOTCH_Num * const    colotab)
+const SCOTCH_Num * const    colotab,
+const SCOTCH_Num            flagval)
 {
   SCOTCH_Num          baseval;
   SCOTCH_Num          vertnbr;
   SCOTCH_Num          vertnnd;
   SCOTCH_Num          vertnum;
-  SCOTCH_Num *        verttab;
-  const SCOTCH_Num *  verttax;
-  SCOTCH_Num *        vendtab;
-  const SCOTCH_Num *  vendtax;
+  SCOTCH_Edge *       verttab;
+  const SCOTCH_Edge * verttax;
+  SCOTCH_Edge *       vendtab;
+  const SCOTCH_Edge * vendtax;
   SCOTCH_Num *        edgetab;
   const SCOTCH_Num *  edgetax;
   const SCOTCH_Num *  colotax;
@@ -94,24 +97,77 @@ const SCOTCH_Num * const    colotab)
 
   for (vertnum = baseval, vertnnd = vertnbr + baseval;
        vertnum < vertnnd; vertnum ++) {
-    SCOTCH_Num          edgenum;
+    SCOTCH_Edge         edgenum;
     SCOTCH_Num          coloval;
 
     coloval = colotax[vertnum];
+    if (coloval < 0) {
+      SCOTCH_errorPrint ("checkColor: uncolored vertex");
+      return (1);
+    }
     for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
       SCOTCH_Num          vertend;
 
       vertend = edgetax[edgenum];
       if (colotax[vertend] == coloval) {
-        SCOTCH_errorPrint ("checkColor: invalid coloring");
+        SCOTCH_errorPrint ("checkColor: invalid coloring (1)");
         return (1);
       }
+      if ((flagval & SCOTCH_COLORDIST2) != 0) {   /* If distance-2 neighbors must also differ */
+        SCOTCH_Edge         edgenm2;
+
+        for (edgenm2 = verttax[vertend]; edgenm2 < vendtax[vertend]; edgenm2 ++) {
+          SCOTCH_Num          vertnd2;
+
+          vertnd2 = edgetax[edgenm2];
+          if ((vertnd2 != vertnum) && (colotax[vertnd2] == coloval)) {
+            SCOTCH_errorPrint ("checkColor: invalid coloring (2)");
+            return (1);
+          }
+        }
+      }
     }
   }
 
   return (0);
 }
 
+/* This routine colors the given graph in
+** a fresh deterministic context with the
+** given number of threads.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+testColor (
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Num * const          colotab,
+SCOTCH_Num * const          coloptr,
+const SCOTCH_Num            flagval,
+const int                   thrdnbr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        cograf;
+  int                 o;
+
+  SCOTCH_contextInit        (&contdat);
+  SCOTCH_contextOptionParse (&contdat, "d");      /* Deterministic behavior */
+  SCOTCH_contextRandomClone (&contdat);
+  SCOTCH_contextRandomReset (&contdat);
+  SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL);
+  SCOTCH_contextBindGraph   (&contdat, grafptr, &cograf);
+
+  o = SCOTCH_graphColor (&cograf, colotab, coloptr, flagval);
+
+  SCOTCH_graphExit   (&cograf);
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -130,7 +186,10 @@ char *              argv[])
   SCOTCH_Num          colonbr;
   SCOTCH_Num          colonum;
   SCOTCH_Num *        colotab;
+  SCOTCH_Num *        colttab;
   SCOTCH_Num *        cnbrtab;
+  SCOTCH_Num          flagnum;
+  static const SCOTCH_Num flagtab[] = { SCOTCH_COLORNONE, SCOTCH_COLORGREEDY, SCOTCH_COLORDIST2, SCOTCH_COLORGREEDY | SCOTCH_COLORDIST2 };
 
   SCOTCH_errorProg (argv[0]);
 
@@ -163,8 +222,13 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+  if ((colttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
+
   if ((cnbrtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
+    SCOTCH_errorPrint ("main: out of memory (3)");
     exit (EXIT_FAILURE);
   }
   memset (cnbrtab, 0, vertnbr * sizeof (SCOTCH_Num));
@@ -174,7 +238,7 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
-  if (checkColor (&grafdat, colotab) != 0)        /* Verify coloring validity */
+  if (checkColor (&grafdat, colotab, 0) != 0)     /* Verify coloring validity */
     exit (EXIT_FAILURE);
 
   printf ("Number of colors: %ld\n", (long) colonbr);
@@ -187,7 +251,57 @@ char *              argv[])
             (long) colonum,
             (long) cnbrtab[colonum]);
 
+  for (flagnum = 0; flagnum < (sizeof (flagtab) / sizeof (flagtab[0])); flagnum ++) {
+    SCOTCH_Num          flagval;
+    SCOTCH_Num          colttmp;
+
+    flagval = flagtab[flagnum];
+    if (testColor (&grafdat, colotab, &colonbr, flagval, 1) != 0) {
+      SCOTCH_errorPrint ("main: cannot color graph (%ld, 1)", (long) flagval);
+      exit (EXIT_FAILURE);
+    }
+    if (checkColor (&grafdat, colotab, flagval) != 0)
+      exit (EXIT_FAILURE);
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+      if (colotab[vertnum] >= colonbr) {
+        SCOTCH_errorPrint ("main: invalid number of colors (%ld)", (long) flagval);
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    if (testColor (&grafdat, colttab, &colttmp, flagval, TEST_THRDNBR) != 0) { /* Colorings must not depend on number of threads */
+      SCOTCH_errorPrint ("main: cannot color graph (%ld, 2)", (long) flagval);
+      exit (EXIT_FAILURE);
+    }
+    if ((colttmp != colonbr) ||
+        (memcmp (colotab, colttab, vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+      SCOTCH_errorPrint ("main: colorings differ (%ld, 1)", (long) flagval);
+      exit (EXIT_FAILURE);
+    }
+
+    if (SCOTCH_graphCompress (&grafdat) != 0) {   /* Colorings of compressed graphs must be the same */
+      SCOTCH_errorPrint ("main: cannot compress graph");
+      exit (EXIT_FAILURE);
+    }
+    if (testColor (&grafdat, colttab, &colttmp, flagval, TEST_THRDNBR) != 0) {
+      SCOTCH_errorPrint ("main: cannot color graph (%ld, 3)", (long) flagval);
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphUncompress (&grafdat) != 0) {
+      SCOTCH_errorPrint ("main: cannot uncompress graph");
+      exit (EXIT_FAILURE);
+    }
+    if ((colttmp != colonbr) ||
+        (memcmp (colotab, colttab, vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+      SCOTCH_errorPrint ("main: colorings differ (%ld, 2)", (long) flagval);
+      exit (EXIT_FAILURE);
+    }
+
+    printf ("Number of colors (flags %ld): %ld\n", (long) flagval, (long) colonbr);
+  }
+
   free (cnbrtab);
+  free (colttab);
   free (colotab);
   SCOTCH_graphExit (&grafdat);
 
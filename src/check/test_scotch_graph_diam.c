@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 26 jan 2017     **/
 /**                                 to   : 22 may 2018     **/
 /**                # Version 7.0  : from : 17 jan 2020     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,6 +61,45 @@
 
 #include "scotch.h"
 
+/*************************/
+/*                       */
+/* The testing routines. */
+/*                       */
+/*************************/
+
+/* This routine computes the pseudo-diameter
+** of the given graph in a deterministic
+** context with the given number of threads.
+** It returns:
+** - >= 0  : pseudo-diameter.
+** - < 0   : on error.
+*/
+
+static
+SCOTCH_Num
+testDiam (
+SCOTCH_Graph * const        grafptr,
+const int                   thrdnbr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        cograf;
+  SCOTCH_Num          diamval;
+
+  SCOTCH_contextInit        (&contdat);
+  SCOTCH_contextOptionParse (&contdat, "d");      /* Deterministic behavior */
+  SCOTCH_contextRandomClone (&contdat);
+  SCOTCH_contextRandomReset (&contdat);
+  SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL);
+  SCOTCH_contextBindGraph   (&contdat, grafptr, &cograf);
+
+  diamval = SCOTCH_graphDiamPV (&cograf);
+
+  SCOTCH_graphExit   (&cograf);
+  SCOTCH_contextExit (&contdat);
+
+  return (diamval);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -109,6 +148,11 @@ char *              argv[])
 
   printf ("Graph pseudo-diameter: %ld\n", (long) diamval);
 
+  if (testDiam (&grafdat, 1) != testDiam (&grafdat, 4)) { /* Result must not depend on number of threads */
+    SCOTCH_errorPrint ("main: pseudo-diameter depends on number of threads");
+    exit (EXIT_FAILURE);
+  }
+
   SCOTCH_graphExit (&grafdat);
 
   exit (EXIT_SUCCESS);
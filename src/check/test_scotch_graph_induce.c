@@ -1,4 +1,4 @@
-/* Copyright 2019,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -38,12 +38,13 @@
 /**                                                        **/
 /**   FUNCTION   : This module tests the operations of     **/
 /**                the SCOTCH_graphInduceList() and        **/
-/**                SCOTCH_graphInducePart() routines.      **/
+/**                SCOTCH_graphInducePart() routines,      **/
+/**                both sequentially and with threads.     **/
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 15 apr 2019     **/
 /**                                 to   : 16 apr 2019     **/
 /**                # Version 7.0  : from : 13 sep 2019     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +64,63 @@
 
 #include "scotch.h"
 
+#define TEST_THRDNBR                4             /* Number of threads of tailored context */
+
+/*********************************/
+/*                               */
+/* The graph comparison routine. */
+/*                               */
+/*********************************/
+
+static
+void
+checkGraphEqual (
+const SCOTCH_Graph * const  grf0ptr,
+const SCOTCH_Graph * const  grf1ptr,
+const char * const          nameptr)
+{
+  SCOTCH_Num          baseval[2];
+  SCOTCH_Num          vertnbr[2];
+  SCOTCH_Edge *       verttab[2];
+  SCOTCH_Edge *       vendtab[2];
+  SCOTCH_Num *        velotab[2];
+  SCOTCH_Edge         edgenbr[2];
+  SCOTCH_Num *        edgetab[2];
+  SCOTCH_Num *        edlotab[2];
+  SCOTCH_Num          vertnum;
+
+  SCOTCH_graphData (grf0ptr, &baseval[0], &vertnbr[0], &verttab[0], &vendtab[0], &velotab[0], NULL, &edgenbr[0], &edgetab[0], &edlotab[0]);
+  SCOTCH_graphData (grf1ptr, &baseval[1], &vertnbr[1], &verttab[1], &vendtab[1], &velotab[1], NULL, &edgenbr[1], &edgetab[1], &edlotab[1]);
+
+  if ((baseval[0] != baseval[1]) ||
+      (vertnbr[0] != vertnbr[1]) ||
+      (edgenbr[0] != edgenbr[1]) ||
+      ((velotab[0] == NULL) != (velotab[1] == NULL)) ||
+      ((edlotab[0] == NULL) != (edlotab[1] == NULL))) {
+    SCOTCH_errorPrint ("checkGraphEqual: %s graphs differ (1)", nameptr);
+    exit (EXIT_FAILURE);
+  }
+
+  for (vertnum = 0; vertnum < vertnbr[0]; vertnum ++) {
+    SCOTCH_Edge         edgenum0;
+    SCOTCH_Edge         edgenum1;
+
+    if (((vendtab[0][vertnum] - verttab[0][vertnum]) != (vendtab[1][vertnum] - verttab[1][vertnum])) ||
+        ((velotab[0] != NULL) && (velotab[0][vertnum] != velotab[1][vertnum]))) {
+      SCOTCH_errorPrint ("checkGraphEqual: %s graphs differ (2)", nameptr);
+      exit (EXIT_FAILURE);
+    }
+    for (edgenum0 = verttab[0][vertnum] - baseval[0], edgenum1 = verttab[1][vertnum] - baseval[1];
+         edgenum0 < (vendtab[0][vertnum] - baseval[0]); edgenum0 ++, edgenum1 ++) {
+      if ((edgetab[0][edgenum0] != edgetab[1][edgenum1]) ||
+          ((edlotab[0] != NULL) && (edlotab[0][edgenum0] != edlotab[1][edgenum1]))) {
+        SCOTCH_errorPrint ("checkGraphEqual: %s graphs differ (3)", nameptr);
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -79,8 +137,12 @@ char *              argv[])
   SCOTCH_Num          orgvertnbr;
   SCOTCH_Num          orgvertnum;
   SCOTCH_GraphPart2 * orgparttab;
+  SCOTCH_Context      contdat;
   SCOTCH_Graph        orggrafdat;
+  SCOTCH_Graph        ctxgrafdat;                 /* Original graph bound to threaded context */
   SCOTCH_Graph        indgrafdat;
+  SCOTCH_Graph        ind0grafdat;                /* Graphs induced sequentially              */
+  SCOTCH_Graph        ind1grafdat;
   SCOTCH_Num *        indlisttab;
   SCOTCH_Num          indvertnbr;
   SCOTCH_Num          indvertnum;
@@ -138,34 +200,75 @@ char *              argv[])
   for (indvertnum = 0; indvertnum < indvertnbr; indvertnum ++) /* Flag kept vertices as belonging to part 1 */
     orgparttab[indlisttab[indvertnum] - baseval] = 1;
 
-  if (SCOTCH_graphInit (&indgrafdat) != 0) {
+  if (SCOTCH_graphInit (&ind0grafdat) != 0) {
     SCOTCH_errorPrint ("main: cannot initialize graph (2)");
     exit (EXIT_FAILURE);
   }
-  if (SCOTCH_graphInduceList (&orggrafdat, indvertnbr, indlisttab, &indgrafdat) != 0) {
+  if (SCOTCH_graphInduceList (&orggrafdat, indvertnbr, indlisttab, &ind0grafdat) != 0) {
     SCOTCH_errorPrint ("main: cannot induce graph (1)");
     exit (EXIT_FAILURE);
   }
-  if (SCOTCH_graphCheck (&indgrafdat) != 0) {
+  if (SCOTCH_graphCheck (&ind0grafdat) != 0) {
     SCOTCH_errorPrint ("main: invalid induced graph (1)");
     exit (EXIT_FAILURE);
   }
-  SCOTCH_graphExit (&indgrafdat);
 
-  if (SCOTCH_graphInit (&indgrafdat) != 0) {
+  if (SCOTCH_graphInit (&ind1grafdat) != 0) {
     SCOTCH_errorPrint ("main: cannot initialize graph (3)");
     exit (EXIT_FAILURE);
   }
-  if (SCOTCH_graphInducePart (&orggrafdat, indvertnbr, orgparttab, 1, &indgrafdat) != 0) {
+  if (SCOTCH_graphInducePart (&orggrafdat, indvertnbr, orgparttab, 1, &ind1grafdat) != 0) {
     SCOTCH_errorPrint ("main: cannot induce graph (2)");
     exit (EXIT_FAILURE);
   }
-  if (SCOTCH_graphCheck (&indgrafdat) != 0) {
+  if (SCOTCH_graphCheck (&ind1grafdat) != 0) {
     SCOTCH_errorPrint ("main: invalid induced graph (2)");
     exit (EXIT_FAILURE);
   }
+
+  SCOTCH_contextInit (&contdat);                  /* Induce same graphs using a multithreaded context */
+  SCOTCH_contextThreadSpawn (&contdat, TEST_THRDNBR, NULL);
+  SCOTCH_graphInit (&ctxgrafdat);
+  if (SCOTCH_contextBindGraph (&contdat, &orggrafdat, &ctxgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot bind context");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize graph (4)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphInduceList (&ctxgrafdat, indvertnbr, indlisttab, &indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot induce graph (3)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid induced graph (3)");
+    exit (EXIT_FAILURE);
+  }
+  checkGraphEqual (&ind0grafdat, &indgrafdat, "list");
+  SCOTCH_graphExit (&indgrafdat);
+
+  if (SCOTCH_graphInit (&indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize graph (5)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphInducePart (&ctxgrafdat, indvertnbr, orgparttab, 1, &indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot induce graph (4)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid induced graph (4)");
+    exit (EXIT_FAILURE);
+  }
+  checkGraphEqual (&ind1grafdat, &indgrafdat, "part");
   SCOTCH_graphExit (&indgrafdat);
 
+  SCOTCH_graphExit   (&ctxgrafdat);               /* Free the context graph before its bound context */
+  SCOTCH_contextExit (&contdat);
+  SCOTCH_graphExit   (&ind1grafdat);
+  SCOTCH_graphExit   (&ind0grafdat);
+
   free (indlisttab);
   free (orgparttab);
 
@@ -0,0 +1,157 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_load.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests that the              **/
+/**                SCOTCH_graphLoad() routine leaves the   **/
+/**                stream positioned just after the        **/
+/**                graph data.                             **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_MARKVAL                12345         /* Value written after graph data */
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        gr2tab[2];
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Edge         edgenbr;
+  int                 markval;
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, &edgenbr);
+
+  if ((fileptr = tmpfile ()) == NULL) {           /* Open temporary file for graphs and marker */
+    SCOTCH_errorPrint ("main: cannot open temporary file");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphSave (&grafdat, fileptr) != 0) || /* Write graph twice, followed by marker value */
+      (SCOTCH_graphSave (&grafdat, fileptr) != 0) ||
+      (fprintf (fileptr, "%d\n", TEST_MARKVAL) < 0)) {
+    SCOTCH_errorPrint ("main: cannot save graphs");
+    exit (EXIT_FAILURE);
+  }
+
+  rewind (fileptr);
+
+  for (i = 0; i < 2; i ++) {                      /* Each graph must be read from where previous one ended */
+    SCOTCH_Num          vertnbr2;
+    SCOTCH_Edge         edgenbr2;
+
+    SCOTCH_graphInit (&gr2tab[i]);
+    if (SCOTCH_graphLoad (&gr2tab[i], fileptr, -1, 0) != 0) {
+      SCOTCH_errorPrint ("main: cannot reload graph (%d)", i);
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphCheck (&gr2tab[i]) != 0) {
+      SCOTCH_errorPrint ("main: invalid reloaded graph (%d)", i);
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_graphSize (&gr2tab[i], &vertnbr2, &edgenbr2);
+    if ((vertnbr2 != vertnbr) || (edgenbr2 != edgenbr)) {
+      SCOTCH_errorPrint ("main: invalid reloaded graph size (%d)", i);
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_graphExit (&gr2tab[i]);
+  }
+
+  if ((fscanf (fileptr, "%d", &markval) != 1) ||  /* Data after graphs must not have been consumed */
+      (markval != TEST_MARKVAL)) {
+    SCOTCH_errorPrint ("main: data after graph lost");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,279 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_map_vol.c             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the communication     **/
+/**                volume objectives of the k-way FM       **/
+/**                refinement method.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_PARTNBR                8             /* Number of parts */
+
+#define TEST_STRATINI               "m{vert=120,low=r{job=t,map=t,poli=S,sep=h{pass=10}f{bal=0.05,move=120}},asc=b{bnd=f{bal=0.05},org=f{bal=0.05}}}"
+
+/*************************/
+/*                       */
+/* The testing routines. */
+/*                       */
+/*************************/
+
+/* This routine computes a mapping of the given
+** graph with the given strategy string, in a
+** deterministic context, so that all strategies
+** which start with the same methods yield the
+** same intermediate mapping.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+testMap (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Arch * const   archptr,
+const char * const          strastr,
+SCOTCH_Num * const          parttab)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        cograf;
+  SCOTCH_Strat        stradat;
+  int                 o;
+
+  SCOTCH_contextInit        (&contdat);
+  SCOTCH_contextOptionParse (&contdat, "d");      /* Deterministic behavior */
+  SCOTCH_contextRandomClone (&contdat);
+  SCOTCH_contextRandomReset (&contdat);
+  SCOTCH_contextBindGraph   (&contdat, grafptr, &cograf);
+
+  SCOTCH_stratInit (&stradat);
+  o = SCOTCH_stratGraphMap (&stradat, strastr);
+  if (o == 0)
+    o = SCOTCH_graphMap (&cograf, archptr, &stradat, parttab);
+
+  SCOTCH_stratExit   (&stradat);
+  SCOTCH_graphExit   (&cograf);
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
+/* This routine computes the total and maximum
+** communication volumes of the given partition,
+** the volume of a part being the sum, over all
+** of its vertices, of the number of distinct
+** other parts to which each vertex is adjacent.
+** It returns:
+** - 0   : if the partition is valid.
+** - !0  : on error.
+*/
+
+static
+int
+testVol (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Num * const    parttab,
+SCOTCH_Num * const          volsptr,              /* Total volume   */
+SCOTCH_Num * const          volmptr)              /* Maximum volume */
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num          voltab[TEST_PARTNBR];
+  SCOTCH_Num          flagtab[TEST_PARTNBR];      /* Last vertex adjacent to part */
+  SCOTCH_Num          volsum;
+  SCOTCH_Num          volmax;
+  SCOTCH_Num          partnum;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  for (partnum = 0; partnum < TEST_PARTNBR; partnum ++) {
+    voltab[partnum]  = 0;
+    flagtab[partnum] = -1;
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Edge         edgenum;
+    SCOTCH_Num          partval;
+
+    partval = parttab[vertnum];
+    if ((partval < 0) || (partval >= TEST_PARTNBR)) {
+      SCOTCH_errorPrint ("testVol: invalid part");
+      return (1);
+    }
+    flagtab[partval] = vertnum;                   /* Do not count own part */
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          partend;
+
+      partend = parttab[edgetab[edgenum - baseval] - baseval];
+      if (flagtab[partend] != vertnum) {          /* If neighbor part not yet counted for vertex */
+        flagtab[partend] = vertnum;
+        voltab[partval] ++;
+      }
+    }
+  }
+
+  for (partnum = 0, volsum = volmax = 0; partnum < TEST_PARTNBR; partnum ++) {
+    volsum += voltab[partnum];
+    if (volmax < voltab[partnum])
+      volmax = voltab[partnum];
+  }
+  *volsptr = volsum;
+  *volmptr = volmax;
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num          volsini;                    /* Volumes of initial mapping */
+  SCOTCH_Num          volmini;
+  SCOTCH_Num          volsval;
+  SCOTCH_Num          volmval;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+
+  if ((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_archInit (&archdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize architecture");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_archCmplt (&archdat, TEST_PARTNBR);
+
+  if ((testMap (&grafdat, &archdat, TEST_STRATINI, parttab) != 0) || /* Compute initial mapping */
+      (testVol (&grafdat, parttab, &volsini, &volmini) != 0)) {
+    SCOTCH_errorPrint ("main: cannot compute mapping (1)");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Initial: total volume %ld, maximum volume %ld\n", (long) volsini, (long) volmini);
+
+  if ((testMap (&grafdat, &archdat, TEST_STRATINI "f{bal=0.05,type=v}", parttab) != 0) || /* Refine total volume */
+      (testVol (&grafdat, parttab, &volsval, &volmval) != 0)) {
+    SCOTCH_errorPrint ("main: cannot compute mapping (2)");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Type v: total volume %ld, maximum volume %ld\n", (long) volsval, (long) volmval);
+  if (volsval > volsini) {
+    SCOTCH_errorPrint ("main: total volume increased");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((testMap (&grafdat, &archdat, TEST_STRATINI "f{bal=0.05,type=m}", parttab) != 0) || /* Refine maximum volume */
+      (testVol (&grafdat, parttab, &volsval, &volmval) != 0)) {
+    SCOTCH_errorPrint ("main: cannot compute mapping (3)");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Type m: total volume %ld, maximum volume %ld\n", (long) volsval, (long) volmval);
+  if (volmval > volmini) {
+    SCOTCH_errorPrint ("main: maximum volume increased");
+    exit (EXIT_FAILURE);
+  }
+
+  if (testMap (&grafdat, &archdat, "m{vert=120,low=r{job=t,map=t,poli=S,sep=h{pass=10}f{bal=0.05,move=120}}f{bal=0.05,type=m},asc=b{bnd=f{bal=0.05,type=v},org=f{bal=0.05,type=v}}}f{bal=0.05,type=m}", parttab) != 0) { /* Volume objectives within multilevel framework */
+    SCOTCH_errorPrint ("main: cannot compute mapping (4)");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&grafdat);
+  free (parttab);
+
+  exit (EXIT_SUCCESS);
+}
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 05 aug 2014     **/
 /**                                 to   : 01 sep 2019     **/
 /**                # Version 7.0  : from : 04 jul 2025     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +62,43 @@
 
 #include "scotch.h"
 
+/*************************************/
+/*                                   */
+/* This routine computes the factor  */
+/* of an ordering within a context.  */
+/*                                   */
+/*************************************/
+
+static
+int
+testFactor (
+SCOTCH_Graph * const          grafptr,
+const SCOTCH_Ordering * const ordeptr,
+const int                     thrdnbr,
+SCOTCH_Num * const            fathtab,
+SCOTCH_Num * const            cntstab,
+double * const                nnzeptr,
+double * const                opcoptr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        cograf;
+  int                 o;
+
+  SCOTCH_contextInit        (&contdat);
+  SCOTCH_contextOptionParse (&contdat, "d");      /* Deterministic behavior */
+  SCOTCH_contextRandomClone (&contdat);
+  SCOTCH_contextRandomReset (&contdat);
+  SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL);
+  SCOTCH_contextBindGraph   (&contdat, grafptr, &cograf);
+
+  o = SCOTCH_graphOrderFactor (&cograf, ordeptr, fathtab, cntstab, nnzeptr, opcoptr);
+
+  SCOTCH_graphExit   (&cograf);
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -83,6 +120,12 @@ char *              argv[])
   SCOTCH_Num          listnbr;
   SCOTCH_Num          listnum;
   SCOTCH_Num *        listtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        fathtab;
+  SCOTCH_Num *        cntstab;
+  double              nnzeval[2];
+  double              opcoval[2];
+  double              nnzesum;
 
   SCOTCH_errorProg (argv[0]);
 
@@ -108,7 +151,7 @@ char *              argv[])
 
   fclose (fileptr);
 
-  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, &velotab, NULL, NULL, NULL, NULL);
 
   listnbr = (vertnbr + 1) / 2;                    /* Only keep half of the vertices in induced graph */
   if ((listtab = malloc (listnbr * sizeof (SCOTCH_Num))) == NULL) {
@@ -144,6 +187,36 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+  if ((fathtab = malloc (vertnbr * 4 * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
+  cntstab = fathtab + 2 * vertnbr;
+
+  if ((testFactor (&grafdat, &ordedat, 1, fathtab, cntstab, &nnzeval[0], &opcoval[0]) != 0) ||
+      (testFactor (&grafdat, &ordedat, 4, fathtab + vertnbr, cntstab + vertnbr, &nnzeval[1], &opcoval[1]) != 0)) {
+    SCOTCH_errorPrint ("main: cannot factor ordering");
+    exit (EXIT_FAILURE);
+  }
+  if ((memcmp (fathtab, fathtab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) || /* Results must not depend on number of threads */
+      (memcmp (cntstab, cntstab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) ||
+      (nnzeval[0] != nnzeval[1]) || (opcoval[0] != opcoval[1])) {
+    SCOTCH_errorPrint ("main: factorization depends on number of threads");
+    exit (EXIT_FAILURE);
+  }
+  for (vertnum = 0, nnzesum = 0.0; vertnum < vertnbr; vertnum ++) {
+    if (((fathtab[vertnum] != -1) && (fathtab[vertnum] <= (vertnum + baseval))) ||
+        (cntstab[vertnum] < 1)) {
+      SCOTCH_errorPrint ("main: invalid factorization");
+      exit (EXIT_FAILURE);
+    }
+    nnzesum += (double) cntstab[vertnum];
+  }
+  if ((velotab == NULL) && (nnzesum != nnzeval[0])) { /* Without vertex loads, non-zeros are sum of column counts */
+    SCOTCH_errorPrint ("main: invalid number of non-zeros");
+    exit (EXIT_FAILURE);
+  }
+
   SCOTCH_graphOrderSave     (&grafdat, &ordedat, fileptr); /* Test ordering data output routines */
   SCOTCH_graphOrderSaveMap  (&grafdat, &ordedat, fileptr);
   SCOTCH_graphOrderSaveTree (&grafdat, &ordedat, fileptr);
@@ -171,6 +244,7 @@ char *              argv[])
 
   fclose (fileptr);
 
+  free (fathtab);
   free (listtab);
   SCOTCH_stratExit      (&stradat);
   SCOTCH_graphOrderExit (&grafdat, &ordedat);
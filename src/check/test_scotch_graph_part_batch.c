@@ -0,0 +1,213 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_part_batch.c          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the batched graph     **/
+/**                partitioning routine.                   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_JOBNBR                 16            /* Number of jobs in batch      */
+#define TEST_THRDNBR                4             /* Number of threads of context */
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  SCOTCH_Graph *      graftab;
+  SCOTCH_Num          partnbrtab[TEST_JOBNBR];
+  SCOTCH_Num          vertidxtab[TEST_JOBNBR + 1];
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        partreftab;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Context      contdat;
+  int                 filenbr;
+  int                 jobnum;
+  FILE *              fileptr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc < 2) {
+    SCOTCH_errorPrint ("usage: %s input_source_graph_file...", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+  filenbr = argc - 1;
+
+  if ((graftab = malloc (filenbr * sizeof (SCOTCH_Graph))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  for (jobnum = 0; jobnum < filenbr; jobnum ++) {
+    if (SCOTCH_graphInit (&graftab[jobnum]) != 0) {
+      SCOTCH_errorPrint ("main: cannot initialize graph");
+      exit (EXIT_FAILURE);
+    }
+    if ((fileptr = fopen (argv[jobnum + 1], "r")) == NULL) {
+      SCOTCH_errorPrint ("main: cannot open file");
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphLoad (&graftab[jobnum], fileptr, -1, 0) != 0) {
+      SCOTCH_errorPrint ("main: cannot load graph");
+      exit (EXIT_FAILURE);
+    }
+    fclose (fileptr);
+  }
+
+  if ((graftab = realloc (graftab, TEST_JOBNBR * sizeof (SCOTCH_Graph))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  vertidxtab[0] = 0;
+  for (jobnum = 0; jobnum < TEST_JOBNBR; jobnum ++) { /* Batch contains copies of the same graphs, with various part numbers */
+    SCOTCH_Num          vertnbr;
+
+    if (jobnum >= filenbr)
+      memcpy (&graftab[jobnum], &graftab[jobnum % filenbr], sizeof (SCOTCH_Graph)); /* Graphs are only read */
+    partnbrtab[jobnum] = (SCOTCH_Num) (2 + (jobnum % 7));
+
+    SCOTCH_graphSize (&graftab[jobnum], &vertnbr, NULL);
+    vertidxtab[jobnum + 1] = vertidxtab[jobnum] + vertnbr;
+  }
+
+  if (((parttab    = malloc (vertidxtab[TEST_JOBNBR] * sizeof (SCOTCH_Num))) == NULL) ||
+      ((partreftab = malloc (vertidxtab[TEST_JOBNBR] * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory (3)");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);                    /* Default strategy will be built by first call */
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_contextOptionParse (&contdat, "d");      /* Deterministic behavior */
+  SCOTCH_contextThreadSpawn (&contdat, TEST_THRDNBR, NULL);
+
+  if (SCOTCH_graphPartBatch (&contdat, TEST_JOBNBR, graftab, partnbrtab, &stradat, parttab) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute batch of partitions (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  for (jobnum = 0; jobnum < TEST_JOBNBR; jobnum ++) { /* Compare with sequential calls in fresh single-thread contexts */
+    SCOTCH_Context      cseqdat;
+    SCOTCH_Graph        cograf;
+    SCOTCH_Num          vertnum;
+
+    SCOTCH_contextInit        (&cseqdat);
+    SCOTCH_contextOptionParse (&cseqdat, "d");
+    SCOTCH_contextRandomClone (&cseqdat);
+    SCOTCH_contextRandomReset (&cseqdat);
+    SCOTCH_contextThreadSpawn (&cseqdat, 1, NULL);
+    SCOTCH_contextBindGraph   (&cseqdat, &graftab[jobnum], &cograf);
+
+    if (SCOTCH_graphPart (&cograf, partnbrtab[jobnum], &stradat, partreftab + vertidxtab[jobnum]) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute partition");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_graphExit   (&cograf);
+    SCOTCH_contextExit (&cseqdat);
+
+    for (vertnum = vertidxtab[jobnum]; vertnum < vertidxtab[jobnum + 1]; vertnum ++) {
+      if ((parttab[vertnum] < 0) || (parttab[vertnum] >= partnbrtab[jobnum])) {
+        SCOTCH_errorPrint ("main: invalid part number");
+        exit (EXIT_FAILURE);
+      }
+    }
+    if (memcmp (parttab    + vertidxtab[jobnum],
+                partreftab + vertidxtab[jobnum],
+                (vertidxtab[jobnum + 1] - vertidxtab[jobnum]) * sizeof (SCOTCH_Num)) != 0) {
+      SCOTCH_errorPrint ("main: batch and sequential partitions differ (%d)", jobnum);
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  SCOTCH_contextExit (&contdat);                  /* Check non-deterministic mode, which must yield valid partitions */
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_contextOptionParse (&contdat, "u");
+  SCOTCH_contextThreadSpawn (&contdat, TEST_THRDNBR, NULL);
+
+  if (SCOTCH_graphPartBatch (&contdat, TEST_JOBNBR, graftab, partnbrtab, &stradat, parttab) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute batch of partitions (2)");
+    exit (EXIT_FAILURE);
+  }
+  for (jobnum = 0; jobnum < TEST_JOBNBR; jobnum ++) {
+    SCOTCH_Num          vertnum;
+
+    for (vertnum = vertidxtab[jobnum]; vertnum < vertidxtab[jobnum + 1]; vertnum ++) {
+      if ((parttab[vertnum] < 0) || (parttab[vertnum] >= partnbrtab[jobnum])) {
+        SCOTCH_errorPrint ("main: invalid part number");
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+
+  SCOTCH_contextExit (&contdat);
+  SCOTCH_stratExit   (&stradat);
+  for (jobnum = 0; jobnum < filenbr; jobnum ++)   /* Only free original graphs */
+    SCOTCH_graphExit (&graftab[jobnum]);
+  free (partreftab);
+  free (parttab);
+  free (graftab);
+
+  exit (EXIT_SUCCESS);
+}
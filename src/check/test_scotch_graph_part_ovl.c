@@ -1,4 +1,4 @@
-/* Copyright 2011,2014,2018,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2011,2014,2018,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 20 sep 2014     **/
 /**                                 to   : 22 may 2018     **/
 /**                # Version 7.0  : from : 04 jul 2025     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,8 +81,8 @@ char *              argv[])
   SCOTCH_Num * restrict parttax;
   SCOTCH_Num            vertnbr;
   SCOTCH_Num            vertnum;
-  SCOTCH_Num *          verttab;
-  SCOTCH_Num *          vendtab;
+  SCOTCH_Edge *         verttab;
+  SCOTCH_Edge *         vendtab;
   SCOTCH_Num *          velotab;
   SCOTCH_Num *          vlbltab;
   SCOTCH_Num *          edgetax;
@@ -163,7 +163,7 @@ char *              argv[])
     if (partval >= 0)                             /* If vertex belongs to one part only */
       loadtab[partval] += veloval;                /* Add vertex load to this part       */
     else {                                        /* Vertex belongs to several parts    */
-      SCOTCH_Num          edgenum;
+      SCOTCH_Edge         edgenum;
 
       for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
         SCOTCH_Num          vertend;
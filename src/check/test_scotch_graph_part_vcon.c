@@ -0,0 +1,216 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_part_vcon.c           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the balance of every  **/
+/**                load constraint of the partitions       **/
+/**                computed for graphs built with the      **/
+/**                SCOTCH_graphBuildMulti() routine.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_VCONNBR                2             /* Number of load constraints        */
+#define TEST_KBALVAL                0.05          /* Requested load imbalance ratio    */
+#define TEST_KBALMAX                0.10          /* Largest imbalance ratio tolerated */
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;                    /* Graph loaded from file            */
+  SCOTCH_Graph        grmcdat;                    /* Multi-constraint graph            */
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
+  SCOTCH_Edge         edgenbr;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        vcontab;                    /* Constraint load array             */
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        loadtab;                    /* Constraint loads of parts         */
+  SCOTCH_Num          vconsum[TEST_VCONNBR];      /* Overall constraint loads          */
+  SCOTCH_Num          vconmax[TEST_VCONNBR];      /* Largest vertex constraint loads */
+  SCOTCH_Num          partnbr;
+  int                 o;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, &edgenbr, &edgetab, NULL);
+
+  if (((vcontab = malloc (vertnbr * TEST_VCONNBR * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  vconsum[0] =                                    /* First constraint is uniform, second one only bears on a third of the vertices */
+  vconsum[1] =
+  vconmax[0] =
+  vconmax[1] = 0;
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    vcontab[vertnum * TEST_VCONNBR]     = 1;
+    vcontab[vertnum * TEST_VCONNBR + 1] = (vertnum < (vertnbr / 3)) ? (1 + (vertnum % 5)) : 0;
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    int                 vconnum;
+
+    for (vconnum = 0; vconnum < TEST_VCONNBR; vconnum ++) {
+      SCOTCH_Num          vconval;
+
+      vconval = vcontab[vertnum * TEST_VCONNBR + vconnum];
+      vconsum[vconnum] += vconval;
+      if (vconmax[vconnum] < vconval)
+        vconmax[vconnum] = vconval;
+    }
+  }
+
+  if (SCOTCH_graphInit (&grmcdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize multi-constraint graph");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphBuildMulti (&grmcdat, baseval, vertnbr, verttab, vendtab, TEST_VCONNBR, vcontab,
+                              NULL, edgenbr, edgetab, NULL) != 0) {
+    SCOTCH_errorPrint ("main: cannot build multi-constraint graph");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&grmcdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid multi-constraint graph");
+    exit (EXIT_FAILURE);
+  }
+
+  for (partnbr = 2, o = 0; partnbr <= 8; partnbr *= 2) {
+    SCOTCH_Num          partnum;
+    int                 vconnum;
+
+    if ((loadtab = calloc (partnbr * TEST_VCONNBR, sizeof (SCOTCH_Num))) == NULL) {
+      SCOTCH_errorPrint ("main: out of memory (2)");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_stratInit (&stradat);
+    SCOTCH_stratGraphMapBuild (&stradat, SCOTCH_STRATBALANCE, partnbr, TEST_KBALVAL);
+    if (SCOTCH_graphPart (&grmcdat, partnbr, &stradat, parttab) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute partition");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Sum constraint loads of parts */
+      if ((parttab[vertnum] < 0) || (parttab[vertnum] >= partnbr)) {
+        SCOTCH_errorPrint ("main: invalid partition");
+        exit (EXIT_FAILURE);
+      }
+      for (vconnum = 0; vconnum < TEST_VCONNBR; vconnum ++)
+        loadtab[parttab[vertnum] * TEST_VCONNBR + vconnum] += vcontab[vertnum * TEST_VCONNBR + vconnum];
+    }
+
+    for (vconnum = 0; vconnum < TEST_VCONNBR; vconnum ++) { /* Every constraint must be balanced */
+      double              loadavg;
+      SCOTCH_Num          loadmax;
+
+      loadavg = (double) vconsum[vconnum] / (double) partnbr;
+      for (partnum = 0, loadmax = 0; partnum < partnbr; partnum ++) {
+        if (loadmax < loadtab[partnum * TEST_VCONNBR + vconnum])
+          loadmax = loadtab[partnum * TEST_VCONNBR + vconnum];
+      }
+      printf ("Parts: %ld, constraint: %d, imbalance: %g\n", (long) partnbr, vconnum, ((double) loadmax / loadavg) - 1.0);
+      if ((double) loadmax > (loadavg * (1.0 + TEST_KBALMAX) + (double) vconmax[vconnum])) {
+        SCOTCH_errorPrint ("main: constraint %d not balanced for %ld parts", vconnum, (long) partnbr);
+        o = 1;
+      }
+    }
+
+    free (loadtab);
+  }
+
+  SCOTCH_graphExit (&grmcdat);
+  SCOTCH_graphExit (&grafdat);
+  free (parttab);
+  free (vcontab);
+
+  exit ((o == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
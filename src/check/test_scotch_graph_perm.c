@@ -0,0 +1,351 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_perm.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module checks that the results of  **/
+/**                the locality relabeling mapping and     **/
+/**                ordering methods are consistent with    **/
+/**                those computed on relabeled graphs.     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define STRATBIPART                 "m{vert=100,low=h{pass=10}f{bal=0.05},asc=f{bal=0.05}}"
+#define STRATMAP                    "m{vert=100,low=r{sep=" STRATBIPART "},asc=f{bal=0.05}}"
+#define STRATORDER                  "n{sep=/(vert>120)?m{vert=100,low=h{pass=10},asc=f{bal=0.2}};,ole=f{cmin=0,cmax=100000,frat=0.08},ose=g}"
+
+/*+ The graph data, to be freed
+    after the graph itself.    +*/
+
+typedef struct TestGraph_ {
+  SCOTCH_Graph              grafdat;
+  SCOTCH_Edge *             verttab;
+  SCOTCH_Num *              velotab;
+  SCOTCH_Num *              edgetab;
+  SCOTCH_Num *              edlotab;
+} TestGraph;
+
+/*******************************/
+/*                             */
+/* The graph building routine. */
+/*                             */
+/*******************************/
+
+static
+void
+testGraphPerm (
+const SCOTCH_Graph * const  orggrafptr,
+const SCOTCH_Num * const    permtab,              /* New index of every old vertex */
+const SCOTCH_Num * const    peritab,              /* Old index of every new vertex */
+TestGraph * const           prmgrafptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Edge         edgenbr;
+  SCOTCH_Edge         edgenum;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+
+  SCOTCH_graphData (orggrafptr, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL, &edgenbr, &edgetab, &edlotab);
+
+  if (((prmgrafptr->verttab = malloc ((vertnbr + 1) * sizeof (SCOTCH_Edge))) == NULL) ||
+      ((prmgrafptr->edgetab = malloc (edgenbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("testGraphPerm: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  prmgrafptr->velotab = NULL;                     /* Keep same weight arrays as original graph */
+  prmgrafptr->edlotab = NULL;
+  if (((velotab != NULL) && ((prmgrafptr->velotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) ||
+      ((edlotab != NULL) && ((prmgrafptr->edlotab = malloc (edgenbr * sizeof (SCOTCH_Num))) == NULL))) {
+    SCOTCH_errorPrint ("testGraphPerm: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (vertnum = 0, edgenum = 0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          vertold;
+    SCOTCH_Edge         edgeold;
+
+    vertold = peritab[vertnum];
+    prmgrafptr->verttab[vertnum] = edgenum + baseval;
+    if (velotab != NULL)
+      prmgrafptr->velotab[vertnum] = velotab[vertold];
+    for (edgeold = verttab[vertold] - baseval; edgeold < vendtab[vertold] - baseval; edgeold ++, edgenum ++) {
+      prmgrafptr->edgetab[edgenum] = permtab[edgetab[edgeold] - baseval] + baseval;
+      if (edlotab != NULL)
+        prmgrafptr->edlotab[edgenum] = edlotab[edgeold];
+    }
+  }
+  prmgrafptr->verttab[vertnum] = edgenum + baseval;
+
+  if ((SCOTCH_graphInit  (&prmgrafptr->grafdat) != 0) ||
+      (SCOTCH_graphBuild (&prmgrafptr->grafdat, baseval, vertnbr, prmgrafptr->verttab, NULL, prmgrafptr->velotab, NULL,
+                          edgenbr, prmgrafptr->edgetab, prmgrafptr->edlotab) != 0) ||
+      (SCOTCH_graphCheck (&prmgrafptr->grafdat) != 0)) {
+    SCOTCH_errorPrint ("testGraphPerm: cannot build graph");
+    exit (EXIT_FAILURE);
+  }
+}
+
+static
+void
+testGraphExit (
+TestGraph * const           grafptr)
+{
+  SCOTCH_graphExit (&grafptr->grafdat);
+  free (grafptr->edlotab);
+  free (grafptr->edgetab);
+  free (grafptr->velotab);
+  free (grafptr->verttab);
+}
+
+/*****************************/
+/*                           */
+/* The computation routine.  */
+/*                           */
+/*****************************/
+
+/* This routine computes a mapping of the
+** given graph onto the given architecture
+** or, if no architecture is given, an
+** ordering of the graph, using the given
+** strategy.
+*/
+
+static
+void
+testCompute (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Arch * const   archptr,              /* Target architecture, or NULL for ordering */
+const char * const          strastr,
+SCOTCH_Num * const          datatab)              /* Result array, of size 2 * vertnbr         */
+{
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          vertnbr;
+  int                 o;
+
+  SCOTCH_graphSize (grafptr, &vertnbr, NULL);
+  SCOTCH_stratInit (&stradat);
+  SCOTCH_randomReset ();                          /* Get the same results on both graphs */
+  if (archptr != NULL)
+    o = (SCOTCH_stratGraphMap (&stradat, strastr) != 0) ||
+        (SCOTCH_graphMap (grafptr, archptr, &stradat, datatab) != 0);
+  else
+    o = (SCOTCH_stratGraphOrder (&stradat, strastr) != 0) ||
+        (SCOTCH_graphOrder (grafptr, &stradat, datatab, datatab + vertnbr, NULL, NULL, NULL) != 0);
+  if (o != 0) {
+    SCOTCH_errorPrint ("testCompute: cannot compute %s", (archptr != NULL) ? "mapping" : "ordering");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Graph        orggrafdat;                 /* Original graph                          */
+  TestGraph           rndgrafdat;                 /* Graph with randomly shuffled vertices   */
+  TestGraph           prmgrafdat;                 /* Shuffled graph relabeled for locality   */
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num *        peritab;
+  SCOTCH_Num *        datatab[2];
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 3) {
+    SCOTCH_errorPrint ("usage: %s graph_file target_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphInit (&orggrafdat) != 0) ||
+      (SCOTCH_archInit (&archdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize structures");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (1)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphLoad (&orggrafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  if ((fileptr = fopen (argv[2], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_archLoad (&archdat, fileptr) != 0) {
+    SCOTCH_errorPrint ("main: cannot load target architecture");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  SCOTCH_graphData (&orggrafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  if (((permtab    = malloc (vertnbr * sizeof (SCOTCH_Num)))     == NULL) ||
+      ((peritab    = malloc (vertnbr * sizeof (SCOTCH_Num)))     == NULL) ||
+      ((datatab[0] = malloc (vertnbr * 2 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((datatab[1] = malloc (vertnbr * 2 * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_randomReset ();                          /* Shuffle vertices, as output by some mesh generators */
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    peritab[vertnum] = vertnum;
+  for (vertnum = vertnbr - 1; vertnum > 0; vertnum --) {
+    SCOTCH_Num          vertold;
+    SCOTCH_Num          verttmp;
+
+    vertold          = SCOTCH_randomVal (vertnum + 1);
+    verttmp          = peritab[vertnum];
+    peritab[vertnum] = peritab[vertold];
+    peritab[vertold] = verttmp;
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    permtab[peritab[vertnum]] = vertnum;
+  testGraphPerm (&orggrafdat, permtab, peritab, &rndgrafdat);
+
+  SCOTCH_stratInit (&stradat);                    /* Get locality permutation of shuffled graph */
+  if ((SCOTCH_stratGraphOrder (&stradat, "l{strat=s}") != 0) ||
+      (SCOTCH_graphOrder (&rndgrafdat.grafdat, &stradat, permtab, peritab, NULL, NULL, NULL) != 0)) {
+    SCOTCH_errorPrint ("main: cannot compute locality permutation");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Un-base permutation arrays */
+    permtab[vertnum] -= baseval;
+    peritab[vertnum] -= baseval;
+    if ((permtab[vertnum] < 0) || (permtab[vertnum] >= vertnbr)) {
+      SCOTCH_errorPrint ("main: invalid locality permutation (1)");
+      exit (EXIT_FAILURE);
+    }
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    if (peritab[permtab[vertnum]] != vertnum) {
+      SCOTCH_errorPrint ("main: invalid locality permutation (2)");
+      exit (EXIT_FAILURE);
+    }
+  }
+  testGraphPerm (&rndgrafdat.grafdat, permtab, peritab, &prmgrafdat);
+
+  {                                               /* Equality checks require a deterministic, single-threaded context */
+    SCOTCH_Context      contdat;
+    SCOTCH_Graph        ctxgraftab[2];            /* Shuffled and relabeled graphs, bound to context */
+
+    SCOTCH_contextInit (&contdat);
+    SCOTCH_contextThreadSpawn (&contdat, 1, NULL);
+    SCOTCH_graphInit (&ctxgraftab[0]);
+    SCOTCH_graphInit (&ctxgraftab[1]);
+    if ((SCOTCH_contextBindGraph (&contdat, &rndgrafdat.grafdat, &ctxgraftab[0]) != 0) ||
+        (SCOTCH_contextBindGraph (&contdat, &prmgrafdat.grafdat, &ctxgraftab[1]) != 0)) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
+
+    testCompute (&ctxgraftab[0], &archdat, "l{strat=" STRATMAP "}", datatab[1]);
+    testCompute (&ctxgraftab[1], &archdat, STRATMAP, datatab[0]);
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Mapping must be the one of the relabeled graph */
+      if (datatab[1][vertnum] != datatab[0][permtab[vertnum]]) {
+        SCOTCH_errorPrint ("main: invalid relabeled mapping");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    testCompute (&ctxgraftab[0], NULL, "l{strat=" STRATORDER "}", datatab[1]);
+    testCompute (&ctxgraftab[1], NULL, STRATORDER, datatab[0]);
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Ordering must be the one of the relabeled graph */
+      if (datatab[1][vertnbr + vertnum] != peritab[datatab[0][vertnbr + vertnum] - baseval] + baseval) {
+        SCOTCH_errorPrint ("main: invalid relabeled ordering");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    SCOTCH_graphExit   (&ctxgraftab[1]);          /* Free context graphs before their bound context */
+    SCOTCH_graphExit   (&ctxgraftab[0]);
+    SCOTCH_contextExit (&contdat);
+  }
+
+  free (datatab[1]);
+  free (datatab[0]);
+  free (peritab);
+  free (permtab);
+
+  testGraphExit (&prmgrafdat);
+  testGraphExit (&rndgrafdat);
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&orggrafdat);
+
+  exit (EXIT_SUCCESS);
+}
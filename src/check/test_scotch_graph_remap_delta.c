@@ -0,0 +1,300 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_remap_delta.c         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_graphRemapDeltaCompute()     **/
+/**                and SCOTCH_graphRepartDelta() routines. **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_PARTNBR                4             /* Number of parts                */
+#define TEST_VDLTNBR                4             /* Size of changed vertex array   */
+#define TEST_DISTMAX                2             /* Largest band width tested      */
+
+/*************************/
+/*                       */
+/* The testing routines. */
+/*                       */
+/*************************/
+
+/* This routine computes the distance of every
+** vertex to the closest changed or new vertex,
+** by breadth-first search.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+testDist (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Num * const    parotab,              /* Old part array, -1 for new vertices */
+const SCOTCH_Num * const    vdlttab,              /* Based changed vertices              */
+SCOTCH_Num * const          disttab,              /* Distance array to fill              */
+SCOTCH_Num * const          queutab)              /* Vertex queue                        */
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num          queuhead;
+  SCOTCH_Num          queutail;
+  int                 vdltnum;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    disttab[vertnum] = -1;
+
+  queutail = 0;
+  for (vdltnum = 0; vdltnum < TEST_VDLTNBR; vdltnum ++) {
+    vertnum = vdlttab[vdltnum] - baseval;
+    if (disttab[vertnum] < 0) {
+      disttab[vertnum]    = 0;
+      queutab[queutail ++] = vertnum;
+    }
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    if ((parotab[vertnum] < 0) && (disttab[vertnum] < 0)) {
+      disttab[vertnum]    = 0;
+      queutab[queutail ++] = vertnum;
+    }
+  }
+
+  for (queuhead = 0; queuhead < queutail; queuhead ++) {
+    SCOTCH_Edge         edgenum;
+
+    vertnum = queutab[queuhead];
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          vertend;
+
+      vertend = edgetab[edgenum - baseval] - baseval;
+      if (disttab[vertend] < 0) {
+        disttab[vertend]     = disttab[vertnum] + 1;
+        queutab[queutail ++] = vertend;
+      }
+    }
+  }
+}
+
+/* This routine checks that the given updated
+** part array is consistent with the old one:
+** all parts are valid, and all old vertices
+** located farther than the given distance from
+** changed vertices keep their old part.
+** It returns:
+** - 0   : if the part array is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testCheck (
+const SCOTCH_Num            vertnbr,
+const SCOTCH_Num * const    parotab,
+const SCOTCH_Num * const    parttab,
+const SCOTCH_Num * const    disttab,
+const SCOTCH_Num            distval,
+const SCOTCH_Num            partnbr)
+{
+  SCOTCH_Num          vertnum;
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    if ((parttab[vertnum] < 0) || (parttab[vertnum] >= partnbr)) {
+      SCOTCH_errorPrint ("testCheck: vertex not placed");
+      return (1);
+    }
+    if ((parotab[vertnum] >= 0) &&                /* Old vertices outside band must keep their part */
+        ((disttab[vertnum] < 0) || (disttab[vertnum] > distval)) &&
+        (parttab[vertnum] != parotab[vertnum])) {
+      SCOTCH_errorPrint ("testCheck: vertex outside band moved");
+      return (1);
+    }
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Mapping      mappdat;
+  SCOTCH_Mapping      mapodat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;                    /* Initial partition                  */
+  SCOTCH_Num *        parotab;                    /* Old partition, with a new vertex   */
+  SCOTCH_Num *        pardtab;                    /* Updated partition                  */
+  SCOTCH_Num *        disttab;
+  SCOTCH_Num *        queutab;
+  SCOTCH_Num          vdlttab[TEST_VDLTNBR];
+  SCOTCH_Num          distval;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  if (((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((pardtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((disttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((queutab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);
+  if (SCOTCH_graphPart (&grafdat, TEST_PARTNBR, &stradat, parttab) != 0) { /* Compute initial partition */
+    SCOTCH_errorPrint ("main: cannot compute partition");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+
+  memcpy (parotab, parttab, vertnbr * sizeof (SCOTCH_Num)); /* Work on a copy of the initial partition */
+  parotab[vertnbr - 1] = -1;                      /* Last vertex is a new vertex                   */
+  vdlttab[0] = baseval + 1;                       /* Changed vertices are based                    */
+  vdlttab[1] = baseval + vertnbr / 2;
+  vdlttab[2] = baseval + vertnbr / 2;             /* Duplicate changed vertex                      */
+  vdlttab[3] = baseval + vertnbr - 1;             /* New vertex may also be a changed vertex       */
+
+  testDist (&grafdat, parotab, vdlttab, disttab, queutab);
+
+  for (distval = 0; distval <= TEST_DISTMAX; distval ++) {
+    printf ("Distance %ld\n", (long) distval);
+
+    SCOTCH_stratInit (&stradat);                  /* Default band graph strategy */
+    if (SCOTCH_graphRepartDelta (&grafdat, TEST_PARTNBR, parotab, 0.2, NULL, TEST_VDLTNBR, vdlttab, distval, &stradat, pardtab) != 0) {
+      SCOTCH_errorPrint ("main: cannot update partition");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    if (testCheck (vertnbr, parotab, pardtab, disttab, distval, TEST_PARTNBR) != 0) {
+      SCOTCH_errorPrint ("main: invalid updated partition");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  if (SCOTCH_archInit (&archdat) != 0) {          /* Remap onto a mesh, with same old mapping */
+    SCOTCH_errorPrint ("main: cannot initialize architecture");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_archMesh2 (&archdat, 2, 2);
+
+  SCOTCH_graphMapInit (&grafdat, &mappdat, &archdat, pardtab);
+  SCOTCH_graphMapInit (&grafdat, &mapodat, &archdat, parotab);
+  SCOTCH_stratInit (&stradat);
+  SCOTCH_stratGraphMap (&stradat, "f{bal=0.05,move=80}");
+  if (SCOTCH_graphRemapDeltaCompute (&grafdat, &mappdat, &mapodat, 0.2, NULL, TEST_VDLTNBR, vdlttab, 1, &stradat) != 0) {
+    SCOTCH_errorPrint ("main: cannot update mapping");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_graphMapExit (&grafdat, &mapodat);
+  SCOTCH_graphMapExit (&grafdat, &mappdat);
+
+  if (testCheck (vertnbr, parotab, pardtab, disttab, 1, TEST_PARTNBR) != 0) {
+    SCOTCH_errorPrint ("main: invalid updated mapping");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&grafdat);
+
+  free (queutab);
+  free (disttab);
+  free (pardtab);
+  free (parotab);
+  free (parttab);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,206 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_mesh_part.c                 **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_meshPart() routine.          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Mesh         meshdat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          velmbas;
+  SCOTCH_Num          vnodbas;
+  SCOTCH_Num          velmnbr;
+  SCOTCH_Num          vnodnbr;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        vnlotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num          velosum;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        loadtab;
+  SCOTCH_Num *        flagtab;
+  SCOTCH_Num          partnbr;
+  int                 stranum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s mesh_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_meshInit (&meshdat) != 0) {          /* Initialize source mesh */
+    SCOTCH_errorPrint ("main: cannot initialize mesh");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_meshLoad (&meshdat, fileptr, -1) != 0) { /* Read source mesh */
+    SCOTCH_errorPrint ("main: cannot load mesh");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_meshData (&meshdat, &velmbas, &vnodbas, &velmnbr, &vnodnbr,
+                   &verttab, &vendtab, &velotab, &vnlotab, NULL, NULL, &edgetab, NULL);
+  baseval = MIN (velmbas, vnodbas);
+
+  if (((parttab = malloc (velmnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((loadtab = malloc (64      * sizeof (SCOTCH_Num))) == NULL) ||
+      ((flagtab = malloc (64      * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (stranum = 0; stranum < 2; stranum ++) {    /* For default and speed strategies */
+    for (partnbr = 1; partnbr <= 64; partnbr *= 4) {
+      SCOTCH_Num          velmnum;
+      SCOTCH_Num          vnodnum;
+      SCOTCH_Num          partnum;
+      SCOTCH_Num          loadmax;
+      SCOTCH_Num          commload;
+
+      SCOTCH_stratInit (&stradat);
+      if ((stranum == 1) &&
+          (SCOTCH_stratMeshPartBuild (&stradat, SCOTCH_STRATSPEED, partnbr, 0.05) != 0)) {
+        SCOTCH_errorPrint ("main: cannot build strategy");
+        exit (EXIT_FAILURE);
+      }
+
+      if (SCOTCH_meshPart (&meshdat, partnbr, &stradat, parttab) != 0) {
+        SCOTCH_errorPrint ("main: cannot partition mesh (" SCOTCH_NUMSTRING ")", partnbr);
+        exit (EXIT_FAILURE);
+      }
+
+      memset (loadtab, 0, partnbr * sizeof (SCOTCH_Num));
+      for (velmnum = 0, velosum = 0; velmnum < velmnbr; velmnum ++) {
+        SCOTCH_Num          veloval;
+
+        if ((parttab[velmnum] < 0) || (parttab[velmnum] >= partnbr)) {
+          SCOTCH_errorPrint ("main: invalid part number (" SCOTCH_NUMSTRING ")", partnbr);
+          exit (EXIT_FAILURE);
+        }
+        veloval = (velotab != NULL) ? velotab[velmnum] : 1;
+        loadtab[parttab[velmnum]] += veloval;
+        velosum += veloval;
+      }
+      for (partnum = 0, loadmax = 0; partnum < partnbr; partnum ++) {
+        if (loadtab[partnum] > loadmax)
+          loadmax = loadtab[partnum];
+      }
+      if ((double) loadmax > ((double) velosum / (double) partnbr) * 1.10 + 1.0) { /* Allow some slack over requested imbalance */
+        SCOTCH_errorPrint ("main: partition is too imbalanced (" SCOTCH_NUMSTRING ")", partnbr);
+        exit (EXIT_FAILURE);
+      }
+
+      memset (flagtab, ~0, partnbr * sizeof (SCOTCH_Num));
+      for (vnodnum = 0, commload = 0; vnodnum < vnodnbr; vnodnum ++) { /* Compute (lambda - 1) connectivity */
+        SCOTCH_Num          vertnum;
+        SCOTCH_Edge         edgenum;
+        SCOTCH_Num          spannbr;
+
+        vertnum = vnodnum + vnodbas - baseval;
+        for (edgenum = verttab[vertnum], spannbr = 0; edgenum < vendtab[vertnum]; edgenum ++) {
+          SCOTCH_Num          partend;
+
+          partend = parttab[edgetab[edgenum - baseval] - velmbas];
+          if (flagtab[partend] != vnodnum) {      /* If part not yet spanned by node */
+            flagtab[partend] = vnodnum;
+            spannbr ++;
+          }
+        }
+        if (spannbr > 1)
+          commload += (spannbr - 1) * ((vnlotab != NULL) ? vnlotab[vnodnum] : 1);
+      }
+      if ((partnbr == 1) && (commload != 0)) {
+        SCOTCH_errorPrint ("main: invalid connectivity for one part");
+        exit (EXIT_FAILURE);
+      }
+
+      printf ("Strategy %d, parts " SCOTCH_NUMSTRING ": maximum load " SCOTCH_NUMSTRING ", connectivity " SCOTCH_NUMSTRING "\n",
+              stranum, partnbr, loadmax, commload);
+
+      SCOTCH_stratExit (&stradat);
+    }
+  }
+
+  free (flagtab);
+  free (loadtab);
+  free (parttab);
+  SCOTCH_meshExit (&meshdat);
+
+  exit (EXIT_SUCCESS);
+}
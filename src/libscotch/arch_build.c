@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.0  : from : 28 jun 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 18 feb 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -150,8 +150,8 @@ Context * const             contptr)              /*+ Execution context
   Gnum                              actpartnbr;   /* Size of part value to put to subjob            */
   Gnum                              termdomnum;
 
-  const Gnum * restrict const tgtverttax = tgtgrafptr->verttax;
-  const Gnum * restrict const tgtvendtax = tgtgrafptr->vendtax;
+  const Genum * restrict const tgtverttax = tgtgrafptr->verttax;
+  const Genum * restrict const tgtvendtax = tgtgrafptr->vendtax;
   const Gnum * restrict const tgtedgetax = tgtgrafptr->edgetax;
   const Gnum * restrict const tgtedlotax = tgtgrafptr->edlotax;
 
@@ -332,7 +332,7 @@ Context * const             contptr)              /*+ Execution context
     while (queuhead < queutail) {                 /* As long as there are vertices in queue */
       Gnum                vertnum;                /* Number of current vertex               */
       Gnum                vertdist;               /* Current distance value                 */
-      Gnum                edgenum;
+      Genum               edgenum;
 
       vertnum  = queutab[queuhead].vertnum;       /* Retrieve vertex from queue */
       vertdist = queutab[queuhead ++].distval;
@@ -1,4 +1,4 @@
-/* Copyright 2015,2016,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2015,2016,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 02 may 2015     **/
 /**                                 to   : 22 feb 2018     **/
 /**                # Version 7.0  : from : 03 aug 2016     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The code of the main routine derives  **/
 /**                  from that of archSubArchBuild().      **/
@@ -192,7 +192,7 @@ Context * const                       contptr)
   }
 
   if (matcptr->levltab[0].grafdat.edlotax != NULL) { /* If original graph has edge loads */
-    Gnum                edgenbr;
+    Genum               edgenbr;
 
     edgenbr = matcptr->levltab[0].grafdat.edgenbr;
     if ((matcptr->lewgtab[0].edwgtab = memAlloc (edgenbr * sizeof (Gnum))) == NULL) {
@@ -225,8 +225,8 @@ ArchCoarsenMulti * restrict * restrict const  multptr)
   const Gnum * restrict           fineedwgtax;
   const Gnum * restrict           finevewgtax;
   const Gnum * restrict           fineedgetax;
-  const Gnum * restrict           fineverttax;
-  const Gnum * restrict           finevendtax;
+  const Genum * restrict           fineverttax;
+  const Genum * restrict           finevendtax;
   Anum                            finevertnbr;
   Gnum * restrict                 finecoartax;
   const ArchDeco2Levl * restrict  finelevlptr;
@@ -241,7 +241,7 @@ ArchCoarsenMulti * restrict * restrict const  multptr)
   Gnum                            coarvertnum;
   Gnum                            coarvertsum;    /* Sum of all coarse vertices kept in coarsening tree       */
   Gnum * restrict                 coarvelotax;
-  Gnum                            coaredgenum;
+  Genum                           coaredgenum;
   ArchDeco2BuildHash * restrict   coarhashtab;
   Gnum                            coarhashmax;
   Gnum                            coarhashsiz;
@@ -335,7 +335,7 @@ ArchCoarsenMulti * restrict * restrict const  multptr)
   coaredwgsum = 0;
   for (coarvertnum = coaredgenum = coargrafptr->baseval, coarvertnnd = coargrafptr->vertnnd, coarvertsum = 0;
        coarvertnum < coarvertnnd; coarvertnum ++) {
-    Gnum                coaredgetmp;
+    Genum               coaredgetmp;
     Gnum                coarvewgval;              /* Aggregated vertex traversal cost */
     Gnum                coaredwgval;              /* Aggregated edge traversal cost   */
     Gnum                finevertnum;
@@ -350,7 +350,7 @@ ArchCoarsenMulti * restrict * restrict const  multptr)
 
     i = 0;
     do {                                          /* For all fine edges of multinode vertices */
-      Gnum                fineedgenum;
+      Genum               fineedgenum;
 
       finevertnum = coarmulttax[coarvertnum].vertnum[i];
 
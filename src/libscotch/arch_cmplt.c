@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2011,2015,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2011,2015,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 02 may 2015     **/
 /**                # Version 7.0  : from : 18 feb 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -301,8 +301,7 @@ const ArchCmplt * const     archptr,
 const ArchCmpltDom * const  dom0ptr,
 const ArchCmpltDom * const  dom1ptr)
 {
-  return (((dom0ptr->termmin == dom1ptr->termmin) && /* All domains are at distance 1 */
-           (dom0ptr->termnbr == dom1ptr->termnbr)) ? 0 : 1); /* If they are different */
+  return (archCmpltDomDist2 (dom0ptr, dom1ptr));  /* All different domains are at distance 1 */
 }
 
 /* This function sets the biggest
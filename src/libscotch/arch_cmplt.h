@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2015,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2015,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -65,7 +65,7 @@
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 28 may 2018     **/
 /**                # Version 7.0  : from : 18 feb 2018     **/
-/**                                 to   : 18 feb 2018     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -87,6 +87,13 @@ typedef struct ArchCmpltDom_ {
   Anum                      termnbr;              /*+ Number of vertices    +*/
 } ArchCmpltDom;
 
+/*+ Inlined distance computation, for the
+    code paths specialized for complete
+    graph architectures.                  +*/
+
+#define archCmpltDomDist2(dom0,dom1) ((((dom0)->termmin == (dom1)->termmin) && \
+                                       ((dom0)->termnbr == (dom1)->termnbr)) ? 0 : 1)
+
 typedef struct ArchCmpltMatch_ {
   ArchCoarsenMulti *        multtab;              /*+ Multinode array for all coarsenings +*/
   Anum                      vertnbr;              /*+ Number of vertices in fine graph    +*/
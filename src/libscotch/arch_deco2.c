@@ -1,4 +1,4 @@
-/* Copyright 2015-2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2015-2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 30 apr 2015     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 18 feb 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -590,8 +590,8 @@ const ArchDeco2Dom * const  dom1ptr)
   disttax -= baseval;
 
   while (1) {                                     /* As long as coarsest graph not hit */
-    const Gnum * restrict         verttax;
-    const Gnum * restrict         vendtax;
+    const Genum * restrict         verttax;
+    const Genum * restrict         vendtax;
     const Gnum * restrict         velotax;
     const Gnum * restrict         edgetax;
     const Gnum * restrict         edlotax;
@@ -635,8 +635,8 @@ const ArchDeco2Dom * const  dom1ptr)
     queuheadidx = 2;
     while (queutailidx != queuheadidx) {
       Gnum                vertnum;
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
       Gnum                distval;
 
 loop: vertnum = queutab[queutailidx ++];          /* Get vertex number from queue        */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2015,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2015,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 19 feb 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The vertices of the (dX,dY) mesh are  **/
 /**                  numbered as terminals so that         **/
@@ -218,10 +218,7 @@ const ArchMesh2 * const    archptr,
 const ArchMesh2Dom * const dom0ptr,
 const ArchMesh2Dom * const dom1ptr)
 {
-  return (((abs (dom0ptr->c[0][0] + dom0ptr->c[0][1] -
-                 dom1ptr->c[0][0] - dom1ptr->c[0][1]) + 1) / 2) +
-          ((abs (dom0ptr->c[1][0] + dom0ptr->c[1][1] -
-                 dom1ptr->c[1][0] - dom1ptr->c[1][1]) + 1) / 2));
+  return (archMesh2DomDist2 (dom0ptr, dom1ptr));
 }
 
 /* These functions try to split a rectangular
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2015,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2015,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -65,7 +65,7 @@
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 28 may 2018     **/
 /**                # Version 7.0  : from : 19 feb 2018     **/
-/**                                 to   : 19 feb 2018     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -105,6 +105,13 @@ typedef struct ArchMeshXMatch_ {
 #define ArchMesh2Dom                ArchMeshXDom
 #define ArchMesh2Match              ArchMeshXMatch
 
+/*+ Inlined distance computation, for the
+    code paths specialized for 2D mesh
+    architectures.                        +*/
+
+#define archMesh2DomDist2(dom0,dom1) (((abs ((dom0)->c[0][0] + (dom0)->c[0][1] - (dom1)->c[0][0] - (dom1)->c[0][1]) + 1) / 2) + \
+                                      ((abs ((dom0)->c[1][0] + (dom0)->c[1][1] - (dom1)->c[1][0] - (dom1)->c[1][1]) + 1) / 2))
+
 /*+ The 3D-mesh definitions. +*/
 
 #define ArchMesh3                   ArchMeshX
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -65,7 +65,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 22 feb 2023     **/
-/**                                 to   : 22 feb 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -90,6 +90,11 @@
 /* This routine builds the active graph
 ** corresponding to the given bipartitioning
 ** job parameters.
+** When a memory arena is provided, the part
+** and frontier arrays are stacked on top of
+** it, and are not freed by bgraphExit(). They
+** will be reclaimed when the caller releases
+** the arena to a mark taken before the call.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -101,7 +106,8 @@ Bgraph * restrict const         actgrafptr,       /*+ Active graph
 const Graph * restrict const    srcgrafptr,       /*+ Source graph                  +*/
 const Arch * restrict const     archptr,          /*+ Target architecture           +*/
 const ArchDom * restrict const  domnsubtab,       /*+ Array of the two subdomains   +*/
-const Gnum * restrict const     vflowgttab)       /*+ Array of vertex weight biases +*/
+const Gnum * restrict const     vflowgttab,       /*+ Array of vertex weight biases +*/
+MemArena * const                arenptr)          /*+ Memory arena to use, or NULL  +*/
 {
   Anum                domndist;                   /* Distance between both subdomains   */
   Anum                domnwght0;                  /* Processor workforce in each domain */
@@ -116,9 +122,18 @@ const Gnum * restrict const     vflowgttab)       /*+ Array of vertex weight bia
   actgrafptr->s.vlbltax = NULL;                   /* Remove vertex labels    */
   actgrafptr->veextax   = NULL;                   /* No external gains (yet) */
 
-  if (((actgrafptr->parttax = memAlloc (actgrafptr->s.vertnbr * sizeof (GraphPart))) == NULL) ||
-      ((actgrafptr->frontab = memAlloc (actgrafptr->s.vertnbr * sizeof (Gnum)))      == NULL)) {
-    errorPrint ("bgraphInit: out of memory");
+  if (arenptr != NULL) {                          /* If arrays to be allocated on top of memory arena */
+    if (memArenaAllocGroup (arenptr, (void **) (void *)
+                            &actgrafptr->parttax, (size_t) (actgrafptr->s.vertnbr * sizeof (GraphPart)),
+                            &actgrafptr->frontab, (size_t) (actgrafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL) {
+      errorPrint ("bgraphInit: out of memory (1)");
+      return (1);
+    }
+    actgrafptr->s.flagval &= ~(BGRAPHFREEFRON | BGRAPHFREEPART); /* Arrays will be released along with arena */
+  }
+  else if (((actgrafptr->parttax = memAlloc (actgrafptr->s.vertnbr * sizeof (GraphPart))) == NULL) ||
+           ((actgrafptr->frontab = memAlloc (actgrafptr->s.vertnbr * sizeof (Gnum)))      == NULL)) {
+    errorPrint ("bgraphInit: out of memory (2)");
     if (actgrafptr->parttax != NULL)
       memFree (actgrafptr->parttax);
     return (1);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 07 nov 2011     **/
 /**                                 to   : 31 aug 2019     **/
 /**                # Version 7.0  : from : 28 aug 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -96,17 +96,17 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
   Gnum                        bndvlvlnum;         /* Index of first band graph vertex to belong to the last layer */
   Gnum                        bndvertnum;
   Gnum                        bndeancnbr;         /* Number of anchor edges                                       */
-  Gnum                        bndedgenbr;         /* Upper bound on the number of edges, including anchor edges   */
-  Gnum                        bndedgenum;
+  Genum                       bndedgenbr;         /* Upper bound on the number of edges, including anchor edges   */
+  Genum                       bndedgenum;
   Gnum * restrict             bndedgetax;
   Gnum * restrict             bndedlotax;
-  Gnum                        bndedgetmp;
+  Genum                       bndedgetmp;
   Gnum                        bnddegrmax;
   Gnum                        bndcommgainextn;    /* Sum of all external gains in band graph                      */
   Gnum                        bndcommgainextn1;   /* Sum of external gains accounted for in load, since in part 1 */
   size_t                      bndedlooftval;      /* Offset of edge load array with respect to edge array         */
-  const Gnum * restrict const orgverttax = orggrafptr->s.verttax; /* Fast accesses                                */
-  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->s.verttax; /* Fast accesses                                */
+  const Genum * restrict const orgvendtax = orggrafptr->s.vendtax;
   const Gnum * restrict const orgvelotax = orggrafptr->s.velotax;
   const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
   const Gnum * restrict const orgedlotax = orggrafptr->s.edlotax;
@@ -149,7 +149,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
     bndvlvlnum = queuheadval;                     /* Record start of last layer         */
     while (queutailval < bndvlvlnum) {            /* For all vertices in queue          */
       Gnum                orgvertnum;
-      Gnum                orgedgenum;
+      Genum               orgedgenum;
       Gnum                orgpartval;
 
       orgvertnum = queutab[queutailval ++];
@@ -228,7 +228,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
 
   bndveexnbr = (orggrafptr->veextax != NULL) ? bndvertnbr : 0;
   if (memAllocGroup ((void **) (void *)           /* Do not allocate vnumtax but keep queutab instead */
-                     &bndgrafdat.s.verttax, (size_t) ((bndvertnbr + 1) * sizeof (Gnum)),
+                     &bndgrafdat.s.verttax, (size_t) ((bndvertnbr + 1) * sizeof (Genum)),
                      &bndgrafdat.s.velotax, (size_t) (bndvertnbr       * sizeof (Gnum)),
                      &bndveextax,           (size_t) (bndveexnbr       * sizeof (Gnum)),
                      &bndgrafdat.frontab,   (size_t) (bndvertnbr       * sizeof (Gnum)),
@@ -272,7 +272,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
        bndvertnum < bndvlvlnum; bndvertnum ++) {  /* Fill index array for vertices not belonging to last level */
     Gnum                orgvertnum;
     GraphPart           orgpartval;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
     Gnum                orgedloval;
     Gnum                bnddegrval;
 
@@ -314,7 +314,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
   bndeancnbr = 0;
   for ( ; bndvertnum < bndvertnnd; bndvertnum ++) { /* Fill index array for vertices belonging to last level */
     Gnum                orgvertnum;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
     GraphPart           orgpartval;
     Gnum                bnddegrval;
     Gnum                orgedloval;
@@ -440,7 +440,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
     Gnum                bndcommloadintn;
     Gnum                bndfronnnd;
     Gnum                bndvertnum;
-    Gnum                bndedgenum;
+    Genum               bndedgenum;
 
     bndcommloadintn = 0;
     for (bndvertnum = orggrafptr->s.baseval, bndfronnnd = bndvertnum + orggrafptr->fronnbr; /* Compute communication load at frontier */
@@ -551,7 +551,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
          bndedgenum < bndgrafdat.s.vendtax[bndvertnum]; bndedgenum ++) {
       Gnum                bndvertend;             /* Index of neighbor of anchor vertex in band graph     */
       Gnum                orgvertnum;             /* Index of neighbor of anchor vertex in original graph */
-      Gnum                orgedgenum;
+      Genum               orgedgenum;
 
       bndvertend = bndedgetax[bndedgenum];
       if (bndgrafdat.parttax[bndvertend] == ancpartval) /* If neighbor is in same part as anchor, skip to next */
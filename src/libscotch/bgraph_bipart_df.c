@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011-2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011-2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.0  : from : 07 nov 2011     **/
 /**                                 to   : 08 aug 2013     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -178,8 +178,8 @@ BgraphBipartDfData * restrict const loopptr)
   const int                           thrdnum = 0;
 #endif /* BGRAPHBIPARTDFNOTHREAD */
   Bgraph * restrict const             grafptr = loopptr->grafptr;
-  const Gnum * restrict const         verttax = grafptr->s.verttax;
-  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Genum * restrict const         verttax = grafptr->s.verttax;
+  const Genum * restrict const         vendtax = grafptr->s.vendtax;
   const Gnum * restrict const         velotax = grafptr->s.velotax;
   const Gnum * restrict const         edgetax = grafptr->s.edgetax;
   const Gnum * restrict const         edlotax = grafptr->s.edlotax;
@@ -226,8 +226,8 @@ BgraphBipartDfData * restrict const loopptr)
     if (edlotax == NULL)                          /* If graph doesn't have edge weights */
       edlosum = vendtax[vertnum] - verttax[vertnum];
     else {
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
 
       for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum], edlosum = 0;
            edgenum < edgennd; edgenum ++)
@@ -301,8 +301,8 @@ skip :
     vancnnt  = vancnnd;                           /* Loop until end of (regular) vertex block    */
     while (1) {
       for ( ; vertnum < vancnnt; vertnum ++) {
-        Gnum                edgenum;
-        Gnum                edgennd;
+        Genum               edgenum;
+        Genum               edgennd;
         float               diffval;
 
         edgenum = verttax[vertnum];
@@ -404,7 +404,7 @@ skip :
   veloval = 1;
   for (vertnum = vertbas, fronnbr = 0, commloadextn = commgainextn = commloadintn = compload1 = compsize1 = 0;
        vertnum < vertnnd; vertnum ++) {
-    Gnum                edgenum;
+    Genum               edgenum;
     Gnum                partval;
     Gnum                commload;                 /* Vertex internal communication load */
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2016,2019,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2016,2019,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -67,7 +67,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 20 aug 2019     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 25 jan 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -264,6 +264,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   Gnum                            hashmax;
   Gnum                            hashnbr;
   void *                          hashtmp;        /* Temporary variable to avoid "restrict"   */
+  MemArena *                      arenptr;        /* Memory arena of context, if any          */
+  MemArenaMark                    markdat;        /* Arena state before hash table allocation */
   Gnum                            comploadsum;    /* Overall vertex load sum, including fixed */
   Gnum                            compload0dltmit; /* Theoretical smallest imbalance allowed  */
   Gnum                            compload0dltmat; /* Theoretical largest imbalance allowed   */
@@ -281,8 +283,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   Gnum                            fronnum;
   BgraphBipartFmType              typeval;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Gnum * restrict const edlotax = grafptr->s.edlotax;
@@ -332,16 +334,25 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;
 
-  if (bgraphBipartFmTablInit (&tabldat) != 0) {
+  arenptr = contextArena (grafptr->contptr);      /* Tables are stacked on arena if it is available */
+
+  if (bgraphBipartFmTablInit (&tabldat, arenptr) != 0) {
     errorPrint ("bgraphBipartFm: internal error (1)"); /* Unable to do proper initialization */
     bgraphBipartFmTablExit (&tabldat);
     return (1);
   }
 
   tablptr = &tabldat;
-  if (memAllocGroup ((void **) (void *)
-                     &hashtmp, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
-                     &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL) {
+  if (arenptr != NULL)
+    memArenaMark (arenptr, &markdat);
+  if (((arenptr == NULL) &&
+       (memAllocGroup ((void **) (void *)
+                       &hashtmp, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
+                       &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL)) ||
+      ((arenptr != NULL) &&
+       (memArenaAllocGroup (arenptr, (void **) (void *)
+                            &hashtmp, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
+                            &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL))) {
     errorPrint ("bgraphBipartFm: out of memory (1)");
     bgraphBipartFmTablExit (tablptr);
     return (1);
@@ -357,7 +368,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
     for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) { /* Set initial gains */
       Gnum                veloval;
       Gnum                hashnum;
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                edloval;
       Gnum                commcut;
       Gnum                commgain;
@@ -402,7 +413,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
       Gnum                vertnum;
       Gnum                veloval;
       Gnum                hashnum;
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                edloval;
       Gnum                commcut;
       Gnum                commgain;
@@ -518,7 +529,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
            ((vexxptr = (BgraphBipartFmVertex *) bgraphBipartFmTablGet (tablptr, compload0dlt, compload0dltmin, compload0dltmax)) != NULL)) {
       Gnum               vertnum;                 /* Number of current vertex */
       int                partval;                 /* Part of current vertex   */
-      Gnum               edgenum;
+      Genum              edgenum;
       Gnum               edloval;
 
       bgraphBipartFmTablDel (tablptr, vexxptr);   /* Remove it from table */
@@ -596,9 +607,12 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
             int                 partdlt;
 
             if (hashnbr >= hashmax) {             /* If extended vertex table is already full */
-              if (bgraphBipartFmResize (&hashtab, &hashmax, &hashmsk, &savetab, savenbr, tablptr, &lockptr) != 0) {
+              if (bgraphBipartFmResize (&hashtab, &hashmax, &hashmsk, &savetab, savenbr, tablptr, &lockptr, arenptr) != 0) {
                 errorPrint ("bgraphBipartFm: out of memory (2)");
-                memFree    (hashtab);             /* Free group leader */
+                if (arenptr != NULL)              /* Free group leader */
+                  memArenaRelease (arenptr, &markdat);
+                else
+                  memFree (hashtab);
                 bgraphBipartFmTablExit (tablptr);
               }
               for (hashnum = (vertend * BGRAPHBIPARTFMHASHPRIME) & hashmsk; hashtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ; /* Search for new first free slot */
@@ -846,7 +860,10 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
 
-  memFree (hashtab);                              /* Free group leader */
+  if (arenptr != NULL)                            /* Free group leader */
+    memArenaRelease (arenptr, &markdat);
+  else
+    memFree (hashtab);
   bgraphBipartFmTablExit (tablptr);
 
   return (0);
@@ -869,7 +886,8 @@ Gnum * const                      hashmskptr,     /*+ Pointer to hash table mask
 BgraphBipartFmSave * restrict *   savetabptr,     /*+ Move array                 +*/
 const Gnum                        savenbr,        /*+ Number of moves recorded   +*/
 BgraphBipartFmTabl *              tablptr,        /*+ Gain table                 +*/
-BgraphBipartFmVertex ** const     lockptr)        /*+ Pointer to locked list     +*/
+BgraphBipartFmVertex ** const     lockptr,        /*+ Pointer to locked list     +*/
+MemArena * const                  arenptr)        /*+ Memory arena, or NULL      +*/
 {
   BgraphBipartFmVertex * restrict hashtab;        /* Extended vertex array                        */
   BgraphBipartFmSave *            savetab;        /* Move backtracking array                      */
@@ -895,10 +913,24 @@ BgraphBipartFmVertex ** const     lockptr)        /*+ Pointer to locked list
   }
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
 
-  if (memReallocGroup ((void *) *hashtabptr,
-                       &hashtab, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
-                       &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL) {
-    errorPrint ("bgraphBipartFmResize: out of memory");
+  if (arenptr != NULL) {                          /* If group is on arena, resize it in the same way as memReallocGroup() */
+    byte *              hashptr;
+    size_t              saveoft;                  /* Offset of save array in new group */
+
+    saveoft = ((hashsiz * sizeof (BgraphBipartFmVertex)) + (sizeof (double) - 1)) & (~ (sizeof (double) - 1));
+    if ((hashptr = (byte *) memArenaRealloc (arenptr, (void *) *hashtabptr,
+                                             ((byte *) *savetabptr - (byte *) *hashtabptr) + hashold * sizeof (BgraphBipartFmSave),
+                                             saveoft + hashsiz * sizeof (BgraphBipartFmSave))) == NULL) {
+      errorPrint ("bgraphBipartFmResize: out of memory (1)");
+      return (1);
+    }
+    hashtab = (BgraphBipartFmVertex *) hashptr;
+    savetab = (BgraphBipartFmSave *) (hashptr + saveoft);
+  }
+  else if (memReallocGroup ((void *) *hashtabptr,
+                            &hashtab, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
+                            &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL) {
+    errorPrint ("bgraphBipartFmResize: out of memory (2)");
     return (1);
   }
 
@@ -1020,7 +1052,7 @@ const Gnum                                  commgainextn)
     Gnum                vertnum;
     Gnum                veloval;
     Gnum                veexval;
-    Gnum                edgenum;
+    Genum               edgenum;
     int                 partval;
     int                 partold;
     Gnum                commcut;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -61,7 +61,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 27 aug 2016     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -137,7 +137,7 @@ typedef struct BgraphBipartFmSave_ {
 
 static BgraphBipartFmVertex * bgraphBipartFmTablGet (BgraphBipartFmTabl * restrict const, const Gnum, const Gnum, const Gnum);
 
-static int                  bgraphBipartFmResize (BgraphBipartFmVertex * restrict *, Gnum * restrict const, Gnum * const, BgraphBipartFmSave * restrict *, const Gnum, BgraphBipartFmTabl * const, BgraphBipartFmVertex ** const);
+static int                  bgraphBipartFmResize (BgraphBipartFmVertex * restrict *, Gnum * restrict const, Gnum * const, BgraphBipartFmSave * restrict *, const Gnum, BgraphBipartFmTabl * const, BgraphBipartFmVertex ** const, MemArena * const);
 #ifdef SCOTCH_DEBUG_BGRAPH3
 static int                  bgraphBipartFmCheck (const Bgraph * restrict const, const BgraphBipartFmVertex * restrict const, const Gnum, const int, const Gnum, const Gnum, const Gnum);
 #endif /* SCOTCH_DEBUG_BGRAPH3 */
@@ -164,7 +164,7 @@ int                         bgraphBipartFm      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartFmTablInit(t)   (((*(t)) = gainTablInit (GAINMAX, BGRAPHBIPARTFMSUBBITS)) == NULL)
+#define bgraphBipartFmTablInit(t,a) (((*(t)) = gainTablInit (GAINMAX, BGRAPHBIPARTFMSUBBITS, GAINTABLTYPEFM, (a))) == NULL)
 #define bgraphBipartFmTablFree(t)   gainTablFree (*(t))
 #define bgraphBipartFmTablExit(t)   do {                     \
                                       if (*(t) != NULL)      \
@@ -197,7 +197,7 @@ int                         bgraphBipartFm      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartFmTablInit(t)   (fiboHeapInit ((t), bgraphBipartFmCmpFunc))
+#define bgraphBipartFmTablInit(t,a) (fiboHeapInit ((t), bgraphBipartFmCmpFunc))
 #define bgraphBipartFmTablFree(t)   fiboHeapFree (t)
 #define bgraphBipartFmTablExit(t)   fiboHeapExit (t)
 #define bgraphBipartFmTablAdd(t,v)  fiboHeapAdd ((t), &(v)->gainlink)
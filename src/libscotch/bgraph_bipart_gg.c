@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2013,2014,2016,2019,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2013,2014,2016,2019,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 01 may 2016     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -145,8 +145,8 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
   Anum                    domndist;
   Anum                    domndist2;              /* Two times domndist */
 
-  const Gnum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Gnum * const          edlotax = grafptr->s.edlotax; /* [norestrict] */
   const Gnum * restrict const veextax = grafptr->veextax;
@@ -181,7 +181,7 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
 
     for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
       Gnum                commload;
-      Gnum                edgenum;
+      Genum               edgenum;
 
       for (edgenum = verttax[vertnum], commload = 0;
            edgenum < vendtax[vertnum]; edgenum ++)
@@ -314,7 +314,7 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
 
     partval = grafptr->parttax[vertnum];
     if (partval > 1) {                            /* If vertex belongs to frontier of part 0 */
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                frontmp;                /* Temporary count value for frontier */
 
       grafptr->frontab[fronnum ++] = vertnum;     /* Then it belongs to the frontier */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -116,7 +116,7 @@ int                         bgraphBipartGg      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartGgTablInit(t)   (((*(t)) = gainTablInit (GAIN_LINMAX, BGRAPHBIPARTGGGAINTABLSUBBITS)) == NULL)
+#define bgraphBipartGgTablInit(t)   (((*(t)) = gainTablInit (GAIN_LINMAX, BGRAPHBIPARTGGGAINTABLSUBBITS, GAINTABLTYPELIST, NULL)) == NULL)
 #define bgraphBipartGgTablFree(t)   gainTablFree (*(t))
 #define bgraphBipartGgTablExit(t)   do {                     \
                                       if (*(t) != NULL)      \
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2014,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2014,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.0  : from : 08 aug 2014     **/
 /**                                 to   : 14 aug 2016     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -96,8 +96,8 @@ const BgraphBipartGpParam * const paraptr)        /*+ Method parameters +*/
   Gnum                            commloadextn;
   Gnum                            rootnum;        /* Index of potential next root */
 
-  const Gnum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Gnum * restrict const edlotax = grafptr->s.edlotax;
@@ -141,7 +141,7 @@ const BgraphBipartGpParam * const paraptr)        /*+ Method parameters +*/
       do {                                        /* Loop on vertices in queue */
         Gnum                vertnum;
         Gnum                distval;
-        Gnum                edgenum;
+        Genum               edgenum;
 
         vertnum = bgraphBipartGpQueueGet (&queudat); /* Get vertex from queue */
         distval = vexxtax[vertnum].distval;       /* Get vertex distance      */
@@ -177,7 +177,7 @@ const BgraphBipartGpParam * const paraptr)        /*+ Method parameters +*/
     do {                                          /* Loop on vertices in queue */
       Gnum                vertnum;
       Gnum                distval;
-      Gnum                edgenum;
+      Genum               edgenum;
 
       vertnum = bgraphBipartGpQueueGet (&queudat); /* Get vertex from queue         */
       grafptr->parttax[vertnum] = 1;              /* Move selected vertex to part 1 */
@@ -207,7 +207,7 @@ const BgraphBipartGpParam * const paraptr)        /*+ Method parameters +*/
       edloval = 1;                                /* Assume no edge loads */
       do {
         Gnum                vertnum;
-        Gnum                edgenum;
+        Genum               edgenum;
 
         vertnum = bgraphBipartGpQueueGet (&queudat); /* Get vertex from queue */
         grafptr->frontab[fronnbr ++] = vertnum;
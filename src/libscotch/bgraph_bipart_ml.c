@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2011,2014,2015,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2011,2014,2015,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 16 aug 2015     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -193,8 +193,8 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multin
   Gnum                        finecompsize1;
 
   const GraphCoarsenMulti * const coarmulttax = coarmulttab - finegrafptr->s.baseval;
-  const Gnum * restrict const     fineverttax = finegrafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const     finevendtax = finegrafptr->s.vendtax;
+  const Genum * restrict const     fineverttax = finegrafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const     finevendtax = finegrafptr->s.vendtax;
   const Gnum * restrict const     fineedgetax = finegrafptr->s.edgetax;
 
   if (finegrafptr->parttax == NULL) {             /* If partition array not yet allocated */
@@ -251,7 +251,7 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multin
 
     if (finevertnum0 != finevertnum1) {           /* If multinode is made of two distinct vertices */
       GraphPart           coarpartval;
-      Gnum                fineedgenum;
+      Genum               fineedgenum;
 
       coarpartval = coarparttax[coarvertnum];
 
@@ -0,0 +1,628 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_pf.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module bipartitions an active      **/
+/**                graph using a multithreaded version of  **/
+/**                the Fiduccia-Mattheyses heuristic.      **/
+/**                Every thread performs a localized       **/
+/**                search on the frontier vertices of its  **/
+/**                own vertex range, the rest of the graph **/
+/**                being frozen; moves are then committed  **/
+/**                concurrently, and conflicting moves are **/
+/**                resolved before the new partition is    **/
+/**                evaluated.                              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_BGRAPH_BIPART_PF
+
+#include "module.h"
+#include "common.h"
+#include "gain.h"
+#include "graph.h"
+#include "arch.h"
+#include "bgraph.h"
+#include "bgraph_bipart_fm.h"
+#include "bgraph_bipart_pf.h"
+
+/*********************************/
+/*                               */
+/* Gain table handling routines. */
+/*                               */
+/*********************************/
+
+/* This routine returns the vertex of best gain
+** whose swap will keep the local imbalance
+** within the bounds granted to the thread.
+** It returns:
+** - !NULL  : pointer to the vertex.
+** - NULL   : if no more vertices available.
+*/
+
+static
+BgraphBipartPfVertex *
+bgraphBipartPfTablGet (
+GainTabl * restrict const   tablptr,              /*+ Gain table        +*/
+const Gnum                  deltcur,              /*+ Current imbalance +*/
+const Gnum                  deltmin,              /*+ Minimum imbalance +*/
+const Gnum                  deltmax)              /*+ Maximum imbalance +*/
+{
+  BgraphBipartPfVertex *  vexxptr;
+  BgraphBipartPfVertex *  vertbest;
+  Gnum                    gainbest;
+  const GainEntr *        tablbest;
+  Gnum                    deltbest;
+
+  tablbest = tablptr->tend;                       /* Assume no candidate vertex found yet */
+  gainbest = GAINMAX;
+  vertbest = NULL;
+  deltbest = deltmax;
+
+  for (vexxptr = (BgraphBipartPfVertex *) gainTablFrst (tablptr); /* Select candidate vertices */
+       (vexxptr != NULL) && (vexxptr->gainlink.tabl < tablbest);
+       vexxptr = (BgraphBipartPfVertex *) gainTablNext (tablptr, &vexxptr->gainlink)) {
+    Gnum                deltnew;
+
+    deltnew = deltcur + vexxptr->compgain;
+    if ((deltnew >= deltmin) &&                   /* If vertex enforces balance */
+        (deltnew <= deltmax)) {
+      deltnew = abs (deltnew);
+      if ((vexxptr->commgain < gainbest) ||       /* And if it gives better gain */
+          ((vexxptr->commgain == gainbest) &&     /* Or if it gives better load  */
+           (deltnew < deltbest))) {
+        tablbest = vexxptr->gainlink.tabl;        /* Select it */
+        gainbest = vexxptr->commgain;
+        vertbest = vexxptr;
+        deltbest = deltnew;
+      }
+    }
+  }
+
+  return (vertbest);
+}
+
+/************************************/
+/*                                  */
+/* The threaded reduction routines. */
+/*                                  */
+/************************************/
+
+static
+void
+bgraphBipartPfScan (
+BgraphBipartPfThread * restrict const blocptr,    /* Pointer to local block  */
+BgraphBipartPfThread * restrict const bremptr,    /* Pointer to remote block */
+const int                             srcpval,    /* Source phase value      */
+const int                             dstpval,    /* Destination phase value */
+const void * const                    globptr)    /* Unused                  */
+{
+  if (bremptr != NULL) {
+    blocptr->fronnnd[dstpval]      = blocptr->fronnnd[srcpval]      + bremptr->fronnnd[srcpval]; /* Compute positions of frontier sub-arrays */
+    blocptr->compload1[dstpval]    = blocptr->compload1[srcpval]    + bremptr->compload1[srcpval]; /* Accumulate graph properties            */
+    blocptr->compsize1[dstpval]    = blocptr->compsize1[srcpval]    + bremptr->compsize1[srcpval];
+    blocptr->commloadextn[dstpval] = blocptr->commloadextn[srcpval] + bremptr->commloadextn[srcpval];
+    blocptr->commloadintn[dstpval] = blocptr->commloadintn[srcpval] + bremptr->commloadintn[srcpval];
+    blocptr->commgainextn[dstpval] = blocptr->commgainextn[srcpval] + bremptr->commgainextn[srcpval];
+  }
+  else {
+    blocptr->fronnnd[dstpval]      = blocptr->fronnnd[srcpval];
+    blocptr->compload1[dstpval]    = blocptr->compload1[srcpval];
+    blocptr->compsize1[dstpval]    = blocptr->compsize1[srcpval];
+    blocptr->commloadextn[dstpval] = blocptr->commloadextn[srcpval];
+    blocptr->commloadintn[dstpval] = blocptr->commloadintn[srcpval];
+    blocptr->commgainextn[dstpval] = blocptr->commgainextn[srcpval];
+  }
+}
+
+/******************************/
+/*                            */
+/* The threaded loop routine. */
+/*                            */
+/******************************/
+
+/* This routine performs the refinement passes
+** on the vertex range of the current thread.
+** Each pass is made of three phases:
+** - a Fiduccia-Mattheyses search, seeded by the
+**   frontier vertices of the range, which only
+**   moves vertices of the range, vertices of
+**   other ranges being considered as frozen;
+** - a commit phase, in which the best prefixes
+**   of the move sequences of all threads are
+**   applied concurrently. Since the sum of all
+**   local imbalances may exceed the global
+**   bounds, threads whose whole best sequence
+**   cannot be kept, in thread order, only keep
+**   their best prefix within an even share of
+**   the imbalance slack. The gains computed by
+**   two threads for a cut edge whose both ends
+**   have been moved are both wrong, since the
+**   edge remains cut; such conflicts are solved
+**   by undoing the move of the end vertex of
+**   highest number;
+** - an evaluation phase, in which the cost of the
+**   new partition is computed exactly. If it is
+**   not better than the former one, all the moves
+**   of the pass are undone and the method stops.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+bgraphBipartPfLoop (
+ThreadDescriptor * restrict const   descptr,
+BgraphBipartPfData * restrict const loopptr)
+{
+  GainTabl * restrict             tablptr;        /* Local gain table                         */
+  BgraphBipartPfVertex * restrict vexxtax;        /* Local vertex array                       */
+  Gnum * restrict                 movetab;        /* Array of vertices moved, in move order   */
+  Gnum * restrict                 commtab;        /* Communication load variation after move  */
+  Gnum * restrict                 delttab;        /* Local imbalance after move               */
+  Gnum * restrict                 frontab;        /* Local frontier array                     */
+  Gnum                            vertbas;        /* Start index of vertex range              */
+  Gnum                            vertnnd;        /* End index of vertex range                */
+  Gnum                            vertsiz;        /* Size of local vertex array               */
+  Gnum                            compload0dlt;   /* Imbalance of current partition           */
+  Gnum                            commload;       /* Communication load of current partition  */
+  INT                             passnum;
+  int                             thrdidx;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  const int                           thrdlst = thrdnbr - 1;
+  Bgraph * restrict const             grafptr = loopptr->grafptr;
+  const Genum * restrict const        verttax = grafptr->s.verttax;
+  const Genum * restrict const        vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Gnum * restrict const         edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const         edlotax = grafptr->s.edlotax;
+  const Gnum * restrict const         veextax = grafptr->veextax;
+  GraphPart * restrict const          parttax = grafptr->parttax;
+  GraphPart * restrict const          movetax = loopptr->movetax;
+  const Gnum                          domndist = (Gnum) grafptr->domndist;
+  const Gnum                          movemax = (Gnum) loopptr->paraptr->movenbr;
+
+  vertbas = grafptr->s.baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum); /* Compute bounds of each thread */
+  vertnnd = grafptr->s.baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum + 1);
+  vertsiz = vertnnd - vertbas;
+
+  vexxtax = NULL;
+  if (((tablptr = gainTablInit (GAINMAX, BGRAPHBIPARTPFSUBBITS, GAINTABLTYPEFM, NULL)) == NULL) || /* Allocate here for memory affinity */
+      (memAllocGroup ((void **) (void *)
+                      &vexxtax, (size_t) (vertsiz * sizeof (BgraphBipartPfVertex)),
+                      &movetab, (size_t) (vertsiz * sizeof (Gnum)),
+                      &commtab, (size_t) (vertsiz * sizeof (Gnum)),
+                      &delttab, (size_t) (vertsiz * sizeof (Gnum)),
+                      &frontab, (size_t) (vertsiz * sizeof (Gnum)), NULL) == NULL)) {
+    errorPrint ("bgraphBipartPfLoop: out of memory");
+    vexxtax = NULL;
+    loopptr->abrtval = 1;
+  }
+  else
+    vexxtax -= vertbas;                           /* Base access to local vertex array */
+
+  threadBarrier (descptr);                        /* Wait until all threads have allocated their data */
+
+  if (loopptr->abrtval != 0)                      /* If any thread decided to quit */
+    goto abort;
+
+  compload0dlt = grafptr->compload0dlt;           /* All threads maintain a copy of the partition state */
+  commload     = grafptr->commload;
+  for (passnum = loopptr->paraptr->passnbr; passnum != 0; passnum --) { /* Negative values mean infinite number of passes */
+    Gnum                deltmin;                  /* Smallest local imbalance allowed                */
+    Gnum                deltmax;                  /* Largest local imbalance allowed                 */
+    Gnum                deltmit;                  /* Smallest local imbalance granted to the thread  */
+    Gnum                deltmat;                  /* Largest local imbalance granted to the thread   */
+    Gnum                deltsum;                  /* Imbalance of combined moves of all threads      */
+    Gnum                deltshr;                  /* Share of current imbalance to be compensated    */
+    Gnum                deltcur;                  /* Current local imbalance                         */
+    Gnum                deltbst;                  /* Local imbalance of best position                */
+    Gnum                commdlt;                  /* Local variation of communication load           */
+    Gnum                commdltbst;               /* Local variation of best position                */
+    Gnum                movenbr;                  /* Number of moves performed                       */
+    Gnum                movebst;                  /* Number of moves of best position                */
+    Gnum                movebsm;                  /* Number of moves of best position within share   */
+    Gnum                moveidx;                  /* Number of uneffective moves since best position */
+    Gnum                revenbr;                  /* Number of moves to undo after conflicts         */
+    Gnum                fronnbr;
+    Gnum                compload1;
+    Gnum                compsize1;
+    Gnum                commloadextn;
+    Gnum                commloadintn;
+    Gnum                commgainextn;
+    Gnum                compload0dltnew;
+    Gnum                commloadnew;
+    Gnum                vertnum;
+    BgraphBipartPfVertex * vexxptr;
+
+    deltmin = loopptr->compload0dltmin - compload0dlt; /* Whole imbalance slack is available to each search */
+    deltmax = loopptr->compload0dltmax - compload0dlt;
+    deltmit = deltmin / thrdnbr;                  /* Truncation keeps shared bounds conservative */
+    deltmat = deltmax / thrdnbr;
+    deltshr = compload0dlt / thrdnbr;
+
+    gainTablFree (tablptr);
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* Set initial gains of all vertices of range */
+      Genum               edgenum;
+      Gnum                edloval;
+      Gnum                commcut;
+      Gnum                commgain;
+      Gnum                veloval;
+      int                 partval;
+      int                 partdlt;
+
+      partval = parttax[vertnum];
+      for (edgenum = verttax[vertnum], commcut = commgain = 0, edloval = 1;
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        int                 partdlt;
+
+        if (edlotax != NULL)
+          edloval = edlotax[edgenum];
+
+        partdlt   = partval ^ parttax[edgetax[edgenum]];
+        commcut  += partdlt;
+        commgain += (1 - 2 * partdlt) * edloval;
+      }
+      commgain *= domndist;                       /* Adjust internal gains with respect to external gains */
+      partdlt   = 2 * partval - 1;
+      veloval   = (velotax != NULL) ? velotax[vertnum] : 1;
+
+      vexxptr = &vexxtax[vertnum];
+      vexxptr->partval  = partval;
+      vexxptr->compgain = partdlt * veloval;
+      vexxptr->commgain = (veextax == NULL) ? commgain : (commgain - partdlt * veextax[vertnum]);
+      vexxptr->commcut  = commcut;
+      bgraphBipartPfSetFree (vexxptr);
+      if (commcut > 0)                            /* Frontier vertices are the seeds of the search */
+        gainTablAdd (tablptr, &vexxptr->gainlink, vexxptr->commgain);
+    }
+
+    deltcur    =
+    deltbst    = 0;
+    commdlt    =
+    commdltbst = 0;
+    movenbr    =
+    movebst    =
+    moveidx    = 0;
+    while ((moveidx < movemax) &&                 /* As long as we can find effective vertices */
+           ((vexxptr = bgraphBipartPfTablGet (tablptr, deltcur, deltmin, deltmax)) != NULL)) {
+      Genum               edgenum;
+      Gnum                edloval;
+      int                 partval;
+
+      gainTablDel (tablptr, &vexxptr->gainlink);  /* Remove it from table */
+      bgraphBipartPfSetUsed (vexxptr);            /* Lock it              */
+
+      vertnum = (Gnum) (vexxptr - vexxtax);
+      partval = vexxptr->partval;
+      commdlt += vexxptr->commgain;
+      deltcur += vexxptr->compgain;
+      movetab[movenbr] = vertnum;
+      commtab[movenbr] = commdlt;
+      delttab[movenbr] = deltcur;
+      movenbr ++;
+      moveidx ++;
+
+      vexxptr->partval  = partval ^ 1;            /* Swap vertex */
+      vexxptr->compgain = - vexxptr->compgain;
+      vexxptr->commgain = - vexxptr->commgain;
+      vexxptr->commcut  = vendtax[vertnum] - verttax[vertnum] - vexxptr->commcut;
+
+      for (edgenum = verttax[vertnum], edloval = 1; /* Update neighbors of the range */
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        BgraphBipartPfVertex *  vexxend;
+        Gnum                    vertend;
+        int                     partdlt;
+
+        vertend = edgetax[edgenum];
+        if ((vertend < vertbas) || (vertend >= vertnnd)) /* Vertices of other ranges are frozen */
+          continue;
+
+        if (edlotax != NULL)
+          edloval = edlotax[edgenum];
+
+        vexxend = &vexxtax[vertend];
+        partdlt = 2 * (partval ^ vexxend->partval) - 1;
+        vexxend->commgain += (domndist * 2) * edloval * partdlt;
+        vexxend->commcut  -= partdlt;
+
+        if (! bgraphBipartPfIsUsed (vexxend)) {   /* If vertex is of use       */
+          if (bgraphBipartPfIsTabl (vexxend)) {   /* If vertex is linked       */
+            gainTablDel (tablptr, &vexxend->gainlink); /* Remove it from table */
+            bgraphBipartPfSetFree (vexxend);      /* Mark it as free anyway    */
+          }
+          if (vexxend->commcut > 0)               /* If vertex belongs to the frontier */
+            gainTablAdd (tablptr, &vexxend->gainlink, vexxend->commgain); /* Re-link it */
+        }
+      }
+
+      if ((commdlt < commdltbst) ||               /* If move improves the cost, or the share of balance */
+          ((commdlt == commdltbst) && (abs (deltshr + deltcur) < abs (deltshr + deltbst)))) {
+        commdltbst = commdlt;
+        deltbst    = deltcur;
+        movebst    = movenbr;
+        moveidx    = 0;
+      }
+    }
+
+    for (moveidx = movebsm = 0, commdltbst = deltbst = 0; /* Find best position within share of imbalance slack */
+         moveidx < movebst; moveidx ++) {
+      if ((delttab[moveidx] >= deltmit) &&
+          (delttab[moveidx] <= deltmat) &&
+          ((commtab[moveidx] < commdltbst) ||
+           ((commtab[moveidx] == commdltbst) && (abs (deltshr + delttab[moveidx]) < abs (deltshr + deltbst))))) {
+        commdltbst = commtab[moveidx];
+        deltbst    = delttab[moveidx];
+        movebsm    = moveidx + 1;
+      }
+    }
+    loopptr->thrdtab[thrdnum].movenbr[0] = movebsm;
+    loopptr->thrdtab[thrdnum].movenbr[1] = movebst;
+    loopptr->thrdtab[thrdnum].deltval[0] = (movebsm > 0) ? delttab[movebsm - 1] : 0;
+    loopptr->thrdtab[thrdnum].deltval[1] = (movebst > 0) ? delttab[movebst - 1] : 0;
+
+    threadBarrier (descptr);                      /* Wait until all searches have been performed on current partition */
+
+    for (thrdidx = 0, deltsum = compload0dlt; thrdidx < thrdnbr; thrdidx ++) /* Sum of moves within shares is always valid */
+      deltsum += loopptr->thrdtab[thrdidx].deltval[0];
+    for (thrdidx = 0; thrdidx <= thrdnum; thrdidx ++) { /* All threads take the same decisions, in thread order */
+      Gnum                deltnew;
+
+      deltnew = deltsum - loopptr->thrdtab[thrdidx].deltval[0] + loopptr->thrdtab[thrdidx].deltval[1];
+      movebst = loopptr->thrdtab[thrdidx].movenbr[0]; /* Assume only moves within share can be kept */
+      if ((deltnew >= loopptr->compload0dltmin) && /* If whole best sequence of thread can be kept */
+          (deltnew <= loopptr->compload0dltmax)) {
+        deltsum = deltnew;
+        movebst = loopptr->thrdtab[thrdidx].movenbr[1];
+      }
+    }
+
+    for (moveidx = 0; moveidx < movebst; moveidx ++) { /* Commit best prefix of move sequence */
+      vertnum = movetab[moveidx];
+      parttax[vertnum] ^= 1;
+      movetax[vertnum]  = 1;
+    }
+
+    threadBarrier (descptr);                      /* Wait until all moves have been committed */
+
+    for (moveidx = revenbr = 0; moveidx < movebst; moveidx ++) { /* Find moves that conflict with moves of other threads */
+      Genum               edgenum;
+
+      vertnum = movetab[moveidx];
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if ((vertend < vertbas) &&                /* Only move of end vertex of highest number is undone */
+            (movetax[vertend] != 0) &&
+            (parttax[vertend] != parttax[vertnum])) { /* If edge was cut and remains so */
+          movetab[revenbr ++] = vertnum;          /* Record move to undo, in place      */
+          break;
+        }
+      }
+    }
+
+    threadBarrier (descptr);                      /* Wait until all conflicts have been found */
+
+    for (moveidx = 0; moveidx < revenbr; moveidx ++) { /* Undo conflicting moves */
+      vertnum = movetab[moveidx];
+      parttax[vertnum] ^= 1;
+      movetax[vertnum]  = 0;
+    }
+
+    threadBarrier (descptr);                      /* Wait until partition is stable */
+
+    for (vertnum = vertbas, fronnbr = 0, commloadextn = commgainextn = commloadintn = compload1 = compsize1 = 0;
+         vertnum < vertnnd; vertnum ++) {         /* Compute exact cost of new partition */
+      Genum               edgenum;
+      Gnum                partval;
+      Gnum                veloval;
+      Gnum                commloadloc;            /* Vertex internal communication load */
+
+      partval = (Gnum) parttax[vertnum];
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      if (veextax != NULL) {
+        Gnum                  veexval;
+
+        veexval = veextax[vertnum];
+        commloadextn += veexval * partval;
+        commgainextn += veexval * (1 - 2 * partval);
+      }
+      compsize1 += partval;
+      compload1 += partval * veloval;
+
+      commloadloc = 0;
+      if (edlotax != NULL) {
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++)
+          commloadloc += (partval ^ (Gnum) parttax[edgetax[edgenum]]) * edlotax[edgenum];
+      }
+      else {
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++)
+          commloadloc += partval ^ (Gnum) parttax[edgetax[edgenum]];
+      }
+      commloadintn += commloadloc;                /* Internal loads will be added twice */
+      if (commloadloc != 0)                       /* If end vertex is in the other part */
+        frontab[fronnbr ++] = vertnum;            /* Then it belongs to the frontier    */
+    }
+    loopptr->thrdtab[thrdnum].fronnnd[0]      = fronnbr; /* Save state for scan-reduce */
+    loopptr->thrdtab[thrdnum].compload1[0]    = compload1;
+    loopptr->thrdtab[thrdnum].compsize1[0]    = compsize1;
+    loopptr->thrdtab[thrdnum].commloadextn[0] = commloadextn;
+    loopptr->thrdtab[thrdnum].commloadintn[0] = commloadintn;
+    loopptr->thrdtab[thrdnum].commgainextn[0] = commgainextn;
+
+    threadScan (descptr, (void *) &loopptr->thrdtab[thrdnum], sizeof (BgraphBipartPfThread), (ThreadScanFunc) bgraphBipartPfScan, NULL);
+
+    compload0dltnew = grafptr->s.velosum - loopptr->thrdtab[thrdlst].compload1[0] - grafptr->compload0avg; /* All threads take the same decision */
+    commloadnew     = loopptr->thrdtab[thrdlst].commloadextn[0] + grafptr->commloadextn0 + (loopptr->thrdtab[thrdlst].commloadintn[0] / 2) * domndist;
+    if ((compload0dltnew < loopptr->compload0dltmin) || /* If new partition is not better, undo all moves of the pass */
+        (compload0dltnew > loopptr->compload0dltmax) ||
+        (commloadnew > commload) ||
+        ((commloadnew == commload) && (abs (compload0dltnew) >= abs (compload0dlt)))) {
+      for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+        if (movetax[vertnum] != 0)
+          parttax[vertnum] ^= 1;
+      }
+      break;
+    }
+
+    memCpy (loopptr->frontab + loopptr->thrdtab[thrdnum].fronnnd[0] - fronnbr, frontab, fronnbr * sizeof (Gnum)); /* Gather frontier sub-array */
+    memSet (movetax + vertbas, 0, vertsiz * sizeof (GraphPart)); /* Reset move flags of range for next pass */
+    if (thrdnum == thrdlst) {                     /* Last thread records state of accepted partition */
+      loopptr->fronnbr      = loopptr->thrdtab[thrdlst].fronnnd[0];
+      loopptr->compload0    = grafptr->s.velosum - loopptr->thrdtab[thrdlst].compload1[0];
+      loopptr->compsize0    = grafptr->s.vertnbr - loopptr->thrdtab[thrdlst].compsize1[0];
+      loopptr->commload     = commloadnew;
+      loopptr->commgainextn = loopptr->thrdtab[thrdlst].commgainextn[0];
+      loopptr->passnbr ++;
+    }
+    compload0dlt = compload0dltnew;
+    commload     = commloadnew;
+  }
+
+abort :
+  if (vexxtax != NULL)
+    memFree (vexxtax + vertbas);                  /* Free group leader of local arrays */
+  if (tablptr != NULL)
+    gainTablExit (tablptr);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the bipartitioning.
+** When the graph is too small with respect to
+** the number of threads, or when the current
+** partition is not balanced, the sequential
+** Fiduccia-Mattheyses method is used instead.
+** It returns:
+** - 0 : if bipartitioning could be computed.
+** - 1 : on error.
+*/
+
+int
+bgraphBipartPf (
+Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
+const BgraphBipartPfParam * const paraptr)        /*+ Method parameters +*/
+{
+  BgraphBipartPfData  loopdat;
+  Gnum                comploadsum;                /* Overall vertex load sum, including fixed */
+  Gnum                compload0dltmit;            /* Theoretical smallest imbalance allowed   */
+  Gnum                compload0dltmat;            /* Theoretical largest imbalance allowed    */
+  int                 thrdnbr;
+
+#ifdef SCOTCH_PTHREAD
+  thrdnbr = contextThreadNbr (grafptr->contptr);
+#else /* SCOTCH_PTHREAD */
+  thrdnbr = 1;
+#endif /* SCOTCH_PTHREAD */
+
+  comploadsum = grafptr->s.velosum + grafptr->vfixload[0] + grafptr->vfixload[1];
+  compload0dltmat = (paraptr->deltval <= 0.0L) ? 0
+                    : ((Gnum) ((double) comploadsum * paraptr->deltval /
+                               (double) MAX (grafptr->domnwght[0], grafptr->domnwght[1])) + 1);
+  compload0dltmit = MAX ((grafptr->compload0min - grafptr->compload0avg), - compload0dltmat);
+  compload0dltmat = MIN ((grafptr->compload0max - grafptr->compload0avg), compload0dltmat);
+
+  if ((thrdnbr < 2) ||                            /* If multithreading is not worth it */
+      (grafptr->s.vertnbr < (thrdnbr * BGRAPHBIPARTPFVERTMIN)) ||
+      (grafptr->fronnbr == 0) ||                  /* Or if imbalance must be fought first */
+      (grafptr->compload0dlt < compload0dltmit) ||
+      (grafptr->compload0dlt > compload0dltmat)) {
+    BgraphBipartFmParam paradat;
+
+    paradat.movenbr = paraptr->movenbr;           /* Use sequential method with same parameters */
+    paradat.passnbr = paraptr->passnbr;
+    paradat.deltval = paraptr->deltval;
+    paradat.typeval = BGRAPHBIPARTFMTYPEBOUNDARY;
+    return (bgraphBipartFm (grafptr, &paradat));
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab, (size_t) (thrdnbr            * sizeof (BgraphBipartPfThread)),
+                     &loopdat.movetax, (size_t) (grafptr->s.vertnbr * sizeof (GraphPart)), NULL) == NULL) {
+    errorPrint ("bgraphBipartPf: out of memory");
+    return (1);
+  }
+  memSet (loopdat.movetax, 0, grafptr->s.vertnbr * sizeof (GraphPart));
+
+  loopdat.grafptr         = grafptr;
+  loopdat.paraptr         = paraptr;
+  loopdat.movetax        -= grafptr->s.baseval;
+  loopdat.frontab         = grafptr->frontab;
+  loopdat.compload0dltmin = compload0dltmit;
+  loopdat.compload0dltmax = compload0dltmat;
+  loopdat.passnbr         = 0;                    /* No pass accepted yet */
+  loopdat.abrtval         = 0;
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) bgraphBipartPfLoop, (void *) &loopdat);
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  if (loopdat.abrtval != 0)                       /* If threads could not run, partition is unchanged */
+    return (1);
+
+  if (loopdat.passnbr > 0) {                      /* If partition has been improved */
+    grafptr->fronnbr      = loopdat.fronnbr;
+    grafptr->compload0    = loopdat.compload0;
+    grafptr->compload0dlt = loopdat.compload0 - grafptr->compload0avg;
+    grafptr->compsize0    = loopdat.compsize0;
+    grafptr->commload     = loopdat.commload;
+    grafptr->commgainextn = loopdat.commgainextn;
+    grafptr->bbalval      = (double) ((grafptr->compload0dlt < 0) ? (- grafptr->compload0dlt) : grafptr->compload0dlt) / (double) grafptr->compload0avg;
+  }
+
+#ifdef SCOTCH_DEBUG_BGRAPH2
+  if (bgraphCheck (grafptr) != 0) {
+    errorPrint ("bgraphBipartPf: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_BGRAPH2 */
+
+  return (0);
+}
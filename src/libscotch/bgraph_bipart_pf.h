@@ -0,0 +1,158 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_pf.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the function       **/
+/**                declarations for the multithreaded      **/
+/**                Fiduccia-Mattheyses bipartitioning      **/
+/**                refinement method.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Minimum number of vertices per thread
+    for the multithreaded method to be used
+    instead of the sequential one.          +*/
+
+#define BGRAPHBIPARTPFVERTMIN       1024
+
+/*+ Gain table subbits. +*/
+
+#define BGRAPHBIPARTPFSUBBITS       4
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct BgraphBipartPfParam_ {
+  INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
+  INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
+} BgraphBipartPfParam;
+
+#ifdef SCOTCH_BGRAPH_BIPART_PF                    /* Private part of the module */
+
+/*+ The local vertex structure. For trick
+    reasons, the gain table data structure
+    must be the first field of the structure. +*/
+
+typedef struct BgraphBipartPfVertex_ {
+  GainLink                  gainlink;             /*+ Gain link: FIRST   +*/
+  Gnum                      compgain;             /*+ Computation gain   +*/
+  Gnum                      commgain;             /*+ Communication gain +*/
+  Gnum                      commcut;              /*+ Cut edges          +*/
+  int                       partval;              /*+ Vertex part        +*/
+} BgraphBipartPfVertex;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct BgraphBipartPfThread_ {
+  Gnum                      fronnnd[2];           /*+ After-last frontier vertex index; [2] for scan +*/
+  Gnum                      compload1[2];         /*+ State return values to aggregate               +*/
+  Gnum                      compsize1[2];
+  Gnum                      commloadextn[2];
+  Gnum                      commloadintn[2];
+  Gnum                      commgainextn[2];
+  Gnum                      movenbr[2];           /*+ Length of best move sequence, within share and whole +*/
+  Gnum                      deltval[2];           /*+ Imbalance variation of these sequences                +*/
+} BgraphBipartPfThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct BgraphBipartPfData_ {
+  Bgraph *                  grafptr;              /*+ Graph to work on                   +*/
+  const BgraphBipartPfParam * paraptr;            /*+ Method parameters                  +*/
+  GraphPart *               movetax;              /*+ Flag array of vertices moved       +*/
+  Gnum *                    frontab;              /*+ Frontier array of the graph        +*/
+  BgraphBipartPfThread *    thrdtab;              /*+ Array of thread-specific data      +*/
+  Gnum                      compload0dltmin;      /*+ Smallest imbalance allowed         +*/
+  Gnum                      compload0dltmax;      /*+ Largest imbalance allowed          +*/
+  Gnum                      fronnbr;              /*+ State of last accepted partition   +*/
+  Gnum                      compload0;
+  Gnum                      compsize0;
+  Gnum                      commload;
+  Gnum                      commgainextn;
+  INT                       passnbr;              /*+ Number of accepted passes          +*/
+  int                       abrtval;              /*+ Abort value                        +*/
+} BgraphBipartPfData;
+
+/*
+**  The function prototypes.
+*/
+
+static BgraphBipartPfVertex * bgraphBipartPfTablGet (GainTabl * restrict const, const Gnum, const Gnum, const Gnum);
+static void                 bgraphBipartPfScan  (BgraphBipartPfThread * restrict const, BgraphBipartPfThread * restrict const, const int, const int, const void * const);
+static void                 bgraphBipartPfLoop  (ThreadDescriptor * restrict const, BgraphBipartPfData * restrict const);
+
+#endif /* SCOTCH_BGRAPH_BIPART_PF */
+
+int                         bgraphBipartPf      (Bgraph * restrict const, const BgraphBipartPfParam * const);
+
+/*
+**  The macro definitions.
+*/
+
+#ifdef SCOTCH_BGRAPH_BIPART_PF
+
+/** Gain table vertex status. **/
+
+#define BGRAPHBIPARTPFSTATEFREE     ((GainLink *) 0) /*+ Vertex in initial state           +*/
+#define BGRAPHBIPARTPFSTATEUSED     ((GainLink *) 1) /*+ Swapped vertex                    +*/
+#define BGRAPHBIPARTPFSTATELINK     ((GainLink *) 2) /*+ Currently in gain table if higher +*/
+
+/*+ Service routines. +*/
+
+#define bgraphBipartPfIsFree(v)     ((v)->gainlink.next == BGRAPHBIPARTPFSTATEFREE)
+#define bgraphBipartPfIsTabl(v)     ((v)->gainlink.next >= BGRAPHBIPARTPFSTATELINK)
+#define bgraphBipartPfIsUsed(v)     ((v)->gainlink.next == BGRAPHBIPARTPFSTATEUSED)
+#define bgraphBipartPfSetFree(v)    do {                                            \
+                                      (v)->gainlink.next = BGRAPHBIPARTPFSTATEFREE; \
+                                    } while (0)
+#define bgraphBipartPfSetUsed(v)    do {                                            \
+                                      (v)->gainlink.next = BGRAPHBIPARTPFSTATEUSED; \
+                                    } while (0)
+
+#endif /* SCOTCH_BGRAPH_BIPART_PF */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2012,2016,2017,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2012,2016,2017,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 02 jan 2017     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 04 sep 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +63,8 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_BGRAPH_BIPART_ST
+
 #include "module.h"
 #include "common.h"
 #include "fibo.h"
@@ -81,6 +83,7 @@
 #include "bgraph_bipart_gg.h"
 #include "bgraph_bipart_gp.h"
 #include "bgraph_bipart_ml.h"
+#include "bgraph_bipart_pf.h"
 #include "bgraph_bipart_zr.h"
 #include "bgraph_bipart_st.h"
 
@@ -125,6 +128,11 @@ static union {
   StratNodeMethodData       padding;
 } bgraphbipartstdefaultml = { { 100, 0.8L, &stratdummy, &stratdummy } };
 
+static union {
+  BgraphBipartPfParam       param;
+  StratNodeMethodData       padding;
+} bgraphbipartstdefaultpf = { { 80, ~0, 0.01L } };
+
 static StratMethodTab       bgraphbipartstmethtab[] = { /* Bipartitioning methods array */
                               { BGRAPHBIPARTSTMETHBD, "b",  (StratMethodFunc) bgraphBipartBd, &bgraphbipartstdefaultbd },
                               { BGRAPHBIPARTSTMETHDF, "d",  (StratMethodFunc) bgraphBipartDf, &bgraphbipartstdefaultdf },
@@ -134,6 +142,7 @@ static StratMethodTab       bgraphbipartstmethtab[] = { /* Bipartitioning method
                               { BGRAPHBIPARTSTMETHGG, "h",  (StratMethodFunc) bgraphBipartGg, &bgraphbipartstdefaultgg },
                               { BGRAPHBIPARTSTMETHGP, "g",  (StratMethodFunc) bgraphBipartGp, &bgraphbipartstdefaultgp },
                               { BGRAPHBIPARTSTMETHML, "m",  (StratMethodFunc) bgraphBipartMl, &bgraphbipartstdefaultml },
+                              { BGRAPHBIPARTSTMETHPF, "p",  (StratMethodFunc) bgraphBipartPf, &bgraphbipartstdefaultpf },
                               { BGRAPHBIPARTSTMETHZR, "z",  (StratMethodFunc) bgraphBipartZr, NULL },
                               { -1,                   NULL, (StratMethodFunc) NULL,           NULL } };
 
@@ -206,6 +215,18 @@ static StratParamTab        bgraphbipartstparatab[] = { /* Method parameter list
                                 (byte *) &bgraphbipartstdefaultml.param,
                                 (byte *) &bgraphbipartstdefaultml.param.coarrat,
                                 NULL },
+                              { BGRAPHBIPARTSTMETHPF,  STRATPARAMINT,    "move",
+                                (byte *) &bgraphbipartstdefaultpf.param,
+                                (byte *) &bgraphbipartstdefaultpf.param.movenbr,
+                                NULL },
+                              { BGRAPHBIPARTSTMETHPF,  STRATPARAMINT,    "pass",
+                                (byte *) &bgraphbipartstdefaultpf.param,
+                                (byte *) &bgraphbipartstdefaultpf.param.passnbr,
+                                NULL },
+                              { BGRAPHBIPARTSTMETHPF,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &bgraphbipartstdefaultpf.param,
+                                (byte *) &bgraphbipartstdefaultpf.param.deltval,
+                                NULL },
                               { BGRAPHBIPARTSTMETHNBR, STRATPARAMINT,    NULL,
                                 NULL, NULL, NULL } };
 
@@ -250,6 +271,100 @@ StratTab                    bgraphbipartststratab = { /* Strategy tables for gra
                               bgraphbipartstparatab,
                               bgraphbipartstcondtab };
 
+/**********************************************/
+/*                                            */
+/* These routines run the two branches of a   */
+/* selection operator in parallel.            */
+/*                                            */
+/**********************************************/
+
+/* This routine applies the strategy of the
+** given branch to its own copy of the active
+** graph, within the given sub-context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+bgraphBipartSt2 (
+Context * restrict const              contptr,    /*+ (Sub-)context                          +*/
+const int                             spltnum,    /*+ Rank of sub-context in initial context +*/
+BgraphBipartStSplit * restrict const  spltptr)
+{
+  Bgraph * restrict const grafptr = spltptr->splttab[spltnum].grafptr;
+  Context * const         contsav = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Assign new context to work graph */
+  spltptr->splttab[spltnum].revaval = bgraphBipartSt (grafptr, spltptr->splttab[spltnum].straptr);
+  grafptr->contptr = contsav;
+}
+
+/* This routine runs concurrently the two
+** strategies of a selection operator, the
+** first one on the active graph and the second
+** one on a copy of it, built from the initial
+** bipartition held in the given save area.
+** On return, the result of the first strategy
+** is saved in the other save area, and the
+** active graph holds the result of the second
+** strategy, like in the sequential case.
+** It returns:
+** - 0 : if the strategies were run concurrently.
+** - 1 : if they have to be run sequentially.
+*/
+
+static
+int
+bgraphBipartSt3 (
+Bgraph * restrict const       grafptr,            /*+ Active graph                     +*/
+const Strat * restrict const  straptr,            /*+ Selection strategy               +*/
+BgraphStore * restrict const  savetab,            /*+ Save areas; initial state in [1] +*/
+int * restrict const          revatab)            /*+ Return values of both strategies +*/
+{
+  Bgraph              grafdat;                    /* Copy of active graph for second strategy */
+  BgraphBipartStSplit spltdat;                    /* Parameters for context splitting          */
+
+  if (contextThreadNbr (grafptr->contptr) <= 1)   /* If context cannot be split, run in sequence */
+    return (1);
+
+  grafdat = *grafptr;                             /* Clone active graph with its own partition arrays */
+  if (memAllocGroup ((void **) (void *)
+                     &grafdat.parttax, (size_t) (grafptr->s.vertnbr * sizeof (GraphPart)),
+                     &grafdat.frontab, (size_t) (grafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL)
+    return (1);                                   /* Not enough memory: fall back to sequential processing */
+  grafdat.parttax -= grafptr->s.baseval;
+  bgraphStoreUpdt (&grafdat, &savetab[1]);        /* Set initial bipartition */
+
+  spltdat.splttab[0].grafptr = grafptr;
+  spltdat.splttab[0].straptr = straptr->data.seledat.stratab[0];
+  spltdat.splttab[1].grafptr = &grafdat;
+  spltdat.splttab[1].straptr = straptr->data.seledat.stratab[1];
+
+  if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) bgraphBipartSt2, &spltdat) != 0) {
+    memFree (grafdat.parttax + grafptr->s.baseval);
+    return (1);
+  }
+
+  revatab[0] = spltdat.splttab[0].revaval;
+  revatab[1] = spltdat.splttab[1].revaval;
+
+  bgraphStoreSave (grafptr, &savetab[0]);         /* Save result of first strategy */
+  grafptr->fronnbr      = grafdat.fronnbr;        /* Get result of second strategy */
+  grafptr->compload0    = grafdat.compload0;
+  grafptr->compload0dlt = grafdat.compload0dlt;
+  grafptr->compsize0    = grafdat.compsize0;
+  grafptr->commload     = grafdat.commload;
+  grafptr->commgainextn = grafdat.commgainextn;
+  grafptr->bbalval      = grafdat.bbalval;
+  memCpy (grafptr->frontab, grafdat.frontab, grafdat.fronnbr * sizeof (Gnum));
+  memCpy (grafptr->parttax + grafptr->s.baseval, grafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+
+  memFree (grafdat.parttax + grafptr->s.baseval); /* Free group leader */
+
+  return (0);
+}
+
 /***********************************************/
 /*                                             */
 /* This is the generic bipartitioning routine. */
@@ -272,6 +387,9 @@ const Strat * restrict const  straptr)            /*+ Bipartitioning strategy
   StratTest           testdat;                    /* Result of condition evaluation */
   BgraphStore         savetab[2];                 /* Results of the two strategies  */
   Gnum                compload0;
+#ifndef BGRAPHBIPARTSTNOTHREAD
+  int                 revatab[2];                 /* Return values of concurrent strategies */
+#endif /* BGRAPHBIPARTSTNOTHREAD */
   int                 o;
   int                 o0;
   int                 o1;
@@ -331,11 +449,20 @@ const Strat * restrict const  straptr)            /*+ Bipartitioning strategy
         return (1);
       }
 
-      bgraphStoreSave     (grafptr, &savetab[1]); /* Save initial bipartition                   */
-      o0 = bgraphBipartSt (grafptr, straptr->data.seledat.stratab[0]); /* Apply first strategy  */
-      bgraphStoreSave     (grafptr, &savetab[0]); /* Save its result                            */
-      bgraphStoreUpdt     (grafptr, &savetab[1]); /* Restore initial bipartition                */
-      o1 = bgraphBipartSt (grafptr, straptr->data.seledat.stratab[1]); /* Apply second strategy */
+      bgraphStoreSave (grafptr, &savetab[1]);     /* Save initial bipartition */
+#ifndef BGRAPHBIPARTSTNOTHREAD
+      if (bgraphBipartSt3 (grafptr, straptr, savetab, revatab) == 0) { /* If both strategies could be run concurrently */
+        o0 = revatab[0];
+        o1 = revatab[1];
+      }
+      else
+#endif /* BGRAPHBIPARTSTNOTHREAD */
+      {
+        o0 = bgraphBipartSt (grafptr, straptr->data.seledat.stratab[0]); /* Apply first strategy  */
+        bgraphStoreSave     (grafptr, &savetab[0]); /* Save its result                            */
+        bgraphStoreUpdt     (grafptr, &savetab[1]); /* Restore initial bipartition                */
+        o1 = bgraphBipartSt (grafptr, straptr->data.seledat.stratab[1]); /* Apply second strategy */
+      }
 
       if ((o0 | o1) != 0) {                       /* If at least one method failed */
         if (o0 == 0)                              /* If first succeeded, take it   */
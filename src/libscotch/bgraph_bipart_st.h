@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 05 apr 2018     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 08 mar 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,10 +68,25 @@ typedef enum BgraphBipartStMethodType_ {
   BGRAPHBIPARTSTMETHGG,                           /*+ Greedy Graph Growing   +*/
   BGRAPHBIPARTSTMETHGP,                           /*+ Gibbs-Poole-Stockmeyer +*/
   BGRAPHBIPARTSTMETHML,                           /*+ Multi-level (strategy) +*/
+  BGRAPHBIPARTSTMETHPF,                           /*+ Parallel F-M           +*/
   BGRAPHBIPARTSTMETHZR,                           /*+ Move all to part zero  +*/
   BGRAPHBIPARTSTMETHNBR                           /*+ Number of methods      +*/
 } BgraphBipartStMethodType;
 
+/*+ This structure holds the splitting
+    parameters for running concurrently
+    both branches of a selection operator. +*/
+
+typedef struct BgraphBipartStSplit2_ {
+  Bgraph *                  grafptr;              /*+ Active graph to work on  +*/
+  const Strat *             straptr;              /*+ Strategy to apply        +*/
+  int                       revaval;              /*+ Return value of strategy +*/
+} BgraphBipartStSplit2;
+
+typedef struct BgraphBipartStSplit_ {
+  BgraphBipartStSplit2      splttab[2];           /*+ Data for both branches +*/
+} BgraphBipartStSplit;
+
 /*+ Method function pointer type. +*/
 
 typedef int (* BgraphBipartFunc) (Bgraph * restrict const, const void * const);
@@ -86,4 +101,9 @@ extern StratTab             bgraphbipartststratab;
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_BGRAPH_BIPART_ST
+static void                 bgraphBipartSt2     (Context * restrict const, const int, BgraphBipartStSplit * restrict const);
+static int                  bgraphBipartSt3     (Bgraph * restrict const, const Strat * restrict const, BgraphStore * restrict const, int * restrict const);
+#endif /* SCOTCH_BGRAPH_BIPART_ST */
+
 int                         bgraphBipartSt      (Bgraph * restrict const, const Strat * restrict const);
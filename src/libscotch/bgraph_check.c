@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2013,2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2013,2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 06 oct 2013     **/
 /**                                 to   : 25 aug 2014     **/
 /**                # Version 7.0  : from : 22 feb 2023     **/
-/**                                 to   : 28 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -89,8 +89,8 @@ const Bgraph * restrict const grafptr)
 
   const Gnum                        baseval = grafptr->s.baseval;
   const Gnum                        vertnnd = grafptr->s.vertnnd;
-  const Gnum * restrict const       verttax = grafptr->s.verttax;
-  const Gnum * restrict const       vendtax = grafptr->s.vendtax;
+  const Genum * restrict const       verttax = grafptr->s.verttax;
+  const Genum * restrict const       vendtax = grafptr->s.vendtax;
   const Gnum * restrict const       edgetax = grafptr->s.edgetax;
   const GraphPart * restrict const  parttax = grafptr->parttax;
   const Gnum * restrict const       frontab = grafptr->frontab;
@@ -129,7 +129,7 @@ const Bgraph * restrict const grafptr)
   o = 1;                                          /* Assume failure when checking */
   for (fronnum = 0; fronnum < grafptr->fronnbr; fronnum ++) {
     Gnum                vertnum;
-    Gnum                edgenum;
+    Genum               edgenum;
     GraphPart           partval;
     GraphPart           flagval;
 
@@ -158,7 +158,7 @@ const Bgraph * restrict const grafptr)
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
     GraphPart           partval;                  /* Part of current vertex    */
     GraphPart           flagval;                  /* Difference in part values */
-    Gnum                edgenum;                  /* Number of current edge    */
+    Genum               edgenum;                  /* Number of current edge    */
 
     partval = parttax[vertnum];
 
@@ -1,4 +1,4 @@
-/* Copyright 2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                cost function computation routine.      **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 22 feb 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -86,8 +86,8 @@ Gnum * restrict const             cmgeptr)        /*+ Pointer to external commun
   Gnum                cmgesum;                    /* External communication gain                  */
   Gnum                vertnum;                    /* Number of current vertex                     */
 
-  const Gnum * restrict const       verttax = grafptr->s.verttax;
-  const Gnum * restrict const       vendtax = grafptr->s.vendtax;
+  const Genum * restrict const       verttax = grafptr->s.verttax;
+  const Genum * restrict const       vendtax = grafptr->s.vendtax;
   const Gnum * restrict const       velotax = grafptr->s.velotax;
   const Gnum * restrict const       veextax = grafptr->veextax;
   const Gnum * restrict const       edgetax = grafptr->s.edgetax;
@@ -105,7 +105,7 @@ Gnum * restrict const             cmgeptr)        /*+ Pointer to external commun
     Gnum                partmsk;                  /* Mask for adding contributions or not */
     Gnum                veloval;                  /* Vertex load                          */
     Gnum                edloval;                  /* Edge load                            */
-    Gnum                edgenum;                  /* Number of current edge               */
+    Genum               edgenum;                  /* Number of current edge               */
 
     partval = (Gnum) parttax[vertnum];
     partmsk = - partval;                          /* TRICK: 0 -> 0; 1 -> 0xFF..FF */
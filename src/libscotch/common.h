@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.1  : from : 02 apr 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 28 sep 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -101,9 +101,11 @@
 #if (INT_WIDTH == 64)                             /* On WIN32 / MSVC, sizeof (int) == sizeof (long) in all cases, unlike other platforms */
 #define __sync_lock_test_and_set(m,v) _InterlockedExchange64 ((long *) (m), (v))
 #define __sync_lock_release(m)      _InterlockedExchange64 ((long *) (m), 0L)
+#define __sync_val_compare_and_swap(m,o,n) _InterlockedCompareExchange64 ((long *) (m), (n), (o))
 #else /* (INT_WIDTH == 64) */
 #define __sync_lock_test_and_set(m,v) _InterlockedExchange ((long *) (m), (v))
 #define __sync_lock_release(m)      _InterlockedExchange ((long *) (m), 0L)
+#define __sync_val_compare_and_swap(m,o,n) _InterlockedCompareExchange ((long *) (m), (n), (o))
 #endif /* (INT_WIDTH == 64) */
 #endif /* _MSC_VER */
 #define ssize_t                     SSIZE_T
@@ -270,11 +272,35 @@
 #endif /* IDXSIZE32 */
 #endif /* IDX       */
 
+#ifndef EDGE                                      /* If type not externally overriden */
+#ifdef EDGESIZE64
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_UINT_T))
+#define EDGE                        int64_t
+#define UEDGE                       uint64_t
+#else /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_UINT_T)) */
+#define EDGE                        int64_t
+#define UEDGE                       u_int64_t
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_UINT_T)) */
+#define COMM_EDGE                   MPI_INT64_T
+#ifdef PRId64
+#define EDGESTRING                  "%" PRId64
+#else /* PRId64 */
+#define EDGESTRING                  "%lld"
+#endif /* PRId64 */
+#else /* EDGESIZE64 */
+#define EDGE                        INT           /* Edge indices have same type as vertex indices */
+#define UEDGE                       UINT
+#define COMM_EDGE                   COMM_INT
+#define EDGESTRING                  INTSTRING
+#endif /* EDGESIZE64 */
+#endif /* EDGE       */
+
 #ifndef INTSIZEBITS
 #define INTSIZEBITS                 (sizeof (INT) << 3)
 #endif /* INTSIZEBITS */
 
 #define INTVALMAX                   ((INT) (((UINT) 1 << (INTSIZEBITS - 1)) - 1))
+#define EDGEVALMAX                  ((EDGE) (((UEDGE) 1 << ((sizeof (EDGE) << 3) - 1)) - 1))
 
 #define byte unsigned char                        /* Byte type */
 #ifndef BYTE
@@ -285,6 +311,37 @@
 #endif /* COMM_BYTE */
 #define COMM_PART                   COMM_BYTE
 
+/*
+**  Handling of memory arenas.
+*/
+
+/** The memory arena chunk. Chunks are
+    chained from the most recent one
+    down to the oldest one.             **/
+
+typedef struct MemArenaChunk_ {
+  struct MemArenaChunk_ *   prevptr;              /*+ Previous chunk in stack, or next spare chunk +*/
+  size_t                    prevtop;              /*+ Top offset of previous chunk when pushed     +*/
+  size_t                    sizeval;              /*+ Size of chunk data area                      +*/
+} MemArenaChunk;
+
+/** The memory arena. Blocks are allocated
+    in stack order, and released in LIFO
+    order by returning to a saved mark.     **/
+
+typedef struct MemArena_ {
+  MemArenaChunk *           chnkptr;              /*+ Current chunk, or NULL             +*/
+  size_t                    topval;               /*+ Offset of free space in chunk      +*/
+  MemArenaChunk *           freeptr;              /*+ List of spare chunks kept for reuse +*/
+} MemArena;
+
+/** The memory arena mark. **/
+
+typedef struct MemArenaMark_ {
+  MemArenaChunk *           chnkptr;              /*+ Current chunk at time of mark +*/
+  size_t                    topval;               /*+ Top offset at time of mark    +*/
+} MemArenaMark;
+
 /*
 **  Handling of pseudo-random numbers.
 */
@@ -366,9 +423,10 @@ typedef struct ValuesContext_ ValuesContext;
 /** The execution context. **/
 
 typedef struct Context_ {
-  ThreadContext *           thrdptr;              /*+ Threading context +*/
-  IntRandContext *          randptr;              /*+ Random context    +*/
-  ValuesContext *           valuptr;              /*+ Values context    +*/
+  ThreadContext *           thrdptr;              /*+ Threading context             +*/
+  IntRandContext *          randptr;              /*+ Random context                +*/
+  ValuesContext *           valuptr;              /*+ Values context                +*/
+  MemArena *                arenptr;              /*+ Memory arena of leader thread +*/
 } Context;
 
 /*+ The context splitting user function. +*/
@@ -383,6 +441,21 @@ typedef struct ContextSplit_ {
   void *                    paraptr;              /*+ Parameter data                                   +*/
 } ContextSplit;
 
+/*+ The user function run by every thread of a context, each in its own single-thread sub-context. +*/
+
+typedef void (* ContextSoloFunc) (Context * const, ThreadDescriptor * const, void * const);
+
+/*+ The data structure for passing arguments to the single-thread sub-context threaded routine. +*/
+
+typedef struct ContextSolo_ {
+  Context                   contdat;              /*+ Context data of the initial context        +*/
+  ThreadContext *           thrdtab;              /*+ Array of single-thread thread contexts     +*/
+  IntRandContext *          randtab;              /*+ Array of pseudo-random generators          +*/
+  MemArena *                arentab;              /*+ Array of memory arenas                     +*/
+  ContextSoloFunc           funcptr;              /*+ Pointer to user function to be called      +*/
+  void *                    paraptr;              /*+ Parameter data                             +*/
+} ContextSolo;
+
 /*
 **  Handling of files.
 */
@@ -413,6 +486,13 @@ const char *                envGetStr           (const char * const, const char
 void *                      memAllocGroup       (void **, ...);
 void *                      memReallocGroup     (void *, ...);
 void *                      memOffset           (void *, ...);
+void                        memArenaInit        (MemArena * const);
+void                        memArenaExit        (MemArena * const);
+void *                      memArenaAlloc       (MemArena * const, const size_t);
+void *                      memArenaAllocGroup  (MemArena * const, void **, ...);
+void *                      memArenaRealloc     (MemArena * const, void * const, const size_t, const size_t);
+void                        memArenaRelease     (MemArena * const, const MemArenaMark * const);
+void                        memArenaTrim        (MemArena * const, void * const, const size_t);
 #if ((defined COMMON_MEMORY_TRACE) || (defined COMMON_MEMORY_CHECK))
 void *                      memAllocRecord      (size_t);
 void *                      memReallocRecord    (void * const, size_t);
@@ -435,6 +515,13 @@ void                        errorPrintW         (const char * const, ...);
 
 int                         intLoad             (FILE * const, INT * const);
 int                         intSave             (FILE * const, const INT);
+#ifdef EDGESIZE64
+int                         intLoadEdge         (FILE * const, EDGE * const);
+int                         intSaveEdge         (FILE * const, const EDGE);
+#else /* EDGESIZE64 */
+#define intLoadEdge                 intLoad       /* Edge indices are plain integers */
+#define intSaveEdge                 intSave
+#endif /* EDGESIZE64 */
 void                        intAscn             (INT * const, const INT, const INT);
 void                        intPerm             (INT * const, const INT, Context * const);
 void                        intRandInit         (IntRandContext * const);
@@ -477,10 +564,12 @@ void                        threadScan          (const ThreadDescriptor * const,
 void                        contextInit         (Context * const);
 void                        contextExit         (Context * const);
 int                         contextCommit       (Context * const);
+MemArena *                  contextArena        (Context * const);
 int                         contextRandomClone  (Context * const);
 int                         contextThreadInit2  (Context * const, const int, const int * const);
 int                         contextThreadInit   (Context * const);
 int                         contextThreadLaunchSplit (Context * const, ContextSplitFunc const, void * const);
+int                         contextThreadLaunchSolo (Context * const, ContextSoloFunc const, void * const);
 int                         contextValuesInit   (Context * const, void * const, const size_t, const int, const size_t, const int, const size_t);
 int                         contextValuesGetDbl (Context * const, const int, double * const);
 int                         contextValuesGetInt (Context * const, const int, INT * const);
@@ -491,6 +580,8 @@ int                         contextValuesSetInt (Context * const, const int, con
 **  Macro definitions.
 */
 
+#define memArenaMark(a,m)           ((m)->chnkptr = (a)->chnkptr, (m)->topval = (a)->topval)
+
 #define clockInit(clk)              ((clk)->time[0]  = (clk)->time[1] = 0)
 #define clockStart(clk)             ((clk)->time[0]  = clockGet ())
 #define clockStop(clk)              ((clk)->time[1] += (clockGet () - (clk)->time[0]))
@@ -1,4 +1,4 @@
-/* Copyright 2019,2021-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                context management routines.            **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 12 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -77,6 +77,7 @@ Context * const             contptr)
   contptr->thrdptr = NULL;                        /* Thread context not initialized yet       */
   contptr->randptr = &intranddat;                 /* Use global random generator by default   */
   contptr->valuptr = NULL;                        /* Allow user library to provide its values */
+  contptr->arenptr = NULL;                        /* Memory arena allocated on demand         */
 
   intRandInit (&intranddat);                      /* Make sure random context is initialized before cloning */
 }
@@ -101,11 +102,16 @@ Context * const             contptr)
       memFree (contptr->valuptr->dataptr);
     memFree (contptr->valuptr);
   }
+  if (contptr->arenptr != NULL) {                 /* If memory arena has been used */
+    memArenaExit (contptr->arenptr);
+    memFree (contptr->arenptr);
+  }
 
 #ifdef SCOTCH_DEBUG_CONTEXT1
   contptr->thrdptr = NULL;
   contptr->randptr = NULL;
   contptr->valuptr = NULL;
+  contptr->arenptr = NULL;
 #endif /* SCOTCH_DEBUG_CONTEXT1 */
 }
 
@@ -132,6 +138,38 @@ Context * const             contptr)
   return (o);
 }
 
+/************************************/
+/*                                  */
+/* These routines handle the memory */
+/* arena features of contexts.      */
+/*                                  */
+/************************************/
+
+/*+ This routine returns the memory arena
+*** of the given context, creating it if
+*** necessary. The arena must only be used
+*** by the leader thread of the context,
+*** for blocks which are released in LIFO
+*** order.
+*** It returns:
+*** - !NULL  : pointer to the memory arena.
+*** - NULL   : if the arena could not be created,
+***            in which case callers may use the heap.
++*/
+
+MemArena *
+contextArena (
+Context * const             contptr)
+{
+  if (contptr->arenptr == NULL) {                 /* If arena not yet created */
+    if ((contptr->arenptr = memAlloc (sizeof (MemArena))) == NULL)
+      return (NULL);
+    memArenaInit (contptr->arenptr);
+  }
+
+  return (contptr->arenptr);
+}
+
 /************************************/
 /*                                  */
 /* These routines handle the random */
@@ -232,7 +270,8 @@ Context * const             contptr)
 ** context into two sub-contexts, each of them inheriting
 ** of (almost) half of the threads of the initial context.
 ** A new, independent, pseudo-random generator is created
-** for the second sub-context. The two sub-contexts are
+** for the second sub-context, and each sub-context leader
+** is given its own memory arena. The two sub-contexts are
 ** initialized as if a contextInit() were called on each
 ** of them, after which each sub-context leader runs the
 ** user-provided function within its sub-context.
@@ -278,6 +317,7 @@ void * const                paraptr)              /* Function parameters */
   ContextSplit              spltdat;              /* Data structure for passing arguments         */
   ThreadContext             thrdtab[2];           /* Thread contexts for both sub-contexts        */
   IntRandContext            randdat;              /* Pseudo-random context for second sub-context */
+  MemArena                  arentab[2];           /* Memory arenas for both sub-context leaders   */
   const int                 thrdnbr = contextThreadNbr (contptr);
 
   if (thrdnbr <= 1)                               /* If current context too small or inactive, nothing to do */
@@ -286,9 +326,11 @@ void * const                paraptr)              /* Function parameters */
   spltdat.conttab[0].thrdptr = &thrdtab[0];
   spltdat.conttab[0].randptr = contptr->randptr;  /* Re-use pseudo-random generator of initial context in sub-context 0 */
   spltdat.conttab[0].valuptr = contptr->valuptr;
+  spltdat.conttab[0].arenptr = &arentab[0];
   spltdat.conttab[1].thrdptr = &thrdtab[1];
   spltdat.conttab[1].randptr = &randdat;          /* Set independent pseudo-random generator for sub-context 1 */
   spltdat.conttab[1].valuptr = contptr->valuptr;
+  spltdat.conttab[1].arenptr = &arentab[1];
   spltdat.funcptr = funcptr;
   spltdat.paraptr = paraptr;
 
@@ -298,7 +340,88 @@ void * const                paraptr)              /* Function parameters */
   intRandProc (&randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator from existing one */
   intRandSeed (&randdat, intRandVal2 (contptr->randptr));
 
+  memArenaInit (&arentab[0]);                     /* Chunks are only allocated when used */
+  memArenaInit (&arentab[1]);
+
   threadLaunch (contptr->thrdptr, (ThreadFunc) contextThreadLaunchSplit2, (void *) &spltdat); /* Launch all threads of initial context */
 
+  memArenaExit (&arentab[0]);
+  memArenaExit (&arentab[1]);
+
+  return (0);
+}
+
+/* This routine, to be called only by the leader thread
+** of the current threading environment, runs the given
+** user function on every thread of this context, each of
+** them within its own single-thread sub-context. Every
+** sub-context has its own memory arena and, save for
+** that of the leader thread, which re-uses the generator
+** of the initial context, its own independent
+** pseudo-random generator. The thread descriptor of
+** the initial context is also passed to the user
+** function, so that threads can synchronize.
+** It returns:
+** - 0  : if sub-contexts could be created.
+** - 1  : if initial context is too small or on error.
+*/
+
+static
+void
+contextThreadLaunchSolo2 (
+ThreadDescriptor * restrict const descptr,        /*+ Thread descriptor in initial context +*/
+ContextSolo * restrict const      soloptr)        /*+ Data structure for sub-contexts      +*/
+{
+  Context             contdat;                    /* Single-thread sub-context */
+
+  const int           thrdnum = threadNum (descptr);
+
+  contdat.thrdptr = &soloptr->thrdtab[thrdnum];
+  contdat.randptr = (thrdnum == 0) ? soloptr->contdat.randptr : &soloptr->randtab[thrdnum];
+  contdat.valuptr = soloptr->contdat.valuptr;
+  contdat.arenptr = &soloptr->arentab[thrdnum];
+
+  soloptr->funcptr (&contdat, descptr, soloptr->paraptr);
+}
+
+int
+contextThreadLaunchSolo (
+Context * const             contptr,
+ContextSoloFunc const       funcptr,              /* Function to launch  */
+void * const                paraptr)              /* Function parameters */
+{
+  ContextSolo               solodat;              /* Data structure for passing arguments */
+  int                       thrdnum;
+
+  const int                 thrdnbr = contextThreadNbr (contptr);
+
+  if (thrdnbr <= 1)                               /* If current context too small or inactive, nothing to do */
+    return (1);
+
+  if (memAllocGroup ((void **) (void *)
+                     &solodat.thrdtab, (size_t) (thrdnbr * sizeof (ThreadContext)),
+                     &solodat.randtab, (size_t) (thrdnbr * sizeof (IntRandContext)),
+                     &solodat.arentab, (size_t) (thrdnbr * sizeof (MemArena)), NULL) == NULL)
+    return (1);                                   /* Not enough memory for sub-contexts */
+
+  solodat.contdat = *contptr;
+  solodat.funcptr = funcptr;
+  solodat.paraptr = paraptr;
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    threadContextImport1 (&solodat.thrdtab[thrdnum], 1); /* Sub-contexts never start their own threads */
+    if (thrdnum > 0) {                            /* Initialize new generators from existing one */
+      intRandProc (&solodat.randtab[thrdnum], intRandVal2 (contptr->randptr));
+      intRandSeed (&solodat.randtab[thrdnum], intRandVal2 (contptr->randptr));
+    }
+    memArenaInit (&solodat.arentab[thrdnum]);     /* Chunks are only allocated when used */
+  }
+
+  threadLaunch (contptr->thrdptr, (ThreadFunc) contextThreadLaunchSolo2, (void *) &solodat); /* Launch all threads of initial context */
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    memArenaExit (&solodat.arentab[thrdnum]);
+  memFree (solodat.thrdtab);                      /* Free group leader */
+
   return (0);
 }
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014-2016,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014-2016,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 03 jun 2018     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -132,6 +132,73 @@ const INT                   val)                  /*+ Value to write     +*/
   return ((fprintf (stream, INTSTRING, (INT) val) == EOF) ? 0 : 1);
 }
 
+#ifdef EDGESIZE64
+
+/* Fast read for EDGE values.
+** It returns:
+** - 1  : on success.
+** - 0  : on error.
+*/
+
+int
+intLoadEdge (
+FILE * const                stream,               /*+ Stream to read from     +*/
+EDGE * const                valptr)               /*+ Area where to put value +*/
+{
+  int                 sign;                       /* Sign flag      */
+  int                 car;                        /* Character read */
+  EDGE                val;                        /* Value          */
+
+  sign = 0;                                       /* Assume positive constant     */
+  for ( ; ; ) {                                   /* Consume whitespaces and sign */
+    car = getc (stream);
+    if (isspace (car))
+      continue;
+    if ((car >= '0') && (car <= '9'))
+      break;
+    if (car == '-') {
+      sign = 1;
+      car  = getc (stream);
+      break;
+    }
+    if (car == '+') {
+      car = getc (stream);
+      break;
+    }
+    return (0);
+  }
+  if ((car < '0') || (car > '9'))                 /* If first char is non numeric */
+    return (0);                                   /* Then it is an error          */
+  val = car - '0';                                /* Get first digit              */
+  for ( ; ; ) {
+    car = getc (stream);
+    if ((car < '0') || (car > '9')) {
+      ungetc (car, stream);
+      break;
+    }
+    val = val * 10 + (car - '0');                 /* Accumulate digits */
+  }
+  *valptr = (sign != 0) ? (- val) : val;          /* Set result */
+
+  return (1);
+}
+
+/* Write routine for EDGE values.
+** It returns:
+** - 1  : on success.
+** - 0  : on error.
+*/
+
+int
+intSaveEdge (
+FILE * const                stream,               /*+ Stream to write to +*/
+const EDGE                  val)                  /*+ Value to write     +*/
+{
+  return ((fprintf (stream, EDGESTRING, (EDGE) val) == EOF) ? 0 : 1);
+}
+
+#endif /* EDGESIZE64 */
+
 /**********************************/
 /*                                */
 /* Permutation building routines. */
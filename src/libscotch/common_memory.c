@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2012,2015,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2012,2015,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -51,7 +51,7 @@
 /**                # Version 6.1  : from : 24 jun 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 08 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -64,6 +64,10 @@
 
 #define COMMON_MEMORY_SZSP          (MAX ((sizeof (size_t)), (sizeof (double)))) /* Space for size, properly aligned */
 
+#define COMMON_MEMORY_ARENAALGN     (sizeof (double)) /* Alignment of arena blocks, as for memAllocGroup() */
+#define COMMON_MEMORY_ARENAHEAD     ((sizeof (MemArenaChunk) + (COMMON_MEMORY_ARENAALGN - 1)) & (~ (COMMON_MEMORY_ARENAALGN - 1)))
+#define COMMON_MEMORY_ARENASIZE     ((size_t) 1 << 20) /* Size of standard arena chunks */
+
 #ifdef COMMON_MEMORY_CHECK
 
 #ifndef COMMON_MEMORY_TRACE
@@ -600,3 +604,259 @@ void *                      memptr,               /*+ Pointer to base address of
 
   return ((void *) ((byte *) memptr + memoff));
 }
+
+/****************************************/
+/*                                      */
+/* These routines handle memory arenas, */
+/* used as per-thread stack allocators. */
+/*                                      */
+/****************************************/
+
+/* This routine initializes an empty
+** memory arena. No chunk is allocated
+** until the first allocation request.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+memArenaInit (
+MemArena * const            arenptr)
+{
+  arenptr->chnkptr = NULL;
+  arenptr->topval  = 0;
+  arenptr->freeptr = NULL;
+}
+
+/* This routine frees all of the chunks
+** of the given memory arena, including
+** spare chunks.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+memArenaExit (
+MemArena * const            arenptr)
+{
+  MemArenaChunk *     chnkptr;
+  MemArenaChunk *     chnktmp;
+
+  for (chnkptr = arenptr->chnkptr; chnkptr != NULL; chnkptr = chnktmp) {
+    chnktmp = chnkptr->prevptr;
+    memFree (chnkptr);
+  }
+  for (chnkptr = arenptr->freeptr; chnkptr != NULL; chnkptr = chnktmp) {
+    chnktmp = chnkptr->prevptr;
+    memFree (chnkptr);
+  }
+
+  memArenaInit (arenptr);
+}
+
+/* This routine allocates a block on top
+** of the given memory arena. Blocks cannot
+** be freed individually: they are released
+** in LIFO order by memArenaRelease().
+** It returns:
+** - !NULL  : pointer to the block.
+** - NULL   : on error.
+*/
+
+void *
+memArenaAlloc (
+MemArena * const            arenptr,
+const size_t                sizeval)
+{
+  MemArenaChunk *     chnkptr;
+  MemArenaChunk **    chnkpptr;
+  size_t              sizetmp;
+  size_t              topval;
+
+  sizetmp = (sizeval + (COMMON_MEMORY_ARENAALGN - 1)) & (~ (COMMON_MEMORY_ARENAALGN - 1));
+
+  chnkptr = arenptr->chnkptr;
+  if ((chnkptr != NULL) &&                        /* If block fits in current chunk */
+      ((chnkptr->sizeval - arenptr->topval) >= sizetmp)) {
+    topval = arenptr->topval;
+    arenptr->topval = topval + sizetmp;
+    return ((void *) ((byte *) chnkptr + COMMON_MEMORY_ARENAHEAD + topval));
+  }
+
+  for (chnkpptr = &arenptr->freeptr; *chnkpptr != NULL; chnkpptr = &(*chnkpptr)->prevptr) { /* Search spare chunks */
+    if ((*chnkpptr)->sizeval >= sizetmp)
+      break;
+  }
+  if ((chnkptr = *chnkpptr) != NULL)              /* If spare chunk found, unlink it */
+    *chnkpptr = chnkptr->prevptr;
+  else {
+    size_t              chnksiz;
+
+    chnksiz = MAX (sizetmp, COMMON_MEMORY_ARENASIZE);
+    if ((chnkptr = memAlloc (COMMON_MEMORY_ARENAHEAD + chnksiz)) == NULL)
+      return (NULL);
+    chnkptr->sizeval = chnksiz;
+  }
+
+  chnkptr->prevptr = arenptr->chnkptr;            /* Push chunk on top of stack */
+  chnkptr->prevtop = arenptr->topval;
+  arenptr->chnkptr = chnkptr;
+  arenptr->topval  = sizetmp;
+
+  return ((void *) ((byte *) chnkptr + COMMON_MEMORY_ARENAHEAD));
+}
+
+/* This routine allocates a set of arrays
+** in a single block on top of the given
+** memory arena, in the same way as
+** memAllocGroup() does.
+** It returns:
+** - !NULL  : pointer to block, all arrays allocated.
+** - NULL   : no array allocated; first block pointer is also set to NULL.
+*/
+
+void *
+memArenaAllocGroup (
+MemArena * const            arenptr,              /*+ Arena to allocate from                +*/
+void **                     memptr,               /*+ Pointer to first argument to allocate +*/
+...)
+{
+  va_list             memlist;                    /* Argument list of the call              */
+  byte **             memloc;                     /* Pointer to pointer of current argument */
+  size_t              memoff;                     /* Offset value of argument               */
+  byte *              blkptr;                     /* Pointer to memory block                */
+
+  memoff = 0;
+  memloc = (byte **) memptr;                      /* Point to first memory argument */
+  va_start (memlist, memptr);                     /* Start argument parsing         */
+  while (memloc != NULL) {                        /* As long as not NULL pointer    */
+    memoff  = (memoff + (sizeof (double) - 1)) & (~ (sizeof (double) - 1));
+    memoff += va_arg (memlist, size_t);
+    memloc  = va_arg (memlist, byte **);
+  }
+  va_end (memlist);
+
+  if ((blkptr = (byte *) memArenaAlloc (arenptr, memoff)) == NULL) { /* If cannot allocate */
+    *memptr = NULL;                               /* Set first pointer to NULL             */
+    return (NULL);
+  }
+
+  memoff = 0;
+  memloc = (byte **) memptr;                      /* Point to first memory argument */
+  va_start (memlist, memptr);                     /* Restart argument parsing       */
+  while (memloc != NULL) {                        /* As long as not NULL pointer    */
+    memoff  = (memoff + (sizeof (double) - 1)) & (~ (sizeof (double) - 1)); /* Pad  */
+    *memloc = blkptr + memoff;                    /* Set argument address           */
+    memoff += va_arg (memlist, size_t);           /* Accumulate padded sizes        */
+    memloc  = va_arg (memlist, void *);           /* Get next argument pointer      */
+  }
+  va_end (memlist);
+
+  return ((void *) blkptr);
+}
+
+/* This routine releases all of the blocks
+** allocated since the given mark was taken
+** with memArenaMark(). Standard-sized chunks
+** are kept for reuse, while oversized ones
+** are given back to the system.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+memArenaRelease (
+MemArena * const            arenptr,
+const MemArenaMark * const  markptr)
+{
+  MemArenaChunk *     chnkptr;
+
+  while ((chnkptr = arenptr->chnkptr) != markptr->chnkptr) { /* Pop chunks pushed after mark */
+    arenptr->chnkptr = chnkptr->prevptr;
+    arenptr->topval  = chnkptr->prevtop;
+    if (chnkptr->sizeval > COMMON_MEMORY_ARENASIZE) /* Do not keep oversized chunks */
+      memFree (chnkptr);
+    else {
+      chnkptr->prevptr = arenptr->freeptr;
+      arenptr->freeptr = chnkptr;
+    }
+  }
+  arenptr->topval = markptr->topval;
+}
+
+/* This routine resizes a block allocated
+** from the given memory arena. If the block
+** is the topmost one and there is enough
+** space left in its chunk, it is resized
+** in place; else, a new block is allocated
+** on top of the arena, and the contents of
+** the old block are copied into it. In the
+** latter case, the space of the old block
+** is only reclaimed when the arena is
+** released past it.
+** It returns:
+** - !NULL  : pointer to the resized block.
+** - NULL   : on error; old block is left unchanged.
+*/
+
+void *
+memArenaRealloc (
+MemArena * const            arenptr,
+void * const                oldptr,
+const size_t                oldsiz,
+const size_t                newsiz)
+{
+  void *              newptr;
+
+  if (arenptr->chnkptr != NULL) {
+    byte *              datptr;
+    size_t              oldoft;
+
+    datptr = (byte *) arenptr->chnkptr + COMMON_MEMORY_ARENAHEAD;
+    oldoft = (byte *) oldptr - datptr;
+    if (((byte *) oldptr >= datptr) &&            /* If block is topmost block of current chunk */
+        ((oldoft + ((oldsiz + (COMMON_MEMORY_ARENAALGN - 1)) & (~ (COMMON_MEMORY_ARENAALGN - 1)))) == arenptr->topval)) {
+      size_t              topval;
+
+      topval = oldoft + ((newsiz + (COMMON_MEMORY_ARENAALGN - 1)) & (~ (COMMON_MEMORY_ARENAALGN - 1)));
+      if (topval <= arenptr->chnkptr->sizeval) {  /* If block can be resized in place */
+        arenptr->topval = topval;
+        return (oldptr);
+      }
+    }
+  }
+
+  if ((newptr = memArenaAlloc (arenptr, newsiz)) == NULL)
+    return (NULL);
+  memCpy (newptr, oldptr, MIN (oldsiz, newsiz));
+
+  return (newptr);
+}
+
+/* This routine shrinks the topmost block
+** of the given memory arena, which must
+** start at the given address.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+memArenaTrim (
+MemArena * const            arenptr,
+void * const                blkptr,
+const size_t                sizeval)
+{
+  byte *              datptr;
+  size_t              topval;
+
+  if (arenptr->chnkptr == NULL)                   /* Nothing to trim if arena is empty */
+    return;
+
+  datptr = (byte *) arenptr->chnkptr + COMMON_MEMORY_ARENAHEAD;
+  if (((byte *) blkptr < datptr) || ((byte *) blkptr > (datptr + arenptr->topval))) /* If block not in current chunk */
+    return;
+
+  topval = ((byte *) blkptr - datptr) + ((sizeval + (COMMON_MEMORY_ARENAALGN - 1)) & (~ (COMMON_MEMORY_ARENAALGN - 1)));
+  if (topval < arenptr->topval)
+    arenptr->topval = topval;
+}
@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2012,2015,2019,2021,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2012,2015,2019,2021,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -61,7 +61,7 @@
 /**                # Version 6.1  : from : 19 jun 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -114,10 +114,20 @@ typedef INT                 Gnum;                 /* Vertex or edge number
 #define GNUMSTRING                  INTSTRING     /* String to printf a Gnum    */
 #endif /* GNUMMAX */
 
+#ifndef GENUMMAX                                  /* If graph.h not included    */
+typedef EDGE                Genum;                /* Edge index or number       */
+#define GENUMMAX                    EDGEVALMAX    /* Maximum Genum value        */
+#define GENUMSTRING                 EDGESTRING    /* String to printf a Genum   */
+#endif /* GENUMMAX */
+
 #ifndef GNUM_MPI
 #define GNUM_MPI                    COMM_INT      /* MPI type for Gnum is MPI type for INT */
 #endif /* GNUM_MPI */
 
+#ifndef GENUM_MPI
+#define GENUM_MPI                   COMM_EDGE     /* MPI type for Genum is MPI type for EDGE */
+#endif /* GENUM_MPI */
+
 #ifndef GRAPHPART_MPI
 #define GRAPHPART_MPI               COMM_BYTE     /* Raw byte type for graph parts */
 #endif /* GRAPHPART_MPI */
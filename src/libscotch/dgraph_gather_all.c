@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2010,2012,2018,2021,2023,2025 Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2010,2012,2018,2021,2023,2025,2026 Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 18 jun 2021     **/
 /**                                 to   : 04 dec 2021     **/
 /**                # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The definitions of MPI_Gather and     **/
 /**                  MPI_Gatherv indicate that elements in **/
@@ -241,6 +241,8 @@ const int                     protnum)            /* -1 means allgather */
     cgrfptr->edlotax = edlotax;
     cgrfptr->edlosum = edlosum;
     cgrfptr->degrmax = dgrfptr->degrglbmax;
+    cgrfptr->vconnbr = 0;
+    cgrfptr->vcontax = NULL;
   }
 #ifdef SCOTCH_DEBUG_DGRAPH2                       /* Prevent Valgrind from yelling */
   else {                                          /* Process is not root           */
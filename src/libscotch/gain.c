@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 20 aug 2020     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Most of the contents of this module   **/
 /**                  comes from "map_b_fm" of the SCOTCH   **/
@@ -134,9 +134,163 @@ GainEntr * const            entrptr)
 
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
+/* This routine returns the index of the first
+** non-empty entry of an array gain table, in
+** the given index range, by way of its bit map.
+** It returns:
+** - >=0  : index of the non-empty entry.
+** - -1   : if all entries of the range are empty.
+*/
+
+static
+INT
+gainTablBmapNext (
+const GainTabl * const      tablptr,
+INT                         entrnum,              /*+ First entry index to consider +*/
+const INT                   entrnnd)              /*+ After-last entry index        +*/
+{
+  const UINT * restrict bmaptab;
+  INT                   wordnum;
+  UINT                  wordval;
+
+  if (entrnum >= entrnnd)
+    return (-1);
+
+  bmaptab = tablptr->bmaptab;
+  wordnum = entrnum / GAIN_BMAPBITS;
+  wordval = bmaptab[wordnum] >> (entrnum % GAIN_BMAPBITS); /* Discard bits of preceding entries */
+  if (wordval == 0) {                             /* If no non-empty entry in rest of word  */
+    INT                   wordnnd;
+
+    wordnnd = (entrnnd + GAIN_BMAPBITS - 1) / GAIN_BMAPBITS;
+    do {                                          /* Skip empty words */
+      if (++ wordnum >= wordnnd)
+        return (-1);
+    } while ((wordval = bmaptab[wordnum]) == 0);
+    entrnum = wordnum * GAIN_BMAPBITS;
+  }
+  for ( ; (wordval & 1) == 0; wordval >>= 1, entrnum ++) ; /* Find first set bit */
+
+  return ((entrnum < entrnnd) ? entrnum : -1);
+}
+
+/* This routine allocates the given number of
+** link slots from the current slot block of an
+** array gain table, allocating a new block if
+** necessary. Block sizes grow geometrically.
+** It returns:
+** - !NULL  : pointer to the slot array.
+** - NULL   : on error.
+*/
+
+static
+GainLink **
+gainTablArryAlloc (
+GainTabl * const            tablptr,
+const INT                   linksiz)
+{
+  GainBlok *          blokptr;
+  INT                 bloksiz;
+
+  if ((tablptr->bloknum + linksiz) <= tablptr->bloksiz) { /* If enough space in current block */
+    GainLink **         linktab;
+
+    linktab = tablptr->blokptr->linktab + tablptr->bloknum;
+    tablptr->bloknum += linksiz;
+    return (linktab);
+  }
+
+  bloksiz = MAX (MAX (2 * tablptr->bloksiz, GAIN_BLOKSIZ), linksiz);
+  if ((blokptr = (GainBlok *) memAlloc (sizeof (GainBlok) + (bloksiz - 1) * sizeof (GainLink *))) == NULL)
+    return (NULL);
+  blokptr->nextptr = tablptr->blokptr;            /* Chain block for freeing */
+  tablptr->blokptr = blokptr;
+  tablptr->bloknum = linksiz;
+  tablptr->bloksiz = bloksiz;
+
+  return (blokptr->linktab);
+}
+
+/* This routine links the given link into the
+** array of the given entry of an array gain
+** table. Deleted links are not removed from
+** entry arrays, but are left as stale slots
+** which are skipped when arrays are scanned,
+** and reclaimed when arrays would have to be
+** extended. Should the array not be extended,
+** the link is marked as linked but is never
+** returned, so that it can be deleted safely.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+gainTablAddArry (
+GainTabl * const            tablptr,
+GainLink * const            linkptr,
+GainEntr * const            entrptr)
+{
+  GainArry *          arryptr;
+  INT                 entrnum;
+
+  if (entrptr < tablptr->tmin)
+    tablptr->tmin = entrptr;
+  if (entrptr > tablptr->tmax)
+    tablptr->tmax = entrptr;
+
+  entrnum = (INT) (entrptr - tablptr->tabk);
+  arryptr = tablptr->arrytab + entrnum;
+  linkptr->next = &gainLinkDummy;                 /* Link is linked in table */
+  linkptr->tabl = entrptr;                        /* Set table position      */
+  if (arryptr->linknbr >= arryptr->linksiz) {     /* If array is full */
+    if ((arryptr->linksiz > 0) &&                 /* If enough stale slots, pack array */
+        (arryptr->livenbr <= (arryptr->linknbr / 2))) {
+      GainLink **         linktab;
+      INT                 linknum;
+      INT                 linknew;
+
+      linktab = arryptr->linktab;
+      for (linknum = linknew = 0; linknum < arryptr->linknbr; linknum ++) {
+        GainLink *          linktmp;
+
+        linktmp = linktab[linknum];
+        if (gainTablArryLive (linktmp, entrptr, linknum)) {
+          linktab[linknew] = linktmp;
+          linktmp->prev    = (GainLink *) ~ (intptr_t) linknew;
+          linknew ++;
+        }
+      }
+      arryptr->linknbr = linknew;
+    }
+    else {                                        /* Array has to be extended */
+      GainLink **         linktmp;
+      INT                 linksiz;
+
+      linksiz = (arryptr->linksiz > 0) ? (arryptr->linksiz * 2) : GAIN_ARRYSIZ;
+      if ((linktmp = gainTablArryAlloc (tablptr, linksiz)) == NULL) {
+        errorPrint ("gainTablAddArry: out of memory");
+        linkptr->prev = NULL;                     /* Link will not be considered */
+        return;
+      }
+      memCpy (linktmp, arryptr->linktab, arryptr->linknbr * sizeof (GainLink *)); /* Old slots are lost until table is freed */
+      arryptr->linktab = linktmp;
+      arryptr->linksiz = linksiz;
+    }
+  }
+
+  linkptr->prev = (GainLink *) ~ (intptr_t) arryptr->linknbr; /* Record position of link in array */
+  arryptr->linktab[arryptr->linknbr ++] = linkptr;
+  if (arryptr->livenbr ++ == 0)                   /* If entry was empty, update bit map */
+    tablptr->bmaptab[entrnum / GAIN_BMAPBITS] |= ((UINT) 1) << (entrnum % GAIN_BMAPBITS);
+}
+
 /* This routine allocates and initializes
 ** a gain table structure with the proper
-** number of subbits.
+** number of subbits. If a memory arena is
+** provided, the table is allocated on top
+** of it, and gainTablExit() will release
+** the arena back to its prior state.
 ** It returns:
 ** - !NULL  : pointer to the gain table;
 ** - NULL   : on error.
@@ -145,30 +299,59 @@ GainEntr * const            entrptr)
 GainTabl *
 gainTablInit (
 const INT                   gainmax,
-const INT                   subbits)
+const INT                   subbits,
+const GainTablType          typeval,              /*+ Type of gain table                    +*/
+MemArena * const            arenptr)              /*+ Memory arena to use, or NULL for heap +*/
 {
   GainEntr *          entrptr;
   GainTabl *          tablptr;
+  MemArenaMark        markdat;
   INT                 totsize;
 
-  if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing           */
-    totsize = ((sizeof (INT) << 3) - subbits) << (subbits + 1); /* Allocate gain table */
+  totsize = (gainmax >= GAIN_LINMAX)              /* Compute gain table size */
+            ? (((sizeof (INT) << 3) - subbits) << (subbits + 1))
+            : (2 * GAIN_LINMAX);
 
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
+  if (arenptr != NULL) {
+    memArenaMark (arenptr, &markdat);
+    tablptr = (GainTabl *) memArenaAlloc (arenptr, sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr));
+  }
+  else
+    tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr));
+  if (tablptr == NULL)
+    return (NULL);
+  tablptr->arenptr = arenptr;
+  if (arenptr != NULL)
+    tablptr->markdat = markdat;
+
+  tablptr->arrytab = NULL;                        /* Assume list table */
+  tablptr->bmaptab = NULL;
+  tablptr->blokptr = NULL;                        /* No slot block allocated yet */
+  tablptr->bloknum =
+  tablptr->bloksiz = 0;
+  if (typeval == GAINTABLTYPEARRY) {              /* If array table, allocate per-entry arrays and bit map */
+    INT                 bmapnbr;
+
+    bmapnbr = (totsize + GAIN_BMAPBITS - 1) / GAIN_BMAPBITS;
+    if (memAllocGroup ((void **) (void *)
+                       &tablptr->arrytab, (size_t) (totsize * sizeof (GainArry)),
+                       &tablptr->bmaptab, (size_t) (bmapnbr * sizeof (UINT)), NULL) == NULL) {
+      tablptr->arrytab = NULL;
+      gainTablExit (tablptr);
       return (NULL);
+    }
+    memSet (tablptr->arrytab, 0, totsize * sizeof (GainArry)); /* No entry array allocated yet */
+    memSet (tablptr->bmaptab, 0, bmapnbr * sizeof (UINT)); /* All entries are empty         */
+  }
 
-    tablptr->tablAdd = gainTablAddLog;
+  if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing */
+    tablptr->tablAdd = (typeval == GAINTABLTYPEARRY) ? gainTablAddLogArry : gainTablAddLog;
 
     tablptr->subbits = subbits;                   /* Fill gain table fields                    */
     tablptr->submask = (1 << (subbits + 1)) - 1;  /* Mask with all subbits, plus one, set to 1 */
   }
-  else {                                          /* Linear indexing     */
-    totsize = 2 * GAIN_LINMAX;                    /* Allocate gain table */
-
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
-      return (NULL);
-
-    tablptr->tablAdd = gainTablAddLin;
+  else {                                          /* Linear indexing */
+    tablptr->tablAdd = (typeval == GAINTABLTYPEARRY) ? gainTablAddLinArry : gainTablAddLin;
     tablptr->subbits = 0;                         /* Fill gain table fields */
     tablptr->submask = 0;
   }
@@ -195,7 +378,25 @@ void
 gainTablExit (
 GainTabl * const         tablptr)
 {
-  memFree (tablptr);                              /* Free table structure itself */
+  if (tablptr->arrytab != NULL) {                 /* If array table, free slot blocks */
+    GainBlok *          blokptr;
+    GainBlok *          bloktmp;
+
+    for (blokptr = tablptr->blokptr; blokptr != NULL; blokptr = bloktmp) {
+      bloktmp = blokptr->nextptr;
+      memFree (blokptr);
+    }
+    memFree (tablptr->arrytab);                   /* Free group leader */
+  }
+
+  if (tablptr->arenptr != NULL) {                 /* If table is on top of arena */
+    MemArenaMark        markdat;
+
+    markdat = tablptr->markdat;                   /* Copy mark before releasing table space */
+    memArenaRelease (tablptr->arenptr, &markdat);
+  }
+  else
+    memFree (tablptr);                            /* Free table structure itself */
 }
 
 /* This routine flushes the contents of
@@ -210,9 +411,18 @@ GainTabl * const            tablptr)
 {
   GainEntr *          entrptr;
 
-  for (entrptr  = tablptr->tmin;                  /* Flush only used area */
-       entrptr <= tablptr->tmax; entrptr ++)
-    entrptr->next = &gainLinkDummy;               /* Point to dummy link area */
+  if (tablptr->arrytab != NULL) {                 /* If array table, keep link arrays for re-use */
+    for (entrptr  = tablptr->tmin;                /* Flush only used area */
+         entrptr <= tablptr->tmax; entrptr ++)
+      tablptr->arrytab[entrptr - tablptr->tabk].linknbr =
+      tablptr->arrytab[entrptr - tablptr->tabk].livenbr = 0;
+    memSet (tablptr->bmaptab, 0, ((tablptr->totsize + GAIN_BMAPBITS - 1) / GAIN_BMAPBITS) * sizeof (UINT));
+  }
+  else {
+    for (entrptr  = tablptr->tmin;                /* Flush only used area */
+         entrptr <= tablptr->tmax; entrptr ++)
+      entrptr->next = &gainLinkDummy;             /* Point to dummy link area */
+  }
 
   tablptr->tmin = tablptr->tend;                  /* Entries of extremal gain */
   tablptr->tmax = tablptr->tabk;
@@ -315,6 +525,64 @@ const INT                   gain)                 /*+ Gain value              +*
   entrptr->next       = linkptr;
 }
 
+/* These routines add a vertex to the array
+** table and table gain indicated in the
+** vertex fields.
+** They return:
+** - VOID  : in all cases.
+*/
+
+void
+gainTablAddLinArry (
+GainTabl * const            tablptr,              /*+ Pointer to gain table   +*/
+GainLink * const            linkptr,              /*+ Pointer to entry to add +*/
+const INT                   gain)                 /*+ Gain value              +*/
+{
+  GainEntr *          entrptr;                    /* Pointer to gain entry */
+
+#ifdef SCOTCH_DEBUG_GAIN2
+  if (tablptr->tablAdd != gainTablAddLinArry) {
+    errorPrint ("gainTablAddLinArry: table type mismatch");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_GAIN2 */
+
+  entrptr = tablptr->tabl + gain;
+  if (entrptr < tablptr->tabk)
+    entrptr = tablptr->tabk;
+  else if (entrptr > tablptr->tend)
+    entrptr = tablptr->tend;
+
+  gainTablAddArry (tablptr, linkptr, entrptr);
+}
+
+void
+gainTablAddLogArry (
+GainTabl * const            tablptr,              /*+ Pointer to gain table   +*/
+GainLink * const            linkptr,              /*+ Pointer to entry to add +*/
+const INT                   gain)                 /*+ Gain value              +*/
+{
+  INT                 i, j;
+
+#ifdef SCOTCH_DEBUG_GAIN2
+  if (tablptr->tablAdd != gainTablAddLogArry) {
+    errorPrint ("gainTablAddLogArry: table type mismatch");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_GAIN2 */
+
+  if (gain >= 0) {                                /* Compute table entry for gain */
+    for (i = 0, j = gain; j > tablptr->submask; i ++, j >>= 1) ;
+    i = (i << tablptr->subbits) + j;
+  }
+  else {
+    for (i = 0, j = - (gain + 1); j > tablptr->submask; i ++, j >>= 1) ;
+    i = - ((i << tablptr->subbits) + j + 1);
+  }
+
+  gainTablAddArry (tablptr, linkptr, tablptr->tabl + i);
+}
+
 /* This routine removes a link
 ** from the table.
 ** It returns:
@@ -340,11 +608,55 @@ GainLink * const            linkptr)              /*+ Pointer to link to delete
     }
   }
 #endif /* SCOTCH_DEBUG_GAIN3 */
+  if (tablptr->arrytab != NULL) {
+    gainTablDelArry (tablptr, linkptr);
+    return;
+  }
+
   linkptr->next->prev = linkptr->prev;            /* TRICK: may write in dummy link area */
   linkptr->prev->next = linkptr->next;
 }
 #endif /* SCOTCH_DEBUG_GAIN1 */
 
+/* This routine removes a link from an array
+** table. The slot of the link is left stale,
+** save when it is at the top of its array.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+gainTablDelArry (
+GainTabl * const            tablptr,
+GainLink * const            linkptr)              /*+ Pointer to link to delete +*/
+{
+  GainArry *          arryptr;
+  INT                 entrnum;
+  INT                 linknum;
+
+  linknum = (INT) ~ (intptr_t) linkptr->prev;
+  if (linknum < 0)                                /* If link could not be added, nothing to do */
+    return;
+
+  entrnum = (INT) (linkptr->tabl - tablptr->tabk);
+  arryptr = tablptr->arrytab + entrnum;
+#ifdef SCOTCH_DEBUG_GAIN2
+  if ((linknum >= arryptr->linknbr) ||
+      (arryptr->linktab[linknum] != linkptr)) {
+    errorPrint ("gainTablDelArry: invalid link");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_GAIN2 */
+
+  linkptr->prev = NULL;                           /* Make slot stale */
+  if (-- arryptr->livenbr == 0) {                 /* If entry is now empty, reset it and update bit map */
+    arryptr->linknbr = 0;
+    tablptr->bmaptab[entrnum / GAIN_BMAPBITS] &= ~(((UINT) 1) << (entrnum % GAIN_BMAPBITS));
+  }
+  else if (linknum == (arryptr->linknbr - 1))     /* If slot is at top of array, reclaim it */
+    arryptr->linknbr = linknum;
+}
+
 /* This routine returns the link of best
 ** gain in the table structure.
 ** It returns:
@@ -358,6 +670,25 @@ GainTabl * const            tablptr)
 {
   GainEntr *          entrptr;
 
+  if (tablptr->arrytab != NULL) {                 /* If array table */
+    GainArry *          arryptr;
+    INT                 entrnum;
+    INT                 linknum;
+
+    entrnum = gainTablBmapNext (tablptr, (INT) (tablptr->tmin - tablptr->tabk), tablptr->totsize);
+    if (entrnum < 0) {
+      tablptr->tmin = tablptr->tend;              /* Set table as empty */
+      tablptr->tmax = tablptr->tabk;
+      return (NULL);
+    }
+    entrptr       = tablptr->tabk + entrnum;
+    tablptr->tmin = entrptr;                      /* Record position of first non-empty entry */
+    arryptr       = tablptr->arrytab + entrnum;
+    for (linknum = arryptr->linknbr - 1; ! gainTablArryLive (arryptr->linktab[linknum], entrptr, linknum); linknum --) ; /* Skip stale slots */
+    arryptr->linknbr = linknum + 1;               /* Reclaim stale slots at top of array */
+    return (arryptr->linktab[linknum]);
+  }
+
   entrptr = tablptr->tmin;
   if (entrptr->next != &gainLinkDummy) {
 #ifdef SCOTCH_DEBUG_GAIN3
@@ -401,6 +732,35 @@ const GainLink * const      linkptr)
 {
   GainEntr *          entrptr;
 
+  if (tablptr->arrytab != NULL) {                 /* If array table */
+    GainArry *          arryptr;
+    INT                 entrnum;
+    INT                 linknum;
+
+    entrptr = linkptr->tabl;
+    entrnum = (INT) (entrptr - tablptr->tabk);
+    arryptr = tablptr->arrytab + entrnum;
+    linknum = (INT) ~ (intptr_t) linkptr->prev - 1;
+    if (arryptr->linknbr == arryptr->livenbr) {   /* If no stale slot in array, no need to check links */
+      if (linknum >= 0)
+        return (arryptr->linktab[linknum]);
+    }
+    else {
+      for ( ; linknum >= 0; linknum --) {         /* Search remaining links in entry array */
+        if (gainTablArryLive (arryptr->linktab[linknum], entrptr, linknum))
+          return (arryptr->linktab[linknum]);
+      }
+    }
+
+    entrnum = gainTablBmapNext (tablptr, entrnum + 1, (INT) (tablptr->tend - tablptr->tabk));
+    if (entrnum < 0)
+      return (NULL);
+    entrptr = tablptr->tabk + entrnum;
+    arryptr = tablptr->arrytab + entrnum;
+    for (linknum = arryptr->linknbr - 1; ! gainTablArryLive (arryptr->linktab[linknum], entrptr, linknum); linknum --) ; /* Skip stale slots */
+    return (arryptr->linktab[linknum]);
+  }
+
   if (linkptr->next != &gainLinkDummy) {
 #ifdef SCOTCH_DEBUG_GAIN3
     if (gainTablCheck (linkptr->tabl) != 0) {
@@ -442,6 +802,19 @@ const ptrdiff_t             addrdlt)
 {
   GainEntr *          entrptr;
 
+  if (tablptr->arrytab != NULL) {                 /* If array table, only skew array contents */
+    for (entrptr  = tablptr->tmin;                /* For all active gain table entries        */
+         entrptr <= tablptr->tmax; entrptr ++) {
+      GainArry *          arryptr;
+      INT                 linknum;
+
+      arryptr = tablptr->arrytab + (entrptr - tablptr->tabk);
+      for (linknum = 0; linknum < arryptr->linknbr; linknum ++) /* Stale slots also point to moved links */
+        arryptr->linktab[linknum] = (GainLink *) ((byte *) arryptr->linktab[linknum] + addrdlt);
+    }
+    return;
+  }
+
   for (entrptr  = tablptr->tmin;                  /* For all active gain table entries */
        entrptr <= tablptr->tmax; entrptr ++) {
     GainLink *          linkptr;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2018,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2018,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 20 aug 2020     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Most of the contents of this module   **/
 /**                  comes from "map_b_fm" of the SCOTCH   **/
@@ -63,13 +63,47 @@
 
 #define GAIN_LINMAX              1024
 
+/*+ Initial size of per-entry link arrays. +*/
+
+#define GAIN_ARRYSIZ             16
+
+/*+ Minimum number of link slots in blocks
+    from which entry arrays are allocated.  +*/
+
+#define GAIN_BLOKSIZ             1024
+
+/*+ Number of bits per bit map word. +*/
+
+#define GAIN_BMAPBITS            ((INT) (sizeof (UINT) << 3))
+
+/*+ Gain table type to be used by FM-like
+    refinement methods. Array tables are
+    selected by the SCOTCH_GAIN_ARRAY flag. +*/
+
+#ifdef SCOTCH_GAIN_ARRAY
+#define GAINTABLTYPEFM           GAINTABLTYPEARRY
+#else /* SCOTCH_GAIN_ARRAY */
+#define GAINTABLTYPEFM           GAINTABLTYPELIST
+#endif /* SCOTCH_GAIN_ARRAY */
+
 /*
 **  The type and structure definitions.
 */
 
+/*+ Gain table types. +*/
+
+typedef enum GainTablType_ {
+  GAINTABLTYPELIST = 0,                           /*+ Doubly-linked lists of links    +*/
+  GAINTABLTYPEARRY                                /*+ Arrays of links, with bit map   +*/
+} GainTablType;
+
 /* The gain link data structure. This must be the
    first item of objects that are linked into gain
-   tables.                                         */
+   tables. In array tables, the next field points
+   to the dummy link, so that links can still be
+   told linked from unlinked, and the prev field
+   holds the complement of the index of the link
+   in its entry array.                              */
 
 typedef struct GainLink_ {
   struct GainLink_ *        next;                 /*+ Pointer to next element: FIRST +*/
@@ -83,6 +117,24 @@ typedef struct GainEntr_ {
   GainLink *                next;                 /*+ Pointer to first element: FIRST +*/
 } GainEntr;
 
+/* Per-entry link array, for array tables. */
+
+typedef struct GainArry_ {
+  GainLink **               linktab;              /*+ Array of links of entry           +*/
+  INT                       linknbr;              /*+ Number of slots used, stale or not +*/
+  INT                       livenbr;              /*+ Number of live links in array      +*/
+  INT                       linksiz;              /*+ Size of allocated array            +*/
+} GainArry;
+
+/* Block of link slots, for array tables. Entry
+   arrays are carved from blocks, which are only
+   freed along with the gain table.              */
+
+typedef struct GainBlok_ {
+  struct GainBlok_ *        nextptr;              /*+ Previously allocated block +*/
+  GainLink *                linktab[1];           /*+ Array of link slots        +*/
+} GainBlok;
+
 /* The gain table structure, built from table entries.
    For trick reasons, the pointer to the first entry
    must be the first field of the structure.           */
@@ -95,6 +147,13 @@ typedef struct GainTabl_ {
   GainEntr *                tmin;                 /*+ Non-empty entry of minimum gain        +*/
   GainEntr *                tmax;                 /*+ Non-empty entry of maximum gain        +*/
   GainEntr *                tend;                 /*+ Last valid gain entry                  +*/
+  MemArena *                arenptr;              /*+ Arena of table, or NULL if on heap     +*/
+  MemArenaMark              markdat;              /*+ Arena state before table allocation    +*/
+  GainArry *                arrytab;              /*+ Per-entry link arrays, or NULL if list +*/
+  UINT *                    bmaptab;              /*+ Bit map of non-empty entries           +*/
+  GainBlok *                blokptr;              /*+ Current block of link slots            +*/
+  INT                       bloknum;              /*+ Index of first free slot in block      +*/
+  INT                       bloksiz;              /*+ Number of slots in current block       +*/
   GainEntr *                tabl;                 /*+ Gain table structure is.. [SIZE - ADJ] +*/
   GainEntr                  tabk[1];              /*+ Split in two for relative access [ADJ] +*/
 } GainTabl;
@@ -103,15 +162,23 @@ typedef struct GainTabl_ {
 **  The function prototypes.
 */
 
-GainTabl *                  gainTablInit        (const INT, const INT);
+GainTabl *                  gainTablInit        (const INT, const INT, const GainTablType, MemArena * const);
 void                        gainTablExit        (GainTabl * const);
 void                        gainTablFree        (GainTabl * const);
 void                        gainTablAddLin      (GainTabl * const, GainLink * const, const INT);
 void                        gainTablAddLog      (GainTabl * const, GainLink * const, const INT);
+void                        gainTablAddLinArry  (GainTabl * const, GainLink * const, const INT);
+void                        gainTablAddLogArry  (GainTabl * const, GainLink * const, const INT);
 void                        gainTablDel         (GainTabl * const, GainLink * const);
+void                        gainTablDelArry     (GainTabl * const, GainLink * const);
 GainLink *                  gainTablFrst        (GainTabl * const);
 GainLink *                  gainTablNext        (GainTabl * const, const GainLink * const);
 void                        gainTablMove        (GainTabl * const, const ptrdiff_t);
+#ifdef SCOTCH_GAIN
+static INT                  gainTablBmapNext    (const GainTabl * const, INT, const INT);
+static GainLink **          gainTablArryAlloc   (GainTabl * const, const INT);
+static void                 gainTablAddArry     (GainTabl * const, GainLink * const, GainEntr * const);
+#endif /* SCOTCH_GAIN */
 #ifdef SCOTCH_DEBUG_GAIN3
 #ifdef SCOTCH_GAIN
 static int                  gainTablCheck       (GainEntr * const);
@@ -124,8 +191,11 @@ static int                  gainTablCheck2      (GainEntr * const, GainLink * co
 */
 
 #define gainTablEmpty(tabl)         ((tabl)->tmin == (tabl)->tend)
+#define gainTablArryLive(l,e,n)     (((l)->tabl == (e)) && ((l)->prev == (GainLink *) ~ (intptr_t) (n))) /* TRICK: complemented indices are not valid addresses */
 #define gainTablAdd(tabl,link,gain) ((tabl)->tablAdd  ((tabl), (link), (gain)))
 #if ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1))
-#define gainTablDel(tabl,link)      (((GainLink *) (link))->next->prev = ((GainLink *) (link))->prev, \
-                                     ((GainLink *) (link))->prev->next = ((GainLink *) (link))->next)
+#define gainTablDel(tabl,link)      (((tabl)->arrytab != NULL)                                           \
+                                     ? gainTablDelArry ((tabl), (GainLink *) (link))                    \
+                                     : (void) (((GainLink *) (link))->next->prev = ((GainLink *) (link))->prev, \
+                                               ((GainLink *) (link))->prev->next = ((GainLink *) (link))->next))
 #endif /* ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1)) */
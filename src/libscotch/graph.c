@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2012,2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2012,2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 sep 2012     **/
 /**                                 to   : 09 aug 2014     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -118,37 +118,51 @@ void
 graphFree (
 Graph * const               grafptr)
 {
-  if (((grafptr->flagval & GRAPHFREEEDGE) != 0) && /* If edgetab must be freed */
-      (grafptr->edgetax != NULL))                 /* And if it exists          */
-    memFree (grafptr->edgetax + grafptr->baseval); /* Free it                  */
-
-  if ((grafptr->flagval & GRAPHFREEVERT) != 0) {  /* If verttab/vendtab must be freed                            */
-    if ((grafptr->vendtax != NULL) &&             /* If vendtax is distinct from verttab                         */
-        (grafptr->vendtax != grafptr->verttax + 1) && /* (if vertex arrays grouped, vendtab not distinct anyway) */
-        ((grafptr->flagval & GRAPHVERTGROUP) == 0))
-      memFree (grafptr->vendtax + grafptr->baseval); /* Then free vendtax                                 */
-    if (grafptr->verttax != NULL)                 /* Free verttab anyway, as it is the array group leader */
-      memFree (grafptr->verttax + grafptr->baseval);
-  }
-  if ((grafptr->flagval & GRAPHFREEVNUM) != 0) {  /* If vnumtab must be freed         */
-    if ((grafptr->vnumtax != NULL) &&             /* And is not in vertex array group */
-        ((grafptr->flagval & GRAPHVERTGROUP) == 0))
-      memFree (grafptr->vnumtax + grafptr->baseval);
+  if ((grafptr->flagval & GRAPHFILEMAP) != 0) {  /* If all arrays belong to a mapped file */
+    if (((grafptr->flagval & GRAPHFREEVERT) != 0) && /* Unmap file area only if owner      */
+        (grafptr->verttax != NULL))
+      graphFreeBin (grafptr);
   }
-  if ((grafptr->flagval & GRAPHFREEOTHR) != 0) {  /* If other arrays must be freed */
-    if ((grafptr->velotax != NULL) &&             /* Free graph tables             */
-        ((grafptr->flagval & GRAPHVERTGROUP) == 0))
-      memFree (grafptr->velotax + grafptr->baseval);
-    if ((grafptr->vlbltax != NULL) &&
-        ((grafptr->flagval & GRAPHVERTGROUP) == 0))
-      memFree (grafptr->vlbltax + grafptr->baseval);
-    if ((grafptr->edlotax != NULL) &&
-        ((grafptr->flagval & GRAPHEDGEGROUP) == 0))
-      memFree (grafptr->edlotax + grafptr->baseval);
+  else {
+    if ((grafptr->flagval & GRAPHEDGECMPR) != 0)  /* If compressed edge arrays present */
+      memFree (grafptr->vcmptax + grafptr->baseval); /* Free array group leader         */
+    if (((grafptr->flagval & GRAPHFREEEDGE) != 0) && /* If edgetab must be freed */
+        (grafptr->edgetax != NULL))               /* And if it exists          */
+      memFree (grafptr->edgetax + grafptr->baseval); /* Free it                  */
+
+    if ((grafptr->flagval & GRAPHFREEVERT) != 0) {  /* If verttab/vendtab must be freed                            */
+      if ((grafptr->vendtax != NULL) &&           /* If vendtax is distinct from verttab                         */
+          (grafptr->vendtax != grafptr->verttax + 1) && /* (if vertex arrays grouped, vendtab not distinct anyway) */
+          ((grafptr->flagval & GRAPHVERTGROUP) == 0))
+        memFree (grafptr->vendtax + grafptr->baseval); /* Then free vendtax                                 */
+      if (grafptr->verttax != NULL)               /* Free verttab anyway, as it is the array group leader */
+        memFree (grafptr->verttax + grafptr->baseval);
+    }
+    if ((grafptr->flagval & GRAPHFREEVNUM) != 0) {  /* If vnumtab must be freed         */
+      if ((grafptr->vnumtax != NULL) &&           /* And is not in vertex array group */
+          ((grafptr->flagval & GRAPHVERTGROUP) == 0))
+        memFree (grafptr->vnumtax + grafptr->baseval);
+    }
+    if ((grafptr->flagval & GRAPHFREEOTHR) != 0) {  /* If other arrays must be freed */
+      if ((grafptr->velotax != NULL) &&           /* Free graph tables             */
+          ((grafptr->flagval & GRAPHVERTGROUP) == 0))
+        memFree (grafptr->velotax + grafptr->baseval);
+      if ((grafptr->vlbltax != NULL) &&
+          ((grafptr->flagval & GRAPHVERTGROUP) == 0))
+        memFree (grafptr->vlbltax + grafptr->baseval);
+      if ((grafptr->edlotax != NULL) &&
+          ((grafptr->flagval & GRAPHEDGEGROUP) == 0))
+        memFree (grafptr->edlotax + grafptr->baseval);
+    }
+    if (((grafptr->flagval & GRAPHFREEVCON) != 0) && /* If constraint array must be freed   */
+        (grafptr->vcontax != NULL))               /* It is always the leader of its group */
+      memFree (grafptr->vcontax + grafptr->baseval * grafptr->vconnbr);
   }
 
 #ifdef SCOTCH_DEBUG_GRAPH2
   memSet (grafptr, ~0, sizeof (Graph));           /* Purge graph fields */
 #endif /* SCOTCH_DEBUG_GRAPH2 */
   grafptr->flagval = GRAPHNONE;                   /* Allow to double-call graphFree or call graphExit */
+  grafptr->vconnbr = 0;                           /* Graph may be re-filled by routines that ignore constraints */
+  grafptr->vcontax = NULL;
 }
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014-2019,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014-2019,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 10 may 2019     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 16 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,18 +82,26 @@
 #define GRAPHFREEVERT               0x0002        /*+ Free verttab array        +*/
 #define GRAPHFREEVNUM               0x0004        /*+ Free vnumtab array        +*/
 #define GRAPHFREEOTHR               0x0008        /*+ Free all other arrays     +*/
-#define GRAPHFREETABS               0x000F        /*+ Free all graph arrays     +*/
+#define GRAPHFREEVCON               0x0100        /*+ Free constraint array     +*/
+#define GRAPHFREETABS               0x010F        /*+ Free all graph arrays     +*/
 #define GRAPHVERTGROUP              0x0010        /*+ All vertex arrays grouped +*/
 #define GRAPHEDGEGROUP              0x0020        /*+ All edge arrays grouped   +*/
+#define GRAPHFILEMAP                0x0040        /*+ All arrays in mapped file +*/
+#define GRAPHEDGECMPR               0x0080        /*+ Compressed edge array     +*/
 
-#define GRAPHBITSUSED               0x003F        /*+ Significant bits for plain graph routines               +*/
-#define GRAPHBITSNOTUSED            0x0040        /*+ Value above which bits not used by plain graph routines +*/
+#define GRAPHBITSUSED               0x01FF        /*+ Significant bits for plain graph routines               +*/
+#define GRAPHBITSNOTUSED            0x0200        /*+ Value above which bits not used by plain graph routines +*/
 
 /*+ Graph loading flags. +*/
 
 #define GRAPHIONOLOADVERT           1             /*+ Remove vertex loads on loading +*/
 #define GRAPHIONOLOADEDGE           2             /*+ Remove edge loads on loading   +*/
 
+/*+ Locality relabeling methods. +*/
+
+#define GRAPHPERMBFS                0             /*+ Breadth-first traversal order +*/
+#define GRAPHPERMRCM                1             /*+ Reverse Cuthill-McKee order   +*/
+
 /*
 **  The type and structure definitions.
 */
@@ -106,6 +114,12 @@ typedef UINT                Gunum;                /* Unsigned type of same width
 #define GNUMSTRING                  INTSTRING     /* String to printf a Gnum     */
 #endif /* GNUMMAX */
 
+#ifndef GENUMMAX                                  /* If dgraph.h not included    */
+typedef EDGE                Genum;                /* Edge indices and numbers    */
+#define GENUMMAX                    EDGEVALMAX    /* Maximum signed Genum value  */
+#define GENUMSTRING                 EDGESTRING    /* String to printf a Genum    */
+#endif /* GENUMMAX */
+
 /*+ The vertex part type, in compressed form. +*/
 
 typedef byte GraphPart;
@@ -136,19 +150,32 @@ typedef struct Graph_ {
   Gnum                      baseval;              /*+ Base index for edge/vertex arrays         +*/
   Gnum                      vertnbr;              /*+ Number of vertices in graph               +*/
   Gnum                      vertnnd;              /*+ Number of vertices in graph, plus baseval +*/
-  Gnum *                    verttax;              /*+ Vertex array [based]                      +*/
-  Gnum *                    vendtax;              /*+ End vertex array [based]                  +*/
+  Genum *                   verttax;              /*+ Vertex array [based]                      +*/
+  Genum *                   vendtax;              /*+ End vertex array [based]                  +*/
   Gnum *                    velotax;              /*+ Vertex load array (if present)            +*/
   Gnum                      velosum;              /*+ Overall graph vertex load                 +*/
   Gnum *                    vnumtax;              /*+ Vertex number in ancestor graph           +*/
   Gnum *                    vlbltax;              /*+ Vertex label (from file)                  +*/
-  Gnum                      edgenbr;              /*+ Number of edges (arcs) in graph           +*/
+  Genum                     edgenbr;              /*+ Number of edges (arcs) in graph           +*/
   Gnum *                    edgetax;              /*+ Edge array [based]                        +*/
   Gnum *                    edlotax;              /*+ Edge load array (if present)              +*/
   Gnum                      edlosum;              /*+ Sum of edge (in fact arc) loads           +*/
   Gnum                      degrmax;              /*+ Maximum degree                            +*/
+  Gnum *                    vcmptax;              /*+ Compressed edge byte index array [based]  +*/
+  byte *                    ecmptab;              /*+ Compressed edge byte array                +*/
+  Gnum                      vconnbr;              /*+ Number of vertex load constraints         +*/
+  Gnum *                    vcontax;              /*+ Constraint load array [based]             +*/
 } Graph;
 
+/*+ The compressed edge array access macro.
+    When the graph is compressed, the adjacency
+    of the given vertex is decoded into the
+    provided buffer, of size degrmax, and a
+    pointer is returned such that the edge
+    array can be indexed by edge numbers.     +*/
+
+#define graphEdgeTax(g,v,b)         (((g)->edgetax != NULL) ? (g)->edgetax : graphCmprVert ((g), (v), (b)))
+
 /*
 **  The function prototypes.
 */
@@ -166,23 +193,38 @@ int                         graphInit           (Graph * const);
 void                        graphExit           (Graph * const);
 void                        graphFree           (Graph * const);
 Gnum                        graphBase           (Graph * const, const Gnum);
-int                         graphBand           (const Graph * restrict const, const Gnum, Gnum * restrict const, const Gnum, Gnum * restrict * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const);
+int                         graphBand           (const Graph * restrict const, const Gnum, Gnum * restrict const, const Gnum, Gnum * restrict * restrict const, Gnum * restrict const, Gnum * restrict const, Genum * restrict const, const Gnum * restrict const, Gnum * restrict const, Context * restrict const);
 int                         graphCheck          (const Graph *);
 int                         graphClone          (const Graph *, Graph *);
+int                         graphCmprBuild      (Graph * const);
+int                         graphCmprCheck      (const Graph * const);
+int                         graphCmprExpand     (Graph * const);
+const Gnum *                graphCmprVert       (const Graph * const, const Gnum, Gnum * const);
 Gnum                        graphDiamPV         (const Graph * restrict const, Context * restrict const);
 Gnum                        graphIelo           (const Graph * const, Gnum * const, Gnum * const);
 int                         graphInduceList     (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const);
+int                         graphInduceList2    (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const, Context * const);
 int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const);
+int                         graphInducePart2    (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const, MemArena * const, Context * const);
 int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphLoadFlag);
-int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
+int                         graphLoad2          (const Gnum, const Gnum, const Genum * const, const Genum * const, Gnum * restrict const, const Gnum, const Gnum * const);
+int                         graphLoadBin        (Graph * restrict const, FILE * const, const Gnum, const GraphLoadFlag);
+int                         graphLoadHead       (Graph * restrict const, FILE * const, const Gnum, const GraphLoadFlag, Gnum * restrict const, char * restrict const);
+int                         graphLoadText       (Graph * restrict const, FILE * const, const Gnum, const GraphLoadFlag, Context * restrict const);
+void                        graphFreeBin        (Graph * const);
+int                         graphPerm           (const Graph * restrict const, const Gnum * restrict const, const Gnum * restrict const, Graph * restrict const);
+int                         graphPermCompute    (const Graph * restrict const, const Gnum, const int, Gnum * restrict const, Gnum * restrict const);
 int                         graphSave           (const Graph * const, FILE * const);
+int                         graphSaveBin        (const Graph * const, FILE * const);
 
 #ifdef SCOTCH_GEOM_H
-int                         graphGeomLoadChac   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomLoadBin    (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomSaveBin    (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomLoadChac   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const, Context * restrict const);
 int                         graphGeomSaveChac   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadHabo   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
-int                         graphGeomLoadMmkt   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomLoadMmkt   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const, Context * restrict const);
 int                         graphGeomSaveMmkt   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
-int                         graphGeomLoadScot   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomLoadScot   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const, Context * restrict const);
 int                         graphGeomSaveScot   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 #endif /* SCOTCH_GEOM_H */
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 05 jan 2010     **/
 /**                                 to   : 22 sep 2011     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code derives from the code of    **/
 /**                  dgraph_band.c in version 5.1.         **/
@@ -56,6 +56,7 @@
 #include "module.h"
 #include "common.h"
 #include "graph.h"
+#include "graph_bfs.h"
 
 /**********************************/
 /*                                */
@@ -65,6 +66,11 @@
 
 /* This routine computes an index array
 ** of given width around the current separator.
+** Band levels are computed by the multithreaded
+** breadth-first search routine, after which band
+** vertices are numbered in queue order, that is,
+** frontier vertices first, then the other ones
+** by increasing level and vertex index.
 ** It returns:
 ** - 0   : if the index array could be computed.
 ** - !0  : on error.
@@ -79,37 +85,40 @@ const Gnum                        distmax,        /*+ Maximum distance from sepa
 Gnum * restrict * restrict const  vnumptr,        /*+ Pointer to vnumtax                                       +*/
 Gnum * restrict const             bandvertlvlptr, /*+ Pointer to based start index of last level               +*/
 Gnum * restrict const             bandvertptr,    /*+ Pointer to bandvertnbr                                   +*/
-Gnum * restrict const             bandedgeptr,    /*+ Pointer to bandedgenbr                                   +*/
+Genum * restrict const            bandedgeptr,    /*+ Pointer to bandedgenbr                                   +*/
 const Gnum * restrict const       pfixtax,        /*+ Fixed partition array                                    +*/
-Gnum * restrict const             bandvfixptr)    /*+ Pointer to bandvfixnbr                                   +*/
+Gnum * restrict const             bandvfixptr,    /*+ Pointer to bandvfixnbr                                   +*/
+Context * restrict const          contptr)        /*+ Execution context                                        +*/
 {
   Gnum                    queunum;
+  Gnum                    queunnd;                /* Number of vertices in queue */
+  Gnum                    levlnum;                /* Last level reached          */
   Gnum * restrict         vnumtax;                /* Index array for vertices kept in band graph */
-  Gnum                    queuheadidx;            /* Index of head of queue                      */
-  Gnum                    queutailidx;            /* Index of tail of queue                      */
   Gnum                    bandvertlvlnum;
   Gnum                    bandvertnum;
-  Gnum                    bandedgenbr;
-  Gnum                    distval;
+  Genum                   bandedgenbr;
   Gnum                    bandvfixnbr;            /* Number of band fixed vertices */
 
-  const Gnum * restrict const verttax = grafptr->verttax;
-  const Gnum * restrict const vendtax = grafptr->vendtax;
-  const Gnum * restrict const edgetax = grafptr->edgetax;
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
 
   if ((vnumtax = memAlloc (grafptr->vertnbr * sizeof (Gnum))) == NULL) {
     errorPrint ("graphBand: out of memory (1)");
     return     (1);
   }
+  vnumtax -= grafptr->baseval;
+
+  if (graphBfs (grafptr, queunbr, queutab, distmax, vnumtax, queutab, &queunnd, &levlnum, NULL, contptr) != 0) { /* Get levels of band vertices */
+    errorPrint ("graphBand: cannot compute band levels");
+    memFree    (vnumtax + grafptr->baseval);
+    return     (1);
+  }
 
   bandvertlvlnum =                                /* Start index of last level is start index */
   bandvertnum    = grafptr->baseval;              /* Reset number of band vertices            */
   bandedgenbr    =
   bandvfixnbr    = 0;
-  memSet (vnumtax, ~0, grafptr->vertnbr * sizeof (Gnum)); /* Reset part array */
-  vnumtax -= grafptr->baseval;
-
-  for (queunum = 0; queunum < queunbr; queunum ++) { /* All frontier vertices will be first vertices of band graph */
+  for (queunum = 0; queunum < queunnd; queunum ++) { /* Number band vertices in queue order */
     Gnum              vertnum;
 
     vertnum = queutab[queunum];
@@ -117,50 +126,19 @@ Gnum * restrict const             bandvfixptr)    /*+ Pointer to bandvfixnbr
       vnumtax[vertnum] = -2;                      /* Set vertex as fixed         */
       bandvfixnbr ++;
     }
-    else
-      vnumtax[vertnum] = bandvertnum ++;          /* Keep frontier vertex in band */
-    bandedgenbr += vendtax[vertnum] - verttax[vertnum]; /* Account for its edges  */
-  }
-  queuheadidx = 0;                                /* No queued vertex read yet                  */
-  queutailidx = queunbr;                          /* All frontier vertices are already in queue */
-
-  for (distval = 0; ++ distval <= distmax; ) {
-    Gnum              queunextidx;                /* Tail index for enqueuing vertices of next band */
-
-    bandvertlvlnum = bandvertnum;
-    *bandvertlvlptr = bandvertlvlnum;             /* Save start index of current level, based */
-
-    for (queunextidx = queutailidx; queuheadidx < queutailidx; ) { /* For all vertices in queue */
-      Gnum              vertnum;
-      Gnum              edgenum;
-
-      vertnum = queutab[queuheadidx ++];          /* Dequeue vertex */
-      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
-        Gnum              vertend;
-
-        vertend = edgetax[edgenum];
-        if (vnumtax[vertend] != ~0)               /* If end vertex has already been processed */
-          continue;                               /* Skip to next vertex                      */
-
-        if ((pfixtax != NULL) && (pfixtax[vertend] != -1)) { /* If fixed vertex */
-          vnumtax[vertend] = -2;                  /* Set vertex as fixed        */
-          bandvfixnbr ++;
-        }
-        else
-          vnumtax[vertend] = bandvertnum ++;      /* Enqueue vertex label */
-
-        bandedgenbr += vendtax[vertend] - verttax[vertend]; /* Account for its edges */
-        queutab[queunextidx ++] = vertend;        /* Enqueue vertex for next pass    */
-      }
+    else {
+      if (vnumtax[vertnum] < distmax)             /* Last level starts after all band vertices of former levels */
+        bandvertlvlnum ++;
+      vnumtax[vertnum] = bandvertnum ++;          /* Keep vertex in band */
     }
-
-    queutailidx = queunextidx;                    /* Prepare queue for next sweep */
+    bandedgenbr += vendtax[vertnum] - verttax[vertnum]; /* Account for its edges */
   }
 
-  *vnumptr     = vnumtax;
-  *bandvfixptr = bandvfixnbr;
-  *bandvertptr = bandvertnum - grafptr->baseval;
-  *bandedgeptr = bandedgenbr;
+  *vnumptr        = vnumtax;
+  *bandvertlvlptr = bandvertlvlnum;
+  *bandvfixptr    = bandvfixnbr;
+  *bandvertptr    = bandvertnum - grafptr->baseval;
+  *bandedgeptr    = bandedgenbr;
 
   return (0);
 }
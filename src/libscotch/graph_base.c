@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.0  : from : 05 aug 2014     **/
 /**                                 to   : 05 aug 2014     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -90,7 +90,7 @@ const Gnum                  baseval)
   Gnum                baseold;                    /* Old base value  */
   Gnum                baseadj;                    /* Base adjustment */
   Gnum                vertnum;
-  Gnum                edgenum;
+  Genum               edgenum;
 
   if (grafptr->baseval == baseval)                /* If nothing to do */
     return (baseval);
@@ -99,8 +99,10 @@ const Gnum                  baseval)
   baseadj = baseval - baseold;                    /* Compute adjustment    */
 
   for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
-    for (edgenum = grafptr->verttax[vertnum]; edgenum < grafptr->vendtax[vertnum]; edgenum ++)
-      grafptr->edgetax[edgenum] += baseadj;
+    if (grafptr->edgetax != NULL) {               /* Compressed adjacency is relative to vertex indices */
+      for (edgenum = grafptr->verttax[vertnum]; edgenum < grafptr->vendtax[vertnum]; edgenum ++)
+        grafptr->edgetax[edgenum] += baseadj;
+    }
     grafptr->verttax[vertnum] += baseadj;
   }
   if (grafptr->vendtax != grafptr->verttax + 1) { /* If distinct vertex end array */
@@ -112,7 +114,8 @@ const Gnum                  baseval)
 
   grafptr->verttax -= baseadj;                    /* Adjust array accesses */
   grafptr->vendtax -= baseadj;
-  grafptr->edgetax -= baseadj;
+  if (grafptr->edgetax != NULL)
+    grafptr->edgetax -= baseadj;
 
   if (grafptr->velotax != NULL)
     grafptr->velotax -= baseadj;
@@ -122,6 +125,10 @@ const Gnum                  baseval)
     grafptr->vlbltax -= baseadj;
   if (grafptr->edlotax != NULL)
     grafptr->edlotax -= baseadj;
+  if (grafptr->vcmptax != NULL)
+    grafptr->vcmptax -= baseadj;
+  if (grafptr->vcontax != NULL)
+    grafptr->vcontax -= baseadj * grafptr->vconnbr;
 
   grafptr->baseval  = baseval;                    /* Set new base value */
   grafptr->vertnnd += baseadj;
@@ -0,0 +1,547 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_bfs.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes breadth-first      **/
+/**                search levels of source graph vertices, **/
+/**                using all the threads of the given      **/
+/**                context.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_BFS
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_bfs.h"
+
+/*********************************/
+/*                               */
+/* These routines perform level- */
+/* synchronous breadth-first     */
+/* searches on source graphs.    */
+/*                               */
+/*********************************/
+
+/* Levels are expanded one at a time, all the
+** vertices of the current level being stored
+** contiguously at the end of the queue array.
+** When the current level is small, it is expanded
+** by the first thread alone. Else, every level is
+** computed either top-down, each thread scanning
+** the neighbors of its slice of the current level
+** and claiming unvisited ones by means of atomic
+** flags, or bottom-up, each thread looking for a
+** neighbor in the current level for the unvisited
+** vertices of its slice of the vertex array. The
+** direction is chosen from the relative numbers
+** of frontier and unexplored arcs. Levels are
+** only written once all threads have made their
+** decisions, so that level values are exact and
+** do not depend on the number of threads. When
+** requested, the queue array is eventually sorted
+** by increasing level and vertex index, seed
+** vertices being kept first, in their order.
+*/
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+*/
+
+static
+void
+graphBfsScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine merges the degree sums, last
+** level vertex minima and abort flags computed
+** by multiple threads.
+*/
+
+static
+void
+graphBfsReduce (
+GraphBfsThread * restrict const tlocptr,          /* Pointer to local thread block  */
+GraphBfsThread * restrict const tremptr,          /* Pointer to remote thread block */
+const void * const              globptr)          /* Unused                         */
+{
+  tlocptr->degrsum += tremptr->degrsum;
+  if (tremptr->vertmin < tlocptr->vertmin)
+    tlocptr->vertmin = tremptr->vertmin;
+  tlocptr->abrtval |= tremptr->abrtval;
+}
+
+/* This routine enlarges the local vertex
+** list of the given thread, so that it can
+** hold more than the given number of vertices.
+** It returns:
+** - 0   : if the list could be enlarged.
+** - !0  : on error.
+*/
+
+static
+int
+graphBfsList (
+GraphBfsThread * restrict const thrdptr,
+const Gnum                      listnbr)
+{
+  Gnum *              listtmp;
+  Gnum                listsiz;
+
+  listsiz = MAX (thrdptr->listsiz * 2, MAX (listnbr + 1, GRAPHBFSLISTMIN));
+  listtmp = (thrdptr->listtab == NULL) ? memAlloc (listsiz * sizeof (Gnum)) : memRealloc (thrdptr->listtab, listsiz * sizeof (Gnum));
+  if (listtmp == NULL) {
+    errorPrint ("graphBfsList: out of memory");
+    return (1);
+  }
+  thrdptr->listtab = listtmp;
+  thrdptr->listsiz = listsiz;
+
+  return (0);
+}
+
+/* This routine expands levels sequentially,
+** as long as they are smaller than the given
+** size. It is called by the first thread only,
+** while the other ones wait on a barrier.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphBfsSeq (
+GraphBfsData * restrict const dataptr,
+const Gnum                    fronmin,            /* Level size from which all threads are used */
+Gnum * restrict const         edgetab)            /* Decoding buffer, if compressed graph        */
+{
+  Gnum                fronbas;
+  Gnum                fronnnd;
+  Gnum                levlnum;
+  Gnum                edgeleft;
+  Gnum                frondeg;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  Gnum * restrict const         levltax = dataptr->levltax;
+  int * restrict const          flagtax = dataptr->flagtax;
+  Gnum * restrict const         queutab = dataptr->queutab;
+  const Gnum                    levlmax = dataptr->levlmax;
+
+  fronbas  = dataptr->fronbas;
+  fronnnd  = dataptr->fronnnd;
+  levlnum  = dataptr->levlnum;
+  edgeleft = dataptr->edgeleft;
+  frondeg  = dataptr->frondeg;
+
+  while ((levlnum < levlmax) && ((fronnnd - fronbas) < fronmin)) {
+    Gnum                queunum;
+    Gnum                quennnd;
+    Gnum                degrsum;
+
+    for (queunum = fronbas, quennnd = fronnnd, degrsum = 0; queunum < fronnnd; queunum ++) {
+      const Gnum * restrict edgetax;
+      Gnum                  vertnum;
+      Genum                 edgenum;
+
+      vertnum = queutab[queunum];
+      edgetax = graphEdgeTax (grafptr, vertnum, edgetab);
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if (levltax[vertend] != ~0)               /* If vertex already visited */
+          continue;
+
+        levltax[vertend] = levlnum + 1;
+        flagtax[vertend] = 1;
+        queutab[quennnd ++] = vertend;
+        degrsum += (Gnum) (vendtax[vertend] - verttax[vertend]);
+      }
+    }
+    if (quennnd == fronnnd) {                     /* If no next level, current level is the last one */
+      dataptr->statval = GRAPHBFSDONE;
+      break;
+    }
+
+    fronbas   = fronnnd;
+    fronnnd   = quennnd;
+    levlnum  ++;
+    edgeleft -= degrsum;
+    frondeg   = degrsum;
+  }
+
+  dataptr->fronbas  = fronbas;
+  dataptr->fronnnd  = fronnnd;
+  dataptr->levlnum  = levlnum;
+  dataptr->edgeleft = edgeleft;
+  dataptr->frondeg  = frondeg;
+  dataptr->dirval   = (frondeg > (edgeleft / GRAPHBFSALPHA)) ? GRAPHBFSBOTTOMUP : GRAPHBFSTOPDOWN;
+}
+
+/* This routine is the threaded core of the
+** breadth-first search routine.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphBfsThrd (
+ThreadDescriptor * restrict const descptr,
+GraphBfsData * restrict const     dataptr)
+{
+  Gnum                vertbas;                    /* Start of slice of vertices */
+  Gnum                vertnnd;                    /* End of slice of vertices   */
+  Gnum                vertnum;
+  Gnum                seednum;
+  Gnum                seednnd;
+  Gnum                fronbas;
+  Gnum                fronnnd;
+  Gnum                levlnum;
+  Gnum                degrsum;
+  Gnum                vertmin;
+  int                 statval;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  const int                     thrdnbr = threadNbr (descptr);
+  const int                     thrdnum = threadNum (descptr);
+  GraphBfsThread * restrict const thrdptr = &dataptr->thrdtab[thrdnum];
+  const Gnum                    baseval = grafptr->baseval;
+  const Gnum                    vertnbr = grafptr->vertnbr;
+  const Gnum * const            seedtab = dataptr->seedtab; /* May be queue array itself */
+  const Gnum                    seednbr = dataptr->seednbr;
+  const Gnum                    levlmax = dataptr->levlmax;
+  Gnum * restrict const         levltax = dataptr->levltax;
+  int * restrict const          flagtax = dataptr->flagtax;
+  Gnum * const                  queutab = dataptr->queutab; /* May hold seed array */
+
+  vertbas = baseval + DATASCAN (vertnbr, thrdnbr, thrdnum);
+  vertnnd = baseval + DATASCAN (vertnbr, thrdnbr, thrdnum + 1);
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+    levltax[vertnum] = ~0;
+    flagtax[vertnum] = 0;
+  }
+  threadBarrier (descptr);                        /* Arrays must be reset before seeds are set */
+
+  for (seednum = DATASCAN (seednbr, thrdnbr, thrdnum), seednnd = DATASCAN (seednbr, thrdnbr, thrdnum + 1), degrsum = 0;
+       seednum < seednnd; seednum ++) {
+    vertnum = seedtab[seednum];
+    levltax[vertnum] = 0;
+    flagtax[vertnum] = 1;
+    queutab[seednum] = vertnum;                   /* Seeds are the first vertices of the queue */
+    degrsum += (Gnum) (vendtax[vertnum] - verttax[vertnum]);
+  }
+  thrdptr->degrsum = degrsum;
+  thrdptr->vertmin = GNUMMAX;
+  thrdptr->abrtval = 0;
+  threadReduce (descptr, (void *) thrdptr, sizeof (GraphBfsThread), (ThreadReduceFunc) graphBfsReduce, 0, NULL);
+  if (thrdnum == 0) {
+    dataptr->fronbas  = 0;
+    dataptr->fronnnd  = seednbr;
+    dataptr->levlnum  = 0;
+    dataptr->frondeg  = thrdptr->degrsum;
+    dataptr->edgeleft = (Gnum) grafptr->edgenbr - thrdptr->degrsum;
+    dataptr->dirval   = GRAPHBFSTOPDOWN;
+    dataptr->statval  = (seednbr > 0) ? GRAPHBFSRUN : GRAPHBFSDONE;
+  }
+  threadBarrier (descptr);                        /* Search state must be set */
+
+  while (1) {
+    Gnum                fronnbr;
+    Gnum                listnbr;
+
+    statval = dataptr->statval;                   /* Read search state after last barrier */
+    fronbas = dataptr->fronbas;
+    fronnnd = dataptr->fronnnd;
+    levlnum = dataptr->levlnum;
+    if ((statval != GRAPHBFSRUN) || (levlnum >= levlmax))
+      break;
+
+    fronnbr = fronnnd - fronbas;
+    if ((thrdnbr == 1) || (fronnbr < GRAPHBFSFRONMIN)) { /* If level too small to be worth sharing */
+      threadBarrier (descptr);                    /* All threads must have read the search state */
+      if (thrdnum == 0)
+        graphBfsSeq (dataptr, (thrdnbr == 1) ? GNUMMAX : GRAPHBFSFRONMIN, thrdptr->edgetab);
+      threadBarrier (descptr);                    /* Search state must be updated */
+      continue;
+    }
+
+    listnbr = 0;
+    if (dataptr->dirval == GRAPHBFSTOPDOWN) {     /* Frontier vertices claim their unvisited neighbors */
+      Gnum                queunum;
+      Gnum                queunnd;
+
+      for (queunum = fronbas + DATASCAN (fronnbr, thrdnbr, thrdnum), queunnd = fronbas + DATASCAN (fronnbr, thrdnbr, thrdnum + 1);
+           (queunum < queunnd) && (thrdptr->abrtval == 0); queunum ++) {
+        const Gnum * restrict edgetax;
+        Genum                 edgenum;
+
+        vertnum = queutab[queunum];
+        edgetax = graphEdgeTax (grafptr, vertnum, thrdptr->edgetab);
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+          Gnum                vertend;
+
+          vertend = edgetax[edgenum];
+          if ((levltax[vertend] != ~0) ||         /* If vertex visited in a former level */
+              (__sync_lock_test_and_set (&flagtax[vertend], 1) != 0)) /* Or already claimed */
+            continue;
+
+          if ((listnbr >= thrdptr->listsiz) &&
+              (graphBfsList (thrdptr, listnbr) != 0)) {
+            thrdptr->abrtval = 1;
+            break;
+          }
+          thrdptr->listtab[listnbr ++] = vertend;
+        }
+      }
+    }
+    else {                                        /* Unvisited vertices look for a neighbor in current level */
+      for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+        const Gnum * restrict edgetax;
+        Genum                 edgenum;
+
+        if (levltax[vertnum] != ~0)
+          continue;
+
+        edgetax = graphEdgeTax (grafptr, vertnum, thrdptr->edgetab);
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+          if (levltax[edgetax[edgenum]] == levlnum)
+            break;
+        }
+        if (edgenum >= vendtax[vertnum])          /* If no neighbor in current level */
+          continue;
+
+        if ((listnbr >= thrdptr->listsiz) &&
+            (graphBfsList (thrdptr, listnbr) != 0)) {
+          thrdptr->abrtval = 1;
+          break;
+        }
+        thrdptr->listtab[listnbr ++] = vertnum;
+      }
+    }
+    threadBarrier (descptr);                      /* Levels can only be written once all decisions are made */
+
+    for (seednum = 0, degrsum = 0; seednum < listnbr; seednum ++) {
+      vertnum = thrdptr->listtab[seednum];
+      levltax[vertnum] = levlnum + 1;
+      flagtax[vertnum] = 1;
+      degrsum += (Gnum) (vendtax[vertnum] - verttax[vertnum]);
+    }
+
+    thrdptr->scantab[0] = listnbr;
+    threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphBfsThread), (ThreadScanFunc) graphBfsScan, NULL); /* Get start index of local vertices in next level */
+    memCpy (queutab + fronnnd + thrdptr->scantab[0] - listnbr, thrdptr->listtab, listnbr * sizeof (Gnum));
+
+    thrdptr->degrsum = degrsum;
+    threadReduce (descptr, (void *) thrdptr, sizeof (GraphBfsThread), (ThreadReduceFunc) graphBfsReduce, 0, NULL);
+    if (thrdnum == 0) {                           /* First thread updates search state */
+      listnbr = dataptr->thrdtab[thrdnbr - 1].scantab[0]; /* Last thread knows size of next level */
+      if (thrdptr->abrtval != 0)
+        dataptr->statval = GRAPHBFSABORT;
+      else if (listnbr <= 0)
+        dataptr->statval = GRAPHBFSDONE;
+      else {
+        dataptr->fronbas   = fronnnd;
+        dataptr->fronnnd   = fronnnd + listnbr;
+        dataptr->levlnum   = levlnum + 1;
+        dataptr->edgeleft -= thrdptr->degrsum;
+        dataptr->frondeg   = thrdptr->degrsum;
+        if (dataptr->dirval == GRAPHBFSTOPDOWN) {
+          if (dataptr->frondeg > (dataptr->edgeleft / GRAPHBFSALPHA))
+            dataptr->dirval = GRAPHBFSBOTTOMUP;
+        }
+        else if (listnbr < (vertnbr / GRAPHBFSBETA))
+          dataptr->dirval = GRAPHBFSTOPDOWN;
+      }
+    }
+    threadBarrier (descptr);                      /* Search state must be updated */
+  }
+
+  if (statval == GRAPHBFSABORT)
+    return;
+
+  for (seednum = fronbas + DATASCAN (fronnnd - fronbas, thrdnbr, thrdnum), seednnd = fronbas + DATASCAN (fronnnd - fronbas, thrdnbr, thrdnum + 1), vertmin = GNUMMAX;
+       seednum < seednnd; seednum ++) {           /* Get smallest vertex of last level */
+    if (queutab[seednum] < vertmin)
+      vertmin = queutab[seednum];
+  }
+  thrdptr->vertmin = vertmin;
+  thrdptr->degrsum = 0;
+  threadReduce (descptr, (void *) thrdptr, sizeof (GraphBfsThread), (ThreadReduceFunc) graphBfsReduce, 0, NULL);
+  if (thrdnum == 0)
+    dataptr->vertmin = thrdptr->vertmin;
+
+  if (dataptr->ordrval != 0) {                    /* If queue must be sorted by level and vertex index */
+    Gnum * restrict const cnbrtab = thrdptr->cnbrtab; /* Counts of local vertices per level          */
+    Gnum * restrict const ofsttab = cnbrtab + levlnum + 1; /* Start indices of local vertices per level */
+    Gnum                  queunum;
+    Gnum                  levltmp;
+
+    memSet (cnbrtab, 0, (levlnum + 1) * sizeof (Gnum));
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+      if (levltax[vertnum] > 0)                   /* Seed vertices and unreached ones are not moved */
+        cnbrtab[levltax[vertnum]] ++;
+    }
+    threadBarrier (descptr);                      /* All counts must be known */
+
+    for (levltmp = 1, queunum = seednbr; levltmp <= levlnum; levltmp ++) {
+      int                 thrdtmp;
+
+      for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+        if (thrdtmp == thrdnum)
+          ofsttab[levltmp] = queunum;
+        queunum += dataptr->thrdtab[thrdtmp].cnbrtab[levltmp];
+      }
+    }
+
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+      if (levltax[vertnum] > 0)
+        queutab[ofsttab[levltax[vertnum]] ++] = vertnum;
+    }
+  }
+}
+
+/* This routine computes the breadth-first
+** search levels of the vertices of the given
+** graph, starting from the given array of seed
+** vertices, up to the given maximum level. The
+** level array is set to ~0 for unreached vertices.
+** If a queue array is provided, of a size equal to
+** the number of vertices, it receives all reached
+** vertices: first the seed vertices, in their
+** order, then the other ones by increasing level
+** and vertex index. The seed array may be the
+** queue array itself.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphBfs (
+const Graph * restrict const  grafptr,            /* Graph to search                              */
+const Gnum                    seednbr,            /* Number of seed vertices                      */
+const Gnum * const            seedtab,            /* Array of seed vertices                       */
+const Gnum                    levlmax,            /* Maximum level to reach                       */
+Gnum * restrict const         levltax,            /* Level array [based]                          */
+Gnum * const                  queutab,            /* Ordered array of reached vertices, or NULL   */
+Gnum * restrict const         vertptr,            /* Pointer to number of reached vertices        */
+Gnum * restrict const         levlptr,            /* Pointer to last level reached                */
+Gnum * restrict const         vlstptr,            /* Pointer to smallest vertex of last level, or NULL */
+Context * restrict const      contptr)            /* Execution context                            */
+{
+  GraphBfsData        datadat;
+  GraphBfsThread *    thrdtab;
+  int *               flagtab;
+  Gnum *              queutmp;
+  Gnum *              edgetab;
+  Gnum *              cnbrtab;
+  Gnum                edgesiz;                    /* Size of decoding buffer of each thread    */
+  Gnum                cnbrsiz;                    /* Size of level count arrays of each thread */
+  int                 thrdnum;
+  int                 o;
+
+  const Gnum          vertnbr = grafptr->vertnbr;
+  const int           thrdnbr = contextThreadNbr (contptr);
+
+  edgesiz = (grafptr->edgetax == NULL) ? (grafptr->degrmax + 1) : 0;
+  cnbrsiz = (queutab != NULL) ? (2 * (MIN (levlmax, vertnbr) + 1)) : 0;
+  if (memAllocGroup ((void **) (void *)
+                     &thrdtab, (size_t) (thrdnbr * sizeof (GraphBfsThread)),
+                     &flagtab, (size_t) (vertnbr * sizeof (int)),
+                     &queutmp, (size_t) (((queutab == NULL) ? vertnbr : 0) * sizeof (Gnum)),
+                     &edgetab, (size_t) (thrdnbr * edgesiz * sizeof (Gnum)),
+                     &cnbrtab, (size_t) (thrdnbr * cnbrsiz * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphBfs: out of memory");
+    return (1);
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    thrdtab[thrdnum].listtab = NULL;
+    thrdtab[thrdnum].listsiz = 0;
+    thrdtab[thrdnum].edgetab = (edgesiz > 0) ? (edgetab + thrdnum * edgesiz) : NULL;
+    thrdtab[thrdnum].cnbrtab = (cnbrsiz > 0) ? (cnbrtab + thrdnum * cnbrsiz) : NULL;
+  }
+
+  datadat.grafptr = grafptr;
+  datadat.seedtab = seedtab;
+  datadat.seednbr = seednbr;
+  datadat.levlmax = levlmax;
+  datadat.levltax = levltax;
+  datadat.flagtax = flagtab - grafptr->baseval;
+  datadat.queutab = (queutab != NULL) ? queutab : queutmp;
+  datadat.ordrval = (queutab != NULL);
+  datadat.thrdtab = thrdtab;
+
+  contextThreadLaunch (contptr, (ThreadFunc) graphBfsThrd, (void *) &datadat);
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (thrdtab[thrdnum].listtab != NULL)
+      memFree (thrdtab[thrdnum].listtab);
+  }
+
+  o = 1;
+  if (datadat.statval != GRAPHBFSABORT) {
+    *vertptr = datadat.fronnnd;                   /* All reached vertices are in queue */
+    *levlptr = datadat.levlnum;
+    if (vlstptr != NULL)
+      *vlstptr = datadat.vertmin;
+    o = 0;
+  }
+
+  memFree (thrdtab);                              /* Free group leader */
+
+  return (o);
+}
@@ -0,0 +1,132 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_bfs.h                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the multithreaded breadth-first     **/
+/**                search routine.                         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Frontier size below which levels are
+    expanded by a single thread, to avoid
+    paying barriers for tiny levels.       +*/
+
+#define GRAPHBFSFRONMIN             1024
+
+/*+ Direction switching parameters: search
+    goes bottom-up when frontier edges exceed
+    the unexplored edges divided by ALPHA, and
+    back top-down when frontier vertices get
+    fewer than the vertices divided by BETA.  +*/
+
+#define GRAPHBFSALPHA               14
+#define GRAPHBFSBETA                24
+
+/*+ Minimum size of per-thread vertex lists. +*/
+
+#define GRAPHBFSLISTMIN             1024
+
+/*+ Search direction and state flags. +*/
+
+#define GRAPHBFSTOPDOWN             0             /* Frontier vertices scan their neighbors     */
+#define GRAPHBFSBOTTOMUP            1             /* Unvisited vertices look for frontier ones  */
+
+#define GRAPHBFSRUN                 0             /* Search goes on                             */
+#define GRAPHBFSDONE                1             /* No more level to expand                    */
+#define GRAPHBFSABORT               2             /* Search aborted on error                    */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphBfsThread_ {
+  Gnum *                    listtab;              /*+ Local list of vertices of next level    +*/
+  Gnum                      listsiz;              /*+ Size of local list                      +*/
+  Gnum *                    edgetab;              /*+ Decoding buffer for compressed graph    +*/
+  Gnum *                    cnbrtab;              /*+ Per-level counts for ordered output     +*/
+  Gnum                      degrsum;              /*+ Sum of degrees of local next vertices   +*/
+  Gnum                      vertmin;              /*+ Smallest local vertex of last level     +*/
+  Gnum                      abrtval;              /*+ Abort flag                              +*/
+  Gnum                      scantab[2];           /*+ Scan area for queue indices             +*/
+} GraphBfsThread;
+
+/*+ The thread-independent data block. The
+    search state is only updated by the first
+    thread, between barriers.                 +*/
+
+typedef struct GraphBfsData_ {
+  const Graph *             grafptr;              /*+ Graph to search                         +*/
+  const Gnum *              seedtab;              /*+ Array of seed vertices                  +*/
+  Gnum                      seednbr;              /*+ Number of seed vertices                 +*/
+  Gnum                      levlmax;              /*+ Maximum level to reach                  +*/
+  Gnum *                    levltax;              /*+ Level array                             +*/
+  int *                     flagtax;              /*+ Visit flag array, for top-down claims   +*/
+  Gnum *                    queutab;              /*+ Queue of reached vertices               +*/
+  int                       ordrval;              /*+ Set if queue must be ordered on output  +*/
+  Gnum                      fronbas;              /*+ Start index of current level in queue   +*/
+  Gnum                      fronnnd;              /*+ End index of current level in queue     +*/
+  Gnum                      levlnum;              /*+ Current level                           +*/
+  Gnum                      edgeleft;             /*+ Number of arcs of unvisited vertices    +*/
+  Gnum                      frondeg;              /*+ Number of arcs of current level         +*/
+  int                       dirval;               /*+ Search direction                        +*/
+  int                       statval;              /*+ Search state                            +*/
+  Gnum                      vertmin;              /*+ Smallest vertex of last level           +*/
+  GraphBfsThread *          thrdtab;              /*+ Array of thread-specific data blocks    +*/
+} GraphBfsData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_BFS
+static void                 graphBfsScan        (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+static void                 graphBfsReduce      (GraphBfsThread * restrict const, GraphBfsThread * restrict const, const void * const);
+static int                  graphBfsList        (GraphBfsThread * restrict const, const Gnum);
+static void                 graphBfsSeq         (GraphBfsData * restrict const, const Gnum, Gnum * restrict const);
+static void                 graphBfsThrd        (ThreadDescriptor * restrict const, GraphBfsData * restrict const);
+#endif /* SCOTCH_GRAPH_BFS */
+
+int                         graphBfs            (const Graph * restrict const, const Gnum, const Gnum * const, const Gnum, Gnum * restrict const, Gnum * const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Context * restrict const);
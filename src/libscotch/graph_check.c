@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2012,2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2012,2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 27 jun 2011     **/
 /**                                 to   : 23 feb 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 12 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,28 +78,33 @@
 /****************************************/
 
 /* This routine checks the consistency
-** of the given graph.
+** of the given graph, using the given
+** buffer array to decode adjacencies if
+** the graph is compressed.
 ** It returns:
 ** - 0   : if graph data are consistent.
 ** - !0  : on error.
 */
 
+static
 int
-graphCheck (
-const Graph * const         grafptr)
+graphCheck2 (
+const Graph * const         grafptr,
+Gnum * const                bufftab,              /* Decoding buffer for compressed graphs */
+const Gnum                  buffnbr)              /* Size of each half of decoding buffer  */
 {
   Gnum                vertnum;                    /* Number of current vertex */
   Gnum                velosum;                    /* Sum of vertex loads      */
   Gnum                edlosum;                    /* Sum of edge loads        */
-  Gnum                edgenbr;                    /* Number of edges (arcs)   */
-  Gnum                edgenum;                    /* Number of current edge   */
+  Genum               edgenbr;                    /* Number of edges (arcs)   */
+  Genum               edgenum;                    /* Number of current edge   */
   Gnum                degrmax;                    /* Maximum degree           */
+  const Gnum *        edgetax;                    /* Edge array of current vertex */
 
   const Gnum                  baseval = grafptr->baseval; /* Fast accesses */
-  const Gnum * restrict const verttax = grafptr->verttax;
-  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
   const Gnum * restrict const velotax = grafptr->velotax;
-  const Gnum * restrict const edgetax = grafptr->edgetax;
   const Gnum * restrict const edlotax = grafptr->edlotax;
 
   if ((grafptr->vertnbr < 0) ||
@@ -112,6 +117,11 @@ const Graph * const         grafptr)
     errorPrint ("graphCheck: invalid edge numbers");
     return (1);
   }
+  if ((grafptr->vconnbr < 0) ||
+      ((grafptr->vconnbr > 0) && ((grafptr->vcontax == NULL) || (velotax == NULL)))) {
+    errorPrint ("graphCheck: invalid constraint parameters");
+    return (1);
+  }
 
   degrmax =
   edgenbr = 0;
@@ -131,9 +141,11 @@ const Graph * const         grafptr)
       degrmax = degrval;
     edgenbr += degrval;
 
+    edgetax = graphEdgeTax (grafptr, vertnum, bufftab);
     for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
-      Gnum                vertend;                /* Number of end vertex      */
-      Gnum                edgeend;                /* Number of end vertex edge */
+      const Gnum * restrict edgeendtax;           /* Edge array of end vertex  */
+      Gnum                  vertend;              /* Number of end vertex      */
+      Gnum                  edgeend;              /* Number of end vertex edge */
 
       vertend = edgetax[edgenum];
       if (edlotax != NULL) {
@@ -155,8 +167,9 @@ const Graph * const         grafptr)
         errorPrint ("graphCheck: loops not allowed");
         return (1);
       }
+      edgeendtax = graphEdgeTax (grafptr, vertend, bufftab + buffnbr);
       for (edgeend = verttax[vertend];            /* Search for matching arc */
-           (edgeend < vendtax[vertend]) && (edgetax[edgeend] != vertnum);
+           (edgeend < vendtax[vertend]) && (edgeendtax[edgeend] != vertnum);
            edgeend ++) ;
       if ((edgeend >= vendtax[vertend]) ||
           ((edlotax != NULL) && (edlotax[edgenum] != edlotax[edgeend]))) {
@@ -164,7 +177,7 @@ const Graph * const         grafptr)
         return (1);
       }
       for (edgeend ++;                            /* Search for duplicate arcs */
-           (edgeend < vendtax[vertend]) && (edgetax[edgeend] != vertnum);
+           (edgeend < vendtax[vertend]) && (edgeendtax[edgeend] != vertnum);
            edgeend ++) ;
       if (edgeend < vendtax[vertend]) {
         errorPrint ("graphCheck: duplicate arc");
@@ -185,6 +198,16 @@ const Graph * const         grafptr)
       }
       velosum = velotmp;
     }
+    if (grafptr->vconnbr > 0) {
+      Gnum                vconnum;
+
+      for (vconnum = 0; vconnum < grafptr->vconnbr; vconnum ++) {
+        if (grafptr->vcontax[vertnum * grafptr->vconnbr + vconnum] < 0) {
+          errorPrint ("graphCheck: invalid constraint load array");
+          return (1);
+        }
+      }
+    }
   }
   if (grafptr->edgenbr != edgenbr) {
     errorPrint ("graphCheck: invalid number of edges");
@@ -205,3 +228,42 @@ const Graph * const         grafptr)
 
   return (0);
 }
+
+/* This routine checks the consistency
+** of the given graph.
+** It returns:
+** - 0   : if graph data are consistent.
+** - !0  : on error.
+*/
+
+int
+graphCheck (
+const Graph * const         grafptr)
+{
+  Gnum *              bufftab;                    /* Decoding buffer for compressed graphs */
+  Gnum                buffnbr;
+  Gnum                vertnum;
+  int                 o;
+
+  if ((grafptr->flagval & GRAPHEDGECMPR) == 0)    /* If plain graph, no decoding buffer needed */
+    return (graphCheck2 (grafptr, NULL, 0));
+
+  if (graphCmprCheck (grafptr) != 0)              /* Check that compressed data can be decoded */
+    return (1);
+
+  for (vertnum = grafptr->baseval, buffnbr = 1;   /* Compute actual maximum degree */
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    if ((grafptr->vendtax[vertnum] - grafptr->verttax[vertnum]) > buffnbr)
+      buffnbr = grafptr->vendtax[vertnum] - grafptr->verttax[vertnum];
+  }
+  if ((bufftab = memAlloc (2 * buffnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("graphCheck: out of memory");
+    return (1);
+  }
+
+  o = graphCheck2 (grafptr, bufftab, buffnbr);
+
+  memFree (bufftab);
+
+  return (o);
+}
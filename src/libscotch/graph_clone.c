@@ -1,4 +1,4 @@
-/* Copyright 2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 22 feb 2016     **/
 /**                                 to   : 22 feb 2018     **/
 /**                # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -71,18 +71,21 @@ graphClone (
 const Graph * restrict const    orggrafptr,
 Graph * restrict const          clngrafptr)
 {
+  Genum *             verttab;
   Gnum *              datatab;
   Gnum                baseval;
   Gnum                vertnbr;
   Gnum                vertnnd;
-  Gnum                datasiz;
-  Gnum                edgesiz;
+  Genum               vertsiz;
+  Genum               datasiz;
+  Genum               edgesiz;
 
   baseval = orggrafptr->baseval;
   vertnbr = orggrafptr->vertnbr;
 
-  datasiz  = vertnbr;                             /* Account for verttab */
-  datasiz += (orggrafptr->vendtax != (orggrafptr->verttax + 1)) ? vertnbr : 1; /* Account for vendtab or compact array */
+  vertsiz  = vertnbr;                             /* Account for verttab */
+  vertsiz += (orggrafptr->vendtax != (orggrafptr->verttax + 1)) ? vertnbr : 1; /* Account for vendtab or compact array */
+  datasiz  = 0;
   if (orggrafptr->velotax != NULL)
     datasiz += vertnbr;                           /* Account for velotab */
   if (orggrafptr->vnumtax != NULL)
@@ -90,7 +93,9 @@ Graph * restrict const          clngrafptr)
   if (orggrafptr->vlbltax != NULL)
     datasiz += vertnbr;                           /* Account for vlbltab */
 
-  if ((datatab = memAlloc (datasiz * sizeof (Gnum))) == NULL) {
+  if (memAllocGroup ((void **) (void *)
+                     &verttab, (size_t) (vertsiz * sizeof (Genum)),
+                     &datatab, (size_t) (datasiz * sizeof (Gnum)), NULL) == NULL) {
     errorPrint ("graphClone: out of memory (1)");
     return     (1);
   }
@@ -100,33 +105,31 @@ Graph * restrict const          clngrafptr)
   clngrafptr->vertnbr = vertnbr;
   clngrafptr->vertnnd = vertnnd = vertnbr + baseval;
 
-  clngrafptr->verttax = datatab - baseval;        /* Manage verttab */
-  memCpy (datatab, orggrafptr->verttax + baseval, vertnbr * sizeof (Gnum));
-  datatab += vertnbr;
+  clngrafptr->verttax = verttab - baseval;        /* Manage verttab */
+  memCpy (verttab, orggrafptr->verttax + baseval, vertnbr * sizeof (Genum));
+  verttab += vertnbr;
 
   if (orggrafptr->vendtax == (orggrafptr->verttax + 1)) { /* If compact array  */
     clngrafptr->vendtax = clngrafptr->verttax + 1; /* Set compact array        */
     edgesiz = orggrafptr->verttax[vertnnd];       /* Get end of compact array  */
     clngrafptr->verttax[vertnnd] = edgesiz;       /* Copy end of compact array */
-    datatab ++;                                   /* Space for last index      */
   }
   else {
-    const Gnum * restrict orgvendptr;
-    Gnum * restrict       clnvendptr;
+    const Genum * restrict orgvendptr;
+    Genum * restrict      clnvendptr;
     Gnum                  vertnum;
 
-    clngrafptr->vendtax = datatab - baseval;      /* Set vendtab */
-    clnvendptr = datatab;
+    clngrafptr->vendtax = verttab - baseval;      /* Set vendtab */
+    clnvendptr = verttab;
     orgvendptr = orggrafptr->vendtax + baseval;
     for (vertnum = 0, edgesiz = 0; vertnum < vertnbr; vertnum ++) {
-      Gnum                vendval;
+      Genum               vendval;
 
       vendval = *orgvendptr ++;                   /* Copy vertex index */
       *clnvendptr ++ = vendval;
       if (vendval > edgesiz)                      /* Record highest end index */
         edgesiz = vendval;
     }
-    datatab = clnvendptr;                         /* Resume after end of cloned array */
   }
   edgesiz -= baseval;                             /* Edge size is given by highest index */
 
@@ -139,6 +142,8 @@ Graph * restrict const          clngrafptr)
     clngrafptr->velotax = NULL;
 
   clngrafptr->velosum = orggrafptr->velosum;
+  clngrafptr->vconnbr = 0;                        /* Vertex load constraints are not cloned */
+  clngrafptr->vcontax = NULL;
 
   if (orggrafptr->vnumtax != NULL) {              /* Account for vnumtab */
     memCpy (datatab, orggrafptr->vnumtax + baseval, vertnbr * sizeof (Gnum));
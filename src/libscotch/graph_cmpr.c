@@ -0,0 +1,421 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_cmpr.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the compressed      **/
+/**                representation of source graph          **/
+/**                adjacency arrays.                       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_CMPR
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_cmpr.h"
+
+/*************************************/
+/*                                   */
+/* These routines handle compressed  */
+/* source graph adjacency arrays.    */
+/*                                   */
+/*************************************/
+
+/* In the compressed form, the neighbors of
+** every vertex are sorted by increasing index.
+** The first neighbor is stored as the zigzag
+** encoding of its signed offset with respect to
+** the vertex itself, and the other neighbors as
+** the differences with their predecessors, all
+** of them as little-endian base-128 variable
+** length integers. The vertex and edge load
+** arrays keep their meaning, edge loads being
+** permuted along with the sorted neighbors.
+*/
+
+/* This routine returns the number of
+** bytes needed to encode the given value.
+** It returns:
+** - >0  : in all cases.
+*/
+
+static
+Gnum
+graphCmprSize (
+Gunum                       dataval)
+{
+  Gnum                byteval;
+
+  for (byteval = 1; dataval >= GRAPHCMPRNEXT; dataval >>= GRAPHCMPRBITS, byteval ++) ;
+
+  return (byteval);
+}
+
+/* This routine copies the adjacency of
+** the given vertex, along with its edge
+** loads if any, into the given array,
+** and sorts it by increasing neighbor
+** index.
+** It returns:
+** - >=0  : degree of the vertex.
+*/
+
+static
+Gnum
+graphCmprSort (
+const Graph * restrict const  grafptr,
+const Gnum                    vertnum,
+Gnum * restrict const         sorttab)
+{
+  Genum               edgenum;
+  Genum               edgennd;
+  Gnum                sortnum;
+
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+  const Gnum * restrict const edlotax = grafptr->edlotax;
+
+  edgenum = grafptr->verttax[vertnum];
+  edgennd = grafptr->vendtax[vertnum];
+  if (edlotax != NULL) {
+    for (sortnum = 0; edgenum < edgennd; edgenum ++, sortnum += 2) {
+      sorttab[sortnum]     = edgetax[edgenum];
+      sorttab[sortnum + 1] = edlotax[edgenum];
+    }
+    intSort2asc1 (sorttab, sortnum / 2);
+    return (sortnum / 2);
+  }
+
+  for (sortnum = 0; edgenum < edgennd; edgenum ++, sortnum ++)
+    sorttab[sortnum] = edgetax[edgenum];
+  intSort1asc1 (sorttab, sortnum);
+  return (sortnum);
+}
+
+/* This routine replaces the edge array of
+** the given graph by its compressed form.
+** Edge loads are kept in a plain array,
+** permuted according to the sorted order
+** of neighbors. Graphs which are mapped
+** from a file cannot be compressed.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphCmprBuild (
+Graph * const               grafptr)
+{
+  Gnum * restrict     sorttab;                    /* Sorting array for adjacency of current vertex */
+  Gnum * restrict     vcmptab;
+  Gnum * restrict     edlotab;
+  byte * restrict     ecmptab;
+  Gnum                ecmpsiz;                    /* Size of compressed edge array in bytes */
+  Genum               edgennd;                    /* Upper bound of edge indices            */
+  Gnum                vertnum;
+
+  const Gnum                  baseval = grafptr->baseval;
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
+  Gnum * const                edgetax = grafptr->edgetax;
+  Gnum * const                edlotax = grafptr->edlotax;
+  const Gnum                  sortsiz = (edlotax != NULL) ? 2 : 1; /* Number of sort items per edge */
+
+  if ((grafptr->flagval & GRAPHEDGECMPR) != 0)    /* If graph already compressed, nothing to do */
+    return (0);
+  if ((grafptr->flagval & GRAPHFILEMAP) != 0) {
+    errorPrint ("graphCmprBuild: cannot compress mapped graph");
+    return (1);
+  }
+
+  if ((sorttab = memAlloc ((grafptr->degrmax * sortsiz + 1) * sizeof (Gnum))) == NULL) {
+    errorPrint ("graphCmprBuild: out of memory (1)");
+    return (1);
+  }
+
+  for (vertnum = baseval, ecmpsiz = 0, edgennd = baseval; /* First pass: compute size of compressed array */
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum                degrval;
+    Gnum                vertend;
+    Gnum                sortnum;
+
+    if (vendtax[vertnum] > edgennd)
+      edgennd = vendtax[vertnum];
+
+    degrval = graphCmprSort (grafptr, vertnum, sorttab);
+    if (degrval <= 0)
+      continue;
+
+    vertend  = sorttab[0];
+    ecmpsiz += graphCmprSize (GRAPHCMPRZIGZAG (vertend - vertnum));
+    for (sortnum = 1; sortnum < degrval; sortnum ++) {
+      ecmpsiz += graphCmprSize ((Gunum) (sorttab[sortnum * sortsiz] - vertend));
+      vertend  = sorttab[sortnum * sortsiz];
+    }
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &vcmptab, (size_t) ((grafptr->vertnbr + 1) * sizeof (Gnum)),
+                     &edlotab, (size_t) ((edlotax != NULL) ? ((edgennd - baseval) * sizeof (Gnum)) : 0),
+                     &ecmptab, (size_t) ecmpsiz, NULL) == NULL) {
+    errorPrint ("graphCmprBuild: out of memory (2)");
+    memFree    (sorttab);
+    return     (1);
+  }
+  vcmptab -= baseval;                             /* Base arrays */
+  edlotab -= baseval;
+
+  for (vertnum = baseval, ecmpsiz = 0;            /* Second pass: encode adjacency */
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum                degrval;
+    Gnum                vertend;
+    Gnum                sortnum;
+
+    vcmptab[vertnum] = ecmpsiz;
+    degrval = graphCmprSort (grafptr, vertnum, sorttab);
+    for (sortnum = 0, vertend = vertnum; sortnum < degrval; sortnum ++) {
+      Gunum               dataval;
+
+      dataval = (sortnum == 0) ? GRAPHCMPRZIGZAG (sorttab[0] - vertnum) : (Gunum) (sorttab[sortnum * sortsiz] - vertend);
+      vertend = sorttab[sortnum * sortsiz];
+      while (dataval >= GRAPHCMPRNEXT) {
+        ecmptab[ecmpsiz ++] = (byte) ((dataval & GRAPHCMPRMASK) | GRAPHCMPRNEXT);
+        dataval >>= GRAPHCMPRBITS;
+      }
+      ecmptab[ecmpsiz ++] = (byte) dataval;
+
+      if (edlotax != NULL)                        /* Permute edge loads along with neighbors */
+        edlotab[verttax[vertnum] + sortnum] = sorttab[sortnum * 2 + 1];
+    }
+  }
+  vcmptab[vertnum] = ecmpsiz;                     /* Set end of compressed array */
+
+  memFree (sorttab);
+
+  if ((grafptr->flagval & GRAPHFREEEDGE) != 0)    /* Free edge array, and edge load array if grouped */
+    memFree (edgetax + baseval);
+  if ((edlotax != NULL) &&                        /* Free separate edge load array if owned */
+      ((grafptr->flagval & (GRAPHFREEOTHR | GRAPHEDGEGROUP)) == GRAPHFREEOTHR))
+    memFree (edlotax + baseval);
+
+  grafptr->flagval  = (grafptr->flagval & ~GRAPHFREEEDGE) | GRAPHEDGECMPR | GRAPHEDGEGROUP; /* Edge loads now belong to compressed group */
+  grafptr->edgetax  = NULL;
+  grafptr->edlotax  = (edlotax != NULL) ? edlotab : NULL;
+  grafptr->vcmptax  = vcmptab;
+  grafptr->ecmptab  = ecmptab;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {
+    errorPrint ("graphCmprBuild: internal error");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine restores a plain edge array
+** for the given compressed graph. Neighbors
+** remain sorted by increasing index.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphCmprExpand (
+Graph * const               grafptr)
+{
+  Gnum * restrict     edgetab;
+  Gnum * restrict     edlotab;
+  Genum               edgennd;
+  Gnum                vertnum;
+
+  const Gnum                  baseval = grafptr->baseval;
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
+
+  if ((grafptr->flagval & GRAPHEDGECMPR) == 0)    /* If graph not compressed, nothing to do */
+    return (0);
+
+  for (vertnum = baseval, edgennd = baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+    if (vendtax[vertnum] > edgennd)
+      edgennd = vendtax[vertnum];
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &edgetab, (size_t) ((edgennd - baseval) * sizeof (Gnum)),
+                     &edlotab, (size_t) ((grafptr->edlotax != NULL) ? ((edgennd - baseval) * sizeof (Gnum)) : 0), NULL) == NULL) {
+    errorPrint ("graphCmprExpand: out of memory");
+    return (1);
+  }
+  edgetab -= baseval;                             /* Base arrays */
+  edlotab -= baseval;
+
+  for (vertnum = baseval; vertnum < grafptr->vertnnd; vertnum ++)
+    graphCmprVert (grafptr, vertnum, edgetab + verttax[vertnum]);
+  if (grafptr->edlotax != NULL) {
+    memCpy (edlotab + baseval, grafptr->edlotax + baseval, (edgennd - baseval) * sizeof (Gnum));
+    grafptr->edlotax = edlotab;
+  }
+
+  memFree (grafptr->vcmptax + baseval);           /* Free compressed array group */
+
+  grafptr->flagval = (grafptr->flagval & ~GRAPHEDGECMPR) | GRAPHFREEEDGE | GRAPHEDGEGROUP;
+  grafptr->edgetax = edgetab;
+  grafptr->vcmptax = NULL;
+  grafptr->ecmptab = NULL;
+
+  return (0);
+}
+
+/* This routine decodes the adjacency of
+** the given vertex of a compressed graph
+** into the given buffer, which must be
+** able to hold degrmax vertex indices.
+** It returns:
+** - !NULL  : based pointer such that
+**            bufftab[0] is accessed with
+**            index verttax[vertnum].
+*/
+
+const Gnum *
+graphCmprVert (
+const Graph * const         grafptr,
+const Gnum                  vertnum,
+Gnum * const                bufftab)
+{
+  const byte * restrict bytetab;
+  Gnum                  buffnum;
+  Gnum                  buffnbr;
+  Gnum                  vertend;
+
+  bytetab = grafptr->ecmptab + grafptr->vcmptax[vertnum];
+  buffnbr = grafptr->vendtax[vertnum] - grafptr->verttax[vertnum];
+  for (buffnum = 0, vertend = vertnum; buffnum < buffnbr; buffnum ++) {
+    Gunum               dataval;
+    int                 shftval;
+    byte                byteval;
+
+    for (dataval = 0, shftval = 0; ; shftval += GRAPHCMPRBITS) {
+      byteval  = *bytetab ++;
+      dataval |= ((Gunum) (byteval & GRAPHCMPRMASK)) << shftval;
+      if ((byteval & GRAPHCMPRNEXT) == 0)
+        break;
+    }
+    vertend += (buffnum == 0) ? GRAPHCMPRUNZIG (dataval) : (Gnum) dataval;
+    bufftab[buffnum] = vertend;
+  }
+
+  return (bufftab - grafptr->verttax[vertnum]);
+}
+
+/* This routine checks the consistency of
+** the compressed adjacency of the given
+** graph, so that it can be safely decoded.
+** It returns:
+** - 0   : if compressed data are consistent.
+** - !0  : on error.
+*/
+
+int
+graphCmprCheck (
+const Graph * const         grafptr)
+{
+  Gnum                vertnum;
+
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const vcmptax = grafptr->vcmptax;
+
+  if ((grafptr->edgetax != NULL) ||
+      (vcmptax == NULL) || (grafptr->ecmptab == NULL) ||
+      (vcmptax[grafptr->baseval] != 0)) {
+    errorPrint ("graphCmprCheck: invalid compressed arrays");
+    return (1);
+  }
+
+  for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum                bytenum;
+    Gnum                bytennd;
+    Gnum                degrval;
+    Genum               edgenum;
+
+    bytenum = vcmptax[vertnum];
+    bytennd = vcmptax[vertnum + 1];
+    degrval = vendtax[vertnum] - verttax[vertnum];
+    if ((bytennd < bytenum) || ((bytennd - bytenum) < degrval)) {
+      errorPrint ("graphCmprCheck: invalid compressed index array");
+      return (1);
+    }
+
+    for (edgenum = 0; edgenum < degrval; edgenum ++) {
+      Gunum               dataval;
+      int                 shftval;
+      byte                byteval;
+
+      for (dataval = 0, shftval = 0; ; shftval += GRAPHCMPRBITS) {
+        if ((bytenum >= bytennd) ||
+            (shftval >= (int) (sizeof (Gunum) * 8))) {
+          errorPrint ("graphCmprCheck: invalid compressed edge array");
+          return (1);
+        }
+        byteval  = grafptr->ecmptab[bytenum ++];
+        dataval |= ((Gunum) (byteval & GRAPHCMPRMASK)) << shftval;
+        if ((byteval & GRAPHCMPRNEXT) == 0)
+          break;
+      }
+      if ((edgenum > 0) && (dataval == 0)) {      /* Neighbors must be distinct */
+        errorPrint ("graphCmprCheck: duplicate arc");
+        return (1);
+      }
+    }
+    if (bytenum != bytennd) {
+      errorPrint ("graphCmprCheck: compressed adjacency size mismatch");
+      return (1);
+    }
+  }
+
+  return (0);
+}
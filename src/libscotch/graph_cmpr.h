@@ -0,0 +1,72 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_cmpr.h                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the compressed adjacency handling   **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Number of payload bits per byte of
+    variable-length encoded integers.  +*/
+
+#define GRAPHCMPRBITS               7
+#define GRAPHCMPRMASK               ((1 << GRAPHCMPRBITS) - 1)
+#define GRAPHCMPRNEXT               (1 << GRAPHCMPRBITS)
+
+/*+ Zigzag mapping of signed values onto unsigned
+    ones, so that small negative first-neighbor
+    offsets are encoded on few bytes.             +*/
+
+#define GRAPHCMPRZIGZAG(d)          ((((Gunum) (d)) << 1) ^ ((Gunum) (((d) < 0) ? -1 : 0)))
+#define GRAPHCMPRUNZIG(u)           ((Gnum) ((u) >> 1) ^ (- (Gnum) ((u) & 1)))
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_CMPR
+static Gnum                 graphCmprSort       (const Graph * restrict const, const Gnum, Gnum * restrict const);
+static Gnum                 graphCmprSize       (Gunum);
+#endif /* SCOTCH_GRAPH_CMPR */
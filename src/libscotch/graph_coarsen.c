@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 29 apr 2019     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -160,7 +160,7 @@ GraphCoarsenData * restrict const coarptr)
   GraphCoarsenMulti * restrict  coarmulttax;      /* Work pointer to multinode array    */
   Gnum                          coarvertnbr;
   Gnum                          coarhashnbr;      /* Size of neighbor vertex hash table */
-  Gnum                          coaredgebas;      /* Start of local edge sub-array      */
+  Genum                         coaredgebas;      /* Start of local edge sub-array      */
 
 #ifdef SCOTCH_PTHREAD
   const int                           thrdnbr     = threadNbr (descptr);
@@ -247,8 +247,8 @@ GraphCoarsenData * restrict const coarptr)
     coargrafptr->vertnnd = coarvertnbr + baseval;
     coargrafptr->velosum = finegrafptr->velosum;  /* Keep load of finer graph         */
     if ((memAllocGroup ((void **) (void *)        /* Allocate coarser graph structure */
-                        &coargrafptr->verttax, (size_t) (coarvertnbr * sizeof (Gnum)),
-                        &coargrafptr->vendtax, (size_t) (coarvendsiz * sizeof (Gnum)),
+                        &coargrafptr->verttax, (size_t) (coarvertnbr * sizeof (Genum)),
+                        &coargrafptr->vendtax, (size_t) (coarvendsiz * sizeof (Genum)),
                         &coargrafptr->velotax, (size_t) (coarvertnbr * sizeof (Gnum)),
                         &coarmulttab,          (size_t) (coarmultsiz * sizeof (GraphCoarsenMulti)), NULL) == NULL) ||
         ((coargrafptr->edgetax = memAlloc (finegrafptr->edgenbr * 2 * sizeof (Gnum))) == NULL)) { /* "* 2" for edlotab */
@@ -389,10 +389,10 @@ GraphCoarsenData * restrict const coarptr)
     if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) != 0) { /* If willing to have faster a non-compact graph */
       Gnum                coarvertnnd;
       Gnum                coarvertnum;
-      Gnum                coaredgenbr;
+      Genum               coaredgenbr;
 
-      const Gnum * restrict const fineverttax = finegrafptr->verttax;
-      const Gnum * restrict const finevendtax = finegrafptr->vendtax;
+      const Genum * restrict const fineverttax = finegrafptr->verttax;
+      const Genum * restrict const finevendtax = finegrafptr->vendtax;
 
       for (coarvertnum = thrdptr->coarvertbas,    /* For all local coarse vertices */
            coarvertnnd = thrdptr->coarvertnnd, coaredgenbr = 0;
@@ -480,6 +480,53 @@ GraphCoarsenData * restrict const coarptr)
 #endif /* GRAPHCOARSENNOTHREAD */
 }
 
+/* This routine builds the constraint load
+** array of the coarse graph, by summing the
+** constraint loads of the fine vertices of
+** each multinode.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphCoarsenVcon (
+const GraphCoarsenData * restrict const coarptr)
+{
+  Gnum * restrict               coarvcontab;
+  Gnum                          coarvertnum;
+
+  Graph * restrict const                    coargrafptr = coarptr->coargrafptr;
+  const Graph * restrict const              finegrafptr = coarptr->finegrafptr;
+  const GraphCoarsenMulti * restrict const  coarmulttab = coarptr->coarmulttab;
+  const Gnum * restrict const               finevcontax = finegrafptr->vcontax;
+  const Gnum                                vconnbr     = finegrafptr->vconnbr;
+
+  if ((coarvcontab = memAlloc (coargrafptr->vertnbr * vconnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("graphCoarsenVcon: out of memory");
+    return (1);
+  }
+
+  for (coarvertnum = 0; coarvertnum < coargrafptr->vertnbr; coarvertnum ++) {
+    Gnum                finevertnum0;
+    Gnum                finevertnum1;
+    Gnum                vconnum;
+
+    finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+    finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+    for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+      coarvcontab[coarvertnum * vconnbr + vconnum] = finevcontax[finevertnum0 * vconnbr + vconnum] +
+                                                     ((finevertnum1 != finevertnum0) ? finevcontax[finevertnum1 * vconnbr + vconnum] : 0);
+  }
+
+  coargrafptr->flagval |= GRAPHFREEVCON;
+  coargrafptr->vconnbr  = vconnbr;
+  coargrafptr->vcontax  = coarvcontab - coargrafptr->baseval * vconnbr;
+
+  return (0);
+}
+
 /* This routine is the sequential core of the
 ** matching and coarse graph building process.
 ** It returns:
@@ -494,6 +541,7 @@ graphCoarsen2 (
 GraphCoarsenData * restrict const     coarptr)
 {
   Gnum *              finematetab;                /* Pointer to locally allocated mate array  */
+  Gnum *              fineedgetab;                /* Decoding buffers for compressed graph    */
   Gnum                coarhashmsk;                /* Mask for access to hash table            */
 
   Graph * restrict const        coargrafptr = coarptr->coargrafptr;
@@ -539,8 +587,25 @@ GraphCoarsenData * restrict const     coarptr)
   }
   coarptr->retuval = 0;                           /* Assume no error */
 
+  fineedgetab = NULL;
+  if (finegrafptr->edgetax == NULL) {             /* If fine graph is compressed, allocate decoding buffers */
+    int                 thrdnum;
+
+    if ((fineedgetab = memAlloc ((thrdnbr * finegrafptr->degrmax + 1) * sizeof (Gnum))) == NULL) {
+      errorPrint ("graphCoarsen2: out of memory (3)");
+      memFree    (coarptr->thrdtab);
+      if (finematetab != NULL)
+        memFree (finematetab);
+      return (2);
+    }
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+      coarptr->thrdtab[thrdnum].fineedgetab = fineedgetab + thrdnum * finegrafptr->degrmax;
+  }
+
   contextThreadLaunch (coarptr->contptr, (ThreadFunc) graphCoarsen3, (void *) coarptr);
 
+  if (fineedgetab != NULL)
+    memFree (fineedgetab);
   memFree (coarptr->thrdtab);
 
   if ((coarptr->flagval & GRAPHCOARSENDSTMATE) == 0) /* If mating array destination not provided */
@@ -555,6 +620,12 @@ GraphCoarsenData * restrict const     coarptr)
   if (coargrafptr->verttax == NULL)               /* If graph could not be created */
     return (coarptr->retuval);
 
+  if ((finegrafptr->vcontax != NULL) &&           /* If fine graph bears vertex load constraints */
+      (graphCoarsenVcon (coarptr) != 0)) {
+    graphFree (coargrafptr);
+    return (2);
+  }
+
 #ifdef SCOTCH_DEBUG_GRAPH2
   if (graphCheck (coargrafptr) != 0) {            /* Check graph consistency */
     errorPrint ("graphCoarsen2: inconsistent graph data");
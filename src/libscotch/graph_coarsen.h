@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -136,6 +136,7 @@ typedef struct GraphCoarsenThread_ {
   Gnum *                    finequeutab;          /*+ Queue array (may be global)                             +*/
   Gnum                      finequeudlt;          /*+ Multiplicative factor for queue slot size on first pass +*/
   Gnum                      finequeunbr;          /*+ Number of vertices in (local) queue                     +*/
+  Gnum *                    fineedgetab;          /*+ Decoding buffer for compressed fine edge array          +*/
   Gnum                      scantab[2];
 } GraphCoarsenThread;
 
@@ -173,6 +174,7 @@ static void                 graphCoarsenEdgeCt  (const GraphCoarsenData * restri
 #endif /* GRAPHCOARSENNOTHREAD */
 static void                 graphCoarsenEdgeLl  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 static void                 graphCoarsenEdgeLu  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
+static int                  graphCoarsenVcon    (const GraphCoarsenData * restrict const);
 #endif /* SCOTCH_GRAPH_COARSEN */
 
 int                         graphCoarsen        (const Graph * restrict const, Graph * restrict const, Gnum * restrict * restrict const, GraphCoarsenMulti * restrict * restrict const, const Gnum, const double, const Gnum, const Anum * restrict const, const Anum * restrict const, const Gnum, Context * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2012,2018,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2012,2018,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 28 oct 2012     **/
 /**                                 to   : 28 feb 2015     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 28 oct 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,16 +61,15 @@ GraphCoarsenThread * restrict const     thrdptr)
 {
   Gnum                coarvertnum;
   Gnum                coarvertnnd;
-  Gnum                coaredgenum;
+  Genum               coaredgenum;
 #ifndef GRAPHCOARSENEDGECOUNT
   Gnum                coaredloadj;                /* Edge load sum adjust with respect to fine graph edge load sum */
   Gnum                coardegrmax;
 #endif /* GRAPHCOARSENEDGECOUNT */
 
   const Graph * restrict const              finegrafptr = coarptr->finegrafptr;
-  const Gnum * restrict const               fineverttax = finegrafptr->verttax;
-  const Gnum * restrict const               finevendtax = finegrafptr->vendtax;
-  const Gnum * restrict const               fineedgetax = finegrafptr->edgetax;
+  const Genum * restrict const               fineverttax = finegrafptr->verttax;
+  const Genum * restrict const               finevendtax = finegrafptr->vendtax;
 #ifdef GRAPHCOARSENEDLOTAB
   const Gnum * restrict const               fineedlotax = finegrafptr->edlotax;
 #endif /* GRAPHCOARSENEDLOTAB */
@@ -78,7 +77,7 @@ GraphCoarsenThread * restrict const     thrdptr)
 #ifndef GRAPHCOARSENEDGECOUNT
   const Gnum * restrict const               finevelotax = finegrafptr->velotax;
   const Graph * restrict const              coargrafptr = coarptr->coargrafptr;
-  Gnum * restrict const                     coarverttax = coargrafptr->verttax;
+  Genum * restrict const                     coarverttax = coargrafptr->verttax;
   Gnum * restrict const                     coarvelotax = coargrafptr->velotax;
   Gnum * restrict const                     coaredgetax = coargrafptr->edgetax;
   Gnum * restrict const                     coaredlotax = coargrafptr->edlotax;
@@ -99,7 +98,7 @@ GraphCoarsenThread * restrict const     thrdptr)
 
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
     Gnum                coarveloval;              /* Load of coarse vertex           */
-    Gnum                coaredgetmp;              /* Current index in edge array     */
+    Genum               coaredgetmp;              /* Current index in edge array     */
 
     coarverttax[coarvertnum] =                    /* Set vertex edge index */
     coaredgetmp = coaredgenum;
@@ -107,9 +106,11 @@ GraphCoarsenThread * restrict const     thrdptr)
 #endif /* GRAPHCOARSENEDGECOUNT */
     i = 0;
     do {                                          /* For all fine edges of multinode vertices */
-      Gnum                fineedgenum;
+      const Gnum * restrict fineedgetax;
+      Genum                 fineedgenum;
 
       finevertnum = coarmulttax[coarvertnum].vertnum[i];
+      fineedgetax = graphEdgeTax (finegrafptr, finevertnum, thrdptr->fineedgetab); /* Decode adjacency if compressed */
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
       coarveloval += (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
 #endif /* GRAPHCOARSENEDGECOUNT */
@@ -0,0 +1,569 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_color.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes vertex colorings   **/
+/**                of source graphs, using all the         **/
+/**                threads of the given context.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_COLOR
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_color.h"
+
+/*********************************/
+/*                               */
+/* These routines compute        */
+/* colorings of source graphs.   */
+/*                               */
+/*********************************/
+
+/* Colorings are computed in rounds, on a
+** queue of uncolored vertices which every
+** thread processes by slices of whole chunks.
+** With Luby rounds, a vertex is given the color
+** of the round when its priority is the highest
+** among the uncolored vertices at distance 1 (or
+** 2). With the speculative greedy method, every
+** chunk is colored sequentially by first fit,
+** considering only the vertices colored in former
+** rounds and those of the same chunk, after which
+** the vertex of lowest priority of every pair of
+** conflicting vertices is put back in the queue.
+** In both cases, the results only depend on the
+** vertex priorities, and not on the number of
+** threads.
+*/
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+*/
+
+static
+void
+graphColorScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine merges the color marking array
+** sizes, color numbers and abort flags computed
+** by multiple threads.
+*/
+
+static
+void
+graphColorReduce (
+GraphColorThread * restrict const tlocptr,        /* Pointer to local thread block  */
+GraphColorThread * restrict const tremptr,        /* Pointer to remote thread block */
+const void * const                globptr)        /* Unused                         */
+{
+  if (tremptr->cmaxnbr > tlocptr->cmaxnbr)
+    tlocptr->cmaxnbr = tremptr->cmaxnbr;
+  if (tremptr->colonbr > tlocptr->colonbr)
+    tlocptr->colonbr = tremptr->colonbr;
+  tlocptr->abrtval |= tremptr->abrtval;
+}
+
+/* This routine tells whether the given vertex
+** has the highest priority among the uncolored
+** vertices of its distance-1 (or distance-2)
+** neighborhood. Only colors set in former rounds
+** are present in the color array at this time.
+** It returns:
+** - 0   : if the vertex cannot be colored yet.
+** - !0  : if the vertex can take the color of
+**         the current round.
+*/
+
+static
+int
+graphColorLuby (
+const GraphColorData * restrict const dataptr,
+const Gnum                            vertnum,
+Gnum * restrict const                 edg1tab,    /* Decoding buffers, if compressed graph */
+Gnum * restrict const                 edg2tab)
+{
+  const Gnum * restrict edgetax;
+  Genum                 edgenum;
+  Genum                 edgennd;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  const Gnum * restrict const   colotax = dataptr->colotax;
+  const Gnum * restrict const   randtax = dataptr->randtax;
+
+  edgetax = graphEdgeTax (grafptr, vertnum, edg1tab);
+  for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+    Gnum                vertend;
+
+    vertend = edgetax[edgenum];
+    if ((colotax[vertend] < 0) &&                 /* If neighbor not colored in a former round */
+        (GRAPHCOLORPRIOR (randtax, vertend, vertnum)))
+      return (0);
+
+    if ((dataptr->flagval & GRAPHCOLORDIST2) != 0) { /* If distance-2 neighbors also considered */
+      const Gnum * restrict edgetx2;
+      Genum                 edgenm2;
+      Genum                 edgennd2;
+
+      edgetx2 = graphEdgeTax (grafptr, vertend, edg2tab);
+      for (edgenm2 = verttax[vertend], edgennd2 = vendtax[vertend]; edgenm2 < edgennd2; edgenm2 ++) {
+        Gnum                vertnd2;
+
+        vertnd2 = edgetx2[edgenm2];
+        if ((vertnd2 != vertnum) &&
+            (colotax[vertnd2] < 0) &&
+            (GRAPHCOLORPRIOR (randtax, vertnd2, vertnum)))
+          return (0);
+      }
+    }
+  }
+
+  return (1);
+}
+
+/* This routine computes the smallest color
+** which is not used by the distance-1 (or
+** distance-2) neighbors of the given vertex
+** that have been colored in a former round
+** or that belong to the same chunk. Colors
+** are marked with a stamp value which is
+** never re-used by the calling thread.
+** It returns:
+** - [0;cmaxnbr[  : tentative color.
+*/
+
+static
+Gnum
+graphColorGreedy (
+const GraphColorData * restrict const dataptr,
+const Gnum                            vertnum,
+const Gnum                            chnkbas,    /* Index of first chunk of the round */
+const Gnum                            stmpval,    /* Marking stamp for this vertex     */
+Gnum * restrict const                 cmrktab,    /* Color marking array               */
+Gnum * restrict const                 edg1tab,    /* Decoding buffers, if compressed   */
+Gnum * restrict const                 edg2tab)
+{
+  const Gnum * restrict edgetax;
+  Genum                 edgenum;
+  Genum                 edgennd;
+  Gnum                  colonum;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  const Gnum * restrict const   colotax = dataptr->colotax;
+  const Gnum * restrict const   chnktax = dataptr->chnktax;
+  const Gnum                    chnknum = chnktax[vertnum];
+
+  edgetax = graphEdgeTax (grafptr, vertnum, edg1tab);
+  for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+    Gnum                vertend;
+    Gnum                chnkend;
+
+    vertend = edgetax[edgenum];
+    chnkend = chnktax[vertend];
+    if ((chnkend < chnkbas) ||                    /* If neighbor colored in a former round */
+        ((chnkend == chnknum) && (colotax[vertend] >= 0))) /* Or already in same chunk     */
+      cmrktab[colotax[vertend]] = stmpval;
+
+    if ((dataptr->flagval & GRAPHCOLORDIST2) != 0) {
+      const Gnum * restrict edgetx2;
+      Genum                 edgenm2;
+      Genum                 edgennd2;
+
+      edgetx2 = graphEdgeTax (grafptr, vertend, edg2tab);
+      for (edgenm2 = verttax[vertend], edgennd2 = vendtax[vertend]; edgenm2 < edgennd2; edgenm2 ++) {
+        Gnum                vertnd2;
+        Gnum                chnknd2;
+
+        vertnd2 = edgetx2[edgenm2];
+        chnknd2 = chnktax[vertnd2];
+        if ((vertnd2 != vertnum) &&
+            ((chnknd2 < chnkbas) ||
+             ((chnknd2 == chnknum) && (colotax[vertnd2] >= 0))))
+          cmrktab[colotax[vertnd2]] = stmpval;
+      }
+    }
+  }
+
+  for (colonum = 0; cmrktab[colonum] == stmpval; colonum ++) ; /* Find first free color */
+
+  return (colonum);
+}
+
+/* This routine tells whether the tentative
+** color of the given vertex is also used by
+** a distance-1 (or distance-2) neighbor of
+** higher priority, colored during the same
+** round in another chunk.
+** It returns:
+** - 0   : if the color of the vertex is kept.
+** - !0  : if the vertex must be colored again.
+*/
+
+static
+int
+graphColorConflict (
+const GraphColorData * restrict const dataptr,
+const Gnum                            vertnum,
+const Gnum                            chnkbas,    /* Index of first chunk of the round */
+Gnum * restrict const                 edg1tab,    /* Decoding buffers, if compressed   */
+Gnum * restrict const                 edg2tab)
+{
+  const Gnum * restrict edgetax;
+  Genum                 edgenum;
+  Genum                 edgennd;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  const Gnum * restrict const   colotax = dataptr->colotax;
+  const Gnum * restrict const   randtax = dataptr->randtax;
+  const Gnum * restrict const   chnktax = dataptr->chnktax;
+  const Gnum                    chnknum = chnktax[vertnum];
+  const Gnum                    coloval = colotax[vertnum];
+
+  edgetax = graphEdgeTax (grafptr, vertnum, edg1tab);
+  for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+    Gnum                vertend;
+    Gnum                chnkend;
+
+    vertend = edgetax[edgenum];
+    chnkend = chnktax[vertend];
+    if ((chnkend >= chnkbas) &&                   /* If neighbor colored in this round */
+        (chnkend != chnknum) &&                   /* In another chunk                  */
+        (colotax[vertend] == coloval) &&
+        (GRAPHCOLORPRIOR (randtax, vertend, vertnum)))
+      return (1);
+
+    if ((dataptr->flagval & GRAPHCOLORDIST2) != 0) {
+      const Gnum * restrict edgetx2;
+      Genum                 edgenm2;
+      Genum                 edgennd2;
+
+      edgetx2 = graphEdgeTax (grafptr, vertend, edg2tab);
+      for (edgenm2 = verttax[vertend], edgennd2 = vendtax[vertend]; edgenm2 < edgennd2; edgenm2 ++) {
+        Gnum                vertnd2;
+        Gnum                chnknd2;
+
+        vertnd2 = edgetx2[edgenm2];
+        chnknd2 = chnktax[vertnd2];
+        if ((vertnd2 != vertnum) &&
+            (chnknd2 >= chnkbas) &&
+            (chnknd2 != chnknum) &&
+            (colotax[vertnd2] == coloval) &&
+            (GRAPHCOLORPRIOR (randtax, vertnd2, vertnum)))
+          return (1);
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* This routine is the threaded core of the
+** coloring routine. Every round is made of a
+** decision phase, in which the color array is
+** only written for vertices of the local slice
+** which cannot be read by other threads, and
+** of an update phase, after which the queue of
+** remaining vertices is compacted in order, at
+** indices given by prefix sums.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorThrd (
+ThreadDescriptor * restrict const descptr,
+GraphColorData * restrict const   dataptr)
+{
+  Gnum                vertbas;                    /* Start of slice of vertices */
+  Gnum                vertnnd;                    /* End of slice of vertices   */
+  Gnum                vertnum;
+  Gnum * restrict     queotab;
+  Gnum * restrict     quentab;
+  Gnum                queunbr;
+  Gnum                chnkbas;                    /* Index of first chunk of current round */
+  Gnum                stmpval;
+  Gnum                colonbr;
+  Gnum * restrict     cmrktab;
+  Gnum * restrict     edg1tab;
+  Gnum * restrict     edg2tab;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const int                     thrdnbr = threadNbr (descptr);
+  const int                     thrdnum = threadNum (descptr);
+  GraphColorThread * restrict const thrdptr = &dataptr->thrdtab[thrdnum];
+  const Gnum                    baseval = grafptr->baseval;
+  const Gnum                    vertnbr = grafptr->vertnbr;
+  Gnum * restrict const         colotax = dataptr->colotax;
+  Gnum * restrict const         chnktax = dataptr->chnktax;
+
+  vertbas = baseval + DATASCAN (vertnbr, thrdnbr, thrdnum);
+  vertnnd = baseval + DATASCAN (vertnbr, thrdnbr, thrdnum + 1);
+  edg1tab = thrdptr->edgetab;
+  edg2tab = (edg1tab != NULL) ? (edg1tab + grafptr->degrmax + 1) : NULL;
+
+  queotab = dataptr->queotab;
+  quentab = dataptr->quentab;
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Initial queue holds all vertices in natural order */
+    queotab[vertnum - baseval] = vertnum;
+
+  thrdptr->colonbr =
+  thrdptr->abrtval = 0;
+  cmrktab = NULL;
+  if ((dataptr->flagval & GRAPHCOLORGREEDY) != 0) {
+    Gnum                cmaxnbr;
+
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++)
+      chnktax[vertnum] = (vertnum - baseval) / GRAPHCOLORCHUNKSIZ;
+
+    if ((dataptr->flagval & GRAPHCOLORDIST2) != 0) { /* First-fit color is bounded by size of distance-2 neighborhood */
+      const Genum * restrict const  verttax = grafptr->verttax;
+      const Genum * restrict const  vendtax = grafptr->vendtax;
+
+      for (vertnum = vertbas, cmaxnbr = 0; vertnum < vertnnd; vertnum ++) {
+        const Gnum * restrict edgetax;
+        Genum                 edgenum;
+        Gnum                  degrsum;
+
+        edgetax = graphEdgeTax (grafptr, vertnum, edg1tab);
+        for (edgenum = verttax[vertnum], degrsum = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+          Gnum                vertend;
+
+          vertend  = edgetax[edgenum];
+          degrsum += (Gnum) (vendtax[vertend] - verttax[vertend]);
+        }
+        if (degrsum >= cmaxnbr)
+          cmaxnbr = degrsum + 1;
+      }
+      if (cmaxnbr > vertnbr)
+        cmaxnbr = vertnbr;
+    }
+    else
+      cmaxnbr = grafptr->degrmax + 1;
+
+    thrdptr->cmaxnbr = cmaxnbr;
+    threadReduce (descptr, (void *) thrdptr, sizeof (GraphColorThread), (ThreadReduceFunc) graphColorReduce, 0, NULL);
+    cmaxnbr = dataptr->thrdtab[0].cmaxnbr;
+
+    if ((cmrktab = memAlloc (cmaxnbr * sizeof (Gnum))) == NULL) {
+      errorPrint ("graphColorThrd: out of memory");
+      thrdptr->abrtval = 1;
+    }
+    else
+      memSet (cmrktab, ~0, cmaxnbr * sizeof (Gnum));
+
+    threadReduce (descptr, (void *) thrdptr, sizeof (GraphColorThread), (ThreadReduceFunc) graphColorReduce, 0, NULL);
+    if (dataptr->thrdtab[0].abrtval != 0) {       /* If any thread failed, all of them leave */
+      if (cmrktab != NULL)
+        memFree (cmrktab);
+      return;
+    }
+  }
+  else
+    threadBarrier (descptr);                      /* Initial queue must be complete */
+
+  for (queunbr = vertnbr, chnkbas = stmpval = colonbr = 0; queunbr > 0; ) {
+    Gnum                chnknbr;
+    Gnum                queubas;                  /* Start of slice of queue */
+    Gnum                queunnd;                  /* End of slice of queue   */
+    Gnum                queunum;
+    Gnum                queulos;                  /* Number of vertices left for next round */
+    Gnum * restrict     quettab;
+
+    chnknbr = (queunbr + GRAPHCOLORCHUNKSIZ - 1) / GRAPHCOLORCHUNKSIZ;
+    queubas = MIN (DATASCAN (chnknbr, thrdnbr, thrdnum)     * GRAPHCOLORCHUNKSIZ, queunbr);
+    queunnd = MIN (DATASCAN (chnknbr, thrdnbr, thrdnum + 1) * GRAPHCOLORCHUNKSIZ, queunbr);
+
+    if (cmrktab != NULL) {                        /* If speculative greedy coloring */
+      for (queunum = queubas; queunum < queunnd; queunum ++) {
+        vertnum = queotab[queunum];
+        colotax[vertnum] = graphColorGreedy (dataptr, vertnum, chnkbas, stmpval ++, cmrktab, edg1tab, edg2tab);
+      }
+      threadBarrier (descptr);                    /* All tentative colors must be set before conflicts are sought */
+
+      for (queunum = queulos = queubas; queunum < queunnd; queunum ++) {
+        vertnum = queotab[queunum];
+        if (graphColorConflict (dataptr, vertnum, chnkbas, edg1tab, edg2tab) != 0)
+          queotab[queulos ++] = vertnum;          /* Compact local slice of queue in place */
+        else if (colotax[vertnum] >= colonbr)
+          colonbr = colotax[vertnum] + 1;
+      }
+    }
+    else {                                        /* Luby rounds */
+      Gnum                queuwin;
+
+      for (queunum = queulos = queuwin = queubas; queunum < queunnd; queunum ++) {
+        vertnum = queotab[queunum];
+        if (graphColorLuby (dataptr, vertnum, edg1tab, edg2tab) != 0)
+          quentab[queuwin ++] = vertnum;          /* Record winners in other queue */
+        else
+          queotab[queulos ++] = vertnum;
+      }
+      threadBarrier (descptr);                    /* Winners can only be colored once all decisions are made */
+
+      for (queunum = queubas; queunum < queuwin; queunum ++)
+        colotax[quentab[queunum]] = colonbr;
+      colonbr ++;                                 /* One color per round */
+    }
+    queulos -= queubas;
+
+    thrdptr->scantab[0] = queulos;
+    threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphColorThread), (ThreadScanFunc) graphColorScan, NULL); /* Get start index of local vertices in next queue */
+    if (thrdnum == (thrdnbr - 1))                 /* Last thread knows the size of the next queue */
+      dataptr->queunbr = thrdptr->scantab[0];
+
+    chnkbas += chnknbr;                           /* Chunk indices of next round will all be new */
+    for (queunum = thrdptr->scantab[0] - queulos, queulos += queubas; queubas < queulos; queubas ++, queunum ++) {
+      vertnum = queotab[queubas];
+      quentab[queunum] = vertnum;
+      if (cmrktab != NULL) {                      /* Reset tentative color of vertex */
+        colotax[vertnum] = ~0;
+        chnktax[vertnum] = chnkbas + queunum / GRAPHCOLORCHUNKSIZ;
+      }
+    }
+    threadBarrier (descptr);                      /* Next queue must be complete */
+
+    queunbr = dataptr->queunbr;
+    quettab = queotab;                            /* Swap queues */
+    queotab = quentab;
+    quentab = quettab;
+  }
+
+  if (cmrktab != NULL)
+    memFree (cmrktab);
+
+  thrdptr->colonbr = colonbr;
+  threadReduce (descptr, (void *) thrdptr, sizeof (GraphColorThread), (ThreadReduceFunc) graphColorReduce, 0, NULL); /* Get number of colors into first thread block */
+}
+
+/* This routine computes a coloring of the
+** given graph, using all the threads of the
+** given context. Vertex priorities are drawn
+** sequentially from the random generator of
+** the context, so that colorings only depend
+** on its state.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphColor (
+const Graph * restrict const  grafptr,            /* Graph to color                */
+Gnum * restrict const         colotax,            /* Color array [based]           */
+Gnum * restrict const         coloptr,            /* Pointer to number of colors   */
+const int                     flagval,            /* Coloring flags                */
+Context * restrict const      contptr)            /* Execution context             */
+{
+  GraphColorData      datadat;
+  GraphColorThread *  thrdtab;
+  Gnum *              chnktab;
+  Gnum *              randtax;
+  Gnum *              edgetab;
+  Gnum                edgesiz;                    /* Size of decoding buffers of each thread */
+  Gnum                vertnum;
+  Gnum                vertnnd;
+  int                 thrdnum;
+  int                 o;
+
+  const Gnum          baseval = grafptr->baseval;
+  const Gnum          vertnbr = grafptr->vertnbr;
+  const int           thrdnbr = contextThreadNbr (contptr);
+
+  memSet (colotax + baseval, ~0, vertnbr * sizeof (Gnum));
+  if (vertnbr <= 0) {
+    *coloptr = 0;
+    return (0);
+  }
+
+  edgesiz = (grafptr->edgetax == NULL) ? (2 * (grafptr->degrmax + 1)) : 0;
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.queotab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &datadat.quentab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &randtax,         (size_t) (vertnbr * sizeof (Gnum)),
+                     &chnktab,         (size_t) ((((flagval & GRAPHCOLORGREEDY) != 0) ? vertnbr : 0) * sizeof (Gnum)),
+                     &thrdtab,         (size_t) (thrdnbr * sizeof (GraphColorThread)),
+                     &edgetab,         (size_t) (thrdnbr * edgesiz * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphColor: out of memory");
+    return (1);
+  }
+  randtax -= baseval;
+
+  for (vertnum = baseval, vertnnd = vertnbr + baseval; vertnum < vertnnd; vertnum ++)
+    randtax[vertnum] = contextIntRandVal (contptr, 32768);
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    thrdtab[thrdnum].edgetab = (edgesiz > 0) ? (edgetab + thrdnum * edgesiz) : NULL;
+
+  datadat.grafptr = grafptr;
+  datadat.colotax = colotax;
+  datadat.randtax = randtax;
+  datadat.chnktax = chnktab - baseval;
+  datadat.flagval = flagval;
+  datadat.thrdtab = thrdtab;
+
+  contextThreadLaunch (contptr, (ThreadFunc) graphColorThrd, (void *) &datadat);
+
+  o = (int) thrdtab[0].abrtval;
+  *coloptr = thrdtab[0].colonbr;
+
+  memFree (datadat.queotab);                      /* Free group leader */
+
+  return (o);
+}
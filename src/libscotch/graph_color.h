@@ -0,0 +1,112 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_color.h                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the multithreaded graph coloring    **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Coloring flags. They must match the
+    values of the SCOTCH_COLOR* flags.  +*/
+
+#define GRAPHCOLORNONE              0x0000        /* Luby rounds, distance 1        */
+#define GRAPHCOLORGREEDY            0x0001        /* Speculative greedy with repair */
+#define GRAPHCOLORDIST2             0x0002        /* Distance-2 coloring            */
+
+/*+ Size of the chunks of the vertex queue
+    which are colored sequentially by the
+    speculative greedy method. It does not
+    depend on the number of threads, so that
+    colorings are reproducible.              +*/
+
+#define GRAPHCOLORCHUNKSIZ          1024
+
+/*+ Priority comparison between two vertices,
+    ties being broken by vertex index.        +*/
+
+#define GRAPHCOLORPRIOR(r,v,w)      (((r)[v] > (r)[w]) || (((r)[v] == (r)[w]) && ((v) > (w))))
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphColorThread_ {
+  Gnum                      cmaxnbr;              /*+ Size of color marking array                   +*/
+  Gnum                      colonbr;              /*+ Number of colors used                         +*/
+  Gnum                      abrtval;              /*+ Abort flag                                    +*/
+  Gnum *                    edgetab;              /*+ Decoding buffers for compressed graph         +*/
+  Gnum                      scantab[2];           /*+ Scan area for queue indices                   +*/
+} GraphColorThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct GraphColorData_ {
+  const Graph *             grafptr;              /*+ Graph to color                           +*/
+  Gnum *                    colotax;              /*+ Color array                              +*/
+  const Gnum *              randtax;              /*+ Vertex priority array                    +*/
+  Gnum *                    chnktax;              /*+ Chunk index array, for greedy coloring   +*/
+  Gnum *                    queotab;              /*+ Queue of uncolored vertices              +*/
+  Gnum *                    quentab;              /*+ Queue of next round                      +*/
+  Gnum                      queunbr;              /*+ Size of queue of next round, once known  +*/
+  int                       flagval;              /*+ Coloring flags                           +*/
+  GraphColorThread *        thrdtab;              /*+ Array of thread-specific data blocks     +*/
+} GraphColorData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_COLOR
+static void                 graphColorScan      (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+static void                 graphColorReduce    (GraphColorThread * restrict const, GraphColorThread * restrict const, const void * const);
+static int                  graphColorLuby      (const GraphColorData * restrict const, const Gnum, Gnum * restrict const, Gnum * restrict const);
+static Gnum                 graphColorGreedy    (const GraphColorData * restrict const, const Gnum, const Gnum, const Gnum, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const);
+static int                  graphColorConflict  (const GraphColorData * restrict const, const Gnum, const Gnum, Gnum * restrict const, Gnum * restrict const);
+static void                 graphColorThrd      (ThreadDescriptor * restrict const, GraphColorData * restrict const);
+#endif /* SCOTCH_GRAPH_COLOR */
+
+int                         graphColor          (const Graph * restrict const, Gnum * restrict const, Gnum * restrict const, const int, Context * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2017,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2017,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 31 mar 2021     **/
 /**                                 to   : 31 mar 2021     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -52,10 +52,13 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_GRAPH_DIAM
+
 #include "module.h"
 #include "common.h"
 #include "graph.h"
 #include "fibo.h"
+#include "graph_bfs.h"
 #include "graph_diam.h"
 
 /***************************************/
@@ -84,50 +87,218 @@ const FiboNode *            nod1ptr)
   return (1);
 }
 
-/* This routine computes the vertex-traversal,
-** edge-weighted pseudo-diameter of the given
-** graph. It is equal to GNUMMAX if the graph
-** is not connected.
-** It returns:
-** - >= 0  : weighted pseudo-diameter.
-** - -1    : on error.
+/* These routines perform pseudo-diameter
+** sweeps from the given root vertex, the
+** farthest vertex of each sweep being the root
+** of the next one, as long as the eccentricity
+** increases. They return the weighted pseudo-
+** diameter, GNUMMAX if the graph is not connected,
+** and -1 on error.
+** With no vertex nor edge loads, sweeps are
+** multithreaded breadth-first searches, the next
+** root being the smallest vertex of the last level.
+** With small non-negative loads, sweeps use a
+** circular bucket queue, the next root being the
+** smallest vertex at maximum distance. Else, they
+** use a Fibonacci heap.
 */
 
+static
 Gnum
-graphDiamPV (
-const Graph * const         grafptr,
-Context * restrict const    contptr)
+graphDiamBfs (
+const Graph * restrict const  grafptr,
+Gnum                          rootnum,
+Context * restrict const      contptr)
+{
+  Gnum * restrict     levltax;
+  Gnum                diammax;
+  Gnum                diambst;
+
+  if ((levltax = (Gnum *) memAlloc (grafptr->vertnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("graphDiamBfs: out of memory");
+    return     (-1);
+  }
+  levltax -= grafptr->baseval;
+
+  diammax = 0;
+  do {
+    Gnum                vertnbr;
+    Gnum                levlnum;
+    Gnum                vertmin;
+
+    diambst = diammax;                            /* Record as starting value for this pass */
+
+    if (graphBfs (grafptr, 1, &rootnum, GNUMMAX, levltax, NULL, &vertnbr, &levlnum, &vertmin, contptr) != 0) {
+      errorPrint ("graphDiamBfs: cannot perform sweep");
+      diambst = -1;
+      break;
+    }
+    if (vertnbr != grafptr->vertnbr) {            /* If graph is not connected */
+      diambst = GNUMMAX;
+      break;
+    }
+    if (diammax < levlnum) {
+      diammax = levlnum;
+      rootnum = vertmin;
+    }
+  } while (diambst < diammax);
+
+  memFree (levltax + grafptr->baseval);
+
+  return (diambst);
+}
+
+static
+Gnum
+graphDiamDial (
+const Graph * restrict const  grafptr,
+Gnum                          rootnum,
+const Gnum                    wghtmax)            /* Maximum weight of an arc */
+{
+  GraphDiamDialVertex * restrict  vexxtax;        /* Extended vertex array                  */
+  Gnum * restrict                 bucktab;        /* Array of bucket heads                  */
+  Gnum * restrict                 edgetab;        /* Decoding buffer for compressed graph   */
+  Gnum                            diammax;
+  Gnum                            diambst;
+
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const edlotax = grafptr->edlotax;
+  const Gnum                  bucknbr = wghtmax + 1; /* Pending distances span at most wghtmax + 1 values */
+
+  if (memAllocGroup ((void **) (void *)
+                     &vexxtax, (size_t) (grafptr->vertnbr * sizeof (GraphDiamDialVertex)),
+                     &bucktab, (size_t) (bucknbr          * sizeof (Gnum)),
+                     &edgetab, (size_t) (((grafptr->edgetax == NULL) ? grafptr->degrmax : 0) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphDiamDial: out of memory");
+    return     (-1);
+  }
+  vexxtax -= grafptr->baseval;
+
+  diammax = 0;
+  do {
+    Gnum                vertnum;
+    Gnum                vertnbr;
+    Gnum                pendnbr;                  /* Number of vertices in buckets */
+    Gnum                distcur;
+    Gnum                distmax;
+    Gnum                vertmax;
+
+    diambst = diammax;                            /* Record as starting value for this pass */
+
+    for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) /* Reset work arrays */
+      vexxtax[vertnum].distval = GNUMMAX;
+    memSet (bucktab, ~0, bucknbr * sizeof (Gnum));
+
+    vexxtax[rootnum].distval = 0;
+    vexxtax[rootnum].prevnum =
+    vexxtax[rootnum].nextnum = ~0;
+    bucktab[0] = rootnum;
+
+    for (distcur = distmax = 0, vertmax = rootnum, vertnbr = 0, pendnbr = 1; pendnbr > 0; distcur ++) {
+      Gnum * const        buckptr = bucktab + (distcur % bucknbr);
+
+      while ((vertnum = *buckptr) != ~0) {        /* Vertices of zero-weight arcs may be appended while scanning */
+        const Gnum * restrict edgetax;
+        Gnum                  distval;
+        Genum                 edgenum;
+
+        *buckptr = vexxtax[vertnum].nextnum;      /* Unlink vertex from head of bucket */
+        if (*buckptr != ~0)
+          vexxtax[*buckptr].prevnum = ~0;
+        pendnbr --;
+        vertnbr ++;
+
+        if (distcur > distmax) {                  /* Keep smallest vertex at maximum distance */
+          distmax = distcur;
+          vertmax = vertnum;
+        }
+        else if ((distcur == distmax) && (vertnum < vertmax))
+          vertmax = vertnum;
+
+        distval = distcur + ((velotax != NULL) ? velotax[vertnum] : 0); /* Add node weight as it is being traversed */
+        edgetax = graphEdgeTax (grafptr, vertnum, edgetab); /* Decode adjacency if compressed */
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+          GraphDiamDialVertex * vexxpnd;
+          Gnum                  vertend;
+          Gnum                  disttmp;
+          Gnum                  distold;
+
+          vertend = edgetax[edgenum];
+          vexxpnd = vexxtax + vertend;
+          disttmp = distval + ((edlotax != NULL) ? edlotax[edgenum] : 1);
+          distold = vexxpnd->distval;
+          if (disttmp >= distold)                 /* Always the case for already processed vertices */
+            continue;
+
+          if (distold == GNUMMAX)                 /* If newly touched vertex */
+            pendnbr ++;
+          else {                                  /* Else unlink it from its former bucket */
+            if (vexxpnd->prevnum != ~0)
+              vexxtax[vexxpnd->prevnum].nextnum = vexxpnd->nextnum;
+            else
+              bucktab[distold % bucknbr] = vexxpnd->nextnum;
+            if (vexxpnd->nextnum != ~0)
+              vexxtax[vexxpnd->nextnum].prevnum = vexxpnd->prevnum;
+          }
+          vexxpnd->distval = disttmp;             /* Link vertex at head of its new bucket */
+          vexxpnd->prevnum = ~0;
+          vexxpnd->nextnum = bucktab[disttmp % bucknbr];
+          if (vexxpnd->nextnum != ~0)
+            vexxtax[vexxpnd->nextnum].prevnum = vertend;
+          bucktab[disttmp % bucknbr] = vertend;
+        }
+      }
+    }
+
+    if (vertnbr != grafptr->vertnbr) {            /* If graph is not connected */
+      diambst = GNUMMAX;
+      break;
+    }
+    if (diammax < distmax) {
+      diammax = distmax;
+      rootnum = vertmax;
+    }
+  } while (diambst < diammax);
+
+  memFree (vexxtax + grafptr->baseval);           /* Free group leader */
+
+  return (diambst);
+}
+
+static
+Gnum
+graphDiamFibo (
+const Graph * restrict const  grafptr,
+Gnum                          rootnum)
 {
   FiboHeap                    fibodat;
-  GraphDiamVertex * restrict  vexxtax;            /* Extended vertex array */
+  GraphDiamVertex * restrict  vexxtax;            /* Extended vertex array                */
+  Gnum * restrict             edgetab;            /* Decoding buffer for compressed graph */
   Gnum                        vertnum;
-  Gnum                        rootnum;
   Gnum                        diammax;
   Gnum                        diambst;
 
-  const Gnum * restrict const verttax = grafptr->verttax;
-  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
   const Gnum * restrict const velotax = grafptr->velotax;
-  const Gnum * restrict const edgetax = grafptr->edgetax;
   const Gnum * restrict const edlotax = grafptr->edlotax;
 
-  if (grafptr->vertnbr <= 0)                      /* Diameter of empty graphs is zero */
-    return (0);
-
-  if ((vexxtax = (GraphDiamVertex *) memAlloc (grafptr->vertnbr * sizeof (GraphDiamVertex))) == NULL) {
-    errorPrint ("graphWdiam: out of memory");
+  if (memAllocGroup ((void **) (void *)
+                     &vexxtax, (size_t) (grafptr->vertnbr * sizeof (GraphDiamVertex)),
+                     &edgetab, (size_t) (((grafptr->edgetax == NULL) ? grafptr->degrmax : 0) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphDiamFibo: out of memory");
     return     (-1);
   }
   if (fiboHeapInit (&fibodat, graphDiamCmpFunc) != 0) {
-    errorPrint ("graphWdiam: cannot initialize Fibonacci heap");
+    errorPrint ("graphDiamFibo: cannot initialize Fibonacci heap");
     memFree    (vexxtax);
     return     (-1);
   }
   vexxtax -= grafptr->baseval;
 
-  rootnum = contextIntRandVal (contptr, grafptr->vertnbr) + grafptr->baseval;
   diammax = 0;                                    /* Ensure at least one pass */
-
   do {
     GraphDiamVertex *   vexxptr;
     Gnum                vertnbr;
@@ -144,9 +315,10 @@ Context * restrict const    contptr)
 
     vertnbr = 0;
     while ((vexxptr = (GraphDiamVertex *) fiboHeapMin (&fibodat)) != NULL) { /* As long as there's a vertex to extract */
-      Gnum                vertnum;
-      Gnum                distval;
-      Gnum                edgenum;
+      const Gnum * restrict edgetax;
+      Gnum                  vertnum;
+      Gnum                  distval;
+      Genum                 edgenum;
 
       vertnbr ++;                                 /* One more vertex processed        */
       fiboHeapDel (&fibodat, (FiboNode *) vexxptr); /* Remove it from heap            */
@@ -161,6 +333,8 @@ Context * restrict const    contptr)
       if (velotax != NULL)                        /* Add node weight as it is being traversed */
         distval += velotax[vertnum];
 
+      edgetax = graphEdgeTax (grafptr, vertnum, edgetab); /* Decode adjacency if compressed */
+
       for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
         GraphDiamVertex *   vexxpnd;
         Gnum                vertend;
@@ -196,3 +370,67 @@ abort:
 
   return (diambst);
 }
+
+/* This routine computes the vertex-traversal,
+** edge-weighted pseudo-diameter of the given
+** graph. It is equal to GNUMMAX if the graph
+** is not connected.
+** It returns:
+** - >= 0  : weighted pseudo-diameter.
+** - -1    : on error.
+*/
+
+Gnum
+graphDiamPV (
+const Graph * const         grafptr,
+Context * restrict const    contptr)
+{
+  Gnum                vertnum;
+  Gnum                rootnum;
+  Gnum                velomin;
+  Gnum                velomax;
+  Gnum                edlomin;
+  Gnum                edlomax;
+
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const edlotax = grafptr->edlotax;
+
+  if (grafptr->vertnbr <= 0)                      /* Diameter of empty graphs is zero */
+    return (0);
+
+  rootnum = contextIntRandVal (contptr, grafptr->vertnbr) + grafptr->baseval;
+
+  if ((velotax == NULL) && (edlotax == NULL))     /* If plain graph, use breadth-first search */
+    return (graphDiamBfs (grafptr, rootnum, contptr));
+
+  velomin =
+  velomax = 0;
+  if (velotax != NULL) {
+    for (vertnum = grafptr->baseval, velomin = GNUMMAX, velomax = 0; vertnum < grafptr->vertnnd; vertnum ++) {
+      if (velotax[vertnum] < velomin)
+        velomin = velotax[vertnum];
+      if (velotax[vertnum] > velomax)
+        velomax = velotax[vertnum];
+    }
+  }
+  edlomin =
+  edlomax = 1;
+  if (edlotax != NULL) {
+    Genum               edgenum;
+
+    for (vertnum = grafptr->baseval, edlomin = GNUMMAX, edlomax = 0; vertnum < grafptr->vertnnd; vertnum ++) {
+      for (edgenum = grafptr->verttax[vertnum]; edgenum < grafptr->vendtax[vertnum]; edgenum ++) {
+        if (edlotax[edgenum] < edlomin)
+          edlomin = edlotax[edgenum];
+        if (edlotax[edgenum] > edlomax)
+          edlomax = edlotax[edgenum];
+      }
+    }
+  }
+
+  if ((velomin >= 0) && (edlomin >= 0) &&         /* If arc weights are small enough, use bucket queue */
+      (velomax <= GRAPHDIAMDIALMAX) && (edlomax <= (GRAPHDIAMDIALMAX - velomax)))
+    return (graphDiamDial (grafptr, rootnum, velomax + edlomax));
+
+  return (graphDiamFibo (grafptr, rootnum));
+}
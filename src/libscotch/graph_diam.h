@@ -41,9 +41,22 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 17 jan 2017     **/
 /**                                 to   : 17 jan 2017     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Maximum weight of an arc, that is, sum
+    of vertex and edge loads, for which the
+    bucket queue is used instead of the
+    Fibonacci heap.                          +*/
+
+#define GRAPHDIAMDIALMAX            1024
+
 /*
 **  The type and structure definitions.
 */
@@ -54,3 +67,25 @@ typedef struct GraphDiamVertex_ {
   FiboNode                  fibodat;              /*+ Fibonacci heap node structure +*/
   Gnum                      distval;              /*+ Current distance value        +*/
 } GraphDiamVertex;
+
+/*+ Bucket queue vertex structure. Vertices
+    of the same distance modulo the number of
+    buckets are chained in a doubly linked
+    list.                                     +*/
+
+typedef struct GraphDiamDialVertex_ {
+  Gnum                      distval;              /*+ Current distance value        +*/
+  Gnum                      prevnum;              /*+ Previous vertex in bucket     +*/
+  Gnum                      nextnum;              /*+ Next vertex in bucket         +*/
+} GraphDiamDialVertex;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_DIAM
+static int                  graphDiamCmpFunc    (const FiboNode *, const FiboNode *);
+static Gnum                 graphDiamBfs        (const Graph * restrict const, Gnum, Context * restrict const);
+static Gnum                 graphDiamDial       (const Graph * restrict const, Gnum, const Gnum);
+static Gnum                 graphDiamFibo       (const Graph * restrict const, Gnum);
+#endif /* SCOTCH_GRAPH_DIAM */
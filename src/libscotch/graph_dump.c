@@ -1,4 +1,4 @@
-/* Copyright 2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 27 dec 2019     **/
 /**                                 to   : 29 dec 2019     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,7 +69,7 @@ FILE * const                fileptr)              /* Output stream */
 {
   int                 o;
 
-  o  = graphDumpArrays (grafptr, "Gnum", prefptr, suffptr, fileptr); /* Dump data arrays */
+  o  = graphDumpArrays (grafptr, "Gnum", "Genum", prefptr, suffptr, fileptr); /* Dump data arrays */
   o |= (fprintf (fileptr,
                  "void\n"
                  "%sGraphBuild%s (\n"
@@ -121,7 +121,7 @@ FILE * const                fileptr)              /* Output stream       */
                    dataptr, prefptr, suffptr, grafptr->baseval) < 0);
   o |= (fprintf (fileptr,
                  "  %svelosum = " GNUMSTRING ";\n"
-                 "  %sedgenbr = " GNUMSTRING ";\n"
+                 "  %sedgenbr = " GENUMSTRING ";\n"
                  "  %sedgetax = %sedgetab%s - " GNUMSTRING ";\n",
                  dataptr, grafptr->velosum,
                  dataptr, grafptr->edgenbr,
@@ -148,14 +148,14 @@ FILE * const                fileptr)              /* Output stream       */
 int
 graphDumpArray (
 const Gnum * const          datatab,
-const Gnum                  datanbr,
+const Genum                 datanbr,
 const char * const          tyinptr,              /* Integer type name */
 const char * const          prefptr,              /* Prefix name       */
 const char * const          nameptr,              /* Infix name        */
 const char * const          suffptr,              /* Suffix name       */
 FILE * const                fileptr)
 {
-  Gnum                datanum;
+  Genum               datanum;
 
   if (fprintf (fileptr, "%s %s%s%s[] = {",
                tyinptr, prefptr, nameptr, suffptr) < 0)
@@ -176,33 +176,71 @@ FILE * const                fileptr)
   return (0);
 }
 
-/* This routine dumps graph data arrays
+/* This routine dumps an edge index array
 ** on the form of C source code.
 ** - 0   : on success.
 ** - !0  : on error.
 */
 
 int
-graphDumpArrays (
-const Graph * const         grafptr,              /* Graph to dump     */
+graphDumpArrayEdge (
+const Genum * const         datatab,
+const Genum                 datanbr,
 const char * const          tyinptr,              /* Integer type name */
 const char * const          prefptr,              /* Prefix name       */
+const char * const          nameptr,              /* Infix name        */
 const char * const          suffptr,              /* Suffix name       */
-FILE * const                fileptr)              /* Output stream     */
+FILE * const                fileptr)
+{
+  Genum               datanum;
+
+  if (fprintf (fileptr, "%s %s%s%s[] = {",
+               tyinptr, prefptr, nameptr, suffptr) < 0)
+    return (1);
+  for (datanum = 0; datanum < (datanbr - 1); datanum ++) {
+    if (fprintf (fileptr, "%s" GENUMSTRING ",",
+	         (((datanum % 16) == 0) ? "\n  " : " "), datatab[datanum]) < 0)
+      return (1);
+  }
+  if (datanbr > 0) {
+    if (fprintf (fileptr, "%s" GENUMSTRING,
+	         (((datanum % 16) == 0) ? "\n  " : " "), datatab[datanum]) < 0)
+      return (1);
+  }
+  if (fprintf (fileptr, "\n};\n\n") < 0)
+    return (1);
+
+  return (0);
+}
+
+/* This routine dumps graph data arrays
+** on the form of C source code.
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphDumpArrays (
+const Graph * const         grafptr,              /* Graph to dump     */
+const char * const          tyinptr,              /* Integer type name    */
+const char * const          tyenptr,              /* Edge index type name */
+const char * const          prefptr,              /* Prefix name          */
+const char * const          suffptr,              /* Suffix name          */
+FILE * const                fileptr)              /* Output stream        */
 {
   int                 o;
 
   const Gnum                        baseval = grafptr->baseval;
   const Gnum                        vertnbr = grafptr->vertnbr;
-  const Gnum                        edgenbr = grafptr->edgenbr;
+  const Genum                       edgenbr = grafptr->edgenbr;
 
   o = 0;
   if (grafptr->vendtax != (grafptr->verttax + 1)) {
-    o |= graphDumpArray (grafptr->verttax + baseval, vertnbr, tyinptr, prefptr, "verttab", suffptr, fileptr);
-    o |= graphDumpArray (grafptr->vendtax + baseval, vertnbr, tyinptr, prefptr, "vendtab", suffptr, fileptr);
+    o |= graphDumpArrayEdge (grafptr->verttax + baseval, vertnbr, tyenptr, prefptr, "verttab", suffptr, fileptr);
+    o |= graphDumpArrayEdge (grafptr->vendtax + baseval, vertnbr, tyenptr, prefptr, "vendtab", suffptr, fileptr);
   }
   else
-    o |= graphDumpArray (grafptr->verttax + baseval, vertnbr + 1, tyinptr, prefptr, "verttab", suffptr, fileptr);
+    o |= graphDumpArrayEdge (grafptr->verttax + baseval, vertnbr + 1, tyenptr, prefptr, "verttab", suffptr, fileptr);
   if (grafptr->velotax != NULL)
     o |= graphDumpArray (grafptr->velotax + baseval, vertnbr, tyinptr, prefptr, "velotab", suffptr, fileptr);
   if (grafptr->vlbltax != NULL)
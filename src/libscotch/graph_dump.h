@@ -49,5 +49,6 @@
 
 int graphDump                                   (const Graph * const, const char * const, const char * const, FILE * const);
 int graphDump2                                  (const Graph * const, const char * const, const char * const, const char * const, FILE * const);
-int graphDumpArray                              (const Gnum * const, const Gnum, const char * const, const char * const, const char * const, const char * const, FILE * const);
-int graphDumpArrays                             (const Graph * const, const char * const, const char * const, const char * const, FILE * const);
+int graphDumpArray                              (const Gnum * const, const Genum, const char * const, const char * const, const char * const, const char * const, FILE * const);
+int graphDumpArrayEdge                          (const Genum * const, const Genum, const char * const, const char * const, const char * const, const char * const, FILE * const);
+int graphDumpArrays                             (const Graph * const, const char * const, const char * const, const char * const, const char * const, FILE * const);
@@ -1,4 +1,4 @@
-/* Copyright 2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 28 dec 2016     **/
 /**                                 to   : 31 may 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code derives from that of        **/
 /**                  arch_build.c.                         **/
@@ -84,14 +84,14 @@ Gnum * const                ielotax)              /* Pointer to inverse edge loa
   float               prodval;
 
   const Gnum                  vertnnd = grafptr->vertnnd;
-  const Gnum * restrict const verttax = grafptr->verttax;
-  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
 
   edlomin = GNUMMAX;
   edlomax = 0;
   for (vertnum = grafptr->baseval; vertnum < vertnnd; vertnum ++) { /* Handle non-compact graphs as well as compact graphs */
-    Gnum                  edgenum;
-    Gnum                  edgennd;
+    Genum                 edgenum;
+    Genum                 edgennd;
 
     for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
          edgenum < edgennd; edgenum ++) {
@@ -111,8 +111,8 @@ Gnum * const                ielotax)              /* Pointer to inverse edge loa
 
   edlosum = 0;
   for (vertnum = grafptr->baseval; vertnum < vertnnd; vertnum ++) {
-    Gnum                  edgenum;
-    Gnum                  edgennd;
+    Genum                 edgenum;
+    Genum                 edgennd;
 
     for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
          edgenum < edgennd; edgenum ++) {
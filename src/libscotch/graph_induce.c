@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2009,2011,2013-2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2009,2011,2013-2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -60,7 +60,7 @@
 /**                # Version 6.0  : from : 29 mar 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Several algorithms, such as the       **/
 /**                  active graph building routine of      **/
@@ -106,21 +106,55 @@ const Graph * restrict const    orggrafptr,
 const Gnum                      indvnumnbr,
 const Gnum * restrict const     indvnumtab,
 Graph * restrict const          indgrafptr)
+{
+  return (graphInduceList2 (orggrafptr, indvnumnbr, indvnumtab, indgrafptr, NULL));
+}
+
+/* This routine builds the graph induced
+** by the original graph and the list of
+** selected vertices, in the same way as
+** graphInduceList(). If an execution context
+** is provided and the original graph is
+** large enough, induction is performed by
+** all the threads of the context.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphInduceList2 (
+const Graph * restrict const    orggrafptr,
+const Gnum                      indvnumnbr,
+const Gnum * restrict const     indvnumtab,
+Graph * restrict const          indgrafptr,
+Context * const                 contptr)          /* Execution context, or NULL */
 {
   Gnum * restrict       orgindxtax;               /* Based access to vertex translation array       */
   Gnum                  indvertnnd;
   Gnum                  indvertnum;               /* Number of current vertex in induced graph      */
   const Gnum * restrict indvnumtax;
-  Gnum                  indedgenbr;               /* (Approximate) number of edges in induced graph */
+  Genum                 indedgenbr;               /* (Approximate) number of edges in induced graph */
 
-  const Gnum * restrict const orgverttax = orggrafptr->verttax;
-  const Gnum * restrict const orgvendtax = orggrafptr->vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->vendtax;
 
-  if (graphInduce2 (orggrafptr, indgrafptr, indvnumnbr) != 0) {
-    errorPrint ("graphInduceList: cannot create induced graph");
+  if (graphInduce2 (orggrafptr, indgrafptr, indvnumnbr, NULL) != 0) {
+    errorPrint ("graphInduceList2: cannot create induced graph");
     return     (1);
   }
 
+  if (graphInduceThrd (orggrafptr, contptr) != 0) { /* If induction is worth being multithreaded */
+    GraphInduceData     indudat;
+
+    indudat.orggrafptr = orggrafptr;
+    indudat.indgrafptr = indgrafptr;
+    indudat.orgparttax = NULL;                    /* Induction from vertex list */
+    indudat.indvnumtab = indvnumtab;
+
+    return (graphInduceThrd2 (&indudat, NULL, contptr));
+  }
+
   memCpy (indgrafptr->vnumtax + indgrafptr->baseval, /* Copy vertex number array from list */
           indvnumtab, indvnumnbr * sizeof (Gnum));
 
@@ -138,7 +172,7 @@ Graph * restrict const          indgrafptr)
     indedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum];
   }
 
-  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr));
+  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr, NULL));
 }
 
 /* This routine builds the graph induced
@@ -160,21 +194,62 @@ const GraphPart * const       orgparttax,         /* Based array of vertex parti
 const Gnum                    indvnumnbr,         /* Number of vertices in selected part   */
 const GraphPart               indpartval,         /* Partition value of vertices to keep   */
 Graph * restrict const        indgrafptr)         /* Pointer to induced subgraph           */
+{
+  return (graphInducePart2 (orggrafptr, orgparttax, indvnumnbr, indpartval, indgrafptr, NULL, NULL));
+}
+
+/* This routine builds the graph induced
+** by the original graph and the vector of
+** selected vertices, in the same way as
+** graphInducePart(). If a memory arena is
+** provided, the arrays of the induced graph
+** are allocated on top of it, and will only
+** be freed when the arena is released past
+** them; else, they are allocated on the heap.
+** If an execution context is provided and
+** the original graph is large enough,
+** induction is performed by all the threads
+** of the context.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphInducePart2 (
+const Graph * restrict const  orggrafptr,         /* Pointer to original graph             */
+const GraphPart * const       orgparttax,         /* Based array of vertex partition flags */
+const Gnum                    indvnumnbr,         /* Number of vertices in selected part   */
+const GraphPart               indpartval,         /* Partition value of vertices to keep   */
+Graph * restrict const        indgrafptr,         /* Pointer to induced subgraph           */
+MemArena * const              arenptr,            /* Memory arena to use, or NULL for heap */
+Context * const               contptr)            /* Execution context, or NULL            */
 {
   Gnum * restrict     orgindxtax;                 /* Based access to vertex translation array       */
   Gnum                orgvertnum;
   Gnum                indvertnum;                 /* Number of current vertex in induced graph      */
   Gnum * restrict     indvnumtax;
-  Gnum                indedgenbr;                 /* (Approximate) number of edges in induced graph */
+  Genum               indedgenbr;                 /* (Approximate) number of edges in induced graph */
 
-  const Gnum * restrict const orgverttax = orggrafptr->verttax;
-  const Gnum * restrict const orgvendtax = orggrafptr->vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->vendtax;
 
-  if (graphInduce2 (orggrafptr, indgrafptr, indvnumnbr) != 0) {
-    errorPrint ("graphInducePart: cannot create induced graph");
+  if (graphInduce2 (orggrafptr, indgrafptr, indvnumnbr, arenptr) != 0) {
+    errorPrint ("graphInducePart2: cannot create induced graph");
     return     (1);
   }
 
+  if (graphInduceThrd (orggrafptr, contptr) != 0) { /* If induction is worth being multithreaded */
+    GraphInduceData     indudat;
+
+    indudat.orggrafptr = orggrafptr;
+    indudat.indgrafptr = indgrafptr;
+    indudat.orgparttax = orgparttax;              /* Induction from part array */
+    indudat.indpartval = indpartval;
+
+    return (graphInduceThrd2 (&indudat, arenptr, contptr));
+  }
+
   orgindxtax = indgrafptr->edlotax;
   indvnumtax = indgrafptr->vnumtax;
   for (orgvertnum = indvertnum = orggrafptr->baseval, indedgenbr = 0; /* Fill index array */
@@ -190,13 +265,13 @@ Graph * restrict const        indgrafptr)         /* Pointer to induced subgraph
   }
 #ifdef SCOTCH_DEBUG_GRAPH2
   if ((indvertnum - indgrafptr->baseval) != indvnumnbr) {
-    errorPrint ("graphInducePart: inconsistent data");
+    errorPrint ("graphInducePart2: inconsistent data");
     graphExit  (indgrafptr);
     return     (1);
   }
 #endif /* SCOTCH_DEBUG_GRAPH2 */
 
-  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr));
+  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr, arenptr));
 }
 
 /* This routine initializes the induced
@@ -211,34 +286,38 @@ int
 graphInduce2 (
 const Graph * restrict const  orggrafptr,         /* Pointer to original graph           */
 Graph * restrict const        indgrafptr,         /* Pointer to induced graph            */
-const Gnum                    indvertnbr)         /* Number of vertices in induced graph */
+const Gnum                    indvertnbr,         /* Number of vertices in induced graph */
+MemArena * const              arenptr)            /* Memory arena to use, or NULL        */
 {
-  Gnum                  indedgenbr;               /* (Approximate) number of edges in induced graph */
+  Genum                 indedgenbr;               /* (Approximate) number of edges in induced graph */
+  size_t                indvelosiz;
 
   const Gnum                baseval = orggrafptr->baseval; /* Fast accesses */
 
   memSet (indgrafptr, 0, sizeof (Graph));         /* Initialize graph fields */
-  indgrafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+  indgrafptr->flagval = (arenptr == NULL)         /* Arrays in arena are released by its owner */
+                        ? (GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP)
+                        : (GRAPHVERTGROUP | GRAPHEDGEGROUP);
   indgrafptr->baseval = baseval;
 
-  if (orggrafptr->velotax != NULL) {
-    if (memAllocGroup ((void **) (void *)
-                       &indgrafptr->verttax, (size_t) ((indvertnbr + 1) * sizeof (Gnum)),
+  indvelosiz = (orggrafptr->velotax != NULL) ? (indvertnbr * sizeof (Gnum)) : 0;
+  if (((arenptr == NULL) &&
+       (memAllocGroup ((void **) (void *)
+                       &indgrafptr->verttax, (size_t) ((indvertnbr + 1) * sizeof (Genum)),
                        &indgrafptr->vnumtax, (size_t) ( indvertnbr      * sizeof (Gnum)),
-                       &indgrafptr->velotax, (size_t) ( indvertnbr      * sizeof (Gnum)), NULL) == NULL) {
-      errorPrint ("graphInduce2: out of memory (1)");
-      return     (1);                             /* Nothing to free because group allocation failed */
-    }
-    indgrafptr->velotax -= baseval;
-  }
-  else {
-    if (memAllocGroup ((void **) (void *)
-                       &indgrafptr->verttax, (size_t) ((indvertnbr + 1) * sizeof (Gnum)),
-                       &indgrafptr->vnumtax, (size_t) ( indvertnbr      * sizeof (Gnum)), NULL) == NULL) {
-      errorPrint ("graphInduce2: out of memory (2)");
-      return     (1);
-    }
+                       &indgrafptr->velotax, (size_t) indvelosiz, NULL) == NULL)) ||
+      ((arenptr != NULL) &&
+       (memArenaAllocGroup (arenptr, (void **) (void *)
+                            &indgrafptr->verttax, (size_t) ((indvertnbr + 1) * sizeof (Genum)),
+                            &indgrafptr->vnumtax, (size_t) ( indvertnbr      * sizeof (Gnum)),
+                            &indgrafptr->velotax, (size_t) indvelosiz, NULL) == NULL))) {
+    errorPrint ("graphInduce2: out of memory (1)");
+    return     (1);                               /* Nothing to free because group allocation failed */
   }
+  if (indvelosiz != 0)
+    indgrafptr->velotax -= baseval;
+  else
+    indgrafptr->velotax = NULL;
   indgrafptr->verttax -= baseval;                 /* Adjust base of arrays */
   indgrafptr->vnumtax -= baseval;
   indgrafptr->vertnbr  = indvertnbr;
@@ -250,10 +329,15 @@ const Gnum                    indvertnbr)         /* Number of vertices in induc
   if (orggrafptr->edlotax != NULL)                /* If graph has edge weights */
     indedgenbr *= 2;                              /* Account for edge weights  */
 
-  if (memAllocGroup ((void *)
-                     &indgrafptr->edgetax, (size_t) (indedgenbr          * sizeof (Gnum)), /* Pre-allocate space for edgetab (and edlotab)          */
-                     &indgrafptr->edlotax, (size_t) (orggrafptr->vertnbr * sizeof (Gnum)), NULL) == NULL) { /* orgindxtab is at the end of the heap */
-    errorPrint ("graphInduce2: out of memory (3)");
+  if (((arenptr == NULL) &&
+       (memAllocGroup ((void *)
+                       &indgrafptr->edgetax, (size_t) (indedgenbr          * sizeof (Gnum)), /* Pre-allocate space for edgetab (and edlotab)          */
+                       &indgrafptr->edlotax, (size_t) (orggrafptr->vertnbr * sizeof (Gnum)), NULL) == NULL)) || /* orgindxtab is at the end of the heap */
+      ((arenptr != NULL) &&
+       (memArenaAllocGroup (arenptr, (void *)     /* Edge block is on top of arena, so that it can be trimmed */
+                            &indgrafptr->edgetax, (size_t) (indedgenbr          * sizeof (Gnum)),
+                            &indgrafptr->edlotax, (size_t) (orggrafptr->vertnbr * sizeof (Gnum)), NULL) == NULL))) {
+    errorPrint ("graphInduce2: out of memory (2)");
     graphExit  (indgrafptr);
     return     (1);
   }
@@ -276,25 +360,26 @@ graphInduce3 (
 const Graph * restrict const  orggrafptr,         /* Pointer to original graph                          */
 Graph * restrict const        indgrafptr,         /* Pointer to induced graph                           */
 const Gnum                    indvertnbr,         /* Number of vertices in induced graph                */
-const Gnum                    indedgenbr)         /* (Upper bound of) number of edges in induced graph  */
+const Gnum                    indedgenbr,         /* (Upper bound of) number of edges in induced graph  */
+MemArena * const              arenptr)            /* Memory arena to use, or NULL                       */
 {
   Gnum                orgvertnum;
-  Gnum                orgedgenum;
+  Genum               orgedgenum;
   Gnum                indvertnum;
   Gnum                indvelosum;                 /* Overall induced vertex load    */
   Gnum                indedlosum;                 /* Overall induced edge load      */
-  Gnum                indedgenum;                 /* Number of current induced edge */
+  Genum               indedgenum;                 /* Number of current induced edge */
   Gnum * restrict     indedgetax;
   Gnum * restrict     indedlotax;
+  Gnum *              orgedgetab;                 /* Decoding buffer if original graph is compressed */
 
-  const Gnum * restrict const orgverttax = orggrafptr->verttax;
-  const Gnum * restrict const orgvendtax = orggrafptr->vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->vendtax;
   const Gnum * restrict const orgvelotax = orggrafptr->velotax;
   const Gnum * restrict const orgvnumtax = orggrafptr->vnumtax;
-  const Gnum * restrict const orgedgetax = orggrafptr->edgetax;
   const Gnum * restrict const orgedlotax = orggrafptr->edlotax;
   const Gnum * restrict const orgindxtax = indgrafptr->edlotax; /* TRICK: get orgindxtax from edlotax */
-  Gnum * restrict const       indverttax = indgrafptr->verttax;
+  Genum * restrict const       indverttax = indgrafptr->verttax;
   Gnum * restrict const       indvelotax = indgrafptr->velotax;
   Gnum * restrict const       indvnumtax = indgrafptr->vnumtax;
 
@@ -308,11 +393,22 @@ const Gnum                    indedgenbr)         /* (Upper bound of) number of
     indedlotax = NULL;
   }
 
+  orgedgetab = NULL;
+  if ((orggrafptr->edgetax == NULL) &&            /* If original graph is compressed, allocate decoding buffer */
+      ((orgedgetab = memAlloc ((orggrafptr->degrmax + 1) * sizeof (Gnum))) == NULL)) {
+    errorPrint ("graphInduce3: out of memory");
+    graphExit  (indgrafptr);
+    return     (1);
+  }
+
   indvelosum = (indvelotax == NULL) ? indgrafptr->vertnbr : 0;
   indedlosum = 0;
   for (indvertnum = indedgenum = indgrafptr->baseval;
        indvertnum < indgrafptr->vertnnd; indvertnum ++) {
+    const Gnum * restrict orgedgetax;
+
     orgvertnum = indvnumtax[indvertnum];
+    orgedgetax = graphEdgeTax (orggrafptr, orgvertnum, orgedgetab); /* Decode adjacency if compressed */
     indverttax[indvertnum] = indedgenum;
     if (indvelotax != NULL) {                     /* If graph has vertex weights */
       indvelosum +=                               /* Accumulate vertex loads     */
@@ -342,6 +438,9 @@ const Gnum                    indedgenbr)         /* (Upper bound of) number of
   }
   indverttax[indvertnum] = indedgenum;            /* Mark end of edge array */
 
+  if (orgedgetab != NULL)
+    memFree (orgedgetab);
+
   indgrafptr->vendtax = indgrafptr->verttax + 1;  /* Use compact representation of vertex arrays */
   indgrafptr->vertnbr = indvertnum - indgrafptr->baseval;
   indgrafptr->vertnnd = indvertnum;
@@ -355,23 +454,51 @@ const Gnum                    indedgenbr)         /* (Upper bound of) number of
       indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
   }
 
+  return (graphInduce4 (indgrafptr, indedlotax, arenptr));
+}
+
+/* This routine shrinks the edge arrays of
+** the induced subgraph to their actual size,
+** thus deleting the vertex translation array
+** that followed them.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphInduce4 (
+Graph * restrict const        indgrafptr,         /* Pointer to induced graph             */
+Gnum * const                  indedlotax,         /* Location of edge load array, or NULL */
+MemArena * const              arenptr)            /* Memory arena to use, or NULL         */
+{
   if (indedlotax != NULL) {                       /* Re-allocate arrays and delete orgindxtab             */
     size_t              indedlooftval;            /* Offset of edge load array with respect to edge array */
 
-    indedlooftval = indedlotax - indedgetax;
-    indgrafptr->edgetax = (Gnum *) memRealloc ((indgrafptr->edgetax + indgrafptr->baseval),
-                                               (indedlooftval + indgrafptr->edgenbr) * sizeof (Gnum)) - indgrafptr->baseval;
-    indgrafptr->edlotax = indgrafptr->edgetax + indedlooftval; /* Use old index into old array as new index */
+    indedlooftval = indedlotax - indgrafptr->edgetax;
+    if (arenptr != NULL) {                        /* If edge block is on top of arena, shrink it in place */
+      memArenaTrim (arenptr, indgrafptr->edgetax + indgrafptr->baseval, (indedlooftval + indgrafptr->edgenbr) * sizeof (Gnum));
+      indgrafptr->edlotax = indedlotax;
+    }
+    else {
+      indgrafptr->edgetax = (Gnum *) memRealloc ((indgrafptr->edgetax + indgrafptr->baseval),
+                                                 (indedlooftval + indgrafptr->edgenbr) * sizeof (Gnum)) - indgrafptr->baseval;
+      indgrafptr->edlotax = indgrafptr->edgetax + indedlooftval; /* Use old index into old array as new index */
+    }
   }
   else {
-    indgrafptr->edgetax = (Gnum *) memRealloc ((indgrafptr->edgetax + indgrafptr->baseval),
-                                               indgrafptr->edgenbr * sizeof (Gnum)) - indgrafptr->baseval;
+    if (arenptr != NULL)
+      memArenaTrim (arenptr, indgrafptr->edgetax + indgrafptr->baseval, indgrafptr->edgenbr * sizeof (Gnum));
+    else
+      indgrafptr->edgetax = (Gnum *) memRealloc ((indgrafptr->edgetax + indgrafptr->baseval),
+                                                 indgrafptr->edgenbr * sizeof (Gnum)) - indgrafptr->baseval;
     indgrafptr->edlotax = NULL;                   /* Delete link to orgindxtax */
   }
 
 #ifdef SCOTCH_DEBUG_GRAPH2
   if (graphCheck (indgrafptr) != 0) {             /* Check graph consistency */
-    errorPrint ("graphInduce3: inconsistent graph data");
+    errorPrint ("graphInduce4: inconsistent graph data");
     graphExit  (indgrafptr);
     return     (1);
   }
@@ -379,3 +506,266 @@ const Gnum                    indedgenbr)         /* (Upper bound of) number of
 
   return (0);
 }
+
+/* This routine tells whether induction
+** is worth being multithreaded, given the
+** number of threads of the context and the
+** size of the original graph.
+** It returns:
+** - 0   : if induction is to be sequential.
+** - !0  : if all the threads of the context
+**         are to be used.
+*/
+
+static
+int
+graphInduceThrd (
+const Graph * restrict const  orggrafptr,         /* Pointer to original graph  */
+Context * const               contptr)            /* Execution context, or NULL */
+{
+#ifdef SCOTCH_PTHREAD
+  int                 thrdnbr;
+
+  if (contptr == NULL)
+    return (0);
+
+  thrdnbr = contextThreadNbr (contptr);
+  return ((thrdnbr > 1) && (orggrafptr->vertnbr >= GRAPHINDUCETHRDMIN));
+#else /* SCOTCH_PTHREAD */
+  return (0);
+#endif /* SCOTCH_PTHREAD */
+}
+
+/* This routine performs a prefix scan
+** sum operation on a single Genum value,
+** backed by a temporary area.
+*/
+
+static
+void
+graphInduceScan (
+Genum * restrict const      tlocptr,              /* Pointer to local area  */
+Genum * restrict const      tremptr,              /* Pointer to remote area */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine sums the induced vertex
+** and edge loads computed by multiple
+** threads.
+*/
+
+static
+void
+graphInduceReduce (
+GraphInduceThread * restrict const  tlocptr,      /* Pointer to local thread block  */
+GraphInduceThread * restrict const  tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->indvelosum += tremptr->indvelosum;
+  tlocptr->indedlosum += tremptr->indedlosum;
+}
+
+/* This routine finalizes the building of
+** the induced subgraph, using all the threads
+** of the given context. The vertex and edge
+** arrays of the induced graph must have been
+** allocated by graphInduce2().
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphInduceThrd2 (
+GraphInduceData * restrict const  dataptr,        /* Induction data             */
+MemArena * const                  arenptr,        /* Memory arena, or NULL      */
+Context * const                   contptr)        /* Execution context          */
+{
+  GraphInduceThread * restrict  thrdtab;
+  Gnum *                        orgedgetab;       /* Decoding buffers if original graph is compressed */
+  Gnum                          orgedgesiz;       /* Size of decoding buffer of each thread           */
+  int                           thrdnum;
+
+  const Graph * restrict const  orggrafptr = dataptr->orggrafptr;
+  Graph * restrict const        indgrafptr = dataptr->indgrafptr;
+  const int                     thrdnbr    = contextThreadNbr (contptr);
+
+  orgedgesiz = (orggrafptr->edgetax == NULL) ? (orggrafptr->degrmax + 1) : 0;
+  if (memAllocGroup ((void **) (void *)
+                     &thrdtab,    (size_t) (thrdnbr * sizeof (GraphInduceThread)),
+                     &orgedgetab, (size_t) (thrdnbr * orgedgesiz * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphInduceThrd2: out of memory");
+    graphExit  (indgrafptr);
+    return     (1);
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    thrdtab[thrdnum].orgedgetab = (orgedgesiz > 0) ? (orgedgetab + thrdnum * orgedgesiz) : NULL;
+  dataptr->thrdtab = thrdtab;
+
+  contextThreadLaunch (contptr, (ThreadFunc) graphInduceThrd3, (void *) dataptr);
+
+  indgrafptr->vendtax = indgrafptr->verttax + 1;  /* Use compact representation of vertex arrays */
+  indgrafptr->velosum = (indgrafptr->velotax != NULL) ? thrdtab[0].indvelosum : indgrafptr->vertnbr;
+  indgrafptr->edgenbr = (Gnum) dataptr->indedgenbr;
+  indgrafptr->edlosum = (orggrafptr->edlotax != NULL) ? thrdtab[0].indedlosum : indgrafptr->edgenbr;
+  indgrafptr->degrmax = orggrafptr->degrmax;      /* Induced maximum degree is likely to be that of the original graph */
+
+  memFree (thrdtab);                              /* Free group leader */
+
+  return (graphInduce4 (indgrafptr, (orggrafptr->edlotax != NULL) ? (indgrafptr->edgetax + indgrafptr->edgenbr) : NULL, arenptr));
+}
+
+/* This routine is the threaded core of
+** the building of the induced subgraph.
+** Every thread marks the selected vertices
+** of its slice of the original graph, then
+** counts and copies the edges of its slice
+** of the induced graph, at indices given by
+** prefix sums, so that the induced graph is
+** the same as the one built sequentially.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphInduceThrd3 (
+ThreadDescriptor * restrict const descptr,
+GraphInduceData * restrict const  dataptr)
+{
+  Gnum                orgvertbas;                 /* Start of slice of original vertices */
+  Gnum                orgvertnnd;                 /* End of slice of original vertices   */
+  Gnum                indvertbas;                 /* Start of slice of induced vertices  */
+  Gnum                indvertnnd;                 /* End of slice of induced vertices    */
+  Gnum                indvertnum;
+  Gnum                indvelosum;
+  Gnum                indedlosum;
+  Genum               indedgenbr;
+  Genum               indedgenum;
+  Gnum * restrict     indedlotax;
+
+  const Graph * restrict const  orggrafptr = dataptr->orggrafptr;
+  Graph * restrict const        indgrafptr = dataptr->indgrafptr;
+  const int                     thrdnbr    = threadNbr (descptr);
+  const int                     thrdnum    = threadNum (descptr);
+  GraphInduceThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+  const Gnum                    baseval    = orggrafptr->baseval;
+  const Genum * restrict const  orgverttax = orggrafptr->verttax;
+  const Genum * restrict const  orgvendtax = orggrafptr->vendtax;
+  const Gnum * restrict const   orgvelotax = orggrafptr->velotax;
+  const Gnum * restrict const   orgvnumtax = orggrafptr->vnumtax;
+  const Gnum * restrict const   orgedlotax = orggrafptr->edlotax;
+  Gnum * restrict const         orgindxtax = indgrafptr->edlotax; /* TRICK: get orgindxtax from edlotax */
+  Genum * restrict const        indverttax = indgrafptr->verttax;
+  Gnum * restrict const         indvelotax = indgrafptr->velotax;
+  Gnum * restrict const         indvnumtax = indgrafptr->vnumtax;
+  Gnum * restrict const         indedgetax = indgrafptr->edgetax;
+
+  orgvertbas = baseval + DATASCAN (orggrafptr->vertnbr, thrdnbr, thrdnum);
+  orgvertnnd = baseval + DATASCAN (orggrafptr->vertnbr, thrdnbr, thrdnum + 1);
+  indvertbas = baseval + DATASCAN (indgrafptr->vertnbr, thrdnbr, thrdnum);
+  indvertnnd = baseval + DATASCAN (indgrafptr->vertnbr, thrdnbr, thrdnum + 1);
+
+  if (dataptr->orgparttax != NULL) {              /* If induction from part array */
+    Gnum                orgvertnum;
+    Gnum                indvertnbr;
+
+    const GraphPart * restrict const  orgparttax = dataptr->orgparttax;
+    const GraphPart                   indpartval = dataptr->indpartval;
+
+    for (orgvertnum = orgvertbas, indvertnbr = 0; orgvertnum < orgvertnnd; orgvertnum ++) {
+      if (orgparttax[orgvertnum] == indpartval)   /* Count local selected vertices */
+        indvertnbr ++;
+    }
+    thrdptr->scantab[0] = indvertnbr;
+    threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphInduceThread), (ThreadScanFunc) graphInduceScan, NULL); /* Get start index of local induced vertices */
+
+    for (orgvertnum = orgvertbas, indvertnum = baseval + (Gnum) thrdptr->scantab[0] - indvertnbr;
+         orgvertnum < orgvertnnd; orgvertnum ++) {
+      if (orgparttax[orgvertnum] == indpartval) { /* If vertex should be kept */
+        orgindxtax[orgvertnum] = indvertnum;      /* Mark selected vertex     */
+        indvnumtax[indvertnum] = orgvertnum;
+        indvertnum ++;                            /* One more induced vertex created */
+      }
+      else
+        orgindxtax[orgvertnum] = ~0;
+    }
+  }
+  else {                                          /* Induction from vertex list */
+    memSet (orgindxtax + orgvertbas, ~0, (orgvertnnd - orgvertbas) * sizeof (Gnum)); /* Preset local slice of index array */
+    memCpy (indvnumtax + indvertbas, dataptr->indvnumtab + (indvertbas - baseval), (indvertnnd - indvertbas) * sizeof (Gnum));
+    threadBarrier (descptr);                      /* Whole index array must be preset before being marked */
+
+    for (indvertnum = indvertbas; indvertnum < indvertnnd; indvertnum ++)
+      orgindxtax[indvnumtax[indvertnum]] = indvertnum; /* Mark selected vertices */
+  }
+  threadBarrier (descptr);                        /* Index array must be complete before edges are scanned */
+
+  for (indvertnum = indvertbas, indedgenbr = 0;   /* Count local induced edges */
+       indvertnum < indvertnnd; indvertnum ++) {
+    const Gnum * restrict orgedgetax;
+    Gnum                  orgvertnum;
+    Genum                 orgedgenum;
+
+    orgvertnum = indvnumtax[indvertnum];
+    orgedgetax = graphEdgeTax (orggrafptr, orgvertnum, thrdptr->orgedgetab); /* Decode adjacency if compressed */
+    for (orgedgenum = orgverttax[orgvertnum];
+         orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+      if (orgindxtax[orgedgetax[orgedgenum]] != ~0) /* If edge should be kept */
+        indedgenbr ++;
+    }
+  }
+  thrdptr->scantab[0] = indedgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphInduceThread), (ThreadScanFunc) graphInduceScan, NULL); /* Get start index of local induced edges */
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread knows the overall number of induced edges */
+    dataptr->indedgenbr = thrdptr->scantab[0];
+  indedgenum = baseval + thrdptr->scantab[0] - indedgenbr;
+  threadBarrier (descptr);                        /* Overall number of edges is needed to locate edge load array */
+
+  indedlotax = (orgedlotax != NULL) ? (indedgetax + dataptr->indedgenbr) : NULL; /* Edge load array follows actual edge array */
+  indvelosum =
+  indedlosum = 0;
+  for (indvertnum = indvertbas; indvertnum < indvertnnd; indvertnum ++) {
+    const Gnum * restrict orgedgetax;
+    Gnum                  orgvertnum;
+    Genum                 orgedgenum;
+
+    orgvertnum = indvnumtax[indvertnum];
+    orgedgetax = graphEdgeTax (orggrafptr, orgvertnum, thrdptr->orgedgetab);
+    indverttax[indvertnum] = indedgenum;
+    if (indvelotax != NULL) {                     /* If graph has vertex weights */
+      indvelosum +=                               /* Accumulate vertex loads     */
+      indvelotax[indvertnum] = orgvelotax[orgvertnum];
+    }
+
+    for (orgedgenum = orgverttax[orgvertnum];
+         orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+      Gnum                indvertend;
+
+      indvertend = orgindxtax[orgedgetax[orgedgenum]];
+      if (indvertend != ~0) {                     /* If edge should be kept */
+        if (indedlotax != NULL) {                 /* If graph has edge weights */
+          indedlosum            +=
+          indedlotax[indedgenum] = orgedlotax[orgedgenum];
+        }
+        indedgetax[indedgenum ++] = indvertend;
+      }
+    }
+  }
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread marks end of edge array */
+    indverttax[indvertnnd] = indedgenum;
+
+  if (orgvnumtax != NULL) {                       /* Adjust local slice of vnumtax */
+    for (indvertnum = indvertbas; indvertnum < indvertnnd; indvertnum ++)
+      indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
+  }
+
+  thrdptr->indvelosum = indvelosum;
+  thrdptr->indedlosum = indedlosum;
+  threadReduce (descptr, (void *) thrdptr, sizeof (GraphInduceThread), (ThreadReduceFunc) graphInduceReduce, 0, NULL); /* Sum loads into first thread block */
+}
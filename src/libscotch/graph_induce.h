@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,15 +56,55 @@
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Minimum number of original vertices for
+    multithreaded induction to be worth it. +*/
+
+#define GRAPHINDUCETHRDMIN          2048
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphInduceThread_ {
+  Gnum                      indvelosum;           /*+ Sum of local induced vertex loads       +*/
+  Gnum                      indedlosum;           /*+ Sum of local induced edge loads         +*/
+  Gnum *                    orgedgetab;           /*+ Decoding buffer for compressed graph    +*/
+  Genum                     scantab[2];           /*+ Scan area for vertex and edge indices   +*/
+} GraphInduceThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct GraphInduceData_ {
+  const Graph *             orggrafptr;           /*+ Original graph                          +*/
+  Graph *                   indgrafptr;           /*+ Induced graph being built               +*/
+  const GraphPart *         orgparttax;           /*+ Part array, or NULL for list induction  +*/
+  GraphPart                 indpartval;           /*+ Part value of vertices to keep          +*/
+  const Gnum *              indvnumtab;           /*+ Vertex list, for list induction         +*/
+  Genum                     indedgenbr;           /*+ Number of induced edges, once known     +*/
+  GraphInduceThread *       thrdtab;              /*+ Array of thread-specific data blocks    +*/
+} GraphInduceData;
+
 /*
 **  The function prototypes.
 */
 
 #ifdef SCOTCH_GRAPH_INDUCE
-static int                  graphInduce2        (const Graph * const, Graph * const, const Gnum);
-static int                  graphInduce3        (const Graph * const, Graph * const, const Gnum, const Gnum);
+static int                  graphInduce2        (const Graph * const, Graph * const, const Gnum, MemArena * const);
+static int                  graphInduce3        (const Graph * const, Graph * const, const Gnum, const Gnum, MemArena * const);
+static int                  graphInduce4        (Graph * const, Gnum * const, MemArena * const);
+static int                  graphInduceThrd     (const Graph * const, Context * const);
+static void                 graphInduceScan     (Genum * restrict const, Genum * restrict const, const int, const int, const void * const);
+static void                 graphInduceReduce   (GraphInduceThread * restrict const, GraphInduceThread * restrict const, const void * const);
+static int                  graphInduceThrd2    (GraphInduceData * const, MemArena * const, Context * const);
+static void                 graphInduceThrd3    (ThreadDescriptor * restrict const, GraphInduceData * restrict const);
 #endif /* SCOTCH_GRAPH_INDUCE */
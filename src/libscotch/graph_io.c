@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2016,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2016,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 03 aug 2016     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,10 +67,14 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_GRAPH_IO
+
 #include "module.h"
 #include "common.h"
 #include "graph.h"
 #include "graph_io.h"
+#include "graph_io_bin.h"
+#include "graph_io_text.h"
 
 /*******************************************/
 /*                                         */
@@ -79,7 +83,9 @@
 /*******************************************/
 
 /* This routine loads a source graph from
-** the given stream.
+** the given stream. Graph files in the
+** native binary format are handled by
+** graphLoadBin().
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -92,92 +98,26 @@ FILE * const                stream,               /* Stream from which to read g
 const Gnum                  baseval,              /* Base value (-1 means keep file base) */
 const GraphLoadFlag         flagval)              /* Graph loading flags                  */
 {
-  Gnum                edgenum;                    /* Number of edges really allocated */
-  Gnum                edgennd;
-  Gnum                vlblsiz;                    /* = vertnbr if vertex labels       */
+  Genum               edgenum;                    /* Number of edges really allocated */
+  Genum               edgennd;
   Gnum                vlblmax;                    /* Maximum vertex label number      */
-  Gnum                velosiz;                    /* = vertnbr if vertex loads wanted */
   Gnum                velosum;                    /* Sum of vertex loads              */
-  Gnum                edlosiz;                    /* = edgenbr if edge loads wanted   */
   Gnum                edlosum;                    /* Sum of edge loads                */
   Gnum                edgeval;                    /* Value where to read edge end     */
   Gnum                baseadj;
-  Gnum                versval;
   Gnum                degrmax;
-  Gnum                propval;
   char                proptab[4];
   Gnum                vertnum;
+  int                 c;
 
-  memSet (grafptr, 0, sizeof (Graph));
-
-  if (intLoad (stream, &versval) != 1) {          /* Read version number */
-    errorPrint ("graphLoad: bad input (1)");
-    return (1);
-  }
-  if (versval != 0) {                             /* If version not zero */
-    errorPrint ("graphLoad: old-style graph format no longer supported");
-    return (1);
-  }
-
-  if ((intLoad (stream, &grafptr->vertnbr) != 1) || /* Read rest of header */
-      (intLoad (stream, &grafptr->edgenbr) != 1) ||
-      (intLoad (stream, &baseadj)          != 1) ||
-      (intLoad (stream, &propval)          != 1) ||
-      (propval < 0)                              ||
-      (propval > 111)) {
-    errorPrint ("graphLoad: bad input (2)");
-    return (1);
-  }
-  if (grafptr->vertnbr < 0) {
-    errorPrint ("graphLoad: invalid number of vertices");
-    return (1);
-  }
-  if ((grafptr->edgenbr < 0) ||
-      ((grafptr->edgenbr & 1) != 0)) {
-    errorPrint ("graphLoad: invalid number of edges");
-    return (1);
-  }
-  sprintf (proptab, "%3.3d", (int) propval);      /* Compute file properties */
-  proptab[0] -= '0';                              /* Vertex labels flag      */
-  proptab[1] -= '0';                              /* Edge weights flag       */
-  proptab[2] -= '0';                              /* Vertex loads flag       */
-
-  grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
-  if (baseval == -1) {                            /* If keep file graph base     */
-    grafptr->baseval = baseadj;                   /* Set graph base as file base */
-    baseadj          = 0;                         /* No base adjustment needed   */
+  if ((c = getc (stream)) != EOF) {               /* Peek first character of stream */
+    ungetc (c, stream);
+    if (c == GRAPHIOBINMAGIC[0])                  /* If binary graph file, switch to dedicated loader */
+      return (graphLoadBin (grafptr, stream, baseval, flagval));
   }
-  else {                                          /* If prescribed graph base */
-    grafptr->baseval = baseval;                   /* Set wanted graph base    */
-    baseadj          = baseval - baseadj;         /* Update base adjust       */
-  }
-  if (proptab[0] != 0)                            /* If vertex labels, no base adjust */
-    baseadj = 0;
-
-  velosiz = ((proptab[2] != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? grafptr->vertnbr : 0;
-  vlblsiz = (proptab[0] != 0) ? grafptr->vertnbr : 0;
-  edlosiz = ((proptab[1] != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? grafptr->edgenbr : 0;
 
-  if ((memAllocGroup ((void **) (void *)
-                      &grafptr->verttax, (size_t) ((grafptr->vertnbr + 1) * sizeof (Gnum)),
-                      &grafptr->velotax, (size_t) (velosiz                * sizeof (Gnum)),
-                      &grafptr->vlbltax, (size_t) (vlblsiz                * sizeof (Gnum)), NULL) == NULL) ||
-      (memAllocGroup ((void **) (void *)
-                      &grafptr->edgetax, (size_t) (grafptr->edgenbr       * sizeof (Gnum)),
-                      &grafptr->edlotax, (size_t) (edlosiz                * sizeof (Gnum)), NULL) == NULL)) {
-    if (grafptr->verttax != NULL)
-      memFree (grafptr->verttax);
-    errorPrint ("graphLoad: out of memory");
-    graphFree  (grafptr);
+  if (graphLoadHead (grafptr, stream, baseval, flagval, &baseadj, proptab) != 0) /* Read header and allocate arrays */
     return (1);
-  }
-  grafptr->vertnnd  = grafptr->vertnbr + grafptr->baseval;
-  grafptr->verttax -= grafptr->baseval;
-  grafptr->vendtax  = grafptr->verttax + 1;       /* Use compact vertex array */
-  grafptr->velotax  = (velosiz != 0) ? (grafptr->velotax - grafptr->baseval) : NULL;
-  grafptr->vlbltax  = (vlblsiz != 0) ? (grafptr->vlbltax - grafptr->baseval) : NULL;
-  grafptr->edgetax -= grafptr->baseval;
-  grafptr->edlotax  = (edlosiz != 0) ? (grafptr->edlotax - grafptr->baseval) : NULL;
 
   vlblmax = grafptr->vertnnd - 1;                 /* No vertex labels known */
   velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0;
@@ -279,12 +219,571 @@ const GraphLoadFlag         flagval)              /* Graph loading flags
   return (0);
 }
 
+/* This routine counts the number of vertices
+** and edges contained in the given text part,
+** which must hold exactly one vertex per line,
+** as written by graphSave(). Values are only
+** checked for syntax, not for consistency.
+** It returns:
+** - 0   : if the part can be parsed line by line.
+** - !0  : if it cannot.
+*/
+
+static
+int
+graphLoadTextCount (
+const GraphLoadTextData * restrict const  loadptr,
+const char *                              dataptr,
+const char * const                        dataend,
+GraphLoadTextThread * restrict const      thrdptr)
+{
+  Gnum                vertnbr;
+  Genum               edgenbr;
+  Gnum                headnbr;                    /* Number of values before degree */
+  Gnum                arcsnbr;                    /* Number of values per arc       */
+
+  headnbr = (Gnum) (loadptr->proptab[0] + loadptr->proptab[2]);
+  arcsnbr = (Gnum) (loadptr->proptab[1] + 1);
+
+  for (vertnbr = edgenbr = 0; dataptr < dataend; ) {
+    Gnum                valunbr;
+    Gnum                valunum;
+    Gnum                degrval;
+    Gnum                valutmp;
+
+    dataptr = graphIoTextBlank (dataptr);
+    if (*dataptr == '\n') {                       /* Skip empty lines */
+      dataptr ++;
+      continue;
+    }
+    if (*dataptr == '\0')                         /* If end of text reached */
+      break;
+
+    for (valunum = 0; valunum <= headnbr; valunum ++) { /* Read header values and degree */
+      dataptr = graphIoTextBlank (dataptr);
+      if (graphIoTextInt (&dataptr, &degrval) != 1)
+        return (1);
+    }
+    if (degrval < 0)
+      return (1);
+
+    for (valunbr = 0; ; valunbr ++) {             /* Count values till end of line */
+      dataptr = graphIoTextBlank (dataptr);
+      if ((*dataptr == '\n') || (*dataptr == '\0'))
+        break;
+      if (graphIoTextInt (&dataptr, &valutmp) != 1)
+        return (1);
+    }
+    if (valunbr != (degrval * arcsnbr))           /* If vertex does not fit on its line */
+      return (1);
+
+    vertnbr ++;
+    edgenbr += degrval;
+  }
+
+  thrdptr->vertbas = vertnbr;
+  thrdptr->edgebas = edgenbr;
+
+  return (0);
+}
+
+/* This routine reads the vertices of the
+** given range of the graph, starting from
+** the given text position, which is updated
+** accordingly. Newlines are considered as
+** ordinary blank characters, so that this
+** routine can also handle any graph file
+** sequentially. When the text window ends
+** before the last vertex of the range, the
+** range is shortened to the vertices read
+** in full, and the text position is set to
+** the beginning of the first incomplete
+** vertex, so that reading can resume from
+** there with the next text window.
+** It returns:
+** - 0   : on success.
+** - 1   : on error.
+** - 2   : if the text window ends before the range.
+*/
+
+static
+int
+graphLoadTextFill (
+const GraphLoadTextData * restrict const  loadptr,
+const char ** const                       posiptr,
+GraphLoadTextThread * restrict const      thrdptr)
+{
+  const char *        dataptr;
+  const char *        vertptr;                    /* Start of data of current vertex */
+  Gnum                vertnum;
+  Genum               edgenum;
+  Genum               edgebas;                    /* Start of edges of current vertex */
+  Gnum                vlblmax;
+  Gnum                velosum;
+  Gnum                edlosum;
+  Gnum                degrmax;
+  int                 o;
+
+  const Graph * restrict const  grafptr = loadptr->grafptr;
+  Genum * restrict const        verttax = grafptr->verttax;
+  Gnum * restrict const         velotax = grafptr->velotax;
+  Gnum * restrict const         vlbltax = grafptr->vlbltax;
+  Gnum * restrict const         edgetax = grafptr->edgetax;
+  Gnum * restrict const         edlotax = grafptr->edlotax;
+  const char * const            proptab = loadptr->proptab;
+  const Gnum                    baseadj = loadptr->baseadj;
+  const Genum                   edgennd = thrdptr->edgennd;
+
+  vlblmax =
+  velosum =
+  edlosum =
+  degrmax = 0;
+  for (vertnum = thrdptr->vertbas, edgenum = thrdptr->edgebas, dataptr = *posiptr;
+       vertnum < thrdptr->vertnnd; vertnum ++) {
+    Gnum                vlblval;                  /* Value where to read vertex label */
+    Gnum                velotmp;                  /* Load of current vertex           */
+    Gnum                edlotmp;                  /* Sum of edge loads of vertex      */
+    Gnum                degrval;
+
+    vertptr = dataptr;
+    edgebas = edgenum;
+
+    vlblval = 0;
+    if (proptab[0] != 0) {                        /* If must read label */
+      dataptr = graphIoTextSpace (dataptr);
+      if (graphIoTextInt (&dataptr, &vlblval) != 1) {
+        o = 1;
+        goto abort;
+      }
+      vlbltax[vertnum] = vlblval;
+    }
+    velotmp = 0;
+    if (proptab[2] != 0) {                        /* If must read vertex load        */
+      Gnum                veloval;                /* Value where to read vertex load */
+
+      dataptr = graphIoTextSpace (dataptr);
+      if (graphIoTextInt (&dataptr, &veloval) != 1) {
+        o = 2;
+        goto abort;
+      }
+      if (velotax != NULL)
+        velotmp          =
+        velotax[vertnum] = veloval;
+    }
+    dataptr = graphIoTextSpace (dataptr);
+    if (graphIoTextInt (&dataptr, &degrval) != 1) { /* Read vertex degree */
+      o = 3;
+      goto abort;
+    }
+    if ((degrval < 0) ||                          /* Check if edge array overflows */
+        ((Genum) degrval > (edgennd - edgenum))) {
+      errorPrint ("graphLoadTextFill: invalid arc count");
+      return (1);
+    }
+
+    verttax[vertnum] = edgenum;                   /* Set index in edge array */
+    for (edlotmp = 0; edgenum < (edgebas + degrval); edgenum ++) {
+      Gnum                edgeval;
+
+      if (proptab[1] != 0) {                      /* If must read edge load        */
+        Gnum                edloval;              /* Value where to read edge load */
+
+        dataptr = graphIoTextSpace (dataptr);
+        if (graphIoTextInt (&dataptr, &edloval) != 1) {
+          o = 4;
+          goto abort;
+        }
+        if (edlotax != NULL)
+          edlotmp         +=
+          edlotax[edgenum] = edloval;
+      }
+      dataptr = graphIoTextSpace (dataptr);
+      if (graphIoTextInt (&dataptr, &edgeval) != 1) {
+        o = 5;
+        goto abort;
+      }
+      edgetax[edgenum] = edgeval + baseadj;
+    }
+
+    if (vlblval > vlblmax)                        /* Account for vertex once read in full */
+      vlblmax = vlblval;
+    if (degrmax < degrval)
+      degrmax = degrval;
+    velosum += velotmp;
+    edlosum += edlotmp;
+  }
+
+  *posiptr         = dataptr;
+  thrdptr->edgebas = edgenum;                     /* Record end of edge range */
+  thrdptr->vlblmax = vlblmax;
+  thrdptr->velosum = velosum;
+  thrdptr->edlosum = edlosum;
+  thrdptr->degrmax = degrmax;
+
+  return (0);
+
+abort:
+  if (dataptr < loadptr->dataend) {               /* If not at end of text window, data is invalid */
+    errorPrint ("graphLoadTextFill: bad input (%d)", o);
+    return (1);
+  }
+
+  *posiptr         = vertptr;                     /* Resume at start of incomplete vertex */
+  thrdptr->vertnnd = vertnum;
+  thrdptr->edgebas = edgebas;
+  thrdptr->vlblmax = vlblmax;
+  thrdptr->velosum = velosum;
+  thrdptr->edlosum = edlosum;
+  thrdptr->degrmax = degrmax;
+
+  return (2);
+}
+
+/* This routine is the threaded core of the
+** text graph loading routine. Every thread
+** first counts the vertices and edges of its
+** part of the text window. Then, once the
+** start indices of all parts are known, it
+** fills its share of the graph arrays.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphLoadTextThread (
+ThreadDescriptor * restrict const   descptr,
+GraphLoadTextData * restrict const  loadptr)
+{
+  const char *        databeg;
+  const char *        dataend;
+
+  const int                             thrdnum = threadNum (descptr);
+  GraphLoadTextThread * restrict const  thrdptr = &loadptr->thrdtab[thrdnum];
+
+  if (thrdnum < loadptr->partnbr) {
+    graphIoTextPart (loadptr->databeg, loadptr->dataend, thrdnum, loadptr->partnbr, &databeg, &dataend);
+    thrdptr->flagval = graphLoadTextCount (loadptr, databeg, dataend, thrdptr);
+  }
+
+  threadBarrier (descptr);
+
+  if (thrdnum == 0) {                             /* Compute part start indices */
+    const Graph * restrict const  grafptr = loadptr->grafptr;
+    Gnum                          vertnum;
+    Genum                         edgenum;
+    int                           partnum;
+
+    for (partnum = 0, vertnum = loadptr->vertbas, edgenum = loadptr->edgebas;
+         partnum < loadptr->partnbr; partnum ++) {
+      GraphLoadTextThread * restrict const  partptr = &loadptr->thrdtab[partnum];
+      Gnum                                  vertnbr;
+      Genum                                 edgenbr;
+
+      loadptr->flagval |= partptr->flagval;
+      vertnbr = partptr->vertbas;
+      edgenbr = partptr->edgebas;
+      partptr->vertbas = vertnum;
+      partptr->edgebas = edgenum;
+      vertnum += vertnbr;
+      edgenum += edgenbr;
+      partptr->vertnnd = vertnum;
+      partptr->edgennd = edgenum;
+    }
+    if ((vertnum > grafptr->vertnnd) ||           /* If counts exceed header, process window sequentially */
+        (edgenum > (grafptr->edgenbr + grafptr->baseval)))
+      loadptr->flagval = 1;
+  }
+
+  threadBarrier (descptr);
+
+  if ((thrdnum < loadptr->partnbr) &&             /* Fill arrays, which cannot fail once text checked */
+      (loadptr->flagval == 0))
+    graphLoadTextFill (loadptr, &databeg, thrdptr);
+}
+
+/* This routine loads a source graph from
+** the given stream, like graphLoad(), but
+** reads the stream by large windows of
+** complete lines, and parses each of them
+** using the threads of the given context.
+** When a window does not hold one vertex
+** per line, it is parsed sequentially, and
+** the vertex it ends with, which may not be
+** complete, is carried to the next window.
+** Once the graph is read, the data read
+** ahead is given back to the stream, so
+** that the stream is left positioned just
+** after the graph data, like graphLoad()
+** does. Since this is only possible when
+** the stream is seekable, non-seekable
+** streams are read by graphLoad().
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadText (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphLoadFlag         flagval,              /* Graph loading flags                  */
+Context * restrict const    contptr)              /* Execution context                    */
+{
+  GraphIoText         textdat;
+  GraphLoadTextData   loaddat;
+  const char *        dataptr;                    /* End of consumed data in text window */
+  Gnum                vertnum;
+  Genum               edgenum;
+  Gnum                vlblmax;
+  Gnum                velosum;
+  Gnum                edlosum;
+  Gnum                degrmax;
+  Gnum                baseadj;
+  char                proptab[4];
+  int                 thrdnbr;
+  int                 c;
+
+  if (ftell (stream) < 0)                         /* If stream not seekable, read-ahead data could not be given back */
+    return (graphLoad (grafptr, stream, baseval, flagval));
+
+  if ((c = getc (stream)) != EOF) {               /* Peek first character of stream */
+    ungetc (c, stream);
+    if (c == GRAPHIOBINMAGIC[0])                  /* If binary graph file, switch to dedicated loader */
+      return (graphLoadBin (grafptr, stream, baseval, flagval));
+  }
+
+  if (graphLoadHead (grafptr, stream, baseval, flagval, &baseadj, proptab) != 0) /* Read header and allocate arrays */
+    return (1);
+
+  thrdnbr = contextThreadNbr (contptr);
+  if (graphIoTextInit (&textdat, stream) != 0) {
+    errorPrint ("graphLoadText: cannot initialize text buffer");
+    graphFree  (grafptr);
+    return (1);
+  }
+  if ((loaddat.thrdtab = memAlloc (thrdnbr * sizeof (GraphLoadTextThread))) == NULL) {
+    errorPrint      ("graphLoadText: out of memory");
+    graphIoTextExit (&textdat);
+    graphFree       (grafptr);
+    return (1);
+  }
+  loaddat.grafptr = grafptr;
+  loaddat.baseadj = baseadj;
+  loaddat.proptab = proptab;
+
+  vlblmax = grafptr->vertnnd - 1;                 /* No vertex labels known */
+  velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0;
+  edlosum = (grafptr->edlotax == NULL) ? grafptr->edgenbr : 0;
+  degrmax = 0;
+  for (vertnum = edgenum = grafptr->baseval, dataptr = NULL; vertnum < grafptr->vertnnd; ) {
+    GraphLoadTextThread * restrict  partptr;
+    int                             partnum;
+
+    if (graphIoTextRead (&textdat, dataptr, &loaddat.databeg, &loaddat.dataend) != 0) { /* Get next text window */
+      errorPrint      ("graphLoadText: invalid graph data (1)");
+      memFree         (loaddat.thrdtab);
+      graphIoTextExit (&textdat);
+      graphFree       (grafptr);
+      return (1);
+    }
+    loaddat.vertbas = vertnum;
+    loaddat.edgebas = edgenum;
+    loaddat.partnbr = graphIoTextPartNbr (loaddat.databeg, loaddat.dataend, thrdnbr);
+    loaddat.flagval = 0;
+
+    dataptr = NULL;                               /* Assume whole window will be consumed */
+    if (loaddat.partnbr > 1)                      /* If text worth being split */
+      contextThreadLaunch (contptr, (ThreadFunc) graphLoadTextThread, (void *) &loaddat);
+    else
+      loaddat.flagval = 1;
+
+    if (loaddat.flagval != 0) {                   /* If text has to be parsed sequentially */
+      loaddat.partnbr = 1;
+      loaddat.thrdtab[0].vertbas = vertnum;
+      loaddat.thrdtab[0].vertnnd = grafptr->vertnnd;
+      loaddat.thrdtab[0].edgebas = edgenum;
+      loaddat.thrdtab[0].edgennd = grafptr->edgenbr + grafptr->baseval;
+      dataptr = loaddat.databeg;
+      if (graphLoadTextFill (&loaddat, &dataptr, &loaddat.thrdtab[0]) == 1) {
+        errorPrint      ("graphLoadText: invalid graph data (2)");
+        memFree         (loaddat.thrdtab);
+        graphIoTextExit (&textdat);
+        graphFree       (grafptr);
+        return (1);
+      }
+    }
+
+    for (partnum = 0; partnum < loaddat.partnbr; partnum ++) { /* Reduce part values */
+      partptr = &loaddat.thrdtab[partnum];
+
+      if (partptr->vlblmax > vlblmax)
+        vlblmax = partptr->vlblmax;
+      if (partptr->degrmax > degrmax)
+        degrmax = partptr->degrmax;
+      velosum += partptr->velosum;
+      edlosum += partptr->edlosum;
+    }
+    vertnum = partptr->vertnnd;                   /* Resume after last vertex read */
+    edgenum = partptr->edgebas;
+  }
+
+  if (vertnum > grafptr->baseval) {               /* If some text window has been read */
+    if (dataptr == NULL) {                        /* If last window parsed in parallel, it only ends with blanks */
+      for (dataptr = loaddat.dataend; (dataptr > loaddat.databeg) && (isspace ((unsigned char) dataptr[-1])); dataptr --) ;
+    }
+    if (graphIoTextSeek (&textdat, dataptr) != 0) { /* Give back data read after graph */
+      errorPrint      ("graphLoadText: cannot restore stream position");
+      memFree         (loaddat.thrdtab);
+      graphIoTextExit (&textdat);
+      graphFree       (grafptr);
+      return (1);
+    }
+  }
+
+  memFree         (loaddat.thrdtab);
+  graphIoTextExit (&textdat);
+
+  if (edgenum != (grafptr->edgenbr + grafptr->baseval)) { /* Check if number of edges is valid */
+    errorPrint ("graphLoadText: invalid arc count");
+    graphFree  (grafptr);
+    return (1);
+  }
+  grafptr->verttax[grafptr->vertnnd] = edgenum;   /* Set end of edge array */
+  grafptr->velosum = velosum;
+  grafptr->edlosum = edlosum;
+  grafptr->degrmax = degrmax;
+
+  if (grafptr->vlbltax != NULL) {                 /* If vertex label renaming necessary       */
+    if (graphLoad2 (grafptr->baseval, grafptr->vertnnd, grafptr->verttax, /* Rename edge ends */
+                    grafptr->vendtax, grafptr->edgetax, vlblmax, grafptr->vlbltax) != 0) {
+      errorPrint ("graphLoadText: cannot relabel vertices");
+      graphFree  (grafptr);
+      return (1);
+    }
+  }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadText: inconsistent graph data");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine reads the header of a
+** source graph file in the new-style
+** graph format from the given stream,
+** and allocates the arrays of the graph
+** accordingly. On return, the stream is
+** positioned at the beginning of the
+** vertex data.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadHead (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphLoadFlag         flagval,              /* Graph loading flags                  */
+Gnum * restrict const       baseptr,              /* Pointer to edge end base adjustment  */
+char * restrict const       proptab)              /* Array of file property flags         */
+{
+  Gnum                vlblsiz;                    /* = vertnbr if vertex labels       */
+  Gnum                velosiz;                    /* = vertnbr if vertex loads wanted */
+  Gnum                edlosiz;                    /* = edgenbr if edge loads wanted   */
+  Gnum                baseadj;
+  Gnum                versval;
+  Gnum                propval;
+
+  memSet (grafptr, 0, sizeof (Graph));
+
+  if (intLoad (stream, &versval) != 1) {          /* Read version number */
+    errorPrint ("graphLoadHead: bad input (1)");
+    return (1);
+  }
+  if (versval != 0) {                             /* If version not zero */
+    errorPrint ("graphLoadHead: old-style graph format no longer supported");
+    return (1);
+  }
+
+  if ((intLoad (stream, &grafptr->vertnbr) != 1) || /* Read rest of header */
+      (intLoadEdge (stream, &grafptr->edgenbr) != 1) ||
+      (intLoad (stream, &baseadj)          != 1) ||
+      (intLoad (stream, &propval)          != 1) ||
+      (propval < 0)                              ||
+      (propval > 111)) {
+    errorPrint ("graphLoadHead: bad input (2)");
+    return (1);
+  }
+  if (grafptr->vertnbr < 0) {
+    errorPrint ("graphLoadHead: invalid number of vertices");
+    return (1);
+  }
+  if ((grafptr->edgenbr < 0) ||
+      ((grafptr->edgenbr & 1) != 0)) {
+    errorPrint ("graphLoadHead: invalid number of edges");
+    return (1);
+  }
+  sprintf (proptab, "%3.3d", (int) propval);      /* Compute file properties */
+  proptab[0] -= '0';                              /* Vertex labels flag      */
+  proptab[1] -= '0';                              /* Edge weights flag       */
+  proptab[2] -= '0';                              /* Vertex loads flag       */
+
+  grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+  if (baseval == -1) {                            /* If keep file graph base     */
+    grafptr->baseval = baseadj;                   /* Set graph base as file base */
+    baseadj          = 0;                         /* No base adjustment needed   */
+  }
+  else {                                          /* If prescribed graph base */
+    grafptr->baseval = baseval;                   /* Set wanted graph base    */
+    baseadj          = baseval - baseadj;         /* Update base adjust       */
+  }
+  if (proptab[0] != 0)                            /* If vertex labels, no base adjust */
+    baseadj = 0;
+  *baseptr = baseadj;
+
+  velosiz = ((proptab[2] != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? grafptr->vertnbr : 0;
+  vlblsiz = (proptab[0] != 0) ? grafptr->vertnbr : 0;
+  edlosiz = ((proptab[1] != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? grafptr->edgenbr : 0;
+
+  if ((memAllocGroup ((void **) (void *)
+                      &grafptr->verttax, (size_t) ((grafptr->vertnbr + 1) * sizeof (Genum)),
+                      &grafptr->velotax, (size_t) (velosiz                * sizeof (Gnum)),
+                      &grafptr->vlbltax, (size_t) (vlblsiz                * sizeof (Gnum)), NULL) == NULL) ||
+      (memAllocGroup ((void **) (void *)
+                      &grafptr->edgetax, (size_t) (grafptr->edgenbr       * sizeof (Gnum)),
+                      &grafptr->edlotax, (size_t) (edlosiz                * sizeof (Gnum)), NULL) == NULL)) {
+    if (grafptr->verttax != NULL)
+      memFree (grafptr->verttax);
+    errorPrint ("graphLoadHead: out of memory");
+    graphFree  (grafptr);
+    return (1);
+  }
+  grafptr->vertnnd  = grafptr->vertnbr + grafptr->baseval;
+  grafptr->verttax -= grafptr->baseval;
+  grafptr->vendtax  = grafptr->verttax + 1;       /* Use compact vertex array */
+  grafptr->velotax  = (velosiz != 0) ? (grafptr->velotax - grafptr->baseval) : NULL;
+  grafptr->vlbltax  = (vlblsiz != 0) ? (grafptr->vlbltax - grafptr->baseval) : NULL;
+  grafptr->edgetax -= grafptr->baseval;
+  grafptr->edlotax  = (edlosiz != 0) ? (grafptr->edlotax - grafptr->baseval) : NULL;
+
+  return (0);
+}
+
 int
 graphLoad2 (
 const Gnum                  baseval,
 const Gnum                  vertnnd,
-const Gnum * const          verttax,
-const Gnum * const          vendtax,
+const Genum * const         verttax,
+const Genum * const         vendtax,
 Gnum * restrict const       edgetax,
 const Gnum                  vlblmax,
 const Gnum * const          vlbltax)
@@ -307,7 +806,7 @@ const Gnum * const          vlbltax)
     indxtab[vlbltax[vertnum]] = vertnum;          /* Set vertex number index */
   }
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
-    Gnum                edgenum;                  /* Number of current edge */
+    Genum               edgenum;                  /* Number of current edge */
 
     for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
       if (edgetax[edgenum] > vlblmax) {           /* If invalid edge end number */
@@ -351,9 +850,9 @@ FILE * const                stream)
   propstr[2] = (grafptr->velotax != NULL) ? '1' : '0';
   propstr[3] = '\0';
 
-  if (fprintf (stream, "0\n" GNUMSTRING "\t" GNUMSTRING "\n" GNUMSTRING "\t%3s\n", /* Write file header */
+  if (fprintf (stream, "0\n" GNUMSTRING "\t" GENUMSTRING "\n" GNUMSTRING "\t%3s\n", /* Write file header */
                (Gnum) grafptr->vertnbr,
-               (Gnum) grafptr->edgenbr,
+               (Genum) grafptr->edgenbr,
                (Gnum) grafptr->baseval,
                propstr) == EOF) {
     errorPrint ("graphSave: bad output (1)");
@@ -362,7 +861,7 @@ FILE * const                stream)
 
   for (vertnum = grafptr->baseval, o = 0;
        (vertnum < grafptr->vertnnd) && (o == 0); vertnum ++) {
-    Gnum                edgenum;
+    Genum               edgenum;
 
     if (grafptr->vlbltax != NULL)                 /* Write vertex label if necessary */
       o  = (fprintf (stream, GNUMSTRING "\t", (Gnum) grafptr->vlbltax[vertnum]) == EOF);
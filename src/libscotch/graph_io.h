@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,12 +57,56 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : to   : 11 jul 2024     **/
-/**                                 to   : 11 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block of the
+    multithreaded graph loading routine. On
+    the first pass, vertbas and edgebas hold
+    the number of vertices and edges of the
+    part; they are then turned into the
+    indices of the first vertex and edge.    +*/
+
+typedef struct GraphLoadTextThread_ {
+  Gnum                      vertbas;              /*+ Number of first vertex of part +*/
+  Gnum                      vertnnd;              /*+ After-last vertex of part      +*/
+  Genum                     edgebas;              /*+ Index of first edge of part    +*/
+  Genum                     edgennd;              /*+ After-last edge of part        +*/
+  Gnum                      vlblmax;              /*+ Maximum vertex label           +*/
+  Gnum                      velosum;              /*+ Partial sum of vertex loads    +*/
+  Gnum                      edlosum;              /*+ Partial sum of edge loads      +*/
+  Gnum                      degrmax;              /*+ Maximum degree                 +*/
+  int                       flagval;              /*+ Part parsing status            +*/
+} GraphLoadTextThread;
+
+/*+ The loading data shared by all threads. +*/
+
+typedef struct GraphLoadTextData_ {
+  Graph *                   grafptr;              /*+ Graph being loaded                      +*/
+  const char *              databeg;              /*+ Start of text window                    +*/
+  const char *              dataend;              /*+ End of text window                      +*/
+  Gnum                      vertbas;              /*+ First vertex of text window             +*/
+  Genum                     edgebas;              /*+ First edge of text window               +*/
+  Gnum                      baseadj;              /*+ Edge end base adjustment                +*/
+  const char *              proptab;              /*+ Array of file property flags            +*/
+  int                       partnbr;              /*+ Number of text parts                    +*/
+  int                       flagval;              /*+ Set if text cannot be parsed by parts   +*/
+  GraphLoadTextThread *     thrdtab;              /*+ Array of thread data blocks             +*/
+} GraphLoadTextData;
+
 /*
 **  The function prototypes.
 */
 
-int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
+#ifdef SCOTCH_GRAPH_IO
+static int                  graphLoadTextCount  (const GraphLoadTextData * restrict const, const char *, const char * const, GraphLoadTextThread * restrict const);
+static int                  graphLoadTextFill   (const GraphLoadTextData * restrict const, const char ** const, GraphLoadTextThread * restrict const);
+static void                 graphLoadTextThread (ThreadDescriptor * restrict const, GraphLoadTextData * restrict const);
+#endif /* SCOTCH_GRAPH_IO */
+
+int                         graphLoad2          (const Gnum, const Gnum, const Genum * const, const Genum * const, Gnum * restrict const, const Gnum, const Gnum * const);
@@ -0,0 +1,662 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the I/O routines   **/
+/**                for handling the native binary graph    **/
+/**                format. When the file matches the       **/
+/**                memory layout of the library, it is     **/
+/**                memory-mapped and used in place.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_IO_BIN
+
+#include "module.h"
+#include "common.h"
+#include "geom.h"
+#include "graph.h"
+#include "graph_io_bin.h"
+
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#define GRAPHIOBINMMAP
+#include            <sys/mman.h>
+#include            <sys/stat.h>
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
+/***********************************/
+/*                                 */
+/* These are the utility routines. */
+/*                                 */
+/***********************************/
+
+/* This routine reverses the byte order
+** of an array of integers of given size.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+graphIoBinSwap (
+void * const                dataptr,
+const size_t                datasiz,              /* Size of integers, in bytes */
+const size_t                datanbr)              /* Number of integers         */
+{
+  byte * restrict     datatab;
+  size_t              datanum;
+
+  for (datanum = 0, datatab = (byte *) dataptr; datanum < datanbr; datanum ++, datatab += datasiz) {
+    size_t              bytenum;
+
+    for (bytenum = 0; bytenum < (datasiz >> 1); bytenum ++) {
+      byte                byteval;
+
+      byteval                            = datatab[bytenum];
+      datatab[bytenum]                   = datatab[datasiz - bytenum - 1];
+      datatab[datasiz - bytenum - 1] = byteval;
+    }
+  }
+}
+
+/* This routine computes the size of a file
+** section holding the given number of integers.
+** It returns:
+** - the padded section size, in bytes.
+*/
+
+static
+size_t
+graphIoBinSize (
+const UINT64                datanbr,
+const UINT32                gnumsiz)
+{
+  return ((size_t) ((datanbr * gnumsiz + (GRAPHIOBINALIGN - 1)) & ~((UINT64) (GRAPHIOBINALIGN - 1))));
+}
+
+/* This routine reads a file section of
+** the given number of integers into the
+** given array of integers of the given
+** width, converting integer width and byte
+** order if necessary. When the array is
+** NULL, the section is skipped.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphIoBinRead (
+FILE * const                stream,
+void * const                datatab,              /* Array to fill, or NULL to skip */
+const Genum                 datanbr,
+const UINT32                filesiz,              /* Width of integers in file      */
+const size_t                datasiz,              /* Width of integers in memory    */
+const int                   swapflag)             /* Set if byte order differs      */
+{
+  UINT64              buftab[GRAPHIOBINBUFNBR];   /* Conversion buffer, aligned for all widths */
+  Genum               datanum;
+  size_t              padnbr;
+
+  if ((datatab != NULL) && (filesiz == datasiz)) { /* If direct read possible */
+    if (fread (datatab, filesiz, (size_t) datanbr, stream) != (size_t) datanbr)
+      return (1);
+    if (swapflag != 0)
+      graphIoBinSwap (datatab, filesiz, (size_t) datanbr);
+  }
+  else {
+    for (datanum = 0; datanum < datanbr; ) {
+      Genum               bufnbr;
+      Genum               bufnum;
+
+      bufnbr = MIN (datanbr - datanum, GRAPHIOBINBUFNBR);
+      if (fread (buftab, filesiz, (size_t) bufnbr, stream) != (size_t) bufnbr)
+        return (1);
+      if (datatab != NULL) {
+        if (swapflag != 0)
+          graphIoBinSwap (buftab, filesiz, (size_t) bufnbr);
+        for (bufnum = 0; bufnum < bufnbr; bufnum ++) {
+          int64_t             dataval;
+
+          dataval = (filesiz == 4) ? (int64_t) ((int32_t *) buftab)[bufnum] : ((int64_t *) buftab)[bufnum];
+          if (datasiz == 4) {
+            if ((dataval > (int64_t) INT32_MAX) || (dataval < (int64_t) INT32_MIN)) {
+              errorPrint ("graphIoBinRead: integer value too large for this build");
+              return (1);
+            }
+            ((int32_t *) datatab)[datanum + bufnum] = (int32_t) dataval;
+          }
+          else
+            ((int64_t *) datatab)[datanum + bufnum] = dataval;
+        }
+      }
+      datanum += bufnbr;
+    }
+  }
+
+  padnbr = graphIoBinSize ((UINT64) datanbr, filesiz) - (size_t) datanbr * filesiz;
+  if ((padnbr > 0) &&                             /* Skip section padding */
+      (fread (buftab, 1, padnbr, stream) != padnbr))
+    return (1);
+
+  return (0);
+}
+
+/* This routine writes the padding bytes
+** which end a file section holding the
+** given number of integers of the given
+** width.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphIoBinPad (
+FILE * const                stream,
+const Genum                 datanbr,
+const size_t                datasiz)
+{
+  static const byte   padtab[GRAPHIOBINALIGN] = { 0 };
+  size_t              padnbr;
+
+  padnbr = graphIoBinSize ((UINT64) datanbr, (UINT32) datasiz) - (size_t) datanbr * datasiz;
+
+  return ((padnbr > 0) && (fwrite (padtab, 1, padnbr, stream) != padnbr));
+}
+
+/* This routine writes the given array
+** of integers of the given width as a
+** padded file section.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphIoBinWrite (
+FILE * const                stream,
+const void * const          datatab,
+const Genum                 datanbr,
+const size_t                datasiz)
+{
+  if ((datanbr > 0) &&
+      (fwrite (datatab, datasiz, (size_t) datanbr, stream) != (size_t) datanbr))
+    return (1);
+
+  return (graphIoBinPad (stream, datanbr, datasiz));
+}
+
+/* This routine checks that the adjacency
+** structure of a graph read from a binary
+** file is consistent, so that arrays and
+** edge ends taken from the file can be used
+** as indices without further checking. It is
+** performed whatever the debug level, since
+** file data cannot be trusted.
+** It returns:
+** - 0   : if the adjacency structure is valid.
+** - !0  : on error.
+*/
+
+static
+int
+graphIoBinCheck (
+const Graph * const         grafptr)
+{
+  Gnum                vertnum;
+
+  const Gnum                    baseval = grafptr->baseval;
+  const Gnum                    vertnnd = grafptr->vertnnd;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Gnum * restrict const   edgetax = grafptr->edgetax;
+
+  if ((verttax[baseval] != baseval) ||            /* Vertex array must span the whole edge array */
+      (verttax[vertnnd] != (grafptr->edgenbr + baseval))) {
+    errorPrint ("graphIoBinCheck: invalid arc count");
+    return (1);
+  }
+
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+    Genum               edgenum;
+
+    if ((verttax[vertnum + 1] < verttax[vertnum]) || /* Vertex array must be monotone and degrees bounded */
+        ((verttax[vertnum + 1] - verttax[vertnum]) > (Genum) grafptr->degrmax)) {
+      errorPrint ("graphIoBinCheck: invalid vertex array");
+      return (1);
+    }
+    for (edgenum = verttax[vertnum]; edgenum < verttax[vertnum + 1]; edgenum ++) {
+      if ((edgetax[edgenum] < baseval) || (edgetax[edgenum] >= vertnnd)) {
+        errorPrint ("graphIoBinCheck: invalid edge array");
+        return (1);
+      }
+    }
+  }
+
+  return (0);
+}
+
+/*************************************************/
+/*                                               */
+/* These routines handle binary graph load/save. */
+/*                                               */
+/*************************************************/
+
+/* This routine loads a source graph from
+** the given stream, in the native binary
+** format. Whenever the stream is a regular
+** file read from its beginning, and the file
+** byte order, integer width and base value
+** match the ones requested, the file is
+** memory-mapped and its arrays are used in
+** place. Else, arrays are allocated and
+** filled with converted file data.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadBin (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphLoadFlag         flagval)              /* Graph loading flags                  */
+{
+  GraphIoBinHead      headdat;
+  int                 swapflag;
+  long                fileoff;
+  size_t              vertsiz;                    /* Sizes of file sections */
+  size_t              velosiz;
+  size_t              vlblsiz;
+  size_t              edgesiz;
+  size_t              edlosiz;
+  Gnum                filebasval;
+  Gnum                baseadj;
+  Gnum                vertnum;
+  Genum               edgenum;
+  Genum               edgennd;
+
+  memSet (grafptr, 0, sizeof (Graph));
+
+  fileoff = ftell (stream);                       /* Get position of header, if stream is seekable */
+  if (fread (&headdat, sizeof (GraphIoBinHead), 1, stream) != 1) {
+    errorPrint ("graphLoadBin: bad input (1)");
+    return (1);
+  }
+  if (memcmp (headdat.magitab, GRAPHIOBINMAGIC, sizeof (headdat.magitab)) != 0) {
+    errorPrint ("graphLoadBin: not a binary graph file");
+    return (1);
+  }
+  if (headdat.endival == GRAPHIOBINENDIAN)
+    swapflag = 0;
+  else if (headdat.endival == GRAPHIOBINENDIANSWAP) {
+    swapflag = 1;
+    graphIoBinSwap (&headdat.gnumsiz, sizeof (UINT32), 5); /* Swap all 32-bit fields after marker */
+    graphIoBinSwap (&headdat.baseval, sizeof (UINT64), 7); /* Swap all 64-bit fields            */
+  }
+  else {
+    errorPrint ("graphLoadBin: invalid byte order marker");
+    return (1);
+  }
+  if (headdat.versval != GRAPHIOBINVERSION) {
+    errorPrint ("graphLoadBin: unsupported format version");
+    return (1);
+  }
+  if (((headdat.gnumsiz  != 4) && (headdat.gnumsiz  != 8)) ||
+      ((headdat.genumsiz != 4) && (headdat.genumsiz != 8)) ||
+      (headdat.vertnbr >= (UINT64) GNUMMAX)                ||
+      (headdat.edgenbr >  (UINT64) GENUMMAX)               ||
+      (headdat.baseval >  (UINT64) GNUMMAX)              ||
+      ((headdat.edgenbr & 1) != 0)) {
+    errorPrint ("graphLoadBin: bad input (2)");
+    return (1);
+  }
+
+  vertsiz = graphIoBinSize (headdat.vertnbr + 1, headdat.genumsiz);
+  velosiz = ((headdat.propval & GRAPHIOBINPROPVELO) != 0) ? graphIoBinSize (headdat.vertnbr, headdat.gnumsiz) : 0;
+  vlblsiz = ((headdat.propval & GRAPHIOBINPROPVLBL) != 0) ? graphIoBinSize (headdat.vertnbr, headdat.gnumsiz) : 0;
+  edgesiz = graphIoBinSize (headdat.edgenbr, headdat.gnumsiz);
+  edlosiz = ((headdat.propval & GRAPHIOBINPROPEDLO) != 0) ? graphIoBinSize (headdat.edgenbr, headdat.gnumsiz) : 0;
+  if (headdat.filesiz != (UINT64) (sizeof (GraphIoBinHead) + vertsiz + velosiz + vlblsiz + edgesiz + edlosiz)) {
+    errorPrint ("graphLoadBin: inconsistent file size");
+    return (1);
+  }
+
+  filebasval       = (Gnum) headdat.baseval;
+  grafptr->baseval = (baseval == -1) ? filebasval : baseval;
+  grafptr->vertnbr = (Gnum) headdat.vertnbr;
+  grafptr->vertnnd = grafptr->vertnbr + grafptr->baseval;
+  grafptr->edgenbr = (Genum) headdat.edgenbr;
+  grafptr->degrmax = (Gnum) headdat.degrmax;
+  edgennd          = grafptr->edgenbr + grafptr->baseval;
+
+#ifdef GRAPHIOBINMMAP
+  if ((swapflag == 0)                       &&    /* If file can be used in place */
+      (headdat.gnumsiz == sizeof (Gnum))    &&
+      (headdat.genumsiz == sizeof (Genum))  &&
+      (grafptr->baseval == filebasval)      &&
+      (fileoff == 0)) {
+    struct stat         statdat;
+    int                 filenum;
+
+    filenum = fileno (stream);
+    if ((filenum >= 0)                        &&
+        (fstat (filenum, &statdat) == 0)      &&
+        (S_ISREG (statdat.st_mode))           &&
+        ((UINT64) statdat.st_size >= headdat.filesiz)) {
+      byte *              mapptr;
+
+      mapptr = (byte *) mmap (NULL, (size_t) headdat.filesiz, PROT_READ | PROT_WRITE, MAP_PRIVATE, filenum, 0); /* Copy-on-write, so that graph can be modified in memory */
+      if (mapptr != (byte *) MAP_FAILED) {
+        byte *              secptr;
+
+        secptr = mapptr + sizeof (GraphIoBinHead);
+        grafptr->verttax = (Genum *) secptr - grafptr->baseval;
+        grafptr->vendtax = grafptr->verttax + 1;  /* Vertex array is always compact */
+        secptr += vertsiz;
+        if (velosiz != 0) {
+          if ((flagval & GRAPHIONOLOADVERT) == 0)
+            grafptr->velotax = (Gnum *) secptr - grafptr->baseval;
+          secptr += velosiz;
+        }
+        if (vlblsiz != 0) {
+          grafptr->vlbltax = (Gnum *) secptr - grafptr->baseval;
+          secptr += vlblsiz;
+        }
+        grafptr->edgetax = (Gnum *) secptr - grafptr->baseval;
+        secptr += edgesiz;
+        if ((edlosiz != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0))
+          grafptr->edlotax = (Gnum *) secptr - grafptr->baseval;
+
+        grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP | GRAPHFILEMAP; /* Only graphFree() can unmap the whole file */
+        grafptr->velosum = (grafptr->velotax != NULL) ? (Gnum) headdat.velosum : grafptr->vertnbr;
+        grafptr->edlosum = (grafptr->edlotax != NULL) ? (Gnum) headdat.edlosum : (Gnum) grafptr->edgenbr;
+
+        if (graphIoBinCheck (grafptr) != 0) {     /* Mapped data is used in place, so check it */
+          errorPrint ("graphLoadBin: invalid graph data (1)");
+          graphFree  (grafptr);
+          return (1);
+        }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+        if (graphCheck (grafptr) != 0) {          /* Check graph consistency */
+          errorPrint ("graphLoadBin: inconsistent graph data (1)");
+          graphFree  (grafptr);
+          return (1);
+        }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+        return (0);
+      }
+    }
+  }
+#endif /* GRAPHIOBINMMAP */
+
+  if ((memAllocGroup ((void **) (void *)
+                      &grafptr->verttax, (size_t) ((grafptr->vertnbr + 1) * sizeof (Genum)),
+                      &grafptr->velotax, (size_t) ((((velosiz != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? grafptr->vertnbr : 0) * sizeof (Gnum)),
+                      &grafptr->vlbltax, (size_t) (((vlblsiz != 0) ? grafptr->vertnbr : 0) * sizeof (Gnum)), NULL) == NULL) ||
+      (memAllocGroup ((void **) (void *)
+                      &grafptr->edgetax, (size_t) (grafptr->edgenbr * sizeof (Gnum)),
+                      &grafptr->edlotax, (size_t) ((((edlosiz != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? grafptr->edgenbr : 0) * sizeof (Gnum)), NULL) == NULL)) {
+    if (grafptr->verttax != NULL)
+      memFree (grafptr->verttax);
+    errorPrint ("graphLoadBin: out of memory");
+    memSet     (grafptr, 0, sizeof (Graph));
+    return (1);
+  }
+  grafptr->flagval  = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+  grafptr->verttax -= grafptr->baseval;
+  grafptr->vendtax  = grafptr->verttax + 1;       /* Use compact vertex array */
+  grafptr->velotax  = ((velosiz != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? (grafptr->velotax - grafptr->baseval) : NULL;
+  grafptr->vlbltax  = (vlblsiz != 0) ? (grafptr->vlbltax - grafptr->baseval) : NULL;
+  grafptr->edgetax -= grafptr->baseval;
+  grafptr->edlotax  = ((edlosiz != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? (grafptr->edlotax - grafptr->baseval) : NULL;
+  grafptr->velosum  = (grafptr->velotax != NULL) ? (Gnum) headdat.velosum : grafptr->vertnbr;
+  grafptr->edlosum  = (grafptr->edlotax != NULL) ? (Gnum) headdat.edlosum : (Gnum) grafptr->edgenbr;
+
+  if ((graphIoBinRead (stream, grafptr->verttax + grafptr->baseval, grafptr->vertnbr + 1, headdat.genumsiz, sizeof (Genum), swapflag) != 0) ||
+      ((velosiz != 0) &&
+       (graphIoBinRead (stream, (grafptr->velotax != NULL) ? (grafptr->velotax + grafptr->baseval) : NULL, grafptr->vertnbr, headdat.gnumsiz, sizeof (Gnum), swapflag) != 0)) ||
+      ((vlblsiz != 0) &&
+       (graphIoBinRead (stream, grafptr->vlbltax + grafptr->baseval, grafptr->vertnbr, headdat.gnumsiz, sizeof (Gnum), swapflag) != 0)) ||
+      (graphIoBinRead (stream, grafptr->edgetax + grafptr->baseval, grafptr->edgenbr, headdat.gnumsiz, sizeof (Gnum), swapflag) != 0) ||
+      ((grafptr->edlotax != NULL) &&              /* Trailing edge load section need not be read if not wanted */
+       (graphIoBinRead (stream, grafptr->edlotax + grafptr->baseval, grafptr->edgenbr, headdat.gnumsiz, sizeof (Gnum), swapflag) != 0))) {
+    errorPrint ("graphLoadBin: bad input (3)");
+    graphFree  (grafptr);
+    return (1);
+  }
+
+  baseadj = grafptr->baseval - filebasval;
+  if (baseadj != 0) {                             /* If base value changed, update vertex and edge arrays */
+    for (vertnum = grafptr->baseval; vertnum <= grafptr->vertnnd; vertnum ++)
+      grafptr->verttax[vertnum] += baseadj;
+    for (edgenum = grafptr->baseval; edgenum < edgennd; edgenum ++)
+      grafptr->edgetax[edgenum] += baseadj;
+  }
+
+  if (graphIoBinCheck (grafptr) != 0) {
+    errorPrint ("graphLoadBin: invalid graph data (2)");
+    graphFree  (grafptr);
+    return (1);
+  }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadBin: inconsistent graph data (2)");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine unmaps the file area of a
+** graph loaded in place by graphLoadBin().
+** It is only called by graphFree().
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+graphFreeBin (
+Graph * const               grafptr)
+{
+#ifdef GRAPHIOBINMMAP
+  GraphIoBinHead *    headptr;
+
+  headptr = (GraphIoBinHead *) ((byte *) (grafptr->verttax + grafptr->baseval) - sizeof (GraphIoBinHead));
+  munmap ((void *) headptr, (size_t) headptr->filesiz);
+#endif /* GRAPHIOBINMMAP */
+}
+
+/* This routine saves a source graph to
+** the given stream, in the native binary
+** format.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSaveBin (
+const Graph * const         grafptr,
+FILE * const                stream)
+{
+  GraphIoBinHead      headdat;
+  const Genum * restrict verttax;
+  const Genum * restrict vendtax;
+  Gnum                baseval;
+  Gnum                vertnum;
+  int                 compflag;
+  int                 o;
+
+  baseval = grafptr->baseval;
+  verttax = grafptr->verttax;
+  vendtax = grafptr->vendtax;
+  compflag = (vendtax == (verttax + 1)) &&        /* Graph arrays can be written as is if compact and starting at base */
+             (verttax[baseval] == baseval);
+
+  memSet (&headdat, 0, sizeof (GraphIoBinHead));
+  memCpy (headdat.magitab, GRAPHIOBINMAGIC, sizeof (headdat.magitab));
+  headdat.endival  = GRAPHIOBINENDIAN;
+  headdat.gnumsiz  = (UINT32) sizeof (Gnum);
+  headdat.genumsiz = (UINT32) sizeof (Genum);
+  headdat.versval  = GRAPHIOBINVERSION;
+  headdat.propval  = ((grafptr->vlbltax != NULL) ? GRAPHIOBINPROPVLBL : 0) |
+                     ((grafptr->velotax != NULL) ? GRAPHIOBINPROPVELO : 0) |
+                     ((grafptr->edlotax != NULL) ? GRAPHIOBINPROPEDLO : 0);
+  headdat.baseval  = (UINT64) baseval;
+  headdat.vertnbr  = (UINT64) grafptr->vertnbr;
+  headdat.edgenbr  = (UINT64) grafptr->edgenbr;
+  headdat.velosum  = (UINT64) grafptr->velosum;
+  headdat.edlosum  = (UINT64) grafptr->edlosum;
+  headdat.degrmax  = (UINT64) grafptr->degrmax;
+  headdat.filesiz  = (UINT64) (sizeof (GraphIoBinHead) +
+                               graphIoBinSize (headdat.vertnbr + 1, sizeof (Genum)) +
+                               graphIoBinSize (headdat.edgenbr,     sizeof (Gnum)) +
+                               (((headdat.propval & GRAPHIOBINPROPVELO) != 0) ? graphIoBinSize (headdat.vertnbr, sizeof (Gnum)) : 0) +
+                               (((headdat.propval & GRAPHIOBINPROPVLBL) != 0) ? graphIoBinSize (headdat.vertnbr, sizeof (Gnum)) : 0) +
+                               (((headdat.propval & GRAPHIOBINPROPEDLO) != 0) ? graphIoBinSize (headdat.edgenbr, sizeof (Gnum)) : 0));
+
+  if (fwrite (&headdat, sizeof (GraphIoBinHead), 1, stream) != 1) {
+    errorPrint ("graphSaveBin: bad output (1)");
+    return (1);
+  }
+
+  if (compflag != 0)                              /* Write vertex array */
+    o = graphIoBinWrite (stream, verttax + baseval, grafptr->vertnbr + 1, sizeof (Genum));
+  else {                                          /* Build compact vertex array on the fly */
+    Genum               buftab[GRAPHIOBINBUFNBR];
+    Gnum                bufnbr;
+    Genum               edgenum;
+
+    o = 0;
+    for (vertnum = baseval, edgenum = baseval, bufnbr = 0; (o == 0) && (vertnum < grafptr->vertnnd); vertnum ++) {
+      buftab[bufnbr ++] = edgenum;
+      edgenum += vendtax[vertnum] - verttax[vertnum];
+      if (bufnbr == GRAPHIOBINBUFNBR) {
+        o = (fwrite (buftab, sizeof (Genum), (size_t) bufnbr, stream) != (size_t) bufnbr);
+        bufnbr = 0;
+      }
+    }
+    buftab[bufnbr ++] = edgenum;                  /* Buffer cannot be full after last flush */
+    o |= (fwrite (buftab, sizeof (Genum), (size_t) bufnbr, stream) != (size_t) bufnbr);
+    o |= graphIoBinPad (stream, grafptr->vertnbr + 1, sizeof (Genum));
+  }
+  if ((o == 0) && (grafptr->velotax != NULL))
+    o = graphIoBinWrite (stream, grafptr->velotax + baseval, grafptr->vertnbr, sizeof (Gnum));
+  if ((o == 0) && (grafptr->vlbltax != NULL))
+    o = graphIoBinWrite (stream, grafptr->vlbltax + baseval, grafptr->vertnbr, sizeof (Gnum));
+
+  if (compflag != 0) {                            /* Write edge arrays */
+    if (o == 0)
+      o = graphIoBinWrite (stream, grafptr->edgetax + baseval, grafptr->edgenbr, sizeof (Gnum));
+    if ((o == 0) && (grafptr->edlotax != NULL))
+      o = graphIoBinWrite (stream, grafptr->edlotax + baseval, grafptr->edgenbr, sizeof (Gnum));
+  }
+  else {                                          /* Write edge arrays vertex by vertex, then padding */
+    const Gnum *        datatax;
+
+    for (datatax = grafptr->edgetax; (o == 0) && (datatax != NULL);
+         datatax = (datatax == grafptr->edgetax) ? grafptr->edlotax : NULL) {
+      for (vertnum = baseval; (o == 0) && (vertnum < grafptr->vertnnd); vertnum ++) {
+        Gnum                degrval;
+
+        degrval = vendtax[vertnum] - verttax[vertnum];
+        o = (fwrite (datatax + verttax[vertnum], sizeof (Gnum), (size_t) degrval, stream) != (size_t) degrval);
+      }
+      if (o == 0)
+        o = graphIoBinPad (stream, grafptr->edgenbr, sizeof (Gnum));
+    }
+  }
+
+  if (o != 0)
+    errorPrint ("graphSaveBin: bad output (2)");
+
+  return (o);
+}
+
+/* This routine loads the geometrical graph
+** in the native binary graph format.
+** Geometry data is not handled.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomLoadBin (
+Graph * restrict const      grafptr,              /* Graph to load    */
+Geom * restrict const       geomptr,              /* Geometry to load */
+FILE * const                filesrcptr,           /* Topological data */
+FILE * const                filegeoptr,           /* No use           */
+const char * const          dataptr)              /* No use           */
+{
+  return (graphLoadBin (grafptr, filesrcptr, -1, 0));
+}
+
+/* This routine saves the geometrical graph
+** in the native binary graph format.
+** Geometry data is not handled.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomSaveBin (
+const Graph * restrict const  grafptr,            /* Graph to save    */
+const Geom * restrict const   geomptr,            /* Geometry to save */
+FILE * const                  filesrcptr,         /* Topological data */
+FILE * const                  filegeoptr,         /* No use           */
+const char * const            dataptr)            /* No use           */
+{
+  return (graphSaveBin (grafptr, filesrcptr));
+}
@@ -0,0 +1,116 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.h                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the native binary graph format.     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ File identification. The first character
+    of the magic string must not be a digit
+    nor a blank, so that binary files can be
+    told apart from Scotch text graph files.  +*/
+
+#define GRAPHIOBINMAGIC             "SCOTCHGB"    /*+ Magic string (8 characters, no terminator) +*/
+#define GRAPHIOBINVERSION           0             /*+ Version of binary format                   +*/
+#define GRAPHIOBINENDIAN            0x01020304    /*+ Endianness marker, in writer byte order    +*/
+#define GRAPHIOBINENDIANSWAP        0x04030201    /*+ Endianness marker, as seen when swapped    +*/
+
+/*+ Property flags. +*/
+
+#define GRAPHIOBINPROPVLBL          0x0001        /*+ Vertex label array present +*/
+#define GRAPHIOBINPROPVELO          0x0002        /*+ Vertex load array present  +*/
+#define GRAPHIOBINPROPEDLO          0x0004        /*+ Edge load array present    +*/
+
+/*+ Section alignment, in bytes. +*/
+
+#define GRAPHIOBINALIGN             8
+
+/*+ Number of integers converted at once when
+    file and memory integer widths differ.     +*/
+
+#define GRAPHIOBINBUFNBR            4096
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The binary file header. It is followed by the
+    verttab, velotab, vlbltab, edgetab and edlotab
+    sections, in this order, each of them padded to
+    GRAPHIOBINALIGN bytes. Absent arrays take no space.
+    The vertex array is always compact, that is, it
+    holds (vertnbr + 1) values, of width genumsiz;
+    all other arrays hold integers of width gnumsiz. All arrays are based
+    with respect to baseval. The header size must be
+    a multiple of GRAPHIOBINALIGN.                    +*/
+
+typedef struct GraphIoBinHead_ {
+  char                      magitab[8];           /*+ Magic string                           +*/
+  UINT32                    endival;              /*+ Endianness marker                      +*/
+  UINT32                    gnumsiz;              /*+ Size of array integers, in bytes       +*/
+  UINT32                    versval;              /*+ Format version                         +*/
+  UINT32                    propval;              /*+ Property flags                         +*/
+  UINT32                    genumsiz;             /*+ Size of vertex array indices, in bytes +*/
+  UINT32                    padval;               /*+ Padding, set to zero                   +*/
+  UINT64                    baseval;              /*+ Base value of arrays                   +*/
+  UINT64                    vertnbr;              /*+ Number of vertices                     +*/
+  UINT64                    edgenbr;              /*+ Number of arcs                         +*/
+  UINT64                    velosum;              /*+ Sum of vertex loads                    +*/
+  UINT64                    edlosum;              /*+ Sum of edge loads                      +*/
+  UINT64                    degrmax;              /*+ Maximum degree                         +*/
+  UINT64                    filesiz;              /*+ Overall file size, header included     +*/
+} GraphIoBinHead;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_IO_BIN
+static void                 graphIoBinSwap      (void * const, const size_t, const size_t);
+static size_t               graphIoBinSize      (const UINT64, const UINT32);
+static int                  graphIoBinRead      (FILE * const, void * const, const Genum, const UINT32, const size_t, const int);
+static int                  graphIoBinPad       (FILE * const, const Genum, const size_t);
+static int                  graphIoBinWrite     (FILE * const, const void * const, const Genum, const size_t);
+#endif /* SCOTCH_GRAPH_IO_BIN */
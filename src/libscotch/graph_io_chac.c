@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2013,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2013,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.0  : from : 10 oct 2013     **/
 /**                                 to   : 03 aug 2016     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,10 +61,230 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_GRAPH_IO_CHAC
+
 #include "module.h"
 #include "common.h"
 #include "geom.h"
 #include "graph.h"
+#include "graph_io_chac.h"
+#include "graph_io_text.h"
+
+/* This routine counts the number of vertices
+** and edges contained in the given text part.
+** In the Chaco format, every line which is not
+** a comment line holds exactly one vertex.
+** Values are only checked for syntax.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphGeomLoadChacCount (
+const GraphGeomChacData * restrict const  loadptr,
+const char *                              dataptr,
+const char * const                        dataend,
+GraphGeomChacThread * restrict const      thrdptr)
+{
+  Gnum                vertnbr;
+  Genum               edgenbr;
+  Gnum                headnbr;                    /* Number of values before edges */
+  Gnum                arcsnbr;                    /* Number of values per arc      */
+
+  const Graph * restrict const  grafptr = loadptr->grafptr;
+
+  headnbr = ((grafptr->vlbltax != NULL) ? 1 : 0) + ((grafptr->velotax != NULL) ? 1 : 0);
+  arcsnbr = (grafptr->edlotax != NULL) ? 2 : 1;
+
+  for (vertnbr = edgenbr = 0; dataptr < dataend; dataptr = graphIoTextLine (dataptr)) {
+    Gnum                valunbr;
+    Gnum                valutmp;
+
+    if (*dataptr == '%')                          /* Skip comment lines */
+      continue;
+
+    for (valunbr = 0; ; valunbr ++) {             /* Count values till end of line */
+      dataptr = graphIoTextBlank (dataptr);
+      if ((*dataptr == '\n') || (*dataptr == '\0'))
+        break;
+      if (graphIoTextInt (&dataptr, &valutmp) != 1)
+        return (1);
+    }
+    valunbr -= headnbr;
+    if ((valunbr < 0) || ((valunbr % arcsnbr) != 0))
+      return (1);
+
+    vertnbr ++;
+    edgenbr += valunbr / arcsnbr;
+  }
+
+  thrdptr->vertbas = vertnbr;
+  thrdptr->edgebas = edgenbr;
+
+  return (0);
+}
+
+/* This routine reads the vertices of the
+** given range of the graph, starting from
+** the given text position.
+** It returns:
+** - 0   : on success.
+** - !0  : error code, as the number of the
+**         diagnostic of the sequential loader.
+*/
+
+static
+int
+graphGeomLoadChacFill (
+const GraphGeomChacData * restrict const  loadptr,
+const char *                              dataptr,
+GraphGeomChacThread * restrict const      thrdptr)
+{
+  Gnum                vertnum;
+  Genum               edgenum;
+  Gnum                vlblmax;
+  Gnum                velosum;
+  Gnum                edlosum;
+  Gnum                degrmax;
+
+  const Graph * restrict const  grafptr = loadptr->grafptr;
+  Genum * restrict const         verttax = grafptr->verttax;
+  Gnum * restrict const         velotax = grafptr->velotax;
+  Gnum * restrict const         vlbltax = grafptr->vlbltax;
+  Gnum * restrict const         edgetax = grafptr->edgetax;
+  Gnum * restrict const         edlotax = grafptr->edlotax;
+  const Gnum                    vertnbr = grafptr->vertnbr;
+  const Genum                   edgennd = thrdptr->edgennd;
+
+  vlblmax =
+  velosum =
+  edlosum =
+  degrmax = 0;
+  for (vertnum = thrdptr->vertbas, edgenum = thrdptr->edgebas;
+       vertnum < thrdptr->vertnnd; dataptr = graphIoTextLine (dataptr)) {
+    if (*dataptr == '%')                          /* Skip comment lines */
+      continue;
+
+    if (vlbltax != NULL) {
+      dataptr = graphIoTextBlank (dataptr);
+      if ((graphIoTextInt (&dataptr, &vlbltax[vertnum]) != 1) ||
+          (vlbltax[vertnum] < 1)                              ||
+          (vlbltax[vertnum] > vertnbr))
+        return (2);
+      if (vlbltax[vertnum] > vlblmax)
+        vlblmax = vlbltax[vertnum];
+    }
+    if (velotax != NULL) {
+      dataptr = graphIoTextBlank (dataptr);
+      if ((graphIoTextInt (&dataptr, &velotax[vertnum]) != 1) ||
+          (velotax[vertnum] < 1))
+        return (3);
+      velosum += velotax[vertnum];
+    }
+    verttax[vertnum] = edgenum;                   /* Set based edge array index */
+
+    while (1) {                                   /* Read graph edges */
+      Gnum                vertend;
+
+      dataptr = graphIoTextBlank (dataptr);
+      if ((*dataptr == '\n') || (*dataptr == '\0')) /* Exit loop if line is complete */
+        break;
+
+      if ((graphIoTextInt (&dataptr, &vertend) != 1) ||
+          (vertend < 1)                              ||
+          (vertend > vertnbr))
+        return (4);
+      if (edgenum >= edgennd)                     /* Test edge array overflow */
+        return (5);
+      if (edlotax != NULL) {
+        dataptr = graphIoTextBlank (dataptr);
+        if ((graphIoTextInt (&dataptr, &edlotax[edgenum]) != 1) ||
+            (edlotax[edgenum] < 1))
+          return (4);
+        edlosum += edlotax[edgenum];
+      }
+      edgetax[edgenum ++] = vertend;
+    }
+
+    if ((edgenum - verttax[vertnum]) > degrmax)
+      degrmax = edgenum - verttax[vertnum];
+    vertnum ++;
+  }
+
+  thrdptr->edgennd = edgenum;                     /* Record end of edge range */
+  thrdptr->vlblmax = vlblmax;
+  thrdptr->velosum = velosum;
+  thrdptr->edlosum = edlosum;
+  thrdptr->degrmax = degrmax;
+
+  return (0);
+}
+
+/* This routine is the threaded core of the
+** Chaco loading routine. Every thread first
+** counts the vertices and edges of its part
+** of the text window. Then, once the start
+** indices of all parts are known, it fills
+** its share of the graph arrays.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphGeomLoadChacThread (
+ThreadDescriptor * restrict const   descptr,
+GraphGeomChacData * restrict const  loadptr)
+{
+  const char *        databeg;
+  const char *        dataend;
+
+  const int                             thrdnum = threadNum (descptr);
+  GraphGeomChacThread * restrict const  thrdptr = &loadptr->thrdtab[thrdnum];
+
+  databeg =
+  dataend = NULL;
+  if (thrdnum < loadptr->partnbr) {
+    graphIoTextPart (loadptr->databeg, loadptr->dataend, thrdnum, loadptr->partnbr, &databeg, &dataend);
+    thrdptr->flagval = graphGeomLoadChacCount (loadptr, databeg, dataend, thrdptr);
+  }
+
+  threadBarrier (descptr);
+
+  if (thrdnum == 0) {                             /* Compute part start indices */
+    const Graph * restrict const  grafptr = loadptr->grafptr;
+    Gnum                          vertnum;
+    Genum                         edgenum;
+    int                           partnum;
+
+    for (partnum = 0, vertnum = loadptr->vertbas, edgenum = loadptr->edgebas;
+         partnum < loadptr->partnbr; partnum ++) {
+      GraphGeomChacThread * restrict const  partptr = &loadptr->thrdtab[partnum];
+      Gnum                                  vertnbr;
+      Genum                                 edgenbr;
+
+      if (partptr->flagval != 0)                  /* Syntax errors are reported as edge errors */
+        loadptr->flagval = 4;
+      vertnbr = partptr->vertbas;
+      edgenbr = partptr->edgebas;
+      partptr->vertbas = vertnum;
+      partptr->edgebas = MIN (edgenum, grafptr->edgenbr + 1);
+      vertnum = MIN (vertnum + vertnbr, grafptr->vertnnd); /* Extra lines are ignored */
+      edgenum += edgenbr;
+      partptr->vertnnd = vertnum;
+      partptr->edgennd = MIN (edgenum, grafptr->edgenbr + 1); /* Do not write past edge array */
+    }
+  }
+
+  threadBarrier (descptr);
+
+  thrdptr->flagval = 0;
+  if ((thrdnum < loadptr->partnbr) &&
+      (loadptr->flagval == 0))
+    thrdptr->flagval = graphGeomLoadChacFill (loadptr, databeg, thrdptr);
+}
 
 /* This routine loads the geometrical graph
 ** in the Chaco graph format, and allocates
@@ -79,24 +299,28 @@ Graph * restrict const      grafptr,              /* Graph to load    */
 Geom * restrict const       geomptr,              /* Geometry to load */
 FILE * const                filesrcptr,           /* Topological data */
 FILE * const                filegeoptr,           /* No use           */
-const char * const          dataptr)              /* No use           */
+const char * const          dataptr,              /* No use           */
+Context * restrict const    contptr)              /* Execution context */
 {
+  GraphIoText       textdat;                      /* Text buffer                */
+  GraphGeomChacData loaddat;                      /* Loading data               */
   char              chalinetab[80];               /* Header line                */
   long              chavertnbr;                   /* Number of vertices         */
-  Gnum              chavertnum;                   /* Number of vertex read      */
   long              chaedgenbr;                   /* Number of edges            */
   long              chaflagval;                   /* Flag on numeric form       */
   char              chaflagstr[4];                /* Flag for optional data     */
   int               chabuffcar;                   /* Buffer for line processing */
-  Gnum              vertnum;
   Gnum              velosiz;
   Gnum              velosum;
   Gnum              vlblsiz;
   Gnum              vlblmax;
-  Gnum              edgenum;
+  Gnum              vertnum;
+  Genum             edgenum;
   Gnum              edlosiz;
   Gnum              edlosum;
   Gnum              degrmax;
+  int               thrdnbr;
+  int               partnum;
 
   do {                                            /* Skip comment lines   */
     chabuffcar = getc (filesrcptr);               /* Read first character */
@@ -137,7 +361,7 @@ const char * const          dataptr)              /* No use           */
   edlosiz = (chaflagstr[2] != '0') ? grafptr->edgenbr : 0;
 
   if ((memAllocGroup ((void **) (void *)
-                      &grafptr->verttax, (size_t) (grafptr->vertnnd * sizeof (Gnum)),
+                      &grafptr->verttax, (size_t) (grafptr->vertnnd * sizeof (Genum)),
                       &grafptr->velotax, (size_t) (velosiz          * sizeof (Gnum)),
                       &grafptr->vlbltax, (size_t) (vlblsiz          * sizeof (Gnum)), NULL) == NULL) ||
       (memAllocGroup ((void **) (void *)
@@ -169,71 +393,57 @@ const char * const          dataptr)              /* No use           */
     edlosum = grafptr->edgenbr;
   }
 
-  for (vertnum = edgenum = 1, degrmax = vlblmax = 0;
-       vertnum < grafptr->vertnnd; vertnum ++) {
-    do {                                          /* Skip comment lines   */
-      chabuffcar = getc (filesrcptr);             /* Read first character */
-      if (chabuffcar == '%') {                    /* If comment line      */
-        fscanf (filesrcptr, "%*[^\n]");           /* Purge line           */
-        getc   (filesrcptr);                      /* Purge newline        */
-      }
-    } while (chabuffcar == '%');
-    ungetc (chabuffcar, filesrcptr);              /* Put character back to filesrcptr */
+  thrdnbr = contextThreadNbr (contptr);
+  if (graphIoTextInit (&textdat, filesrcptr) != 0) {
+    errorPrint ("graphGeomLoadChac: cannot initialize text buffer");
+    graphFree  (grafptr);
+    return     (1);
+  }
+  if ((loaddat.thrdtab = (GraphGeomChacThread *) memAlloc (thrdnbr * sizeof (GraphGeomChacThread))) == NULL) {
+    errorPrint      ("graphGeomLoadChac: out of memory");
+    graphIoTextExit (&textdat);
+    graphFree       (grafptr);
+    return          (1);
+  }
+  loaddat.grafptr = grafptr;
+  loaddat.flagval = 0;
 
-    if (grafptr->vlbltax != NULL) {
-      if ((intLoad (filesrcptr, &grafptr->vlbltax[vertnum]) != 1) ||
-          (grafptr->vlbltax[vertnum] < 1)                         ||
-          (grafptr->vlbltax[vertnum] > chavertnbr)) {
-        errorPrint ("graphGeomLoadChac: bad input (2)");
-        graphFree  (grafptr);
-        return     (1);
-      }
-      if (grafptr->vlbltax[vertnum] > vlblmax)
-        vlblmax = grafptr->vlbltax[vertnum];
+  for (vertnum = edgenum = 1, degrmax = vlblmax = 0; /* Chaco graphs are based */
+       (vertnum < grafptr->vertnnd) && (loaddat.flagval == 0); ) {
+    if (graphIoTextRead (&textdat, NULL, &loaddat.databeg, &loaddat.dataend) != 0) { /* Read next window of vertex lines */
+      loaddat.flagval = 2;                        /* Not enough vertex lines */
+      break;
     }
-    if (grafptr->velotax != NULL) {
-      if ((intLoad (filesrcptr, &grafptr->velotax[vertnum]) != 1) ||
-          (grafptr->velotax[vertnum] < 1)) {
-        errorPrint ("graphGeomLoadChac: bad input (3)");
-        graphFree  (grafptr);
-        return     (1);
-      }
-      velosum += grafptr->velotax[vertnum];
-    }
-    grafptr->verttax[vertnum] = edgenum;          /* Set based edge array index */
-
-    while (1) {                                   /* Read graph edges              */
-      fscanf (filesrcptr, "%*[ \t\r]");           /* Skip white spaces except '\n' */
-      chabuffcar = getc (filesrcptr);             /* Read next char                */
-      if (chabuffcar == EOF)                      /* If end of file reached        */
-        chabuffcar = '\n';                        /* Indicate line as complete     */
-      if (chabuffcar == '\n')                     /* Exit loop if line is complete */
-        break;
+    loaddat.vertbas = vertnum;
+    loaddat.edgebas = edgenum;
+    loaddat.partnbr = graphIoTextPartNbr (loaddat.databeg, loaddat.dataend, thrdnbr);
+    contextThreadLaunch (contptr, (ThreadFunc) graphGeomLoadChacThread, (void *) &loaddat);
 
-      ungetc (chabuffcar, filesrcptr);            /* Else put character back to stream */
-
-      if ((intLoad (filesrcptr, &chavertnum) != 1) ||
-          (chavertnum < 1)                         ||
-          (chavertnum > chavertnbr)                ||
-          ((grafptr->edlotax != NULL) &&
-           ((intLoad (filesrcptr, &grafptr->edlotax[edgenum]) != 1) ||
-            (edlosum += grafptr->edlotax[edgenum], grafptr->edlotax[edgenum] < 1)))) {
-        errorPrint ("graphGeomLoadChac: bad input (4)");
-        graphFree  (grafptr);
-        return     (1);
-      }
-      if (edgenum > (grafptr->edgenbr + 1)) { /* Test edge array overflow */
-        errorPrint ("graphGeomLoadChac: bad input (5)");
-        graphFree  (grafptr);
-        return     (1);
-      }
-      grafptr->edgetax[edgenum ++] = chavertnum;
-    }
+    for (partnum = 0; partnum < loaddat.partnbr; partnum ++) { /* Reduce part values */
+      const GraphGeomChacThread * restrict const  partptr = &loaddat.thrdtab[partnum];
 
-    if ((edgenum - grafptr->verttax[vertnum]) > degrmax)
-      degrmax = edgenum - grafptr->verttax[vertnum];
+      if ((loaddat.flagval == 0) && (partptr->flagval != 0)) /* Report first error */
+        loaddat.flagval = partptr->flagval;
+      if (partptr->vertnnd > partptr->vertbas)    /* If part holds vertices, record its end of edge range */
+        edgenum = partptr->edgennd;
+      if (partptr->vlblmax > vlblmax)
+        vlblmax = partptr->vlblmax;
+      if (partptr->degrmax > degrmax)
+        degrmax = partptr->degrmax;
+      velosum += partptr->velosum;
+      edlosum += partptr->edlosum;
+    }
+    vertnum = loaddat.thrdtab[loaddat.partnbr - 1].vertnnd; /* Resume after last vertex read */
   }
-  grafptr->verttax[vertnum] = edgenum;            /* Set end of based vertex array */
+  memFree         (loaddat.thrdtab);
+  graphIoTextExit (&textdat);
+  if (loaddat.flagval != 0) {
+    errorPrint ("graphGeomLoadChac: bad input (%d)", loaddat.flagval);
+    graphFree  (grafptr);
+    return     (1);
+  }
+
+  grafptr->verttax[grafptr->vertnnd] = edgenum;   /* Set end of based vertex array */
   grafptr->velosum = velosum;
   grafptr->edlosum = edlosum;
   grafptr->degrmax = degrmax;
@@ -276,15 +486,15 @@ const char * const            dataptr)            /* No use           */
 {
   Gnum              baseadj;                      /* Base adjustment  */
   Gnum              vertnum;                      /* Current vertex   */
-  Gnum              edgenum;                      /* Current edge     */
+  Genum             edgenum;                      /* Current edge     */
   char *            sepaptr;                      /* Separator string */
   int               o;
 
   baseadj = 1 - grafptr->baseval;                 /* Output base is always 1 */
 
-  o = (fprintf (filesrcptr, GNUMSTRING "\t" GNUMSTRING "\t%c%c%c\n", /* Write graph header */
-                (Gnum)  grafptr->vertnbr,
-                (Gnum) (grafptr->edgenbr / 2),
+  o = (fprintf (filesrcptr, GNUMSTRING "\t" GENUMSTRING "\t%c%c%c\n", /* Write graph header */
+                (Gnum)   grafptr->vertnbr,
+                (Genum) (grafptr->edgenbr / 2),
                 ((grafptr->vlbltax != NULL) ? '1' : '0'),
                 ((grafptr->velotax != NULL) ? '1' : '0'),
                 ((grafptr->edlotax != NULL) ? '1' : '0')) < 0);
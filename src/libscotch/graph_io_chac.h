@@ -0,0 +1,91 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_chac.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the Chaco graph format handling     **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block of the
+    multithreaded loading routine. On the
+    first pass, vertbas and edgebas hold the
+    number of vertices and edges of the part;
+    they are then turned into the indices of
+    its first vertex and edge.                 +*/
+
+typedef struct GraphGeomChacThread_ {
+  Gnum                      vertbas;              /*+ Number of first vertex of part +*/
+  Gnum                      vertnnd;              /*+ After-last vertex of part      +*/
+  Genum                     edgebas;              /*+ Index of first edge of part    +*/
+  Genum                     edgennd;              /*+ After-last edge of part        +*/
+  Gnum                      vlblmax;              /*+ Maximum vertex label           +*/
+  Gnum                      velosum;              /*+ Partial sum of vertex loads    +*/
+  Gnum                      edlosum;              /*+ Partial sum of edge loads      +*/
+  Gnum                      degrmax;              /*+ Maximum degree                 +*/
+  int                       flagval;              /*+ Part parsing status            +*/
+} GraphGeomChacThread;
+
+/*+ The loading data shared by all threads. +*/
+
+typedef struct GraphGeomChacData_ {
+  Graph *                   grafptr;              /*+ Graph being loaded                   +*/
+  const char *              databeg;              /*+ Start of text window                 +*/
+  const char *              dataend;              /*+ End of text window                   +*/
+  Gnum                      vertbas;              /*+ First vertex of text window          +*/
+  Genum                     edgebas;              /*+ First edge of text window            +*/
+  int                       partnbr;              /*+ Number of text parts                 +*/
+  int                       flagval;              /*+ Loading status                       +*/
+  GraphGeomChacThread *     thrdtab;              /*+ Array of thread data blocks          +*/
+} GraphGeomChacData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_IO_CHAC
+static int                  graphGeomLoadChacCount (const GraphGeomChacData * restrict const, const char *, const char * const, GraphGeomChacThread * restrict const);
+static int                  graphGeomLoadChacFill (const GraphGeomChacData * restrict const, const char *, GraphGeomChacThread * restrict const);
+static void                 graphGeomLoadChacThread (ThreadDescriptor * restrict const, GraphGeomChacData * restrict const);
+#endif /* SCOTCH_GRAPH_IO_CHAC */
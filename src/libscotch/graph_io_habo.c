@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2016,2018,2019,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2016,2018,2019,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 04 aug 2016     **/
 /**                                 to   : 27 aug 2019     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 31 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -99,9 +99,9 @@ const char * const          dataptr)              /* Tag value        */
   GraphGeomHaboHash * restrict  hashtab;          /* Neighbor hash table             */
   Gnum                          hashmsk;          /* Mask for access to hash table   */
   Gnum                          vertnum;          /* Number of current vertex        */
-  Gnum                          edgenum;          /* Number of current edge (arc)    */
+  Genum                         edgenum;          /* Number of current edge (arc)    */
   Gnum                          edgeold;          /* Number of non-purged edge       */
-  Gnum                          edgetmp;          /* Temporary edge number           */
+  Genum                         edgetmp;          /* Temporary edge number           */
   Gnum                          degrmax;          /* Maximum degree                  */
   int                           c;
 
@@ -184,7 +184,7 @@ const char * const          dataptr)              /* Tag value        */
     return (1);
   }
 
-  if (((grafptr->verttax = (Gnum *) memAlloc ((habcolnbr + 1) * sizeof (Gnum))) == NULL) ||
+  if (((grafptr->verttax = (Genum *) memAlloc ((habcolnbr + 1) * sizeof (Genum))) == NULL) ||
       (memAllocGroup ((void **) (void *)
                       &grafptr->edgetax, (size_t) (habnzrnbr * 2   * sizeof (Gnum)),
                       &habcoltab,        (size_t) ((habcolnbr + 1) * sizeof (Gnum)),
@@ -245,7 +245,7 @@ const char * const          dataptr)              /* Tag value        */
     return (1);
   }
 
-  memSet (grafptr->vendtax, 0, habcolnbr * sizeof (Gnum)); /* Here, vendtax = verttab */
+  memSet (grafptr->vendtax, 0, habcolnbr * sizeof (Genum)); /* Here, vendtax = verttab */
 
   for (vertnum = 1, habnzrnum = 0, habvalnum = habnzrfmt.datanbr; /* Start by eating end of previous line  */
        vertnum < grafptr->vertnnd; vertnum ++) {  /* Read matrix pattern                                   */
@@ -284,7 +284,7 @@ const char * const          dataptr)              /* Tag value        */
 
   degrmax = 1;
   for (vertnum = edgenum = 1; vertnum < grafptr->vertnnd; vertnum ++) { /* Build (superset of) vertex array */
-    Gnum              edgetmp;
+    Genum             edgetmp;
 
     edgetmp = grafptr->verttax[vertnum];
     grafptr->verttax[vertnum] = edgenum;
@@ -1,4 +1,4 @@
-/* Copyright 2008,2010,2016,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2010,2016,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 04 aug 2016     **/
 /**                                 to   : 04 aug 2016     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -55,11 +55,14 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_GRAPH_IO_MMKT
+
 #include "module.h"
 #include "common.h"
 #include "geom.h"
 #include "graph.h"
 #include "graph_io_mmkt.h"
+#include "graph_io_text.h"
 
 /********************************************************/
 /*                                                      */
@@ -67,8 +70,115 @@
 /*                                                      */
 /********************************************************/
 
+/* This routine is the threaded core of the
+** Matrix Market loading routine. Every thread
+** first counts the entry lines of its part of
+** the text window. Then, once the index of the
+** first entry line of every part is known, it reads
+** its entries and records them, along with
+** their symmetric counterparts, in the edge
+** array. Loop edges are replaced by pairs of
+** out-of-range indices, which will be sorted
+** after all regular edges.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphGeomLoadMmktThread (
+ThreadDescriptor * restrict const   descptr,
+GraphGeomMmktData * restrict const  loadptr)
+{
+  const char *        dataptr;
+  const char *        dataend;
+  Gnum                linenum;
+  Gnum                loopnbr;
+
+  const int                             thrdnum = threadNum (descptr);
+  GraphGeomMmktThread * restrict const  thrdptr = &loadptr->thrdtab[thrdnum];
+  GraphGeomMmktEdge * restrict const    sorttab = loadptr->sorttab;
+  const Gnum                            baseval = loadptr->baseval;
+  const Gnum                            vertnnd = loadptr->vertnnd;
+
+  dataptr =
+  dataend = NULL;
+  if (thrdnum < loadptr->partnbr) {
+    Gnum                linenbr;
+
+    graphIoTextPart (loadptr->databeg, loadptr->dataend, thrdnum, loadptr->partnbr, &dataptr, &dataend);
+
+    for (dataptr = graphIoTextBlank (dataptr), linenbr = 0; dataptr < dataend; /* Count entry lines */
+         dataptr = graphIoTextBlank (graphIoTextLine (dataptr))) {
+      if ((*dataptr != '\n') && (*dataptr != '%') && (*dataptr != '\0')) /* Skip empty and comment lines */
+        linenbr ++;
+    }
+    thrdptr->linebas = linenbr;
+  }
+
+  threadBarrier (descptr);
+
+  if (thrdnum == 0) {                             /* Compute part start indices */
+    int                 partnum;
+
+    for (partnum = 0, linenum = loadptr->linebas; partnum < loadptr->partnbr; partnum ++) {
+      GraphGeomMmktThread * restrict const  partptr = &loadptr->thrdtab[partnum];
+      Gnum                                  linenbr;
+
+      linenbr = partptr->linebas;
+      partptr->linebas = linenum;
+      linenum += linenbr;
+      partptr->linennd = MIN (linenum, loadptr->linenbr); /* Extra lines are ignored */
+    }
+  }
+
+  threadBarrier (descptr);
+
+  thrdptr->loopnbr = 0;
+  thrdptr->flagval = 0;
+  if (thrdnum >= loadptr->partnbr)
+    return;
+
+  graphIoTextPart (loadptr->databeg, loadptr->dataend, thrdnum, loadptr->partnbr, &dataptr, &dataend);
+  for (linenum = thrdptr->linebas, loopnbr = 0; linenum < thrdptr->linennd;
+       dataptr = graphIoTextLine (dataptr)) {
+    Gnum                vertnum;
+    Gnum                vertend;
+
+    dataptr = graphIoTextBlank (dataptr);
+    if ((*dataptr == '\n') || (*dataptr == '%'))  /* Skip empty and comment lines */
+      continue;
+
+    if ((graphIoTextInt (&dataptr, &vertnum) != 1) || /* Read edge ends */
+        ((dataptr = graphIoTextBlank (dataptr)), (graphIoTextInt (&dataptr, &vertend) != 1))) {
+      thrdptr->flagval = 1;
+      return;
+    }
+    if ((vertnum < baseval) || (vertnum >= vertnnd) ||
+        (vertend < baseval) || (vertend >= vertnnd)) {
+      thrdptr->flagval = 2;
+      return;
+    }
+
+    if (vertnum == vertend) {                     /* If loop edge, push it after all regular edges */
+      vertnum =
+      vertend = vertnnd;
+      loopnbr ++;
+    }
+    sorttab[2 * linenum].vertnum[0]     =         /* Add edge and its symmetric */
+    sorttab[2 * linenum + 1].vertnum[1] = vertnum;
+    sorttab[2 * linenum].vertnum[1]     =
+    sorttab[2 * linenum + 1].vertnum[0] = vertend;
+    linenum ++;
+  }
+  thrdptr->loopnbr = loopnbr;
+}
+
 /* This routine loads a source graph from
 ** the given stream, corresponding to a MatrixMarket file.
+** Entry lines are read by large windows, each
+** of which is parsed by the threads of the
+** given context.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -80,8 +190,11 @@ Graph * restrict const      grafptr,              /* Graph to load    */
 Geom * restrict const       geomptr,              /* Geometry to load */
 FILE * const                filesrcptr,           /* Topological data */
 FILE * const                filegeoptr,           /* No use           */
-const char * const          dataptr)              /* Fake base value  */
+const char * const          dataptr,              /* Fake base value  */
+Context * restrict const    contptr)              /* Execution context */
 {
+  GraphIoText         textdat;
+  GraphGeomMmktData   loaddat;
   Gnum                baseval;
   Gnum                mrownbr;
   Gnum                mcolnbr;
@@ -93,12 +206,14 @@ const char * const          dataptr)              /* Fake base value  */
   Gnum                sortnbr;
   Gnum                sortnum;
   Gnum *              edgetax;
-  Gnum                edgenum;
-  Gnum                edgetmp;
+  Genum               edgenum;
+  Genum               edgetmp;
   Gnum                degrmax;
   char                linetab[1025];
   char *              lineptr;
   char                c;
+  int                 thrdnbr;
+  int                 partnum;
 
   baseval = 1;                                    /* Regular MatrixMarket indices start from 1 */
 
@@ -153,7 +268,7 @@ const char * const          dataptr)              /* Fake base value  */
   grafptr->vertnbr = mrownbr;
   grafptr->vertnnd = grafptr->vertnbr + baseval;
 
-  if ((grafptr->verttax = memAlloc ((grafptr->vertnbr + 1) * sizeof (Gnum))) == NULL) {
+  if ((grafptr->verttax = memAlloc ((grafptr->vertnbr + 1) * sizeof (Genum))) == NULL) {
     errorPrint ("graphGeomLoadMmkt: out of memory (1)");
     graphExit  (grafptr);
     return     (1);
@@ -173,30 +288,48 @@ const char * const          dataptr)              /* Fake base value  */
   grafptr->edgetax = ((Gnum *) sorttab) - baseval; /* TRICK: will be freed if graph is freed */
   grafptr->edlotax = NULL;
 
-  for (linenum = sortnbr = 0; linenum < linenbr; linenum ++) {
-    if ((intLoad (filesrcptr, &sorttab[sortnbr].vertnum[0]) != 1) || /* Read edge ends */
-        (intLoad (filesrcptr, &sorttab[sortnbr].vertnum[1]) != 1) ||
-        (fgets (linetab, 1025, filesrcptr) == NULL)) { /* Skip end of line */
-      errorPrint ("graphGeomLoadMmkt: bad input (4)");
-      graphExit  (grafptr);
-      return     (1);
-    }
-
-    if ((sorttab[sortnbr].vertnum[0] < baseval) || (sorttab[sortnbr].vertnum[0] >= (mrownbr + baseval)) ||
-        (sorttab[sortnbr].vertnum[1] < baseval) || (sorttab[sortnbr].vertnum[1] >= (mrownbr + baseval))) {
-      errorPrint ("graphGeomLoadMmkt: bad input (5)");
-      graphExit  (grafptr);
-      return     (1);
+  thrdnbr = contextThreadNbr (contptr);
+  if (graphIoTextInit (&textdat, filesrcptr) != 0) {
+    errorPrint ("graphGeomLoadMmkt: cannot initialize text buffer");
+    graphExit  (grafptr);
+    return     (1);
+  }
+  if ((loaddat.thrdtab = (GraphGeomMmktThread *) memAlloc (thrdnbr * sizeof (GraphGeomMmktThread))) == NULL) {
+    errorPrint      ("graphGeomLoadMmkt: out of memory (3)");
+    graphIoTextExit (&textdat);
+    graphExit       (grafptr);
+    return          (1);
+  }
+  loaddat.baseval = baseval;
+  loaddat.vertnnd = mrownbr + baseval;
+  loaddat.linenbr = linenbr;
+  loaddat.sorttab = sorttab;
+  loaddat.flagval = 0;
+
+  for (linenum = 0, sortnbr = 2 * linenbr; (linenum < linenbr) && (loaddat.flagval == 0); ) {
+    if (graphIoTextRead (&textdat, NULL, &loaddat.databeg, &loaddat.dataend) != 0) { /* Read next window of entry lines */
+      loaddat.flagval = 1;                        /* Not enough entry lines */
+      break;
     }
+    loaddat.linebas = linenum;
+    loaddat.partnbr = graphIoTextPartNbr (loaddat.databeg, loaddat.dataend, thrdnbr);
+    contextThreadLaunch (contptr, (ThreadFunc) graphGeomLoadMmktThread, (void *) &loaddat);
 
-    if (sorttab[sortnbr].vertnum[0] != sorttab[sortnbr].vertnum[1]) { /* If not loop edge  */
-      sorttab[sortnbr + 1].vertnum[0] = sorttab[sortnbr].vertnum[1]; /* Add symmetric edge */
-      sorttab[sortnbr + 1].vertnum[1] = sorttab[sortnbr].vertnum[0];
-      sortnbr += 2;
+    for (partnum = 0; partnum < loaddat.partnbr; partnum ++) {
+      loaddat.flagval |= loaddat.thrdtab[partnum].flagval;
+      sortnbr         -= 2 * loaddat.thrdtab[partnum].loopnbr; /* Loop edges will be sorted last and discarded */
     }
+    linenum = loaddat.thrdtab[loaddat.partnbr - 1].linennd; /* Resume after last entry line read */
+  }
+  memFree         (loaddat.thrdtab);
+  graphIoTextExit (&textdat);
+  if (loaddat.flagval != 0) {
+    errorPrint ((loaddat.flagval == 2) ? "graphGeomLoadMmkt: bad input (5)" : "graphGeomLoadMmkt: bad input (4)");
+    graphExit  (grafptr);
+    return     (1);
   }
 
-  intSort2asc2 (sorttab, sortnbr);                /* Sort edges by increasing indices */
+  intSort2asc2 (sorttab, 2 * linenbr);            /* Sort edges by increasing indices */
 
   edgetax = grafptr->edgetax;                     /* TRICK: point to beginning of sorted edge array for re-use */
   for (sortnum = degrmax = 0, vertnum = verttmp = baseval - 1, edgetmp = edgenum = baseval;
@@ -270,7 +403,7 @@ const char * const            dataptr)            /* No use           */
 {
   Gnum              baseadj;                      /* Base adjustment  */
   Gnum              vertnum;                      /* Current vertex   */
-  Gnum              edgenum;                      /* Current edge     */
+  Genum             edgenum;                      /* Current edge     */
   int               o;
 
   baseadj = 1 - grafptr->baseval;                 /* Output base is always 1 */
@@ -1,4 +1,4 @@
-/* Copyright 2008 ENSEIRB, INRIA & CNRS
+/* Copyright 2008,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,6 +41,8 @@
 /**                                                        **/
 /**   DATES      : # Version 5.0  : from : 17 jan 2008     **/
 /**                                 to   : 14 mar 2008     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,3 +55,39 @@
 typedef struct GraphGeomMmktEdge_ {
   Gnum                      vertnum[2];
 } GraphGeomMmktEdge;
+
+/*+ The thread-specific data block of the
+    multithreaded loading routine. On the
+    first pass, linebas holds the number of
+    entry lines of the part; it is then turned
+    into the index of its first entry line.    +*/
+
+typedef struct GraphGeomMmktThread_ {
+  Gnum                      linebas;              /*+ Index of first entry line of part +*/
+  Gnum                      linennd;              /*+ After-last entry line of part     +*/
+  Gnum                      loopnbr;              /*+ Number of loop edges in part      +*/
+  int                       flagval;              /*+ Part parsing status               +*/
+} GraphGeomMmktThread;
+
+/*+ The loading data shared by all threads. +*/
+
+typedef struct GraphGeomMmktData_ {
+  const char *              databeg;              /*+ Start of text window                +*/
+  const char *              dataend;              /*+ End of text window                  +*/
+  Gnum                      linebas;              /*+ First entry line of text window     +*/
+  Gnum                      baseval;              /*+ Base value of indices               +*/
+  Gnum                      vertnnd;              /*+ After-last vertex index             +*/
+  Gnum                      linenbr;              /*+ Number of entry lines to read       +*/
+  GraphGeomMmktEdge *       sorttab;              /*+ Array of edges to symmetrize        +*/
+  int                       partnbr;              /*+ Number of text parts                +*/
+  int                       flagval;              /*+ Loading status                      +*/
+  GraphGeomMmktThread *     thrdtab;              /*+ Array of thread data blocks         +*/
+} GraphGeomMmktData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_IO_MMKT
+static void                 graphGeomLoadMmktThread (ThreadDescriptor * restrict const, GraphGeomMmktData * restrict const);
+#endif /* SCOTCH_GRAPH_IO_MMKT */
@@ -49,7 +49,7 @@
 /**                # Version 5.1  : from : 11 aug 2010     **/
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,7 +65,8 @@
 
 /* This routine loads the geometrical graph
 ** in the Scotch graph format, and allocates
-** the proper structures.
+** the proper structures. The graph is read
+** using the threads of the given context.
 ** - 0   : on success.
 ** - !0  : on error.
 */
@@ -76,7 +77,8 @@ Graph * restrict const      grafptr,              /* Graph to load    */
 Geom * restrict const       geomptr,              /* Geometry to load */
 FILE * const                filesrcptr,           /* Topological data */
 FILE * const                filegeoptr,           /* No use           */
-const char * const          dataptr)              /* No use           */
+const char * const          dataptr,              /* No use           */
+Context * restrict const    contptr)              /* Execution context */
 {
   void *                        coorfileptr;      /* Temporary pointer to comply with C99 rules */
   double * restrict             coorfiletab;      /* Pointer to geometric data read from file   */
@@ -91,7 +93,7 @@ const char * const          dataptr)              /* No use           */
   int                           o;
 
   if (filesrcptr != NULL) {
-    if (graphLoad (grafptr, filesrcptr, -1, 0) != 0)
+    if (graphLoadText (grafptr, filesrcptr, -1, 0, contptr) != 0)
       return (1);
   }
 
@@ -0,0 +1,394 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_text.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the block-buffered **/
+/**                text reading routines shared by the     **/
+/**                multithreaded graph file loaders.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_io_text.h"
+
+/**************************************/
+/*                                    */
+/* These routines handle text buffers */
+/* for the graph loading routines.    */
+/*                                    */
+/**************************************/
+
+/* This routine initializes the given text
+** buffer for reading from the given stream.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphIoTextInit (
+GraphIoText * restrict const  textptr,            /* Text buffer to initialize */
+FILE * const                  stream)             /* Stream to read data from  */
+{
+  if ((textptr->datatab = memAlloc (GRAPHIOTEXTBLOKSIZ + 1)) == NULL) { /* One more byte for terminating null character */
+    errorPrint ("graphIoTextInit: out of memory");
+    return (1);
+  }
+  textptr->stream  = stream;
+  textptr->bufssiz = GRAPHIOTEXTBLOKSIZ;
+  textptr->datasiz =
+  textptr->lineoft = 0;
+  textptr->lineval = '\0';
+  textptr->flagval = 0;
+
+  return (0);
+}
+
+/* This routine provides the next window of
+** complete lines of the stream, as a null-
+** terminated text. The data of the previous
+** window located after the given position,
+** which has not been consumed by the caller,
+** is placed at the start of the new window.
+** When the stream has not been read yet, or
+** when the whole previous window has been
+** consumed, the given position can be NULL.
+** Since the whole window is available at
+** once, it can be parsed by several threads
+** concurrently. The buffer size is bounded:
+** it only grows when the new window would
+** not hold more data than the unconsumed
+** part of the previous one, that is, when a
+** line or a vertex does not fit in it.
+** It returns:
+** - 0   : on success.
+** - 1   : on error.
+** - 2   : if no new data can be provided.
+*/
+
+int
+graphIoTextRead (
+GraphIoText * restrict const  textptr,            /* Text buffer                    */
+const char * const            consptr,            /* End of consumed data, or NULL  */
+const char ** const           pbegptr,            /* Pointer to start of new window */
+const char ** const           pendptr)            /* Pointer to end of new window   */
+{
+  char *              datatab;
+  size_t              datasiz;
+  size_t              consoft;                    /* Offset of end of consumed data        */
+  size_t              seensiz;                    /* Size of data already provided to user */
+  size_t              lineoft;
+
+  datatab = textptr->datatab;
+  datatab[textptr->lineoft] = textptr->lineval;   /* Restore character hidden by null character */
+  consoft = (consptr == NULL) ? textptr->lineoft : (size_t) (consptr - datatab);
+  seensiz = textptr->lineoft - consoft;
+  datasiz = textptr->datasiz - consoft;
+  memMov (datatab, datatab + consoft, datasiz);   /* Move unconsumed data to start of buffer */
+
+  while (1) {
+    while ((datasiz < textptr->bufssiz) && (textptr->flagval == 0)) { /* Fill buffer */
+      size_t              readsiz;
+
+      readsiz = fread (datatab + datasiz, 1, textptr->bufssiz - datasiz, textptr->stream);
+      if (readsiz == 0) {                         /* If end of stream or error */
+        if (ferror (textptr->stream)) {
+          errorPrint ("graphIoTextRead: bad input");
+          textptr->datasiz =                      /* Leave buffer in a consistent state */
+          textptr->lineoft = 0;
+          return (1);
+        }
+        textptr->flagval = 1;
+      }
+      datasiz += readsiz;
+    }
+
+    for (lineoft = datasiz; (lineoft > seensiz) && (datatab[lineoft - 1] != '\n'); lineoft --) ; /* Search for last newline */
+    if (lineoft > seensiz)                        /* If window holds new complete lines */
+      break;
+    if (textptr->flagval != 0) {                  /* If end of stream reached, provide incomplete last line */
+      if (datasiz <= seensiz) {                   /* If no new data at all */
+        textptr->datasiz =
+        textptr->lineoft = datasiz;
+        textptr->lineval = '\0';
+        datatab[datasiz] = '\0';
+        return (2);
+      }
+      lineoft = datasiz;
+      break;
+    }
+
+    {                                             /* Buffer full of already provided data: double its size */
+      char *              datatmp;
+
+      if ((datatmp = memRealloc (datatab, 2 * textptr->bufssiz + 1)) == NULL) {
+        errorPrint ("graphIoTextRead: out of memory");
+        textptr->datasiz =
+        textptr->lineoft = 0;
+        return (1);
+      }
+      textptr->datatab  =
+      datatab           = datatmp;
+      textptr->bufssiz *= 2;
+    }
+  }
+
+  textptr->datasiz = datasiz;
+  textptr->lineoft = lineoft;
+  textptr->lineval = datatab[lineoft];
+  datatab[lineoft] = '\0';                       /* Terminate text so that no bound checking is needed */
+
+  *pbegptr = datatab;
+  *pendptr = datatab + lineoft;
+
+  return (0);
+}
+
+/* This routine gives back to the stream
+** the data of the current window located
+** after the given position, by moving the
+** stream position backwards, so that the
+** next reads from the stream start exactly
+** after the consumed data. The stream must
+** be seekable.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphIoTextSeek (
+GraphIoText * restrict const  textptr,            /* Text buffer          */
+const char * const            consptr)            /* End of consumed data */
+{
+  size_t              restsiz;                    /* Size of data read but not consumed */
+
+  restsiz = textptr->datasiz - (size_t) (consptr - textptr->datatab);
+  if ((restsiz > 0) &&
+      (fseek (textptr->stream, - (long) restsiz, SEEK_CUR) != 0)) {
+    errorPrint ("graphIoTextSeek: cannot seek stream");
+    return (1);
+  }
+  textptr->datatab[textptr->lineoft] = textptr->lineval; /* Restore character hidden by null character */
+  textptr->datasiz =                              /* Buffer is now empty */
+  textptr->lineoft = 0;
+  textptr->lineval = '\0';
+  textptr->flagval = 0;                           /* Stream may be read again */
+
+  return (0);
+}
+
+/* This routine frees the contents
+** of the given text buffer.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphIoTextExit (
+GraphIoText * restrict const  textptr)
+{
+  if (textptr->datatab != NULL)
+    memFree (textptr->datatab);
+#ifdef SCOTCH_DEBUG_GRAPH2
+  textptr->datatab = NULL;
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+}
+
+/* This routine computes the number of parts
+** into which the given text should be split,
+** so that every part has enough data to be
+** worth the processing by a separate thread.
+** It returns:
+** - > 0  : number of parts.
+*/
+
+int
+graphIoTextPartNbr (
+const char * const          databeg,              /* Start of text to split */
+const char * const          dataend,              /* End of text to split   */
+const int                   thrdnbr)              /* Number of threads      */
+{
+  size_t              partnbr;
+
+  partnbr = (size_t) (dataend - databeg) / GRAPHIOTEXTPARTMIN;
+  if (partnbr > (size_t) thrdnbr)
+    partnbr = (size_t) thrdnbr;
+
+  return ((partnbr < 1) ? 1 : (int) partnbr);
+}
+
+/* This routine computes the bounds of the
+** given part of the given text. Part bounds
+** are always located at line starts, so that
+** each line belongs to exactly one part.
+** Since bounds only depend on the part
+** number, neighbor parts computed by
+** different threads always match.
+** graphIoTextPart2() computes a single
+** bound, and graphIoTextPart() the two
+** bounds of a part.
+** They return:
+** - ptr   : graphIoTextPart2(): pointer to the part bound.
+** - void  : graphIoTextPart(): in all cases.
+*/
+
+static
+const char *
+graphIoTextPart2 (
+const char * const          databeg,
+const char * const          dataend,
+const int                   partnum,
+const int                   partnbr)
+{
+  if (partnum <= 0)
+    return (databeg);
+  if (partnum >= partnbr)
+    return (dataend);
+
+  return (graphIoTextLine (databeg + (size_t) (dataend - databeg) / (size_t) partnbr * (size_t) partnum));
+}
+
+void
+graphIoTextPart (
+const char * const          databeg,              /* Start of text to split    */
+const char * const          dataend,              /* End of text to split      */
+const int                   partnum,              /* Number of part to compute */
+const int                   partnbr,              /* Number of parts           */
+const char ** const         pbegptr,              /* Pointer to start of part  */
+const char ** const         pendptr)              /* Pointer to end of part    */
+{
+  *pbegptr = graphIoTextPart2 (databeg, dataend, partnum,     partnbr);
+  *pendptr = graphIoTextPart2 (databeg, dataend, partnum + 1, partnbr);
+}
+
+/* These routines skip blank characters, as
+** defined by isspace(), like intLoad() does.
+** graphIoTextBlank() stops at newlines, while
+** graphIoTextSpace() does not.
+** They return:
+** - ptr  : pointer to the first non-blank character.
+*/
+
+const char *
+graphIoTextBlank (
+const char *                dataptr)
+{
+  while ((*dataptr != '\n') && (isspace ((unsigned char) *dataptr)))
+    dataptr ++;
+
+  return (dataptr);
+}
+
+const char *
+graphIoTextSpace (
+const char *                dataptr)
+{
+  while (isspace ((unsigned char) *dataptr))
+    dataptr ++;
+
+  return (dataptr);
+}
+
+/* This routine returns a pointer to the
+** start of the line following the one
+** containing the given character, or to
+** the end of the text if no such line
+** exists.
+** It returns:
+** - ptr  : pointer to the start of the next line.
+*/
+
+const char *
+graphIoTextLine (
+const char *                dataptr)
+{
+  const char *        lineptr;
+
+  lineptr = strchr (dataptr, '\n');               /* Library routines are likely to be vectorized */
+
+  return ((lineptr != NULL) ? (lineptr + 1) : (dataptr + strlen (dataptr)));
+}
+
+/* This routine decodes an integer value
+** located at the given text position, and
+** updates the position accordingly. Blank
+** characters are not skipped. The decoding
+** loop performs a single test per digit,
+** by way of unsigned arithmetic.
+** It returns:
+** - 1  : if an integer value has been read.
+** - 0  : if no digit is present.
+*/
+
+int
+graphIoTextInt (
+const char ** const         dataptr,              /* Pointer to current position */
+Gnum * const                valuptr)              /* Pointer to value to read    */
+{
+  const char *        charptr;
+  unsigned int        digival;
+  Gnum                valutmp;
+  int                 signval;
+
+  charptr = *dataptr;
+  signval = (*charptr == '-');                    /* Handle optional sign */
+  charptr += signval | (*charptr == '+');
+
+  digival = (unsigned int) (*charptr - '0');
+  if (digival > 9)                                /* If not a digit */
+    return (0);
+
+  valutmp = 0;
+  do {
+    valutmp = valutmp * 10 + (Gnum) digival;
+    digival = (unsigned int) (*(++ charptr) - '0');
+  } while (digival <= 9);
+
+  *dataptr = charptr;
+  *valuptr = (signval != 0) ? - valutmp : valutmp;
+
+  return (1);
+}
@@ -0,0 +1,98 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_text.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the block-buffered text graph       **/
+/**                reading routines.                       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Initial size of the text window read
+    from the stream, in bytes. The window
+    only grows when a single line, or a
+    single vertex, does not fit in it.       +*/
+
+#define GRAPHIOTEXTBLOKSIZ          (1 << 22)
+
+/*+ Minimum amount of text to be processed
+    by each thread, in bytes, below which
+    fewer threads are used.                   +*/
+
+#define GRAPHIOTEXTPARTMIN          (1 << 16)
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The text buffer. It holds a window of
+    complete lines of the stream, followed
+    by a terminating null character, plus
+    the beginning of the next line, if any.
+    The character overwritten by the null
+    character is saved in lineval.           +*/
+
+typedef struct GraphIoText_ {
+  FILE *                    stream;               /*+ Stream to read data from              +*/
+  char *                    datatab;              /*+ Text data array                       +*/
+  size_t                    bufssiz;              /*+ Size of data array, without null byte +*/
+  size_t                    datasiz;              /*+ Amount of data in array               +*/
+  size_t                    lineoft;              /*+ End of window, after its last newline +*/
+  char                      lineval;              /*+ Character hidden by null character    +*/
+  int                       flagval;              /*+ Set once end of stream is reached     +*/
+} GraphIoText;
+
+/*
+**  The function prototypes.
+*/
+
+int                         graphIoTextInit     (GraphIoText * restrict const, FILE * const);
+int                         graphIoTextRead     (GraphIoText * restrict const, const char * const, const char ** const, const char ** const);
+int                         graphIoTextSeek     (GraphIoText * restrict const, const char * const);
+void                        graphIoTextExit     (GraphIoText * restrict const);
+int                         graphIoTextPartNbr  (const char * const, const char * const, const int);
+void                        graphIoTextPart     (const char * const, const char * const, const int, const int, const char ** const, const char ** const);
+const char *                graphIoTextBlank    (const char *);
+const char *                graphIoTextSpace    (const char *);
+const char *                graphIoTextLine     (const char *);
+int                         graphIoTextInt      (const char ** const, Gnum * const);
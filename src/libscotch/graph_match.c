@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2012,2015,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2012,2015,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 05 oct 2012     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -163,8 +163,8 @@ Gnum                                finevertnnd)
   Gnum                finequeunbr;
   Gnum                finevertnum;
 
-  const Gnum * restrict const fineverttax = coarptr->finegrafptr->verttax;
-  const Gnum * restrict const finevendtax = coarptr->finegrafptr->vendtax;
+  const Genum * restrict const fineverttax = coarptr->finegrafptr->verttax;
+  const Genum * restrict const finevendtax = coarptr->finegrafptr->vendtax;
 
   for (finevertnum = finevertbas, finequeuptr = thrdptr->finequeutab;
        finevertnum < finevertnnd; finevertnum ++) {
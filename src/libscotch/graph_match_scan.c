@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2015,2018-2020 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2015,2018-2020,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**   DATES      : # Version 6.0  : from : 01 oct 2012     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 14 jan 2020     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code partly derives from the     **/
 /**                  code of graph_match.c partly updated  **/
@@ -84,9 +84,8 @@ GraphCoarsenThread * restrict const thrdptr)
 #ifndef GRAPHMATCHSCANSEQ
   volatile int * const            locktax = coarptr->finelocktax;
 #endif /* GRAPHMATCHSCANSEQ */
-  const Gnum * restrict const     fineverttax = finegrafptr->verttax;
-  const Gnum * restrict const     finevendtax = finegrafptr->vendtax;
-  const Gnum * restrict const     fineedgetax = finegrafptr->edgetax;
+  const Genum * restrict const     fineverttax = finegrafptr->verttax;
+  const Genum * restrict const     finevendtax = finegrafptr->vendtax;
 #ifdef GRAPHMATCHSCANEDLOTAB
   const Gnum * restrict const     fineedlotax = finegrafptr->edlotax;
 #endif /* GRAPHMATCHSCANEDLOTAB */
@@ -102,8 +101,8 @@ GraphCoarsenThread * restrict const thrdptr)
   for ( ; finequeunum < finequeunnd; finequeunum += finequeudlt) { /* For all queued vertex indices */
     Gnum                finevertnum;
     Gnum                finevertbst;
-    Gnum                fineedgenum;
-    Gnum                fineedgennd;
+    Genum               fineedgenum;
+    Genum               fineedgennd;
 #ifdef GRAPHMATCHSCANEDLOTAB
     Gnum                fineedlobst = -1;         /* Edge load of current best neighbor */
 #endif /* GRAPHMATCHSCANEDLOTAB */
@@ -148,6 +147,8 @@ GraphCoarsenThread * restrict const thrdptr)
       }
     }
     else {                                        /* Vertex has at least one neighbor     */
+      const Gnum * restrict const fineedgetax = graphEdgeTax (finegrafptr, finevertnum, thrdptr->fineedgetab); /* Decode adjacency if compressed */
+
       do {                                        /* Perform search for mate on neighbors */
         Gnum                finevertend;
 
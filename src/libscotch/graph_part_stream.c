@@ -0,0 +1,510 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_part_stream.c                     **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes partitions of      **/
+/**                graphs read from a stream in the Scotch **/
+/**                source graph format, without ever       **/
+/**                storing their edges in memory.          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Vertices are assigned one after the   **/
+/**                  other, according to the parts of      **/
+/**                  their already assigned neighbors, by  **/
+/**                  means of either the Fennel or the     **/
+/**                  linear deterministic greedy (LDG)     **/
+/**                  objective functions. Additional       **/
+/**                  passes re-stream the graph and move   **/
+/**                  vertices according to the parts of    **/
+/**                  all of their neighbors.               **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_PART_STREAM
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "graph_io_bin.h"
+#include "graph_part_stream.h"
+
+/*********************************/
+/*                               */
+/* Part load heap handling       */
+/* routines.                     */
+/*                               */
+/*********************************/
+
+/* These routines restore the heap property
+** of the part load heap after the load of
+** the part at the given heap position has
+** decreased or increased, respectively.
+** They return:
+** - VOID  : in all cases.
+*/
+
+static
+void
+graphPartStreamHeapUp (
+GraphPartStreamData * restrict const  dataptr,
+Anum                                  heapnum)
+{
+  Anum * restrict const         heaptab = dataptr->heaptab;
+  Anum * restrict const         heapidx = dataptr->heapidx;
+  const Gnum * restrict const   compload = dataptr->compload;
+  Anum                          partnum;
+
+  partnum = heaptab[heapnum];
+  while (heapnum > 0) {
+    Anum                heapfth;
+
+    heapfth = (heapnum - 1) >> 1;
+    if (compload[heaptab[heapfth]] <= compload[partnum])
+      break;
+    heaptab[heapnum] = heaptab[heapfth];
+    heapidx[heaptab[heapnum]] = heapnum;
+    heapnum = heapfth;
+  }
+  heaptab[heapnum] = partnum;
+  heapidx[partnum] = heapnum;
+}
+
+static
+void
+graphPartStreamHeapDown (
+GraphPartStreamData * restrict const  dataptr,
+Anum                                  heapnum)
+{
+  Anum * restrict const         heaptab = dataptr->heaptab;
+  Anum * restrict const         heapidx = dataptr->heapidx;
+  const Gnum * restrict const   compload = dataptr->compload;
+  const Anum                    partnbr = dataptr->partnbr;
+  Anum                          partnum;
+
+  partnum = heaptab[heapnum];
+  while (1) {
+    Anum                heapson;
+
+    heapson = (heapnum << 1) + 1;
+    if (heapson >= partnbr)
+      break;
+    if ((heapson < (partnbr - 1)) &&              /* Select lightest son */
+        (compload[heaptab[heapson + 1]] < compload[heaptab[heapson]]))
+      heapson ++;
+    if (compload[heaptab[heapson]] >= compload[partnum])
+      break;
+    heaptab[heapnum] = heaptab[heapson];
+    heapidx[heaptab[heapnum]] = heapnum;
+    heapnum = heapson;
+  }
+  heaptab[heapnum] = partnum;
+  heapidx[partnum] = heapnum;
+}
+
+/*********************************/
+/*                               */
+/* Stream reading routines.      */
+/*                               */
+/*********************************/
+
+/* This routine reads the header of the
+** graph stream and checks its validity.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphPartStreamHead (
+GraphPartStreamData * restrict const  dataptr,
+FILE * const                          stream)
+{
+  Gnum                versval;
+  Gnum                propval;
+  int                 c;
+
+  if ((c = getc (stream)) != EOF) {               /* Peek first character of stream */
+    ungetc (c, stream);
+    if (c == GRAPHIOBINMAGIC[0]) {
+      errorPrint ("graphPartStreamHead: binary graph streams not supported");
+      return (1);
+    }
+  }
+
+  if (intLoad (stream, &versval) != 1) {          /* Read version number */
+    errorPrint ("graphPartStreamHead: bad input (1)");
+    return (1);
+  }
+  if (versval != 0) {                             /* If version not zero */
+    errorPrint ("graphPartStreamHead: old-style graph format no longer supported");
+    return (1);
+  }
+
+  if ((intLoad (stream, &dataptr->vertnbr) != 1) || /* Read rest of header */
+      (intLoadEdge (stream, &dataptr->edgenbr) != 1) ||
+      (intLoad (stream, &dataptr->baseval) != 1) ||
+      (intLoad (stream, &propval)          != 1) ||
+      (propval < 0)                              ||
+      (propval > 111)) {
+    errorPrint ("graphPartStreamHead: bad input (2)");
+    return (1);
+  }
+  if (dataptr->vertnbr < 0) {
+    errorPrint ("graphPartStreamHead: invalid number of vertices");
+    return (1);
+  }
+  if ((dataptr->edgenbr < 0) ||
+      ((dataptr->edgenbr & 1) != 0)) {
+    errorPrint ("graphPartStreamHead: invalid number of edges");
+    return (1);
+  }
+  sprintf (dataptr->proptab, "%3.3d", (int) propval); /* Compute file properties */
+  dataptr->proptab[0] -= '0';                     /* Vertex labels flag      */
+  dataptr->proptab[1] -= '0';                     /* Edge weights flag       */
+  dataptr->proptab[2] -= '0';                     /* Vertex loads flag       */
+
+  return (0);
+}
+
+/* This routine returns the un-based index
+** of the vertex of given label, or ~0 if
+** the label has not been read yet.
+** It returns:
+** - ~0   : if label not found.
+** - >=0  : vertex index.
+*/
+
+static
+Gnum
+graphPartStreamHashFind (
+const GraphPartStreamData * restrict const  dataptr,
+const Gnum                                  vlblnum)
+{
+  const GraphPartStreamHash * restrict const  hashtab = dataptr->hashtab;
+  const Gnum                                  hashmsk = dataptr->hashmsk;
+  Gnum                                        hashnum;
+
+  for (hashnum = (vlblnum * GRAPHPARTSTREAMHASHPRIME) & hashmsk; ; hashnum = (hashnum + 1) & hashmsk) {
+    if (hashtab[hashnum].vertnum == ~0)           /* If empty slot reached, label not present */
+      return (~0);
+    if (hashtab[hashnum].vlblnum == vlblnum)
+      return (hashtab[hashnum].vertnum);
+  }
+}
+
+/*********************************/
+/*                               */
+/* This is the streaming         */
+/* partitioning routine.         */
+/*                               */
+/*********************************/
+
+/* This routine reads a graph in the Scotch
+** source graph format from the given input
+** stream, and writes to the given output
+** stream a mapping file, in the format of
+** mapSave(), which assigns every vertex to
+** one of the parts. Only O(vertnbr + partnbr)
+** memory is used. When more than one pass
+** is requested, the input stream must be
+** seekable, as it is read again from start.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphPartStream (
+FILE * const                        instream,     /*+ Stream from which to read graph    +*/
+FILE * const                        outstream,    /*+ Stream to which to write mapping   +*/
+const GraphPartStreamParam * const  paraptr)      /*+ Method parameters                  +*/
+{
+  GraphPartStreamData data;
+  Gnum                vertnbr;
+  Genum               edgenbr;
+  Gnum                hashsiz;
+  Gnum                velosum;                    /* Sum of vertex loads read in first pass */
+  Gnum                edlosum;                    /* Sum of arc loads read in first pass    */
+  Genum               edgesum;                    /* Number of arcs read in first pass      */
+  double              partsqr;
+  INT                 passnum;
+  int                 o;
+
+  memSet (&data, 0, sizeof (GraphPartStreamData));
+  data.partnbr = paraptr->partnbr;
+
+  if (graphPartStreamHead (&data, instream) != 0)
+    return (1);
+  vertnbr = data.vertnbr;
+  edgenbr = data.edgenbr;
+
+  hashsiz = 0;
+  if (data.proptab[0] != 0) {                     /* If vertex labels are present, build label hash table */
+    for (data.hashmsk = 31; data.hashmsk < (vertnbr * 2); data.hashmsk = data.hashmsk * 2 + 1) ;
+    hashsiz = data.hashmsk + 1;
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &data.parttab,  (size_t) (vertnbr      * sizeof (Anum)),
+                     &data.compload, (size_t) (data.partnbr * sizeof (Gnum)),
+                     &data.gaintab,  (size_t) (data.partnbr * sizeof (Gnum)),
+                     &data.touctab,  (size_t) (data.partnbr * sizeof (Anum)),
+                     &data.heaptab,  (size_t) (data.partnbr * sizeof (Anum)),
+                     &data.heapidx,  (size_t) (data.partnbr * sizeof (Anum)),
+                     &data.hashtab,  (size_t) (hashsiz      * sizeof (GraphPartStreamHash)), NULL) == NULL) {
+    errorPrint ("graphPartStream: out of memory");
+    return (1);
+  }
+  memSet (data.parttab,  ~0, vertnbr      * sizeof (Anum)); /* No vertex assigned yet */
+  memSet (data.compload,  0, data.partnbr * sizeof (Gnum));
+  memSet (data.gaintab,  ~0, data.partnbr * sizeof (Gnum)); /* No part touched yet    */
+  memSet (data.hashtab,  ~0, hashsiz      * sizeof (GraphPartStreamHash));
+  {
+    Anum                partnum;
+
+    for (partnum = 0; partnum < data.partnbr; partnum ++) /* All parts empty, so any order is a heap */
+      data.heaptab[partnum] =
+      data.heapidx[partnum] = partnum;
+  }
+
+  partsqr = sqrt ((double) data.partnbr);
+  velosum =
+  edlosum = 0;
+  edgesum = 0;
+  o = 1;                                          /* Assume an error */
+
+  for (passnum = 0; passnum < paraptr->passnbr; passnum ++) {
+    Gnum                vertnum;
+    int                 lastflag;
+
+    if (passnum > 0) {                            /* If stream has to be read again */
+      if (fseek (instream, 0, SEEK_SET) != 0) {
+        errorPrint ("graphPartStream: cannot rewind input stream (multiple passes require a seekable stream)");
+        goto abort;
+      }
+      if (graphPartStreamHead (&data, instream) != 0)
+        goto abort;
+      if ((data.vertnbr != vertnbr) || (data.edgenbr != edgenbr)) {
+        errorPrint ("graphPartStream: input stream changed between passes");
+        goto abort;
+      }
+    }
+
+    lastflag = (passnum == (paraptr->passnbr - 1));
+    if ((lastflag) &&
+        (fprintf (outstream, GNUMSTRING "\n",
+                  (Gnum) vertnbr) == EOF)) {
+      errorPrint ("graphPartStream: bad output (1)");
+      goto abort;
+    }
+
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+      Gnum                vlblval;
+      Gnum                veloval;
+      Gnum                degrval;
+      Gnum                degrnum;
+      Anum                toucnbr;
+      Anum                toucnum;
+      Anum                partbst;
+      double              scorbst;
+      double              velotot;                /* Estimated total vertex load */
+      double              edlotot;                /* Estimated total edge load   */
+      double              loadmax;                /* Maximum load of any part    */
+      double              alphval;                /* Fennel load penalty factor  */
+
+      vlblval = vertnum + data.baseval;
+      if (data.proptab[0] != 0) {                 /* If must read label */
+        if (intLoad (instream, &vlblval) != 1) {
+          errorPrint ("graphPartStream: bad input (1)");
+          goto abort;
+        }
+        if (passnum == 0) {                       /* Add label to hash table during first pass */
+          Gnum                hashnum;
+
+          for (hashnum = (vlblval * GRAPHPARTSTREAMHASHPRIME) & data.hashmsk; ; hashnum = (hashnum + 1) & data.hashmsk) {
+            if (data.hashtab[hashnum].vertnum == ~0) {
+              data.hashtab[hashnum].vlblnum = vlblval;
+              data.hashtab[hashnum].vertnum = vertnum;
+              break;
+            }
+            if (data.hashtab[hashnum].vlblnum == vlblval) {
+              errorPrint ("graphPartStream: duplicate vertex label");
+              goto abort;
+            }
+          }
+        }
+      }
+      veloval = 1;
+      if ((data.proptab[2] != 0) &&               /* If must read vertex load */
+          (intLoad (instream, &veloval) != 1)) {
+        errorPrint ("graphPartStream: bad input (2)");
+        goto abort;
+      }
+      if ((intLoad (instream, &degrval) != 1) ||  /* Read vertex degree */
+          (degrval < 0)) {
+        errorPrint ("graphPartStream: bad input (3)");
+        goto abort;
+      }
+
+      if (passnum == 0)
+        velosum += veloval;
+      else {                                      /* Remove vertex from its current part */
+        Anum                partold;
+
+        partold = data.parttab[vertnum];
+        data.compload[partold] -= veloval;
+        data.parttab[vertnum]   = ~0;
+        graphPartStreamHeapUp (&data, data.heapidx[partold]);
+      }
+
+      for (degrnum = 0, toucnbr = 0; degrnum < degrval; degrnum ++) {
+        Gnum                edloval;
+        Gnum                edgeval;
+        Gnum                vertend;
+        Anum                partend;
+
+        edloval = 1;
+        if ((data.proptab[1] != 0) &&             /* If must read edge load */
+            (intLoad (instream, &edloval) != 1)) {
+          errorPrint ("graphPartStream: bad input (4)");
+          goto abort;
+        }
+        if (intLoad (instream, &edgeval) != 1) {  /* Read edge end */
+          errorPrint ("graphPartStream: bad input (5)");
+          goto abort;
+        }
+        if (passnum == 0) {
+          edlosum += edloval;
+          edgesum ++;
+        }
+
+        if (data.proptab[0] != 0) {               /* If edge ends are labels */
+          if ((vertend = graphPartStreamHashFind (&data, edgeval)) == ~0) {
+            if (passnum == 0)                     /* Vertex not read yet, so not assigned either */
+              continue;
+            errorPrint ("graphPartStream: invalid arc end number (1)");
+            goto abort;
+          }
+        }
+        else {
+          vertend = edgeval - data.baseval;
+          if ((vertend < 0) || (vertend >= vertnbr)) {
+            errorPrint ("graphPartStream: invalid arc end number (2)");
+            goto abort;
+          }
+        }
+
+        partend = data.parttab[vertend];
+        if (partend == ~0)                        /* If end vertex not assigned yet (or loop edge) */
+          continue;
+        if (data.gaintab[partend] < 0) {          /* If part not yet touched */
+          data.gaintab[partend]  = 0;
+          data.touctab[toucnbr ++] = partend;
+        }
+        data.gaintab[partend] += edloval;
+      }
+
+      if (passnum == 0) {                         /* Estimate totals from what has been read so far */
+        velotot = (double) velosum * (double) vertnbr / (double) (vertnum + 1);
+        edlotot = (edgesum > 0) ? ((double) edlosum * (double) edgenbr / (double) edgesum) : (double) edgenbr;
+      }
+      else {
+        velotot = (double) velosum;
+        edlotot = (double) edlosum;
+      }
+      loadmax = velotot * (1.0 + paraptr->kbalval) / (double) data.partnbr;
+      alphval = partsqr * (edlotot * 0.5) / pow (MAX (velotot, 1.0), GRAPHPARTSTREAMGAMMA);
+
+      partbst = data.heaptab[0];                  /* Lightest part is default choice */
+      scorbst = - (double) GNUMMAX;
+      for (toucnum = -1; toucnum < toucnbr; toucnum ++) { /* Evaluate lightest part, then touched parts */
+        Anum                partnum;
+        double              loadval;
+        double              gainval;
+        double              scorval;
+
+        partnum = (toucnum < 0) ? data.heaptab[0] : data.touctab[toucnum];
+        loadval = (double) data.compload[partnum];
+        if ((toucnum >= 0) &&                     /* Touched parts must be able to receive vertex */
+            ((loadval + (double) veloval) > loadmax))
+          continue;
+
+        gainval = (data.gaintab[partnum] > 0) ? (double) data.gaintab[partnum] : 0.0;
+        scorval = (paraptr->typeval == GRAPHPARTSTREAMLDG)
+                  ? gainval * (1.0 - loadval / loadmax)
+                  : gainval - alphval * (pow (loadval + (double) veloval, GRAPHPARTSTREAMGAMMA) - pow (loadval, GRAPHPARTSTREAMGAMMA));
+        if ((scorval > scorbst) ||
+            ((scorval == scorbst) && (data.compload[partnum] < data.compload[partbst]))) {
+          scorbst = scorval;
+          partbst = partnum;
+        }
+      }
+      for (toucnum = 0; toucnum < toucnbr; toucnum ++) /* Reset touched parts */
+        data.gaintab[data.touctab[toucnum]] = ~0;
+
+      data.parttab[vertnum]    = partbst;         /* Assign vertex to best part */
+      data.compload[partbst] += veloval;
+      graphPartStreamHeapDown (&data, data.heapidx[partbst]);
+
+      if ((lastflag) &&
+          (fprintf (outstream, GNUMSTRING "\t" ANUMSTRING "\n",
+                    (Gnum) vlblval, (Anum) partbst) == EOF)) {
+        errorPrint ("graphPartStream: bad output (2)");
+        goto abort;
+      }
+    }
+
+    if ((passnum == 0) && (edgesum != edgenbr)) { /* Check arc count once */
+      errorPrint ("graphPartStream: invalid arc count");
+      goto abort;
+    }
+  }
+
+  o = 0;                                          /* Partitioning succeeded */
+
+abort:
+  memFree (data.parttab);                         /* Free group leader */
+
+  return (o);
+}
@@ -0,0 +1,116 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_part_stream.h                     **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the data declara-  **/
+/**                tions for the streaming graph partition-**/
+/**                ing routine.                            **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Streaming objective types. +*/
+
+#define GRAPHPARTSTREAMFENNEL       0x0000        /*+ Fennel objective: edge gain minus load penalty +*/
+#define GRAPHPARTSTREAMLDG          0x0001        /*+ Linear deterministic greedy objective          +*/
+
+/*+ Exponent of the Fennel load penalty. +*/
+
+#define GRAPHPARTSTREAMGAMMA        1.5
+
+/*+ Prime number for hashing vertex labels. +*/
+
+#define GRAPHPARTSTREAMHASHPRIME    17
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct GraphPartStreamParam_ {
+  Anum                      partnbr;              /*+ Number of parts                       +*/
+  INT                       passnbr;              /*+ Number of streaming passes            +*/
+  double                    kbalval;              /*+ Maximum load imbalance ratio          +*/
+  int                       typeval;              /*+ Type of objective function to consider +*/
+} GraphPartStreamParam;
+
+/*+ Vertex label hash table cell. +*/
+
+typedef struct GraphPartStreamHash_ {
+  Gnum                      vlblnum;              /*+ Vertex label                     +*/
+  Gnum                      vertnum;              /*+ Un-based vertex index; ~0 if free +*/
+} GraphPartStreamHash;
+
+/*+ The streaming partitioning data. Only
+    arrays of sizes in O(vertnbr + partnbr)
+    are allocated, since edges are never
+    kept in memory.                          +*/
+
+typedef struct GraphPartStreamData_ {
+  Gnum                      vertnbr;              /*+ Number of vertices, from stream header     +*/
+  Genum                     edgenbr;              /*+ Number of arcs, from stream header         +*/
+  Gnum                      baseval;              /*+ Base value of stream vertex indices        +*/
+  Anum                      partnbr;              /*+ Number of parts                            +*/
+  char                      proptab[4];           /*+ Stream property flags                      +*/
+  Anum *                    parttab;              /*+ Part of each vertex; ~0 if not yet assigned +*/
+  Gnum *                    compload;             /*+ Load of each part                          +*/
+  Gnum *                    gaintab;              /*+ Edge load to each part; -1 if untouched    +*/
+  Anum *                    touctab;              /*+ List of touched parts                      +*/
+  Anum *                    heaptab;              /*+ Min-heap of parts by load                  +*/
+  Anum *                    heapidx;              /*+ Position of each part in heap              +*/
+  GraphPartStreamHash *     hashtab;              /*+ Vertex label hash table, if any            +*/
+  Gnum                      hashmsk;              /*+ Mask for access to hash table              +*/
+} GraphPartStreamData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_PART_STREAM
+static int                  graphPartStreamHead (GraphPartStreamData * restrict const, FILE * const);
+static Gnum                 graphPartStreamHashFind (const GraphPartStreamData * restrict const, const Gnum);
+static void                 graphPartStreamHeapUp (GraphPartStreamData * restrict const, Anum);
+static void                 graphPartStreamHeapDown (GraphPartStreamData * restrict const, Anum);
+#endif /* SCOTCH_GRAPH_PART_STREAM */
+
+int                         graphPartStream     (FILE * const, FILE * const, const GraphPartStreamParam * const);
@@ -0,0 +1,386 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_perm.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes locality-improving **/
+/**                vertex permutations of source graphs,   **/
+/**                and builds the permuted graphs.         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_PERM
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_perm.h"
+
+/****************************************/
+/*                                      */
+/* These routines compute the locality  */
+/* permutation of a source graph.       */
+/*                                      */
+/****************************************/
+
+/* This routine performs a breadth-first
+** traversal of the connected component
+** of the given root vertex, restricted
+** to vertices of number smaller than
+** vertnnd. Vertices are appended to the
+** queue array from index queunum, and the
+** flag array receives their queue index.
+** When a sort array is provided, the
+** children of every vertex are sorted by
+** ascending degree, as in the Cuthill-
+** McKee algorithm.
+** It returns:
+** - the index after the last enqueued vertex.
+*/
+
+static
+Gnum
+graphPermBfs (
+const Graph * restrict const  grafptr,            /*+ Graph                                      +*/
+const Gnum                    vertnnd,            /*+ End of vertices to traverse                +*/
+const Gnum                    rootnum,            /*+ Root vertex                                +*/
+Gnum                          queunum,            /*+ Queue index of root vertex                 +*/
+Gnum * restrict const         queutax,            /*+ Vertex queue                               +*/
+Gnum * restrict const         flagtax,            /*+ Queue index of vertices, ~0 if not reached +*/
+Gnum * restrict const         sorttab,            /*+ Degree sort array, or NULL                 +*/
+Gnum * restrict const         levlptr,            /*+ Pointer to number of levels                +*/
+Gnum * restrict const         lastptr)            /*+ Pointer to queue index of last level       +*/
+{
+  Gnum                queunnd;
+  Gnum                levlnbr;
+  Gnum                levlbas;                    /* Queue index of first vertex of current level */
+  Gnum                levlnnd;                    /* Queue index after last vertex of this level  */
+
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const  edgetax = grafptr->edgetax;
+
+  flagtax[rootnum] = queunum;
+  queutax[queunum] = rootnum;
+  queunnd = queunum + 1;
+  levlbas = queunum;
+  levlnnd = queunnd;
+  levlnbr = 1;
+
+  for ( ; queunum < queunnd; queunum ++) {
+    Gnum                vertnum;
+    Genum               edgenum;
+    Gnum                queutmp;
+
+    if (queunum == levlnnd) {                     /* If first vertex of next level reached */
+      levlbas = levlnnd;
+      levlnnd = queunnd;
+      levlnbr ++;
+    }
+
+    vertnum = queutax[queunum];
+    queutmp = queunnd;                            /* Record index of first child */
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                vertend;
+
+      vertend = edgetax[edgenum];
+      if ((vertend < vertnnd) && (flagtax[vertend] == ~0)) { /* If end vertex not yet enqueued */
+        flagtax[vertend] = queunnd;
+        queutax[queunnd ++] = vertend;
+      }
+    }
+
+    if ((sorttab != NULL) && ((queunnd - queutmp) > 1)) { /* If children have to be sorted by ascending degree */
+      Gnum                sortnbr;
+      Gnum                sortnum;
+
+      sortnbr = queunnd - queutmp;
+      for (sortnum = 0; sortnum < sortnbr; sortnum ++) {
+        Gnum                vertend;
+
+        vertend = queutax[queutmp + sortnum];
+        sorttab[2 * sortnum]     = (Gnum) (vendtax[vertend] - verttax[vertend]);
+        sorttab[2 * sortnum + 1] = vertend;
+      }
+      intSort2asc1 (sorttab, sortnbr);
+      for (sortnum = 0; sortnum < sortnbr; sortnum ++) {
+        Gnum                vertend;
+
+        vertend = sorttab[2 * sortnum + 1];
+        flagtax[vertend] = queutmp + sortnum;
+        queutax[queutmp + sortnum] = vertend;
+      }
+    }
+  }
+
+  *levlptr = levlnbr;
+  *lastptr = levlbas;
+
+  return (queunnd);
+}
+
+/* This routine computes a vertex permutation
+** which improves the locality of memory accesses
+** when traversing the adjacency of the graph.
+** Only vertices of number smaller than vertnnd
+** are relabeled, the other ones (e.g. halo
+** vertices) keeping their number. Every connected
+** component is traversed in breadth-first order
+** from a pseudo-peripheral vertex, so that
+** neighbor vertices receive close numbers.
+** The direct permutation array permtax gives
+** the new number of every old vertex, and the
+** inverse permutation array peritax the old
+** number of every new vertex.
+** It returns:
+** - 0   : if permutation could be computed.
+** - !0  : on error.
+*/
+
+int
+graphPermCompute (
+const Graph * restrict const  grafptr,            /*+ Graph                          +*/
+const Gnum                    vertnnd,            /*+ End of vertices to relabel     +*/
+const int                     typeval,            /*+ Type of relabeling             +*/
+Gnum * restrict const         permtax,            /*+ Direct permutation array [based]  +*/
+Gnum * restrict const         peritax)            /*+ Inverse permutation array [based] +*/
+{
+  Gnum * restrict     sorttab;                    /* Degree sort array for Cuthill-McKee ordering */
+  Gnum                queunum;
+  Gnum                vertnum;
+
+  const Genum * restrict const verttax = grafptr->verttax;
+  const Genum * restrict const vendtax = grafptr->vendtax;
+  const Gnum                   baseval = grafptr->baseval;
+
+  sorttab = NULL;
+  if ((typeval == GRAPHPERMRCM) &&
+      ((sorttab = memAlloc ((grafptr->degrmax + 1) * 2 * sizeof (Gnum))) == NULL)) {
+    errorPrint ("graphPermCompute: out of memory");
+    return (1);
+  }
+
+  memSet (permtax + baseval, ~0, (vertnnd - baseval) * sizeof (Gnum)); /* No vertex reached yet */
+
+  for (vertnum = baseval, queunum = baseval; vertnum < vertnnd; vertnum ++) {
+    Gnum                rootnum;
+    Gnum                rootbst;
+    Gnum                levlbst;
+    Gnum                passnum;
+
+    if (permtax[vertnum] != ~0)                   /* If vertex already belongs to a traversed component */
+      continue;
+
+    for (passnum = 0, rootnum = rootbst = vertnum, levlbst = 0; /* Search for a pseudo-peripheral root vertex */
+         passnum < GRAPHPERMPASSMAX; passnum ++) {
+      Gnum                queunnd;
+      Gnum                queutmp;
+      Gnum                levlnbr;
+      Gnum                lastnum;
+      Gnum                degrmin;
+
+      queunnd = graphPermBfs (grafptr, vertnnd, rootnum, queunum, peritax, permtax, NULL, &levlnbr, &lastnum);
+      for (queutmp = queunum; queutmp < queunnd; queutmp ++) /* Reset flags of component vertices */
+        permtax[peritax[queutmp]] = ~0;
+
+      if (levlnbr <= levlbst)                     /* If eccentricity did not increase, keep best root */
+        break;
+      levlbst = levlnbr;
+      rootbst = rootnum;
+
+      for (degrmin = GNUMMAX; lastnum < queunnd; lastnum ++) { /* Select vertex of smallest degree in last level */
+        Gnum                vertend;
+        Gnum                degrval;
+
+        vertend = peritax[lastnum];
+        degrval = (Gnum) (vendtax[vertend] - verttax[vertend]);
+        if (degrval < degrmin) {
+          degrmin = degrval;
+          rootnum = vertend;
+        }
+      }
+    }
+
+    {
+      Gnum                levlnbr;
+      Gnum                lastnum;
+
+      queunum = graphPermBfs (grafptr, vertnnd, rootbst, queunum, peritax, permtax, sorttab, &levlnbr, &lastnum);
+    }
+  }
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (queunum != vertnnd) {
+    errorPrint ("graphPermCompute: internal error");
+    if (sorttab != NULL)
+      memFree (sorttab);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  if (sorttab != NULL) {                          /* If Cuthill-McKee ordering, reverse it */
+    Gnum                vertnum;
+    Gnum                vertend;
+
+    for (vertnum = baseval, vertend = vertnnd - 1; vertnum < vertend; vertnum ++, vertend --) {
+      Gnum                verttmp;
+
+      verttmp          = peritax[vertnum];
+      peritax[vertnum] = peritax[vertend];
+      peritax[vertend] = verttmp;
+    }
+    for (vertnum = baseval; vertnum < vertnnd; vertnum ++)
+      permtax[peritax[vertnum]] = vertnum;
+
+    memFree (sorttab);
+  }
+
+  for (vertnum = vertnnd; vertnum < grafptr->vertnnd; vertnum ++) /* Remaining vertices keep their numbers */
+    permtax[vertnum] =
+    peritax[vertnum] = vertnum;
+
+  return (0);
+}
+
+/* This routine builds the permuted graph of
+** the given graph, according to the given
+** permutation arrays. Adjacency lists keep
+** their order, so that the halo structure of
+** halo graphs is preserved. The vertex number
+** array of the permuted graph holds the numbers
+** of its vertices in the ancestor graph of the
+** original graph, if any, or else in the original
+** graph. Vertex labels are not kept.
+** It returns:
+** - 0   : if permuted graph could be built.
+** - !0  : on error.
+*/
+
+int
+graphPerm (
+const Graph * restrict const  orggrafptr,         /*+ Original graph                    +*/
+const Gnum * restrict const   permtax,            /*+ Direct permutation array [based]  +*/
+const Gnum * restrict const   peritax,            /*+ Inverse permutation array [based] +*/
+Graph * restrict const        prmgrafptr)         /*+ Permuted graph to build           +*/
+{
+  Gnum                prmvertnum;
+  Genum               prmedgenum;
+  Genum * restrict    prmverttax;
+  Gnum * restrict     prmvelotax;
+  Gnum * restrict     prmvnumtax;
+  Gnum * restrict     prmedgetax;
+  Gnum * restrict     prmedlotax;
+
+  const Genum * restrict const orgverttax = orggrafptr->verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->vendtax;
+  const Gnum * restrict const  orgvelotax = orggrafptr->velotax;
+  const Gnum * restrict const  orgvnumtax = orggrafptr->vnumtax;
+  const Gnum * restrict const  orgedgetax = orggrafptr->edgetax;
+  const Gnum * restrict const  orgedlotax = orggrafptr->edlotax;
+  const Gnum                   baseval    = orggrafptr->baseval;
+  const Gnum                   vertnbr    = orggrafptr->vertnbr;
+  const Genum                  edgenbr    = orggrafptr->edgenbr;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if ((orggrafptr->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint ("graphPerm: compressed graphs not supported");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  memSet (prmgrafptr, 0, sizeof (Graph));         /* Initialize graph fields */
+  prmgrafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+  prmgrafptr->baseval = baseval;
+  prmgrafptr->vertnbr = vertnbr;
+  prmgrafptr->vertnnd = orggrafptr->vertnnd;
+  prmgrafptr->velosum = orggrafptr->velosum;
+  prmgrafptr->edgenbr = edgenbr;
+  prmgrafptr->edlosum = orggrafptr->edlosum;
+  prmgrafptr->degrmax = orggrafptr->degrmax;
+
+  if (memAllocGroup ((void **) (void *)
+                     &prmverttax, (size_t) ((vertnbr + 1) * sizeof (Genum)),
+                     &prmvnumtax, (size_t) ( vertnbr      * sizeof (Gnum)),
+                     &prmvelotax, (size_t) ((orgvelotax != NULL) ? (vertnbr * sizeof (Gnum)) : 0), NULL) == NULL) {
+    errorPrint ("graphPerm: out of memory (1)");
+    return (1);
+  }
+  prmgrafptr->verttax = (prmverttax -= baseval);
+  prmgrafptr->vendtax = prmverttax + 1;           /* Permuted graph is compact */
+  prmgrafptr->vnumtax = (prmvnumtax -= baseval);
+  prmgrafptr->velotax = (orgvelotax != NULL) ? (prmvelotax -= baseval) : NULL;
+
+  if ((prmedgetax = memAlloc (edgenbr * ((orgedlotax != NULL) ? 2 : 1) * sizeof (Gnum))) == NULL) {
+    errorPrint ("graphPerm: out of memory (2)");
+    graphFree  (prmgrafptr);
+    return (1);
+  }
+  prmgrafptr->edgetax = (prmedgetax -= baseval);
+  prmgrafptr->edlotax = prmedlotax = (orgedlotax != NULL) ? (prmedgetax + edgenbr) : NULL;
+
+  for (prmvertnum = prmedgenum = baseval; prmvertnum < prmgrafptr->vertnnd; prmvertnum ++) {
+    Gnum                orgvertnum;
+    Genum               orgedgenum;
+
+    orgvertnum = peritax[prmvertnum];
+    prmverttax[prmvertnum] = prmedgenum;
+    prmvnumtax[prmvertnum] = (orgvnumtax != NULL) ? orgvnumtax[orgvertnum] : orgvertnum;
+    if (orgvelotax != NULL)
+      prmvelotax[prmvertnum] = orgvelotax[orgvertnum];
+
+    for (orgedgenum = orgverttax[orgvertnum]; orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++, prmedgenum ++) {
+      prmedgetax[prmedgenum] = permtax[orgedgetax[orgedgenum]];
+      if (orgedlotax != NULL)
+        prmedlotax[prmedgenum] = orgedlotax[orgedgenum];
+    }
+  }
+  prmverttax[prmvertnum] = prmedgenum;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (prmgrafptr) != 0) {
+    errorPrint ("graphPerm: inconsistent graph data");
+    graphFree  (prmgrafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
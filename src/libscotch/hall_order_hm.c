@@ -0,0 +1,1210 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hall_order_hm.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module orders a halo graph by      **/
+/**                approximate minimum degree or minimum   **/
+/**                fill, eliminating in parallel sets of   **/
+/**                independent pivots of near-minimum      **/
+/**                score.                                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_HALL_ORDER_HM
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "hall_order_hm.h"
+
+#ifdef COMMON_OS_WINDOWS
+#define anint(x)                    floor ((x) + 0.5)
+#else /* COMMON_OS_WINDOWS */
+#define anint(x)                    (((x) > 0) ? floor ((x) + 0.5) : ceil ((x) - 0.5))
+#endif /* COMMON_OS_WINDOWS */
+
+/***********************************/
+/*                                 */
+/* These routines handle the score */
+/* buckets and the flag arrays.    */
+/*                                 */
+/***********************************/
+
+/* This routine returns the bucket of the
+** given score. Minimum fill scores larger
+** than the graph weight are spread over
+** coarser buckets, like in HAMF.
+** It returns:
+** - the bucket index : in all cases.
+*/
+
+static
+Gnum
+hallOrderHmBuck (
+const HallOrderHmData * restrict const  dataptr,
+const Gnum                              scorval)
+{
+  if (scorval <= dataptr->norig)
+    return (scorval);
+
+  return (MIN ((scorval - dataptr->norig) / dataptr->pasval + dataptr->norig, dataptr->nbbuck));
+}
+
+/* These routines add a variable to the head
+** of its bucket list, and remove it from it.
+** They return:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmBuckAdd (
+HallOrderHmData * restrict const  dataptr,
+const Gnum                        nodenum,
+const Gnum                        bucknum)
+{
+  Gnum                nodenxt;
+
+  nodenxt = dataptr->headtab[bucknum];
+  dataptr->nexttab[nodenum] = nodenxt;
+  dataptr->prevtab[nodenum] = -1;
+  if (nodenxt != -1)
+    dataptr->prevtab[nodenxt] = nodenum;
+  dataptr->headtab[bucknum] = nodenum;
+  dataptr->bucktab[nodenum] = bucknum;
+  if (dataptr->buckmin > bucknum)
+    dataptr->buckmin = bucknum;
+}
+
+static
+void
+hallOrderHmBuckDel (
+HallOrderHmData * restrict const  dataptr,
+const Gnum                        nodenum)
+{
+  Gnum                nodenxt;
+  Gnum                nodeprv;
+
+  nodenxt = dataptr->nexttab[nodenum];
+  nodeprv = dataptr->prevtab[nodenum];
+  if (nodeprv != -1)
+    dataptr->nexttab[nodeprv] = nodenxt;
+  else
+    dataptr->headtab[dataptr->bucktab[nodenum]] = nodenxt;
+  if (nodenxt != -1)
+    dataptr->prevtab[nodenxt] = nodeprv;
+  dataptr->bucktab[nodenum] = -1;
+}
+
+/* This routine makes sure that the given
+** number of flag values, plus the range of
+** set differences of one element, can be
+** taken from the flag array of the given
+** thread without integer overflow.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmFlag (
+const HallOrderHmData * restrict const  dataptr,
+HallOrderHmThread * restrict const      thrdptr,
+const Gnum                              flagnbr)
+{
+  if (thrdptr->wflgval < (GNUMMAX - flagnbr - 2 * (dataptr->norig + 2)))
+    return;
+
+  memSet (thrdptr->wtab, 0, dataptr->n * sizeof (Gnum));
+  thrdptr->wflgval = 1;
+}
+
+/*************************************/
+/*                                   */
+/* These routines select independent */
+/* pivots of near-minimum score.     */
+/*                                   */
+/*************************************/
+
+/* This routine gathers the candidate pivots
+** of the next round: variables whose score
+** is within some slack of the minimum score,
+** taken by increasing bucket, up to a fixed
+** maximum number. Candidates are then ranked
+** by increasing score and, for equal scores,
+** in bucket list order, that is, most recently
+** updated variables first, like in HAMF, which
+** preserves the locality of eliminations.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmGather (
+HallOrderHmData * restrict const  dataptr)
+{
+  const HallOrderHmNode * restrict const  nodetab = dataptr->nodetab;
+  const Gnum * restrict const             headtab = dataptr->headtab;
+  const Gnum * restrict const             nexttab = dataptr->nexttab;
+  HallOrderHmPivot * restrict const       pivttab = dataptr->pivttab;
+  Gnum * restrict const                   sorttab = dataptr->sorttab;
+  Gnum                                    bucknum;
+  Gnum                                    buckmax;
+  Gnum                                    nodenum;
+  Gnum                                    scormin;
+  Gnum                                    scormax;
+  Gnum                                    candnbr;
+  Gnum                                    candnum;
+  double                                  scortmp;
+
+  if (dataptr->nelval >= dataptr->totel) {        /* If all variables eliminated */
+    dataptr->statval = HALLORDERHMDONE;
+    return;
+  }
+
+  for (bucknum = dataptr->buckmin; headtab[bucknum] == -1; bucknum ++) ; /* Find first non-empty bucket */
+  dataptr->buckmin = bucknum;
+
+  if (bucknum >= dataptr->norig) {                /* If bucket may hold different scores */
+    for (nodenum = headtab[bucknum], scormin = GNUMMAX; nodenum != -1; nodenum = nexttab[nodenum]) {
+      if (scormin > nodetab[nodenum].scorval)
+        scormin = nodetab[nodenum].scorval;
+    }
+  }
+  else
+    scormin = bucknum;
+  scortmp = (double) scormin * (1.0 + HALLORDERHMSCORRAT);
+  scormax = (scortmp >= (double) GNUMMAX) ? GNUMMAX : (Gnum) scortmp;
+  buckmax = hallOrderHmBuck (dataptr, scormax);
+
+  for (candnbr = 0; (bucknum <= buckmax) && (candnbr < HALLORDERHMCANDMAX); bucknum ++) {
+    for (nodenum = headtab[bucknum]; (nodenum != -1) && (candnbr < HALLORDERHMCANDMAX); nodenum = nexttab[nodenum]) {
+      if (nodetab[nodenum].scorval <= scormax) {
+        sorttab[2 * candnbr]     = nodetab[nodenum].scorval;
+        sorttab[2 * candnbr + 1] = candnbr;
+        pivttab[candnbr].memsiz  = nodenum;       /* Node kept in memory field until sorted */
+        candnbr ++;
+      }
+    }
+  }
+  intSort2asc2 (sorttab, candnbr);
+  for (candnum = 0; candnum < candnbr; candnum ++)
+    pivttab[candnum].nodenum = pivttab[sorttab[2 * candnum + 1]].memsiz;
+  dataptr->candnbr = candnbr;
+
+  if (dataptr->claimbas >= (GNUMMAX - 2 * (HALLORDERHMCANDMAX + 1))) { /* If claim priorities would overflow */
+    memSet (dataptr->claimtab, 0, dataptr->n * sizeof (Gnum));
+    dataptr->claimbas = 1;
+  }
+  else
+    dataptr->claimbas += HALLORDERHMCANDMAX + 1;  /* Claims of former rounds are all lower */
+}
+
+/* This routine raises the claim priority
+** of a variable to the given value, if it
+** is higher than the current one.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmClaim (
+Gnum * const                claimptr,
+const Gnum                  prioval)
+{
+  Gnum                claimval;
+
+  claimval = *((volatile Gnum *) claimptr);      /* Avoid atomic operation if already beaten */
+  while (claimval < prioval) {
+    Gnum                claimtmp;
+
+    claimtmp = __sync_val_compare_and_swap (claimptr, claimval, prioval);
+    if (claimtmp == claimval)                     /* If claim succeeded */
+      return;
+    claimval = claimtmp;                          /* Retry against new claim value */
+  }
+}
+
+/* This routine processes the reach of a range
+** of candidates, that is, the candidate itself,
+** its adjacent variables and the variables of its
+** adjacent elements. In the first pass, every
+** candidate claims its reach with a priority
+** which decreases with its rank. In the second
+** pass, the candidates which hold all of their
+** claims are accepted as pivots. Accepted pivots
+** therefore have disjoint reaches: their elements
+** can be built concurrently, without any variable
+** being updated by two threads. The candidate of
+** lowest rank is always accepted.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmReach (
+HallOrderHmData * restrict const  dataptr,
+const Gnum                        candbas,
+const Gnum                        candnnd,
+const int                         passnum)
+{
+  const HallOrderHmNode * restrict const  nodetab  = dataptr->nodetab;
+  const Gnum * restrict const             iwtab    = dataptr->iwtab;
+  Gnum * restrict const                   claimtab = dataptr->claimtab;
+  HallOrderHmPivot * restrict const       pivttab  = dataptr->pivttab;
+  Gnum                                    candnum;
+
+  for (candnum = candbas; candnum < candnnd; candnum ++) {
+    const HallOrderHmNode * restrict  mptr;
+    Gnum                              prioval;
+    Gnum                              memsiz;
+    Gnum                              adjnum;
+    Gnum                              adjnnd;
+    Gnum                              nodenum;
+
+    nodenum = pivttab[candnum].nodenum;
+    prioval = dataptr->claimbas + HALLORDERHMCANDMAX - candnum;
+    mptr    = &nodetab[nodenum];
+
+    if (passnum == 0)
+      hallOrderHmClaim (&claimtab[nodenum], prioval);
+    else if (claimtab[nodenum] != prioval)
+      goto reject;
+
+    for (adjnum = mptr->adjidx, adjnnd = adjnum + mptr->elemnbr, memsiz = mptr->adjnbr - mptr->elemnbr;
+         adjnum < adjnnd; adjnum ++) {
+      const HallOrderHmNode * restrict  eptr;
+      Gnum                              lstnum;
+      Gnum                              lstnnd;
+
+      eptr = &nodetab[iwtab[adjnum]];
+      if (eptr->fathnum != -1)                    /* Skip absorbed elements */
+        continue;
+
+      for (lstnum = eptr->adjidx, lstnnd = lstnum + eptr->adjnbr; lstnum < lstnnd; lstnum ++) {
+        Gnum                nodeend;
+
+        nodeend = iwtab[lstnum];
+        if ((nodetab[nodeend].typeval == HALLORDERHMNODEELEM) || /* Skip eliminated and secondary variables */
+            (nodetab[nodeend].nvval <= 0))
+          continue;
+        if (passnum == 0)
+          hallOrderHmClaim (&claimtab[nodeend], prioval);
+        else if (claimtab[nodeend] != prioval)
+          goto reject;
+      }
+      memsiz += eptr->adjnbr;
+    }
+    for (adjnnd = mptr->adjidx + mptr->adjnbr; adjnum < adjnnd; adjnum ++) {
+      Gnum                nodeend;
+
+      nodeend = iwtab[adjnum];
+      if ((nodetab[nodeend].typeval == HALLORDERHMNODEELEM) ||
+          (nodetab[nodeend].nvval <= 0))
+        continue;
+      if (passnum == 0)
+        hallOrderHmClaim (&claimtab[nodeend], prioval);
+      else if (claimtab[nodeend] != prioval)
+        goto reject;
+    }
+
+    if (passnum != 0)                             /* Candidate holds its whole reach */
+      pivttab[candnum].memsiz = memsiz;
+    continue;
+reject:
+    pivttab[candnum].memsiz = -1;
+  }
+}
+
+/* This routine compacts the workspace by moving
+** all live adjacency lists towards its beginning.
+** The first item of each live list is replaced by
+** a negative marker holding the node number, and
+** is kept in the adjacency index of the node until
+** the list is moved.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmCompact (
+HallOrderHmData * restrict const  dataptr)
+{
+  HallOrderHmNode * restrict const  nodetab = dataptr->nodetab;
+  Gnum * restrict const             iwtab   = dataptr->iwtab;
+  const Gnum                        pfreval = dataptr->pfreval;
+  Gnum                              nodenum;
+  Gnum                              iwnum;
+  Gnum                              iwnew;
+
+  for (nodenum = 0; nodenum < dataptr->n; nodenum ++) {
+    HallOrderHmNode * restrict  nodeptr;
+    Gnum                        adjidx;
+
+    nodeptr = &nodetab[nodenum];
+    if ((nodeptr->adjnbr <= 0) ||                 /* Skip empty lists                 */
+        ((nodeptr->typeval == HALLORDERHMNODEELEM) ? (nodeptr->fathnum != -1) : (nodeptr->nvval <= 0))) /* And dead nodes */
+      continue;
+
+    adjidx = nodeptr->adjidx;
+    nodeptr->adjidx = iwtab[adjidx];
+    iwtab[adjidx]   = -1 - nodenum;
+  }
+
+  for (iwnum = iwnew = 0; iwnum < pfreval; ) {
+    HallOrderHmNode * restrict  nodeptr;
+    Gnum                        adjnum;
+    Gnum                        adjnnd;
+
+    if (iwtab[iwnum] >= 0) {                      /* Skip garbage */
+      iwnum ++;
+      continue;
+    }
+
+    nodeptr = &nodetab[-1 - iwtab[iwnum]];
+    iwtab[iwnew] = nodeptr->adjidx;
+    nodeptr->adjidx = iwnew;
+    for (adjnum = iwnum + 1, adjnnd = iwnum + nodeptr->adjnbr, iwnew ++; adjnum < adjnnd; adjnum ++, iwnew ++)
+      iwtab[iwnew] = iwtab[adjnum];
+    iwnum = adjnnd;
+  }
+  memSet (iwtab + iwnew, 0, (pfreval - iwnew) * sizeof (Gnum)); /* Remove stale markers from free space */
+  dataptr->pfreval = iwnew;
+}
+
+/* This routine keeps the accepted candidates
+** as pivots, in rank order, and reserves in the
+** workspace the room to build their elements.
+** The workspace is compacted, and enlarged if
+** necessary.
+** It returns:
+** - void  : in all cases. The elimination state
+**   is set to abort on error.
+*/
+
+static
+void
+hallOrderHmSelect (
+HallOrderHmData * restrict const  dataptr)
+{
+  HallOrderHmPivot * restrict const pivttab = dataptr->pivttab;
+  Gnum                              candnum;
+  Gnum                              pivtnbr;
+  Gnum                              pivtnum;
+  Gnum                              memsum;
+
+  for (candnum = pivtnbr = memsum = 0; candnum < dataptr->candnbr; candnum ++) {
+    if (pivttab[candnum].memsiz < 0)              /* Skip rejected candidates */
+      continue;
+
+    pivttab[pivtnbr].nodenum = pivttab[candnum].nodenum;
+    pivttab[pivtnbr].memsiz  = pivttab[candnum].memsiz;
+    pivttab[pivtnbr].lmeidx  = memsum;            /* Relative index for the time being */
+    memsum += pivttab[candnum].memsiz;
+    pivtnbr ++;
+  }
+  dataptr->pivtnbr = pivtnbr;
+  dataptr->nlefval = dataptr->totel - dataptr->nelval;
+
+  if ((dataptr->pfreval + memsum) > dataptr->iwsiz) {
+    hallOrderHmCompact (dataptr);
+
+    if ((dataptr->pfreval + memsum) > dataptr->iwsiz) {
+      Gnum *              iwtmp;
+      Gnum                iwsiz;
+
+      iwsiz = MAX (dataptr->iwsiz + (dataptr->iwsiz >> 1), dataptr->pfreval + memsum);
+      if ((iwtmp = (Gnum *) memRealloc (dataptr->iwtab, iwsiz * sizeof (Gnum))) == NULL) {
+        errorPrint ("hallOrderHmSelect: out of memory");
+        dataptr->statval = HALLORDERHMABORT;
+        return;
+      }
+      memSet (iwtmp + dataptr->iwsiz, 0, (iwsiz - dataptr->iwsiz) * sizeof (Gnum)); /* Garbage must not look like markers */
+      dataptr->iwtab = iwtmp;
+      dataptr->iwsiz = iwsiz;
+    }
+  }
+
+  for (pivtnum = 0; pivtnum < pivtnbr; pivtnum ++)
+    pivttab[pivtnum].lmeidx += dataptr->pfreval;
+  dataptr->pfreval += memsum;
+}
+
+/*************************************/
+/*                                   */
+/* These routines eliminate pivots.  */
+/*                                   */
+/*************************************/
+
+/* This routine turns a range of pivots into
+** elements. For each pivot, it builds the new
+** element from its reach, absorbing its adjacent
+** elements, then computes the set differences of
+** the elements adjacent to the new one, prunes the
+** lists of the variables of the new element, and
+** computes their approximate degrees and partial
+** fills, performing aggressive absorption of the
+** elements which are covered by the new one.
+** Weights of variables are not updated, since they
+** can be read by the threads handling other pivots;
+** mass elimination is only flagged in the hash array.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmElim (
+HallOrderHmData * restrict const    dataptr,
+HallOrderHmThread * restrict const  thrdptr,
+const Gnum                          pivtbas,
+const Gnum                          pivtnnd)
+{
+  HallOrderHmNode * restrict const  nodetab = dataptr->nodetab;
+  Gnum * restrict const             iwtab   = dataptr->iwtab;
+  Gnum * restrict const             hashtab = dataptr->hashtab;
+  Gnum * restrict const             wtab    = thrdptr->wtab;
+  Gnum * restrict const             wftab   = thrdptr->wftab;
+  const Gnum                        nlefval = dataptr->nlefval;
+  const Gnum                        n       = dataptr->n;
+  Gnum                              pivtnum;
+
+  for (pivtnum = pivtbas; pivtnum < pivtnnd; pivtnum ++) {
+    HallOrderHmPivot * restrict const pivtptr = &dataptr->pivttab[pivtnum];
+    HallOrderHmNode * restrict        mptr;
+    Gnum                              me;
+    Gnum                              wflg;
+    Gnum                              degme;
+    Gnum                              lmeidx;
+    Gnum                              lmennd;
+    Gnum                              lmenum;
+    Gnum                              adjnum;
+    Gnum                              adjnnd;
+
+    hallOrderHmFlag (dataptr, thrdptr, 0);
+    wflg = thrdptr->wflgval;
+
+    me   = pivtptr->nodenum;
+    mptr = &nodetab[me];
+    mptr->typeval = HALLORDERHMNODEELEM;          /* Pivot is no longer a variable */
+
+    lmeidx = pivtptr->lmeidx;                     /* Build new element in reserved space */
+    lmennd = lmeidx;
+    degme  = 0;
+    for (adjnum = mptr->adjidx, adjnnd = adjnum + mptr->elemnbr; adjnum < adjnnd; adjnum ++) {
+      HallOrderHmNode * restrict  eptr;
+      Gnum                        lstnum;
+      Gnum                        lstnnd;
+
+      eptr = &nodetab[iwtab[adjnum]];
+      if (eptr->fathnum != -1)
+        continue;
+
+      for (lstnum = eptr->adjidx, lstnnd = lstnum + eptr->adjnbr; lstnum < lstnnd; lstnum ++) {
+        Gnum                i;
+
+        i = iwtab[lstnum];
+        if ((nodetab[i].typeval != HALLORDERHMNODEELEM) && /* If principal variable not yet in Lme */
+            (nodetab[i].nvval > 0) && (wtab[i] != wflg)) {
+          wtab[i] = wflg;
+          iwtab[lmennd ++] = i;
+          degme += nodetab[i].nvval;
+        }
+      }
+      eptr->fathnum = me;                         /* Absorb element into new element */
+    }
+    for (adjnnd = mptr->adjidx + mptr->adjnbr; adjnum < adjnnd; adjnum ++) {
+      Gnum                i;
+
+      i = iwtab[adjnum];
+      if ((nodetab[i].typeval != HALLORDERHMNODEELEM) &&
+          (nodetab[i].nvval > 0) && (wtab[i] != wflg)) {
+        wtab[i] = wflg;
+        iwtab[lmennd ++] = i;
+        degme += nodetab[i].nvval;
+      }
+    }
+    pivtptr->lmenbr = lmennd - lmeidx;
+    pivtptr->nvpiv  = mptr->nvval;
+    pivtptr->degme  = degme;
+
+    wflg ++;                                      /* Set differences are computed above Lme flag */
+    for (lmenum = lmeidx; lmenum < lmennd; lmenum ++) { /* Compute (w[e] - wflg) = |Le\Lme| for all elements */
+      const HallOrderHmNode * restrict  iptr;
+      Gnum                              nvi;
+
+      iptr = &nodetab[iwtab[lmenum]];
+      nvi  = iptr->nvval;
+      for (adjnum = iptr->adjidx, adjnnd = adjnum + iptr->elemnbr; adjnum < adjnnd; adjnum ++) {
+        Gnum                e;
+
+        e = iwtab[adjnum];
+        if (nodetab[e].fathnum != -1)
+          continue;
+        if (wtab[e] >= wflg)                      /* If element already seen for this pivot */
+          wtab[e] -= nvi;
+        else {
+          wtab[e] = nodetab[e].degrval + wflg - nvi;
+          if (wftab != NULL)
+            wftab[e] = 0;
+        }
+      }
+    }
+
+    for (lmenum = lmeidx; lmenum < lmennd; lmenum ++) { /* Degree update and element absorption */
+      HallOrderHmNode * restrict  iptr;
+      Gnum                        i;
+      Gnum                        p1;
+      Gnum                        p2;
+      Gnum                        p3;
+      Gnum                        pn;
+      Gunum                       hash;
+      Gnum                        deg;
+      Gnum                        wf3;
+      Gnum                        wf4;
+      Gnum                        nvi;
+
+      i    = iwtab[lmenum];
+      iptr = &nodetab[i];
+      nvi  = iptr->nvval;
+      p1   = iptr->adjidx;
+      p2   = p1 + iptr->elemnbr;
+      hash = 0;
+      deg  =
+      wf3  =
+      wf4  = 0;
+      for (adjnum = pn = p1; adjnum < p2; adjnum ++) { /* Scan the element list of i */
+        Gnum                e;
+        Gnum                dext;
+
+        e = iwtab[adjnum];
+        if (nodetab[e].fathnum != -1)
+          continue;
+        dext = wtab[e] - wflg;                    /* dext = |Le\Lme| */
+        if (dext > 0) {
+          if (wftab != NULL) {
+            if (wftab[e] == 0)                    /* First time we meet e: compute its surface */
+              wftab[e] = dext * ((2 * nodetab[e].degrval) - dext - 1);
+            wf4 += wftab[e];
+          }
+          deg += dext;
+          iwtab[pn ++] = e;
+          hash += (Gunum) e;
+        }
+        else if (dext == 0)                       /* Aggressive absorption: Le is covered by Lme */
+          nodetab[e].fathnum = me;
+      }
+      p3 = pn;
+      for (adjnnd = p1 + iptr->adjnbr; adjnum < adjnnd; adjnum ++) { /* Scan the variable list of i */
+        Gnum                j;
+
+        j = iwtab[adjnum];
+        if ((nodetab[j].typeval != HALLORDERHMNODEELEM) && /* If principal variable not in Lme */
+            (nodetab[j].nvval > 0) && (wtab[j] != (wflg - 1))) {
+          deg += nodetab[j].nvval;
+          wf3 += nodetab[j].nvval;
+          iwtab[pn ++] = j;
+          hash += (Gunum) j;
+        }
+      }
+
+      if (iptr->typeval == HALLORDERHMNODEHALO)   /* Halo variables keep their degree */
+        hashtab[i] = -2;
+      else if (deg == 0) {                        /* Mass elimination, performed afterwards */
+        hashtab[i] = -1;
+        continue;
+      }
+      else {
+        if (wftab == NULL) {                      /* Approximate minimum degree */
+          deg = MIN (nlefval, deg);
+          iptr->degrval = MIN (iptr->degrval, deg);
+        }
+        else {                                    /* Approximate minimum fill */
+          if (iptr->degrval < deg) {              /* Approximate degree is loose; cannot subtract partial fill */
+            wf4 = 0;
+            wf3 = 0;
+          }
+          else
+            iptr->degrval = deg;
+          iptr->scorval = wf4 + 2 * nvi * wf3;
+        }
+        hashtab[i] = (Gnum) (hash % (Gunum) n);
+      }
+
+      iwtab[pn] = iwtab[p3];                      /* Add me to the front of the list of i */
+      iwtab[p3] = iwtab[p1];
+      iwtab[p1] = me;
+      iptr->adjnbr  = pn - p1 + 1;
+      iptr->elemnbr = p3 - p1 + 1;
+    }
+
+    thrdptr->wflgval = wflg + dataptr->norig + 2; /* Skip range of set differences */
+  }
+}
+
+/* This routine completes the elimination of a
+** range of pivots. For each of them, it performs
+** mass elimination, detects the supervariables of
+** the new element, by sorting its variables by hash
+** value and comparing their lists, and computes the
+** scores of its remaining variables. The removed
+** variables are kept after the principal ones in the
+** element list, so that they can be removed from their
+** buckets afterwards.
+** It returns:
+** - void  : in all cases. The abort flag of the
+**   thread is set on error.
+*/
+
+static
+void
+hallOrderHmSuper (
+HallOrderHmData * restrict const    dataptr,
+HallOrderHmThread * restrict const  thrdptr,
+const Gnum                          pivtbas,
+const Gnum                          pivtnnd)
+{
+  HallOrderHmNode * restrict const  nodetab = dataptr->nodetab;
+  Gnum * restrict const             iwtab   = dataptr->iwtab;
+  const Gnum * restrict const       hashtab = dataptr->hashtab;
+  Gnum * restrict const             wtab    = thrdptr->wtab;
+  const Gnum                        n       = dataptr->n;
+  const float                       dummy   = (float) (GNUMMAX - 1);
+  Gnum                              pivtnum;
+
+  for (pivtnum = pivtbas; pivtnum < pivtnnd; pivtnum ++) {
+    HallOrderHmPivot * restrict const pivtptr = &dataptr->pivttab[pivtnum];
+    HallOrderHmNode * restrict        mptr;
+    Gnum * restrict                   sorttab;
+    Gnum                              sortnbr;
+    Gnum                              sortnum;
+    Gnum                              me;
+    Gnum                              nvpiv;
+    Gnum                              degme;
+    Gnum                              nleft;
+    Gnum                              lmeidx;
+    Gnum                              lmennd;
+    Gnum                              lmenum;
+    Gnum                              lmenew;
+
+    me     = pivtptr->nodenum;
+    mptr   = &nodetab[me];
+    nvpiv  = pivtptr->nvpiv;
+    degme  = pivtptr->degme;
+    lmeidx = pivtptr->lmeidx;
+    lmennd = lmeidx + pivtptr->lmenbr;
+
+    if (thrdptr->sortsiz < pivtptr->lmenbr) {     /* Make sure sort array is large enough */
+      Gnum *              sorttmp;
+      Gnum                sortsiz;
+
+      sortsiz = MAX (pivtptr->lmenbr, thrdptr->sortsiz * 2);
+      sortsiz = MAX (sortsiz, HALLORDERHMSORTMIN);
+      if ((sorttmp = (Gnum *) ((thrdptr->sorttab == NULL) /* Never re-allocate an unset array */
+                               ? memAlloc   (sortsiz * 2 * sizeof (Gnum))
+                               : memRealloc (thrdptr->sorttab, sortsiz * 2 * sizeof (Gnum)))) == NULL) {
+        errorPrint ("hallOrderHmSuper: out of memory");
+        thrdptr->abrtval = 1;
+        return;
+      }
+      thrdptr->sorttab = sorttmp;
+      thrdptr->sortsiz = sortsiz;
+    }
+    sorttab = thrdptr->sorttab;
+
+    for (lmenum = lmeidx, sortnbr = 0; lmenum < lmennd; lmenum ++) {
+      HallOrderHmNode * restrict  iptr;
+      Gnum                        i;
+
+      i    = iwtab[lmenum];
+      iptr = &nodetab[i];
+      if (hashtab[i] == -1) {                     /* Mass elimination */
+        degme        -= iptr->nvval;
+        nvpiv        += iptr->nvval;
+        iptr->nvval   = 0;
+        iptr->fathnum = me;
+      }
+      else if (hashtab[i] >= 0) {                 /* Non-halo variable may be merged */
+        sorttab[2 * sortnbr]     = hashtab[i];
+        sorttab[2 * sortnbr + 1] = i;
+        sortnbr ++;
+      }
+    }
+
+    intSort2asc2 (sorttab, sortnbr);
+    hallOrderHmFlag (dataptr, thrdptr, sortnbr);
+    for (sortnum = 0; sortnum < sortnbr; ) {      /* For all groups of variables of same hash */
+      Gnum                sortnnd;
+      Gnum                sorttmp;
+
+      for (sortnnd = sortnum + 1; (sortnnd < sortnbr) && (sorttab[2 * sortnnd] == sorttab[2 * sortnum]); sortnnd ++) ;
+
+      for ( ; sortnum < sortnnd - 1; sortnum ++) {
+        HallOrderHmNode * restrict  iptr;
+        Gnum                        i;
+        Gnum                        adjnum;
+        Gnum                        adjnnd;
+        Gnum                        wflg;
+
+        i    = sorttab[2 * sortnum + 1];
+        iptr = &nodetab[i];
+        if (iptr->nvval == 0)                     /* Skip variables already merged */
+          continue;
+
+        wflg = thrdptr->wflgval ++;
+        for (adjnum = iptr->adjidx, adjnnd = adjnum + iptr->adjnbr; adjnum < adjnnd; adjnum ++)
+          wtab[iwtab[adjnum]] = wflg;
+
+        for (sorttmp = sortnum + 1; sorttmp < sortnnd; sorttmp ++) {
+          HallOrderHmNode * restrict  jptr;
+          Gnum                        j;
+
+          j    = sorttab[2 * sorttmp + 1];
+          jptr = &nodetab[j];
+          if ((jptr->nvval == 0) ||
+              (jptr->adjnbr  != iptr->adjnbr) ||
+              (jptr->elemnbr != iptr->elemnbr))
+            continue;
+          for (adjnum = jptr->adjidx, adjnnd = adjnum + jptr->adjnbr; adjnum < adjnnd; adjnum ++) {
+            if (wtab[iwtab[adjnum]] != wflg)
+              break;
+          }
+          if (adjnum < adjnnd)                    /* Lists differ */
+            continue;
+
+          iptr->nvval  += jptr->nvval;            /* Merge j into i */
+          jptr->nvval   = 0;
+          jptr->fathnum = i;
+          if (iptr->scorval < jptr->scorval)      /* Keep largest partial fill */
+            iptr->scorval = jptr->scorval;
+        }
+      }
+      sortnum = sortnnd;
+    }
+
+    nleft = dataptr->nlefval - nvpiv;
+    for (lmenum = lmenew = lmeidx; lmenum < lmennd; lmenum ++) { /* Compute scores and compact element */
+      HallOrderHmNode * restrict  iptr;
+      Gnum                        i;
+      Gnum                        nvi;
+
+      i    = iwtab[lmenum];
+      iptr = &nodetab[i];
+      nvi  = iptr->nvval;
+      if (nvi <= 0)                               /* Keep removed variables at end of element */
+        continue;
+
+      iwtab[lmenum] = iwtab[lmenew];
+      iwtab[lmenew ++] = i;
+      if (iptr->typeval == HALLORDERHMNODEHALO)
+        continue;
+
+      if (dataptr->typeval == HALLORDERHMTYPEDEGR) {
+        iptr->degrval = MIN (iptr->degrval + degme, nleft) - nvi;
+        iptr->scorval = iptr->degrval;
+      }
+      else {
+        Gnum                deg;
+        float               rmf;
+        float               rmf1;
+
+        deg = iptr->degrval;
+        if ((iptr->degrval + degme) > nleft) {
+          rmf1 = (float) deg * (float) ((deg - 1) + (2 * degme)) - (float) iptr->scorval;
+          iptr->degrval = nleft - nvi;
+          deg  = iptr->degrval;
+          rmf  = (float) deg * (float) (deg - 1) - (float) (degme - nvi) * (float) (degme - nvi - 1);
+          rmf  = MIN (rmf, rmf1);
+        }
+        else {
+          iptr->degrval += degme - nvi;
+          rmf = (float) deg * (float) ((deg - 1) + 2 * degme) - (float) iptr->scorval;
+        }
+
+        rmf /= (float) (nvi + 1);
+        if (rmf < dummy)
+          iptr->scorval = (Gnum) anint (rmf);
+        else if ((rmf / (float) n) < dummy)
+          iptr->scorval = (Gnum) anint (rmf / (float) n);
+        else
+          iptr->scorval = GNUMMAX - 1;
+        if (iptr->scorval < 1)
+          iptr->scorval = 1;
+      }
+    }
+
+    pivtptr->nvpiv = nvpiv;
+    mptr->adjidx   = lmeidx;                      /* Finalize the new element */
+    mptr->adjnbr   = lmenew - lmeidx;
+    mptr->elemnbr  = 0;
+    mptr->nvval    = nvpiv + degme;
+    mptr->degrval  = degme;
+  }
+}
+
+/* This routine updates the bucket lists
+** after the elimination of a round of pivots,
+** in rank order, so that the bucket lists do
+** not depend on the number of threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmUpdate (
+HallOrderHmData * restrict const  dataptr)
+{
+  const HallOrderHmNode * restrict const  nodetab = dataptr->nodetab;
+  const Gnum * restrict const             iwtab   = dataptr->iwtab;
+  const HallOrderHmPivot * restrict const pivttab = dataptr->pivttab;
+  Gnum                                    pivtnum;
+
+  for (pivtnum = 0; pivtnum < dataptr->pivtnbr; pivtnum ++) {
+    Gnum                lmenum;
+    Gnum                lmennd;
+
+    dataptr->nelval += pivttab[pivtnum].nvpiv;
+    hallOrderHmBuckDel (dataptr, pivttab[pivtnum].nodenum);
+
+    for (lmenum = pivttab[pivtnum].lmeidx, lmennd = lmenum + pivttab[pivtnum].lmenbr;
+         lmenum < lmennd; lmenum ++) {
+      Gnum                i;
+
+      i = iwtab[lmenum];
+      if (nodetab[i].typeval == HALLORDERHMNODEHALO)
+        continue;
+
+      hallOrderHmBuckDel (dataptr, i);
+      if (nodetab[i].nvval > 0)
+        hallOrderHmBuckAdd (dataptr, i, hallOrderHmBuck (dataptr, nodetab[i].scorval));
+    }
+  }
+}
+
+/* This routine performs elimination rounds
+** with the given thread only, as long as they
+** have fewer candidates than the given number.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmSeq (
+HallOrderHmData * restrict const    dataptr,
+HallOrderHmThread * restrict const  thrdptr,
+const Gnum                          candmin)
+{
+  while ((dataptr->statval == HALLORDERHMRUN) && (dataptr->candnbr < candmin)) {
+    hallOrderHmReach  (dataptr, 0, dataptr->candnbr, 0);
+    hallOrderHmReach  (dataptr, 0, dataptr->candnbr, 1);
+    hallOrderHmSelect (dataptr);
+    if (dataptr->statval != HALLORDERHMRUN)
+      return;
+    hallOrderHmElim   (dataptr, thrdptr, 0, dataptr->pivtnbr);
+    hallOrderHmSuper  (dataptr, thrdptr, 0, dataptr->pivtnbr);
+    if (thrdptr->abrtval != 0) {
+      dataptr->statval = HALLORDERHMABORT;
+      return;
+    }
+    hallOrderHmUpdate (dataptr);
+    hallOrderHmGather (dataptr);
+  }
+}
+
+/* This routine is the threaded core of the
+** ordering routine. Each round is processed
+** in five phases separated by barriers: claim
+** and acceptance of candidates, reservation of
+** workspace, construction of elements, then
+** detection of supervariables, and eventually
+** update of the buckets and gathering of the
+** candidates of the next round.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHmThrd (
+ThreadDescriptor * restrict const descptr,
+HallOrderHmData * restrict const  dataptr)
+{
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  HallOrderHmThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+
+  while (1) {
+    Gnum                candnbr;
+    Gnum                pivtnbr;
+
+    if (dataptr->statval != HALLORDERHMRUN)       /* Read elimination state after last barrier */
+      break;
+
+    candnbr = dataptr->candnbr;
+    if (candnbr < HALLORDERHMCANDMIN) {           /* If round too small to be worth sharing */
+      threadBarrier (descptr);                    /* All threads must have read the state   */
+      if (thrdnum == 0)
+        hallOrderHmSeq (dataptr, thrdptr, HALLORDERHMCANDMIN);
+      threadBarrier (descptr);                    /* Elimination state must be updated      */
+      continue;
+    }
+
+    hallOrderHmReach (dataptr, DATASCAN (candnbr, thrdnbr, thrdnum), DATASCAN (candnbr, thrdnbr, thrdnum + 1), 0);
+    threadBarrier (descptr);                      /* All claims must be made        */
+    hallOrderHmReach (dataptr, DATASCAN (candnbr, thrdnbr, thrdnum), DATASCAN (candnbr, thrdnbr, thrdnum + 1), 1);
+    threadBarrier (descptr);                      /* All candidates must be decided */
+    if (thrdnum == 0)
+      hallOrderHmSelect (dataptr);
+    threadBarrier (descptr);                      /* Workspace must be reserved     */
+    if (dataptr->statval != HALLORDERHMRUN)
+      break;
+
+    pivtnbr = dataptr->pivtnbr;
+    hallOrderHmElim (dataptr, thrdptr, DATASCAN (pivtnbr, thrdnbr, thrdnum), DATASCAN (pivtnbr, thrdnbr, thrdnum + 1));
+    threadBarrier (descptr);                      /* Weights must no longer be read */
+    hallOrderHmSuper (dataptr, thrdptr, DATASCAN (pivtnbr, thrdnbr, thrdnum), DATASCAN (pivtnbr, thrdnbr, thrdnum + 1));
+    threadBarrier (descptr);                      /* All elements must be complete  */
+    if (thrdnum == 0) {
+      int                 thrdtmp;
+
+      for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+        if (dataptr->thrdtab[thrdtmp].abrtval != 0)
+          dataptr->statval = HALLORDERHMABORT;
+      }
+      if (dataptr->statval == HALLORDERHMRUN) {
+        hallOrderHmUpdate (dataptr);
+        hallOrderHmGather (dataptr);
+      }
+    }
+    threadBarrier (descptr);                      /* Elimination state must be updated */
+  }
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes an approximate minimum
+** degree or minimum fill ordering of the given
+** halo graph, in the form of HAMF, that is, as
+** filled by hgraphOrderHxFill(): lists are based
+** at 1 and halo variables come last, with negative
+** lengths. Halo variables are never eliminated.
+** Unlike HAMF and HALMD, which eliminate one pivot
+** at a time, rounds of pivots of near-minimum score
+** with disjoint reaches are eliminated concurrently,
+** so that the elimination tree and supervariables
+** may differ; yet, they do not depend on the number
+** of threads. On output, the nv and pe arrays hold
+** the elimination tree, as expected by the
+** hallOrderHxBuild() routine.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hallOrderHmHamx (
+const Gnum                  n,                    /* Number of nodes, halo included    */
+const Gnum                  vnohnbr,              /* Number of non-halo nodes          */
+const Gnum                  norig,                /* Weight of nodes, halo included    */
+const int                   typeval,              /* Score type                        */
+const Gnum                  pfree,                /* Index of first free slot, based 1 */
+Gnum * const                petab,                /* Index of lists, then tree         */
+const Gnum * const          lentab,               /* Length of lists                   */
+const Gnum * const          iwtab,                /* Adjacency lists                   */
+Gnum * const                nvtab,                /* Node weights, then tree weights   */
+Context * const             contptr)              /* Execution context                 */
+{
+  HallOrderHmData       datadat;
+  HallOrderHmThread *   thrdtab;
+  HallOrderHmNode *     nodetab;
+  Gnum *                wtab;
+  Gnum *                wftab;
+  Gnum                  iwnum;
+  Gnum                  nodenum;
+  Gnum                  hrotnum;                  /* Root of halo variables, if any */
+  int                   thrdnbr;
+  int                   thrdnum;
+  int                   o;
+
+  thrdnbr = ((n < HALLORDERHMNODEMIN) ? 1 : contextThreadNbr (contptr));
+
+  datadat.n       = n;
+  datadat.vnohnbr = vnohnbr;
+  datadat.norig   = norig;
+  datadat.typeval = typeval;
+  datadat.nbbuck  = (typeval == HALLORDERHMTYPEDEGR) ? norig : (2 * norig);
+  datadat.pasval  = MAX ((norig / 8), 1);
+  datadat.iwsiz   = (pfree - 1) + (pfree - 1) / 4 + n;
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.nodetab,  (size_t) (n * sizeof (HallOrderHmNode)),
+                     &datadat.headtab,  (size_t) ((datadat.nbbuck + 1) * sizeof (Gnum)),
+                     &datadat.nexttab,  (size_t) (n * sizeof (Gnum)),
+                     &datadat.prevtab,  (size_t) (n * sizeof (Gnum)),
+                     &datadat.bucktab,  (size_t) (n * sizeof (Gnum)),
+                     &datadat.hashtab,  (size_t) (n * sizeof (Gnum)),
+                     &datadat.claimtab, (size_t) (n * sizeof (Gnum)),
+                     &datadat.pivttab,  (size_t) (HALLORDERHMCANDMAX * sizeof (HallOrderHmPivot)),
+                     &datadat.sorttab,  (size_t) (HALLORDERHMCANDMAX * 2 * sizeof (Gnum)),
+                     &thrdtab,          (size_t) (thrdnbr * sizeof (HallOrderHmThread)),
+                     &wtab,             (size_t) (thrdnbr * n * sizeof (Gnum)),
+                     &wftab,            (size_t) (((typeval == HALLORDERHMTYPEFILL) ? (thrdnbr * n) : 0) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hallOrderHmHamx: out of memory (1)");
+    return (1);
+  }
+  if ((datadat.iwtab = (Gnum *) memAlloc (datadat.iwsiz * sizeof (Gnum))) == NULL) {
+    errorPrint ("hallOrderHmHamx: out of memory (2)");
+    memFree    (datadat.nodetab);                 /* Free group leader */
+    return (1);
+  }
+
+  memSet (wtab, 0, thrdnbr * n * sizeof (Gnum));
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    thrdtab[thrdnum].wtab    = wtab + thrdnum * n;
+    thrdtab[thrdnum].wftab   = (typeval == HALLORDERHMTYPEFILL) ? (wftab + thrdnum * n) : NULL;
+    thrdtab[thrdnum].wflgval = 1;
+    thrdtab[thrdnum].sorttab = NULL;
+    thrdtab[thrdnum].sortsiz = 0;
+    thrdtab[thrdnum].abrtval = 0;
+  }
+  datadat.thrdtab = thrdtab;
+
+  for (iwnum = 0; iwnum < (pfree - 1); iwnum ++)  /* Un-base adjacency lists */
+    datadat.iwtab[iwnum] = iwtab[iwnum] - 1;
+  memSet (datadat.iwtab + iwnum, 0, (datadat.iwsiz - iwnum) * sizeof (Gnum)); /* Garbage must not look like markers */
+  datadat.pfreval = iwnum;
+
+  nodetab = datadat.nodetab;
+  memSet (datadat.headtab, ~0, (datadat.nbbuck + 1) * sizeof (Gnum));
+  memSet (datadat.bucktab, ~0, n * sizeof (Gnum));
+  memSet (datadat.claimtab, 0, n * sizeof (Gnum));
+  datadat.claimbas = 1;
+  datadat.buckmin  = datadat.nbbuck;
+  datadat.nelval   = 0;
+  datadat.totel    = 0;
+  for (nodenum = 0; nodenum < n; nodenum ++) {
+    HallOrderHmNode * restrict  nodeptr;
+
+    nodeptr = &nodetab[nodenum];
+    nodeptr->adjidx  = petab[nodenum] - 1;
+    nodeptr->adjnbr  = (nodenum < vnohnbr) ? lentab[nodenum] : ((lentab[nodenum] == (-1 - norig)) ? 0 : - lentab[nodenum]);
+    nodeptr->elemnbr = 0;
+    nodeptr->nvval   = nvtab[nodenum];
+    nodeptr->fathnum = -1;
+    nodeptr->typeval = (nodenum < vnohnbr) ? HALLORDERHMNODEVAR : HALLORDERHMNODEHALO;
+    if (nodenum < vnohnbr)
+      datadat.totel += nodeptr->nvval;
+  }
+  for (nodenum = 0; nodenum < vnohnbr; nodenum ++) { /* Compute initial degrees and fill buckets */
+    HallOrderHmNode * restrict  nodeptr;
+    Gnum                        adjnum;
+    Gnum                        adjnnd;
+    Gnum                        deg;
+
+    nodeptr = &nodetab[nodenum];
+    for (adjnum = nodeptr->adjidx, adjnnd = adjnum + nodeptr->adjnbr, deg = 0; adjnum < adjnnd; adjnum ++)
+      deg += nodetab[datadat.iwtab[adjnum]].nvval;
+    nodeptr->degrval = deg;
+    nodeptr->scorval = deg;
+    if (deg == 0) {                               /* Isolated variables are eliminated at once */
+      nodeptr->typeval = HALLORDERHMNODEELEM;
+      datadat.nelval  += nodeptr->nvval;
+    }
+    else
+      hallOrderHmBuckAdd (&datadat, nodenum, hallOrderHmBuck (&datadat, deg));
+  }
+
+  datadat.statval = HALLORDERHMRUN;
+  hallOrderHmGather (&datadat);
+  if (thrdnbr == 1)
+    hallOrderHmSeq (&datadat, &thrdtab[0], GNUMMAX);
+  else
+    contextThreadLaunch (contptr, (ThreadFunc) hallOrderHmThrd, (void *) &datadat);
+
+  o = 1;
+  if (datadat.statval == HALLORDERHMDONE) {
+    hrotnum = (vnohnbr < n) ? vnohnbr : -1;       /* First halo variable absorbs all others */
+    for (nodenum = 0; nodenum < n; nodenum ++) {
+      HallOrderHmNode * restrict  nodeptr;
+
+      nodeptr = &nodetab[nodenum];
+      switch (nodeptr->typeval) {
+        case HALLORDERHMNODEELEM :
+          nvtab[nodenum] = nodeptr->nvval;
+          petab[nodenum] = (nodeptr->fathnum != -1) ? (-1 - nodeptr->fathnum) : ((hrotnum != -1) ? (-1 - hrotnum) : 0);
+          break;
+        case HALLORDERHMNODEHALO :
+          nvtab[nodenum] = (nodenum == hrotnum) ? (n - vnohnbr) : 0;
+          petab[nodenum] = (nodenum == hrotnum) ? 0 : (-1 - hrotnum);
+          break;
+        default : {                               /* Secondary variable: find its element */
+          Gnum                nodetmp;
+
+          for (nodetmp = nodeptr->fathnum; nodetab[nodetmp].typeval != HALLORDERHMNODEELEM; nodetmp = nodetab[nodetmp].fathnum) ;
+          nodeptr->fathnum = nodetmp;             /* Compress path */
+          nvtab[nodenum] = 0;
+          petab[nodenum] = -1 - nodetmp;
+        }
+      }
+    }
+    o = 0;
+  }
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (thrdtab[thrdnum].sorttab != NULL)
+      memFree (thrdtab[thrdnum].sorttab);
+  }
+  memFree (datadat.iwtab);
+  memFree (datadat.nodetab);                      /* Free group leader */
+
+  return (o);
+}
@@ -0,0 +1,200 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hall_order_hm.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the multithreaded Halo Approximate  **/
+/**                Multiple Minimum Degree and Minimum     **/
+/**                Fill ordering routine.                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Maximum number of candidate pivots per
+    elimination round. It does not depend on
+    the number of threads, so that orderings
+    are the same whatever this number is.     +*/
+
+#define HALLORDERHMCANDMAX          256
+
+/*+ Number of candidate pivots below which
+    rounds are processed by a single thread,
+    to avoid paying barriers for tiny rounds. +*/
+
+#define HALLORDERHMCANDMIN          64
+
+/*+ Relative score slack within which
+    variables are candidate pivots.    +*/
+
+#define HALLORDERHMSCORRAT          0.1
+
+/*+ Number of nodes below which threads
+    are not launched at all.            +*/
+
+#define HALLORDERHMNODEMIN          1024
+
+/*+ Minimum size of per-thread sort arrays. +*/
+
+#define HALLORDERHMSORTMIN          256
+
+/*+ Score types. +*/
+
+#define HALLORDERHMTYPEDEGR         0             /* Approximate minimum degree */
+#define HALLORDERHMTYPEFILL         1             /* Approximate minimum fill   */
+
+/*+ Node types. +*/
+
+#define HALLORDERHMNODEVAR          0             /* Non-halo variable          */
+#define HALLORDERHMNODEHALO         1             /* Halo variable, never eliminated */
+#define HALLORDERHMNODEELEM         2             /* Element                    */
+
+/*+ Elimination state flags. +*/
+
+#define HALLORDERHMRUN              0             /* Elimination goes on        */
+#define HALLORDERHMDONE             1             /* All variables eliminated   */
+#define HALLORDERHMABORT            2             /* Elimination aborted on error */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The quotient graph node structure. All the
+    data of a node that are accessed when scanning
+    its neighbors are kept together, so that each
+    visit costs a single cache line. Variable lists
+    hold elements first, then variables; element
+    lists only hold variables.                       +*/
+
+typedef struct HallOrderHmNode_ {
+  Gnum                      adjidx;               /*+ Index of adjacency list in workspace       +*/
+  Gnum                      adjnbr;               /*+ Size of adjacency list                     +*/
+  Gnum                      elemnbr;              /*+ Number of leading elements in list         +*/
+  Gnum                      nvval;                /*+ Weight of variable, 0 if secondary, or
+                                                      true degree of element                     +*/
+  Gnum                      degrval;              /*+ Approximate degree of variable, or external
+                                                      degree of element                          +*/
+  Gnum                      scorval;              /*+ Elimination score of variable              +*/
+  Gnum                      fathnum;              /*+ Absorbing node, or -1 if none              +*/
+  Gnum                      typeval;              /*+ Node type                                  +*/
+} HallOrderHmNode;
+
+/*+ The pivot structure. Candidates are
+    sorted by increasing score; the accepted
+    ones are then compacted in the same order. +*/
+
+typedef struct HallOrderHmPivot_ {
+  Gnum                      nodenum;              /*+ Pivot variable                             +*/
+  Gnum                      memsiz;               /*+ Bound on element size, -1 if rejected      +*/
+  Gnum                      lmeidx;               /*+ Index of element list in workspace         +*/
+  Gnum                      lmenbr;               /*+ Number of variables in element, removed
+                                                      ones included                              +*/
+  Gnum                      nvpiv;                /*+ Weight of eliminated variables             +*/
+  Gnum                      degme;                /*+ External degree of element                 +*/
+} HallOrderHmPivot;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct HallOrderHmThread_ {
+  Gnum *                    wtab;                 /*+ Flag and set difference array              +*/
+  Gnum *                    wftab;                /*+ Element surface array, for minimum fill    +*/
+  Gnum                      wflgval;              /*+ Current flag value                         +*/
+  Gnum *                    sorttab;              /*+ Hash and variable pairs for supervariables +*/
+  Gnum                      sortsiz;              /*+ Size of sort array, in pairs               +*/
+  int                       abrtval;              /*+ Abort flag                                 +*/
+} HallOrderHmThread;
+
+/*+ The thread-independent data block. The
+    elimination state is only updated by the
+    first thread, between barriers.          +*/
+
+typedef struct HallOrderHmData_ {
+  Gnum                      n;                    /*+ Number of nodes, halo included             +*/
+  Gnum                      vnohnbr;              /*+ Number of non-halo nodes                   +*/
+  Gnum                      norig;                /*+ Weight of nodes, halo included             +*/
+  Gnum                      totel;                /*+ Weight of non-halo nodes                   +*/
+  int                       typeval;              /*+ Score type                                 +*/
+  Gnum                      nbbuck;               /*+ Index of last bucket                       +*/
+  Gnum                      pasval;               /*+ Score step of upper buckets                +*/
+  HallOrderHmNode *         nodetab;              /*+ Node array                                 +*/
+  Gnum *                    iwtab;                /*+ Workspace of adjacency lists               +*/
+  Gnum                      iwsiz;                /*+ Size of workspace                          +*/
+  Gnum                      pfreval;              /*+ Index of first free workspace slot         +*/
+  Gnum *                    headtab;              /*+ Heads of bucket lists                      +*/
+  Gnum *                    nexttab;              /*+ Next variable in bucket list               +*/
+  Gnum *                    prevtab;              /*+ Previous variable in bucket list           +*/
+  Gnum *                    bucktab;              /*+ Bucket of variable, or -1                  +*/
+  Gnum                      buckmin;              /*+ Lower bound on first non-empty bucket      +*/
+  Gnum *                    hashtab;              /*+ Hash value of variable list                +*/
+  Gnum *                    claimtab;             /*+ Claim priority of variable                 +*/
+  Gnum                      claimbas;             /*+ Base claim priority of current round       +*/
+  HallOrderHmPivot *        pivttab;              /*+ Array of candidates, then of pivots        +*/
+  Gnum                      candnbr;              /*+ Number of candidates                       +*/
+  Gnum                      pivtnbr;              /*+ Number of accepted pivots                  +*/
+  Gnum *                    sorttab;              /*+ Score and variable pairs for candidates    +*/
+  Gnum                      nelval;               /*+ Weight of eliminated variables             +*/
+  Gnum                      nlefval;              /*+ Weight of variables left at start of round +*/
+  int                       statval;              /*+ Elimination state                          +*/
+  HallOrderHmThread *       thrdtab;              /*+ Array of thread-specific data blocks       +*/
+} HallOrderHmData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_HALL_ORDER_HM
+static Gnum                 hallOrderHmBuck     (const HallOrderHmData * restrict const, const Gnum);
+static void                 hallOrderHmBuckAdd  (HallOrderHmData * restrict const, const Gnum, const Gnum);
+static void                 hallOrderHmBuckDel  (HallOrderHmData * restrict const, const Gnum);
+static void                 hallOrderHmFlag     (const HallOrderHmData * restrict const, HallOrderHmThread * restrict const, const Gnum);
+static void                 hallOrderHmGather   (HallOrderHmData * restrict const);
+static void                 hallOrderHmClaim    (Gnum * const, const Gnum);
+static void                 hallOrderHmReach    (HallOrderHmData * restrict const, const Gnum, const Gnum, const int);
+static void                 hallOrderHmCompact  (HallOrderHmData * restrict const);
+static void                 hallOrderHmSelect   (HallOrderHmData * restrict const);
+static void                 hallOrderHmElim     (HallOrderHmData * restrict const, HallOrderHmThread * restrict const, const Gnum, const Gnum);
+static void                 hallOrderHmSuper    (HallOrderHmData * restrict const, HallOrderHmThread * restrict const, const Gnum, const Gnum);
+static void                 hallOrderHmUpdate   (HallOrderHmData * restrict const);
+static void                 hallOrderHmSeq      (HallOrderHmData * restrict const, HallOrderHmThread * restrict const, const Gnum);
+static void                 hallOrderHmThrd     (ThreadDescriptor * restrict const, HallOrderHmData * restrict const);
+#endif /* SCOTCH_HALL_ORDER_HM */
+
+int                         hallOrderHmHamx     (const Gnum, const Gnum, const Gnum, const int, const Gnum, Gnum * const, const Gnum * const, const Gnum * const, Gnum * const, Context * const);
@@ -1,4 +1,4 @@
-/* Copyright 2007,2010,2012,2018,2019,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2010,2012,2018,2019,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 27 nov 2012     **/
 /**                                 to   : 23 may 2018     **/
 /**                # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 07 oct 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -416,6 +416,8 @@ Hgraph * restrict const     cgrfptr)              /* Centralized halo graph */
       cgrfptr->s.verttax[vertnum] = edgeadj;
     }
     cgrfptr->s.degrmax = degrmax;
+    cgrfptr->s.vconnbr = 0;
+    cgrfptr->s.vcontax = NULL;
   }
   else {
     if (dgrfptr->s.veloloctax != NULL) {          /* Get vertex loads if any */
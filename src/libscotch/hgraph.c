@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2012,2014,2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2012,2014,2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 23 may 2018     **/
 /**                # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -138,6 +138,8 @@ Graph * restrict const        ugrfptr)
   ugrfptr->edlotax = grafptr->s.edlotax;
   ugrfptr->edlosum = grafptr->enlosum;
   ugrfptr->degrmax = grafptr->s.degrmax;          /* Upper bound */
+  ugrfptr->vconnbr = 0;                           /* Vertex load constraints are not kept */
+  ugrfptr->vcontax = NULL;
 }
 
 /* This routine fills-in the halo fields of a
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2012,2018,2019,2022,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2012,2018,2019,2022,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,9 +72,9 @@ typedef struct Hgraph_ {
   Graph                     s;                    /*+ Source graph                                                   +*/
   Gnum                      vnohnbr;              /*+ Number of non-halo vertices                                    +*/
   Gnum                      vnohnnd;              /*+ Based number of first halo vertex in graph (s.vertnnd if none) +*/
-  Gnum *                    vnhdtax;              /*+ End vertex array for non-halo vertices [vnohnbr, based]        +*/
+  Genum *                   vnhdtax;              /*+ End vertex array for non-halo vertices [vnohnbr, based]        +*/
   Gnum                      vnlosum;              /*+ Sum of vertex loads for non-halo vertices only (<= s.velosum)  +*/
-  Gnum                      enohnbr;              /*+ Number of non-halo edges                                       +*/
+  Genum                     enohnbr;              /*+ Number of non-halo edges                                       +*/
   Gnum                      enlosum;              /*+ Sum of non-halo edge loads                                     +*/
   Gnum                      levlnum;              /*+ Nested dissection level                                        +*/
   Context *                 contptr;              /*+ Execution context                                              +*/
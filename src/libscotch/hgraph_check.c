@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 23 may 2018     **/
 /**                                 to   : 23 may 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -76,7 +76,7 @@ hgraphCheck (
 const Hgraph * restrict const grafptr)
 {
   Gnum                vertnum;                    /* Number of current vertex */
-  Gnum                edgenum;                    /* Number of current edge   */
+  Genum               edgenum;                    /* Number of current edge   */
   Gnum                enlosum;
 
   if (graphCheck (&grafptr->s) != 0) {
@@ -103,7 +103,7 @@ const Hgraph * restrict const grafptr)
     }
 
     if (grafptr->s.edlotax != NULL) {
-      Gnum                edgenum;
+      Genum               edgenum;
 
       for (edgenum = grafptr->s.verttax[vertnum]; edgenum < grafptr->vnhdtax[vertnum]; edgenum ++)
         enlosum += grafptr->s.edlotax[edgenum];
@@ -1,4 +1,4 @@
-/* Copyright 2019,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 27 dec 2019     **/
 /**                                 to   : 25 jan 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,9 +72,9 @@ FILE * const                  fileptr)            /* Output stream */
 {
   int                 o;
 
-  o  = graphDumpArrays (&grafptr->s, "Gnum", prefptr, suffptr, fileptr); /* Dump source graph data arrays */
+  o  = graphDumpArrays (&grafptr->s, "Gnum", "Genum", prefptr, suffptr, fileptr); /* Dump source graph data arrays */
   if (grafptr->vnhdtax != grafptr->s.vendtax)
-    o |= graphDumpArray  (grafptr->vnhdtax + grafptr->s.baseval, grafptr->vnohnbr, "Gnum", prefptr, "vnhdtab", suffptr, fileptr);
+    o |= graphDumpArrayEdge (grafptr->vnhdtax + grafptr->s.baseval, grafptr->vnohnbr, "Genum", prefptr, "vnhdtab", suffptr, fileptr);
 
   o |= (fprintf (fileptr,
                  "void\n"
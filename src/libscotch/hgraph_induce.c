@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2012,2014,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2012,2014,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 27 mar 2012     **/
 /**                                 to   : 20 aug 2020     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -94,8 +94,8 @@ Hgraph * restrict const           indgrafptr)     /* Pointer to induced subgraph
   Gnum                indvertnbr;                 /* Number of vertices in induced graph             */
   Gnum                indvertnum;                 /* Number of current vertex in induced graph       */
   Gnum                indvelosiz;
-  Gnum                indedgenbr;                 /* (Approximate) number of edges in induced graph  */
-  Gnum                indedgesiz;                 /* (Approximate) size of edge and edge load arrays */
+  Genum               indedgenbr;                 /* (Approximate) number of edges in induced graph  */
+  Genum               indedgesiz;                 /* (Approximate) size of edge and edge load arrays */
 
   memSet (indgrafptr, 0, sizeof (Hgraph));        /* Pre-initialize graph fields */
 
@@ -105,8 +105,8 @@ Hgraph * restrict const           indgrafptr)     /* Pointer to induced subgraph
   indvertnbr = indvnumnbr + indhalonbr;           /* Compute upper bound on number of vertices */
   indvelosiz = (orggrafptr->s.velotax != NULL) ? indvertnbr : 0;
   if (memAllocGroup ((void **) (void *)           /* Allocate induced graph structure */
-                     &indgrafptr->s.verttax, (size_t) ((indvertnbr + 1) * sizeof (Gnum)),
-                     &indgrafptr->vnhdtax,   (size_t) ( indvnumnbr      * sizeof (Gnum)), /* Put closest to beginning of array because no padding after */
+                     &indgrafptr->s.verttax, (size_t) ((indvertnbr + 1) * sizeof (Genum)),
+                     &indgrafptr->vnhdtax,   (size_t) ( indvnumnbr      * sizeof (Genum)), /* Put closest to beginning of array because no padding after */
                      &indgrafptr->s.velotax, (size_t) ( indvelosiz      * sizeof (Gnum)),
                      &indgrafptr->s.vnumtax, (size_t) ( indvertnbr      * sizeof (Gnum)), NULL) == NULL) {
     errorPrint ("hgraphInduceList: out of memory (1)");
@@ -140,11 +140,14 @@ Hgraph * restrict const           indgrafptr)     /* Pointer to induced subgraph
       return (1);
     }
   }
-  memSet (orgindxtax, ~0, orggrafptr->s.vertnbr * sizeof (Gnum)); /* Preset index array */
-  orgindxtax -= orggrafptr->s.baseval;            /* Base access to orgindxtab          */
+  orgindxtax -= orggrafptr->s.baseval;            /* Base access to orgindxtab */
+
+  if (hgraphInduceThrd (orggrafptr) == 0) {       /* If sequential induction, mark selected vertices now */
+    memSet (orgindxtax + orggrafptr->s.baseval, ~0, orggrafptr->s.vertnbr * sizeof (Gnum)); /* Preset index array */
 
-  for (indvertnum = indgrafptr->s.baseval; indvertnum < indgrafptr->vnohnnd; indvertnum ++) /* For all non-halo vertices */
-    orgindxtax[indgrafptr->s.vnumtax[indvertnum]] = indvertnum; /* Mark selected vertices */
+    for (indvertnum = indgrafptr->s.baseval; indvertnum < indgrafptr->vnohnnd; indvertnum ++) /* For all non-halo vertices */
+      orgindxtax[indgrafptr->s.vnumtax[indvertnum]] = indvertnum; /* Mark selected vertices */
+  }
 
   return (hgraphInduce2 (orggrafptr, orgindxtax, indgrafptr, indedgenbr, indedgetab));
 }
@@ -169,6 +172,9 @@ Gnum * restrict const           indedgetab)       /* Pointer to pre-allocated sp
 {
   void * restrict     indedgetnd;                 /* End of compacted edge array                 */
   Gnum                indvertnum;                 /* Current vertex number in induced halo graph */
+  int                 thrdval;                    /* Flag set if induction is multithreaded      */
+
+  thrdval = hgraphInduceThrd (orggrafptr);
 
   indedgetnd = memOffset (indedgetab, &indgrafptr->s.edgetax, (size_t) (indedgenbr * sizeof (Gnum)), NULL);
   indgrafptr->s.edgetax = indedgetab - indgrafptr->s.baseval;
@@ -191,7 +197,14 @@ Gnum * restrict const           indedgetab)       /* Pointer to pre-allocated sp
       return (1);
     }
 #endif /* SCOTCH_DEBUG_HGRAPH2 */
-    hgraphInduce2L (orggrafptr, orgindxtax, indgrafptr);
+    if (thrdval != 0) {                           /* If multithreaded induction */
+      if (hgraphInduceThrd2 (orggrafptr, orgindxtax, indgrafptr) != 0) {
+        hgraphExit (indgrafptr);
+        return (1);
+      }
+    }
+    else
+      hgraphInduce2L (orggrafptr, orgindxtax, indgrafptr);
 
     indedlooftval = indgrafptr->s.edlotax - indgrafptr->s.edgetax;
     memReallocGroup ((void *) indedgetab,         /* Implicitly free orgindxtab */
@@ -202,7 +215,14 @@ Gnum * restrict const           indedgetab)       /* Pointer to pre-allocated sp
     indgrafptr->s.edlotax  = indgrafptr->s.edgetax + indedlooftval; /* Use old index into old array as new index */
   }
   else {
-    hgraphInduce2U (orggrafptr, orgindxtax, indgrafptr);
+    if (thrdval != 0) {                           /* If multithreaded induction */
+      if (hgraphInduceThrd2 (orggrafptr, orgindxtax, indgrafptr) != 0) {
+        hgraphExit (indgrafptr);
+        return (1);
+      }
+    }
+    else
+      hgraphInduce2U (orggrafptr, orgindxtax, indgrafptr);
 
     indgrafptr->s.edgetax  = memRealloc ((void *) indedgetab, indgrafptr->s.edgenbr * sizeof (Gnum)); /* Use real number of edges, implicitely free orgindxtab */
     indgrafptr->s.edgetax -= indgrafptr->s.baseval;
@@ -211,7 +231,8 @@ Gnum * restrict const           indedgetab)       /* Pointer to pre-allocated sp
   indgrafptr->levlnum   = orggrafptr->levlnum + 1; /* Induced subgraph is one level below    */
   indgrafptr->contptr   = orggrafptr->contptr;    /* Use same execution context              */
 
-  if (orggrafptr->s.vnumtax != NULL) {            /* Adjust vnumtax */
+  if ((orggrafptr->s.vnumtax != NULL) &&          /* Adjust vnumtax, if not already done by threads */
+      (thrdval == 0)) {
     const Gnum * restrict const orgvnumtax = orggrafptr->s.vnumtax;
     Gnum * restrict const indvnumtax       = indgrafptr->s.vnumtax;
 
@@ -277,12 +298,12 @@ const Hgraph * restrict const orggrafptr,         /* Pointer to original graph *
 const Gnum                    indvnumnbr,
 const Gnum * restrict const   indvnumtab)
 {
-  Gnum                indedgenbr;                 /* Revised number of edges in induced halo graph */
+  Genum               indedgenbr;                 /* Revised number of edges in induced halo graph */
   Gnum                indvertnum;                 /* Current vertex number in induced halo graph   */
   Gnum * restrict     orgindxtax;                 /* Array of numbers of selected vertices         */
 
-  const Gnum * restrict const orgverttax = orggrafptr->s.verttax;
-  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->s.verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->s.vendtax;
   const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
 
   if ((orgindxtax = memAlloc (orggrafptr->s.vertnbr * sizeof (Gnum))) == NULL)
@@ -296,7 +317,7 @@ const Gnum * restrict const   indvnumtab)
   for (indvertnum = 0, indedgenbr = 0;            /* For all vertices in list */
        indvertnum < indvnumnbr; indvertnum ++) {
     Gnum                orgvertnum;               /* Current vertex number in original halo graph */
-    Gnum                orgedgenum;               /* Current edge number in original halo graph   */
+    Genum               orgedgenum;               /* Current edge number in original halo graph   */
 
     orgvertnum = indvnumtab[indvertnum];          /* Get number of original vertex                  */
     indedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum]; /* Add degree of original vertex */
@@ -312,3 +333,379 @@ const Gnum * restrict const   indvnumtab)
 
   return (indedgenbr);
 }
+
+/* This routine tells whether induction
+** is worth being multithreaded, given the
+** number of threads of the context of the
+** original graph and its size.
+** It returns:
+** - 0   : if induction is to be sequential.
+** - !0  : if all the threads of the context
+**         are to be used.
+*/
+
+static
+int
+hgraphInduceThrd (
+const Hgraph * restrict const orggrafptr)         /* Pointer to original graph */
+{
+#ifdef SCOTCH_PTHREAD
+  int                 thrdnbr;
+
+  if (orggrafptr->contptr == NULL)
+    return (0);
+
+  thrdnbr = contextThreadNbr (orggrafptr->contptr);
+  return ((thrdnbr > 1) && (orggrafptr->s.vertnbr >= HGRAPHINDUCETHRDMIN));
+#else /* SCOTCH_PTHREAD */
+  return (0);
+#endif /* SCOTCH_PTHREAD */
+}
+
+/* This routine performs a prefix scan
+** sum operation on a single Genum value,
+** backed by a temporary area.
+*/
+
+static
+void
+hgraphInduceScan (
+Genum * restrict const      tlocptr,              /* Pointer to local area   */
+Genum * restrict const      tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* These routines aggregate the partial
+** parameters of the induced halo graph,
+** computed by multiple threads for its
+** non-halo and halo vertices, respectively.
+*/
+
+static
+void
+hgraphInduceReduce1 (
+HgraphInduceThread * restrict const tlocptr,      /* Pointer to local thread block  */
+HgraphInduceThread * restrict const tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->indvnlosum += tremptr->indvnlosum;
+  tlocptr->indenohnbr += tremptr->indenohnbr;
+  tlocptr->indenlosum += tremptr->indenlosum;
+  tlocptr->indedlosum += tremptr->indedlosum;
+  if (tremptr->inddegrmax > tlocptr->inddegrmax)
+    tlocptr->inddegrmax = tremptr->inddegrmax;
+}
+
+static
+void
+hgraphInduceReduce2 (
+HgraphInduceThread * restrict const tlocptr,      /* Pointer to local thread block  */
+HgraphInduceThread * restrict const tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->indvhlosum += tremptr->indvhlosum;
+  tlocptr->indehlosum += tremptr->indehlosum;
+  if (tremptr->inddhlmax > tlocptr->inddhlmax)
+    tlocptr->inddhlmax = tremptr->inddhlmax;
+}
+
+/* This routine fills the vertex and edge
+** arrays of the induced halo graph, using all
+** the threads of the context of the original
+** graph. It yields the same graph as the
+** sequential hgraphInduce2L() and hgraphInduce2U()
+** routines.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+hgraphInduceThrd2 (
+const Hgraph * restrict const   orggrafptr,       /* Pointer to original graph             */
+Gnum * restrict const           orgindxtax,       /* Array of numbers of selected vertices */
+Hgraph * restrict const         indgrafptr)       /* Pointer to induced graph              */
+{
+  HgraphInduceData    indudat;
+  HgraphInduceThread * restrict thrdptr;
+
+  if ((indudat.thrdtab = memAlloc (contextThreadNbr (orggrafptr->contptr) * sizeof (HgraphInduceThread))) == NULL) {
+    errorPrint ("hgraphInduceThrd2: out of memory");
+    return (1);
+  }
+  indudat.orggrafptr = orggrafptr;
+  indudat.indgrafptr = indgrafptr;
+  indudat.orgindxtax = orgindxtax;
+
+  contextThreadLaunch (orggrafptr->contptr, (ThreadFunc) hgraphInduceThrd3, (void *) &indudat);
+
+  thrdptr = &indudat.thrdtab[0];                  /* Reduced values are in first thread block */
+  indgrafptr->s.vertnbr = indudat.indvertnnd - indgrafptr->s.baseval;
+  indgrafptr->s.vertnnd = indudat.indvertnnd;
+  indgrafptr->s.velosum = (indgrafptr->s.velotax != NULL) ? (thrdptr->indvnlosum + thrdptr->indvhlosum) : indgrafptr->s.vertnbr;
+  indgrafptr->s.edgenbr = indgrafptr->s.verttax[indudat.indvertnnd] - indgrafptr->s.baseval; /* Set actual number of edges */
+  indgrafptr->s.edlosum = (indgrafptr->s.edlotax != NULL) ? (thrdptr->indedlosum + thrdptr->indehlosum) : indgrafptr->s.edgenbr;
+  indgrafptr->s.degrmax = MAX (thrdptr->inddegrmax, thrdptr->inddhlmax);
+  indgrafptr->vnlosum   = (indgrafptr->s.velotax != NULL) ? thrdptr->indvnlosum : indgrafptr->vnohnbr;
+  indgrafptr->enohnbr   = thrdptr->indenohnbr;
+  indgrafptr->enlosum   = (indgrafptr->s.edlotax != NULL) ? thrdptr->indenlosum : thrdptr->indenohnbr;
+
+  memFree (indudat.thrdtab);
+
+  return (0);
+}
+
+/* This routine is the threaded core of the
+** building of the induced halo graph.
+** Non-halo vertices keep all their edges,
+** so that their edge sub-arrays are located
+** by a prefix sum of their original degrees.
+** Edges to halo vertices are first recorded
+** with their original end vertex numbers,
+** then renumbered by the first thread, in
+** the same order as the sequential routine,
+** so that the induced graph does not depend
+** on the number of threads. Halo vertices
+** are eventually processed in parallel.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hgraphInduceThrd3 (
+ThreadDescriptor * restrict const descptr,
+HgraphInduceData * restrict const dataptr)
+{
+  Gnum                indvertbas;                 /* Start of slice of induced vertices          */
+  Gnum                indvertnnd;                 /* End of slice of induced vertices            */
+  Gnum                indvertnum;                 /* Number of current induced vertex            */
+  Gnum                indvelosum;                 /* Sum of local vertex loads                   */
+  Gnum                indenohnbr;                 /* Number of local non-halo edges              */
+  Gnum                indenlosum;                 /* Sum of local non-halo edge loads            */
+  Gnum                indedlosum;                 /* Sum of local edge loads                     */
+  Gnum                inddegrmax;                 /* Local maximum degree                        */
+  Genum               indedgenbr;                 /* Number of local edges                       */
+  Genum               indedgenum;                 /* Number of current edge in induced subgraph  */
+  Gnum * restrict     indedlotax;                 /* Edge load array; not const as it will move  */
+
+  const Hgraph * restrict const       orggrafptr = dataptr->orggrafptr;
+  Hgraph * restrict const             indgrafptr = dataptr->indgrafptr;
+  const int                           thrdnbr    = threadNbr (descptr);
+  const int                           thrdnum    = threadNum (descptr);
+  HgraphInduceThread * restrict const thrdptr    = &dataptr->thrdtab[thrdnum];
+  const Gnum                          baseval    = orggrafptr->s.baseval;
+  const Gnum                          vnohnnd    = indgrafptr->vnohnnd;
+  const Genum * restrict const        orgverttax = orggrafptr->s.verttax;
+  const Genum * restrict const        orgvendtax = orggrafptr->s.vendtax;
+  const Gnum * restrict const         orgvelotax = orggrafptr->s.velotax;
+  const Gnum * restrict const         orgvnumtax = orggrafptr->s.vnumtax;
+  const Gnum * restrict const         orgedgetax = orggrafptr->s.edgetax;
+  const Gnum * restrict const         orgedlotax = orggrafptr->s.edlotax;
+  Gnum * restrict const               orgindxtax = dataptr->orgindxtax;
+  Genum * restrict const              indvnhdtax = indgrafptr->vnhdtax;
+  Genum * restrict const              indverttax = indgrafptr->s.verttax;
+  Gnum * restrict const               indvelotax = indgrafptr->s.velotax;
+  Gnum * restrict const               indvnumtax = indgrafptr->s.vnumtax;
+  Gnum * restrict const               indedgetax = indgrafptr->s.edgetax;
+
+  {                                               /* Mark selected vertices */
+    const Gnum          orgvertbas = baseval + DATASCAN (orggrafptr->s.vertnbr, thrdnbr, thrdnum);
+    const Gnum          orgvertnnd = baseval + DATASCAN (orggrafptr->s.vertnbr, thrdnbr, thrdnum + 1);
+
+    memSet (orgindxtax + orgvertbas, ~0, (orgvertnnd - orgvertbas) * sizeof (Gnum)); /* Preset local slice of index array */
+  }
+  indvertbas = baseval + DATASCAN (indgrafptr->vnohnbr, thrdnbr, thrdnum);
+  indvertnnd = baseval + DATASCAN (indgrafptr->vnohnbr, thrdnbr, thrdnum + 1);
+  threadBarrier (descptr);                        /* Whole index array must be preset before being marked */
+
+  for (indvertnum = indvertbas; indvertnum < indvertnnd; indvertnum ++)
+    orgindxtax[indvnumtax[indvertnum]] = indvertnum;
+
+  for (indvertnum = indvertbas, indedgenbr = 0;   /* Non-halo vertices keep all of their edges */
+       indvertnum < indvertnnd; indvertnum ++) {
+    Gnum                orgvertnum;
+
+    orgvertnum  = indvnumtax[indvertnum];
+    indedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum];
+  }
+  thrdptr->scantab[0] = indedgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (HgraphInduceThread), (ThreadScanFunc) hgraphInduceScan, NULL); /* Also barrier for index array */
+  if (thrdnum == (thrdnbr - 1))
+    dataptr->indedgennd = baseval + thrdptr->scantab[0];
+
+  indedlotax = indgrafptr->s.edlotax;
+  indvelosum =
+  indenohnbr =
+  indenlosum =
+  indedlosum =
+  inddegrmax = 0;
+  for (indvertnum = indvertbas, indedgenum = baseval + thrdptr->scantab[0] - indedgenbr; /* For all local non-halo vertices */
+       indvertnum < indvertnnd; indvertnum ++) {
+    Gnum                orgvertnum;
+    Genum               orgedgenum;
+    Genum               indedgennd;               /* Index of after-last edge position in edge array       */
+    Genum               indedhdnum;               /* Index of after-last edge linking to non-halo vertices */
+    Gnum                inddegrval;
+
+    orgvertnum = indvnumtax[indvertnum];
+    indverttax[indvertnum] = indedgenum;
+    indenohnbr -= indedgenum;                     /* Subtract base of non-halo edges */
+    if (indvelotax != NULL) {                     /* If graph has vertex weights     */
+      indvelosum +=                               /* Accumulate vertex loads         */
+      indvelotax[indvertnum] = orgvelotax[orgvertnum];
+    }
+
+    inddegrval = orgvendtax[orgvertnum] - orgverttax[orgvertnum]; /* Get degree of non-halo node */
+    if (inddegrmax < inddegrval)                  /* Keep maximum degree                         */
+      inddegrmax = inddegrval;
+
+    for (orgedgenum = orgverttax[orgvertnum], indedhdnum = indedgennd = indedgenum + inddegrval;
+         orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+      Gnum                orgvertend;
+      Gnum                indvertend;
+
+      orgvertend = orgedgetax[orgedgenum];
+      indvertend = orgindxtax[orgvertend];
+      if (indvertend == ~0) {                     /* If neighbor is halo vertex, keep its original number for now */
+        indedhdnum --;
+        indedgetax[indedhdnum] = orgvertend;
+        if (indedlotax != NULL)
+          indedlosum += indedlotax[indedhdnum] = orgedlotax[orgedgenum];
+      }
+      else {                                      /* If neighbor is non-halo vertex */
+        indedgetax[indedgenum] = indvertend;
+        if (indedlotax != NULL) {
+          indedlosum += indedlotax[indedgenum] = orgedlotax[orgedgenum];
+          indenlosum += orgedlotax[orgedgenum];
+        }
+        indedgenum ++;
+      }
+    }
+    indenohnbr += indedhdnum;                     /* Add position to number of non-halo edges */
+    indvnhdtax[indvertnum] = indedhdnum;          /* Set end of non-halo sub-array            */
+    indedgenum = indedgennd;                      /* Point to next free space in edge array   */
+  }
+  thrdptr->indvnlosum = indvelosum;
+  thrdptr->indenohnbr = indenohnbr;
+  thrdptr->indenlosum = indenlosum;
+  thrdptr->indedlosum = indedlosum;
+  thrdptr->inddegrmax = inddegrmax;
+  threadReduce (descptr, (void *) thrdptr, sizeof (HgraphInduceThread), (ThreadReduceFunc) hgraphInduceReduce1, 0, NULL);
+
+  if (thrdnum == 0) {                             /* First thread numbers halo vertices in sequential order */
+    Gnum                indvertend;
+
+    for (indvertnum = baseval, indvertend = vnohnnd; indvertnum < vnohnnd; indvertnum ++) {
+      Gnum                orgvertnum;
+
+      orgvertnum = indvnumtax[indvertnum];
+      for (indedgenum = indverttax[indvertnum] + (orgvendtax[orgvertnum] - orgverttax[orgvertnum]); /* Halo edges were stored backwards */
+           indedgenum > indvnhdtax[indvertnum]; ) {
+        Gnum                orgvertend;
+
+        indedgenum --;
+        orgvertend = indedgetax[indedgenum];
+        if (orgindxtax[orgvertend] == ~0) {       /* If neighbor is yet undeclared halo vertex */
+          indvnumtax[indvertend] = orgvertend;    /* Add number of halo vertex to array        */
+          orgindxtax[orgvertend] = indvertend ++; /* Get induced number of vertex              */
+        }
+        indedgetax[indedgenum] = orgindxtax[orgvertend];
+      }
+    }
+    dataptr->indvertnnd = indvertend;
+
+    if (indedlotax != NULL) {                     /* If edge loads present, move edge load array after final edge array */
+      Gnum *              indedgetab;             /* Dummy area to recieve un-based edgetab   */
+      Gnum *              indedlotab;             /* Save of old position of edgetab array    */
+      Genum               indedgenbs;             /* Revised number of edges in halo subgraph */
+
+      indedgenbs = 2 * (dataptr->indedgennd - baseval) - thrdptr->indenohnbr; /* Compute total number of edges */
+      indedlotab = indedlotax + baseval;          /* Save old offset of move area */
+      memOffset (indedgetax + baseval,            /* Compute new offsets          */
+                 &indedgetab, (size_t) (indedgenbs * sizeof (Gnum)),
+                 &indedlotax, (size_t) (indedgenbs * sizeof (Gnum)), NULL);
+      memMov (indedlotax, indedlotab, (dataptr->indedgennd - baseval) * sizeof (Gnum)); /* Move already existing edge load array */
+      indgrafptr->s.edlotax = indedlotax - baseval; /* Record new position of edge load array */
+    }
+  }
+  threadBarrier (descptr);                        /* Halo vertices and edge load array are now known */
+
+  indedlotax = indgrafptr->s.edlotax;
+  indvertbas = vnohnnd + DATASCAN (dataptr->indvertnnd - vnohnnd, thrdnbr, thrdnum);
+  indvertnnd = vnohnnd + DATASCAN (dataptr->indvertnnd - vnohnnd, thrdnbr, thrdnum + 1);
+  for (indvertnum = indvertbas, indedgenbr = 0;   /* Count edges of halo vertices */
+       indvertnum < indvertnnd; indvertnum ++) {
+    Gnum                orgvertnum;
+    Genum               orgedgenum;
+
+    orgvertnum = indvnumtax[indvertnum];
+    for (orgedgenum = orgverttax[orgvertnum];
+         orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+      Gnum                indvertend;
+
+      indvertend = orgindxtax[orgedgetax[orgedgenum]];
+      if ((indvertend != ~0) &&                   /* If end vertex in induced halo subgraph */
+          (indvertend < vnohnnd))                 /* And in its non-halo part only          */
+        indedgenbr ++;
+    }
+  }
+  thrdptr->scantab[0] = indedgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (HgraphInduceThread), (ThreadScanFunc) hgraphInduceScan, NULL);
+
+  indvelosum =
+  indedlosum =
+  inddegrmax = 0;
+  for (indvertnum = indvertbas, indedgenum = dataptr->indedgennd + thrdptr->scantab[0] - indedgenbr; /* For all local halo vertices */
+       indvertnum < indvertnnd; indvertnum ++) {
+    Gnum                orgvertnum;
+    Genum               orgedgenum;
+
+    orgvertnum = indvnumtax[indvertnum];
+    indverttax[indvertnum] = indedgenum;
+    if (indvelotax != NULL) {                     /* If graph has vertex weights */
+      indvelosum +=                               /* Accumulate vertex loads     */
+      indvelotax[indvertnum] = orgvelotax[orgvertnum];
+    }
+
+    for (orgedgenum = orgverttax[orgvertnum];
+         orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+      Gnum                indvertend;
+
+      indvertend = orgindxtax[orgedgetax[orgedgenum]];
+      if ((indvertend != ~0) &&                   /* If end vertex in induced halo subgraph */
+          (indvertend < vnohnnd)) {               /* And in its non-halo part only          */
+        indedgetax[indedgenum] = indvertend;
+        if (indedlotax != NULL)
+          indedlosum += indedlotax[indedgenum] = orgedlotax[orgedgenum];
+        indedgenum ++;
+      }
+    }
+    if (inddegrmax < (indedgenum - indverttax[indvertnum]))
+      inddegrmax = (indedgenum - indverttax[indvertnum]);
+  }
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread sets end of compact vertex array */
+    indverttax[dataptr->indvertnnd] = indedgenum;
+
+  if (orgvnumtax != NULL) {                       /* Adjust local slices of vnumtax, which are no longer used */
+    Gnum                indvnhdbas;
+    Gnum                indvnhdnnd;
+
+    indvnhdbas = baseval + DATASCAN (indgrafptr->vnohnbr, thrdnbr, thrdnum);
+    indvnhdnnd = baseval + DATASCAN (indgrafptr->vnohnbr, thrdnbr, thrdnum + 1);
+    for (indvertnum = indvnhdbas; indvertnum < indvnhdnnd; indvertnum ++)
+      indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
+    for (indvertnum = indvertbas; indvertnum < indvertnnd; indvertnum ++)
+      indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
+  }
+
+  thrdptr->indvhlosum = indvelosum;
+  thrdptr->indehlosum = indedlosum;
+  thrdptr->inddhlmax  = inddegrmax;
+  threadReduce (descptr, (void *) thrdptr, sizeof (HgraphInduceThread), (ThreadReduceFunc) hgraphInduceReduce2, 0, NULL);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,10 +44,48 @@
 /**                # Version 6.0  : from : 05 apr 2018     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Minimum number of original vertices for
+    multithreaded induction to be worth it. +*/
+
+#define HGRAPHINDUCETHRDMIN         2048
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct HgraphInduceThread_ {
+  Gnum                      indvnlosum;           /*+ Sum of local non-halo vertex loads        +*/
+  Gnum                      indenohnbr;           /*+ Number of local non-halo edges            +*/
+  Gnum                      indenlosum;           /*+ Sum of local non-halo edge loads          +*/
+  Gnum                      indedlosum;           /*+ Sum of edge loads of non-halo vertices    +*/
+  Gnum                      inddegrmax;           /*+ Maximum degree of non-halo vertices       +*/
+  Gnum                      indvhlosum;           /*+ Sum of local halo vertex loads            +*/
+  Gnum                      indehlosum;           /*+ Sum of edge loads of halo vertices        +*/
+  Gnum                      inddhlmax;            /*+ Maximum degree of halo vertices           +*/
+  Genum                     scantab[2];           /*+ Scan area for edge indices                +*/
+} HgraphInduceThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct HgraphInduceData_ {
+  const Hgraph *            orggrafptr;           /*+ Original halo graph                       +*/
+  Hgraph *                  indgrafptr;           /*+ Induced halo graph being built            +*/
+  Gnum *                    orgindxtax;           /*+ Original to induced vertex number array   +*/
+  Genum                     indedgennd;           /*+ End of edges of non-halo vertices         +*/
+  Gnum                      indvertnnd;           /*+ End of induced vertices, once numbered    +*/
+  HgraphInduceThread *      thrdtab;              /*+ Array of thread-specific data blocks      +*/
+} HgraphInduceData;
+
 /*
 **  The function prototypes.
 */
@@ -57,4 +95,10 @@ static int                  hgraphInduce2       (const Hgraph * const, Gnum * co
 static void                 hgraphInduce2L      (const Hgraph * const, Gnum * const, Hgraph * const);
 static void                 hgraphInduce2U      (const Hgraph * const, Gnum * const, Hgraph * const);
 static Gnum                 hgraphInduce3       (const Hgraph * restrict const, const Gnum, const Gnum * restrict const);
+static int                  hgraphInduceThrd    (const Hgraph * const);
+static void                 hgraphInduceScan    (Genum * restrict const, Genum * restrict const, const int, const int, const void * const);
+static void                 hgraphInduceReduce1 (HgraphInduceThread * restrict const, HgraphInduceThread * restrict const, const void * const);
+static void                 hgraphInduceReduce2 (HgraphInduceThread * restrict const, HgraphInduceThread * restrict const, const void * const);
+static int                  hgraphInduceThrd2   (const Hgraph * const, Gnum * const, Hgraph * const);
+static void                 hgraphInduceThrd3   (ThreadDescriptor * restrict const, HgraphInduceData * restrict const);
 #endif /* SCOTCH_HGRAPH_INDUCE */
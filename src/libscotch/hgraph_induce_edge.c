@@ -61,7 +61,7 @@ Hgraph * restrict const       indgrafptr)         /* Pointer to induced halo gra
   Gnum                indvertnum;                 /* Number of current induced vertex                */
   Gnum                indvertnnd;                 /* Number of after-last induced (halo) vertex      */
   Gnum                indvelosum;                 /* Overall induced vertex load                     */
-  Gnum                indedgenum;                 /* Number of current edge in induced halo subgraph */
+  Genum               indedgenum;                 /* Number of current edge in induced halo subgraph */
   Gnum                indenohnbr;                 /* Number of non-halo edges in halo subgraph       */
   Gnum                inddegrmax;                 /* Maximum degree                                  */
 #ifdef SCOTCH_DEBUG_HGRAPH2
@@ -72,12 +72,12 @@ Hgraph * restrict const       indgrafptr)         /* Pointer to induced halo gra
   Gnum                indenlosum;
 #endif /* HGRAPHINDUCE2L */
 
-  const Gnum * restrict const orgverttax = orggrafptr->s.verttax;
-  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->s.verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->s.vendtax;
   const Gnum * restrict const orgvelotax = orggrafptr->s.velotax;
   const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
-  Gnum * restrict const       indvnhdtax = indgrafptr->vnhdtax;
-  Gnum * restrict const       indverttax = indgrafptr->s.verttax;
+  Genum * restrict const       indvnhdtax = indgrafptr->vnhdtax;
+  Genum * restrict const       indverttax = indgrafptr->s.verttax;
   Gnum * restrict const       indvelotax = indgrafptr->s.velotax;
   Gnum * restrict const       indvnumtax = indgrafptr->s.vnumtax;
   Gnum * restrict const       indedgetax = indgrafptr->s.edgetax;
@@ -92,8 +92,8 @@ Hgraph * restrict const       indgrafptr)         /* Pointer to induced halo gra
   for (indvertnum = indedgenum = indgrafptr->s.baseval, indvelosum = indenohnbr = 0, indvertnnd = indgrafptr->vnohnnd; /* For all non-halo vertices */
        indvertnum < indgrafptr->vnohnnd; indvertnum ++) {
     Gnum                orgvertnum;               /* Number of current vertex in original halo graph       */
-    Gnum                orgedgenum;               /* Number of current edge in original halo graph         */
-    Gnum                indedgennd;               /* Index of after-last edge position in edge array       */
+    Genum               orgedgenum;               /* Number of current edge in original halo graph         */
+    Genum               indedgennd;               /* Index of after-last edge position in edge array       */
     Gnum                indedhdnum;               /* Index of after-last edge linking to non-halo vertices */
     Gnum                inddegrval;
 
@@ -170,7 +170,7 @@ Hgraph * restrict const       indgrafptr)         /* Pointer to induced halo gra
 
   for ( ; indvertnum < indvertnnd; indvertnum ++) { /* For all halo vertices found during first pass */
     Gnum                orgvertnum;               /* Number of current vertex in original halo graph */
-    Gnum                orgedgenum;               /* Number of current edge in original halo graph   */
+    Genum               orgedgenum;               /* Number of current edge in original halo graph   */
 
     orgvertnum = indvnumtax[indvertnum];
     indverttax[indvertnum] = indedgenum;
@@ -1,4 +1,4 @@
-/* Copyright 2018,2021,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2018,2021,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 04 apr 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 26 apr 2021     **/
-/**                                 to   : 02 oct 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -90,8 +90,8 @@ const HgraphOrderCcParam * restrict const paraptr)
   Gnum                qtalidx;
   int                 o;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vnhdtax = grafptr->vnhdtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vnhdtax = grafptr->vnhdtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
 
   if (memAllocGroup ((void **) (void *)
@@ -117,7 +117,7 @@ const HgraphOrderCcParam * restrict const paraptr)
 
     while (qhedidx < qtalidx) {
       Gnum                vertnum;
-      Gnum                edgenum;
+      Genum               edgenum;
 
       vertnum = queutab[qhedidx ++];              /* Get vertex from queue */
 #ifdef SCOTCH_DEBUG_ORDER2
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2014,2015,2018,2020,2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2014,2015,2018,2020,2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 04 aug 2014     **/
 /**                                 to   : 27 jan 2020     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 17 jan 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Pre-hashing proves itself extremely   **/
 /**                  efficient, since for graphs that      **/
@@ -108,10 +108,10 @@ const HgraphOrderCpParam * const  paraptr)
   Gnum                          coarvnhdsiz;      /* Size of non-halo end vertex array; zero if graph has no halo          */
   Gnum                          coarvsizsiz;      /* Size of coarse vertex sizes array; zero if no fine vertex loads       */
   Gnum * restrict               coarvsiztax;      /* Array of coarse vertex sizes (as number of merged fine vertices)      */
-  Gnum                          coaredgenbr;      /* Number of compressed edges                                            */
-  Gnum                          coaredgenum;      /* Number of current compressed edge                                     */
+  Genum                         coaredgenbr;      /* Number of compressed edges                                            */
+  Genum                         coaredgenum;      /* Number of current compressed edge                                     */
   Gnum                          coarenohnnd;      /* Position in edge array of first edge of first halo vertex             */
-  Gnum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
+  Genum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
   Gnum * restrict               finecoartax;      /* Original to compressed vertex number array                            */
   HgraphOrderCpMate * restrict  finematetab;      /* Array of fine vertices that may be compressed with current vertex     */
   HgraphOrderCpHash * restrict  finehashtab;      /* Neighbor hash table                                                   */
@@ -128,11 +128,11 @@ const HgraphOrderCpParam * const  paraptr)
 
 
   Gnum * restrict const         fineperitab = fineordeptr->peritab;
-  const Gnum * restrict const   fineverttax = finegrafptr->s.verttax;
+  const Genum * restrict const   fineverttax = finegrafptr->s.verttax;
   const Gnum * restrict const   finevelotax = finegrafptr->s.velotax;
-  const Gnum * restrict const   finevendtax = finegrafptr->s.vendtax;
+  const Genum * restrict const   finevendtax = finegrafptr->s.vendtax;
   const Gnum * restrict const   finevnumtax = finegrafptr->s.vnumtax;
-  const Gnum * restrict const   finevnhdtax = finegrafptr->vnhdtax;
+  const Genum * restrict const   finevnhdtax = finegrafptr->vnhdtax;
   const Gnum * restrict const   fineedgetax = finegrafptr->s.edgetax;
 
   for (finehashmsk = 15;                          /* Set neighbor hash table sizes */
@@ -167,7 +167,7 @@ const HgraphOrderCpParam * const  paraptr)
 
   for (finevertnum = finegrafptr->s.baseval, coarvertnbr = finegrafptr->vnohnbr; /* For all non-halo vertices */
        finevertnum < finegrafptr->vnohnnd; finevertnum ++) {
-    Gnum                fineedgenum;              /* Current edge number */
+    Genum               fineedgenum;              /* Current edge number */
     Gnum                finehsumval;              /* Hash sum value      */
     Gnum                finehsumbit;
 
@@ -203,7 +203,7 @@ const HgraphOrderCpParam * const  paraptr)
     Gnum                finedegrval;              /* Degree of current fine vertex     */
     Gnum                finehsumval;              /* Current hash sum value            */
     Gnum                finematenbr;              /* Number of mates of current vertex */
-    Gnum                fineedgenum;              /* Current edge number               */
+    Genum               fineedgenum;              /* Current edge number               */
 
     finedegrval = finevendtax[finevertnum] - fineverttax[finevertnum];
     finehsumval = finehsumtax[finevertnum];
@@ -235,7 +235,7 @@ const HgraphOrderCpParam * const  paraptr)
     finecoartax[finevertnum] = coarvertnbr ++;    /* Assume no mate found */
 
     if (finematenbr > 0) {                        /* If potential mates exist */
-      Gnum                fineedgenum;            /* Current edge number      */
+      Genum               fineedgenum;            /* Current edge number      */
       Gnum                finehashnum;
 
       for (fineedgenum = fineverttax[finevertnum]; /* For all edges, including halo edges */
@@ -256,8 +256,8 @@ const HgraphOrderCpParam * const  paraptr)
 
       finematenbr --;                             /* Point to first potential mate */
       do {                                        /* For all potential mates       */
-        Gnum                fineedgenum;          /* Current edge number           */
-        Gnum                fineedgennd;
+        Genum               fineedgenum;          /* Current edge number           */
+        Genum               fineedgennd;
 
         for (fineedgenum = fineverttax[finematetab[finematenbr].finevertend], /* For all edges, including halo edges */
              fineedgennd = finevendtax[finematetab[finematenbr].finevertend];
@@ -307,8 +307,8 @@ loop_failed: ;
   coarvnhdsiz = (finegrafptr->s.vertnbr == finegrafptr->vnohnbr) ? 0 : coargrafdat.vnohnbr; /* If no halo, no need for vnhdtax; will use vendtax */
   coarvsizsiz = (finevelotax == NULL) ? 0 : coarvertnbr; /* If no fine vertex loads, use coarse velotax as coarvsiztax                           */
   if ((dataptr = memAllocGroup ((void **) (void *)
-                                &coargrafdat.s.verttax, (size_t) ((coarvertnbr + 1) * sizeof (Gnum)),
-                                &coargrafdat.vnhdtax,   (size_t) (coarvnhdsiz       * sizeof (Gnum)),
+                                &coargrafdat.s.verttax, (size_t) ((coarvertnbr + 1) * sizeof (Genum)),
+                                &coargrafdat.vnhdtax,   (size_t) (coarvnhdsiz       * sizeof (Genum)),
                                 &coargrafdat.s.velotax, (size_t) (coarvertnbr       * sizeof (Gnum)),
                                 &coarvsiztax,           (size_t) (coarvsizsiz       * sizeof (Gnum)), NULL)) != NULL) {
     dataptr               =
@@ -332,7 +332,7 @@ loop_failed: ;
 
   for (finevertnum = finegrafptr->s.baseval, coarvertnum = coaredgenum = coargrafdat.s.baseval; /* For all non-halo vertices */
        finevertnum < finegrafptr->vnohnnd; finevertnum ++) {
-    Gnum                fineedgenum;              /* Current edge number */
+    Genum               fineedgenum;              /* Current edge number */
 
     if (finecoartax[finevertnum] != coarvertnum)  /* Skip fine vertices until we find one that is part of current coarse vertex */
       continue;
@@ -373,7 +373,7 @@ loop_failed: ;
     coarvertnum ++;
   }
   for (coarenohnnd = coaredgenum; finevertnum < finegrafptr->s.vertnnd; finevertnum ++) { /* For all halo vertices */
-    Gnum                fineedgenum;              /* Current edge number */
+    Genum               fineedgenum;              /* Current edge number */
 
 #ifdef SCOTCH_DEBUG_ORDER2
     if (finecoartax[finevertnum] != coarvertnum) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 5.1  : from : 01 oct 2009     **/
 /**                                 to   : 01 oct 2009     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -94,13 +94,13 @@ const HgraphOrderGpParam * restrict const paraptr)
   Gnum                            diamdist;       /* Maximum diameter value found   */
   Gnum                            vertdist;       /* DIstance of current vertex     */
   Gnum                            vertnum;        /* Number of current vertex       */
-  Gnum                            edgenum;        /* Number of current edge         */
+  Genum                           edgenum;        /* Number of current edge         */
   Gnum                            ordeval;        /* Current ordering value         */
   Gnum                            ordevnd;        /* End value of ordering          */
 
-  const Gnum * restrict const     verttax = grafptr->s.verttax;
+  const Genum * restrict const     verttax = grafptr->s.verttax;
   const Gnum * restrict const     vnumtax = grafptr->s.vnumtax;
-  const Gnum * restrict const     vnhdtax = grafptr->vnhdtax;
+  const Genum * restrict const     vnhdtax = grafptr->vnhdtax;
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
 
   if (memAllocGroup ((void **) (void *)
@@ -196,7 +196,7 @@ const HgraphOrderGpParam * restrict const paraptr)
 
       vertdist = vexxtax[vertnum].vertdist;       /* Get vertex distance       */
       do {                                        /* Loop on vertices in layer */
-        Gnum                  edgennd;            /* End of edge sub-array     */
+        Genum                 edgennd;            /* End of edge sub-array     */
 
         ordeptr->peritab[ordeval ++] = (vnumtax == NULL) ? vertnum : vnumtax[vertnum];
         vexxtax[vertnum].passnum = passnum + 1;   /* Set vertex as ordered */
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 11 nov 2019     **/
 /**                                 to   : 11 feb 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,6 +69,7 @@
 #include "hgraph.h"
 #include "hall_order_hx.h"
 #include "hall_order_hd.h"
+#include "hall_order_hm.h"
 #include "hgraph_order_hd.h"
 #include "hgraph_order_hx.h"
 #include "hgraph_order_si.h"
@@ -140,13 +141,23 @@ const HgraphOrderHdParam * restrict const paraptr)
 
   hgraphOrderHxFill (grafptr, petab, lentab, iwtab, nvartab, elentab, &pfree);
 
-  hallOrderHdR2Halmd (norig, n, 0, iwlen, petab, pfree, /* No elements here */
-                      lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
-                      leaftab, secntab, nexttab, frsttab);
-  if (ncmpa < 0) {
-    errorPrint ("hgraphOrderHd: internal error");
-    memFree    (petab);                           /* Free group leader */
-    return (1);
+  if (paraptr->typeval == HGRAPHORDERHDTYPEPAR) { /* If threaded multiple elimination */
+    if (hallOrderHmHamx (n, grafptr->vnohnbr, norig, HALLORDERHMTYPEDEGR, pfree,
+                         petab, lentab, iwtab, nvartab, grafptr->contptr) != 0) {
+      errorPrint ("hgraphOrderHd: cannot compute ordering");
+      memFree    (petab);                         /* Free group leader */
+      return (1);
+    }
+  }
+  else {
+    hallOrderHdR2Halmd (norig, n, 0, iwlen, petab, pfree, /* No elements here */
+                        lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
+                        leaftab, secntab, nexttab, frsttab);
+    if (ncmpa < 0) {
+      errorPrint ("hgraphOrderHd: internal error");
+      memFree    (petab);                         /* Free group leader */
+      return (1);
+    }
   }
 
   if (grafptr->s.velotax != NULL) {
@@ -51,7 +51,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 11 sep 2024     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,6 +61,11 @@
 
 #define HGRAPHORDERHDCOMPRAT        1.2L          /*+ Compression ratio +*/
 
+/*+ Elimination types. +*/
+
+#define HGRAPHORDERHDTYPESEQ        0             /*+ Sequential single elimination  +*/
+#define HGRAPHORDERHDTYPEPAR        1             /*+ Threaded multiple elimination  +*/
+
 /*
 **  The type and structure definitions.
 */
@@ -71,6 +76,7 @@ typedef struct HgraphOrderHdParam_ {
   INT                       colmin;               /*+ Minimum number of columns +*/
   INT                       colmax;               /*+ Maximum number of columns +*/
   double                    fillrat;              /*+ Fill-in ratio             +*/
+  int                       typeval;              /*+ Elimination type          +*/
 } HgraphOrderHdParam;
 
 /*
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 29 oct 2019     **/
 /**                                 to   : 18 jan 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +66,7 @@
 #include "order.h"
 #include "hgraph.h"
 #include "hall_order_hf.h"
+#include "hall_order_hm.h"
 #include "hall_order_hx.h"
 #include "hgraph_order_hf.h"
 #include "hgraph_order_hx.h"
@@ -142,13 +143,23 @@ const HgraphOrderHfParam * restrict const paraptr)
 
   hgraphOrderHxFill (grafptr, petab, lentab, iwtab, nvtab, elentab, &pfree);
 
-  hallOrderHfR3Hamdf4 (norig, n, 0, nbbuck, iwlen, petab, pfree,
-                       lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
-                       leaftab, secntab, nexttab, frsttab, headtab);
-  if (ncmpa < 0) {
-    errorPrint ("hgraphOrderHf: internal error");
-    memFree    (petab);                           /* Free group leader */
-    return (1);
+  if (paraptr->typeval == HGRAPHORDERHFTYPEPAR) { /* If threaded multiple elimination */
+    if (hallOrderHmHamx (n, grafptr->vnohnbr, norig, HALLORDERHMTYPEFILL, pfree,
+                         petab, lentab, iwtab, nvtab, grafptr->contptr) != 0) {
+      errorPrint ("hgraphOrderHf: cannot compute ordering");
+      memFree    (petab);                         /* Free group leader */
+      return (1);
+    }
+  }
+  else {
+    hallOrderHfR3Hamdf4 (norig, n, 0, nbbuck, iwlen, petab, pfree,
+                         lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
+                         leaftab, secntab, nexttab, frsttab, headtab);
+    if (ncmpa < 0) {
+      errorPrint ("hgraphOrderHf: internal error");
+      memFree    (petab);                         /* Free group leader */
+      return (1);
+    }
   }
 
   if (grafptr->s.velotax != NULL) {
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 11 sep 2024     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +59,11 @@
 
 #define HGRAPHORDERHFCOMPRAT        1.2L          /*+ Compression ratio +*/
 
+/*+ Elimination types. +*/
+
+#define HGRAPHORDERHFTYPESEQ        0             /*+ Sequential single elimination  +*/
+#define HGRAPHORDERHFTYPEPAR        1             /*+ Threaded multiple elimination  +*/
+
 /*
 **  The type and structure definitions.
 */
@@ -69,6 +74,7 @@ typedef struct HgraphOrderHfParam_ {
   INT                       colmin;               /*+ Minimum number of columns +*/
   INT                       colmax;               /*+ Maximum number of columns +*/
   double                    fillrat;              /*+ Fill-in ratio             +*/
+  int                       typeval;              /*+ Elimination type          +*/
 } HgraphOrderHfParam;
 
 /*
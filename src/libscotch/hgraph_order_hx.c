@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.1  : from : 29 oct 2019     **/
 /**                                 to   : 26 jan 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -85,15 +85,15 @@ Gnum * restrict const         pfreptr)
   Gnum                vertadj;                    /* Index adjustment for vertices */
   Gnum                vertnum;
   Gnum                vertnew;
-  Gnum                edgenew;
+  Genum               edgenew;
 
   Gnum * restrict const       petax   = petab   - 1; /* Base HAMF arrays at base 1 */
   Gnum * restrict const       iwtax   = iwtab   - 1;
   Gnum * restrict const       lentax  = lentab  - 1;
   Gnum * restrict const       nvtax   = nvtab   - 1;
   Gnum * restrict const       elentax = elentab - 1;
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
 
@@ -101,7 +101,7 @@ Gnum * restrict const         pfreptr)
   for (vertnum = grafptr->s.baseval, vertnew = edgenew = 1; /* Process non-halo vertices */
        vertnum < grafptr->vnohnnd; vertnum ++, vertnew ++) {
     Gnum                      degrval;
-    Gnum                      edgenum;
+    Genum                     edgenum;
 
     degrval = vendtax[vertnum] - verttax[vertnum];
     petax[vertnew]   = edgenew;
@@ -114,7 +114,7 @@ Gnum * restrict const         pfreptr)
   }
   for ( ; vertnum < grafptr->s.vertnnd; vertnum ++, vertnew ++) { /* Process halo vertices */
     Gnum                      degrval;
-    Gnum                      edgenum;
+    Genum                     edgenum;
 
     degrval = verttax[vertnum] - vendtax[vertnum]; /* Negative degree */
     petax[vertnew]   = edgenew;
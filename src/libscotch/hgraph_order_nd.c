@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2012,2014,2016,2018,2019,2021,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2012,2014,2016,2018,2019,2021,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 03 oct 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,10 +69,206 @@
 #include "graph.h"
 #include "order.h"
 #include "hgraph.h"
-#include "hgraph_order_nd.h"
-#include "hgraph_order_st.h"
 #include "vgraph.h"
 #include "vgraph_separate_st.h"
+#include "hgraph_order_nd.h"
+#include "hgraph_order_st.h"
+
+/****************************/
+/*                          */
+/* Subtree work estimation. */
+/*                          */
+/****************************/
+
+/* This routine estimates the factorization
+** work of the subtree of a part of given load
+** and halo load, in the operation count model
+** of symbolCost, vertex loads standing for the
+** number of columns of compressed vertices.
+** The part is assumed to be recursively
+** bisected by separators of load
+** vertload^sepexp; each separator yields a dense
+** column block whose height comprises the halo
+** of its subgraph, i.e. the separator itself
+** plus half of the halo of its parent.
+** It returns:
+** - the estimated operation count : in all cases.
+*/
+
+static
+double
+hgraphOrderNdCost (
+const Gnum                  vertload,             /*+ Load of part            +*/
+const Gnum                  haloload,             /*+ Load of halo vertices   +*/
+const double                sepexp)               /*+ Separator load exponent +*/
+{
+  double              costval;
+  double              subtnbr;
+  double              vertval;
+  double              haloval;
+
+  for (costval = 0.0, subtnbr = 1.0, vertval = (double) vertload, haloval = (double) haloload;
+       vertval >= 1.0; subtnbr *= 2.0) {
+    double              sepaval;
+
+    sepaval  = MIN (pow (vertval, sepexp), vertval);
+    costval += subtnbr * sepaval * (sepaval * sepaval / 3.0 + sepaval * haloval + haloval * haloval);
+    vertval  = (vertval - sepaval) * 0.5;
+    haloval  = sepaval + haloval * 0.5;
+  }
+
+  return (costval);
+}
+
+/* This routine computes the fraction of
+** the load to put in the first part, such
+** that the estimated work of both subtrees
+** is in the same ratio as their numbers of
+** cores, which minimizes the critical path.
+** It returns:
+** - the fraction, in [0.1;0.9] : in all cases.
+*/
+
+static
+double
+hgraphOrderNdFrac (
+const Gnum                  vertload,             /*+ Load to share            +*/
+const Gnum * const          halotab,              /*+ Halo loads of parts      +*/
+const double                sepexp,               /*+ Separator load exponent  +*/
+const Gnum * const          proctab)              /*+ Number of cores of parts +*/
+{
+  double              fracmin;
+  double              fracmax;
+  int                 passnum;
+
+  for (fracmin = 0.1, fracmax = 0.9, passnum = 0; passnum < 20; passnum ++) { /* Dichotomy on work ratio */
+    double              fracval;
+
+    fracval = (fracmin + fracmax) * 0.5;
+    if ((hgraphOrderNdCost ((Gnum) (fracval * (double) vertload), halotab[0], sepexp) * (double) proctab[1]) <
+        (hgraphOrderNdCost ((Gnum) ((1.0 - fracval) * (double) vertload), halotab[1], sepexp) * (double) proctab[0]))
+      fracmin = fracval;
+    else
+      fracmax = fracval;
+  }
+
+  return ((fracmin + fracmax) * 0.5);
+}
+
+/* This routine sets the domain weights of
+** the separation graph such that the first
+** part receives the given fraction of the
+** load, as far as weights allow it without
+** overflowing load differences.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hgraphOrderNdWght (
+Vgraph * restrict const     grafptr,
+const double                fracval)
+{
+  Gnum                wgtsum;
+
+  for (wgtsum = HGRAPHORDERNDWGTSUM; (wgtsum > 2) && (grafptr->s.velosum > (GNUMMAX / wgtsum)); wgtsum /= 2) ;
+  grafptr->dwgttab[0] = (Gnum) (fracval * (double) wgtsum + 0.5);
+  grafptr->dwgttab[0] = MAX (grafptr->dwgttab[0], 1);
+  grafptr->dwgttab[0] = MIN (grafptr->dwgttab[0], wgtsum - 1);
+  grafptr->dwgttab[1] = wgtsum - grafptr->dwgttab[0];
+}
+
+/* This routine estimates the time of the
+** factorization of the subtree rooted at the
+** given separator, on the given number of
+** cores: the column block of the separator
+** is processed by all cores, then cores are
+** dealt to both parts so as to minimize the
+** larger of their times. The halo of each
+** part is the separator plus the halo vertices
+** of the graph which are adjacent to the part.
+** All sizes are measured as vertex loads.
+** It returns:
+** - 0   : if the estimate could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+hgraphOrderNdEval (
+const Hgraph * restrict const grafptr,            /*+ Halo graph                         +*/
+const Vgraph * restrict const vspgrafptr,         /*+ Separation of its non-halo part    +*/
+const Gnum                    procnbr,            /*+ Number of cores                    +*/
+const double                  sepexp,             /*+ Separator load exponent for parts  +*/
+Gnum * const                  proctab,            /*+ Number of cores of parts           +*/
+Gnum * const                  halotab,            /*+ Halo loads of parts                +*/
+double * const                timeptr)            /*+ Pointer to estimated time          +*/
+{
+  const Gnum * restrict const       velotax = grafptr->s.velotax;
+  const Genum * restrict const      vendtax = grafptr->s.vendtax;
+  const Genum * restrict const      vnhdtax = grafptr->vnhdtax;
+  const Gnum * restrict const       edgetax = grafptr->s.edgetax;
+  const GraphPart * restrict const  parttax = vspgrafptr->parttax;
+  const Gnum                        halonbr = grafptr->s.vertnbr - grafptr->vnohnbr;
+  const double                      haloval = (double) (grafptr->s.velosum - grafptr->vnlosum);
+  double                            sepaval;
+  double                            costtab[2];
+  double                            costbst;
+  Gnum                              procnum;
+
+  halotab[0] =
+  halotab[1] = vspgrafptr->compload[2];
+  if (halonbr > 0) {                              /* If parts may be adjacent to distinct halo vertices */
+    byte * restrict     flagtax;
+    Gnum                vertnum;
+
+    if ((flagtax = (byte *) memAlloc (halonbr * sizeof (byte))) == NULL) {
+      errorPrint ("hgraphOrderNdEval: out of memory");
+      return (1);
+    }
+    memSet (flagtax, 0, halonbr * sizeof (byte));
+    flagtax -= grafptr->vnohnnd;
+
+    for (vertnum = grafptr->s.baseval; vertnum < grafptr->vnohnnd; vertnum ++) {
+      GraphPart           partval;
+      Genum               edgenum;
+
+      partval = parttax[vertnum];
+      if (partval > 1)                            /* Separator vertices are adjacent to both parts */
+        continue;
+      for (edgenum = vnhdtax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) { /* For all halo neighbors */
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if ((flagtax[vertend] & (1 << partval)) == 0) {
+          flagtax[vertend] |= (1 << partval);
+          halotab[partval] += (velotax != NULL) ? velotax[vertend] : 1;
+        }
+      }
+    }
+
+    memFree (flagtax + grafptr->vnohnnd);
+  }
+
+  costtab[0] = hgraphOrderNdCost (vspgrafptr->compload[0], halotab[0], sepexp);
+  costtab[1] = hgraphOrderNdCost (vspgrafptr->compload[1], halotab[1], sepexp);
+  for (procnum = 1, costbst = -1.0; procnum < procnbr; procnum ++) { /* Deal cores so as to minimize critical path */
+    double              costval;
+
+    costval = MAX (costtab[0] / (double) procnum, costtab[1] / (double) (procnbr - procnum));
+    if ((costbst < 0.0) || (costval < costbst)) {
+      costbst    = costval;
+      proctab[0] = procnum;
+      proctab[1] = procnbr - procnum;
+    }
+  }
+
+  sepaval  = (double) vspgrafptr->compload[2];
+  *timeptr = costbst + sepaval * (sepaval * sepaval / 3.0 + sepaval * haloval + haloval * haloval) / (double) procnbr;
+
+  return (0);
+}
 
 /***************************/
 /*                         */
@@ -101,7 +297,8 @@ const HgraphOrderNdSplit * const  spltptr)
     o = 1;
   }
   if (o == 0) {
-    o = hgraphOrderNd (&indgrafdat, spltptr->ordeptr, spltptr->splttab[spltnum].ordenum, spltptr->splttab[spltnum].cblkptr, spltptr->paraptr);
+    o = hgraphOrderNd3 (&indgrafdat, spltptr->ordeptr, spltptr->splttab[spltnum].ordenum, spltptr->splttab[spltnum].cblkptr, spltptr->paraptr,
+                        spltptr->splttab[spltnum].procnbr, spltptr->splttab[spltnum].sepexp);
 
     hgraphExit (&indgrafdat);
   }
@@ -135,20 +332,60 @@ Order * restrict const                    ordeptr,
 const Gnum                                ordenum,
 OrderCblk * restrict const                cblkptr,
 const HgraphOrderNdParam * restrict const paraptr)
+{
+  Gnum                procnbr;
+
+  procnbr = 0;                                    /* Assume size mode */
+  if (paraptr->typeval == HGRAPHORDERNDTYPETREE)
+    procnbr = (paraptr->procnbr > 0) ? (Gnum) paraptr->procnbr : (Gnum) contextThreadNbr (grafptr->contptr);
+
+  return (hgraphOrderNd3 (grafptr, ordeptr, ordenum, cblkptr, paraptr, procnbr, HGRAPHORDERNDSEPEXP));
+}
+
+/* This routine performs the ordering of a
+** subtree. In tree mode, while more than one
+** core is available for the subtree, separator
+** balance is steered such that the estimated
+** work of each part matches its share of the
+** cores. Once the halo of each part is known,
+** the separation is computed again if the work
+** of parts departs from their share, and kept
+** if its estimated time is smaller. Cores are
+** then dealt to the parts according to their
+** estimated work.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+hgraphOrderNd3 (
+Hgraph * restrict const                   grafptr,
+Order * restrict const                    ordeptr,
+const Gnum                                ordenum,
+OrderCblk * restrict const                cblkptr,
+const HgraphOrderNdParam * restrict const paraptr,
+const Gnum                                procnbr, /*+ Number of target cores, 0 if size mode +*/
+const double                              sepexp) /*+ Estimated separator size exponent      +*/
 {
   Gnum *              vspvnumptr[3];              /* Pointers to vertex lists to fill   */
   VertList            vsplisttab[3];              /* Array of separated part lists      */
   Vgraph              vspgrafdat;                 /* Vertex separation graph data       */
   Gnum                vspvertnum;                 /* Current vertex in separation graph */
+  Gnum                proctab[2];                 /* Number of target cores of both parts */
+  Gnum                halotab[2];                 /* Halo loads of both parts             */
+  Gnum                haloload;                   /* Load of halo vertices                */
+  double              sepexpsub;                  /* Separator exponent for both parts    */
   int                 o;
 
   hgraphUnhalo (grafptr, &vspgrafdat.s);          /* Keep only non-halo vertices for separation */
   if ((vspgrafdat.frontab = (Gnum *) memAlloc (vspgrafdat.s.vertnbr * sizeof (Gnum))) == NULL) {
-    errorPrint ("hgraphOrderNd: out of memory (1)");
+    errorPrint ("hgraphOrderNd3: out of memory (1)");
     return (1);
   }
   if ((vspgrafdat.parttax = (GraphPart *) memAlloc (vspgrafdat.s.vertnbr * sizeof (GraphPart))) == NULL) {
-    errorPrint ("hgraphOrderNd: out of memory (2)");
+    errorPrint ("hgraphOrderNd3: out of memory (2)");
     memFree    (vspgrafdat.frontab);
     return (1);
   }
@@ -157,10 +394,20 @@ const HgraphOrderNdParam * restrict const paraptr)
   vspgrafdat.s.flagval  |= VGRAPHFREEFRON | VGRAPHFREEPART;
   vspgrafdat.dwgttab[0]  =                        /* Parts should have about the same weights */
   vspgrafdat.dwgttab[1]  = 1;
+  haloload = grafptr->s.velosum - grafptr->vnlosum;
+  if (procnbr > 1) {                              /* If cores have to be shared between parts */
+    proctab[0] = (procnbr + 1) / 2;
+    proctab[1] = procnbr / 2;
+    if (proctab[0] != proctab[1]) {               /* If odd number of cores, parts should have unequal work */
+      halotab[0] =                                /* Assume future separator and even share of halo          */
+      halotab[1] = (Gnum) pow ((double) vspgrafdat.s.velosum, sepexp) + haloload / 2;
+      hgraphOrderNdWght (&vspgrafdat, hgraphOrderNdFrac (vspgrafdat.s.velosum, halotab, sepexp, proctab));
+    }
+  }
   vspgrafdat.compload[0] = vspgrafdat.s.velosum;
   vspgrafdat.compload[1] = 0;
   vspgrafdat.compload[2] = 0;
-  vspgrafdat.comploaddlt = vspgrafdat.s.velosum;
+  vspgrafdat.comploaddlt = vspgrafdat.s.velosum * vspgrafdat.dwgttab[1];
   vspgrafdat.compsize[0] = vspgrafdat.s.vertnbr;
   vspgrafdat.compsize[1] = 0;
   vspgrafdat.fronnbr     = 0;
@@ -179,6 +426,57 @@ const HgraphOrderNdParam * restrict const paraptr)
     return (hgraphOrderSt (grafptr, ordeptr, ordenum, cblkptr, paraptr->ordstratlea)); /* Order this leaf */
   }
 
+  sepexpsub = sepexp;
+  if ((vspgrafdat.compload[2] > 1) && (vspgrafdat.s.velosum > 2)) { /* Measure exponent of separator load */
+    sepexpsub = log ((double) vspgrafdat.compload[2]) / log ((double) vspgrafdat.s.velosum);
+    sepexpsub = MAX (sepexpsub, 0.34);            /* Keep model within bounds of mesh-like graphs */
+    sepexpsub = MIN (sepexpsub, 0.90);
+  }
+  proctab[0] =
+  proctab[1] = MIN (procnbr, 1);                  /* Parts keep mode of their parent */
+  if (procnbr > 1) {                              /* If cores have to be dealt to parts */
+    double              fracval;
+    double              timeval;
+
+    if (hgraphOrderNdEval (grafptr, &vspgrafdat, procnbr, sepexpsub, proctab, halotab, &timeval) != 0) {
+      vgraphExit (&vspgrafdat);
+      return (1);
+    }
+    fracval = hgraphOrderNdFrac (vspgrafdat.s.velosum - vspgrafdat.compload[2], halotab, sepexpsub, proctab);
+    if (fabs (fracval - (double) vspgrafdat.compload[0] / (double) (vspgrafdat.s.velosum - vspgrafdat.compload[2])) > HGRAPHORDERNDFRACTOL) { /* If work of parts does not match cores */
+      VgraphStore         savedat;
+      Gnum                prsvtab[2];
+      Gnum                hlsvtab[2];
+      double              tmsvval;
+
+      if (vgraphStoreInit (&vspgrafdat, &savedat) != 0) {
+        errorPrint ("hgraphOrderNd3: out of memory (3)");
+        vgraphExit (&vspgrafdat);
+        return (1);
+      }
+      vgraphStoreSave (&vspgrafdat, &savedat);    /* Save first separation */
+      prsvtab[0] = proctab[0];
+      prsvtab[1] = proctab[1];
+      hlsvtab[0] = halotab[0];
+      hlsvtab[1] = halotab[1];
+      tmsvval    = timeval;
+
+      hgraphOrderNdWght (&vspgrafdat, fracval);   /* Steer balance with measured halos */
+      vgraphZero (&vspgrafdat);
+      if ((vgraphSeparateSt (&vspgrafdat, paraptr->sepstrat) != 0) ||
+          (vspgrafdat.compsize[0] == 0) || (vspgrafdat.compsize[1] == 0) ||
+          (hgraphOrderNdEval (grafptr, &vspgrafdat, procnbr, sepexpsub, proctab, halotab, &timeval) != 0) ||
+          (timeval >= tmsvval)) {                 /* If new separation is not better, restore first one */
+        vgraphStoreUpdt (&vspgrafdat, &savedat);
+        proctab[0] = prsvtab[0];
+        proctab[1] = prsvtab[1];
+        halotab[0] = hlsvtab[0];
+        halotab[1] = hlsvtab[1];
+      }
+      vgraphStoreExit (&savedat);
+    }
+  }
+
   vsplisttab[0].vnumnbr = vspgrafdat.compsize[0]; /* Build vertex lists within frontier array */
   vsplisttab[0].vnumtab = vspgrafdat.frontab + vspgrafdat.fronnbr;
   vsplisttab[1].vnumnbr = vspgrafdat.compsize[1];
@@ -192,14 +490,14 @@ const HgraphOrderNdParam * restrict const paraptr)
     *vspvnumptr[vspgrafdat.parttax[vspvertnum]] ++ = vspvertnum;
 #ifdef SCOTCH_DEBUG_HGRAPH2
     if (vspgrafdat.parttax[vspvertnum] != 2) {    /* If vertex does not separate */
-      Gnum                vspedgenum;
+      Genum               vspedgenum;
       GraphPart           vsppartnum;
 
       vsppartnum = 1 - vspgrafdat.parttax[vspvertnum]; /* Get opposite part value */
       for (vspedgenum = vspgrafdat.s.verttax[vspvertnum];
            vspedgenum < vspgrafdat.s.vendtax[vspvertnum]; vspedgenum ++) {
         if (vspgrafdat.parttax[vspgrafdat.s.edgetax[vspedgenum]] == vsppartnum) { /* If an edge crosses the separator */
-          errorPrint ("hgraphOrderNd: internal error (1)");
+          errorPrint ("hgraphOrderNd3: internal error (1)");
           vgraphExit (&vspgrafdat);
           return (1);
         }
@@ -211,7 +509,7 @@ const HgraphOrderNdParam * restrict const paraptr)
   if ((vspvnumptr[0] != vsplisttab[0].vnumtab + vsplisttab[0].vnumnbr) ||
       (vspvnumptr[1] != vsplisttab[1].vnumtab + vsplisttab[1].vnumnbr) ||
       (vspvnumptr[2] != vsplisttab[2].vnumtab + vsplisttab[2].vnumnbr)) {
-    errorPrint ("hgraphOrderNd: internal error (2)");
+    errorPrint ("hgraphOrderNd3: internal error (2)");
     vgraphExit (&vspgrafdat);
     return (1);
   }
@@ -221,7 +519,7 @@ const HgraphOrderNdParam * restrict const paraptr)
   vspgrafdat.parttax = NULL;                      /* Prevent subsequent freeing */
 
   if ((cblkptr->cblktab = (OrderCblk *) memAlloc (3 * sizeof (OrderCblk))) == NULL) {
-    errorPrint ("hgraphOrderNd: out of memory (3)");
+    errorPrint ("hgraphOrderNd3: out of memory (4)");
     vgraphExit (&vspgrafdat);
     return (1);
   }
@@ -253,8 +551,8 @@ const HgraphOrderNdParam * restrict const paraptr)
     cblkptr->cblktab[2].cblknbr = 0;
     cblkptr->cblktab[2].cblktab = NULL;
 
-    if (graphInduceList (&grafptr->s, vsplisttab[2].vnumnbr, vsplisttab[2].vnumtab, &indgrafdat.s) != 0) { /* Perform non-halo induction for separator, as it will get highest numbers */
-      errorPrint ("hgraphOrderNd: cannot build induced subgraph (1)");
+    if (graphInduceList2 (&grafptr->s, vsplisttab[2].vnumnbr, vsplisttab[2].vnumtab, &indgrafdat.s, grafptr->contptr) != 0) { /* Perform non-halo induction for separator, as it will get highest numbers */
+      errorPrint ("hgraphOrderNd3: cannot build induced subgraph (1)");
       vgraphExit (&vspgrafdat);
       return (1);
     }
@@ -291,11 +589,15 @@ const HgraphOrderNdParam * restrict const paraptr)
     spltdat.splttab[0].vhalmax = vsplisttab[2].vnumnbr + grafptr->s.vertnbr - grafptr->vnohnbr;
     spltdat.splttab[0].ordenum = ordenum;
     spltdat.splttab[0].cblkptr = cblkptr->cblktab;
+    spltdat.splttab[0].procnbr = proctab[0];
+    spltdat.splttab[0].sepexp  = sepexpsub;
     spltdat.splttab[1].vnumnbr = vsplisttab[1].vnumnbr;
     spltdat.splttab[1].vnumtab = vsplisttab[1].vnumtab;
     spltdat.splttab[1].vhalmax = vsplisttab[2].vnumnbr + grafptr->s.vertnbr - grafptr->vnohnbr;
     spltdat.splttab[1].ordenum = ordenum + vsplisttab[0].vnumnbr;
     spltdat.splttab[1].cblkptr = cblkptr->cblktab + 1;
+    spltdat.splttab[1].procnbr = proctab[1];
+    spltdat.splttab[1].sepexp  = sepexpsub;
     spltdat.grafptr = grafptr;
     spltdat.ordeptr = ordeptr;
     spltdat.paraptr = paraptr;
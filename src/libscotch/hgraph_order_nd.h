@@ -50,10 +50,36 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 26 apr 2021     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Separation types. +*/
+
+#define HGRAPHORDERNDTYPESIZE       0             /*+ Balance part sizes                     +*/
+#define HGRAPHORDERNDTYPETREE       1             /*+ Balance subtree work over target cores +*/
+
+/*+ Separator size exponent assumed
+    before any separator is computed,
+    that of 3D meshes.                +*/
+
+#define HGRAPHORDERNDSEPEXP         0.667
+
+/*+ Sum of domain weights used to
+    express unequal part targets. +*/
+
+#define HGRAPHORDERNDWGTSUM         64
+
+/*+ Tolerance on the fraction of vertices
+    of the first part, beyond which a new
+    separation is attempted.              +*/
+
+#define HGRAPHORDERNDFRACTOL        0.05
+
 /*
 **  The type and structure definitions.
 */
@@ -61,9 +87,11 @@
 /*+ This structure holds the method parameters. +*/
 
 typedef struct HgraphOrderNdParam_ {
-  Strat *                   sepstrat;             /*+ Separation strategy         +*/
-  Strat *                   ordstratlea;          /*+ Leaf ordering strategy      +*/
-  Strat *                   ordstratsep;          /*+ Separator ordering strategy +*/
+  Strat *                   sepstrat;             /*+ Separation strategy                        +*/
+  Strat *                   ordstratlea;          /*+ Leaf ordering strategy                     +*/
+  Strat *                   ordstratsep;          /*+ Separator ordering strategy                +*/
+  int                       typeval;              /*+ Separation type                            +*/
+  INT                       procnbr;              /*+ Number of target cores; 0: context threads +*/
 } HgraphOrderNdParam;
 
 /*+ This structure holds the splitting parameters. +*/
@@ -74,6 +102,8 @@ typedef struct HgraphOrderNdSplit2_ {
   Gnum                      vhalmax;              /*+ Upper bound on induced halo vertices     +*/
   Gnum                      ordenum;              /*+ Local start index of inverse permutation +*/
   OrderCblk *               cblkptr;              /*+ Column block to process                  +*/
+  Gnum                      procnbr;              /*+ Number of target cores, 0 if size mode   +*/
+  double                    sepexp;               /*+ Estimated separator size exponent        +*/
 } HgraphOrderNdSplit2;
 
 typedef struct HgraphOrderNdSplit_ {
@@ -89,7 +119,12 @@ typedef struct HgraphOrderNdSplit_ {
 */
 
 #ifdef SCOTCH_HGRAPH_ORDER_ND
+static double               hgraphOrderNdCost   (const Gnum, const Gnum, const double);
+static double               hgraphOrderNdFrac   (const Gnum, const Gnum * const, const double, const Gnum * const);
+static void                 hgraphOrderNdWght   (Vgraph * restrict const, const double);
+static int                  hgraphOrderNdEval   (const Hgraph * restrict const, const Vgraph * restrict const, const Gnum, const double, Gnum * const, Gnum * const, double * const);
 static void                 hgraphOrderNd2      (Context * restrict const, const int, const HgraphOrderNdSplit * const);
+static int                  hgraphOrderNd3      (Hgraph * const, Order * const, const Gnum, OrderCblk * const, const HgraphOrderNdParam * const, const Gnum, const double);
 #endif /* SCOTCH_HGRAPH_ORDER_ND */
 
 int                         hgraphOrderNd       (Hgraph * const, Order * const, const Gnum, OrderCblk * const, const HgraphOrderNdParam * const);
@@ -0,0 +1,160 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hgraph_order_rl.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module orders halo graph vertices  **/
+/**                by relabeling them so as to improve     **/
+/**                memory locality, and applying the       **/
+/**                ordering strategy to the relabeled      **/
+/**                graph.                                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "order.h"
+#include "hgraph.h"
+#include "hgraph_order_rl.h"
+#include "hgraph_order_st.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the ordering.
+** Since the vertex number array of the
+** relabeled graph holds the numbers of
+** its vertices in the original graph, the
+** ordering computed on the relabeled graph
+** needs no further translation.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hgraphOrderRl (
+Hgraph * restrict const                   orggrafptr,
+Order * restrict const                    ordeptr,
+const Gnum                                ordenum, /*+ Zero-based ordering number +*/
+OrderCblk * restrict const                cblkptr, /*+ Single column-block        +*/
+const HgraphOrderRlParam * restrict const paraptr)
+{
+  Hgraph              prmgrafdat;                 /* Relabeled graph           */
+  Gnum * restrict     permtax;                    /* Direct permutation array  */
+  Gnum * restrict     peritax;                    /* Inverse permutation array */
+  Genum * restrict    prmvnhdtax;
+  Gnum                prmvertnum;
+  int                 o;
+
+  const Genum * restrict const orgverttax = orggrafptr->s.verttax;
+  const Genum * restrict const orgvnhdtax = orggrafptr->vnhdtax;
+  const Gnum                   baseval    = orggrafptr->s.baseval;
+
+  if (orggrafptr->vnohnbr < 2)                    /* If nothing to relabel */
+    return (hgraphOrderSt (orggrafptr, ordeptr, ordenum, cblkptr, paraptr->straptr));
+
+  if (memAllocGroup ((void **) (void *)
+                     &permtax, (size_t) (orggrafptr->s.vertnbr * sizeof (Gnum)),
+                     &peritax, (size_t) (orggrafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hgraphOrderRl: out of memory (1)");
+    return (1);
+  }
+  permtax -= baseval;
+  peritax -= baseval;
+
+  hgraphInit (&prmgrafdat);
+  if ((graphPermCompute (&orggrafptr->s, orggrafptr->vnohnnd, paraptr->typeval, permtax, peritax) != 0) || /* Halo vertices keep their numbers */
+      (graphPerm (&orggrafptr->s, permtax, peritax, &prmgrafdat.s) != 0)) {
+    errorPrint ("hgraphOrderRl: cannot build relabeled graph");
+    memFree    (permtax + baseval);
+    return (1);
+  }
+
+  if (orgvnhdtax == orggrafptr->s.vendtax)        /* If graph has no halo */
+    prmgrafdat.vnhdtax = prmgrafdat.s.vendtax;
+  else {
+    if ((prmvnhdtax = memAlloc (orggrafptr->vnohnbr * sizeof (Genum))) == NULL) {
+      errorPrint ("hgraphOrderRl: out of memory (2)");
+      hgraphExit (&prmgrafdat);
+      memFree    (permtax + baseval);
+      return (1);
+    }
+    prmvnhdtax -= baseval;
+    for (prmvertnum = baseval; prmvertnum < orggrafptr->vnohnnd; prmvertnum ++) { /* Adjacency lists keep their order */
+      Gnum                orgvertnum;
+
+      orgvertnum = peritax[prmvertnum];
+      prmvnhdtax[prmvertnum] = prmgrafdat.s.verttax[prmvertnum] + (orgvnhdtax[orgvertnum] - orgverttax[orgvertnum]);
+    }
+    prmgrafdat.vnhdtax     = prmvnhdtax;
+    prmgrafdat.s.flagval  |= HGRAPHFREEVNHD;
+  }
+  prmgrafdat.vnohnbr = orggrafptr->vnohnbr;
+  prmgrafdat.vnohnnd = orggrafptr->vnohnnd;
+  prmgrafdat.vnlosum = orggrafptr->vnlosum;
+  prmgrafdat.enohnbr = orggrafptr->enohnbr;
+  prmgrafdat.enlosum = orggrafptr->enlosum;
+  prmgrafdat.levlnum = orggrafptr->levlnum;
+  prmgrafdat.contptr = orggrafptr->contptr;
+
+  memFree (permtax + baseval);                    /* Free group leader */
+
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (hgraphCheck (&prmgrafdat) != 0) {
+    errorPrint ("hgraphOrderRl: inconsistent graph data");
+    hgraphExit (&prmgrafdat);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+  o = hgraphOrderSt (&prmgrafdat, ordeptr, ordenum, cblkptr, paraptr->straptr);
+
+  hgraphExit (&prmgrafdat);
+
+  return (o);
+}
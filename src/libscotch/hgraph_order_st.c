@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -74,6 +74,7 @@
 #include "hgraph_order_hf.h"
 #include "hgraph_order_kp.h"
 #include "hgraph_order_nd.h"
+#include "hgraph_order_rl.h"
 #include "hgraph_order_si.h"
 #include "hgraph_order_st.h"
 #include "kgraph.h"
@@ -110,12 +111,12 @@ static union {
 static union {
   HgraphOrderHdParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaulthd = { { 1, 10000, 0.08L } };
+} hgraphorderstdefaulthd = { { 1, 10000, 0.08L, HGRAPHORDERHDTYPESEQ } };
 
 static union {
   HgraphOrderHfParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaulthf = { { 1, 1000000, 0.08L } };
+} hgraphorderstdefaulthf = { { 1, 1000000, 0.08L, HGRAPHORDERHFTYPESEQ } };
 
 static union {
   HgraphOrderKpParam        param;
@@ -125,7 +126,12 @@ static union {
 static union {                                    /* Default parameters for nested dissection method */
   HgraphOrderNdParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaultnd = { { &stratdummy, &stratdummy, &stratdummy } };
+} hgraphorderstdefaultnd = { { &stratdummy, &stratdummy, &stratdummy, HGRAPHORDERNDTYPESIZE, 0 } };
+
+static union {
+  HgraphOrderRlParam        param;
+  StratNodeMethodData       padding;
+} hgraphorderstdefaultrl = { { GRAPHPERMRCM, &stratdummy } };
 
 static StratMethodTab       hgraphorderstmethtab[] = { /* Graph ordering methods array */
                               { HGRAPHORDERSTMETHBL, "b",  (StratMethodFunc) hgraphOrderBl, &hgraphorderstdefaultbl },
@@ -136,6 +142,7 @@ static StratMethodTab       hgraphorderstmethtab[] = { /* Graph ordering methods
                               { HGRAPHORDERSTMETHHF, "f",  (StratMethodFunc) hgraphOrderHf, &hgraphorderstdefaulthf },
                               { HGRAPHORDERSTMETHKP, "k",  (StratMethodFunc) hgraphOrderKp, &hgraphorderstdefaultkp },
                               { HGRAPHORDERSTMETHND, "n",  (StratMethodFunc) hgraphOrderNd, &hgraphorderstdefaultnd },
+                              { HGRAPHORDERSTMETHRL, "l",  (StratMethodFunc) hgraphOrderRl, &hgraphorderstdefaultrl },
                               { HGRAPHORDERSTMETHSI, "s",  (StratMethodFunc) hgraphOrderSi, NULL },
                               { -1,                  NULL, (StratMethodFunc) NULL,          NULL } };
 
@@ -180,6 +187,10 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaulthd.param,
                                 (byte *) &hgraphorderstdefaulthd.param.fillrat,
                                 NULL },
+                              { HGRAPHORDERSTMETHHD,  STRATPARAMCASE,   "type",
+                                (byte *) &hgraphorderstdefaulthd.param,
+                                (byte *) &hgraphorderstdefaulthd.param.typeval,
+                                (void *) "sp" },
                               { HGRAPHORDERSTMETHHF,  STRATPARAMINT,    "cmin",
                                 (byte *) &hgraphorderstdefaulthf.param,
                                 (byte *) &hgraphorderstdefaulthf.param.colmin,
@@ -192,6 +203,10 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaulthf.param,
                                 (byte *) &hgraphorderstdefaulthf.param.fillrat,
                                 NULL },
+                              { HGRAPHORDERSTMETHHF,  STRATPARAMCASE,   "type",
+                                (byte *) &hgraphorderstdefaulthf.param,
+                                (byte *) &hgraphorderstdefaulthf.param.typeval,
+                                (void *) "sp" },
                               { HGRAPHORDERSTMETHKP,  STRATPARAMINT,    "siz",
                                 (byte *) &hgraphorderstdefaultkp.param,
                                 (byte *) &hgraphorderstdefaultkp.param.partsiz,
@@ -212,6 +227,22 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaultnd.param,
                                 (byte *) &hgraphorderstdefaultnd.param.ordstratsep,
                                 (void *) &hgraphorderststratab },
+                              { HGRAPHORDERSTMETHND,  STRATPARAMINT,    "proc",
+                                (byte *) &hgraphorderstdefaultnd.param,
+                                (byte *) &hgraphorderstdefaultnd.param.procnbr,
+                                NULL },
+                              { HGRAPHORDERSTMETHND,  STRATPARAMCASE,   "type",
+                                (byte *) &hgraphorderstdefaultnd.param,
+                                (byte *) &hgraphorderstdefaultnd.param.typeval,
+                                (void *) "st" },
+                              { HGRAPHORDERSTMETHRL,  STRATPARAMSTRAT,  "strat",
+                                (byte *) &hgraphorderstdefaultrl.param,
+                                (byte *) &hgraphorderstdefaultrl.param.straptr,
+                                (void *) &hgraphorderststratab },
+                              { HGRAPHORDERSTMETHRL,  STRATPARAMCASE,   "type",
+                                (byte *) &hgraphorderstdefaultrl.param,
+                                (byte *) &hgraphorderstdefaultrl.param.typeval,
+                                (void *) "br" },
                               { HGRAPHORDERSTMETHNBR, STRATPARAMINT,    NULL,
                                 NULL, NULL, NULL } };
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2012,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2012,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 11 sep 2024     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +67,7 @@ typedef enum HgraphOrderStMethodType_ {
   HGRAPHORDERSTMETHHF,                            /*+ Block Halo Approximate Minimum Fill   +*/
   HGRAPHORDERSTMETHKP,                            /*+ K-way block partitioning              +*/
   HGRAPHORDERSTMETHND,                            /*+ Nested Dissection                     +*/
+  HGRAPHORDERSTMETHRL,                            /*+ Locality relabeling                   +*/
   HGRAPHORDERSTMETHSI,                            /*+ Simple                                +*/
   HGRAPHORDERSTMETHNBR                            /*+ Number of methods                     +*/
 } HgraphOrderStMethodType;
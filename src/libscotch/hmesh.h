@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,7 +83,7 @@
 
 typedef struct Hmesh_ {
   Mesh                      m;                    /*+ Source mesh                                                              +*/
-  Gnum * restrict           vehdtax;              /*+ End vertex array for elements [based] (non-halo nodes look at m.vendtax) +*/
+  Genum * restrict          vehdtax;              /*+ End vertex array for elements [based] (non-halo nodes look at m.vendtax) +*/
   Gnum                      veihnbr;              /*+ Number of halo isolated element vertices, which have halo nodes only     +*/
   Gnum                      vnohnbr;              /*+ Number of non-halo node vertices                                         +*/
   Gnum                      vnohnnd;              /*+ Based number of first halo node vertex in mesh graph (m.vnodnnd if none) +*/
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 28 apr 2019     **/
 /**                                 to   : 28 apr 2019     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # From a given halo mesh is created a   **/
 /**                  halo graph, such that all vertices of **/
@@ -100,10 +100,10 @@ Hgraph * restrict const       grafptr)            /*+ Graph to build +*/
   Gnum                        hashsiz;            /* Size of hash table                     */
   Gnum                        hashmsk;            /* Mask for access to hash table          */
   HmeshHgraphHash * restrict  hashtab;            /* Table of edges to other node vertices  */
-  Gnum                        edgemax;            /* Upper bound of number of edges in mesh */
-  Gnum                        edgennd;            /* Based upper bound on number of edges   */
+  Genum                       edgemax;            /* Upper bound of number of edges in mesh */
+  Genum                       edgennd;            /* Based upper bound on number of edges   */
   Gnum                        enohnbr;            /* Number of non-halo edges               */
-  Gnum                        edgenum;            /* Number of current graph edge           */
+  Genum                       edgenum;            /* Number of current graph edge           */
   Gnum                        vertnum;            /* Number of current graph vertex         */
   Gnum                        degrmax;
 
@@ -127,8 +127,8 @@ Hgraph * restrict const       grafptr)            /*+ Graph to build +*/
   hashmsk = hashsiz - 1;
 
   if (memAllocGroup ((void **) (void *)
-                     &grafptr->s.verttax, (size_t) ((grafptr->s.vertnbr + 1) * sizeof (Gnum)),
-                     &grafptr->vnhdtax,   (size_t) ( grafptr->vnohnbr        * sizeof (Gnum)), NULL) == NULL) {
+                     &grafptr->s.verttax, (size_t) ((grafptr->s.vertnbr + 1) * sizeof (Genum)),
+                     &grafptr->vnhdtax,   (size_t) ( grafptr->vnohnbr        * sizeof (Genum)), NULL) == NULL) {
     errorPrint ("hmeshHgraph: out of memory (1)");
     return     (1);
   }
@@ -196,7 +196,7 @@ Hgraph * restrict const       grafptr)            /*+ Graph to build +*/
             Gnum                        vertend;
 
             if (edgenum == edgennd) {             /* If edge array already full */
-              Gnum                        edgemax;
+              Genum                       edgemax;
               Gnum * restrict             edgetmp;
 
               edgemax = edgennd - grafptr->s.baseval; /* Increase size by 25 % */
@@ -273,7 +273,7 @@ Hgraph * restrict const       grafptr)            /*+ Graph to build +*/
             Gnum                        vertend;
 
             if (edgenum == edgennd) {             /* If edge array already full */
-              Gnum                        edgemax;
+              Genum                       edgemax;
               Gnum * restrict             edgetmp;
 
               edgemax = edgennd - grafptr->s.baseval; /* Increase size by 25 % */
@@ -309,6 +309,8 @@ Hgraph * restrict const       grafptr)            /*+ Graph to build +*/
   grafptr->s.edlosum =                            /* Graph edges are not weighted */
   grafptr->s.edgenbr = edgenum - grafptr->s.baseval;
   grafptr->s.degrmax = degrmax;
+  grafptr->s.vconnbr = 0;
+  grafptr->s.vcontax = NULL;
 
   memFree (hashtab);
 
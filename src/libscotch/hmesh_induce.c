@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 23 jan 2020     **/
 /**                                 to   : 26 jan 2020     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -106,8 +106,8 @@ Hmesh * restrict const            indmeshptr)     /* Pointer to induced halo sub
   Gnum                indvnodnbr;                 /* Upper bound on the number of node vertices in induced halo mesh */
   Gnum                indvnodnum;                 /* Number of current node vertex in induced halo mesh              */
   Gnum * restrict     indedgetax;                 /* Based access to induced mesh graph edge arrays                  */
-  Gnum                indedgenbr;                 /* (Approximate) number of edges in induced halo mesh              */
-  Gnum                indedgenum;                 /* Number of current edge in induced halo mesh                     */
+  Genum               indedgenbr;                 /* (Approximate) number of edges in induced halo mesh              */
+  Genum               indedgenum;                 /* Number of current edge in induced halo mesh                     */
   Gnum * restrict     indvnuhtax;                 /* Array of vertex numbers for halo nodes (aka vnumtab)            */
   Gnum                indvelonbr;
   Gnum                indvelosum;
@@ -138,8 +138,8 @@ Hmesh * restrict const            indmeshptr)     /* Pointer to induced halo sub
   indvnlonbr = (orgmeshptr->m.vnlotax != NULL) ? indvnodnbr            : 0;
 
   if (memAllocGroup ((void **) (void *)           /* Allocate induced mesh graph structure */
-                     &indmeshptr->m.verttax, (size_t) ((indvertnbr + 1) * sizeof (Gnum)),
-                     &indmeshptr->vehdtax,   (size_t) ( orgvelmnbr      * sizeof (Gnum)), /* vehdtab is limited to elements */
+                     &indmeshptr->m.verttax, (size_t) ((indvertnbr + 1) * sizeof (Genum)),
+                     &indmeshptr->vehdtax,   (size_t) ( orgvelmnbr      * sizeof (Genum)), /* vehdtab is limited to elements */
                      &indmeshptr->m.velotax, (size_t) ( indvelonbr      * sizeof (Gnum)),
                      &indmeshptr->m.vnlotax, (size_t) ( indvnlonbr      * sizeof (Gnum)),
                      &indmeshptr->m.vnumtax, (size_t) ( orgvnodnbr      * sizeof (Gnum)), NULL) == NULL) {  /* vnumtab is of size vnohnbr */
@@ -198,8 +198,8 @@ Hmesh * restrict const            indmeshptr)     /* Pointer to induced halo sub
        indvertnum = indedgenum = indmeshptr->m.baseval; /* Elements are placed first in vertex array */
        orgvelmnum < orgmeshptr->m.velmnnd; orgvelmnum ++) {
     if (orgparttax[orgvelmnum] == orgpartval) {   /* If element belongs to right part */
-      Gnum                orgedgenum;
-      Gnum                indedgennd;             /* Index of after-last edge position in edge array       */
+      Genum               orgedgenum;
+      Genum               indedgennd;             /* Index of after-last edge position in edge array       */
       Gnum                indedhdnum;             /* Index of after-last edge linking to non-halo vertices */
 
       orgedgenum = orgmeshptr->m.verttax[orgvelmnum];
@@ -300,7 +300,7 @@ Hmesh * restrict const            indmeshptr)     /* Pointer to induced halo sub
 #endif /* SCOTCH_DEBUG_HMESH2 */
   for ( ; indvertnum < indmeshptr->vnohnnd; indvertnum ++) { /* For all non-halo induced node vertices */
     Gnum                orgvnodnum;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
 
     orgvnodnum = indmeshptr->m.vnumtax[indvertnum] + (orgmeshptr->m.vnodbas - orgmeshptr->m.baseval); /* Get number of original node */
 
@@ -327,7 +327,7 @@ Hmesh * restrict const            indmeshptr)     /* Pointer to induced halo sub
 
   for ( ; indvertnum < indmeshptr->m.vnodnnd; indvertnum ++) { /* For all halo induced node vertices */
     Gnum                orgvnodnum;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
 
     orgvnodnum = indvnuhtax[indvertnum];        /* Get number of original node */
 
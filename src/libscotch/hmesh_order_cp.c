@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2020,2021,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2020,2021,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 09 feb 2020     **/
 /**                # Version 7.0  : from : 28 aug 2020     **/
-/**                                 to   : 17 jan 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,8 +92,8 @@ const HmeshOrderCpParam * restrict const  paraptr)
   const Gnum * restrict         coarperitax;      /* Temporary based access to coarperitab                                 */
   Gnum                          coarvertnum;      /* Number of current compressed vertex                                   */
   Gnum * restrict               coarvsiztax;      /* Array of coarse vertex sizes (as number of merged fine vertices)      */
-  Gnum                          coaredgenum;      /* Number of current compressed edge                                     */
-  Gnum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
+  Genum                         coaredgenum;      /* Number of current compressed edge                                     */
+  Genum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
   Gnum                          coarvnodmax;
   Gnum                          coarvertmax;
   Gnum * restrict               finecoartax;      /* Original to compressed vertex number array                            */
@@ -105,7 +105,7 @@ const HmeshOrderCpParam * restrict const  paraptr)
   Gnum                          finevsizsum;      /* Sum of compressed vertex sizes to build fine inverse permutation      */
   Gnum                          coarvsizsiz;      /* Size of array of sizes of coarse nodes                                */
   Gnum                          coarvelmnbr;      /* Number of coarse element vertices                                     */
-  Gnum * restrict               coarverttax;
+  Genum * restrict              coarverttax;
   Gnum * restrict               coarvnlotax;
   Gnum * restrict               coaredgetax;
   Gnum * restrict               coarfinetax;
@@ -136,7 +136,7 @@ const HmeshOrderCpParam * restrict const  paraptr)
   finehashmsk = finehashmsk * 4 + 3;              /* Fill hash table at 1/4 of capacity */
 
   if (memAllocGroup ((void **) (void *)
-                     &coarverttax, (size_t) ((coarvertmax + 1)      * sizeof (Gnum)),
+                     &coarverttax, (size_t) ((coarvertmax + 1)      * sizeof (Genum)),
                      &coarvsiztax, (size_t) (coarvsizsiz            * sizeof (Gnum)), /* TRICK: if no vertex loads, coarvsiztax points to coarvnodtax */
                      &coarvnlotax, (size_t) (coarvnodmax            * sizeof (Gnum)), /* Only change node weights                                     */
                      &finecoartax, (size_t) (finemeshptr->m.vnodnbr * sizeof (Gnum)),
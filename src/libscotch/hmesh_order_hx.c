@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.1  : from : 29 oct 2019     **/
 /**                                 to   : 26 jan 2020     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -94,15 +94,15 @@ Gnum * restrict const         pfreptr)
   Gnum                        vnodnum;
   Gnum                        degrval;
   Gnum                        vertnum;
-  Gnum                        edgenum;
+  Genum                       edgenum;
 
   Gnum * restrict const       petax   = petab   - 1; /* Base HAMF arrays at base 1 */
   Gnum * restrict const       iwtax   = iwtab   - 1;
   Gnum * restrict const       lentax  = lentab  - 1;
   Gnum * restrict const       nvtax   = nvtab   - 1;
   Gnum * restrict const       elentax = elentab - 1;
-  const Gnum * restrict const verttax = meshptr->m.verttax;
-  const Gnum * restrict const vendtax = meshptr->m.vendtax;
+  const Genum * restrict const verttax = meshptr->m.verttax;
+  const Genum * restrict const vendtax = meshptr->m.vendtax;
   const Gnum * restrict const velotax = meshptr->m.velotax;
   const Gnum * restrict const edgetax = meshptr->m.edgetax;
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2020,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2020,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 27 aug 2020     **/
 /**                # Version 7.0  : from : 22 jun 2021     **/
-/**                                 to   : 22 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -216,8 +216,8 @@ Kgraph * restrict const     grafptr)
   Gnum                          vertnnd;
   Gnum                          fronnbr;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Anum * restrict const parttax = grafptr->m.parttax;
   Gnum * restrict const       frontab = grafptr->frontab;
@@ -225,7 +225,7 @@ Kgraph * restrict const     grafptr)
   for (vertnum = grafptr->s.baseval, vertnnd = grafptr->s.vertnnd, fronnbr = 0;
        vertnum < vertnnd; vertnum ++) {
     Anum                partval;                  /* Part of current vertex */
-    Gnum                edgenum;                  /* Number of current edge */
+    Genum               edgenum;                  /* Number of current edge */
 
     partval = parttax[vertnum];
     for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
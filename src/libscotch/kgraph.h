@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2014,2018,2021,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2014,2018,2021,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 16 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The comploadavg and comploaddlt       **/
 /**                  should always be allocated together,  **/
@@ -154,6 +154,7 @@ void                        kgraphExit          (Kgraph * const);
 void                        kgraphFrst          (Kgraph * const);
 int                         kgraphCheck         (const Kgraph * const);
 void                        kgraphCost          (Kgraph * const);
+Gnum                        kgraphCostVol       (const Kgraph * restrict const, Gnum * restrict const, Gnum * restrict const);
 void                        kgraphFron          (Kgraph * const);
 int                         kgraphBand          (Kgraph * restrict const, const Gnum, Kgraph * restrict const, Gnum * const, Gnum * restrict * restrict const);
 
@@ -1,4 +1,4 @@
-/* Copyright 2009-2011,2013-2016,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2009-2011,2013-2016,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.1  : from : 19 apr 2021     **/
 /**                                 to   : 30 jun 2021     **/
 /**                # Version 7.0  : from : 24 aug 2019     **/
-/**                                 to   : 19 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code derives from the code of    **/
 /**                  kdgraph_band.c in version 5.2 for     **/
@@ -89,7 +89,7 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
   Gnum                      bandvertnbr;          /* Number of band vertices (including anchor vertices)                                    */
   Gnum                      bandvertnnd;          /* Based end of band vertex array (without anchor vertices)                               */
   Gnum                      bandvertnum;
-  Gnum * restrict           bandverttax;
+  Genum * restrict           bandverttax;
   Gnum * restrict           bandvelotax;
   Gnum * restrict           bandvmlotax;
   Gnum * restrict           bandvnumtax;          /* Original numbers of vertices in band graph                                             */
@@ -97,8 +97,8 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
   Gnum * restrict           bandedgetax;
   Gnum * restrict           bandedlotax;
   Gnum * restrict           bandeeextab;
-  Gnum                      bandedgenbr;
-  Gnum                      bandedgenum;
+  Genum                     bandedgenbr;
+  Genum                     bandedgenum;
   Gnum                      banddegrmax;
   Gnum * restrict           bandfrontab;
   Anum * restrict           bandparttax;
@@ -121,8 +121,8 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
   KgraphBandHash * restrict termhashtab;
   Anum                      termhashmsk = 0;      /* Set initial value to prevent gcc from yelling */
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Gnum * restrict const edlotax = grafptr->s.edlotax;
@@ -135,7 +135,7 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
 
   if (graphBand (&grafptr->s, grafptr->fronnbr, grafptr->frontab, distmax,
                  &vnumotbdtax, &bandvertlvlnum, &bandvertnbr, &bandedgenbr,
-                 pfixtax, &bandvfixnbr) != 0) {   /* Get vertices to keep in band graph */
+                 pfixtax, &bandvfixnbr, grafptr->contptr) != 0) { /* Get vertices to keep in band graph */
     errorPrint ("kgraphBand: cannot number graph vertices");
     return (1);
   }
@@ -236,7 +236,7 @@ abort:
   bandgrafptr->m.domntab  = NULL;                 /* TRICK: clean domain array to prevent its freeing on error */
 
   if ((memAllocGroup ((void **) (void *)          /* Allocate graph data */
-                      &bandgrafptr->s.verttax, (size_t) ((bandvertnbr + 1) * sizeof (Gnum)), /* Compact vertex array */
+                      &bandgrafptr->s.verttax, (size_t) ((bandvertnbr + 1) * sizeof (Genum)), /* Compact vertex array */
                       &bandgrafptr->s.velotax, (size_t) ( bandvertnbr      * sizeof (Gnum)), NULL) == NULL) ||
       ((bandgrafptr->s.edgetax = memAlloc ((bandedgenbr + bandedlonbr) * sizeof (Gnum))) == NULL)) {
     errorPrint ("kgraphBand: out of memory (3)");
@@ -337,7 +337,7 @@ abort:
   for (bandvertnum = bandedgenum = bandgrafptr->s.baseval; /* Build vertex array of band graph                  */
        bandvertnum < bandvertlvlnum; bandvertnum ++) { /* For all vertices that do not belong to the last level */
     Gnum              vertnum;
-    Gnum              edgenum;
+    Genum             edgenum;
     Anum              partval;
     Gnum              degrval;
 
@@ -436,7 +436,7 @@ abort:
   }
   for ( ; bandvertnum < bandvertnnd; bandvertnum ++) { /* For all vertices that belong to the last level except anchors */
     Gnum              vertnum;
-    Gnum              edgenum;
+    Genum             edgenum;
     Anum              partval;
 
     vertnum = bandvnumtax[bandvertnum];
@@ -583,7 +583,7 @@ abort:
 
   if (pfixtax != NULL) {                          /* We have fixed vertices */
     memFree (termhashtab);                        /* Free group leader      */
-    for (bandvertnum = bandgrafptr->s.baseval, bandedgenum = 0; bandvertnum < bandvertnnd;
+    for (bandvertnum = bandedgenum = bandgrafptr->s.baseval; bandvertnum < bandvertnnd;
         bandvertnum ++) {                         /* Link anchors to vertices */
       for ( ; bandedgenum < bandverttax[bandvertnum + 1]; bandedgenum ++) {
         Gnum                  bandvertend;
@@ -605,13 +605,13 @@ abort:
   }
   else {
     if (bandedlotax != NULL) {                    /* If graph has edge weights */
-      Gnum              edgenum;
-      Gnum              edgennd;
+      Genum             edgenum;
+      Genum             edgennd;
 
       for (bandvertnum = bandgrafptr->s.baseval;  /* For all vertices not belonging to last level */
            bandvertnum < bandvertlvlnum; bandvertnum ++) {
         Gnum              vertnum;
-        Gnum              bandedgenum;
+        Genum             bandedgenum;
 
         vertnum     = bandvnumtax[bandvertnum];
         bandedgenum = bandverttax[bandvertnum];
@@ -660,8 +660,7 @@ abort:
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-  if (pfixtax != NULL)
-    kgraphFron (bandgrafptr);
+  kgraphFron (bandgrafptr);                       /* Seed vertices need not all belong to the frontier, e.g. in kgraphDelta() */
 
   bandgrafptr->m.domntab = grafptr->m.domntab;    /* Use original domain array for computing costs and checking mapping consistency */
   kgraphCost (bandgrafptr);
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2013,2014,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2013,2014,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 14 sep 2014     **/
 /**                # Version 7.0  : from : 11 jul 2021     **/
-/**                                 to   : 17 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -89,8 +89,8 @@ const Kgraph * restrict const grafptr)
 
   const Gnum                      baseval = grafptr->s.baseval;
   const Gnum                      vertnnd = grafptr->s.vertnnd;
-  const Gnum * restrict const     verttax = grafptr->s.verttax;
-  const Gnum * restrict const     vendtax = grafptr->s.vendtax;
+  const Genum * restrict const     verttax = grafptr->s.verttax;
+  const Genum * restrict const     vendtax = grafptr->s.vendtax;
   const Gnum * restrict const     velotax = grafptr->s.velotax;
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Gnum * restrict const     edlotax = grafptr->s.edlotax;
@@ -161,7 +161,7 @@ const Kgraph * restrict const grafptr)
   }
   for (fronnum = 0; fronnum < grafptr->fronnbr; fronnum ++) {
     Gnum                vertnum;
-    Gnum                edgenum;
+    Genum               edgenum;
     Anum                partval;
     Anum                flagval;
 
@@ -191,7 +191,7 @@ const Kgraph * restrict const grafptr)
   edloval  = 1;                                   /* Assume edges are not weighted */
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
     Anum                partval;                  /* Part of current vertex */
-    Gnum                edgenum;                  /* Number of current edge */
+    Genum               edgenum;                  /* Number of current edge */
     Gnum                commcut;
 
     partval = parttax[vertnum];
@@ -1,4 +1,4 @@
-/* Copyright 2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                partitions.                             **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 16 jun 2023     **/
-/**                                 to   : 16 jun 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -60,6 +60,31 @@
 /*                                 */
 /***********************************/
 
+/* The load computation routine is
+** instantiated once per type of distance
+** computation, so that distances between
+** complete graph and 2D mesh domains are
+** computed inline.
+*/
+
+#define KGRAPHCOSTCOMMTYPE          MAPPINGDISTTYPEGEN
+#define KGRAPHCOSTCOMMNAME          kgraphCostCommGen
+#include "kgraph_cost_comm.c"
+#undef KGRAPHCOSTCOMMNAME
+#undef KGRAPHCOSTCOMMTYPE
+
+#define KGRAPHCOSTCOMMTYPE          MAPPINGDISTTYPECMPLT
+#define KGRAPHCOSTCOMMNAME          kgraphCostCommCmplt
+#include "kgraph_cost_comm.c"
+#undef KGRAPHCOSTCOMMNAME
+#undef KGRAPHCOSTCOMMTYPE
+
+#define KGRAPHCOSTCOMMTYPE          MAPPINGDISTTYPEMESH2
+#define KGRAPHCOSTCOMMNAME          kgraphCostCommMesh2
+#include "kgraph_cost_comm.c"
+#undef KGRAPHCOSTCOMMNAME
+#undef KGRAPHCOSTCOMMTYPE
+
 /* This routine computes the cost of the
 ** current partition.
 ** It returns:
@@ -70,7 +95,6 @@ void
 kgraphCost (
 Kgraph * restrict const     grafptr)
 {
-  Gnum                      vertnum;
   Gnum * restrict           compload;
   Gnum                      commload;
   double                    fdomwgt;
@@ -79,67 +103,34 @@ Kgraph * restrict const     grafptr)
   Anum                      domnnum;
   ArchDom                   domndat;
   double                    domnrat;
+  MappingDist               distdat;              /* Cache of distances between domains */
 
-  const Gnum * restrict const     verttax = grafptr->s.verttax;
-  const Gnum * restrict const     velotax = grafptr->s.velotax;
-  const Gnum * restrict const     vendtax = grafptr->s.vendtax;
-  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
-  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Arch * restrict const     archptr = grafptr->m.archptr;
   const ArchDom * restrict const  domntab = grafptr->m.domntab;
-  Anum * restrict const           parttax = grafptr->m.parttax;
   const Anum                      domnnbr = grafptr->m.domnnbr;
 
-  commload = 0;
+  mapDistInit (&distdat, &grafptr->m, grafptr->s.edgenbr / 2, MAPPINGDISTNONE);
+
   compload = grafptr->comploaddlt;                   /* Use delta array as temporary storage */
   memSet (compload, 0, domnnbr * sizeof (Gnum));
-  for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
-    Gnum                edgenum;
-    Gnum                edgennd;
-    Anum                partval;                  /* Part of current vertex                                */
-    Anum                partlst;                  /* Part of last vertex for which a distance was computed */
-    Anum                distlst;                  /* Last distance computed                                */
-    Gnum                veloval;
-
-    partval = parttax[vertnum];
-    partlst = -1;                                 /* Invalid part to recompute distance */
-    distlst = -1;                                 /* To prevent compiler from yelling   */
-
-#ifdef SCOTCH_DEBUG_KGRAPH2
-    if ((partval < 0) || (partval >= domnnbr)) {
-      errorPrint ("kgraphCost: invalid part number (1)");
-      return;
-    }
-#endif /* SCOTCH_DEBUG_KGRAPH2 */
-    veloval = (velotax != NULL) ? velotax[vertnum] : 1;
-    compload[partval] += veloval;
-
-    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
-         edgenum < edgennd; edgenum ++) {
-      Gnum                vertend;
-      Anum                partend;
-
-      vertend = edgetax[edgenum];
-      if (vertend > vertnum)                      /* Compute loads only once */
-        continue;
-
-      partend = parttax[vertend];
+  switch (distdat.typeval) {                      /* Call routine specialized for distance type */
+    case MAPPINGDISTTYPECMPLT :
+      commload = kgraphCostCommCmplt (grafptr, &distdat, compload);
+      break;
+    case MAPPINGDISTTYPEMESH2 :
+      commload = kgraphCostCommMesh2 (grafptr, &distdat, compload);
+      break;
+    default :
+      commload = kgraphCostCommGen (grafptr, &distdat, compload);
+  }
 #ifdef SCOTCH_DEBUG_KGRAPH2
-      if ((partend < 0) || (partend >= domnnbr)) {
-        errorPrint ("kgraphCost: invalid part number (2)");
-        return;
-      }
-#endif /* SCOTCH_DEBUG_KGRAPH2 */
-      if (partval != partend) {
-        if (partend != partlst) {
-          distlst = archDomDist (archptr, &domntab[partval], &domntab[partend]);
-          partlst = partend;
-        }
-        commload += (Gnum) distlst * ((edlotax != NULL) ? edlotax[edgenum] : 1);
-      }
-    }
+  if (commload < 0) {
+    mapDistExit (&distdat);
+    return;
   }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
   grafptr->commload = commload;
+  mapDistExit (&distdat);
 
   fdomwgt = 0;
   fvelsum = 0;
@@ -179,3 +170,56 @@ Kgraph * restrict const     grafptr)
     grafptr->comploadavg[domnnum] = (Gnum) ((double) velosum * ((double) archDomWght (archptr, &domntab[domnnum]) / domnrat));
   }
 }
+
+/* This routine computes the communication
+** volume of the current partition, that is,
+** for every vertex, the number of distinct
+** parts other than its own to which its
+** neighbors belong. The per-part volumes
+** are the sums of the volumes of the
+** vertices of each part.
+** It returns:
+** - the total communication volume : in all cases.
+*/
+
+Gnum
+kgraphCostVol (
+const Kgraph * restrict const grafptr,
+Gnum * restrict const         flagtab,            /*+ Work array of size domnnbr           +*/
+Gnum * restrict const         voldtab)            /*+ Array of part volumes, or NULL       +*/
+{
+  Gnum                      vertnum;
+  Gnum                      volusum;
+
+  const Genum * restrict const  verttax = grafptr->s.verttax;
+  const Genum * restrict const  vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const   edgetax = grafptr->s.edgetax;
+  const Anum * restrict const   parttax = grafptr->m.parttax;
+  const Anum                    domnnbr = grafptr->m.domnnbr;
+
+  memSet (flagtab, ~0, domnnbr * sizeof (Gnum));
+  if (voldtab != NULL)
+    memSet (voldtab, 0, domnnbr * sizeof (Gnum));
+
+  for (vertnum = grafptr->s.baseval, volusum = 0; vertnum < grafptr->s.vertnnd; vertnum ++) {
+    Genum               edgenum;
+    Anum                partval;
+    Gnum                voluval;
+
+    partval = parttax[vertnum];
+    for (edgenum = verttax[vertnum], voluval = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+      Anum                partend;
+
+      partend = parttax[edgetax[edgenum]];
+      if ((partend != partval) && (flagtab[partend] != vertnum)) { /* If neighbor part not yet accounted for */
+        flagtab[partend] = vertnum;
+        voluval ++;
+      }
+    }
+    volusum += voluval;
+    if (voldtab != NULL)
+      voldtab[partval] += voluval;
+  }
+
+  return (volusum);
+}
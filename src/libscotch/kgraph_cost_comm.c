@@ -0,0 +1,133 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_cost_comm.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the stub of the    **/
+/**                load computation routine of k-way       **/
+/**                mappings, specialized for each type of  **/
+/**                distance computation.                   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/**********************************/
+/*                                */
+/* The load computation           */
+/* subroutine pattern.            */
+/*                                */
+/**********************************/
+
+/* This routine computes the computation
+** loads of all parts of the current mapping,
+** which are accumulated in the given array,
+** and returns its communication load.
+** It returns:
+** - >= 0  : communication load.
+** - -1    : on error (debug mode only).
+*/
+
+static
+Gnum
+KGRAPHCOSTCOMMNAME (
+const Kgraph * restrict const   grafptr,
+MappingDist * restrict const    distptr,          /*+ Cache of distances between domains +*/
+Gnum * restrict const           compload)         /*+ Array of part loads, set to zero   +*/
+{
+  Gnum                      vertnum;
+  Gnum                      commload;
+
+  const Genum * restrict const    verttax = grafptr->s.verttax;
+  const Gnum * restrict const     velotax = grafptr->s.velotax;
+  const Genum * restrict const    vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
+  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
+  const Anum * restrict const     parttax = grafptr->m.parttax;
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  const Anum                      domnnbr = grafptr->m.domnnbr;
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  commload = 0;
+  for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
+    Genum               edgenum;
+    Genum               edgennd;
+    Anum                partval;                  /* Part of current vertex                                */
+    Anum                partlst;                  /* Part of last vertex for which a distance was computed */
+    Anum                distlst;                  /* Last distance computed                                */
+    Gnum                veloval;
+
+    partval = parttax[vertnum];
+    partlst = -1;                                 /* Invalid part to recompute distance */
+    distlst = -1;                                 /* To prevent compiler from yelling   */
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+    if ((partval < 0) || (partval >= domnnbr)) {
+      errorPrint ("kgraphCost: invalid part number (1)");
+      return (-1);
+    }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+    veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+    compload[partval] += veloval;
+
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
+         edgenum < edgennd; edgenum ++) {
+      Gnum                vertend;
+      Anum                partend;
+
+      vertend = edgetax[edgenum];
+      if (vertend > vertnum)                      /* Compute loads only once */
+        continue;
+
+      partend = parttax[vertend];
+#ifdef SCOTCH_DEBUG_KGRAPH2
+      if ((partend < 0) || (partend >= domnnbr)) {
+        errorPrint ("kgraphCost: invalid part number (2)");
+        return (-1);
+      }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+      if (partval != partend) {
+        if (partend != partlst) {
+          distlst = mapDistGetType (distptr, KGRAPHCOSTCOMMTYPE, partval, partend);
+          partlst = partend;
+        }
+        commload += (Gnum) distlst * ((edlotax != NULL) ? edlotax[edgenum] : 1);
+      }
+    }
+  }
+
+  return (commload);
+}
@@ -0,0 +1,158 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_delta.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module updates an existing k-way   **/
+/**                mapping after local changes of the      **/
+/**                graph, by creating a band graph of      **/
+/**                given width around the changed          **/
+/**                vertices, applying a refinement         **/
+/**                strategy to the band graph, and         **/
+/**                projecting back the obtained parts to   **/
+/**                the original graph.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Contrary to kgraphMapBd(), the band   **/
+/**                  graph is not centered on the whole    **/
+/**                  frontier but only on the changed      **/
+/**                  vertices, so that the cost of the     **/
+/**                  refinement depends on the size of the **/
+/**                  change and not on the one of the      **/
+/**                  frontier.                             **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_delta.h"
+#include "kgraph_map_st.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes a band graph of given
+** width around the vertices held in the frontier
+** array of the given graph, which must be the
+** vertices affected by the changes since the
+** current mapping was computed, applies the
+** given strategy to the band graph, and updates
+** the mapping, frontier and costs of the
+** original graph accordingly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+kgraphDelta (
+Kgraph * restrict const       orggrafptr,         /*+ Graph, with changed vertices in frontier array +*/
+const Gnum                    distmax,            /*+ Width of band around changed vertices         +*/
+const Strat * restrict const  straptr)            /*+ Strategy for band graph                       +*/
+{
+  Kgraph                    bndgrafdat;           /* Band graph structure                      */
+  Gnum * restrict           bndvnumtax;           /* Original numbers of vertices in band graph */
+  Gnum                      bndvertancnnd;        /* End of band vertex array, without anchors  */
+  Gnum                      bndvertnum;
+  int                       o;
+
+  const Anum                  domnnbr = orggrafptr->m.domnnbr;
+
+  if (orggrafptr->fronnbr == 0) {                 /* If no vertex changed, keep mapping as is */
+    kgraphFron (orggrafptr);
+    kgraphCost (orggrafptr);
+    return (0);
+  }
+
+  if (kgraphBand (orggrafptr, distmax, &bndgrafdat, NULL, &bndvnumtax) != 0) {
+    errorPrint ("kgraphDelta: cannot create band graph");
+    return (1);
+  }
+
+  kgraphFron (&bndgrafdat);                       /* Changed vertices may not belong to the frontier */
+
+  bndgrafdat.m.domntab  = orggrafptr->m.domntab;  /* Transfer mapping domain array to band graph */
+  orggrafptr->m.domntab = NULL;
+
+  o = kgraphMapSt (&bndgrafdat, straptr);         /* Refine band graph */
+
+  orggrafptr->m.domntab = bndgrafdat.m.domntab;   /* Transfer (potentially updated) mapping domain array back to original graph */
+  orggrafptr->m.domnnbr = bndgrafdat.m.domnnbr;
+  orggrafptr->m.domnmax = bndgrafdat.m.domnmax;
+  bndgrafdat.m.domntab  = NULL;
+
+  if (o != 0) {
+    errorPrint ("kgraphDelta: cannot refine band graph");
+    goto abort;
+  }
+  if (bndgrafdat.m.domnnbr != domnnbr) {
+    errorPrint ("kgraphDelta: change in band graph number of parts not supported");
+    o = 1;
+    goto abort;
+  }
+
+  bndvertancnnd = bndgrafdat.s.vertnnd - domnnbr;
+  for (bndvertnum = bndgrafdat.s.baseval; bndvertnum < bndvertancnnd; bndvertnum ++) /* Update part array of all vertices except anchors */
+    orggrafptr->m.parttax[bndvnumtax[bndvertnum]] = bndgrafdat.m.parttax[bndvertnum];
+
+  kgraphFron (orggrafptr);                        /* Recompute frontier and costs of original graph */
+  kgraphCost (orggrafptr);
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (orggrafptr) != 0) {
+    errorPrint ("kgraphDelta: inconsistent graph data");
+    o = 1;
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+abort:
+  memFree    (bndvnumtax + bndgrafdat.s.baseval);
+  kgraphExit (&bndgrafdat);
+
+  return (o);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.1  : from : 30 jun 2021     **/
 /**                                 to   : 16 jul 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 30 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Since only edges from local vertices  **/
 /**                  to local anchors are created in       **/
@@ -108,8 +108,8 @@ Kgraph * const                      orggrafptr,   /*+ Graph             +*/
 const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 {
   Kgraph                    bndgrafdat;           /* Partitioning band graph structure                                   */
-  const Gnum * restrict     bndverttax;
-  const Gnum * restrict     bndvendtax;
+  const Genum * restrict     bndverttax;
+  const Genum * restrict     bndvendtax;
   const Gnum * restrict     bndedgetax;
   const Gnum * restrict     bndedlotax;
   const Anum * restrict     bndparttax;
@@ -127,8 +127,8 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
   Gnum                      vertnum;
   int                       o;
 
-  const Gnum * restrict const orgverttax = orggrafptr->s.verttax;
-  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->s.verttax;
+  const Genum * restrict const orgvendtax = orggrafptr->s.vendtax;
   const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
   const Gnum * restrict const orgedlotax = orggrafptr->s.edlotax;
   const Arch * restrict const archptr    = orggrafptr->m.archptr;
@@ -209,8 +209,8 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 
   commload = 0;
   for (bndvertnum = bndgrafdat.s.baseval; bndvertnum < bndvertlvlnum; bndvertnum ++) { /* For all vertices of band graph save for last layer */
-    Gnum                bndedgenum;
-    Gnum                bndedgennd;
+    Genum               bndedgenum;
+    Genum               bndedgennd;
     Anum                bndpartval;
     Anum                bndpartlst;               /* Part of last vertex for which a distance was computed */
     Anum                bnddistlst;               /* Last distance computed                                */
@@ -237,8 +237,8 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
     }
   }
   for ( ; bndvertnum < bndvertancnnd; bndvertnum ++) { /* For all vertices of last layer, remove communication loads to band vertices once */
-    Gnum                bndedgenum;
-    Gnum                bndedgennd;
+    Genum               bndedgenum;
+    Genum               bndedgennd;
     Anum                bndpartval;
     Anum                bndpartlst;               /* Part of last vertex for which a distance was computed */
     Anum                bnddistlst;               /* Last distance computed                                */
@@ -276,8 +276,8 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 
   commload2 = 0;
   for (bndvertnum = bndgrafdat.s.baseval; bndvertnum < bndvertancnnd; bndvertnum ++) { /* For all vertices */
-    Gnum                orgedgenum;
-    Gnum                orgedgennd;
+    Genum               orgedgenum;
+    Genum               orgedgennd;
     Gnum                orgvertnum;
     Anum                orgpartval;
     int                 orgflagval;
@@ -317,7 +317,7 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 
     for (vertnum = orggrafptr->s.baseval; vertnum < orggrafptr->s.vertnnd; vertnum ++) {
       Gnum                partval;
-      Gnum                edgenum;
+      Genum               edgenum;
 
       if ((orggrafptr->pfixtax[vertnum] == -1) || /* If it is not a fixed vertex            */
           (kgraphMapBdFlagVal (orgflagtab, vertnum) != 0)) /* Or has already been processed */
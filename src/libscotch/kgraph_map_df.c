@@ -1,4 +1,4 @@
-/* Copyright 2010-2012,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010-2012,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**   DATES      : # Version 6.0  : from : 05 jan 2010     **/
 /**                                 to   : 04 nov 2012     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -151,8 +151,8 @@ KgraphMapDfData * restrict const  loopptr)
   Anum * restrict const               parttax = grafptr->m.parttax;
   const float                         crloval = (float) grafptr->r.crloval;
   const Anum * restrict const         parotax = grafptr->r.m.parttax;
-  const Gnum * restrict const         verttax = grafptr->s.verttax;
-  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Genum * restrict const         verttax = grafptr->s.verttax;
+  const Genum * restrict const         vendtax = grafptr->s.vendtax;
   const Gnum * restrict const         velotax = grafptr->s.velotax;
   const Gnum * const                  edgetax = grafptr->s.edgetax;
   const Gnum * const                  edlotax = grafptr->s.edlotax;
@@ -170,8 +170,8 @@ KgraphMapDfData * restrict const  loopptr)
   if (edlotax != NULL) {
     for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* For all local non-anchor vertices */
       Gnum                velssum;
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
       if ((vendtax[vertnum] - verttax[vertnum]) == 0) { /* Non-anchor vertices should not be isolated */
@@ -188,8 +188,8 @@ KgraphMapDfData * restrict const  loopptr)
     }
 
     for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) { /* For all local anchor vertices */
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
       Gnum                velssum;
 
       for (edgenum = verttax[vancnnd + domnnum], edgennd = vendtax[vancnnd + domnnum], velssum = 0;
@@ -307,8 +307,8 @@ KgraphMapDfData * restrict const  loopptr)
     veloval = 1.0F;                               /* Assume no vertex loads */
 
     for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* For all local regular vertices */
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
       Gnum                soplval;                /* Load sum of edges going to vertex old part                 */
       Gnum                sfplval;                /* Load sum of edges going to vertex of other parts           */
       Gnum                dfplval;                /* Load sum of edges going to vertex of other parts * distval */
@@ -364,7 +364,7 @@ KgraphMapDfData * restrict const  loopptr)
           }
         }
         sorttab[partnbr].partval = partval;       /* Create new slot */
-        sorttab[partnbr].distval = ((mappflag == 1) && (partcur != partval)) ? archDomDist (archptr, &grafptr->m.domntab[partcur], &grafptr->m.domntab[partval]) : 1;
+        sorttab[partnbr].distval = ((mappflag == 1) && (partcur != partval)) ? mapDistGet (&loopptr->distdat, partcur, partval) : 1;
         sorttab[partnbr].diffval = diffval;
         sorttab[partnbr].edlosum = edloval;
         partnbr ++;
@@ -456,8 +456,8 @@ endloop1 : ;
 
     for (domnnum = domnbas, vertnum = vancnnd + domnbas; /* For all the subset of anchor vertices */
          domnnum < domnnnd; domnnum ++, vertnum ++) {
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
       Anum                partnbr;                /* Number of active parts */
       float               diffval;
 
@@ -588,6 +588,8 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
   loopdat.difntax -= grafptr->s.baseval;
   loopdat.difotax -= grafptr->s.baseval;
   loopdat.passnbr  = paraptr->passnbr;
+  mapDistInit (&loopdat.distdat, &grafptr->m,     /* Shared cache is only filled when distances are needed */
+               archPart (grafptr->m.archptr) ? 0 : (vertnbr * paraptr->passnbr), MAPPINGDISTSHARED);
 
   loopdat.abrtval = 0;                            /* No one wants to abort yet */
 
@@ -598,6 +600,7 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
 #endif /* KGRAPHMAPDFNOTHREAD */
 
   memFree (loopdat.vanctab);                      /* Free group leader */
+  mapDistExit (&loopdat.distdat);
 
   kgraphFron (grafptr);
   kgraphCost (grafptr);
@@ -1,4 +1,4 @@
-/* Copyright 2009-2012,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2009-2012,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 22 dec 2009     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -100,6 +100,7 @@ typedef struct KgraphMapDfData_ {
   Gnum *                    velstax;              /*+ Vertex edge load sum array +*/
   KgraphMapDfVertex *       difntax;              /*+ New diffusion value array  +*/
   KgraphMapDfVertex *       difotax;              /*+ Old diffusion value array  +*/
+  MappingDist               distdat;              /*+ Cache of domain distances  +*/
   int                       passnbr;              /*+ Number of passes           +*/
   volatile int              abrtval;              /*+ Abort value                +*/
 } KgraphMapDfData;
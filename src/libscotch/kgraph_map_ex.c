@@ -1,4 +1,4 @@
-/* Copyright 2011,2013,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2011,2013,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 27 may 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 11 jul 2021     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -57,6 +57,7 @@
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
+#include "arch_cmplt.h"
 #include "mapping.h"
 #include "kgraph.h"
 #include "kgraph_map_ex.h"
@@ -92,6 +93,7 @@ const KgraphMapExParam * const  paraptr)          /*+ Method parameters +*/
   Anum                        termnbr;            /* Number of terminal domains in mapping     */
   Gnum                        vertnum;
   Gnum                        vertnnd;
+  Gnum                        vertancnnd;         /* Based end of non-anchor vertices          */
   double                      velosum;            /* Sum of vertex weights                     */
   double                      wghtsum;            /* Sum of architecture weights               */
   Anum                        wghttmp;            /* Sum of architecture weights for archVar   */
@@ -172,13 +174,15 @@ const KgraphMapExParam * const  paraptr)          /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-  parttax = grafptr->m.parttax;
+  parttax    = grafptr->m.parttax;
+  vertancnnd = ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) ? (grafptr->s.vertnnd - domnnbr) : grafptr->s.vertnnd; /* Anchors never move */
   for (vertnum = grafptr->s.baseval, vertnnd = grafptr->s.vertnnd, sortnbr = 0; /* Get vertex weights */
        vertnum < vertnnd; vertnum ++) {
     Gnum                veloval;
 
     veloval = (velotax != NULL) ? velotax[vertnum] : 1;
-    if ((pfixtax == NULL) || (pfixtax[vertnum] < 0)) { /* If vertex is not fixed */
+    if ((vertnum < vertancnnd) &&                 /* If vertex is neither an anchor */
+        ((pfixtax == NULL) || (pfixtax[vertnum] < 0))) { /* Nor fixed                 */
       sorttab[sortnbr].veloval = veloval;         /* Record it for sorting       */
       sorttab[sortnbr].vertnum = vertnum;
       sortnbr ++;
@@ -187,7 +191,7 @@ const KgraphMapExParam * const  paraptr)          /*+ Method parameters +*/
       doextab[parttax[vertnum]].comploadmax -= veloval; /* Reduce available room in domain for non-fixed vertices */
   }
 #ifdef SCOTCH_DEBUG_KGRAPH2
-  if (sortnbr != (grafptr->s.vertnbr - grafptr->vfixnbr)) {
+  if (sortnbr != (vertancnnd - grafptr->s.baseval - grafptr->vfixnbr)) {
     errorPrint ("kgraphMapEx: internal error (2)");
     return (1);
   }
@@ -397,8 +401,9 @@ const Gnum                              veloval)
     if (son1num == -1)                            /* If node has only one son */
       return (kgraphMapExFind2 (archptr, treetab, doextab, bestptr, treenum, son0num, veloval)); /* Process it directly */
 
-    i = (archDomDist (archptr, &treetab[treenum].domndat, &treetab[son0num].domndat) <= /* Get closest subdomain */
-         archDomDist (archptr, &treetab[treenum].domndat, &treetab[son1num].domndat)) ? 0 : 1;
+    i = (archDomDistIs (archptr, Cmplt) ||        /* All subdomains are equally close in complete graphs */
+         (archDomDist (archptr, &treetab[treenum].domndat, &treetab[son0num].domndat) <= /* Get closest subdomain */
+          archDomDist (archptr, &treetab[treenum].domndat, &treetab[son1num].domndat))) ? 0 : 1;
 
     o = kgraphMapExFind2 (archptr, treetab, doextab, bestptr, treenum, treetab[nodenum].sonstab[i], veloval); /* Process closest branch */
     if (o != 0)                                   /* If didn't find suitable terminal in closest branch */
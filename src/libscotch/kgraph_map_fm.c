@@ -1,4 +1,4 @@
-/* Copyright 2004,2010-2012,2014,2016,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2010-2012,2014,2016,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**   DATES      : # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -307,13 +307,13 @@ Gnum * const                                chektab)
   commloadtmp = 0;
   for (vexxidx = 0; vexxidx <= hashmsk; vexxidx ++) { /* For all vertex slots */
     Gnum                vertnum;
-    Gnum                edgenum;
+    Genum               edgenum;
     Anum                domnorg;
     Anum                domnlst;                  /* Domain of last vertex for which a distance was computed */
     Anum                distlst;                  /* Last distance computed                                  */
     Gnum                commloadloctmp;
     Gnum                edlosum;
-    Gnum                edgenbr;
+    Genum               edgenbr;
 
     commloadloctmp = 0;
     vertnum = vexxtab[vexxidx].vertnum;
@@ -458,7 +458,7 @@ Gnum * const                                chektab)
     for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
       if (grafptr->pfixtax[vertnum] != -1) {      /* If vertex is fixed */
         Gnum                domnorg;
-        Gnum                edgenum;
+        Genum               edgenum;
 
         domnorg = parttax[vertnum];
         domnlst = -1;                             /* Invalid part to recompute distance */
@@ -546,240 +546,37 @@ KgraphMapFmTabl * restrict const    tablptr)
   return (0);
 }
 
-static
-int
-kgraphMapFmPartAdd2 (
-const Kgraph * restrict const       grafptr,
-KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array   +*/
-Gnum                                vexxidx,
-KgraphMapFmEdge * restrict * const  edxxtabptr,
-Gnum * restrict const               edxxsizptr,
-Gnum * restrict const               edxxnbrptr,
-Anum                                domnnum,      /*+ Vertex domain                      +*/
-Anum                                domnend,      /*+ Domain of the extended edge to add +*/
-Gnum                                edloval,      /*+ Load of the edge to domnend        +*/
-KgraphMapFmTabl * restrict const    tablptr)
-{
-  KgraphMapFmEdge * restrict    edxxtab;
-  Gnum                          edxxidx;
-  Gnum                          edxxtmp;
-  Gnum                          commgain;
-
-  const Arch * restrict const     archptr = grafptr->m.archptr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
-
-  if (*edxxnbrptr >= *edxxsizptr)                 /* If new slot would not fit  */
-    kgraphMapFmEdgeResize (vexxtab, -1, edxxtabptr, edxxsizptr, *edxxnbrptr, tablptr); /* No vexxidx because vertex extended edges will be readd later */
-
-  edxxtab = *edxxtabptr;
-  edxxidx = (*edxxnbrptr) ++;                     /* Allocate new slot */
-
-  edxxtab[edxxidx].domnnum = domnend;             /* Set extended edge data */
-  edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
-  edxxtab[edxxidx].edlosum = edloval;
-  edxxtab[edxxidx].edgenbr = 1;
-  edxxtab[edxxidx].vexxidx = vexxidx;
-  edxxtab[edxxidx].mswpnum = 0;
-
-  commgain = 0;                                   /* Compute commgain */
-  for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
-    commgain += edxxtab[edxxtmp].edlosum *
-                (archDomDist (archptr, &domntab[edxxtab[edxxtmp].domnnum], &domntab[domnend])
-                - edxxtab[edxxtmp].distval);
-  }
-  commgain += (vexxtab[vexxidx].edlosum - edloval) * edxxtab[edxxidx].distval;
-  edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval;
-
-  edxxtab[edxxidx].edxxidx  = vexxtab[vexxidx].edxxidx; /* Link edge to vertex  */
-  vexxtab[vexxidx].edxxidx  = edxxidx;
-
-  edxxtab[edxxidx].cmiggain = 0;                  /* Compute migration commgain */
-  edxxtab[edxxidx].cmigmask = 0;
-  if (vexxtab[vexxidx].domoptr != NULL) {
-    Gnum                migcoef;                  /* Equal to -migedloval if vertex was mapped in old mapping */
-
-    migcoef = grafptr->r.cmloval * ((grafptr->r.vmlotax != NULL) ? grafptr->r.vmlotax[vexxtab[vexxidx].vertnum] : 1);
-
-    edxxtab[edxxidx].cmiggain = (archDomIncl (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr) == 1) ? 0
-                                : migcoef * archDomDist (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr);
-    edxxtab[edxxidx].cmiggain -= vexxtab[vexxidx].cmigload;
-    edxxtab[edxxidx].cmigmask = ~0;
-  }
-
-  if (vexxtab[vexxidx].lockptr == NULL)           /* If value has to be linked */
-    kgraphMapFmTablAdd (tablptr, &edxxtab[edxxidx]);
-
-  return (0);
-}
-
-/* This routine adds a vertex to hash table.
+/* The vertex insertion routines are
+** instantiated once per type of distance
+** computation, so that distances between
+** complete graph and 2D mesh domains are
+** computed inline, and the cache is only
+** looked up for other architectures.
 */
 
-static
-int
-kgraphMapFmPartAdd (
-const Kgraph * restrict const               grafptr,
-const Gnum                                  vertnum,
-const Gnum                                  vexxidx,  /* Hash value for insertion in vexxtab */
-KgraphMapFmVertex * restrict const          vexxtab,
-KgraphMapFmEdge **                          edxxtabptr,
-Gnum * restrict const                       edxxsizptr,
-Gnum * restrict const                       edxxnbrptr,
-KgraphMapFmTabl * restrict const            tablptr)
-{
-  Gnum                          oldvertnum;       /* Number of current vertex */
-  KgraphMapFmEdge * restrict    edxxtab;
-  Gnum                          edxxidx;
-  Gnum                          edgenum;
-  Gnum                          edlosum;
-  Gnum                          edgenbr;
-  Anum                          domnnum;
-  Gnum                          commload;         /* Communication load for local domain */
-
-  const Gnum * restrict const     verttax = grafptr->s.verttax;
-  const Gnum * restrict const     vendtax = grafptr->s.vendtax;
-  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
-  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
-  const Arch * restrict const     archptr = grafptr->m.archptr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
-  const Anum * restrict const     parttax = grafptr->m.parttax;
-  const Anum * restrict const     parotax = grafptr->r.m.parttax;
-
-#ifdef SCOTCH_DEBUG_KGRAPH2
-  if (vexxtab[vexxidx].vertnum != ~0) {
-    errorPrint ("kgraphMapFmPartAdd: internal error (1)");
-    return     (1);
-  }
-#endif /* SCOTCH_DEBUG_KGRAPH2 */
-
-  domnnum = parttax[vertnum];
-
-  vexxtab[vexxidx].vertnum = vertnum;
-  vexxtab[vexxidx].domnnum = domnnum;
-  vexxtab[vexxidx].veloval = (grafptr->s.velotax != NULL) ? grafptr->s.velotax[vertnum] : 1; /* Vertex will be linked since value is positive */
-  vexxtab[vexxidx].mswpnum = 0;                   /* Implicitly set slot as used */
-  vexxtab[vexxidx].edxxidx = -1;                  /* No target domains yet       */
-  vexxtab[vexxidx].lockptr = NULL;                /* No locked yet               */
-
-  oldvertnum = ((grafptr->s.vnumtax != NULL) &&   /* If there is ancestor graph vertex numbers           */
-                (grafptr->s.flagval & KGRAPHHASANCHORS) == 0) /* That are not the ones of the band graph */
-               ? grafptr->s.vnumtax[vertnum] : vertnum; /* Get vertex number in original graph           */
-
-  if ((parotax != NULL) &&                        /* If we are doing a repartitioning                                     */
-      (parotax[oldvertnum] != -1))                /* And if vertex was mapped to an old domain                            */
-    vexxtab[vexxidx].domoptr = mapDomain (&grafptr->r.m, oldvertnum); /* Domain in which the vertex was previously mapped */
-  else
-    vexxtab[vexxidx].domoptr = NULL;
-
-  edxxtab = *edxxtabptr;                          /* Compute and link edges */
-  edgenbr = 0;
-
-  for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
-    Gnum                domnend;
-
-    domnend = edxxtab[edxxidx].domnnum;
-    edxxtab[edxxidx].edlosum = 0;
-    edxxtab[edxxidx].edgenbr = 0;
-    edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
-  }
-
-  commload = 0;                                   /* Load associated with vertex edges */
-  edlosum  = 0;
-  for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
-    Gnum                edxxidx;
-    Gnum                vertend;
-    Anum                domnend;
-    Gnum                edloval;
-
-    vertend = edgetax[edgenum];
-    domnend = parttax[vertend];
-
-    edloval = (edlotax != NULL) ? edlotax[edgenum] : 1; /* Do not account for crloval yet */
-
-    if (domnend == domnnum) {                     /* If end vertex belongs to same domain */
-      edlosum += edloval;                         /* Record local edge load sum           */
-      edgenbr ++;                                 /* Record local edge                    */
-      continue;                                   /* Skip further processing              */
-    }
-
-    for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) { /* Search for edge */
-      if (edxxtab[edxxidx].domnnum == domnend)    /* If edge slot found */
-        break;
-    }
-
-    if (edxxidx == -1) {                          /* If edge slot not found    */
-      if (*edxxnbrptr >= *edxxsizptr)             /* If new slot would not fit */
-        kgraphMapFmEdgeResize (vexxtab, vexxidx, edxxtabptr, edxxsizptr, *edxxnbrptr, tablptr);
-
-      edxxidx = (*edxxnbrptr) ++;                 /* Allocate new slot */
-      edxxtab = *edxxtabptr;                      /* Update edxxtab    */
-
-      edxxtab[edxxidx].commgain = 0;
-      edxxtab[edxxidx].cmiggain = 0;
-      edxxtab[edxxidx].cmigmask = (parotax != NULL) ? ~0 : 0;
-      edxxtab[edxxidx].domnnum  = domnend;
-      edxxtab[edxxidx].distval  = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
-      edxxtab[edxxidx].edlosum  = 0;
-      edxxtab[edxxidx].edgenbr  = 0;
-      edxxtab[edxxidx].vexxidx  = vexxidx;
-      edxxtab[edxxidx].edxxidx  = vexxtab[vexxidx].edxxidx; /* Link edge to vertex */
-      vexxtab[vexxidx].edxxidx  = edxxidx;
-      edxxtab[edxxidx].mswpnum  = 0;
-    }
-
-    commload += edloval * edxxtab[edxxidx].distval;
-    edxxtab[edxxidx].edlosum += edloval;
-    edxxtab[edxxidx].edgenbr ++;
-  }
-  commload *= grafptr->r.crloval;                 /* Multiply all local loads by crloval */
-  vexxtab[vexxidx].edlosum = edlosum;
-  vexxtab[vexxidx].edgenbr = edgenbr;
-
-  for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
-    Gnum                domncur;
-    Gnum                edxxtmp;
-    Gnum                commgain;
-
-    domncur = edxxtab[edxxidx].domnnum;
-
-    commgain = 0;
-    for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
-      Anum                domnend;
-
-      if (edxxtmp == edxxidx)
-        continue;
-
-      domnend = edxxtab[edxxtmp].domnnum;
-      commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
-                  archDomDist (archptr, &domntab[domncur], &domntab[domnend]);
-    }
-    commgain += vexxtab[vexxidx].edlosum * edxxtab[edxxidx].distval;
-    edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
-  }
-
-  vexxtab[vexxidx].cmigload = 0;
-  if (vexxtab[vexxidx].domoptr != NULL) {
-    Gnum                migcoef;                  /* Equal to -migedloval if vertex was mapped in old mapping */
-
-    migcoef = grafptr->r.cmloval * ((grafptr->r.vmlotax != NULL) ? grafptr->r.vmlotax[vertnum] : 1);
-
-    vexxtab[vexxidx].cmigload = (archDomIncl (archptr, &domntab[domnnum], vexxtab[vexxidx].domoptr) == 1) ? 0
-                                 : migcoef * archDomDist (archptr, &domntab[domnnum], vexxtab[vexxidx].domoptr);
-    for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
-      edxxtab[edxxidx].cmiggain = (archDomIncl (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr) == 1) ? 0
-                                   : migcoef * archDomDist (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr);
-      edxxtab[edxxidx].cmiggain -= vexxtab[vexxidx].cmigload;
-      edxxtab[edxxidx].cmigmask = ~0;
-    }
-  }
-
-  if (vexxtab[vexxidx].lockptr == NULL) {         /* If value has to be (re)linked */
-    for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) /* Insert edges to neighbors in gain arrays */
-      kgraphMapFmTablAdd (tablptr, &edxxtab[edxxidx]);
-  }
-
-  return (0);
-}
+#define KGRAPHMAPFMPARTTYPE         MAPPINGDISTTYPEGEN
+#define KGRAPHMAPFMPARTADDNAME      kgraphMapFmPartAddGen
+#define KGRAPHMAPFMPARTADD2NAME     kgraphMapFmPartAdd2Gen
+#include "kgraph_map_fm_part.c"
+#undef KGRAPHMAPFMPARTADD2NAME
+#undef KGRAPHMAPFMPARTADDNAME
+#undef KGRAPHMAPFMPARTTYPE
+
+#define KGRAPHMAPFMPARTTYPE         MAPPINGDISTTYPECMPLT
+#define KGRAPHMAPFMPARTADDNAME      kgraphMapFmPartAddCmplt
+#define KGRAPHMAPFMPARTADD2NAME     kgraphMapFmPartAdd2Cmplt
+#include "kgraph_map_fm_part.c"
+#undef KGRAPHMAPFMPARTADD2NAME
+#undef KGRAPHMAPFMPARTADDNAME
+#undef KGRAPHMAPFMPARTTYPE
+
+#define KGRAPHMAPFMPARTTYPE         MAPPINGDISTTYPEMESH2
+#define KGRAPHMAPFMPARTADDNAME      kgraphMapFmPartAddMesh2
+#define KGRAPHMAPFMPARTADD2NAME     kgraphMapFmPartAdd2Mesh2
+#include "kgraph_map_fm_part.c"
+#undef KGRAPHMAPFMPARTADD2NAME
+#undef KGRAPHMAPFMPARTADDNAME
+#undef KGRAPHMAPFMPARTTYPE
 
 /* This routine doubles the size all of the arrays
 ** involved in handling the hash table and hash
@@ -931,6 +728,335 @@ KgraphMapFmVertex ** const        lockptr)        /*+ Pointer to locked list
   return (0);
 }
 
+/* This routine computes the variation of the
+** communication volume of all parts when
+** moving the given vertex to the given part.
+** The volume of a vertex is the number of
+** distinct parts, other than its own, to
+** which its neighbors belong. Moving a vertex
+** changes its own volume and the volumes of
+** its neighbors, which are recomputed by
+** scanning their adjacency.
+** It returns:
+** - the variation of the total volume : in all cases.
+*/
+
+static
+Gnum
+kgraphMapFmVolDelta (
+const Kgraph * restrict const grafptr,
+const Gnum                    vertnum,            /*+ Vertex to move                       +*/
+const Anum                    partdst,            /*+ Destination part                     +*/
+Gnum * restrict const         cnttab,             /*+ Neighbor count array, zeroed         +*/
+Gnum * restrict const         dlttab,             /*+ Part volume variation array, zeroed +*/
+Anum * restrict const         listtab,            /*+ List of parts whose volume varies    +*/
+Anum * restrict const         listptr)            /*+ Pointer to size of part list         +*/
+{
+  Genum               edgenum;
+  Anum                listnbr;
+  Gnum                voluold;                    /* Volume of vertex before move */
+  Gnum                volunew;                    /* Volume of vertex after move  */
+  Gnum                voludlt;
+
+  const Genum * restrict const  verttax = grafptr->s.verttax;
+  const Genum * restrict const  vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const   edgetax = grafptr->s.edgetax;
+  const Anum * restrict const   parttax = grafptr->m.parttax;
+  const Anum                    partorg = parttax[vertnum];
+
+  for (edgenum = verttax[vertnum], voluold = volunew = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+    Anum                partend;
+
+    partend = parttax[edgetax[edgenum]];
+    if (cnttab[partend] ++ == 0) {                /* If first neighbor in this part */
+      voluold += (partend != partorg) ? 1 : 0;
+      volunew += (partend != partdst) ? 1 : 0;
+    }
+  }
+  for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) /* Reset count array */
+    cnttab[parttax[edgetax[edgenum]]] = 0;
+
+  listnbr = 0;
+  listtab[listnbr ++] = partorg;                  /* Parts of vertex always come first */
+  listtab[listnbr ++] = partdst;
+  dlttab[partorg] -= voluold;
+  dlttab[partdst] += volunew;
+  voludlt = volunew - voluold;
+
+  for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+    Gnum                vertend;
+    Anum                partend;
+    Gnum                voluend;
+    Genum               edgetmp;
+
+    vertend = edgetax[edgenum];
+    partend = parttax[vertend];
+    for (edgetmp = verttax[vertend]; edgetmp < vendtax[vertend]; edgetmp ++)
+      cnttab[parttax[edgetax[edgetmp]]] ++;
+
+    voluend = 0;
+    if ((partend != partorg) && (cnttab[partorg] == 1)) /* If moved vertex was the only neighbor in its part */
+      voluend --;
+    if ((partend != partdst) && (cnttab[partdst] == 0)) /* If moved vertex will be the only neighbor in new part */
+      voluend ++;
+
+    for (edgetmp = verttax[vertend]; edgetmp < vendtax[vertend]; edgetmp ++) /* Reset count array */
+      cnttab[parttax[edgetax[edgetmp]]] = 0;
+
+    if (voluend != 0) {
+      Anum                listnum;
+
+      for (listnum = 0; listnum < listnbr; listnum ++) { /* Search for part in list */
+        if (listtab[listnum] == partend)
+          break;
+      }
+      if (listnum >= listnbr)                     /* If part not yet in list, add it */
+        listtab[listnbr ++] = partend;
+      dlttab[partend] += voluend;
+      voludlt         += voluend;
+    }
+  }
+
+  *listptr = listnbr;
+
+  return (voludlt);
+}
+
+/* This routine refines the current mapping so
+** as to reduce its communication volume rather
+** than its edge cut. Since volume gains depend
+** on the parts of the neighbors of neighbors,
+** which the extended vertex and edge structures
+** of the Fiduccia-Mattheyses algorithm do not
+** record, a greedy scheme is used: at each pass,
+** every frontier vertex is moved to the neighbor
+** part yielding the best exact volume gain, as
+** long as this move does not degrade the
+** objective nor load balance. When the maximum
+** volume per part is minimized, moves must not
+** make any part reach the current maximum, and
+** moves that decrease the volume of a part of
+** maximum volume are preferred.
+** It returns:
+** - 0 : if mapping could be computed.
+** - 1 : on error.
+*/
+
+static
+int
+kgraphMapFmVol (
+Kgraph * restrict const           grafptr,        /*+ Active graph      +*/
+const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
+{
+  Gnum * restrict           comploadmax;          /* Array of maximum imbalances       */
+  Gnum * restrict           voldtab;              /* Communication volumes of parts    */
+  Gnum * restrict           cnttab;               /* Neighbor count array              */
+  Gnum * restrict           dlttab;               /* Part volume variation array       */
+  Gnum * restrict           flagtab;              /* Flag array for candidate parts    */
+  Anum * restrict           listtab;              /* List of parts of varying volume   */
+  Anum * restrict           candtab;              /* List of candidate parts           */
+  Gnum                      volumax;              /* Current maximum part volume       */
+  Gnum                      volunbr;              /* Number of parts of maximum volume */
+  Anum                      domnnum;
+  Gnum                      vertnnd;
+  INT                       passnum;
+
+  const Genum * restrict const  verttax = grafptr->s.verttax;
+  const Genum * restrict const  vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const   velotax = grafptr->s.velotax;
+  const Gnum * restrict const   edgetax = grafptr->s.edgetax;
+  const Anum                    domnnbr = grafptr->m.domnnbr;
+  Anum * restrict const         parttax = grafptr->m.parttax;
+  const Anum * restrict const   pfixtax = grafptr->pfixtax;
+  Gnum * restrict const         comploaddlt = grafptr->comploaddlt;
+
+  grafptr->kbalval = paraptr->deltval;            /* Store last k-way imbalance ratio */
+  kgraphCost (grafptr);                           /* Compute current load imbalances  */
+
+  if (memAllocGroup ((void **) (void *)
+                     &comploadmax, (size_t) (domnnbr * sizeof (Gnum)),
+                     &voldtab,     (size_t) (domnnbr * sizeof (Gnum)),
+                     &cnttab,      (size_t) (domnnbr * sizeof (Gnum)),
+                     &dlttab,      (size_t) (domnnbr * sizeof (Gnum)),
+                     &flagtab,     (size_t) (domnnbr * sizeof (Gnum)),
+                     &listtab,     (size_t) (domnnbr * sizeof (Anum)),
+                     &candtab,     (size_t) (domnnbr * sizeof (Anum)), NULL) == NULL) {
+    errorPrint ("kgraphMapFmVol: out of memory");
+    return (1);
+  }
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+    comploadmax[domnnum] = (Gnum) ((double) grafptr->comploadavg[domnnum] * paraptr->deltval);
+
+  volumax = 0;                                    /* Avoid compiler warnings */
+  volunbr = 0;
+  if (paraptr->typeval == KGRAPHMAPFMTYPEVOLMAX) { /* If part volumes have to be maintained */
+    kgraphCostVol (grafptr, flagtab, voldtab);
+    for (domnnum = 0, volumax = -1; domnnum < domnnbr; domnnum ++) {
+      if (voldtab[domnnum] > volumax) {
+        volumax = voldtab[domnnum];
+        volunbr = 1;
+      }
+      else if (voldtab[domnnum] == volumax)
+        volunbr ++;
+    }
+  }
+
+  memSet (cnttab,  0, domnnbr * sizeof (Gnum));
+  memSet (dlttab,  0, domnnbr * sizeof (Gnum));
+  memSet (flagtab, ~0, domnnbr * sizeof (Gnum));
+
+  vertnnd = grafptr->s.vertnnd;
+  if ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) /* Anchor vertices must not be moved */
+    vertnnd -= domnnbr;
+
+  for (passnum = 0; passnum != paraptr->passnbr; passnum ++) {
+    Gnum                movenbr;
+    Gnum                vertnum;
+
+    for (vertnum = grafptr->s.baseval, movenbr = 0; vertnum < vertnnd; vertnum ++) {
+      Anum                partorg;
+      Anum                partbst;
+      Anum                candnbr;
+      Anum                candnum;
+      Gnum                gainbst;
+      Gnum                baldbst;
+      int                 flagbst;
+      Gnum                veloval;
+      Genum               edgenum;
+
+      if ((pfixtax != NULL) && (pfixtax[vertnum] >= 0)) /* Do not move fixed vertices */
+        continue;
+
+      partorg = parttax[vertnum];
+      for (edgenum = verttax[vertnum], candnbr = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+        Anum                partend;
+
+        partend = parttax[edgetax[edgenum]];
+        if ((partend != partorg) && (flagtab[partend] != vertnum)) { /* If neighbor part not yet recorded */
+          flagtab[partend]    = vertnum;
+          candtab[candnbr ++] = partend;
+        }
+      }
+      if (candnbr == 0)                           /* If vertex does not belong to frontier */
+        continue;
+
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      for (candnum = 0, partbst = -1, gainbst = 0, baldbst = 0, flagbst = 0; candnum < candnbr; candnum ++) {
+        Anum                partdst;
+        Anum                listnbr;
+        Anum                listnum;
+        Gnum                gainval;              /* Decrease of total volume        */
+        Gnum                baldval;              /* Decrease of load imbalance      */
+        Gnum                dltoold;
+        Gnum                dltonew;
+        Gnum                dltdold;
+        Gnum                dltdnew;
+        int                 flagval;              /* Set if maximum volume decreases */
+
+        partdst = candtab[candnum];
+        dltoold = comploaddlt[partorg];
+        dltonew = dltoold - veloval;
+        dltdold = comploaddlt[partdst];
+        dltdnew = dltdold + veloval;
+        baldval = (ABS (dltoold) + ABS (dltdold)) - (ABS (dltonew) + ABS (dltdnew));
+        if (((ABS (dltonew) > comploadmax[partorg]) || /* If move would break load balance */
+             (ABS (dltdnew) > comploadmax[partdst])) &&
+            (baldval <= 0))                       /* And would not improve it either      */
+          continue;
+
+        gainval = - kgraphMapFmVolDelta (grafptr, vertnum, partdst, cnttab, dlttab, listtab, &listnbr);
+
+        flagval = 0;
+        if (paraptr->typeval == KGRAPHMAPFMTYPEVOLMAX) {
+          for (listnum = 0; listnum < listnbr; listnum ++) {
+            Anum                partval;
+            Gnum                voluold;
+            Gnum                volunew;
+
+            partval = listtab[listnum];
+            voluold = voldtab[partval];
+            volunew = voluold + dlttab[partval];
+            if (voluold == volumax) {             /* Parts of maximum volume must not grow */
+              if (volunew > voluold)
+                break;
+              if (volunew < voluold)
+                flagval = 1;
+            }
+            else if (volunew >= volumax)          /* Other parts must not reach maximum volume */
+              break;
+          }
+          if (listnum < listnbr)                  /* If move would increase maximum volume, skip it */
+            gainval = GNUMMIN;
+        }
+        for (listnum = 0; listnum < listnbr; listnum ++) /* Reset volume variation array */
+          dlttab[listtab[listnum]] = 0;
+
+        if ((gainval == GNUMMIN) ||               /* If move is not acceptable */
+            ((flagval == 0) && ((gainval < 0) || ((gainval == 0) && (baldval <= 0)))))
+          continue;
+
+        if ((flagval >  flagbst) ||               /* Keep best move */
+            ((flagval == flagbst) && ((partbst < 0) || (gainval > gainbst) ||
+                                      ((gainval == gainbst) && (baldval > baldbst))))) {
+          partbst = partdst;
+          gainbst = gainval;
+          baldbst = baldval;
+          flagbst = flagval;
+        }
+      }
+      if (partbst < 0)                            /* If no acceptable move found */
+        continue;
+
+      if (paraptr->typeval == KGRAPHMAPFMTYPEVOLMAX) { /* Update part volumes */
+        Anum                listnbr;
+        Anum                listnum;
+
+        kgraphMapFmVolDelta (grafptr, vertnum, partbst, cnttab, dlttab, listtab, &listnbr);
+        for (listnum = 0; listnum < listnbr; listnum ++) {
+          Anum                partval;
+
+          partval = listtab[listnum];
+          if ((voldtab[partval] == volumax) && (dlttab[partval] < 0))
+            volunbr --;
+          voldtab[partval] += dlttab[partval];
+          dlttab[partval]   = 0;
+        }
+        if (volunbr <= 0) {                       /* If no part of maximum volume left, recompute it */
+          for (domnnum = 0, volumax = -1; domnnum < domnnbr; domnnum ++) {
+            if (voldtab[domnnum] > volumax) {
+              volumax = voldtab[domnnum];
+              volunbr = 1;
+            }
+            else if (voldtab[domnnum] == volumax)
+              volunbr ++;
+          }
+        }
+      }
+
+      parttax[vertnum]      = partbst;
+      comploaddlt[partorg] -= veloval;
+      comploaddlt[partbst] += veloval;
+      movenbr ++;
+    }
+    if (movenbr == 0)                             /* If no move done during pass, stop */
+      break;
+  }
+
+  memFree (comploadmax);                          /* Free group leader */
+
+  kgraphFron (grafptr);                           /* Update frontier and costs of modified mapping */
+  kgraphCost (grafptr);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapFmVol: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -963,6 +1089,9 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   Gnum                            cmigload;
   KgraphMapFmTabl * restrict      tablptr;        /* Pointer to gain table for easy access          */
   KgraphMapFmTabl                 tabldat;        /* Gain table                                     */
+  MappingDist                     distdat;        /* Cache of distances between domains             */
+  KgraphMapFmPartAddFunc          partaddptr;     /* Vertex insertion routine for distance type     */
+  KgraphMapFmPartAdd2Func         partad2ptr;     /* Extended edge insertion routine                */
   KgraphMapFmVertex *             lockptr;
   Gnum                            fronnum;
   Gnum                            fronnbr;
@@ -989,17 +1118,18 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   Gnum *                          chektab;        /* Extra memory needed for the check routine      */
 #endif /* SCOTCH_DEBUG_KGRAPH3 */
 
-  const Gnum * restrict const     verttax = grafptr->s.verttax;
-  const Gnum * restrict const     vendtax = grafptr->s.vendtax;
+  const Genum * restrict const     verttax = grafptr->s.verttax;
+  const Genum * restrict const     vendtax = grafptr->s.vendtax;
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Gnum * restrict const     edlotax = grafptr->s.edlotax;
-  const Arch * restrict const     archptr = grafptr->m.archptr;
   const Gnum                      domnnbr = grafptr->m.domnnbr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
   Anum * restrict const           parttax = grafptr->m.parttax;
   Anum * restrict const           parotax = grafptr->r.m.parttax;
   const Gnum * restrict const     pfixtax = grafptr->pfixtax;
 
+  if (paraptr->typeval != KGRAPHMAPFMTYPECUT)     /* If communication volume is to be minimized */
+    return (kgraphMapFmVol (grafptr, paraptr));
+
 #ifdef SCOTCH_DEBUG_KGRAPH3                       /* Allocation of extra memory needed for the check routine */
   if ((chektab = memAlloc (domnnbr * 3 * sizeof(Gnum))) == NULL) {
     errorPrint ("kgraphMapFm: out of memory (1)");
@@ -1090,6 +1220,20 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
       return (1);
     }
   }
+  mapDistInit (&distdat, &grafptr->m, edxxsiz, MAPPINGDISTNONE);
+  switch (distdat.typeval) {                      /* Select specialized routines once and for all */
+    case MAPPINGDISTTYPECMPLT :
+      partaddptr = kgraphMapFmPartAddCmplt;
+      partad2ptr = kgraphMapFmPartAdd2Cmplt;
+      break;
+    case MAPPINGDISTTYPEMESH2 :
+      partaddptr = kgraphMapFmPartAddMesh2;
+      partad2ptr = kgraphMapFmPartAdd2Mesh2;
+      break;
+    default :
+      partaddptr = kgraphMapFmPartAddGen;
+      partad2ptr = kgraphMapFmPartAdd2Gen;
+  }
   memSet (vexxtab, ~0, hashsiz * sizeof (KgraphMapFmVertex)); /* Set all vertex numbers to ~0 */
   memSet (edxxtab, ~0, edxxsiz * sizeof (KgraphMapFmEdge));   /* Set all edge numbers to ~0   */
 
@@ -1098,6 +1242,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     if (kgraphMapFmResize (&vexxtab, &hashmax, &hashmsk, savetab, 0, tablptr, edxxtab, &lockptr) != 0) {
       errorPrint ("kgraphMapFm: out of memory (5)");
       memFree    (vexxtab);                       /* Free group leader */
+      mapDistExit (&distdat);
       kgraphMapFmTablExit (tablptr);
       return (1);
     }
@@ -1111,7 +1256,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     if ((pfixtax == NULL) || (pfixtax[vertnum] == -1)) { /* Add only not fixed vertices */
       for (hashnum = (vertnum * KGRAPHMAPFMHASHPRIME) & hashmsk; vexxtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ;
 
-      kgraphMapFmPartAdd (grafptr, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+      partaddptr (grafptr, &distdat, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
       if (vexxtab[hashnum].edxxidx == -1) {       /* If vertex does not have any neighbor */
@@ -1322,10 +1467,10 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
       Gnum                vexxidx;
       Gnum                edxxtmp;
       Gnum                veloval;
-      Gnum                edgenum;
+      Genum               edgenum;
       Anum                domnnum;
       Gnum                edlosum;
-      Gnum                edgenbr;
+      Genum               edgenbr;
       Anum                domnend;
       Gnum                edxxidx;
       Gnum *              edxpptr;
@@ -1413,7 +1558,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         }
         edxxtab[edxxidx].commgain -= edxxptr->commgain;
         edxxtab[edxxidx].cmiggain -= edxxptr->cmiggain;
-        edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnend], &domntab[domncur]);
+        edxxtab[edxxidx].distval = mapDistGet (&distdat, domnend, domncur);
       }
       edxxptr->commgain = - edxxptr->commgain;
       edxxptr->cmiggain = - edxxptr->cmiggain;
@@ -1474,6 +1619,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           if (kgraphMapFmResize (&vexxtab, &hashmax, &hashmsk, savetab, savenbr, tablptr, edxxtab, &lockptr) != 0) {
             errorPrint ("kgraphMapFm: out of memory (7)");
             memFree    (vexxtab);                 /* Free group leader */
+            mapDistExit (&distdat);
             kgraphMapFmTablExit (tablptr);
             return       (1);
           }
@@ -1482,7 +1628,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
              (vexxtab[vexxend].vertnum != vertend) && (vexxtab[vexxend].vertnum != ~0); vexxend = (vexxend + 1) & hashmsk) ;
 
         if (vexxtab[vexxend].vertnum == ~0) {     /* If neighbor vertex not yet inserted, create it */
-          kgraphMapFmPartAdd (grafptr, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+          partaddptr (grafptr, &distdat, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
           hashnbr ++;                             /* One more vertex in hash table */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           if (vexxtab[vexxend].edxxidx == -1) {
@@ -1619,7 +1765,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Gnum        edxxidx;
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-          kgraphMapFmPartAdd2 (grafptr, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
+          partad2ptr (grafptr, &distdat, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           for (edxxidx = vexxtab[vexxend].edxxidx; (edxxidx != -1) && (edxxtab[edxxidx].domnnum != domnend); edxxidx = edxxtab[edxxidx].edxxidx) ;
           if (edxxidx == -1) {
@@ -1653,8 +1799,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
         edloval *= grafptr->r.crloval;
         for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) /* Update vertex links */
-           edxxtab[edxxend].commgain -= edloval * (divnval - archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnend])
-                                                 - divoval + archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnnum]));
+           edxxtab[edxxend].commgain -= edloval * (divnval - mapDistGet (&distdat, edxxtab[edxxend].domnnum, domnend)
+                                                 - divoval + mapDistGet (&distdat, edxxtab[edxxend].domnnum, domnnum));
         if (vexxtab[vexxend].lockptr == NULL) { /* If vertex is not locked */
           for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) { /* Relink its extended edges */
             kgraphMapFmTablDel (tablptr, &edxxtab[edxxend]); /* Remove it and re-link it                            */
@@ -1744,7 +1890,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   for (vexxidx = fronnbr = 0;                     /* Build new frontier, compute commload, update parttax */
        vexxidx <= hashmsk; vexxidx ++) {          /* hashsiz no longer valid after resizing, so use hashmsk */
     Gnum                vertnum;
-    Gnum                edgenum;
+    Genum               edgenum;
     Anum                domnnum;
     Anum                domnlst;                  /* Domain of last vertex for which a distance was computed */
     Anum                distlst;                  /* Last distance computed                                  */
@@ -1772,7 +1918,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Anum              distval;
           Gnum              edloval;
 
-          distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+          distval = (domnend != domnlst) ? mapDistGet (&distdat, domnnum, domnend) : distlst;
           distlst = distval;
           domnlst = domnend;
           edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1791,7 +1937,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
     for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
       if ((grafptr->pfixtax != NULL) && (grafptr->pfixtax[vertnum] != -1)) { /* If vertex is fixed */
-        Gnum                edgenum;
+        Genum               edgenum;
         Anum                domnnum;
         Gnum                commcut;
         Anum                domnlst;              /* Domain of last vertex for which a distance was computed */
@@ -1811,7 +1957,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
             Anum              distval;
             Gnum              edloval;
 
-            distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+            distval = (domnend != domnlst) ? mapDistGet (&distdat, domnnum, domnend) : distlst;
             distlst = distval;
             domnlst = domnend;
             edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1838,6 +1984,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   memFree (vexxtab);
   memFree (savetab);
   memFree (edxxtab);
+  mapDistExit (&distdat);
   kgraphMapFmTablExit (tablptr);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
@@ -1,4 +1,4 @@
-/* Copyright 2004,2010-2012,2016,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2010-2012,2016,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,6 +48,8 @@
 /**                                 to   : 12 oct 2006     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -75,12 +77,21 @@
 **  The type and structure definitions.
 */
 
+/*+ Objective function types. +*/
+
+typedef enum KgraphMapFmType_ {
+  KGRAPHMAPFMTYPECUT = 0,                         /*+ Weighted edge cut times distance      +*/
+  KGRAPHMAPFMTYPEVOLSUM,                          /*+ Total communication volume            +*/
+  KGRAPHMAPFMTYPEVOLMAX                           /*+ Maximum communication volume per part +*/
+} KgraphMapFmType;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct KgraphMapFmParam_ {
   INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
   INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
   double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
+  KgraphMapFmType           typeval;              /*+ Objective function to minimize                       +*/
 } KgraphMapFmParam;
 
 /*+ The extended edge structure. In fact, this
@@ -161,6 +172,13 @@ typedef struct KgraphMapFmSave_ {
   } u;
 } KgraphMapFmSave;
 
+/*+ The vertex insertion routine types, of
+    which there is one instance per type of
+    distance computation.                   +*/
+
+typedef int (* KgraphMapFmPartAddFunc) (const Kgraph * restrict const, MappingDist * restrict const, const Gnum, const Gnum, KgraphMapFmVertex * restrict const, KgraphMapFmEdge **, Gnum * restrict const, Gnum * restrict const, KgraphMapFmTabl * restrict const);
+typedef int (* KgraphMapFmPartAdd2Func) (const Kgraph * restrict const, MappingDist * restrict const, KgraphMapFmVertex * restrict const, Gnum, KgraphMapFmEdge * restrict * const, Gnum * restrict const, Gnum * restrict const, Anum, Anum, Gnum, KgraphMapFmTabl * restrict const);
+
 /*
 **  The function prototypes.
 */
@@ -179,7 +197,7 @@ int                         kgraphMapFm         (Kgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define kgraphMapFmTablInit(t)      (((*(t)) = gainTablInit (GAINMAX, KGRAPHMAPFMSUBBITS)) == NULL)
+#define kgraphMapFmTablInit(t)      (((*(t)) = gainTablInit (GAINMAX, KGRAPHMAPFMSUBBITS, GAINTABLTYPEFM, NULL)) == NULL)
 #define kgraphMapFmTablFree(t)      gainTablFree (*(t))
 #define kgraphMapFmTablExit(t)      do {                     \
                                       if (*(t) != NULL)      \
@@ -0,0 +1,311 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_fm_part.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                Sebastien FOURESTIER (v6.0)             **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the stub of the    **/
+/**                vertex insertion routines of the k-way  **/
+/**                Fiduccia-Mattheyses mapping refinement, **/
+/**                specialized for each type of distance   **/
+/**                computation.                            **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # This code derives from the code of    **/
+/**                  kgraph_map_fm.c, from which it has    **/
+/**                  been extracted so that distances are  **/
+/**                  computed inline for the architectures **/
+/**                  which allow it.                       **/
+/**                                                        **/
+/************************************************************/
+
+/*****************************/
+/*                           */
+/* The vertex insertion      */
+/* subroutine patterns.      */
+/*                           */
+/*****************************/
+
+/* This routine adds to the given vertex an
+** extended edge towards the given domain,
+** and updates the gains of its other
+** extended edges accordingly.
+** It returns:
+** - 0   : in all cases.
+*/
+
+static
+int
+KGRAPHMAPFMPARTADD2NAME (
+const Kgraph * restrict const       grafptr,
+MappingDist * restrict const        distptr,      /*+ Cache of distances between domains +*/
+KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array   +*/
+Gnum                                vexxidx,
+KgraphMapFmEdge * restrict * const  edxxtabptr,
+Gnum * restrict const               edxxsizptr,
+Gnum * restrict const               edxxnbrptr,
+Anum                                domnnum,      /*+ Vertex domain                      +*/
+Anum                                domnend,      /*+ Domain of the extended edge to add +*/
+Gnum                                edloval,      /*+ Load of the edge to domnend        +*/
+KgraphMapFmTabl * restrict const    tablptr)
+{
+  KgraphMapFmEdge * restrict    edxxtab;
+  Gnum                          edxxidx;
+  Gnum                          edxxtmp;
+  Gnum                          commgain;
+
+  const Arch * restrict const     archptr = grafptr->m.archptr;
+  const ArchDom * restrict const  domntab = grafptr->m.domntab;
+
+  if (*edxxnbrptr >= *edxxsizptr)                 /* If new slot would not fit  */
+    kgraphMapFmEdgeResize (vexxtab, -1, edxxtabptr, edxxsizptr, *edxxnbrptr, tablptr); /* No vexxidx because vertex extended edges will be readd later */
+
+  edxxtab = *edxxtabptr;
+  edxxidx = (*edxxnbrptr) ++;                     /* Allocate new slot */
+
+  edxxtab[edxxidx].domnnum = domnend;             /* Set extended edge data */
+  edxxtab[edxxidx].distval = mapDistGetType (distptr, KGRAPHMAPFMPARTTYPE, domnnum, domnend);
+  edxxtab[edxxidx].edlosum = edloval;
+  edxxtab[edxxidx].edgenbr = 1;
+  edxxtab[edxxidx].vexxidx = vexxidx;
+  edxxtab[edxxidx].mswpnum = 0;
+
+  commgain = 0;                                   /* Compute commgain */
+  for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
+    commgain += edxxtab[edxxtmp].edlosum *
+                (mapDistGetType (distptr, KGRAPHMAPFMPARTTYPE, edxxtab[edxxtmp].domnnum, domnend)
+                - edxxtab[edxxtmp].distval);
+  }
+  commgain += (vexxtab[vexxidx].edlosum - edloval) * edxxtab[edxxidx].distval;
+  edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval;
+
+  edxxtab[edxxidx].edxxidx  = vexxtab[vexxidx].edxxidx; /* Link edge to vertex  */
+  vexxtab[vexxidx].edxxidx  = edxxidx;
+
+  edxxtab[edxxidx].cmiggain = 0;                  /* Compute migration commgain */
+  edxxtab[edxxidx].cmigmask = 0;
+  if (vexxtab[vexxidx].domoptr != NULL) {
+    Gnum                migcoef;                  /* Equal to -migedloval if vertex was mapped in old mapping */
+
+    migcoef = grafptr->r.cmloval * ((grafptr->r.vmlotax != NULL) ? grafptr->r.vmlotax[vexxtab[vexxidx].vertnum] : 1);
+
+    edxxtab[edxxidx].cmiggain = (archDomIncl (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr) == 1) ? 0
+                                : migcoef * archDomDist (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr);
+    edxxtab[edxxidx].cmiggain -= vexxtab[vexxidx].cmigload;
+    edxxtab[edxxidx].cmigmask = ~0;
+  }
+
+  if (vexxtab[vexxidx].lockptr == NULL)           /* If value has to be linked */
+    kgraphMapFmTablAdd (tablptr, &edxxtab[edxxidx]);
+
+  return (0);
+}
+
+/* This routine adds a vertex to hash table,
+** and computes the gains of its extended
+** edges.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+KGRAPHMAPFMPARTADDNAME (
+const Kgraph * restrict const               grafptr,
+MappingDist * restrict const                distptr,  /* Cache of distances between domains  */
+const Gnum                                  vertnum,
+const Gnum                                  vexxidx,  /* Hash value for insertion in vexxtab */
+KgraphMapFmVertex * restrict const          vexxtab,
+KgraphMapFmEdge **                          edxxtabptr,
+Gnum * restrict const                       edxxsizptr,
+Gnum * restrict const                       edxxnbrptr,
+KgraphMapFmTabl * restrict const            tablptr)
+{
+  Gnum                          oldvertnum;       /* Number of current vertex */
+  KgraphMapFmEdge * restrict    edxxtab;
+  Gnum                          edxxidx;
+  Genum                         edgenum;
+  Gnum                          edlosum;
+  Genum                         edgenbr;
+  Anum                          domnnum;
+  Gnum                          commload;         /* Communication load for local domain */
+
+  const Genum * restrict const     verttax = grafptr->s.verttax;
+  const Genum * restrict const     vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
+  const Arch * restrict const     archptr = grafptr->m.archptr;
+  const ArchDom * restrict const  domntab = grafptr->m.domntab;
+  const Anum * restrict const     parttax = grafptr->m.parttax;
+  const Anum * restrict const     parotax = grafptr->r.m.parttax;
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (vexxtab[vexxidx].vertnum != ~0) {
+    errorPrint ("kgraphMapFmPartAdd: internal error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  domnnum = parttax[vertnum];
+
+  vexxtab[vexxidx].vertnum = vertnum;
+  vexxtab[vexxidx].domnnum = domnnum;
+  vexxtab[vexxidx].veloval = (grafptr->s.velotax != NULL) ? grafptr->s.velotax[vertnum] : 1; /* Vertex will be linked since value is positive */
+  vexxtab[vexxidx].mswpnum = 0;                   /* Implicitly set slot as used */
+  vexxtab[vexxidx].edxxidx = -1;                  /* No target domains yet       */
+  vexxtab[vexxidx].lockptr = NULL;                /* No locked yet               */
+
+  oldvertnum = ((grafptr->s.vnumtax != NULL) &&   /* If there is ancestor graph vertex numbers           */
+                (grafptr->s.flagval & KGRAPHHASANCHORS) == 0) /* That are not the ones of the band graph */
+               ? grafptr->s.vnumtax[vertnum] : vertnum; /* Get vertex number in original graph           */
+
+  if ((parotax != NULL) &&                        /* If we are doing a repartitioning                                     */
+      (parotax[oldvertnum] != -1))                /* And if vertex was mapped to an old domain                            */
+    vexxtab[vexxidx].domoptr = mapDomain (&grafptr->r.m, oldvertnum); /* Domain in which the vertex was previously mapped */
+  else
+    vexxtab[vexxidx].domoptr = NULL;
+
+  edxxtab = *edxxtabptr;                          /* Compute and link edges */
+  edgenbr = 0;
+
+  for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
+    Gnum                domnend;
+
+    domnend = edxxtab[edxxidx].domnnum;
+    edxxtab[edxxidx].edlosum = 0;
+    edxxtab[edxxidx].edgenbr = 0;
+    edxxtab[edxxidx].distval = mapDistGetType (distptr, KGRAPHMAPFMPARTTYPE, domnnum, domnend);
+  }
+
+  commload = 0;                                   /* Load associated with vertex edges */
+  edlosum  = 0;
+  for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+    Gnum                edxxidx;
+    Gnum                vertend;
+    Anum                domnend;
+    Gnum                edloval;
+
+    vertend = edgetax[edgenum];
+    domnend = parttax[vertend];
+
+    edloval = (edlotax != NULL) ? edlotax[edgenum] : 1; /* Do not account for crloval yet */
+
+    if (domnend == domnnum) {                     /* If end vertex belongs to same domain */
+      edlosum += edloval;                         /* Record local edge load sum           */
+      edgenbr ++;                                 /* Record local edge                    */
+      continue;                                   /* Skip further processing              */
+    }
+
+    for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) { /* Search for edge */
+      if (edxxtab[edxxidx].domnnum == domnend)    /* If edge slot found */
+        break;
+    }
+
+    if (edxxidx == -1) {                          /* If edge slot not found    */
+      if (*edxxnbrptr >= *edxxsizptr)             /* If new slot would not fit */
+        kgraphMapFmEdgeResize (vexxtab, vexxidx, edxxtabptr, edxxsizptr, *edxxnbrptr, tablptr);
+
+      edxxidx = (*edxxnbrptr) ++;                 /* Allocate new slot */
+      edxxtab = *edxxtabptr;                      /* Update edxxtab    */
+
+      edxxtab[edxxidx].commgain = 0;
+      edxxtab[edxxidx].cmiggain = 0;
+      edxxtab[edxxidx].cmigmask = (parotax != NULL) ? ~0 : 0;
+      edxxtab[edxxidx].domnnum  = domnend;
+      edxxtab[edxxidx].distval  = mapDistGetType (distptr, KGRAPHMAPFMPARTTYPE, domnnum, domnend);
+      edxxtab[edxxidx].edlosum  = 0;
+      edxxtab[edxxidx].edgenbr  = 0;
+      edxxtab[edxxidx].vexxidx  = vexxidx;
+      edxxtab[edxxidx].edxxidx  = vexxtab[vexxidx].edxxidx; /* Link edge to vertex */
+      vexxtab[vexxidx].edxxidx  = edxxidx;
+      edxxtab[edxxidx].mswpnum  = 0;
+    }
+
+    commload += edloval * edxxtab[edxxidx].distval;
+    edxxtab[edxxidx].edlosum += edloval;
+    edxxtab[edxxidx].edgenbr ++;
+  }
+  commload *= grafptr->r.crloval;                 /* Multiply all local loads by crloval */
+  vexxtab[vexxidx].edlosum = edlosum;
+  vexxtab[vexxidx].edgenbr = edgenbr;
+
+  for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
+    Gnum                domncur;
+    Gnum                edxxtmp;
+    Gnum                commgain;
+
+    domncur = edxxtab[edxxidx].domnnum;
+
+    commgain = 0;
+    for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
+      Anum                domnend;
+
+      if (edxxtmp == edxxidx)
+        continue;
+
+      domnend = edxxtab[edxxtmp].domnnum;
+      commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
+                  mapDistGetType (distptr, KGRAPHMAPFMPARTTYPE, domncur, domnend);
+    }
+    commgain += vexxtab[vexxidx].edlosum * edxxtab[edxxidx].distval;
+    edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
+  }
+
+  vexxtab[vexxidx].cmigload = 0;
+  if (vexxtab[vexxidx].domoptr != NULL) {
+    Gnum                migcoef;                  /* Equal to -migedloval if vertex was mapped in old mapping */
+
+    migcoef = grafptr->r.cmloval * ((grafptr->r.vmlotax != NULL) ? grafptr->r.vmlotax[vertnum] : 1);
+
+    vexxtab[vexxidx].cmigload = (archDomIncl (archptr, &domntab[domnnum], vexxtab[vexxidx].domoptr) == 1) ? 0
+                                 : migcoef * archDomDist (archptr, &domntab[domnnum], vexxtab[vexxidx].domoptr);
+    for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
+      edxxtab[edxxidx].cmiggain = (archDomIncl (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr) == 1) ? 0
+                                   : migcoef * archDomDist (archptr, &domntab[edxxtab[edxxidx].domnnum], vexxtab[vexxidx].domoptr);
+      edxxtab[edxxidx].cmiggain -= vexxtab[vexxidx].cmigload;
+      edxxtab[edxxidx].cmigmask = ~0;
+    }
+  }
+
+  if (vexxtab[vexxidx].lockptr == NULL) {         /* If value has to be (re)linked */
+    for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) /* Insert edges to neighbors in gain arrays */
+      kgraphMapFmTablAdd (tablptr, &edxxtab[edxxidx]);
+  }
+
+  return (0);
+}
@@ -0,0 +1,707 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_jt.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a k-way mapping of  **/
+/**                the given mapping graph by means of a   **/
+/**                multithreaded synchronous refinement    **/
+/**                algorithm: in each pass, all threads    **/
+/**                compute in parallel the best move of    **/
+/**                their vertices, filter out the moves    **/
+/**                which conflict with better neighboring  **/
+/**                moves, apply the remaining ones, and    **/
+/**                rebalance overloaded domains.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KGRAPH_MAP_JT
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_jt.h"
+
+/*************************/
+/*                       */
+/* The gain subroutines. */
+/*                       */
+/*************************/
+
+/* This routine computes the migration cost
+** of the given vertex when it is mapped onto
+** the given domain.
+** It returns:
+** - the migration cost : in all cases.
+*/
+
+static
+Gnum
+kgraphMapJtMigr (
+const Kgraph * restrict const grafptr,
+const Gnum                    vertnum,
+const Anum                    domnnum)
+{
+  const ArchDom * restrict  domoptr;              /* Domain of vertex in old mapping */
+  Gnum                      vertold;              /* Number of vertex in old mapping */
+
+  const Arch * restrict const     archptr = grafptr->m.archptr;
+  const Anum * restrict const     parotax = grafptr->r.m.parttax;
+
+  if (parotax == NULL)                            /* If not doing a repartitioning */
+    return (0);
+
+  vertold = ((grafptr->s.vnumtax != NULL) &&      /* If there are ancestor graph vertex numbers           */
+             ((grafptr->s.flagval & KGRAPHHASANCHORS) == 0)) /* That are not the ones of the band graph */
+            ? grafptr->s.vnumtax[vertnum] : vertnum;
+  if (parotax[vertold] == -1)                     /* If vertex was not mapped in old mapping */
+    return (0);
+
+  domoptr = mapDomain (&grafptr->r.m, vertold);
+  if (archDomIncl (archptr, &grafptr->m.domntab[domnnum], domoptr) == 1)
+    return (0);
+
+  return (grafptr->r.cmloval * ((grafptr->r.vmlotax != NULL) ? grafptr->r.vmlotax[vertnum] : 1) *
+          (Gnum) archDomDist (archptr, &grafptr->m.domntab[domnnum], domoptr));
+}
+
+/* This routine computes the best move of
+** the given vertex to one of the domains of
+** its neighbors. If load arrays are given,
+** only domains which can receive the vertex
+** without exceeding their maximum load, or
+** which would remain less overloaded than the
+** current domain of the vertex, are considered.
+** The sum of the loads of the edges linking
+** the vertex to its own domain is also
+** returned in *edloptr.
+** It returns:
+** - GNUMMAX : if no move is possible.
+** - gain    : the cost variation of the best
+**             move, the destination domain of
+**             which is set in *domnptr.
+*/
+
+static
+Gnum
+kgraphMapJtBest (
+const Kgraph * restrict const           grafptr,
+MappingDist * restrict const            distptr,  /*+ Cache of domain distances        +*/
+const KgraphMapJtWork * restrict const  workptr,  /*+ Thread work area                   +*/
+const Gnum                              vertnum,
+const Gnum * restrict const             comploaddlt, /*+ Current load imbalances, or NULL +*/
+const Gnum * restrict const             comploadmax, /*+ Maximum load imbalances          +*/
+Anum * restrict const                   domnptr,  /*+ Pointer to best destination domain +*/
+Gnum * restrict const                   edloptr)  /*+ Pointer to internal edge load      +*/
+{
+  Anum                      listnbr;              /* Number of neighbor domains      */
+  Anum                      listnum;
+  Anum                      partval;              /* Current domain of vertex        */
+  Anum                      domnbst;              /* Best destination domain         */
+  Gnum                      gainbst;              /* Gain of best move               */
+  Gnum                      commcur;              /* Communication load in current domain */
+  Gnum                      migrcur;              /* Migration load in current domain     */
+  Gnum                      veloval;
+  Genum                     edgenum;
+
+  const Genum * restrict const    verttax = grafptr->s.verttax;
+  const Genum * restrict const    vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
+  const Anum * restrict const     parttax = grafptr->m.parttax;
+  Gnum * restrict const           edlotab = workptr->edlotab;
+  Anum * restrict const           listtab = workptr->domntab;
+
+  partval = parttax[vertnum];
+  for (edgenum = verttax[vertnum], listnbr = 0;   /* Accumulate edge loads per neighbor domain */
+       edgenum < vendtax[vertnum]; edgenum ++) {
+    Anum                domnend;
+
+    domnend = parttax[edgetax[edgenum]];
+    if (edlotab[domnend] < 0) {                   /* If domain not yet recorded */
+      edlotab[domnend]    = 0;
+      listtab[listnbr ++] = domnend;
+    }
+    edlotab[domnend] += (edlotax != NULL) ? edlotax[edgenum] : 1;
+  }
+
+  domnbst = -1;
+  gainbst = GNUMMAX;
+  if ((listnbr > 1) || ((listnbr == 1) && (listtab[0] != partval))) { /* If vertex is in the frontier */
+    veloval = (grafptr->s.velotax != NULL) ? grafptr->s.velotax[vertnum] : 1;
+
+    for (listnum = 0, commcur = 0; listnum < listnbr; listnum ++) {
+      if (listtab[listnum] != partval)
+        commcur += edlotab[listtab[listnum]] * (Gnum) mapDistGet (distptr, partval, listtab[listnum]);
+    }
+    migrcur = kgraphMapJtMigr (grafptr, vertnum, partval);
+
+    for (listnum = 0; listnum < listnbr; listnum ++) {
+      Anum                domncnd;                /* Candidate destination domain */
+      Anum                listtmp;
+      Gnum                commnew;
+      Gnum                gainval;
+
+      domncnd = listtab[listnum];
+      if ((domncnd == partval) ||
+          ((comploaddlt != NULL) &&               /* Destination must not be overloaded, or less than source is */
+           ((comploaddlt[domncnd] + veloval) > comploadmax[domncnd]) &&
+           ((comploaddlt[domncnd] + veloval) >= comploaddlt[partval])))
+        continue;
+
+      for (listtmp = 0, commnew = 0; listtmp < listnbr; listtmp ++) {
+        if (listtab[listtmp] != domncnd)
+          commnew += edlotab[listtab[listtmp]] * (Gnum) mapDistGet (distptr, domncnd, listtab[listtmp]);
+      }
+      gainval = (commnew - commcur) * grafptr->r.crloval + kgraphMapJtMigr (grafptr, vertnum, domncnd) - migrcur;
+      if ((gainval < gainbst) ||                  /* Keep best move, breaking ties by domain number */
+          ((gainval == gainbst) && (domncnd < domnbst))) {
+        gainbst = gainval;
+        domnbst = domncnd;
+      }
+    }
+  }
+
+  *edloptr = (edlotab[partval] < 0) ? 0 : edlotab[partval];
+  for (listnum = 0; listnum < listnbr; listnum ++) /* Reset work area for next vertex */
+    edlotab[listtab[listnum]] = -1;
+
+  *domnptr = domnbst;
+  return (gainbst);
+}
+
+/* This routine recomputes the gain of the
+** candidate move of the given vertex, assuming
+** that all its neighbors the candidate moves of
+** which have a better gain, or an equal gain
+** and a smaller vertex number, have already
+** been performed. This priority order makes
+** the result independent of the number of
+** threads.
+** It returns:
+** - gain : the updated gain of the move.
+*/
+
+static
+Gnum
+kgraphMapJtFilt (
+const Kgraph * restrict const           grafptr,
+KgraphMapJtData * restrict const        loopptr,
+const Gnum                              vertnum)
+{
+  Anum                      partval;              /* Current domain of vertex     */
+  Anum                      domnnew;              /* Candidate destination domain */
+  Gnum                      gainval;              /* Gain of candidate move       */
+  Gnum                      commdlt;              /* Communication load variation */
+  Genum                     edgenum;
+
+  const Genum * restrict const    verttax = grafptr->s.verttax;
+  const Genum * restrict const    vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
+  const Anum * restrict const     parttax = grafptr->m.parttax;
+  const Anum * restrict const     movetax = loopptr->movetax;
+  const Gnum * restrict const     gaintax = loopptr->gaintax;
+
+  partval = parttax[vertnum];
+  domnnew = movetax[vertnum];
+  gainval = gaintax[vertnum];
+  for (edgenum = verttax[vertnum], commdlt = 0;
+       edgenum < vendtax[vertnum]; edgenum ++) {
+    Gnum                vertend;
+    Anum                domnend;
+    Gnum                edloval;
+
+    vertend = edgetax[edgenum];
+    domnend = parttax[vertend];
+    if ((movetax[vertend] >= 0) &&                /* If neighbor has a move of higher priority, assume it is done */
+        ((gaintax[vertend] < gainval) ||
+         ((gaintax[vertend] == gainval) && (vertend < vertnum))))
+      domnend = movetax[vertend];
+
+    edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+    if (domnend != domnnew)
+      commdlt += edloval * (Gnum) mapDistGet (&loopptr->distdat, domnnew, domnend);
+    if (domnend != partval)
+      commdlt -= edloval * (Gnum) mapDistGet (&loopptr->distdat, partval, domnend);
+  }
+
+  return (commdlt * grafptr->r.crloval + kgraphMapJtMigr (grafptr, vertnum, domnnew) - kgraphMapJtMigr (grafptr, vertnum, partval));
+}
+
+/* This routine computes the communication
+** and migration loads of the given vertex
+** range. Communication loads are accounted
+** for on both ends of every edge.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapJtCost (
+const Kgraph * restrict const       grafptr,
+MappingDist * restrict const        distptr,
+const Gnum                          vertbas,
+const Gnum                          vertnnd,
+KgraphMapJtThread * restrict const  thrdptr)
+{
+  Gnum                      vertnum;
+  Gnum                      commload;
+  Gnum                      cmigload;
+
+  const Genum * restrict const    verttax = grafptr->s.verttax;
+  const Genum * restrict const    vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
+  const Anum * restrict const     parttax = grafptr->m.parttax;
+
+  for (vertnum = vertbas, commload = cmigload = 0; vertnum < vertnnd; vertnum ++) {
+    Anum                partval;
+    Anum                domnlst;                  /* Domain of last vertex for which a distance was computed */
+    Anum                distlst;                  /* Last distance computed                                  */
+    Genum               edgenum;
+
+    partval = parttax[vertnum];
+    domnlst = -1;
+    distlst = 0;
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Anum                domnend;
+
+      domnend = parttax[edgetax[edgenum]];
+      if (domnend != partval) {
+        if (domnend != domnlst) {
+          distlst = mapDistGet (distptr, partval, domnend);
+          domnlst = domnend;
+        }
+        commload += (Gnum) distlst * ((edlotax != NULL) ? edlotax[edgenum] : 1);
+      }
+    }
+    cmigload += kgraphMapJtMigr (grafptr, vertnum, partval);
+  }
+
+  thrdptr->commload = commload;
+  thrdptr->cmigload = cmigload;
+}
+
+/* This routine computes the sum of the load
+** overloads of all domains with respect to
+** their maximum load imbalance.
+** It returns:
+** - the load excess : in all cases.
+*/
+
+static
+Gnum
+kgraphMapJtExcs (
+const Gnum * restrict const comploaddlt,
+const Gnum * restrict const comploadmax,
+const Anum                  domnnbr)
+{
+  Anum                domnnum;
+  Gnum                loadexc;
+
+  for (domnnum = 0, loadexc = 0; domnnum < domnnbr; domnnum ++) {
+    Gnum                loadtmp;
+
+    loadtmp = comploaddlt[domnnum] - comploadmax[domnnum];
+    if (loadtmp > 0)
+      loadexc += loadtmp;
+  }
+
+  return (loadexc);
+}
+
+/*****************************/
+/*                           */
+/* The threaded loop routine */
+/*                           */
+/*****************************/
+
+/* This routine performs the refinement passes
+** on the given range of vertices. All threads
+** take the same decisions, based on data which
+** are reduced in the same order by all of them.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapJtLoop (
+ThreadDescriptor * restrict const descptr,
+KgraphMapJtData * restrict const  loopptr)
+{
+  KgraphMapJtWork           workdat;              /* Work area for gain computations            */
+  Gnum * restrict           comptab;              /* Load variations of local moves             */
+  Gnum                      vertbas;              /* Range of non-anchor vertices to process    */
+  Gnum                      vertnnd;
+  Gnum                      verttnd;              /* End of range for cost computations         */
+  Gnum                      vertnum;
+  Anum                      domnbas;              /* Range of domains to process for reductions */
+  Anum                      domnnnd;
+  Anum                      domnnum;
+  Gnum                      commload;             /* Loads of current mapping                   */
+  Gnum                      cmigload;
+  Gnum                      loadexc;
+  INT                       passnum;
+  int                       stalnbr;              /* Number of passes without improvement       */
+  int                       bestflag;             /* Flag set if current mapping is the best    */
+  int                       thrdtmp;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  Kgraph * restrict const             grafptr = loopptr->grafptr;
+  KgraphMapJtThread * restrict const  thrdtab = loopptr->thrdtab;
+  KgraphMapJtThread * restrict const  thrdptr = &thrdtab[thrdnum];
+  const Gnum                          baseval = grafptr->s.baseval;
+  const Gnum                          vancnbr = loopptr->vancnnd - baseval;
+  const Anum                          domnnbr = grafptr->m.domnnbr;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Anum * restrict const         pfixtax = grafptr->pfixtax;
+  Anum * restrict const               parttax = grafptr->m.parttax;
+  Anum * restrict const               movetax = loopptr->movetax;
+  Gnum * restrict const               gaintax = loopptr->gaintax;
+  GraphPart * restrict const          flagtax = loopptr->flagtax;
+  Anum * restrict const               partbst = loopptr->partbst;
+  Gnum * restrict const               sorttab = loopptr->sorttab;
+  Gnum * restrict const               comploaddlt = grafptr->comploaddlt;
+  const Gnum * restrict const         comploadmax = loopptr->comploadmax;
+
+  vertbas = baseval + DATASCAN (vancnbr, thrdnbr, thrdnum);
+  vertnnd = baseval + DATASCAN (vancnbr, thrdnbr, thrdnum + 1);
+  verttnd = (thrdnum == (thrdnbr - 1)) ? grafptr->s.vertnnd : vertnnd; /* Last thread also accounts for anchors */
+  domnbas = DATASCAN (domnnbr, thrdnbr, thrdnum);
+  domnnnd = DATASCAN (domnnbr, thrdnbr, thrdnum + 1);
+
+  if (memAllocGroup ((void **) (void *)           /* Allocate here for memory affinity */
+                     &workdat.edlotab, (size_t) (domnnbr * sizeof (Gnum)),
+                     &workdat.domntab, (size_t) (domnnbr * sizeof (Anum)),
+                     &comptab,         (size_t) (domnnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kgraphMapJtLoop: out of memory");
+    workdat.edlotab  = NULL;
+    loopptr->abrtval = 1;
+  }
+  else {
+    memSet (workdat.edlotab, ~0, domnnbr * sizeof (Gnum)); /* No domain recorded yet */
+    memSet (comptab,          0, domnnbr * sizeof (Gnum));
+    memCpy (partbst + vertbas, parttax + vertbas, (vertnnd - vertbas) * sizeof (Anum)); /* Initial mapping is the best so far */
+  }
+  thrdptr->comptab = comptab;
+  kgraphMapJtCost (grafptr, &loopptr->distdat, vertbas, verttnd, thrdptr);
+
+  threadBarrier (descptr);                        /* Wait until all threads have allocated their data */
+
+  if (loopptr->abrtval != 0)                      /* If any thread decided to quit */
+    goto abort;
+
+  if (thrdnum == 0) {                             /* Record state of initial mapping */
+    for (thrdtmp = 0, commload = cmigload = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+      commload += thrdtab[thrdtmp].commload;
+      cmigload += thrdtab[thrdtmp].cmigload;
+    }
+    loopptr->commload = commload / 2;
+    loopptr->cmigload = cmigload;
+    loopptr->loadexc  = kgraphMapJtExcs (comploaddlt, comploadmax, domnnbr);
+  }
+  bestflag = 1;
+
+  for (passnum = 0, stalnbr = 0;
+       (passnum < loopptr->paraptr->passnbr) && (stalnbr < KGRAPHMAPJTSTALNBR); passnum ++) {
+    Gnum                movenbr;                  /* Number of moves of the pass */
+    int                 balnum;
+
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* Compute candidate moves */
+      Anum                domnnew;
+      Gnum                gainval;
+      Gnum                edloval;
+
+      movetax[vertnum] = -1;
+      if ((pfixtax != NULL) && (pfixtax[vertnum] != -1)) /* Fixed vertices never move */
+        continue;
+
+      gainval = kgraphMapJtBest (grafptr, &loopptr->distdat, &workdat, vertnum, NULL, NULL, &domnnew, &edloval);
+      if ((domnnew >= 0) &&                       /* Keep improving moves and slightly worsening ones */
+          ((gainval < 0) || ((gainval * KGRAPHMAPJTLOSSDIV) < (edloval * grafptr->r.crloval)))) {
+        movetax[vertnum] = domnnew;
+        gaintax[vertnum] = gainval;
+      }
+    }
+
+    threadBarrier (descptr);                      /* Wait until all candidate moves are known */
+
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Filter out conflicting moves */
+      flagtax[vertnum] = ((movetax[vertnum] >= 0) && (kgraphMapJtFilt (grafptr, loopptr, vertnum) < 0)) ? 1 : 0;
+
+    threadBarrier (descptr);                      /* Wait until all moves are decided */
+
+    for (vertnum = vertbas, movenbr = 0; vertnum < vertnnd; vertnum ++) { /* Perform moves */
+      Anum                partval;
+      Gnum                veloval;
+
+      if (flagtax[vertnum] == 0)
+        continue;
+
+      partval = parttax[vertnum];
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      parttax[vertnum]  = movetax[vertnum];
+      comptab[partval] -= veloval;
+      comptab[movetax[vertnum]] += veloval;
+      movenbr ++;
+    }
+    thrdptr->movenbr = movenbr;
+
+    threadBarrier (descptr);                      /* Wait until all moves are performed */
+
+    for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) { /* Reduce load variations */
+      for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++)
+        comploaddlt[domnnum] += thrdtab[thrdtmp].comptab[domnnum];
+    }
+    for (thrdtmp = 0, movenbr = 0; thrdtmp < thrdnbr; thrdtmp ++)
+      movenbr += thrdtab[thrdtmp].movenbr;
+
+    threadBarrier (descptr);                      /* Wait until loads are up to date */
+
+    memSet (comptab, 0, domnnbr * sizeof (Gnum));
+
+    for (balnum = 0; balnum < KGRAPHMAPJTBALNBR; balnum ++) { /* Rebalancing rounds */
+      Gnum * restrict     sortptr;
+      Gnum                candnbr;
+
+      if (kgraphMapJtExcs (comploaddlt, comploadmax, domnnbr) == 0) /* If mapping is balanced */
+        break;
+
+      for (vertnum = vertbas, candnbr = 0, sortptr = sorttab + 2 * (vertbas - baseval); /* Compute least costly moves out of overloaded domains */
+           vertnum < vertnnd; vertnum ++) {
+        Anum                partval;
+        Anum                domnnew;
+        Gnum                gainval;
+        Gnum                edloval;
+
+        partval = parttax[vertnum];
+        if ((comploaddlt[partval] <= comploadmax[partval]) ||
+            ((pfixtax != NULL) && (pfixtax[vertnum] != -1)))
+          continue;
+
+        gainval = kgraphMapJtBest (grafptr, &loopptr->distdat, &workdat, vertnum, comploaddlt, comploadmax, &domnnew, &edloval);
+        if (domnnew >= 0) {
+          movetax[vertnum] = domnnew;
+          sortptr[2 * candnbr]     = gainval;
+          sortptr[2 * candnbr + 1] = vertnum;
+          candnbr ++;
+        }
+      }
+      thrdptr->candnbr = candnbr;
+
+      threadBarrier (descptr);                    /* Wait until all candidates are known */
+
+      if (thrdnum == 0) {                         /* First thread performs the moves in ascending loss order */
+        Gnum                sortnbr;
+        Gnum                sortnum;
+
+        for (thrdtmp = 1, sortnbr = thrdtab[0].candnbr; thrdtmp < thrdnbr; thrdtmp ++) { /* Gather candidate arrays */
+          memMov (sorttab + 2 * sortnbr, sorttab + 2 * DATASCAN (vancnbr, thrdnbr, thrdtmp),
+                  2 * thrdtab[thrdtmp].candnbr * sizeof (Gnum));
+          sortnbr += thrdtab[thrdtmp].candnbr;
+        }
+        intSort2asc2 (sorttab, sortnbr);
+
+        for (sortnum = 0, loopptr->movenbr = 0; sortnum < sortnbr; sortnum ++) {
+          Anum                partval;
+          Anum                domnnew;
+          Gnum                veloval;
+
+          vertnum = sorttab[2 * sortnum + 1];
+          partval = parttax[vertnum];
+          domnnew = movetax[vertnum];
+          veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+          if ((comploaddlt[partval] <= comploadmax[partval]) || /* If source is no longer overloaded   */
+              (((comploaddlt[domnnew] + veloval) > comploadmax[domnnew]) && /* Or destination would become more so */
+               ((comploaddlt[domnnew] + veloval) >= comploaddlt[partval])))
+            continue;
+
+          parttax[vertnum]      = domnnew;
+          comploaddlt[partval] -= veloval;
+          comploaddlt[domnnew] += veloval;
+          loopptr->movenbr ++;
+        }
+      }
+
+      threadBarrier (descptr);                    /* Wait until rebalancing moves are performed */
+
+      if (loopptr->movenbr == 0)                  /* If no progress can be made */
+        break;
+      movenbr += loopptr->movenbr;
+    }
+
+    if (movenbr == 0)                             /* If mapping has not changed, it will not change any longer */
+      break;
+
+    kgraphMapJtCost (grafptr, &loopptr->distdat, vertbas, verttnd, thrdptr);
+
+    threadBarrier (descptr);                      /* Wait until all partial loads are known */
+
+    for (thrdtmp = 0, commload = cmigload = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+      commload += thrdtab[thrdtmp].commload;
+      cmigload += thrdtab[thrdtmp].cmigload;
+    }
+    commload /= 2;
+    loadexc   = kgraphMapJtExcs (comploaddlt, comploadmax, domnnbr);
+    bestflag  = ((loadexc < loopptr->loadexc) ||  /* Compare on load excess first, then on cost */
+                 ((loadexc == loopptr->loadexc) &&
+                  ((commload * grafptr->r.crloval + cmigload) < (loopptr->commload * grafptr->r.crloval + loopptr->cmigload)))) ? 1 : 0;
+
+    threadBarrier (descptr);                      /* Wait until all threads have read state of best mapping */
+
+    if (bestflag != 0) {                          /* If current mapping is the best so far, record it */
+      memCpy (partbst + vertbas, parttax + vertbas, (vertnnd - vertbas) * sizeof (Anum));
+      if (thrdnum == 0) {
+        loopptr->commload = commload;
+        loopptr->cmigload = cmigload;
+        loopptr->loadexc  = loadexc;
+      }
+      stalnbr = 0;
+    }
+    else
+      stalnbr ++;
+  }
+
+  if (bestflag == 0)                              /* If last mapping is not the best, restore best one */
+    memCpy (parttax + vertbas, partbst + vertbas, (vertnnd - vertbas) * sizeof (Anum));
+
+abort :
+  if (workdat.edlotab != NULL)
+    memFree (workdat.edlotab);                    /* Free group leader of local arrays */
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine refines the current k-way
+** mapping of the given mapping graph. Since
+** it is a refinement method, it does nothing
+** when the mapping has fewer than two domains.
+** It returns:
+** - 0 : if the mapping could be computed.
+** - 1 : on error.
+*/
+
+int
+kgraphMapJt (
+Kgraph * restrict const           grafptr,        /*+ Active graph      +*/
+const KgraphMapJtParam * const    paraptr)        /*+ Method parameters +*/
+{
+  KgraphMapJtData     loopdat;
+  Gnum                vertnum;
+  Anum                domnnum;
+  int                 thrdnbr;
+
+  const Anum          domnnbr = grafptr->m.domnnbr;
+  const Gnum          vertnbr = grafptr->s.vertnbr;
+  const Gnum          baseval = grafptr->s.baseval;
+
+  grafptr->kbalval = paraptr->deltval;            /* Store last k-way imbalance ratio */
+
+  if ((domnnbr < 2) || (paraptr->passnbr <= 0))   /* If nothing to refine */
+    return (0);
+
+#ifdef SCOTCH_PTHREAD
+  thrdnbr = contextThreadNbr (grafptr->contptr);
+#else /* SCOTCH_PTHREAD */
+  thrdnbr = 1;
+#endif /* SCOTCH_PTHREAD */
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab,     (size_t) (thrdnbr     * sizeof (KgraphMapJtThread)),
+                     &loopdat.movetax,     (size_t) (vertnbr     * sizeof (Anum)),
+                     &loopdat.gaintax,     (size_t) (vertnbr     * sizeof (Gnum)),
+                     &loopdat.partbst,     (size_t) (vertnbr     * sizeof (Anum)),
+                     &loopdat.sorttab,     (size_t) (vertnbr * 2 * sizeof (Gnum)),
+                     &loopdat.comploadmax, (size_t) (domnnbr     * sizeof (Gnum)),
+                     &loopdat.flagtax,     (size_t) (vertnbr     * sizeof (GraphPart)), NULL) == NULL) {
+    errorPrint ("kgraphMapJt: out of memory");
+    return (1);
+  }
+
+  kgraphCost (grafptr);                           /* Make sure loads are consistent with current mapping */
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+    loopdat.comploadmax[domnnum] = (Gnum) ((double) grafptr->comploadavg[domnnum] * paraptr->deltval);
+
+  loopdat.grafptr  = grafptr;
+  loopdat.paraptr  = paraptr;
+  loopdat.movetax -= baseval;
+  loopdat.gaintax -= baseval;
+  loopdat.partbst -= baseval;
+  loopdat.flagtax -= baseval;
+  loopdat.vancnnd  = ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) ? (grafptr->s.vertnnd - domnnbr) : grafptr->s.vertnnd; /* Anchors never move */
+  loopdat.abrtval  = 0;
+  mapDistInit (&loopdat.distdat, &grafptr->m, grafptr->s.edgenbr * paraptr->passnbr, MAPPINGDISTSHARED);
+  for (vertnum = loopdat.vancnnd; vertnum < grafptr->s.vertnnd; vertnum ++) /* Anchors have no candidate move */
+    loopdat.movetax[vertnum] = -1;
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapJtLoop, (void *) &loopdat);
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+  mapDistExit (&loopdat.distdat);
+
+  kgraphFron (grafptr);                           /* Mapping may have been partially updated before abort */
+  kgraphCost (grafptr);
+
+  if (loopdat.abrtval != 0)
+    return (1);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapJt: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
@@ -0,0 +1,136 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_jt.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declaration    **/
+/**                for the multithreaded synchronous k-way **/
+/**                refinement mapping routine.             **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Number of passes without improvement
+    of the best mapping before stopping.  +*/
+
+#define KGRAPHMAPJTSTALNBR          3
+
+/*+ Maximum number of rebalancing rounds
+    per pass.                             +*/
+
+#define KGRAPHMAPJTBALNBR           4
+
+/*+ Worsening moves are considered as
+    candidates when their loss is smaller
+    than the internal edge load of the
+    vertex divided by this value, so that
+    neighboring moves can make them
+    profitable.                            +*/
+
+#define KGRAPHMAPJTLOSSDIV          4
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct KgraphMapJtParam_ {
+  INT                       passnbr;              /*+ Maximum number of passes to do +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio +*/
+} KgraphMapJtParam;
+
+#ifdef SCOTCH_KGRAPH_MAP_JT                       /* Private part of the module */
+
+/*+ The thread-specific data block. +*/
+
+typedef struct KgraphMapJtThread_ {
+  Gnum *                    comptab;              /*+ Load variations of moves, per domain   +*/
+  Gnum                      movenbr;              /*+ Number of moves performed              +*/
+  Gnum                      candnbr;              /*+ Number of rebalancing candidates       +*/
+  Gnum                      commload;             /*+ Communication load, edges counted twice +*/
+  Gnum                      cmigload;             /*+ Migration load                         +*/
+} KgraphMapJtThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct KgraphMapJtData_ {
+  Kgraph *                  grafptr;              /*+ Graph to work on                         +*/
+  const KgraphMapJtParam *  paraptr;              /*+ Method parameters                        +*/
+  KgraphMapJtThread *       thrdtab;              /*+ Array of thread-specific data            +*/
+  Anum *                    movetax;              /*+ Candidate destination domain, or -1      +*/
+  Gnum *                    gaintax;              /*+ Gain of candidate move                   +*/
+  GraphPart *               flagtax;              /*+ Flag set if candidate move is confirmed  +*/
+  Anum *                    partbst;              /*+ Part array of best mapping found so far  +*/
+  Gnum *                    sorttab;              /*+ Array of rebalancing candidates and loss +*/
+  Gnum *                    comploadmax;          /*+ Maximum load imbalance of every domain   +*/
+  MappingDist               distdat;              /*+ Cache of distances between domains       +*/
+  Gnum                      vancnnd;              /*+ End of non-anchor vertex range           +*/
+  Gnum                      commload;             /*+ Communication load of best mapping       +*/
+  Gnum                      cmigload;             /*+ Migration load of best mapping           +*/
+  Gnum                      loadexc;              /*+ Load excess of best mapping              +*/
+  Gnum                      movenbr;              /*+ Number of moves of rebalancing round     +*/
+  int                       abrtval;              /*+ Abort value                              +*/
+} KgraphMapJtData;
+
+/*+ The vertex gain computation work area. +*/
+
+typedef struct KgraphMapJtWork_ {
+  Gnum *                    edlotab;              /*+ Edge load sum to each domain, or -1 +*/
+  Anum *                    domntab;              /*+ List of neighbor domains            +*/
+} KgraphMapJtWork;
+
+/*
+**  The function prototypes.
+*/
+
+static Gnum                 kgraphMapJtMigr     (const Kgraph * restrict const, const Gnum, const Anum);
+static Gnum                 kgraphMapJtBest     (const Kgraph * restrict const, MappingDist * restrict const, const KgraphMapJtWork * restrict const, const Gnum, const Gnum * restrict const, const Gnum * restrict const, Anum * restrict const, Gnum * restrict const);
+static Gnum                 kgraphMapJtFilt     (const Kgraph * restrict const, KgraphMapJtData * restrict const, const Gnum);
+static void                 kgraphMapJtCost     (const Kgraph * restrict const, MappingDist * restrict const, const Gnum, const Gnum, KgraphMapJtThread * restrict const);
+static Gnum                 kgraphMapJtExcs     (const Gnum * restrict const, const Gnum * restrict const, const Anum);
+static void                 kgraphMapJtLoop     (ThreadDescriptor * restrict const, KgraphMapJtData * restrict const);
+
+#endif /* SCOTCH_KGRAPH_MAP_JT */
+
+int                         kgraphMapJt         (Kgraph * restrict const, const KgraphMapJtParam * const);
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2012,2014,2015,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2012,2014,2015,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 25 feb 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 19 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -237,8 +237,8 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to multinode array
   Anum * restrict       fineparttax;              /* May not have been allocated yet             */
 
   const GraphCoarsenMulti * restrict const coarmulttax = coarmulttab - finegrafptr->s.baseval;
-  const Gnum * restrict const              fineverttax = finegrafptr->s.verttax;
-  const Gnum * restrict const              finevendtax = finegrafptr->s.vendtax;
+  const Genum * restrict const              fineverttax = finegrafptr->s.verttax;
+  const Genum * restrict const              finevendtax = finegrafptr->s.vendtax;
   const Gnum * restrict const              fineedgetax = finegrafptr->s.edgetax;
 
   if (coargrafptr == NULL) {                      /* If no coarse graph provided             */
@@ -291,7 +291,7 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to multinode array
     finevertnum1 = coarmulttax[coarvertnum].vertnum[1];
 
     if (finevertnum0 != finevertnum1) {           /* If multinode si made of two distinct vertices */
-      Gnum                fineedgenum;
+      Genum               fineedgenum;
       Gnum                partval;
 
       partval = coarparttax[coarvertnum];
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2013,2014,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2013,2014,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -69,7 +69,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 21 jun 2019     **/
 /**                # Version 7.0  : from : 23 aug 2019     **/
-/**                                 to   : 19 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -147,7 +147,7 @@ const KgraphMapRbParam * restrict const paraptr)
   }
   else {
     if (kgraphMapRbVfloBuild (grafptr->m.archptr, &grafptr->s, grafptr->vfixnbr, grafptr->pfixtax,
-                              &indgrafdat, &vflonbr, &vflotab) != 0) {
+                              &indgrafdat, &vflonbr, &vflotab, grafptr->contptr) != 0) {
       errorPrint ("kgraphMapRb: cannot create induced graph");
       return (1);
     }
@@ -216,7 +216,8 @@ const Gnum                                  orgvfixnbr, /*+ Number of fixed vert
 const Anum * restrict const                 orgpfixtax, /*+ Array of fixed vertex terminal domains     +*/
 Graph * restrict const                      indgrafptr, /*+ Induced subgraph without fixed vertices    +*/
 Anum * restrict const                       vflonbrptr, /*+ Pointer to number of fixed vertex slots    +*/
-KgraphMapRbVflo * restrict * restrict const vflotabptr) /*+ Pointer to fixed vertex load array pointer +*/
+KgraphMapRbVflo * restrict * restrict const vflotabptr, /*+ Pointer to fixed vertex load array pointer +*/
+Context * const                             contptr) /*+ Execution context                             +*/
 {
   ArchDom                     domndat;
   Gnum                        orgvertnum;
@@ -282,7 +283,7 @@ KgraphMapRbVflo * restrict * restrict const vflotabptr) /*+ Pointer to fixed ver
       orgparttax[orgvertnum] = 0;                 /* Keep non-fixed vertex in induced subgraph */
   }
 
-  if (graphInducePart (orggrafptr, orgparttax, orggrafptr->vertnbr - orgvfixnbr, 0, indgrafptr) != 0) { /* Keep non-fixed vertices in induced graph */
+  if (graphInducePart2 (orggrafptr, orgparttax, orggrafptr->vertnbr - orgvfixnbr, 0, indgrafptr, NULL, contptr) != 0) { /* Keep non-fixed vertices in induced graph */
     errorPrint ("kgraphMapRbVfloBuild: cannot build induced subgraph");
     memFree    (hashtab);
     return (1);
@@ -562,8 +563,10 @@ const Graph * restrict const            srcgrafptr, /*+ Source graph
 const Mapping * restrict const          srcmappptr, /*+ Current mapping               +*/
 const ArchDom * restrict const          domnsubtab, /*+ Array of the two subdomains   +*/
 const Gnum * restrict const             vflowgttab, /*+ Array of vertex weight biases +*/
+MemArena * const                        arenptr,  /*+ Memory arena to use, or NULL    +*/
 Context * const                         contptr)  /*+ Execution context               +*/
 {
+  MemArenaMark          markdat;                  /* Arena mark before external gain array */
   Gnum                  actvertnum;               /* Number of current active vertex   */
   Gnum                  commloadextn0;            /* External communication load       */
   Gnum                  commgainextn0;            /* External communication gain       */
@@ -573,19 +576,19 @@ Context * const                         contptr)  /*+ Execution context
   int                   o;
 
   const Arch * restrict const     archptr    = dataptr->mappptr->archptr;
-  const Gnum * restrict const     orgverttax = dataptr->grafptr->verttax;
-  const Gnum * restrict const     orgvendtax = dataptr->grafptr->vendtax;
+  const Genum * restrict const     orgverttax = dataptr->grafptr->verttax;
+  const Genum * restrict const     orgvendtax = dataptr->grafptr->vendtax;
   const Gnum * restrict const     orgedgetax = dataptr->grafptr->edgetax;
   const Gnum * restrict const     orgedlotax = dataptr->grafptr->edlotax;
   const Mapping * restrict const  oldmappptr = dataptr->r.mappptr;
   const Gnum * restrict const     orgvmlotax = dataptr->r.vmlotax;
   const Anum * restrict const     orgpfixtax = dataptr->pfixtax;
-  const Gnum * restrict const     actverttax = srcgrafptr->verttax; /* Get pointers from source graph before bgraphInit() */
-  const Gnum * restrict const     actvendtax = srcgrafptr->vendtax;
+  const Genum * restrict const     actverttax = srcgrafptr->verttax; /* Get pointers from source graph before bgraphInit() */
+  const Genum * restrict const     actvendtax = srcgrafptr->vendtax;
   const Gnum * restrict const     actedgetax = srcgrafptr->edgetax;
   const Gnum * restrict const     actvnumtax = srcgrafptr->vnumtax;
 
-  if (bgraphInit (actgrafptr, srcgrafptr, srcmappptr->archptr, domnsubtab, vflowgttab) != 0) {
+  if (bgraphInit (actgrafptr, srcgrafptr, srcmappptr->archptr, domnsubtab, vflowgttab, arenptr) != 0) {
     errorPrint ("kgraphMapRbBgraph: cannot create bipartition graph");
     return (1);
   }
@@ -602,7 +605,13 @@ Context * const                         contptr)  /*+ Execution context
   if (flagval == KGRAPHMAPRBVEEXNONE)             /* If nothing to do */
     return (0);
 
-  if ((veextax = (Gnum *) memAlloc (actgrafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
+  if (arenptr != NULL) {
+    memArenaMark (arenptr, &markdat);             /* Array is on top of arena, so that it can be released if useless */
+    veextax = (Gnum *) memArenaAlloc (arenptr, actgrafptr->s.vertnbr * sizeof (Gnum));
+  }
+  else
+    veextax = (Gnum *) memAlloc (actgrafptr->s.vertnbr * sizeof (Gnum));
+  if (veextax == NULL) {
     errorPrint ("kgraphMapRbBgraph: out of memory");
     return (1);
   }
@@ -627,10 +636,10 @@ Context * const                         contptr)  /*+ Execution context
       orgvertnum = actvnumtax[actvertnum];        /* Get vertex number in original graph    */
 
       if ((flagval & KGRAPHMAPRBVEEXEDGE) != 0) { /* If edge-based gains have to be computed */
-        Gnum                orgedgenum;
-        Gnum                orgedgennd;
-        Gnum                actedgenum;
-        Gnum                actedgennd;
+        Genum               orgedgenum;
+        Genum               orgedgennd;
+        Genum               actedgenum;
+        Genum               actedgennd;
 
         orgedgenum = orgverttax[orgvertnum];
         orgedgennd = orgvendtax[orgvertnum];
@@ -724,11 +733,15 @@ Context * const                         contptr)  /*+ Execution context
 
 fail :
   if ((o != 0) || (veexmsk == 0)) {               /* If external gain array is useless */
-    memFree (veextax + actgrafptr->s.baseval);    /* Forget about it                   */
+    if (arenptr != NULL)                          /* Forget about it                   */
+      memArenaRelease (arenptr, &markdat);
+    else
+      memFree (veextax + actgrafptr->s.baseval);
     return  (o);                                  /* Return error code                 */
   }
 
-  actgrafptr->s.flagval |= BGRAPHFREEVEEX;        /* Keep external gain array */
+  if (arenptr == NULL)                            /* Arena arrays are released by caller */
+    actgrafptr->s.flagval |= BGRAPHFREEVEEX;      /* Keep external gain array            */
   actgrafptr->veextax    = veextax;
 
   actgrafptr->commload      = commloadextn0;      /* Account for external gains in future computations */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2009,2011,2014,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2009,2011,2014,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -70,7 +70,7 @@
 /**                # Version 6.1  : from : 28 jun 2021     **/
 /**                                 to   : 28 jun 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code is a complete rewrite of    **/
 /**                  the original code of kgraphMapRb(),   **/
@@ -86,6 +86,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -109,7 +110,15 @@ static KgraphMapRbMapPoolLink kgraphmaprbmappooldummy; /* Dummy links for pool r
 /************************************/
 
 /* This routine initializes the job pool
-** structures.
+** structures. When jobs are to be processed
+** concurrently, the domain and job arrays are
+** sized beforehand for the largest possible
+** number of domains, as they cannot be moved
+** while other threads read them. This bound
+** is exact: a domain is only created when a
+** bipartition yields two non-empty parts, so
+** that every domain holds at least one vertex
+** and one terminal.
 ** It returns:
 ** - 0   : in case of success.
 ** - !0  : on error.
@@ -139,6 +148,31 @@ Context * const                         contptr)
     poolptr->grafptr = dataptr->grafptr;          /* We will need top-level graph data */
   }
   poolptr->pfixtax = dataptr->pfixtax;
+  poolptr->dataptr = dataptr;
+
+  poolptr->queutab    = NULL;                     /* Assume jobs will be processed in sequence */
+  poolptr->queunum[0] = 0;
+  poolptr->queunum[1] = (dataptr->paraptr->flagjobtie != 0) ? 0 : 1;
+  poolptr->thrdnbr    = 1;
+#if ((defined SCOTCH_PTHREAD) && (! defined KGRAPHMAPRBMAPNOTHREAD))
+  if (((flagval & KGRAPHMAPRBMAPARCHVAR) == 0) && /* Domain arrays cannot be resized while being read by other threads */
+      (contextThreadNbr (contptr) > 1)) {
+    INT                 deteval;
+
+    contextValuesGetInt (contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+    if (deteval == 0) {                           /* Concurrent processing makes domain numbering non-deterministic */
+      Anum                domnmax;
+
+      domnmax = archDomSize (mappptr->archptr, &dataptr->domnorg); /* Upper bound on number of domains */
+      if (domnmax > dataptr->grafptr->vertnbr)
+        domnmax = dataptr->grafptr->vertnbr;
+
+      if ((mappptr->domnmax >= domnmax) ||        /* Make room for all domains beforehand, as arrays cannot move */
+          (mapResize (mappptr, domnmax) == 0))
+        poolptr->thrdnbr = contextThreadNbr (contptr); /* Queues will be created when enough jobs are pending */
+    }
+  }
+#endif /* ((defined SCOTCH_PTHREAD) && (! defined KGRAPHMAPRBMAPNOTHREAD)) */
 
   poolptr->linktab[0].prev =                      /* Initialize doubly linked list as empty, pointing to the dummy element */
   poolptr->linktab[0].next =
@@ -149,6 +183,7 @@ Context * const                         contptr)
 
   if ((poolptr->jobtab = (KgraphMapRbMapJob *) memAlloc (mappptr->domnmax * sizeof (KgraphMapRbMapJob))) == NULL) {
     errorPrint ("kgraphMapRbMapPoolInit: out of memory (2)");
+    kgraphMapRbMapPoolExit2 (poolptr);
     return (1);
   }
   poolptr->jobtab[0].poolflag = 0;                /* In case kgraphMapRbPoolExit() is called just afterwards on single-domain mapping */
@@ -164,6 +199,7 @@ Context * const                         contptr)
     if ((poolptr->domntab[1] = (ArchDom *) memAlloc (mappptr->domnmax * sizeof (ArchDom))) == NULL) {
       errorPrint ("kgraphMapRbMapPoolInit: out of memory (3)");
       memFree    (poolptr->jobtab);
+      kgraphMapRbMapPoolExit2 (poolptr);
       return (1);
     }
   }
@@ -174,6 +210,30 @@ Context * const                         contptr)
   return (0);
 }
 
+/* This routine frees the concurrent
+** job queues, if any.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapRbMapPoolExit2 (
+KgraphMapRbMapPoolData * restrict const poolptr)
+{
+#ifdef SCOTCH_PTHREAD
+  if (poolptr->queutab != NULL) {
+    int                 queunum;
+
+    for (queunum = 0; queunum < (2 * poolptr->thrdnbr); queunum ++)
+      pthread_mutex_destroy (&poolptr->queutab[queunum].lockdat);
+    pthread_mutex_destroy (&poolptr->lockdat);
+    pthread_cond_destroy  (&poolptr->conddat);
+    memFree (poolptr->queutab);
+  }
+#endif /* SCOTCH_PTHREAD */
+}
+
 /* This routine frees all of the internal arrays
 ** involved in the DRB algorithms. Great care
 ** should be taken that this routine always
@@ -209,6 +269,7 @@ KgraphMapRbMapPoolData * restrict const poolptr)
   }
 
   memFree (poolptr->jobtab);
+  kgraphMapRbMapPoolExit2 (poolptr);
 }
 
 /* This routine swaps the internal arrays
@@ -224,6 +285,7 @@ KgraphMapRbMapPoolData * restrict const poolptr)
 {
   KgraphMapRbMapPoolLink *  linktmp;
   ArchDom *                 domntmp;
+  int                       queutmp;
 
   linktmp             = poolptr->pooltab[0];
   poolptr->pooltab[0] = poolptr->pooltab[1];
@@ -232,6 +294,10 @@ KgraphMapRbMapPoolData * restrict const poolptr)
   domntmp             = poolptr->domntab[0];
   poolptr->domntab[0] = poolptr->domntab[1];
   poolptr->domntab[1] = domntmp;
+
+  queutmp             = poolptr->queunum[0];
+  poolptr->queunum[0] = poolptr->queunum[1];
+  poolptr->queunum[1] = queutmp;
 }
 
 /* This routine doubles the size all of the arrays
@@ -346,12 +412,12 @@ KgraphMapRbMapJob * const               jobptr)
 static
 KgraphMapRbMapJob *
 kgraphMapRbMapPoolGet (
-KgraphMapRbMapPoolData * const  poolptr)
+KgraphMapRbMapPoolLink * const  linkptr)
 {
   KgraphMapRbMapJob * jobbest;                    /* Best job found */
   KgraphMapRbMapJob * jobptr;
 
-  jobbest = (KgraphMapRbMapJob *) poolptr->pooltab[0]->next;  /* Get first job in pool */
+  jobbest = (KgraphMapRbMapJob *) linkptr->next;  /* Get first job in pool */
   for (jobptr  = jobbest;                         /* For all jobs in pool              */
        jobptr != (KgraphMapRbMapJob *) (void *) &kgraphmaprbmappooldummy;
        jobptr  = (KgraphMapRbMapJob *) jobptr->poollink.next) {
@@ -362,6 +428,7 @@ KgraphMapRbMapPoolData * const  poolptr)
   if (jobbest != (KgraphMapRbMapJob *) (void *) &kgraphmaprbmappooldummy) { /* If job found */
     jobbest->poollink.next->prev = jobbest->poollink.prev; /* Remove it from pool           */
     jobbest->poollink.prev->next = jobbest->poollink.next; /* But do not mark it unused     */
+    jobbest->poolptr = NULL;                      /* Job no longer belongs to any pool */
   }
   else                                            /* Dummy job means no job found */
     jobbest = NULL;
@@ -369,6 +436,99 @@ KgraphMapRbMapPoolData * const  poolptr)
   return (jobbest);
 }
 
+/* This routine adds a new job to the next
+** pool. When jobs are processed concurrently,
+** the job is added to the next queue of the
+** given thread, and idle threads are woken up.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapRbMapPoolPut (
+KgraphMapRbMapPoolData * const  poolptr,
+KgraphMapRbMapJob * const       jobptr,
+const int                       thrdnum)          /*+ Number of thread adding the job +*/
+{
+#ifdef SCOTCH_PTHREAD
+  if (poolptr->queutab != NULL) {
+    KgraphMapRbMapPoolQueue *     queuptr;
+
+    queuptr = &poolptr->queutab[2 * thrdnum + poolptr->queunum[1]];
+    pthread_mutex_lock   (&queuptr->lockdat);
+    kgraphMapRbMapPoolAdd (&queuptr->linkdat, jobptr); /* Job is queued before being accounted for */
+    pthread_mutex_unlock (&queuptr->lockdat);
+
+    pthread_mutex_lock     (&poolptr->lockdat);
+    poolptr->jobnbrtab[poolptr->queunum[1]] ++;
+    pthread_cond_broadcast (&poolptr->conddat);   /* Wake-up idle threads */
+    pthread_mutex_unlock   (&poolptr->lockdat);
+    return;
+  }
+#endif /* SCOTCH_PTHREAD */
+
+  kgraphMapRbMapPoolAdd (poolptr->pooltab[1], jobptr);
+}
+
+#ifdef SCOTCH_PTHREAD
+
+/* This routine locks the queue holding the
+** given job, if any, so that the priority of
+** the job can be updated. At most one queue
+** is locked at a time, the lock of the
+** previous queue being released if the job
+** belongs to another queue.
+** It returns:
+** - 1  : if the job is queued, with its queue locked.
+** - 0  : if the job is not queued.
+*/
+
+static
+int
+kgraphMapRbMapPoolLock (
+KgraphMapRbMapPoolData * const          poolptr,
+KgraphMapRbMapPoolQueue ** const        queuptr,  /*+ Pointer to currently locked queue, if any +*/
+const KgraphMapRbMapJob * const         jobptr)
+{
+  while (1) {
+    KgraphMapRbMapPoolQueue *     queutmp;
+
+    queutmp = (KgraphMapRbMapPoolQueue *) jobptr->poolptr; /* TRICK: link is first; value checked once locked */
+    if (queutmp != *queuptr) {                    /* If job not in currently locked queue */
+      kgraphMapRbMapPoolUnlock (queuptr);
+      if (queutmp == NULL)                        /* If job not queued */
+        return (0);
+      pthread_mutex_lock (&queutmp->lockdat);
+      *queuptr = queutmp;
+    }
+    else if (queutmp == NULL)
+      return (0);
+
+    if (jobptr->poolptr == &queutmp->linkdat)     /* If job did not move in the meantime */
+      return (1);
+  }
+}
+
+/* This routine releases the lock on the
+** currently locked queue, if any.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapRbMapPoolUnlock (
+KgraphMapRbMapPoolQueue ** const        queuptr)
+{
+  if (*queuptr != NULL) {
+    pthread_mutex_unlock (&(*queuptr)->lockdat);
+    *queuptr = NULL;
+  }
+}
+
+#endif /* SCOTCH_PTHREAD */
+
 /* This routine adds a job to the given pool
 ** as the first bipartitioning job.
 ** It returns:
@@ -425,7 +585,9 @@ KgraphMapRbMapPoolData * const  poolptr,
 const KgraphMapRbMapJob * const joboldptr,        /* Job to be removed      */
 const GraphPart * const         parttax,
 KgraphMapRbMapJob * const       jobnewptr,        /* Its only active subjob */
-const GraphPart                 partval)
+const GraphPart                 partval,
+const int                       thrdnum,          /* Number of current thread */
+Context * const                 contptr)          /* Context of current thread */
 {
   Gnum                prioval;
   Gnum                priolvl;
@@ -435,7 +597,7 @@ const GraphPart                 partval)
   switch (poolptr->polival) {                     /* Set job priority value */
     case KGRAPHMAPRBPOLIRANDOM :
       prioval =
-      priolvl = contextIntRandVal (poolptr->contptr, INTVALMAX);
+      priolvl = contextIntRandVal (contptr, INTVALMAX);
       break;
     case KGRAPHMAPRBPOLILEVEL :
       priolvl = joboldptr->priolvl + 1;
@@ -459,23 +621,25 @@ const GraphPart                 partval)
   jobnewptr->prioval = prioval;
 
   if (poolptr->polival >= KGRAPHMAPRBPOLINEIGHBOR) { /* If neighbors have to be updated */
-    Gnum                prioold;
+    KgraphMapRbMapPoolQueue * queuptr;            /* Currently locked queue, if any */
+    Gnum                      prioold;
 
     KgraphMapRbMapJob * restrict const  jobtab     = poolptr->jobtab;
     const Anum * restrict const         mapparttax = poolptr->mappptr->parttax; /* Based pointer to mapping part array */
     const Anum * restrict const         toppfixtax = poolptr->pfixtax;
-    const Gnum * restrict const         topverttax = poolptr->grafptr->verttax; /* Point to top-level graph arrays */
-    const Gnum * restrict const         topvendtax = poolptr->grafptr->vendtax;
+    const Genum * restrict const         topverttax = poolptr->grafptr->verttax; /* Point to top-level graph arrays */
+    const Genum * restrict const         topvendtax = poolptr->grafptr->vendtax;
     const Gnum * restrict const         topedgetax = poolptr->grafptr->edgetax;
 
+    queuptr = NULL;
     prioold = joboldptr->prioval;
 
     if (joboldptr->grafdat.vertnbr < poolptr->grafptr->vertnbr) { /* If subgraph is not top graph, change priority of neighboring jobs of old job */
       Gnum                jobvertnnd;
       Gnum                jobvertnum;
 
-      const Gnum * restrict const jobverttax = joboldptr->grafdat.verttax;
-      const Gnum * restrict const jobvendtax = joboldptr->grafdat.vendtax;
+      const Genum * restrict const jobverttax = joboldptr->grafdat.verttax;
+      const Genum * restrict const jobvendtax = joboldptr->grafdat.vendtax;
       const Gnum * restrict const jobvnumtax = joboldptr->grafdat.vnumtax;
 
       jobnewptr->poolflag = 0;                    /* TRICK: avoid new job being considered for update */
@@ -483,7 +647,7 @@ const GraphPart                 partval)
       for (jobvertnum = joboldptr->grafdat.baseval, jobvertnnd = joboldptr->grafdat.vertnnd;
            jobvertnum < jobvertnnd; jobvertnum ++) {
         Gnum                topvertnum;
-        Gnum                topedgenum;
+        Genum               topedgenum;
 
         if (parttax[jobvertnum] == partval)       /* If vertex belongs to part which is still alive */
           continue;                               /* Do not consider update part as removed         */
@@ -503,6 +667,7 @@ const GraphPart                 partval)
 #ifdef SCOTCH_DEBUG_KGRAPH2
             if (mapparttax[topvertend] != ~0) {
               errorPrint ("kgraphMapRbMapPoolUpdt1: internal error (1)");
+              kgraphMapRbMapPoolRelease (&queuptr);
               return;
             }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
@@ -511,9 +676,9 @@ const GraphPart                 partval)
 
           jobnghbptr = &jobtab[mapparttax[topvertend]]; /* Get pointer to neighboring job */
 
-          if ((jobnghbptr->poolflag != 0) &&      /* If neighbor is active                   */
-              (jobnghbptr->prioval <= prioold))   /* And had not already a stronger priority */
-            jobnghbptr->priolvl ++;               /* Update neighbor priority                */
+          if (kgraphMapRbMapPoolActive (poolptr, &queuptr, jobnghbptr) && /* If neighbor is active */
+              (jobnghbptr->prioval <= prioold))   /* And had not already a stronger priority         */
+            jobnghbptr->priolvl ++;               /* Update neighbor priority                        */
         }
       }
 
@@ -524,14 +689,14 @@ const GraphPart                 partval)
       Gnum                jobvertnnd;
       Gnum                jobvertnum;
 
-      const Gnum * restrict const jobverttax = jobnewptr->grafdat.verttax;
-      const Gnum * restrict const jobvendtax = jobnewptr->grafdat.vendtax;
+      const Genum * restrict const jobverttax = jobnewptr->grafdat.verttax;
+      const Genum * restrict const jobvendtax = jobnewptr->grafdat.vendtax;
       const Gnum * restrict const jobvnumtax = jobnewptr->grafdat.vnumtax;
 
       for (jobvertnum = jobnewptr->grafdat.baseval, jobvertnnd = jobnewptr->grafdat.vertnnd;
            jobvertnum < jobvertnnd; jobvertnum ++) {
         Gnum                          topvertnum;
-        Gnum                          topedgenum;
+        Genum                         topedgenum;
 
         topvertnum = jobvnumtax[jobvertnum];      /* For subjobs jobvnumtax always exists */
 
@@ -548,6 +713,7 @@ const GraphPart                 partval)
 #ifdef SCOTCH_DEBUG_KGRAPH2
             if (mapparttax[topvertend] != ~0) {
               errorPrint ("kgraphMapRbMapPoolUpdt1: internal error (2)");
+              kgraphMapRbMapPoolRelease (&queuptr);
               return;
             }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
@@ -558,7 +724,7 @@ const GraphPart                 partval)
           if (jobnghbptr == jobnewptr)            /* If it is the current job, do not consider the edge */
             continue;
 
-          if ((jobnghbptr->poolflag == 0) ||      /* If neighbor is not active            */
+          if ((! kgraphMapRbMapPoolActive (poolptr, &queuptr, jobnghbptr)) || /* If neighbor is not active */
               (prioval > jobnghbptr->prioval))    /* Or if we have higher priority        */
             priolvl ++;                           /* Increase our priority                */
           else if ((prioval <  jobnghbptr->prioval) && /* Else if neighbor has higher one */
@@ -567,11 +733,12 @@ const GraphPart                 partval)
         }
       }
     }
+    kgraphMapRbMapPoolRelease (&queuptr);
   }
 
   jobnewptr->priolvl = priolvl;
 
-  kgraphMapRbMapPoolAdd (poolptr->pooltab[1], jobnewptr); /* Add job to pool */
+  kgraphMapRbMapPoolPut (poolptr, jobnewptr, thrdnum); /* Add job to pool */
 }
 
 static
@@ -581,7 +748,9 @@ KgraphMapRbMapPoolData * const  poolptr,
 const KgraphMapRbMapJob * const joboldptr,        /* Job to be removed */
 const GraphPart * const         parttax,
 KgraphMapRbMapJob * const       jobnewptr0,       /* Its two subjobs   */
-KgraphMapRbMapJob * const       jobnewptr1)
+KgraphMapRbMapJob * const       jobnewptr1,
+const int                       thrdnum,          /* Number of current thread  */
+Context * const                 contptr)          /* Context of current thread */
 {
   KgraphMapRbMapJob * restrict  jobnewtab[2];
   int                           i;
@@ -601,7 +770,7 @@ KgraphMapRbMapJob * const       jobnewptr1)
     switch (poolptr->polival) {                   /* Set job priority value */
       case KGRAPHMAPRBPOLIRANDOM :
         prioval =
-        priolvl = contextIntRandVal (poolptr->contptr, INTVALMAX);
+        priolvl = contextIntRandVal (contptr, INTVALMAX);
         break;
       case KGRAPHMAPRBPOLILEVEL :
         priolvl = joboldptr->priolvl + 1;
@@ -626,26 +795,28 @@ KgraphMapRbMapJob * const       jobnewptr1)
     jobnewptr->prioval  = prioval;                /* Then in its turn subdomain 0 will have its proper priority value          */
 
     if (poolptr->polival >= KGRAPHMAPRBPOLINEIGHBOR) { /* If neighbors have to be updated */
-      Gnum                jobvertnnd;
-      Gnum                jobvertnum;
-      Gnum                prioold;
+      KgraphMapRbMapPoolQueue * queuptr;          /* Currently locked queue, if any */
+      Gnum                      jobvertnnd;
+      Gnum                      jobvertnum;
+      Gnum                      prioold;
 
       KgraphMapRbMapJob * restrict const  jobtab     = poolptr->jobtab;
       const Anum * restrict const         mapparttax = poolptr->mappptr->parttax; /* Based pointer to mapping part array */
       const Anum * restrict const         toppfixtax = poolptr->pfixtax;
-      const Gnum * restrict const         topverttax = poolptr->grafptr->verttax; /* Point to top-level graph arrays */
-      const Gnum * restrict const         topvendtax = poolptr->grafptr->vendtax;
+      const Genum * restrict const         topverttax = poolptr->grafptr->verttax; /* Point to top-level graph arrays */
+      const Genum * restrict const         topvendtax = poolptr->grafptr->vendtax;
       const Gnum * restrict const         topedgetax = poolptr->grafptr->edgetax;
-      const Gnum * restrict const         jobverttax = jobnewptr->grafdat.verttax;
-      const Gnum * restrict const         jobvendtax = jobnewptr->grafdat.vendtax;
+      const Genum * restrict const         jobverttax = jobnewptr->grafdat.verttax;
+      const Genum * restrict const         jobvendtax = jobnewptr->grafdat.vendtax;
       const Gnum * restrict const         jobvnumtax = jobnewptr->grafdat.vnumtax;
 
+      queuptr = NULL;
       prioold = joboldptr->prioval;
 
       for (jobvertnum = jobnewptr->grafdat.baseval, jobvertnnd = jobnewptr->grafdat.vertnnd;
            jobvertnum < jobvertnnd; jobvertnum ++) {
         Gnum                          topvertnum;
-        Gnum                          topedgenum;
+        Genum                         topedgenum;
 
         topvertnum = jobvnumtax[jobvertnum];      /* For subjobs jobvnumtax always exists */
 
@@ -656,12 +827,14 @@ KgraphMapRbMapJob * const       jobnewptr1)
         for (topedgenum = topverttax[topvertnum]; topedgenum < topvendtax[topvertnum]; topedgenum ++) {
           KgraphMapRbMapJob * jobnghbptr;         /* (Old ?) job of neighbor vertex */
           Gnum                topvertend;
+          int                 actival;
 
           topvertend = topedgetax[topedgenum];
           if ((toppfixtax != NULL) && (toppfixtax[topvertend] >= 0)) {
 #ifdef SCOTCH_DEBUG_KGRAPH2
             if (mapparttax[topvertend] != ~0) {
               errorPrint ("kgraphMapRbMapPoolUpdt2: internal error");
+              kgraphMapRbMapPoolRelease (&queuptr);
               return;
             }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
@@ -670,20 +843,23 @@ KgraphMapRbMapJob * const       jobnewptr1)
 
           jobnghbptr = &jobtab[mapparttax[topvertend]]; /* Get pointer to neighboring job */
 
-          if ((jobnghbptr->poolflag != 0)      && /* If neighbor is in active job  */
+          actival = ((jobnghbptr == jobnewptr0) || (jobnghbptr == jobnewptr)) /* Subjobs not yet queued belong to current thread */
+                    ? (jobnghbptr->poolflag != 0) : kgraphMapRbMapPoolActive (poolptr, &queuptr, jobnghbptr);
+          if ((actival != 0)                   && /* If neighbor is in active job  */
               (jobnghbptr->prioval >  prioval) && /* Which gained priority over us */
               (jobnghbptr->prioval <= prioold)) {
             jobnghbptr->priolvl ++;               /* Update neighbor priority */
           }
-          if ((jobnghbptr->poolflag == 0) ||      /* If neighbor is fully known    */
+          if ((actival == 0) ||                   /* If neighbor is fully known    */
               (jobnghbptr->prioval < prioval))    /* Or has smaller priority value */
             priolvl ++;                           /* Then we should be processed   */
         }
       }
+      kgraphMapRbMapPoolRelease (&queuptr);
     }
 
     jobnewptr->priolvl = priolvl;                 /* Set new priority          */
-    kgraphMapRbMapPoolAdd (poolptr->pooltab[1], jobnewptr); /* Add job to pool */
+    kgraphMapRbMapPoolPut (poolptr, jobnewptr, thrdnum); /* Add job to pool */
   }
 }
 
@@ -701,26 +877,28 @@ KgraphMapRbMapPoolData * const  poolptr,
 const KgraphMapRbMapJob * const joboldptr)        /* Job to be removed */
 {
   if (poolptr->polival >= KGRAPHMAPRBPOLINEIGHBOR) { /* If neighbors have to be modified */
-    Gnum                jobvertnnd;
-    Gnum                jobvertnum;
-    Gnum                prioold;
+    KgraphMapRbMapPoolQueue * queuptr;            /* Currently locked queue, if any */
+    Gnum                      jobvertnnd;
+    Gnum                      jobvertnum;
+    Gnum                      prioold;
 
     KgraphMapRbMapJob * restrict const  jobtab     = poolptr->jobtab;
     const Anum * restrict const         mapparttax = poolptr->mappptr->parttax; /* Based pointer to mapping part array */
     const Anum * restrict const         toppfixtax = poolptr->pfixtax;
-    const Gnum * restrict const         topverttax = poolptr->grafptr->verttax; /* Point to top-level graph arrays */
-    const Gnum * restrict const         topvendtax = poolptr->grafptr->vendtax;
+    const Genum * restrict const         topverttax = poolptr->grafptr->verttax; /* Point to top-level graph arrays */
+    const Genum * restrict const         topvendtax = poolptr->grafptr->vendtax;
     const Gnum * restrict const         topedgetax = poolptr->grafptr->edgetax;
-    const Gnum * restrict const         jobverttax = joboldptr->grafdat.verttax;
-    const Gnum * restrict const         jobvendtax = joboldptr->grafdat.vendtax;
+    const Genum * restrict const         jobverttax = joboldptr->grafdat.verttax;
+    const Genum * restrict const         jobvendtax = joboldptr->grafdat.vendtax;
     const Gnum * restrict const         jobvnumtax = joboldptr->grafdat.vnumtax;
 
+    queuptr = NULL;
     prioold = joboldptr->prioval;
 
     for (jobvertnum = joboldptr->grafdat.baseval, jobvertnnd = joboldptr->grafdat.vertnnd;
          jobvertnum < jobvertnnd; jobvertnum ++) {
       Gnum                topvertnum;             /* Source graph vertex number */
-      Gnum                topedgenum;             /* Source graph edge number   */
+      Genum               topedgenum;             /* Source graph edge number   */
 
       topvertnum = (jobvnumtax == NULL) ? jobvertnum : jobvnumtax[jobvertnum];
 
@@ -737,6 +915,7 @@ const KgraphMapRbMapJob * const joboldptr)        /* Job to be removed */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           if (mapparttax[topvertend] != ~0) {
             errorPrint ("kgraphMapRbMapPoolRemv: internal error (1)");
+            kgraphMapRbMapPoolRelease (&queuptr);
             return;
           }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
@@ -745,11 +924,12 @@ const KgraphMapRbMapJob * const joboldptr)        /* Job to be removed */
 
         jobnghbptr = &jobtab[mapparttax[topvertend]]; /* Get pointer to neighboring job */
 
-        if ((jobnghbptr->poolflag != 0) &&        /* If neighbor job is active                       */
+        if (kgraphMapRbMapPoolActive (poolptr, &queuptr, jobnghbptr) && /* If neighbor job is active */
             (jobnghbptr->prioval <= prioold))     /* And had not already a stronger priority         */
           jobnghbptr->priolvl ++;                 /* Increase its priority since we are now inactive */
       }
     }
+    kgraphMapRbMapPoolRelease (&queuptr);
   }
 }
 
@@ -849,6 +1029,357 @@ const Anum                              jobsubnum1)
   }
 }
 
+/*****************************************/
+/*                                       */
+/* These routines process bipartitioning */
+/* jobs, possibly concurrently.          */
+/*                                       */
+/*****************************************/
+
+/* This routine bipartitions the given job,
+** and creates and enqueues its subjobs.
+** Local data is freed in case of error,
+** but the job pool is not.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+kgraphMapRbMap2 (
+KgraphMapRbMapPoolData * restrict const poolptr,  /*+ Job pool data                 +*/
+KgraphMapRbMapJob *                     joborgptr, /*+ Job to process, out of pools +*/
+const int                               thrdnum,  /*+ Number of current thread      +*/
+Context * const                         contptr)  /*+ Context of current thread     +*/
+{
+  ArchDom                 domnsubtab[2];          /* Subdomains of current job domain     */
+  KgraphMapRbMapJob       joborgdat;              /* Aera to save original job data       */
+  Anum                    jobsubnum[2];           /* Number of subjob slots in job array  */
+  Gnum                    jobsubsiz[2];           /* Sizes of subjobs                     */
+  Bgraph                  actgrafdat;             /* Bipartition graph                    */
+  Gnum                    vflonbrtab[2];
+  Gnum                    vflowgttab[2];
+  Gnum                    levlnum;
+  int                     partval;
+  MemArena *              arenptr;                /* Memory arena for bipartition graphs  */
+  MemArenaMark            markdat;                /* Arena state before bipartition graph creation */
+  int                     i;
+
+  const KgraphMapRbData * restrict const  dataptr = poolptr->dataptr;
+  Mapping * restrict const                mappptr = dataptr->mappptr;
+
+  arenptr = contextArena (contptr);               /* Use heap for bipartition graphs if no arena */
+
+  jobsubnum[0] = (Anum) (joborgptr - poolptr->jobtab); /* Get current (and first son) job slot number before possible move of pointers */
+  joborgdat = *joborgptr;                         /* Save current job data (clone graph)                                                   */
+
+  if (archDomBipart (mappptr->archptr, &joborgdat.domnorg, &domnsubtab[0], &domnsubtab[1]) != 0) {
+    errorPrint ("kgraphMapRbMap2: cannot bipartition domain");
+    return (1);                                   /* Copied graph will be freed as not yet removed */
+  }
+
+  kgraphMapRbVfloSplit (mappptr->archptr, domnsubtab, /* Split fixed vertex load slots, if any */
+                        joborgdat.vflonbr, joborgdat.vflotab, vflonbrtab, vflowgttab);
+  if (arenptr != NULL)
+    memArenaMark (arenptr, &markdat);
+  if (kgraphMapRbBgraph (dataptr, &actgrafdat, &joborgdat.grafdat, poolptr->mappptr, domnsubtab, vflowgttab, arenptr, contptr) != 0) { /* Create bipartition graph */
+    errorPrint ("kgraphMapRbMap2: cannot create bipartition graph");
+    if (arenptr != NULL)
+      memArenaRelease (arenptr, &markdat);
+    return (1);                                   /* Copied graph will be freed as not yet removed */
+  }
+
+  actgrafdat.s.flagval |= (joborgdat.grafdat.flagval & GRAPHFREETABS); /* Bipartition graph is responsible for freeing the cloned graph data fields */
+  joborgptr->poolflag = 0;                        /* Original slot is now considered unused so that cloned graph data will not be freed twice           */
+
+  if ((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) == 0) { /* If not variable-sized, impose constraints on bipartition */
+    double              comploadmin;              /* Minimum vertex load per target load */
+    double              comploadmax;              /* Maximum vertex load per target load */
+    double              comploadavg;
+
+    comploadmin = (1.0 - dataptr->paraptr->kbalval) * dataptr->comploadrat; /* Ratio can have been tilted when working on subgraph */
+    comploadmax = (1.0 + dataptr->paraptr->kbalval) * dataptr->comploadrat;
+    comploadavg = (double) actgrafdat.s.velosum / (double) archDomWght (mappptr->archptr, &joborgdat.domnorg);
+    actgrafdat.compload0min = actgrafdat.compload0avg -
+                              (Gnum) MIN ((comploadmax - comploadavg) * (double) actgrafdat.domnwght[0],
+                                          (comploadavg - comploadmin) * (double) actgrafdat.domnwght[1]);
+    actgrafdat.compload0max = actgrafdat.compload0avg +
+                              (Gnum) MIN ((comploadavg - comploadmin) * (double) actgrafdat.domnwght[0],
+                                          (comploadmax - comploadavg) * (double) actgrafdat.domnwght[1]);
+  }
+
+  if (bgraphBipartSt (&actgrafdat, dataptr->paraptr->strat) != 0) { /* Perform bipartitioning */
+    errorPrint ("kgraphMapRbMap2: cannot bipartition job");
+    bgraphExit (&actgrafdat);
+    if (arenptr != NULL)
+      memArenaRelease (arenptr, &markdat);
+    return (1);
+  }
+
+  if ((partval = 1, actgrafdat.compsize0 == 0) || /* If no bipartition found */
+      (partval = 0, actgrafdat.compsize0 == actgrafdat.s.vertnbr)) {
+    if ((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) != 0) { /* If architecture is variable-sized       */
+      poolptr->domntab[0][jobsubnum[0]] = joborgdat.domnorg; /* Propagate domain in next pool         */
+      kgraphMapRbMapPoolRemv (poolptr, &joborgdat); /* Remove job from pool as long as graph exists */
+    }
+    else if (archDomSize (mappptr->archptr, &domnsubtab[partval]) <= 1) { /* If domain is terminal   */
+      poolptr->domntab[0][jobsubnum[0]] = domnsubtab[partval]; /* Refine domain in next pool          */
+      kgraphMapRbMapPoolRemv (poolptr, &joborgdat); /* Remove job from pool as long as graph exists */
+    }
+    else {                                        /* Re-use job slot and graph for further bipartitioning */
+      poolptr->domntab[0][jobsubnum[0]] =         /* Update domain in next pool                           */
+      joborgptr->domnorg = domnsubtab[partval];   /* New job takes same graph and non-empty subdomain     */
+      joborgptr->vflonbr = vflonbrtab[partval];
+      joborgptr->vflotab = joborgdat.vflotab + (partval * vflonbrtab[0]); /* Point to proper sub-array */
+      joborgptr->levlnum ++;
+      kgraphMapRbMapPoolUpdt1 (poolptr, &joborgdat, actgrafdat.parttax, joborgptr, partval, thrdnum, contptr); /* Add job to pool */
+      actgrafdat.s.flagval &= ~GRAPHFREETABS;     /* Since graph will be re-used, never free its internal arrays */
+    }
+    bgraphExit (&actgrafdat);                     /* Free bipartitioning data as well as current graph */
+    if (arenptr != NULL)
+      memArenaRelease (arenptr, &markdat);
+    return (0);
+  }
+
+#ifdef SCOTCH_PTHREAD
+  if (poolptr->queutab != NULL)                   /* Domain slots are shared by all threads */
+    pthread_mutex_lock (&poolptr->lockdat);
+#endif /* SCOTCH_PTHREAD */
+  if ((poolptr->mappptr->domnnbr == poolptr->mappptr->domnmax) && /* If all job slots busy                            */
+      ((poolptr->queutab != NULL) ||              /* Arrays presized for concurrent processing cannot move */
+       (kgraphMapRbMapPoolResize (poolptr) != 0))) { /* From this point, joborgptr may no longer be valid  */
+    errorPrint ("kgraphMapRbMap2: cannot resize structures");
+#ifdef SCOTCH_PTHREAD
+    if (poolptr->queutab != NULL)
+      pthread_mutex_unlock (&poolptr->lockdat);
+#endif /* SCOTCH_PTHREAD */
+    bgraphExit (&actgrafdat);
+    if (arenptr != NULL)
+      memArenaRelease (arenptr, &markdat);
+    return (1);
+  }
+  jobsubnum[1] = poolptr->mappptr->domnnbr ++;    /* Get slot number of new subdomain */
+#ifdef SCOTCH_PTHREAD
+  if (poolptr->queutab != NULL)
+    pthread_mutex_unlock (&poolptr->lockdat);
+#endif /* SCOTCH_PTHREAD */
+
+  jobsubsiz[1] = actgrafdat.s.vertnbr - actgrafdat.compsize0;
+  jobsubsiz[0] = actgrafdat.compsize0;
+
+  poolptr->jobtab[jobsubnum[1]].poolflag = 0;     /* Assume that new job is inactive in case of premature freeing                           */
+  poolptr->domntab[1][jobsubnum[1]] = joborgdat.domnorg; /* Copy original domain to new subdomain as old mapping shares parttax with new */
+  poolptr->domntab[0][jobsubnum[1]] = domnsubtab[1];
+
+  if ((poolptr->flagval & KGRAPHMAPRBMAPPARTHALF) != 0) /* If can only update second half */
+    kgraphMapRbMapPartOne (poolptr, &actgrafdat, jobsubnum[1]);
+  else
+    kgraphMapRbMapPartBoth (poolptr, &actgrafdat, jobsubnum);
+  poolptr->domntab[0][jobsubnum[0]] = domnsubtab[0]; /* Set subdomain once moved vertices no longer refer to it, for concurrent readers */
+
+  levlnum = joborgdat.levlnum + 1;
+  for (i = 1; i >= 0; i --) {                     /* For both subdomains */
+    KgraphMapRbMapJob * jobsubptr;
+
+    jobsubptr = &poolptr->jobtab[jobsubnum[i]];   /* Point to subdomain job slot                                */
+    jobsubptr->poollink.prev =                    /* Prevent Valgrind from yelling in kgraphMapRbMapPoolResize() */
+    jobsubptr->poollink.next = NULL;
+    jobsubptr->poolptr = NULL;                    /* Subjob not yet in any pool */
+    jobsubptr->prioval =                          /* Prevent Valgrind from yelling in kgraphMapRbMapPoolRemv()/Updt1()/Updt2() */
+    jobsubptr->priolvl = 0;
+
+    if ((((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) == 0) && (archDomSize (mappptr->archptr, &domnsubtab[i]) <= 1)) || /* If single-vertex domain  */
+        (((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) != 0) && (jobsubsiz[i] <= 1))) { /* Or if variable-sized architecture with single vertex graph */
+      jobsubsiz[i] = 0;                           /* Cancel subjob */
+      continue;
+    }
+
+    partval = i;                                  /* At least this subjob works */
+
+    if (graphInducePart2 (&actgrafdat.s, actgrafdat.parttax, jobsubsiz[i], (GraphPart) i, &jobsubptr->grafdat, NULL, contptr) != 0) {
+      errorPrint ("kgraphMapRbMap2: cannot create induced subgraph");
+      bgraphExit (&actgrafdat);
+      if (arenptr != NULL)
+        memArenaRelease (arenptr, &markdat);
+      return (1);
+    }
+    jobsubptr->poolflag = 1;                      /* So that graph is freed in case of error on other part */
+    jobsubptr->domnorg  = domnsubtab[i];
+    jobsubptr->vflonbr  = vflonbrtab[i];
+    jobsubptr->vflotab  = joborgdat.vflotab + (i * vflonbrtab[0]); /* Point to proper sub-array */
+    jobsubptr->levlnum  = levlnum;                /* Set new level */
+  }
+
+  if ((jobsubsiz[0] | jobsubsiz[1]) == 0)         /* If both subjobs do not need further processing */
+    kgraphMapRbMapPoolRemv (poolptr, &joborgdat);
+  else if (jobsubsiz[1 - partval] == 0)           /* If one of the subjobs only needs further processing */
+    kgraphMapRbMapPoolUpdt1 (poolptr, &joborgdat, actgrafdat.parttax, &poolptr->jobtab[jobsubnum[partval]], (GraphPart) partval, thrdnum, contptr);
+  else
+    kgraphMapRbMapPoolUpdt2 (poolptr, &joborgdat, actgrafdat.parttax, &poolptr->jobtab[jobsubnum[0]], &poolptr->jobtab[jobsubnum[1]], thrdnum, contptr);
+
+  bgraphExit (&actgrafdat);                       /* Free bipartition graph data */
+  if (arenptr != NULL)
+    memArenaRelease (arenptr, &markdat);
+
+  return (0);
+}
+
+#ifdef SCOTCH_PTHREAD
+
+/* This routine is run by every worker thread
+** when jobs are processed concurrently. Each
+** thread takes the best job from its own queue
+** or, if it is empty, steals the best job from
+** the queue of another thread, subjobs being
+** added to the queue of the thread that created
+** them. When job pools are not tied, all threads
+** synchronize before swapping pools.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapRbMapThread (
+Context * const                 contptr,          /*+ Single-thread context of current thread +*/
+ThreadDescriptor * const        descptr,          /*+ Descriptor of initial context           +*/
+KgraphMapRbMapPoolData * const  poolptr)
+{
+  const int           thrdnbr = poolptr->thrdnbr;
+  const int           thrdnum = threadNum (descptr);
+
+  while (1) {                                     /* For all pool levels */
+    const int           queunum = poolptr->queunum[0]; /* Stable until next barrier */
+
+    while (1) {                                   /* For all jobs in current pools */
+      KgraphMapRbMapJob * jobptr;
+      int                 thrdtmp;
+      int                 o;
+
+      pthread_mutex_lock (&poolptr->lockdat);
+      while ((poolptr->jobnbrtab[queunum] == 0) && /* Wait until a job is queued or all jobs are done */
+             (poolptr->jobactnbr > 0) && (poolptr->abrtval == 0))
+        pthread_cond_wait (&poolptr->conddat, &poolptr->lockdat);
+      if ((poolptr->jobnbrtab[queunum] == 0) || (poolptr->abrtval != 0)) { /* If current pools are exhausted */
+        pthread_mutex_unlock (&poolptr->lockdat);
+        break;
+      }
+      poolptr->jobnbrtab[queunum] --;             /* Reserve a job, which is guaranteed to be found in some queue */
+      poolptr->jobactnbr ++;
+      pthread_mutex_unlock (&poolptr->lockdat);
+
+      for (jobptr = NULL, thrdtmp = thrdnum; jobptr == NULL; thrdtmp = (thrdtmp + 1) % thrdnbr) { /* Own queue first, then steal */
+        KgraphMapRbMapPoolQueue * queuptr;
+
+        queuptr = &poolptr->queutab[2 * thrdtmp + queunum];
+        pthread_mutex_lock   (&queuptr->lockdat);
+        jobptr = kgraphMapRbMapPoolGet (&queuptr->linkdat);
+        pthread_mutex_unlock (&queuptr->lockdat);
+      }
+
+      o = kgraphMapRbMap2 (poolptr, jobptr, thrdnum, contptr);
+
+      pthread_mutex_lock (&poolptr->lockdat);
+      if (o != 0)
+        poolptr->abrtval = 1;
+      poolptr->jobactnbr --;
+      pthread_cond_broadcast (&poolptr->conddat); /* Idle threads may have to terminate */
+      pthread_mutex_unlock   (&poolptr->lockdat);
+    }
+
+    threadBarrier (descptr);                      /* Wait for all threads to be done with current pools */
+    if (thrdnum == 0) {
+      kgraphMapRbMapPoolSwap (poolptr);           /* Swap current and next levels */
+      poolptr->levlflag = (poolptr->abrtval == 0) && (poolptr->jobnbrtab[poolptr->queunum[0]] != 0); /* Decide once for all threads */
+    }
+    threadBarrier (descptr);
+
+    if (poolptr->levlflag == 0)                   /* If error or no jobs left, stop; job counters may already have changed */
+      break;
+  }
+}
+
+/* This routine returns the number of jobs
+** in the pools, up to the given bound.
+** It returns:
+** - the number of jobs : in all cases.
+*/
+
+static
+Anum
+kgraphMapRbMapPoolCount (
+KgraphMapRbMapPoolData * const  poolptr,
+const Anum                      jobmax)
+{
+  KgraphMapRbMapPoolLink *  linkptr;
+  Anum                      jobnbr;
+  int                       i;
+
+  for (i = 0, jobnbr = 0; i < ((poolptr->pooltab[0] == poolptr->pooltab[1]) ? 1 : 2); i ++) {
+    for (linkptr = poolptr->pooltab[i]->next;
+         (linkptr != &kgraphmaprbmappooldummy) && (jobnbr < jobmax);
+         linkptr = linkptr->next, jobnbr ++) ;
+  }
+
+  return (jobnbr);
+}
+
+/* This routine processes all remaining jobs
+** concurrently. Jobs are first spread across
+** the queues of all threads.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+kgraphMapRbMapThreads (
+KgraphMapRbMapPoolData * const  poolptr,
+Context * const                 contptr)
+{
+  int                 queunum;
+  int                 thrdnum;
+  int                 i;
+
+  if ((poolptr->queutab = (KgraphMapRbMapPoolQueue *) memAlloc (2 * poolptr->thrdnbr * sizeof (KgraphMapRbMapPoolQueue))) == NULL) {
+    errorPrint ("kgraphMapRbMapThreads: out of memory");
+    return (1);
+  }
+  for (queunum = 0; queunum < (2 * poolptr->thrdnbr); queunum ++) {
+    poolptr->queutab[queunum].linkdat.prev =
+    poolptr->queutab[queunum].linkdat.next = &kgraphmaprbmappooldummy;
+    pthread_mutex_init (&poolptr->queutab[queunum].lockdat, NULL);
+  }
+  pthread_mutex_init (&poolptr->lockdat, NULL);
+  pthread_cond_init  (&poolptr->conddat, NULL);
+  poolptr->jobnbrtab[0] =
+  poolptr->jobnbrtab[1] = 0;
+  poolptr->jobactnbr    = 0;
+  poolptr->abrtval      = 0;
+  poolptr->levlflag     = 1;
+
+  for (i = 0, thrdnum = 0; i < ((poolptr->pooltab[0] == poolptr->pooltab[1]) ? 1 : 2); i ++) {
+    KgraphMapRbMapJob * jobptr;
+
+    while ((jobptr = kgraphMapRbMapPoolGet (poolptr->pooltab[i])) != NULL) { /* Spread jobs in priority order */
+      kgraphMapRbMapPoolAdd (&poolptr->queutab[2 * thrdnum + poolptr->queunum[i]].linkdat, jobptr);
+      poolptr->jobnbrtab[poolptr->queunum[i]] ++;
+      thrdnum = (thrdnum + 1) % poolptr->thrdnbr;
+    }
+  }
+
+  if (contextThreadLaunchSolo (contptr, (ContextSoloFunc) kgraphMapRbMapThread, (void *) poolptr) != 0) {
+    errorPrint ("kgraphMapRbMapThreads: cannot launch threads");
+    return (1);
+  }
+
+  return (poolptr->abrtval);
+}
+
+#endif /* SCOTCH_PTHREAD */
+
 /********************************************/
 /*                                          */
 /* This is the entry point for the Dual     */
@@ -857,7 +1388,13 @@ const Anum                              jobsubnum1)
 /********************************************/
 
 /* This routine runs the Dual Recursive
-** Bipartitioning algorithm.
+** Bipartitioning algorithm. Jobs are first
+** processed one after the other by all the
+** threads of the context; when there are
+** enough pending jobs to keep all threads
+** busy, and unless deterministic behavior
+** is required, jobs are processed concurrently,
+** each by a single thread.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -872,14 +1409,7 @@ KgraphMapRbVflo * restrict const        vflotab,  /*+ Array of fixed vertex load
 Context * const                         contptr)  /*+ Execution context                    +*/
 {
   KgraphMapRbMapPoolData  pooldat;                /* Data for handling jobs and job pools */
-  ArchDom                 domnsubtab[2];          /* Subdomains of current job domain     */
-  KgraphMapRbMapJob       joborgdat;              /* Aera to save original job data       */
-  Anum                    jobsubnum[2];           /* Number of subjob slots in job array  */
-  Gnum                    jobsubsiz[2];           /* Sizes of subjobs                     */
-  Bgraph                  actgrafdat;             /* Bipartition graph                    */
-  double                  comploadmin;            /* Minimum vertex load per target load  */
-  double                  comploadmax;            /* Maximum vertex load per target load  */
-  int                     i;
+  int                     thrdflag;               /* Flag set if jobs to process concurrently */
 
   Mapping * restrict const  mappptr = dataptr->mappptr;
 
@@ -914,149 +1444,42 @@ Context * const                         contptr)  /*+ Execution context
   pooldat.jobtab[0].grafdat.flagval &= ~GRAPHFREETABS; /* Do not free its arrays on exit     */
   pooldat.jobtab[0].vflonbr = vflonbr;            /* Record initial list of fixed load slots */
   pooldat.jobtab[0].vflotab = vflotab;
-  pooldat.jobtab[0].vflotab = vflotab;
   pooldat.jobtab[0].levlnum = 0;                  /* Initial recursion level is 0 */
   kgraphMapRbMapPoolFrst (&pooldat, &pooldat.jobtab[0]); /* Add initial job       */
 
-  comploadmin = (1.0 - dataptr->paraptr->kbalval) * dataptr->comploadrat; /* Ratio can have been tilted when working on subgraph */
-  comploadmax = (1.0 + dataptr->paraptr->kbalval) * dataptr->comploadrat;
-
+  thrdflag = 0;
   while (! kgraphMapRbMapPoolEmpty (&pooldat)) {  /* For all non-empty pools */
     KgraphMapRbMapJob * joborgptr;                /* Pointer to current job  */
 
-    while ((joborgptr = kgraphMapRbMapPoolGet (&pooldat)) != NULL) { /* For all jobs in pool */
-      Gnum                vflonbrtab[2];
-      Gnum                vflowgttab[2];
-      Gnum                levlnum;
-      int                 partval;
-
-      jobsubnum[0] = (Anum) (joborgptr - pooldat.jobtab);  /* Get current (and first son) job slot number before possible move of pointers */
-      joborgdat = *joborgptr;                     /* Save current job data (clone graph)                                                   */
-
-      if (archDomBipart (mappptr->archptr, &joborgdat.domnorg, &domnsubtab[0], &domnsubtab[1]) != 0) {
-        errorPrint ("kgraphMapRbMap: cannot bipartition domain");
-        kgraphMapRbMapPoolExit (&pooldat);        /* Copied graph will be freed as not yet removed */
-        return (1);
-      }
-
-      kgraphMapRbVfloSplit (mappptr->archptr, domnsubtab, /* Split fixed vertex load slots, if any */
-                            joborgdat.vflonbr, joborgdat.vflotab, vflonbrtab, vflowgttab);
-      if (kgraphMapRbBgraph (dataptr, &actgrafdat, &joborgdat.grafdat, pooldat.mappptr, domnsubtab, vflowgttab, contptr) != 0) { /* Create bipartition graph */
-        errorPrint ("kgraphMapRbMap: cannot create bipartition graph");
-        kgraphMapRbMapPoolExit (&pooldat);        /* Copied graph will be freed as not yet removed */
-        return (1);
-      }
-
-      actgrafdat.s.flagval |= (joborgdat.grafdat.flagval & GRAPHFREETABS); /* Bipartition graph is responsible for freeing the cloned graph data fields */
-      joborgptr->poolflag = 0;                    /* Original slot is now considered unused so that cloned graph data will not be freed twice           */
-
-      if ((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) == 0) { /* If not variable-sized, impose constraints on bipartition */
-        double              comploadavg;
-
-        comploadavg = (double) actgrafdat.s.velosum / (double) archDomWght (mappptr->archptr, &joborgdat.domnorg);
-        actgrafdat.compload0min = actgrafdat.compload0avg -
-                                  (Gnum) MIN ((comploadmax - comploadavg) * (double) actgrafdat.domnwght[0],
-                                              (comploadavg - comploadmin) * (double) actgrafdat.domnwght[1]);
-        actgrafdat.compload0max = actgrafdat.compload0avg +
-                                  (Gnum) MIN ((comploadavg - comploadmin) * (double) actgrafdat.domnwght[0],
-                                              (comploadmax - comploadavg) * (double) actgrafdat.domnwght[1]);
-      }
-
-      if (bgraphBipartSt (&actgrafdat, dataptr->paraptr->strat) != 0) { /* Perform bipartitioning */
-        errorPrint             ("kgraphMapRbMap: cannot bipartition job");
-        bgraphExit             (&actgrafdat);
+    while ((joborgptr = kgraphMapRbMapPoolGet (pooldat.pooltab[0])) != NULL) { /* For all jobs in pool */
+      if (kgraphMapRbMap2 (&pooldat, joborgptr, 0, contptr) != 0) {
+        errorPrint             ("kgraphMapRbMap: cannot process job");
         kgraphMapRbMapPoolExit (&pooldat);
         return (1);
       }
-
-      if ((partval = 1, actgrafdat.compsize0 == 0) || /* If no bipartition found */
-          (partval = 0, actgrafdat.compsize0 == actgrafdat.s.vertnbr)) {
-        if ((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) != 0) { /* If architecture is variable-sized       */
-          pooldat.domntab[0][jobsubnum[0]] = joborgdat.domnorg; /* Propagate domain in next pool         */
-          kgraphMapRbMapPoolRemv (&pooldat, &joborgdat); /* Remove job from pool as long as graph exists */
-        }
-        else if (archDomSize (mappptr->archptr, &domnsubtab[partval]) <= 1) { /* If domain is terminal   */
-          pooldat.domntab[0][jobsubnum[0]] = domnsubtab[partval]; /* Refine domain in next pool          */
-          kgraphMapRbMapPoolRemv (&pooldat, &joborgdat); /* Remove job from pool as long as graph exists */
-        }
-        else {                                    /* Re-use job slot and graph for further bipartitioning */
-          pooldat.domntab[0][jobsubnum[0]] =      /* Update domain in next pool                           */
-          joborgptr->domnorg = domnsubtab[partval]; /* New job takes same graph and non-empty subdomain   */
-          joborgptr->vflonbr = vflonbrtab[partval];
-          joborgptr->vflotab = joborgdat.vflotab + (partval * vflonbrtab[0]); /* Point to proper sub-array */
-          joborgptr->levlnum ++;
-          kgraphMapRbMapPoolUpdt1 (&pooldat, &joborgdat, actgrafdat.parttax, joborgptr, partval); /* Add job to pool */
-          actgrafdat.s.flagval &= ~GRAPHFREETABS; /* Since graph will be re-used, never free its internal arrays     */
-        }
-        bgraphExit (&actgrafdat);                 /* Free bipartitioning data as well as current graph */
-        continue;                                 /* Process next job in current pool                  */
-      }
-
-      if ((pooldat.mappptr->domnnbr == pooldat.mappptr->domnmax) && /* If all job slots busy and if cannot resize */
-          (kgraphMapRbMapPoolResize (&pooldat) != 0)) { /* From this point, joborgptr may no longer be valid      */
-        errorPrint             ("kgraphMapRbMap: cannot resize structures");
-        kgraphMapRbMapPoolExit (&pooldat);
-        return (1);
-      }
-
-      jobsubnum[1] = pooldat.mappptr->domnnbr ++; /* Get slot number of new subdomain */
-      jobsubsiz[1] = actgrafdat.s.vertnbr - actgrafdat.compsize0;
-      jobsubsiz[0] = actgrafdat.compsize0;
-
-      pooldat.jobtab[jobsubnum[1]].poolflag = 0;  /* Assume that new job is inactive in case of premature freeing                           */
-      pooldat.domntab[1][jobsubnum[1]] = joborgdat.domnorg; /* Copy original domain to new subdomain as old mapping shares parttax with new */
-      pooldat.domntab[0][jobsubnum[0]] = domnsubtab[0]; /* Set subdomains of second mapping before relinking subjobs in pool                */
-      pooldat.domntab[0][jobsubnum[1]] = domnsubtab[1];
-
-      if ((pooldat.flagval & KGRAPHMAPRBMAPPARTHALF) != 0) /* If can only update second half */
-        kgraphMapRbMapPartOne (&pooldat, &actgrafdat, jobsubnum[1]);
-      else
-        kgraphMapRbMapPartBoth (&pooldat, &actgrafdat, jobsubnum);
-
-      levlnum = joborgdat.levlnum + 1;
-      for (i = 1; i >= 0; i --) {                 /* For both subdomains */
-        KgraphMapRbMapJob * jobsubptr;
-
-        jobsubptr = &pooldat.jobtab[jobsubnum[i]]; /* Point to subdomain job slot                                */
-        jobsubptr->poollink.prev =                /* Prevent Valgrind from yelling in kgraphMapRbMapPoolResize() */
-        jobsubptr->poollink.next = NULL;
-        jobsubptr->prioval =                      /* Prevent Valgrind from yelling in kgraphMapRbMapPoolRemv()/Updt1()/Updt2() */
-        jobsubptr->priolvl = 0;
-
-        if ((((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) == 0) && (archDomSize (mappptr->archptr, &domnsubtab[i]) <= 1)) || /* If single-vertex domain  */
-            (((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) != 0) && (jobsubsiz[i] <= 1))) { /* Or if variable-sized architecture with single vertex graph */
-          jobsubsiz[i] = 0;                       /* Cancel subjob */
-          continue;
-        }
-
-        partval = i;                              /* At least this subjob works */
-
-        if (graphInducePart (&actgrafdat.s, actgrafdat.parttax, jobsubsiz[i], (GraphPart) i, &jobsubptr->grafdat) != 0) {
-          errorPrint             ("kgraphMapRbMap: cannot create induced subgraph");
-          bgraphExit             (&actgrafdat);
-          kgraphMapRbMapPoolExit (&pooldat);
-          return (1);
-        }
-        jobsubptr->poolflag = 1;                  /* So that graph is freed in case of error on other part */
-        jobsubptr->domnorg  = domnsubtab[i];
-        jobsubptr->vflonbr  = vflonbrtab[i];
-        jobsubptr->vflotab  = joborgdat.vflotab + (i * vflonbrtab[0]); /* Point to proper sub-array */
-        jobsubptr->levlnum  = levlnum;            /* Set new level */
+#ifdef SCOTCH_PTHREAD
+      if ((pooldat.thrdnbr > 1) &&                /* If enough jobs to keep all threads busy */
+          (kgraphMapRbMapPoolCount (&pooldat, KGRAPHMAPRBMAPTHRDJOBMIN * pooldat.thrdnbr) >= (KGRAPHMAPRBMAPTHRDJOBMIN * pooldat.thrdnbr))) {
+        thrdflag = 1;
+        break;
       }
-
-      if ((jobsubsiz[0] | jobsubsiz[1]) == 0)     /* If both subjobs do not need further processing */
-        kgraphMapRbMapPoolRemv (&pooldat, &joborgdat);
-      else if (jobsubsiz[1 - partval] == 0)       /* If one of the subjobs only needs further processing */
-        kgraphMapRbMapPoolUpdt1 (&pooldat, &joborgdat, actgrafdat.parttax, &pooldat.jobtab[jobsubnum[partval]], (GraphPart) partval);
-      else
-        kgraphMapRbMapPoolUpdt2 (&pooldat, &joborgdat, actgrafdat.parttax, &pooldat.jobtab[jobsubnum[0]], &pooldat.jobtab[jobsubnum[1]]);
-
-      bgraphExit (&actgrafdat);                   /* Free bipartition graph data */
+#endif /* SCOTCH_PTHREAD */
     }
+    if (thrdflag != 0)                            /* Keep pools as is */
+      break;
 
     kgraphMapRbMapPoolSwap (&pooldat);            /* Swap current and next levels */
   }
 
+#ifdef SCOTCH_PTHREAD
+  if ((thrdflag != 0) &&
+      (kgraphMapRbMapThreads (&pooldat, contptr) != 0)) {
+    errorPrint             ("kgraphMapRbMap: cannot process jobs concurrently");
+    kgraphMapRbMapPoolExit (&pooldat);
+    return (1);
+  }
+#endif /* SCOTCH_PTHREAD */
+
   kgraphMapRbMapPoolExit (&pooldat);              /* Free internal structures and propagate back new partition */
 
   return (0);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -68,7 +68,7 @@
 /**                # Version 6.1  : from : 28 jun 2021     **/
 /**                                 to   : 28 jun 2021     **/
 /**                # Version 7.0  : from : 14 jan 2020     **/
-/**                                 to   : 16 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,6 +82,13 @@
 #define KGRAPHMAPRBMAPARCHCMPLT     0x0002        /* Complete-graph architecture                         */
 #define KGRAPHMAPRBMAPPARTHALF      0x0004        /* Only update half of part array as mappings are tied */
 
+/*+ Minimum number of pending jobs per thread
+    before jobs are processed concurrently, each
+    by a single thread, rather than one after the
+    other by all threads of the context.         +*/
+
+#define KGRAPHMAPRBMAPTHRDJOBMIN    2
+
 /*
 **  The type and structure definitions.
 */
@@ -110,11 +117,26 @@ typedef struct KgraphMapRbMapJob_ {
   Gnum                      levlnum;              /*+ Level of this job                        +*/
 } KgraphMapRbMapJob;
 
+/*+ This structure defines the job queue of a
+    worker thread, when jobs are processed
+    concurrently. Jobs in a queue point to it
+    through their pool pointer, and the queue
+    lock protects both the list and the priority
+    values of the jobs it holds.                 +*/
+
+typedef struct KgraphMapRbMapPoolQueue_ {
+  KgraphMapRbMapPoolLink    linkdat;              /*+ List of jobs in queue; TRICK: FIRST +*/
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_t           lockdat;              /*+ Lock for list and job priorities    +*/
+#endif /* SCOTCH_PTHREAD */
+} KgraphMapRbMapPoolQueue;
+
 /*+ This structure defines the working data,
     for easier parameter passing.            +*/
 
 typedef struct KgraphMapRbMapPoolData_ {
   int                       flagval;              /*+ Pool flag value                            +*/
+  const KgraphMapRbData *   dataptr;              /*+ Global mapping data                        +*/
   KgraphMapRbPolicy         polival;              /*+ Job selection policy                       +*/
   const Graph *             grafptr;              /*+ Pointer to top graph                       +*/
   const Anum *              pfixtax;              /*+ Pointer to fixed part array                +*/
@@ -125,6 +147,17 @@ typedef struct KgraphMapRbMapPoolData_ {
   Mapping *                 mappptr;              /*+ Pointer to original mapping: current state +*/
   ArchDom                   domnorg;              /*+ Original domain to map                     +*/
   Context *                 contptr;
+  KgraphMapRbMapPoolQueue * queutab;              /*+ Pairs of per-thread queues, if concurrent  +*/
+  int                       queunum[2];           /*+ Indices of current and next queues in pair +*/
+  Anum                      jobnbrtab[2];         /*+ Numbers of queued jobs, by queue index     +*/
+  Anum                      jobactnbr;            /*+ Number of jobs being processed             +*/
+  int                       thrdnbr;              /*+ Number of worker threads; 1 if sequential  +*/
+  int                       abrtval;              /*+ Abort value                                +*/
+  int                       levlflag;             /*+ Flag set if next level is to be processed  +*/
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_t           lockdat;              /*+ Lock for job counters and domain slots     +*/
+  pthread_cond_t            conddat;              /*+ Wake-up condition for idle threads         +*/
+#endif /* SCOTCH_PTHREAD */
 } KgraphMapRbMapPoolData;
 
 /*
@@ -134,12 +167,21 @@ typedef struct KgraphMapRbMapPoolData_ {
 #ifdef SCOTCH_KGRAPH_MAP_RB_MAP
 static int                  kgraphMapRbMapPoolInit (KgraphMapRbMapPoolData * restrict const, const KgraphMapRbData * restrict const, Context * const);
 static void                 kgraphMapRbMapPoolExit (KgraphMapRbMapPoolData * restrict const poolptr);
+static void                 kgraphMapRbMapPoolExit2 (KgraphMapRbMapPoolData * restrict const poolptr);
 static void                 kgraphMapRbMapPoolAdd (KgraphMapRbMapPoolLink * restrict const, KgraphMapRbMapJob * const);
-static KgraphMapRbMapJob *  kgraphMapRbMapPoolGet (KgraphMapRbMapPoolData * restrict const);
+static KgraphMapRbMapJob *  kgraphMapRbMapPoolGet (KgraphMapRbMapPoolLink * const);
 static void                 kgraphMapRbMapPoolFrst (KgraphMapRbMapPoolData * const, KgraphMapRbMapJob * const);
-static void                 kgraphMapRbMapPoolUpdt1 (KgraphMapRbMapPoolData * const, const KgraphMapRbMapJob * const, const GraphPart * const, KgraphMapRbMapJob * const, const GraphPart);
-static void                 kgraphMapRbMapPoolUpdt2 (KgraphMapRbMapPoolData * const, const KgraphMapRbMapJob * const, const GraphPart * const, KgraphMapRbMapJob * const, KgraphMapRbMapJob * const);
+static void                 kgraphMapRbMapPoolUpdt1 (KgraphMapRbMapPoolData * const, const KgraphMapRbMapJob * const, const GraphPart * const, KgraphMapRbMapJob * const, const GraphPart, const int, Context * const);
+static void                 kgraphMapRbMapPoolUpdt2 (KgraphMapRbMapPoolData * const, const KgraphMapRbMapJob * const, const GraphPart * const, KgraphMapRbMapJob * const, KgraphMapRbMapJob * const, const int, Context * const);
 static int                  kgraphMapRbMapPoolResize (KgraphMapRbMapPoolData * restrict const);
+static int                  kgraphMapRbMap2     (KgraphMapRbMapPoolData * restrict const, KgraphMapRbMapJob *, const int, Context * const);
+#ifdef SCOTCH_PTHREAD
+static int                  kgraphMapRbMapPoolLock (KgraphMapRbMapPoolData * const, KgraphMapRbMapPoolQueue ** const, const KgraphMapRbMapJob * const);
+static void                 kgraphMapRbMapPoolUnlock (KgraphMapRbMapPoolQueue ** const);
+static Anum                 kgraphMapRbMapPoolCount (KgraphMapRbMapPoolData * const, const Anum);
+static void                 kgraphMapRbMapThread (Context * const, ThreadDescriptor * const, KgraphMapRbMapPoolData * const);
+static int                  kgraphMapRbMapThreads (KgraphMapRbMapPoolData * const, Context * const);
+#endif /* SCOTCH_PTHREAD */
 #endif /* SCOTCH_KGRAPH_MAP_RB_MAP */
 
 int                         kgraphMapRbMap      (const KgraphMapRbData * restrict const, const Graph * restrict const, const Anum, KgraphMapRbVflo * restrict const, Context * restrict const);
@@ -149,3 +191,11 @@ int                         kgraphMapRbMap      (const KgraphMapRbData * restric
 */
 
 #define kgraphMapRbMapPoolEmpty(poolptr) ((poolptr)->pooltab[0]->next == &kgraphmaprbmappooldummy)
+
+#ifdef SCOTCH_PTHREAD
+#define kgraphMapRbMapPoolActive(poolptr,queuptr,jobptr) (((poolptr)->queutab != NULL) ? kgraphMapRbMapPoolLock ((poolptr), (queuptr), (jobptr)) : ((jobptr)->poolflag != 0))
+#define kgraphMapRbMapPoolRelease(queuptr) kgraphMapRbMapPoolUnlock (queuptr)
+#else /* SCOTCH_PTHREAD */
+#define kgraphMapRbMapPoolActive(poolptr,queuptr,jobptr) ((void) (queuptr), ((jobptr)->poolflag != 0))
+#define kgraphMapRbMapPoolRelease(queuptr)
+#endif /* SCOTCH_PTHREAD */
@@ -1,4 +1,4 @@
-/* Copyright 2008,2011,2014,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2011,2014,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 28 jun 2021     **/
 /**                                 to   : 28 jun 2021     **/
 /**                # Version 7.0  : from : 03 may 2021     **/
-/**                                 to   : 16 jul 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This is a rewrite of kgraphMapRb()    **/
 /**                  for complete-graph target topologies. **/
@@ -214,6 +214,8 @@ KgraphMapRbPartSplit * const  spltptr)
   Anum                  vflonbrtab[2];            /* Number of fixed vertex slots in subdomains  */
   Gnum                  vflowgttab[2];            /* Weights of fixed vertex slots in subdomains */
   KgraphMapRbPartSplit  spltdat;                  /* Parameters for context splitting            */
+  MemArena *            arenptr;                  /* Memory arena of context leader thread       */
+  MemArenaMark          markdat;                  /* Arena state to return to when done          */
   int                   avarval;                  /* Flag set if variable-sized                  */
   GraphPart             partval;
   int                   o;
@@ -240,19 +242,27 @@ KgraphMapRbPartSplit * const  spltptr)
       goto end3;
   }
 
+  if ((arenptr = contextArena (contptr)) == NULL) { /* Induced and bipartition graphs are stacked on arena */
+    errorPrint ("kgraphMapRbPart2: out of memory");
+    o = 1;
+    goto end3;
+  }
+  memArenaMark (arenptr, &markdat);
+
   indgrafptr = srcgrafptr;                        /* Assume we will work on the original graph */
   if ((srcparttax != NULL) &&                     /* If not the case, build induced subgraph   */
       (indvertnbr < srcgrafptr->vertnbr)) {
     indgrafptr = &indgrafdat;
-    if ((o = graphInducePart (srcgrafptr, srcparttax, indvertnbr, indpartval, &indgrafdat)) != 0) {
+    if ((o = graphInducePart2 (srcgrafptr, srcparttax, indvertnbr, indpartval, &indgrafdat, arenptr, contptr)) != 0) {
       errorPrint ("kgraphMapRbPart2: cannot induce graph");
+      memArenaRelease (arenptr, &markdat);
       goto end3;
     }
   }
 
   kgraphMapRbVfloSplit (mappptr->archptr, domnsubtab, spltptr->splttab[spltnum].vflonbr, spltptr->splttab[spltnum].vflotab, vflonbrtab, vflowgttab);
 
-  if ((o = kgraphMapRbBgraph (spltptr->dataptr, &actgrafdat, indgrafptr, mappptr, domnsubtab, vflowgttab, contptr)) != 0) { /* Create active graph */
+  if ((o = kgraphMapRbBgraph (spltptr->dataptr, &actgrafdat, indgrafptr, mappptr, domnsubtab, vflowgttab, arenptr, contptr)) != 0) { /* Create active graph */
     errorPrint ("kgraphMapRbPart2: cannot create bipartition graph");
     goto end2;
   }
@@ -275,8 +285,10 @@ KgraphMapRbPartSplit * const  spltptr)
     errorPrint ("kgraphMapRbPart2: cannot bipartition graph");
     goto end1;
   }
-  memFree (actgrafdat.frontab);                   /* Frontier array of bipartitioning graph is no longer necessary */
+  if ((actgrafdat.s.flagval & BGRAPHFREEFRON) != 0) /* Frontier array of bipartitioning graph is no longer necessary */
+    memFree (actgrafdat.frontab);                 /* Arena space will only be reclaimed on return                  */
   actgrafdat.s.flagval &= ~BGRAPHFREEFRON;
+  actgrafdat.frontab    = NULL;
 
   spltdat.splttab[0].vertnbr = actgrafdat.compsize0; /* Prepare the two subjobs */
   spltdat.splttab[0].vflonbr = vflonbrtab[0];
@@ -293,6 +305,7 @@ KgraphMapRbPartSplit * const  spltptr)
       bgraphExit (&actgrafdat);                   /* Free bipartition graph (that is, parttax) */
       if (indgrafptr == &indgrafdat)              /* If an induced subgraph had been created   */
         graphExit (&indgrafdat);                  /* Free it                                   */
+      memArenaRelease (arenptr, &markdat);        /* Pop arena before retrying                 */
 
       spltptr->splttab[spltnum].vflonbr = spltdat.splttab[partval].vflonbr; /* Restrict to non-empty subdomain (vertnbr unchanged) */
       spltptr->splttab[spltnum].vflotab = spltdat.splttab[partval].vflotab;
@@ -326,6 +339,7 @@ end1:
 end2:
   if (indgrafptr == &indgrafdat)                  /* If an induced subgraph had been created */
     graphExit (&indgrafdat);                      /* Free it                                 */
+  memArenaRelease (arenptr, &markdat);            /* Release arena space in LIFO order       */
 end3:
   if (o != 0) {                                   /* Lock only to Propagate errors */
 #ifdef SCOTCH_PTHREAD
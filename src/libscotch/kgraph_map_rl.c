@@ -0,0 +1,255 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_rl.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a mapping of the   **/
+/**                given k-way mapping graph by relabeling **/
+/**                its vertices so as to improve memory    **/
+/**                locality, applying the mapping strategy **/
+/**                to the relabeled graph, and projecting  **/
+/**                back the obtained mapping to the        **/
+/**                original graph.                         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "arch.h"
+#include "graph.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_rl.h"
+#include "kgraph_map_st.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine relabels the vertices of the
+** graph, applies the mapping strategy to the
+** relabeled graph, and propagates back the
+** resulting mapping to the original graph.
+** Graphs which are subgraphs of some ancestor
+** graph, or which contain anchor vertices,
+** are mapped in place.
+** It returns:
+** - 0   : if the mapping could be computed.
+** - !0  : on error.
+*/
+
+int
+kgraphMapRl (
+Kgraph * const                      orggrafptr,   /*+ Graph             +*/
+const KgraphMapRlParam * const      paraptr)      /*+ Method parameters +*/
+{
+  Kgraph                    prmgrafdat;           /* Relabeled graph                   */
+  Gnum * restrict           permtax;              /* Direct permutation array          */
+  Gnum * restrict           peritax;              /* Inverse permutation array         */
+  Anum * restrict           prmparttax;
+  Gnum                      prmvertnum;
+  Gnum                      fronnum;
+  int                       o;
+
+  const Gnum                baseval = orggrafptr->s.baseval;
+  const Gnum                vertnbr = orggrafptr->s.vertnbr;
+
+  if ((orggrafptr->s.vnumtax != NULL) ||          /* If graph numbering is bound to that of an ancestor graph */
+      ((orggrafptr->s.flagval & KGRAPHHASANCHORS) != 0) || /* Or if anchor vertices must remain last      */
+      (vertnbr < 2))                              /* Or if nothing to relabel                               */
+    return (kgraphMapSt (orggrafptr, paraptr->strat));
+
+  if (memAllocGroup ((void **) (void *)
+                     &permtax, (size_t) (vertnbr * sizeof (Gnum)),
+                     &peritax, (size_t) (vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kgraphMapRl: out of memory (1)");
+    return (1);
+  }
+  permtax -= baseval;
+  peritax -= baseval;
+
+  if (graphPermCompute (&orggrafptr->s, orggrafptr->s.vertnnd, paraptr->typeval, permtax, peritax) != 0) {
+    errorPrint ("kgraphMapRl: cannot compute permutation");
+    memFree    (permtax + baseval);
+    return (1);
+  }
+  if (graphPerm (&orggrafptr->s, permtax, peritax, &prmgrafdat.s) != 0) {
+    errorPrint ("kgraphMapRl: cannot build relabeled graph");
+    memFree    (permtax + baseval);
+    return (1);
+  }
+  prmgrafdat.s.vnumtax = NULL;                    /* Relabeled graph is the new original graph; TRICK: array freed along with group */
+
+  prmgrafdat.domnorg     = orggrafptr->domnorg;
+  prmgrafdat.r.crloval   = orggrafptr->r.crloval;
+  prmgrafdat.r.cmloval   = orggrafptr->r.cmloval;
+  prmgrafdat.r.vmlotax   = NULL;
+  prmgrafdat.vfixnbr     = orggrafptr->vfixnbr;
+  prmgrafdat.pfixtax     = NULL;
+  prmgrafdat.fronnbr     = orggrafptr->fronnbr;
+  prmgrafdat.frontab     = NULL;
+  prmgrafdat.comploadavg = orggrafptr->comploadavg; /* Share target load arrays; they are transferred back afterwards */
+  prmgrafdat.comploaddlt = orggrafptr->comploaddlt;
+  prmgrafdat.comploadrat = orggrafptr->comploadrat;
+  prmgrafdat.commload    = orggrafptr->commload;
+  prmgrafdat.kbalval     = orggrafptr->kbalval;
+  prmgrafdat.levlnum     = orggrafptr->levlnum;
+  prmgrafdat.contptr     = orggrafptr->contptr;
+  mapInit2 (&prmgrafdat.m,   &prmgrafdat.s, orggrafptr->m.archptr,   orggrafptr->m.domnmax,   orggrafptr->m.domnnbr);
+  mapInit2 (&prmgrafdat.r.m, &prmgrafdat.s, orggrafptr->r.m.archptr, orggrafptr->r.m.domnmax, orggrafptr->r.m.domnnbr);
+
+  if ((prmgrafdat.frontab = memAlloc (vertnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("kgraphMapRl: out of memory (2)");
+    goto abort;
+  }
+  prmgrafdat.s.flagval |= KGRAPHFREEFRON;
+  for (fronnum = 0; fronnum < orggrafptr->fronnbr; fronnum ++)
+    prmgrafdat.frontab[fronnum] = permtax[orggrafptr->frontab[fronnum]];
+
+  if (orggrafptr->m.parttax != NULL) {            /* If an initial mapping is present, permute it */
+    if ((prmparttax = memAlloc (vertnbr * sizeof (Anum))) == NULL) {
+      errorPrint ("kgraphMapRl: out of memory (3)");
+      goto abort;
+    }
+    prmparttax -= baseval;
+    for (prmvertnum = baseval; prmvertnum < prmgrafdat.s.vertnnd; prmvertnum ++)
+      prmparttax[prmvertnum] = orggrafptr->m.parttax[peritax[prmvertnum]];
+    prmgrafdat.m.parttax  = prmparttax;
+    prmgrafdat.m.flagval |= MAPPINGFREEPART;
+  }
+
+  if (orggrafptr->r.m.parttax != NULL) {          /* If doing a repartitioning, permute old mapping */
+    if ((prmparttax = memAlloc (vertnbr * sizeof (Anum))) == NULL) {
+      errorPrint ("kgraphMapRl: out of memory (4)");
+      goto abort;
+    }
+    prmparttax -= baseval;
+    for (prmvertnum = baseval; prmvertnum < prmgrafdat.s.vertnnd; prmvertnum ++)
+      prmparttax[prmvertnum] = orggrafptr->r.m.parttax[peritax[prmvertnum]];
+    prmgrafdat.r.m.parttax = prmparttax;
+    prmgrafdat.r.m.domntab = orggrafptr->r.m.domntab; /* Old mapping domain array is shared (no freeing) */
+    prmgrafdat.r.m.flagval = (orggrafptr->r.m.flagval & MAPPINGINCOMPLETE) | MAPPINGFREEPART;
+  }
+
+  if (orggrafptr->r.vmlotax != NULL) {
+    Gnum * restrict     prmvmlotax;
+
+    if ((prmvmlotax = memAlloc (vertnbr * sizeof (Gnum))) == NULL) {
+      errorPrint ("kgraphMapRl: out of memory (5)");
+      goto abort;
+    }
+    prmvmlotax -= baseval;
+    for (prmvertnum = baseval; prmvertnum < prmgrafdat.s.vertnnd; prmvertnum ++)
+      prmvmlotax[prmvertnum] = orggrafptr->r.vmlotax[peritax[prmvertnum]];
+    prmgrafdat.r.vmlotax  = prmvmlotax;
+    prmgrafdat.s.flagval |= KGRAPHFREEVMLO;
+  }
+
+  if (orggrafptr->pfixtax != NULL) {
+    Anum * restrict     prmpfixtax;
+
+    if ((prmpfixtax = memAlloc (vertnbr * sizeof (Anum))) == NULL) {
+      errorPrint ("kgraphMapRl: out of memory (6)");
+      goto abort;
+    }
+    prmpfixtax -= baseval;
+    for (prmvertnum = baseval; prmvertnum < prmgrafdat.s.vertnnd; prmvertnum ++)
+      prmpfixtax[prmvertnum] = orggrafptr->pfixtax[peritax[prmvertnum]];
+    prmgrafdat.pfixtax    = prmpfixtax;
+    prmgrafdat.s.flagval |= KGRAPHFREEPFIX;
+  }
+
+  prmgrafdat.m.flagval |= orggrafptr->m.flagval & MAPPINGFREEDOMN; /* Transfer mapping domain array to relabeled graph */
+  prmgrafdat.m.domntab  = orggrafptr->m.domntab;
+  orggrafptr->m.flagval &= ~MAPPINGFREEDOMN;
+  orggrafptr->m.domntab  = NULL;
+
+  o = kgraphMapSt (&prmgrafdat, paraptr->strat);  /* Map relabeled graph */
+
+  orggrafptr->m.flagval |= prmgrafdat.m.flagval & MAPPINGFREEDOMN; /* Transfer (potentially updated) mapping domain array back */
+  orggrafptr->m.domntab  = prmgrafdat.m.domntab;
+  orggrafptr->m.domnnbr  = prmgrafdat.m.domnnbr;
+  orggrafptr->m.domnmax  = prmgrafdat.m.domnmax;
+  prmgrafdat.m.domntab   = NULL;
+  orggrafptr->comploadavg = prmgrafdat.comploadavg; /* Propagate target load arrays, which may have been reallocated */
+  orggrafptr->comploaddlt = prmgrafdat.comploaddlt;
+
+  if (o != 0) {
+    errorPrint ("kgraphMapRl: cannot map relabeled graph");
+    goto abort;
+  }
+
+  if (mapAlloc (&orggrafptr->m) != 0) {           /* Allocate part array if not already present */
+    errorPrint ("kgraphMapRl: cannot allocate mapping arrays");
+    goto abort;
+  }
+  for (prmvertnum = baseval; prmvertnum < prmgrafdat.s.vertnnd; prmvertnum ++)
+    orggrafptr->m.parttax[peritax[prmvertnum]] = prmgrafdat.m.parttax[prmvertnum];
+  for (fronnum = 0; fronnum < prmgrafdat.fronnbr; fronnum ++)
+    orggrafptr->frontab[fronnum] = peritax[prmgrafdat.frontab[fronnum]];
+  orggrafptr->fronnbr  = prmgrafdat.fronnbr;
+  orggrafptr->commload = prmgrafdat.commload;
+  orggrafptr->kbalval  = prmgrafdat.kbalval;
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (orggrafptr) != 0) {
+    errorPrint ("kgraphMapRl: inconsistent graph data");
+    o = 1;
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  prmgrafdat.comploadavg = NULL;                  /* Target load arrays belong to original graph */
+  kgraphExit (&prmgrafdat);
+  memFree    (permtax + baseval);                 /* Free group leader */
+
+  return (o);
+
+abort:
+  prmgrafdat.comploadavg = NULL;
+  kgraphExit (&prmgrafdat);
+  memFree    (permtax + baseval);
+
+  return (1);
+}
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 09 feb 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +63,8 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_KGRAPH_MAP_ST
+
 #include "module.h"
 #include "common.h"
 #include "parser.h"
@@ -80,9 +82,12 @@
 #include "kgraph_map_df.h"
 #include "kgraph_map_ex.h"
 #include "kgraph_map_fm.h"
+#include "kgraph_map_jt.h"
 #include "kgraph_map_ml.h"
 #include "kgraph_map_rb.h"
+#include "kgraph_map_rl.h"
 #include "kgraph_map_st.h"
+#include "kgraph_map_vc.h"
 
 /*
 **  The static and global variables.
@@ -112,7 +117,12 @@ static union {
 static union {
   KgraphMapFmParam          param;
   StratNodeMethodData       padding;
-} kgraphmapstdefaultfm = { { 200, ~0, 0.05 } };
+} kgraphmapstdefaultfm = { { 200, ~0, 0.05, KGRAPHMAPFMTYPECUT } };
+
+static union {
+  KgraphMapJtParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultjt = { { 20, 0.05 } };
 
 static union {
   KgraphMapMlParam          param;
@@ -124,14 +134,27 @@ static union {
   StratNodeMethodData       padding;
 } kgraphmapstdefaultrb = { { 1, 1, KGRAPHMAPRBPOLINGSIZE, &stratdummy, 0.05 } };
 
+static union {
+  KgraphMapRlParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultrl = { { GRAPHPERMRCM, &stratdummy } };
+
+static union {
+  KgraphMapVcParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultvc = { { 100, 0.05 } };
+
 static StratMethodTab       kgraphmapstmethtab[] = { /* Mapping methods array */
                               { KGRAPHMAPSTMETHBD, "b",  (StratMethodFunc) kgraphMapBd, &kgraphmapstdefaultbd },
                               { KGRAPHMAPSTMETHCP, "c",  (StratMethodFunc) kgraphMapCp, &kgraphmapstdefaultcp },
                               { KGRAPHMAPSTMETHDF, "d",  (StratMethodFunc) kgraphMapDf, &kgraphmapstdefaultdf },
                               { KGRAPHMAPSTMETHEX, "x",  (StratMethodFunc) kgraphMapEx, &kgraphmapstdefaultex },
                               { KGRAPHMAPSTMETHFM, "f",  (StratMethodFunc) kgraphMapFm, &kgraphmapstdefaultfm },
+                              { KGRAPHMAPSTMETHJT, "j",  (StratMethodFunc) kgraphMapJt, &kgraphmapstdefaultjt },
                               { KGRAPHMAPSTMETHML, "m",  (StratMethodFunc) kgraphMapMl, &kgraphmapstdefaultml },
                               { KGRAPHMAPSTMETHRB, "r",  (StratMethodFunc) kgraphMapRb, &kgraphmapstdefaultrb },
+                              { KGRAPHMAPSTMETHRL, "l",  (StratMethodFunc) kgraphMapRl, &kgraphmapstdefaultrl },
+                              { KGRAPHMAPSTMETHVC, "v",  (StratMethodFunc) kgraphMapVc, &kgraphmapstdefaultvc },
                               { -1,                NULL, (StratMethodFunc) NULL,        NULL } };
 
 static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
@@ -175,6 +198,18 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                                 (byte *) &kgraphmapstdefaultfm.param,
                                 (byte *) &kgraphmapstdefaultfm.param.deltval,
                                 NULL },
+                              { KGRAPHMAPSTMETHFM,  STRATPARAMCASE,   "type",
+                                (byte *) &kgraphmapstdefaultfm.param,
+                                (byte *) &kgraphmapstdefaultfm.param.typeval,
+                                (void *) "cvm" },
+                              { KGRAPHMAPSTMETHJT,  STRATPARAMINT,    "pass",
+                                (byte *) &kgraphmapstdefaultjt.param,
+                                (byte *) &kgraphmapstdefaultjt.param.passnbr,
+                                NULL },
+                              { KGRAPHMAPSTMETHJT,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kgraphmapstdefaultjt.param,
+                                (byte *) &kgraphmapstdefaultjt.param.deltval,
+                                NULL },
                               { KGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.stratasc,
@@ -215,6 +250,22 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                                 (byte *) &kgraphmapstdefaultrb.param,
                                 (byte *) &kgraphmapstdefaultrb.param.strat,
                                 (void *) &bgraphbipartststratab },
+                              { KGRAPHMAPSTMETHRL,  STRATPARAMSTRAT,  "strat",
+                                (byte *) &kgraphmapstdefaultrl.param,
+                                (byte *) &kgraphmapstdefaultrl.param.strat,
+                                (void *) &kgraphmapststratab },
+                              { KGRAPHMAPSTMETHRL,  STRATPARAMCASE,   "type",
+                                (byte *) &kgraphmapstdefaultrl.param,
+                                (byte *) &kgraphmapstdefaultrl.param.typeval,
+                                (void *) "br" },
+                              { KGRAPHMAPSTMETHVC,  STRATPARAMINT,    "pass",
+                                (byte *) &kgraphmapstdefaultvc.param,
+                                (byte *) &kgraphmapstdefaultvc.param.passnbr,
+                                NULL },
+                              { KGRAPHMAPSTMETHVC,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kgraphmapstdefaultvc.param,
+                                (byte *) &kgraphmapstdefaultvc.param.kbalval,
+                                NULL },
                               { KGRAPHMAPSTMETHNBR, STRATPARAMINT,    NULL,
                                 NULL, NULL, NULL } };
 
@@ -243,6 +294,140 @@ StratTab                    kgraphmapststratab = { /* Strategy tables for graph
                               kgraphmapstparatab,
                               kgraphmapstcondtab };
 
+/**********************************************/
+/*                                            */
+/* These routines run the two branches of a   */
+/* selection operator in parallel.            */
+/*                                            */
+/**********************************************/
+
+/* This routine applies the strategy of the
+** given branch to its own copy of the active
+** graph, within the given sub-context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapSt2 (
+Context * restrict const            contptr,      /*+ (Sub-)context                          +*/
+const int                           spltnum,      /*+ Rank of sub-context in initial context +*/
+KgraphMapStSplit * restrict const   spltptr)
+{
+  Kgraph * restrict const grafptr = spltptr->splttab[spltnum].grafptr;
+  Context * const         contsav = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Assign new context to work graph */
+  spltptr->splttab[spltnum].revaval = kgraphMapSt (grafptr, spltptr->splttab[spltnum].straptr);
+  grafptr->contptr = contsav;
+}
+
+/* This routine runs concurrently the two
+** strategies of a selection operator, the
+** first one on the active graph and the second
+** one on a copy of it, which owns its mapping,
+** frontier and load arrays. Like in the
+** sequential case, the domain arrays of the
+** active graph are assumed to be large enough
+** to hold the mapping of any branch; if it is
+** not the case, the second strategy is deemed
+** to have failed. On return, the result of the
+** first strategy is saved in the given save
+** area, and the active graph holds the result
+** of the second strategy.
+** It returns:
+** - 0 : if the strategies were run concurrently.
+** - 1 : if they have to be run sequentially.
+*/
+
+static
+int
+kgraphMapSt3 (
+Kgraph * restrict const       grafptr,            /*+ Active graph                     +*/
+const Strat * restrict const  straptr,            /*+ Selection strategy               +*/
+KgraphStore * restrict const  saveptr,            /*+ Save area for first strategy     +*/
+int * restrict const          revatab)            /*+ Return values of both strategies +*/
+{
+  Kgraph              grafdat;                    /* Copy of active graph for second strategy */
+  KgraphMapStSplit    spltdat;                    /* Parameters for context splitting          */
+  const Gnum          baseval = grafptr->s.baseval;
+  const Gnum          vertnbr = grafptr->s.vertnbr;
+  const Anum          domnmax = grafptr->m.domnmax;
+
+  if ((contextThreadNbr (grafptr->contptr) <= 1) || /* If context cannot be split, run in sequence */
+      (grafptr->m.parttax == NULL) ||             /* Or if there is no mapping to copy yet         */
+      (grafptr->m.domntab == NULL))
+    return (1);
+
+  grafdat = *grafptr;                             /* Clone active graph with its own mapping and work arrays */
+  grafdat.s.flagval = (grafptr->s.flagval & ~(GRAPHFREETABS | KGRAPHFREEFRON | KGRAPHFREECOMP | KGRAPHFREEPFIX | KGRAPHFREEVMLO)) |
+                      KGRAPHFREEFRON | KGRAPHFREECOMP;
+  grafdat.comploadavg = NULL;
+  grafdat.r.m.grafptr = &grafdat.s;               /* Old mapping is shared, but must refer to graph copy */
+  mapInit2 (&grafdat.m, &grafdat.s, grafptr->m.archptr, domnmax, grafptr->m.domnnbr);
+  if ((mapAlloc (&grafdat.m) != 0) ||
+      ((grafdat.frontab = memAlloc (vertnbr * sizeof (Gnum))) == NULL) ||
+      (memAllocGroup ((void **) (void *)
+                      &grafdat.comploadavg, (size_t) (domnmax * sizeof (Gnum)),
+                      &grafdat.comploaddlt, (size_t) (domnmax * sizeof (Gnum)), NULL) == NULL)) {
+    if (grafdat.frontab != grafptr->frontab)      /* If frontier array allocated */
+      memFree (grafdat.frontab);
+    mapExit (&grafdat.m);
+    return (1);                                   /* Not enough memory: fall back to sequential processing */
+  }
+  grafdat.m.flagval |= grafptr->m.flagval & MAPPINGINCOMPLETE;
+  memCpy (grafdat.m.parttax + baseval, grafptr->m.parttax + baseval, vertnbr * sizeof (Anum)); /* Set initial mapping */
+  memCpy (grafdat.m.domntab, grafptr->m.domntab, grafptr->m.domnnbr * sizeof (ArchDom));
+  memCpy (grafdat.comploadavg, grafptr->comploadavg, domnmax * sizeof (Gnum));
+  memCpy (grafdat.comploaddlt, grafptr->comploaddlt, domnmax * sizeof (Gnum));
+  memCpy (grafdat.frontab, grafptr->frontab, grafptr->fronnbr * sizeof (Gnum));
+
+  spltdat.splttab[0].grafptr = grafptr;
+  spltdat.splttab[0].straptr = straptr->data.seledat.stratab[0];
+  spltdat.splttab[1].grafptr = &grafdat;
+  spltdat.splttab[1].straptr = straptr->data.seledat.stratab[1];
+
+  if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) kgraphMapSt2, &spltdat) != 0) {
+    memFree (grafdat.comploadavg);
+    memFree (grafdat.frontab);
+    mapExit (&grafdat.m);
+    return (1);
+  }
+
+  revatab[0] = spltdat.splttab[0].revaval;
+  revatab[1] = spltdat.splttab[1].revaval;
+
+  kgraphStoreSave (grafptr, saveptr);             /* Save result of first strategy */
+
+  if ((grafdat.m.domnnbr > grafptr->m.domnmax) || /* If result of second strategy cannot fit */
+      (grafptr->m.parttax == NULL) || (grafptr->m.domntab == NULL))
+    revatab[1] = 1;                               /* Consider it as failed */
+  else {                                          /* Get result of second strategy */
+    grafptr->m.domnnbr = grafdat.m.domnnbr;
+    grafptr->fronnbr   = grafdat.fronnbr;
+    grafptr->commload  = grafdat.commload;
+    grafptr->kbalval   = grafdat.kbalval;
+    if (grafdat.m.domnnbr > 0) {
+      memCpy (grafptr->m.parttax + baseval, grafdat.m.parttax + baseval, vertnbr * sizeof (Anum));
+      memCpy (grafptr->m.domntab,           grafdat.m.domntab,           grafdat.m.domnnbr * sizeof (ArchDom));
+      memCpy (grafptr->comploadavg,         grafdat.comploadavg,         grafdat.m.domnnbr * sizeof (Gnum));
+      memCpy (grafptr->comploaddlt,         grafdat.comploaddlt,         grafdat.m.domnnbr * sizeof (Gnum));
+      memCpy (grafptr->frontab,             grafdat.frontab,             grafdat.fronnbr   * sizeof (Gnum));
+    }
+  }
+
+  if (((grafdat.s.flagval & KGRAPHFREECOMP) != 0) && /* Free copy arrays, which may have been replaced by methods */
+      (grafdat.comploadavg != NULL))
+    memFree (grafdat.comploadavg);
+  if (((grafdat.s.flagval & KGRAPHFREEFRON) != 0) &&
+      (grafdat.frontab != NULL))
+    memFree (grafdat.frontab);
+  mapExit (&grafdat.m);
+
+  return (0);
+}
+
 /****************************************/
 /*                                      */
 /* This is the generic mapping routine. */
@@ -265,6 +450,9 @@ const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
   StratTest           testdat;                    /* Result of condition evaluation         */
   KgraphStore         savetab[2];                 /* Results of the two strategies          */
   Gnum                comploaddltasu[2];          /* Absolute sum of computation load delta */
+#ifndef KGRAPHMAPSTNOTHREAD
+  int                 revatab[2];                 /* Return values of concurrent strategies */
+#endif /* KGRAPHMAPSTNOTHREAD */
   Anum                partnum;
   int                 o;
   int                 o0;
@@ -324,11 +512,20 @@ const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
         return (1);
       }
 
-      kgraphStoreSave  (grafptr, &savetab[1]);    /* Save initial mapping                    */
-      o0 = kgraphMapSt (grafptr, straptr->data.seledat.stratab[0]); /* Apply first strategy  */
-      kgraphStoreSave  (grafptr, &savetab[0]);    /* Save its result                         */
-      kgraphStoreUpdt  (grafptr, &savetab[1]);    /* Restore initial mapping                 */
-      o1 = kgraphMapSt (grafptr, straptr->data.seledat.stratab[1]); /* Apply second strategy */
+      kgraphStoreSave (grafptr, &savetab[1]);     /* Save initial mapping */
+#ifndef KGRAPHMAPSTNOTHREAD
+      if (kgraphMapSt3 (grafptr, straptr, &savetab[0], revatab) == 0) { /* If both strategies could be run concurrently */
+        o0 = revatab[0];
+        o1 = revatab[1];
+      }
+      else
+#endif /* KGRAPHMAPSTNOTHREAD */
+      {
+        o0 = kgraphMapSt (grafptr, straptr->data.seledat.stratab[0]); /* Apply first strategy  */
+        kgraphStoreSave  (grafptr, &savetab[0]);  /* Save its result                           */
+        kgraphStoreUpdt  (grafptr, &savetab[1]);  /* Restore initial mapping                   */
+        o1 = kgraphMapSt (grafptr, straptr->data.seledat.stratab[1]); /* Apply second strategy */
+      }
 
       if ((o0 | o1) != 0) {                       /* If at least one method failed */
         if (o0 == 0)                              /* If first succeeded, take it   */
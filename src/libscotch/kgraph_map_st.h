@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 08 jun 2011     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 07 nov 2024     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,11 +68,28 @@ typedef enum KgraphMapStMethodType_ {
   KGRAPHMAPSTMETHDF,                              /*+ Diffusion                     +*/
   KGRAPHMAPSTMETHEX,                              /*+ Exactifier                    +*/
   KGRAPHMAPSTMETHFM,                              /*+ Fiduccia-Mattheyses           +*/
+  KGRAPHMAPSTMETHJT,                              /*+ Parallel refinement           +*/
   KGRAPHMAPSTMETHML,                              /*+ Multi-level (strategy)        +*/
   KGRAPHMAPSTMETHRB,                              /*+ Dual Recursive Bipartitioning +*/
+  KGRAPHMAPSTMETHRL,                              /*+ Locality relabeling           +*/
+  KGRAPHMAPSTMETHVC,                              /*+ Multi-constraint balancing    +*/
   KGRAPHMAPSTMETHNBR                              /*+ Number of methods             +*/
 } KgraphMapStMethodType;
 
+/*+ This structure holds the splitting
+    parameters for running concurrently
+    both branches of a selection operator. +*/
+
+typedef struct KgraphMapStSplit2_ {
+  Kgraph *                  grafptr;              /*+ Active graph to work on  +*/
+  const Strat *             straptr;              /*+ Strategy to apply        +*/
+  int                       revaval;              /*+ Return value of strategy +*/
+} KgraphMapStSplit2;
+
+typedef struct KgraphMapStSplit_ {
+  KgraphMapStSplit2         splttab[2];           /*+ Data for both branches +*/
+} KgraphMapStSplit;
+
 /*+ Method function pointer type. +*/
 
 typedef int (* KgraphMapFunc) (Kgraph * restrict const, const void * const);
@@ -87,4 +104,9 @@ extern StratTab             kgraphmapststratab;
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_KGRAPH_MAP_ST
+static void                 kgraphMapSt2        (Context * restrict const, const int, KgraphMapStSplit * restrict const);
+static int                  kgraphMapSt3        (Kgraph * restrict const, const Strat * restrict const, KgraphStore * restrict const, int * restrict const);
+#endif /* SCOTCH_KGRAPH_MAP_ST */
+
 int                         kgraphMapSt         (Kgraph * restrict const, const Strat * restrict const);
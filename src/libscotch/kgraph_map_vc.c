@@ -0,0 +1,355 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_vc.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module balances the parts of a     **/
+/**                k-way mapping with respect to each of   **/
+/**                the vertex load constraints of the      **/
+/**                graph, by moving frontier vertices out  **/
+/**                of overloaded parts.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KGRAPH_MAP_VC
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_vc.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes the variation of the
+** overall balance penalty of the mapping when
+** moving a vertex of given constraint loads
+** from one domain to another. The penalty is
+** the sum, over all constraints and domains,
+** of the squared deviations of the normalized
+** domain loads with respect to their targets,
+** weighted by the inverse of the targets. As
+** it is convex, local moves that decrease it
+** diffuse load from the most loaded domains
+** to their less loaded neighbors.
+** It returns:
+** - the penalty variation : in all cases.
+*/
+
+static
+double
+kgraphMapVcDelta (
+const Gnum * restrict const   vloatab,            /*+ Current constraint loads of domains  +*/
+const double * restrict const vtgttab,            /*+ Normalized target loads of domains   +*/
+const double * restrict const vcsctab,            /*+ Normalization factors of constraints +*/
+const Gnum * restrict const   vconptr,            /*+ Constraint loads of moved vertex     +*/
+const Gnum                    vconnbr,            /*+ Number of constraints                +*/
+const Anum                    partorg,            /*+ Domain vertex is moved from          +*/
+const Anum                    partdst)            /*+ Domain vertex is moved to            +*/
+{
+  double              deltval;
+  Gnum                vconnum;
+
+  const double        vtgtorg = vtgttab[partorg];
+  const double        vtgtdst = vtgttab[partdst];
+
+  for (vconnum = 0, deltval = 0.0; vconnum < vconnbr; vconnum ++) {
+    double              vconval;
+    double              vdlporg;                  /* Deviations of domains with respect to their targets */
+    double              vdlpdst;
+
+    if (vconptr[vconnum] == 0)                    /* Move does not change this constraint */
+      continue;
+
+    vconval = (double) vconptr[vconnum] * vcsctab[vconnum];
+    vdlporg = (double) vloatab[partorg * vconnbr + vconnum] * vcsctab[vconnum] - vtgtorg;
+    vdlpdst = (double) vloatab[partdst * vconnbr + vconnum] * vcsctab[vconnum] - vtgtdst;
+
+    deltval += vconval * (vconval - 2.0 * vdlporg) / vtgtorg +
+               vconval * (vconval + 2.0 * vdlpdst) / vtgtdst;
+  }
+
+  return (deltval);
+}
+
+/* This routine performs the multi-constraint
+** load balancing of the current mapping. At
+** each pass, every vertex of a domain that is
+** overloaded with respect to some constraint
+** that this vertex bears is considered for a
+** move to a neighboring domain, provided that
+** this move decreases the overall normalized
+** overload. Candidate moves are then applied
+** by decreasing communication gain, as long as
+** they remain profitable with respect to the
+** updated domain loads.
+** It returns:
+** - 0 : if mapping could be computed.
+** - 1 : on error.
+*/
+
+int
+kgraphMapVc (
+Kgraph * restrict const         grafptr,          /*+ Graph to map      +*/
+const KgraphMapVcParam * const  paraptr)          /*+ Method parameters +*/
+{
+  KgraphMapVcSort * restrict  sorttab;            /* Array of candidate moves             */
+  Gnum * restrict             vloatab;            /* Constraint loads of domains          */
+  Gnum * restrict             vlmxtab;            /* Maximum constraint loads of domains  */
+  double * restrict           vtgttab;            /* Normalized target loads of domains   */
+  double * restrict           vcsctab;            /* Normalization factors of constraints */
+  Gnum * restrict             nghbtab;            /* Flag array of neighbor domains       */
+  Anum * restrict             parttab;            /* List of neighbor domains             */
+  byte * restrict             ovlftab;            /* Flag array of domains above target   */
+  double                      wghtsum;            /* Sum of domain weights                */
+  Anum                        domnnum;
+  Gnum                        vconnum;
+  Gnum                        vertnum;
+  INT                         passnum;
+
+  const Gnum                  vconnbr = grafptr->s.vconnbr;
+  const Gnum * restrict const vcontax = grafptr->s.vcontax;
+  const Anum                  domnnbr = grafptr->m.domnnbr;
+  const Arch * restrict const archptr = grafptr->m.archptr;
+  const ArchDom * restrict const domntab = grafptr->m.domntab;
+  Anum * restrict const       parttax = grafptr->m.parttax;
+  const Anum * restrict const pfixtax = grafptr->pfixtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const edlotax = grafptr->s.edlotax;
+  const Gnum                  baseval = grafptr->s.baseval;
+  const Gnum                  vertnnd = grafptr->s.vertnnd;
+
+  if ((vcontax == NULL) ||                        /* If graph bears no constraints (coarsened graphs keep them) */
+      (domnnbr < 2) ||                            /* Or if nothing to balance                                   */
+      (paraptr->passnbr <= 0) ||
+      ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0)) /* Band graphs do not bear constraints */
+    return (0);
+
+  for (domnnum = 0, wghtsum = 0.0; domnnum < domnnbr; domnnum ++) {
+    Anum                domnwght;
+
+    domnwght = archDomWght (archptr, &domntab[domnnum]);
+    if (domnwght <= 0)                            /* Targets are used as divisors, so they must not be zero */
+      return (0);                                 /* Leave mapping as is                                    */
+    wghtsum += (double) domnwght;
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &sorttab, (size_t) (grafptr->s.vertnbr  * sizeof (KgraphMapVcSort)),
+                     &vloatab, (size_t) (domnnbr * vconnbr * sizeof (Gnum)),
+                     &vlmxtab, (size_t) (domnnbr * vconnbr * sizeof (Gnum)),
+                     &vtgttab, (size_t) (domnnbr           * sizeof (double)),
+                     &vcsctab, (size_t) (vconnbr           * sizeof (double)),
+                     &nghbtab, (size_t) (domnnbr           * sizeof (Gnum)),
+                     &parttab, (size_t) (domnnbr           * sizeof (Anum)),
+                     &ovlftab, (size_t) (domnnbr           * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("kgraphMapVc: out of memory");
+    return (1);
+  }
+
+  memSet (vloatab, 0, vconnbr * sizeof (Gnum));   /* Compute overall constraint loads */
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+    for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+      vloatab[vconnum] += vcontax[vertnum * vconnbr + vconnum];
+  }
+  for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+    vcsctab[vconnum] = (vloatab[vconnum] > 0) ? (1.0 / (double) vloatab[vconnum]) : 0.0;
+
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++) { /* Compute maximum constraint loads of domains */
+    double              domnrat;
+
+    domnrat = (double) archDomWght (archptr, &domntab[domnnum]) / wghtsum;
+    vtgttab[domnnum] = domnrat;
+    domnrat *= 1.0 + paraptr->kbalval;
+    for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+      vlmxtab[domnnum * vconnbr + vconnum] = (Gnum) ((double) vloatab[vconnum] * domnrat);
+  }
+
+  for (passnum = 0; passnum < paraptr->passnbr; passnum ++) {
+    Gnum                sortnbr;
+    Gnum                sortnum;
+    Gnum                movenbr;
+    int                 flagval;
+
+    memSet (vloatab, 0, domnnbr * vconnbr * sizeof (Gnum)); /* Recompute constraint loads of domains */
+    for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+      Anum                partval;
+
+      partval = parttax[vertnum];
+      for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+        vloatab[partval * vconnbr + vconnum] += vcontax[vertnum * vconnbr + vconnum];
+    }
+    for (domnnum = 0, flagval = 0; domnnum < domnnbr; domnnum ++) {
+      ovlftab[domnnum] = 0;
+      for (vconnum = 0; vconnum < vconnbr; vconnum ++) {
+        if (vloatab[domnnum * vconnbr + vconnum] > vlmxtab[domnnum * vconnbr + vconnum])
+          flagval = 1;                            /* Some domain is overloaded          */
+        if (((double) vloatab[domnnum * vconnbr + vconnum] * vcsctab[vconnum]) > vtgttab[domnnum])
+          ovlftab[domnnum] = 1;                   /* Domain can yield load to neighbors */
+      }
+    }
+    if (flagval == 0)                             /* If all constraints balanced, we are done */
+      break;
+
+    memSet (nghbtab, ~0, domnnbr * sizeof (Gnum));
+    for (vertnum = baseval, sortnbr = 0; vertnum < vertnnd; vertnum ++) {
+      const Gnum * restrict vconptr;
+      Anum                partval;
+      Anum                partnbr;
+      Anum                partnum;
+      Anum                partbst;
+      Gnum                gainbst;
+      double              deltbst;
+      Genum               edgenum;
+
+      partval = parttax[vertnum];
+      if ((ovlftab[partval] == 0) ||              /* If domain of vertex not above its target */
+          ((pfixtax != NULL) && (pfixtax[vertnum] >= 0))) /* Or if vertex is fixed            */
+        continue;
+
+      vconptr = vcontax + vertnum * vconnbr;
+      for (vconnum = 0; vconnum < vconnbr; vconnum ++) { /* Check that vertex bears some constraint above target */
+        if ((vconptr[vconnum] > 0) &&
+            (((double) vloatab[partval * vconnbr + vconnum] * vcsctab[vconnum]) > vtgttab[partval]))
+          break;
+      }
+      if (vconnum >= vconnbr)                     /* If moving vertex would not help */
+        continue;
+
+      for (edgenum = verttax[vertnum], partnbr = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+        Anum                partend;
+
+        partend = parttax[edgetax[edgenum]];
+        if ((partend != partval) && (nghbtab[partend] != vertnum)) { /* If neighbor domain not yet recorded */
+          nghbtab[partend]    = vertnum;
+          parttab[partnbr ++] = partend;
+        }
+      }
+
+      for (partnum = 0, partbst = -1, gainbst = GNUMMIN, deltbst = 0.0; partnum < partnbr; partnum ++) {
+        Anum                partdst;
+        double              deltval;
+        Gnum                gainval;
+
+        partdst = parttab[partnum];
+        deltval = kgraphMapVcDelta (vloatab, vtgttab, vcsctab, vconptr, vconnbr, partval, partdst);
+        if (deltval >= 0.0)                       /* If move does not decrease overload */
+          continue;
+
+        for (edgenum = verttax[vertnum], gainval = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+          Anum                partend;
+          Gnum                edloval;
+
+          partend = parttax[edgetax[edgenum]];
+          edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+          if (partend != partval)
+            gainval += edloval * archDomDist (archptr, &domntab[partval], &domntab[partend]);
+          if (partend != partdst)
+            gainval -= edloval * archDomDist (archptr, &domntab[partdst], &domntab[partend]);
+        }
+
+        if ((gainval > gainbst) ||
+            ((gainval == gainbst) && (deltval < deltbst))) {
+          partbst = partdst;
+          gainbst = gainval;
+          deltbst = deltval;
+        }
+      }
+
+      if (partbst >= 0) {                         /* If a profitable move found, record it */
+        sorttab[sortnbr].gainval = - gainbst;
+        sorttab[sortnbr].vertnum = vertnum;
+        sorttab[sortnbr].partval = partbst;
+        sortnbr ++;
+      }
+    }
+    if (sortnbr == 0)                             /* If no move possible, abort */
+      break;
+
+    intSort3asc2 (sorttab, sortnbr);              /* Sort moves by decreasing gain and increasing vertex number */
+
+    for (sortnum = 0, movenbr = 0; sortnum < sortnbr; sortnum ++) {
+      const Gnum * restrict vconptr;
+      Anum                partorg;
+      Anum                partdst;
+
+      vertnum = sorttab[sortnum].vertnum;
+      partorg = parttax[vertnum];
+      partdst = (Anum) sorttab[sortnum].partval;
+      vconptr = vcontax + vertnum * vconnbr;
+      if (kgraphMapVcDelta (vloatab, vtgttab, vcsctab, vconptr, vconnbr, partorg, partdst) >= 0.0) /* If move no longer profitable */
+        continue;
+
+      for (vconnum = 0; vconnum < vconnbr; vconnum ++) {
+        vloatab[partorg * vconnbr + vconnum] -= vconptr[vconnum];
+        vloatab[partdst * vconnbr + vconnum] += vconptr[vconnum];
+      }
+      parttax[vertnum] = partdst;
+      movenbr ++;
+    }
+    if (movenbr == 0)
+      break;
+  }
+
+  memFree (sorttab);                              /* Free group leader */
+
+  kgraphFron (grafptr);                           /* Update frontier and costs of modified mapping */
+  kgraphCost (grafptr);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapVc: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
@@ -0,0 +1,77 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_vc.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the multi-constraint load balancing **/
+/**                k-way graph mapping routines.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct KgraphMapVcParam_ {
+  INT                       passnbr;              /*+ Maximum number of passes +*/
+  double                    kbalval;              /*+ Imbalance ratio          +*/
+} KgraphMapVcParam;
+
+/*+ This structure holds a candidate
+    move, for sorting by decreasing
+    communication gain. The first two
+    fields are the sort keys.        +*/
+
+typedef struct KgraphMapVcSort_ {
+  Gnum                      gainval;              /*+ Opposite of communication gain +*/
+  Gnum                      vertnum;              /*+ Vertex number                  +*/
+  Gnum                      partval;              /*+ Destination domain index       +*/
+} KgraphMapVcSort;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_KGRAPH_MAP_VC
+static double               kgraphMapVcDelta    (const Gnum * restrict const, const double * restrict const, const double * restrict const, const Gnum * restrict const, const Gnum, const Anum, const Anum);
+#endif /* SCOTCH_KGRAPH_MAP_VC */
+
+int                         kgraphMapVc         (Kgraph * restrict const, const KgraphMapVcParam * const);
@@ -1,4 +1,4 @@
-/* Copyright 2011,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2011,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -156,7 +156,7 @@ Kgraph * const              grafptr,
 const KgraphStore * const   storptr)
 {
 #ifdef SCOTCH_DEBUG_KGRAPH2
-  if (grafptr->m.domnmax < storptr->domnmax) {
+  if (grafptr->m.domnmax < storptr->domnnbr) {   /* Domain array may have been resized since save area was created */
     errorPrint ("kgraphStoreUpdt: cannot update state");
     return;
   }
@@ -0,0 +1,247 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh.c                                 **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the k-way active    **/
+/**                mesh partitioning structures.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+
+/**********************************/
+/*                                */
+/* Active mesh handling routines. */
+/*                                */
+/**********************************/
+
+/* This routine initializes the active mesh
+** corresponding to the given source mesh.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kmeshInit (
+Kmesh * restrict const        actmeshptr,         /*+ Active mesh     +*/
+const Mesh * restrict const   srcmeshptr,         /*+ Source mesh     +*/
+const Anum                    partnbr)            /*+ Number of parts +*/
+{
+  actmeshptr->m            = *srcmeshptr;         /* Clone source mesh        */
+  actmeshptr->m.flagval   &= ~MESHFREETABS;       /* Do not free its contents */
+  actmeshptr->parttax      = NULL;                /* No part array yet        */
+  actmeshptr->compload     = NULL;                /* No group leader yet      */
+  actmeshptr->partnbr      = partnbr;
+  actmeshptr->comploadavg  = (srcmeshptr->velosum + partnbr - 1) / partnbr;
+  actmeshptr->commload     = 0;
+  actmeshptr->kbalval      = 0.0;
+  actmeshptr->levlnum      = 0;
+  actmeshptr->contptr      = NULL;
+}
+
+/* This routine frees the contents
+** of the given active mesh.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kmeshExit (
+Kmesh * const               meshptr)
+{
+  if (meshptr->compload != NULL)
+    memFree (meshptr->compload);                  /* Free group leader */
+
+  meshExit (&meshptr->m);                         /* Free source mesh */
+
+#ifdef SCOTCH_DEBUG_KMESH2
+  memSet (meshptr, ~0, sizeof (Kmesh));
+#endif /* SCOTCH_DEBUG_KMESH2 */
+}
+
+/* This routine allocates the partition
+** data of the given active mesh. The part
+** array is only allocated if not already
+** provided.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+kmeshAlloc (
+Kmesh * const               meshptr)
+{
+  Gnum                partsiz;
+  Anum * restrict     parttab;
+
+  partsiz = (meshptr->parttax == NULL) ? meshptr->m.velmnbr : 0; /* Allocate part array only if not already */
+
+  if (memAllocGroup ((void **) (void *)
+                     &meshptr->compload, (size_t) (meshptr->partnbr * sizeof (Gnum)),
+                     &parttab,           (size_t) (partsiz          * sizeof (Anum)), NULL) == NULL) {
+    errorPrint ("kmeshAlloc: out of memory");
+    return (1);
+  }
+  if (meshptr->parttax == NULL)                   /* Part array does not need flag as will be group freed */
+    meshptr->parttax = parttab - meshptr->m.velmbas;
+
+  return (0);
+}
+
+/* This routine moves all of the mesh
+** elements to the first part.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kmeshZero (
+Kmesh * const               meshptr)
+{
+  memSet (meshptr->compload + 1, 0, (meshptr->partnbr - 1) * sizeof (Gnum));
+  meshptr->compload[0] = meshptr->m.velosum;
+  meshptr->commload    = 0;
+
+  memSet (meshptr->parttax + meshptr->m.velmbas, 0, meshptr->m.velmnbr * sizeof (Anum)); /* Set all elements to part 0 */
+}
+
+/* This routine computes the part loads
+** and the communication load of the
+** current partition.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+kmeshCost (
+Kmesh * const               meshptr)
+{
+  Gnum * restrict     flagtab;                    /* Flag array to count parts only once per node */
+  Gnum                commload;
+  Gnum                velmnum;
+  Gnum                vnodnum;
+
+  const Genum * restrict const  verttax  = meshptr->m.verttax;
+  const Genum * restrict const  vendtax  = meshptr->m.vendtax;
+  const Gnum * restrict const   velotax  = meshptr->m.velotax;
+  const Gnum * restrict const   vnlotax  = meshptr->m.vnlotax;
+  const Gnum * restrict const   edgetax  = meshptr->m.edgetax;
+  const Anum * restrict const   parttax  = meshptr->parttax;
+  Gnum * restrict const         compload = meshptr->compload;
+
+  if ((flagtab = (Gnum *) memAlloc (meshptr->partnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("kmeshCost: out of memory");
+    return (1);
+  }
+  memSet (flagtab, ~0, meshptr->partnbr * sizeof (Gnum));
+
+  memSet (compload, 0, meshptr->partnbr * sizeof (Gnum));
+  for (velmnum = meshptr->m.velmbas; velmnum < meshptr->m.velmnnd; velmnum ++)
+    compload[parttax[velmnum]] += (velotax != NULL) ? velotax[velmnum] : 1;
+
+  for (vnodnum = meshptr->m.vnodbas, commload = 0; vnodnum < meshptr->m.vnodnnd; vnodnum ++) {
+    Genum               enodnum;
+    Gnum                partnbr;
+
+    for (enodnum = verttax[vnodnum], partnbr = 0; enodnum < vendtax[vnodnum]; enodnum ++) {
+      Anum                partval;
+
+      partval = parttax[edgetax[enodnum]];
+      if (flagtab[partval] != vnodnum) {          /* If part not yet accounted for */
+        flagtab[partval] = vnodnum;
+        partnbr ++;
+      }
+    }
+    if (partnbr > 1)
+      commload += (partnbr - 1) * ((vnlotax != NULL) ? vnlotax[vnodnum] : 1);
+  }
+  meshptr->commload = commload;
+
+  memFree (flagtab);
+
+  return (0);
+}
+
+/* This routine computes the maximum load
+** that parts may have for the given imbalance
+** ratio. Since elements cannot be split, this
+** load is never less than the average load
+** plus the load of the heaviest element.
+** It returns:
+** - the maximum part load, in all cases.
+*/
+
+Gnum
+kmeshLoadMax (
+const Kmesh * const         meshptr,
+const double                deltval)              /*+ Maximum imbalance ratio +*/
+{
+  Gnum                velomax;
+  Gnum                loadmax;
+
+  const Gnum * restrict const velotax = meshptr->m.velotax;
+
+  if (velotax != NULL) {
+    Gnum                velmnum;
+
+    for (velmnum = meshptr->m.velmbas, velomax = 0; velmnum < meshptr->m.velmnnd; velmnum ++) {
+      if (velotax[velmnum] > velomax)
+        velomax = velotax[velmnum];
+    }
+  }
+  else
+    velomax = 1;
+
+  loadmax = (Gnum) ((double) meshptr->comploadavg * deltval);
+  if (loadmax < velomax)
+    loadmax = velomax;
+
+  return (meshptr->comploadavg + loadmax);
+}
@@ -0,0 +1,95 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh.h                                 **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the data declarat- **/
+/**                ions for the k-way mesh partitioning    **/
+/**                routines, which partition the elements  **/
+/**                of a mesh so as to minimize the connec- **/
+/**                tivity of its nodes.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The active mesh structure. The elements
+    of the mesh are the vertices to partition,
+    and its nodes are the hyperedges linking
+    them. The communication load is the sum,
+    over all nodes, of their load times the
+    number of parts spanned by their elements,
+    minus one.                                 +*/
+
+typedef struct Kmesh_ {
+  Mesh                      m;                    /*+ Source mesh                                  +*/
+  Anum *                    parttax;              /*+ Element part array; can be allocated apart   +*/
+  Gnum *                    compload;             /*+ Array of part loads; group leader            +*/
+  Anum                      partnbr;              /*+ Number of parts                              +*/
+  Gnum                      comploadavg;          /*+ Average part load                            +*/
+  Gnum                      commload;             /*+ Connectivity-minus-one communication load    +*/
+  double                    kbalval;              /*+ Last k-way imbalance ratio                   +*/
+  INT                       levlnum;              /*+ Coarsening level                             +*/
+  Context *                 contptr;              /*+ Execution context                            +*/
+} Kmesh;
+
+/*+ The save mesh structure. +*/
+
+typedef struct KmeshStore_ {
+  Gnum                      commload;             /*+ Communication load        +*/
+  byte *                    datatab;              /*+ Variable-sized data array +*/
+} KmeshStore;
+
+/*
+**  The function prototypes.
+*/
+
+void                        kmeshInit           (Kmesh * const, const Mesh * restrict const, const Anum);
+void                        kmeshExit           (Kmesh * const);
+int                         kmeshAlloc          (Kmesh * const);
+void                        kmeshZero           (Kmesh * const);
+int                         kmeshCost           (Kmesh * const);
+int                         kmeshCheck          (const Kmesh * const);
+Gnum                        kmeshLoadMax        (const Kmesh * const, const double);
+
+int                         kmeshStoreInit      (const Kmesh * const, KmeshStore * const);
+void                        kmeshStoreExit      (KmeshStore * const);
+void                        kmeshStoreSave      (const Kmesh * const, KmeshStore * const);
+void                        kmeshStoreUpdt      (Kmesh * const, const KmeshStore * const);
@@ -0,0 +1,121 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_check.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the k-way mesh     **/
+/**                partitioning consistency checking       **/
+/**                routine.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+
+/*************************/
+/*                       */
+/* These routines handle */
+/* active meshes.        */
+/*                       */
+/*************************/
+
+/* This routine checks the consistency
+** of the given active mesh.
+** It returns:
+** - 0   : if mesh data are consistent.
+** - !0  : on error.
+*/
+
+int
+kmeshCheck (
+const Kmesh * restrict const  meshptr)
+{
+  Kmesh               chekmeshdat;                /* Mesh for recomputing costs */
+  Gnum                velmnum;
+  Anum                partnum;
+  int                 o;
+
+  if (meshptr->partnbr <= 0) {
+    errorPrint ("kmeshCheck: invalid number of parts");
+    return (1);
+  }
+
+  for (velmnum = meshptr->m.velmbas; velmnum < meshptr->m.velmnnd; velmnum ++) {
+    if ((meshptr->parttax[velmnum] < 0) ||
+        (meshptr->parttax[velmnum] >= meshptr->partnbr)) {
+      errorPrint ("kmeshCheck: invalid part array");
+      return (1);
+    }
+  }
+
+  chekmeshdat = *meshptr;                         /* Clone active mesh structure to recompute costs */
+  if ((chekmeshdat.compload = (Gnum *) memAlloc (meshptr->partnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("kmeshCheck: out of memory");
+    return (1);
+  }
+
+  o = 1;                                          /* Assume an error */
+  if (kmeshCost (&chekmeshdat) != 0) {
+    errorPrint ("kmeshCheck: cannot compute costs");
+    goto abort;
+  }
+  for (partnum = 0; partnum < meshptr->partnbr; partnum ++) {
+    if (chekmeshdat.compload[partnum] != meshptr->compload[partnum]) {
+      errorPrint ("kmeshCheck: invalid part load array");
+      goto abort;
+    }
+  }
+  if (chekmeshdat.commload != meshptr->commload) {
+    errorPrint ("kmeshCheck: invalid communication load");
+    goto abort;
+  }
+
+  o = 0;
+abort:
+  memFree (chekmeshdat.compload);
+
+  return (o);
+}
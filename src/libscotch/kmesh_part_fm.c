@@ -0,0 +1,389 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_part_fm.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a k-way partition   **/
+/**                of the elements of a mesh by means of   **/
+/**                a Fiduccia-Mattheyses-like heuristic    **/
+/**                minimizing the connectivity-minus-one   **/
+/**                metric of its nodes.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KMESH_PART_FM
+
+#include "module.h"
+#include "common.h"
+#include "gain.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+#include "kmesh_part_fm.h"
+
+/*********************************/
+/*                               */
+/* Gain computation subroutines. */
+/*                               */
+/*********************************/
+
+/* This routine computes the best move of the
+** given element towards one of the parts of its
+** neighbor elements. Moving element e from part
+** a to part b decreases the connectivity of
+** every node of e of which e is the only element
+** in a, and increases the connectivity of every
+** node of e which has no element in b. Hence, if
+** B is the load of the nodes of the first kind,
+** W the load of all nodes of e, and C(b) the load
+** of the nodes of e having elements in b, the
+** gain of the move is B - W + C(b).
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kmeshPartFmEval (
+const Kmesh * restrict const            meshptr,  /*+ Active mesh                 +*/
+const KmeshPartFmData * restrict const  dataptr,  /*+ Work data                   +*/
+const Gnum                              velmnum,  /*+ Element to evaluate         +*/
+KmeshPartFmLink * restrict const        linkptr)  /*+ Link in which to store move +*/
+{
+  Genum               eelmnum;
+  Gnum                nodeload;                   /* Load W of all nodes of element              */
+  Gnum                ownload;                    /* Load B of nodes with no other element in part */
+  Anum                candnbr;
+  Anum                candnum;
+  Anum                partorg;
+  Anum                partbst;
+  Gnum                gainbst;
+  Gnum                velodlt;
+
+  const Genum * restrict const  verttax  = meshptr->m.verttax;
+  const Genum * restrict const  vendtax  = meshptr->m.vendtax;
+  const Gnum * restrict const   vnlotax  = meshptr->m.vnlotax;
+  const Gnum * restrict const   edgetax  = meshptr->m.edgetax;
+  const Anum * restrict const   parttax  = meshptr->parttax;
+  const Gnum * restrict const   compload = meshptr->compload;
+  Gnum * restrict const         conntab  = dataptr->conntab;
+  Anum * restrict const         candtab  = dataptr->candtab;
+  Anum * restrict const         nodetab  = dataptr->nodetab;
+  byte * restrict const         flagtab  = dataptr->flagtab;
+
+  partorg = parttax[velmnum];
+  for (eelmnum = verttax[velmnum], nodeload = ownload = 0, candnbr = 0;
+       eelmnum < vendtax[velmnum]; eelmnum ++) {
+    Gnum                vnodnum;
+    Gnum                vnloval;
+    Genum               enodnum;
+    Anum                nodenbr;
+    Anum                nodenum;
+    int                 orgflag;                  /* Set if node has another element in origin part */
+
+    vnodnum = edgetax[eelmnum];
+    vnloval = (vnlotax != NULL) ? vnlotax[vnodnum] : 1;
+    nodeload += vnloval;
+
+    for (enodnum = verttax[vnodnum], nodenbr = 0, orgflag = 0;
+         enodnum < vendtax[vnodnum]; enodnum ++) {
+      Gnum                velmend;
+      Anum                partend;
+
+      velmend = edgetax[enodnum];
+      if (velmend == velmnum)
+        continue;
+      partend = parttax[velmend];
+      if (partend == partorg) {
+        orgflag = 1;
+        continue;
+      }
+      if ((flagtab[partend] & KMESHPARTFMFLAGNODE) != 0) /* If part already met for this node */
+        continue;
+      flagtab[partend] |= KMESHPARTFMFLAGNODE;
+      nodetab[nodenbr ++] = partend;
+      if ((flagtab[partend] & KMESHPARTFMFLAGCAND) == 0) { /* If part not yet a candidate */
+        flagtab[partend] |= KMESHPARTFMFLAGCAND;
+        candtab[candnbr ++] = partend;
+      }
+      conntab[partend] += vnloval;
+    }
+    for (nodenum = 0; nodenum < nodenbr; nodenum ++) /* Reset node flags of parts met */
+      flagtab[nodetab[nodenum]] &= ~KMESHPARTFMFLAGNODE;
+
+    if (orgflag == 0)                             /* If element is the only one of its part for this node */
+      ownload += vnloval;
+  }
+
+  velodlt = (meshptr->m.velotax != NULL) ? meshptr->m.velotax[velmnum] : 1;
+  partbst = ~0;
+  gainbst = 0;                                    /* Avoid compiler warnings */
+  for (candnum = 0; candnum < candnbr; candnum ++) {
+    Anum                partdst;
+    Gnum                gainval;
+
+    partdst = candtab[candnum];
+    gainval = ownload - nodeload + conntab[partdst];
+    conntab[partdst] = 0;                         /* Reset candidate data */
+    flagtab[partdst] = 0;
+
+    if ((compload[partdst] + velodlt > dataptr->loadmax) && /* If move would overload destination part */
+        ((compload[partorg] <= dataptr->loadmax) || /* And would not relieve overloaded origin part    */
+         (compload[partdst] + velodlt >= compload[partorg])))
+      continue;
+
+    if ((partbst == ~0) || (gainval > gainbst) ||
+        ((gainval == gainbst) && (compload[partdst] < compload[partbst]))) {
+      partbst = partdst;
+      gainbst = gainval;
+    }
+  }
+
+  linkptr->partval = partbst;
+  linkptr->gainval = gainbst;
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the k-way partitioning
+** refinement. At each pass, all elements having
+** a possible move are linked in a gain table,
+** and the best moves are performed one after
+** the other, each element being moved at most
+** once, until too many moves have been done
+** without improving the partition. Partitions
+** are first compared by their overload with
+** respect to the maximum part load, then by
+** their communication load. Moves performed
+** after the best partition are rolled back.
+** It returns:
+** - 0 : if the partition could be refined.
+** - 1 : on error.
+*/
+
+int
+kmeshPartFm (
+Kmesh * restrict const            meshptr,        /*+ Active mesh       +*/
+const KmeshPartFmParam * const    paraptr)        /*+ Method parameters +*/
+{
+  KmeshPartFmData     datadat;
+  KmeshPartFmLink *   linktax;
+  KmeshPartFmSave *   savetab;
+  GainTabl *          tablptr;
+  Gnum                loadovl;                    /* Sum of overloads of parts */
+  Anum                partnum;
+  INT                 passnum;
+
+  const Genum * restrict const  verttax  = meshptr->m.verttax;
+  const Genum * restrict const  vendtax  = meshptr->m.vendtax;
+  const Gnum * restrict const   velotax  = meshptr->m.velotax;
+  const Gnum * restrict const   edgetax  = meshptr->m.edgetax;
+  const Gnum                    velmbas  = meshptr->m.velmbas;
+  const Gnum                    velmnnd  = meshptr->m.velmnnd;
+  const Anum                    partnbr  = meshptr->partnbr;
+  Anum * restrict const         parttax  = meshptr->parttax;
+  Gnum * restrict const         compload = meshptr->compload;
+
+  meshptr->kbalval = paraptr->deltval;            /* Store last k-way imbalance ratio */
+  if ((meshptr->m.velmnbr <= 0) || (partnbr < 2)) /* Nothing to refine              */
+    return (0);
+
+  if (memAllocGroup ((void **) (void *)
+                     &linktax,         (size_t) (meshptr->m.velmnbr * sizeof (KmeshPartFmLink)),
+                     &savetab,         (size_t) (meshptr->m.velmnbr * sizeof (KmeshPartFmSave)),
+                     &datadat.conntab, (size_t) (partnbr            * sizeof (Gnum)),
+                     &datadat.candtab, (size_t) (partnbr            * sizeof (Anum)),
+                     &datadat.nodetab, (size_t) (partnbr            * sizeof (Anum)),
+                     &datadat.flagtab, (size_t) (partnbr            * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("kmeshPartFm: out of memory (1)");
+    return (1);
+  }
+  if ((tablptr = gainTablInit (GAINMAX, KMESHPARTFMSUBBITS, GAINTABLTYPEFM, NULL)) == NULL) {
+    errorPrint ("kmeshPartFm: out of memory (2)");
+    memFree    (linktax);
+    return (1);
+  }
+  linktax -= velmbas;
+  memSet (datadat.conntab, 0, partnbr * sizeof (Gnum));
+  memSet (datadat.flagtab, 0, partnbr * sizeof (byte));
+  datadat.loadmax = kmeshLoadMax (meshptr, paraptr->deltval);
+
+  for (partnum = 0, loadovl = 0; partnum < partnbr; partnum ++) {
+    if (compload[partnum] > datadat.loadmax)
+      loadovl += compload[partnum] - datadat.loadmax;
+  }
+
+  for (passnum = 0; passnum != paraptr->passnbr; passnum ++) {
+    KmeshPartFmLink *   linkptr;
+    Gnum                velmnum;
+    Gnum                savenbr;                  /* Number of moves performed in pass  */
+    Gnum                savebst;                  /* Number of moves of best partition  */
+    Gnum                commbst;                  /* Communication load of best state   */
+    Gnum                loadbst;                  /* Overload of best state             */
+    INT                 movenbr;                  /* Number of moves without improvement */
+
+    gainTablFree (tablptr);                       /* Flush links left from previous pass */
+    for (velmnum = velmbas; velmnum < velmnnd; velmnum ++) {
+      linkptr = &linktax[velmnum];
+      linkptr->stateval = KMESHPARTFMSTATEFREE;
+      linkptr->flagval  = ~0;
+      kmeshPartFmEval (meshptr, &datadat, velmnum, linkptr);
+      if (linkptr->partval != ~0) {               /* If element can be moved, link it */
+        linkptr->stateval = KMESHPARTFMSTATELINK;
+        gainTablAdd (tablptr, (GainLink *) linkptr, - linkptr->gainval);
+      }
+    }
+
+    savenbr =
+    savebst = 0;
+    commbst = meshptr->commload;
+    loadbst = loadovl;
+    movenbr = 0;
+    while ((linkptr = (KmeshPartFmLink *) gainTablFrst (tablptr)) != NULL) {
+      Genum               eelmnum;
+      Anum                partorg;
+      Anum                partdst;
+      Gnum                veloval;
+      Gnum                loadorg;
+      Gnum                loaddst;
+
+      gainTablDel (tablptr, (GainLink *) linkptr);
+      linkptr->stateval = KMESHPARTFMSTATEFREE;
+      velmnum = (Gnum) (linkptr - linktax);
+
+      kmeshPartFmEval (meshptr, &datadat, velmnum, linkptr); /* Part loads may have changed since element was linked */
+      if (linkptr->partval == ~0)                 /* If element cannot be moved any longer                        */
+        continue;
+
+      partorg = parttax[velmnum];
+      partdst = linkptr->partval;
+      veloval = (velotax != NULL) ? velotax[velmnum] : 1;
+      loadorg = compload[partorg];
+      loaddst = compload[partdst];
+      loadovl -= ((loadorg > datadat.loadmax) ? (loadorg - datadat.loadmax) : 0) +
+                 ((loaddst > datadat.loadmax) ? (loaddst - datadat.loadmax) : 0);
+      loadorg -= veloval;
+      loaddst += veloval;
+      loadovl += ((loadorg > datadat.loadmax) ? (loadorg - datadat.loadmax) : 0) +
+                 ((loaddst > datadat.loadmax) ? (loaddst - datadat.loadmax) : 0);
+      compload[partorg] = loadorg;
+      compload[partdst] = loaddst;
+      parttax[velmnum]  = partdst;
+      meshptr->commload -= linkptr->gainval;
+      linkptr->stateval  = KMESHPARTFMSTATELOCK;
+      savetab[savenbr].velmnum = velmnum;
+      savetab[savenbr].partval = partorg;
+      savenbr ++;
+
+      if ((loadovl < loadbst) ||                  /* If partition improved, record it */
+          ((loadovl == loadbst) && (meshptr->commload < commbst))) {
+        loadbst = loadovl;
+        commbst = meshptr->commload;
+        savebst = savenbr;
+        movenbr = 0;
+      }
+      else if (movenbr ++ >= paraptr->movenbr)    /* If too many uneffective moves, end pass */
+        break;
+
+      for (eelmnum = verttax[velmnum]; eelmnum < vendtax[velmnum]; eelmnum ++) { /* Update neighbor elements */
+        Gnum                vnodnum;
+        Genum               enodnum;
+
+        vnodnum = edgetax[eelmnum];
+        for (enodnum = verttax[vnodnum]; enodnum < vendtax[vnodnum]; enodnum ++) {
+          KmeshPartFmLink *   lnkeptr;
+
+          lnkeptr = &linktax[edgetax[enodnum]];
+          if ((lnkeptr->stateval == KMESHPARTFMSTATELOCK) || /* If element moved or already updated */
+              (lnkeptr->flagval  == velmnum))
+            continue;
+          lnkeptr->flagval = velmnum;
+
+          if (lnkeptr->stateval == KMESHPARTFMSTATELINK)
+            gainTablDel (tablptr, (GainLink *) lnkeptr);
+          kmeshPartFmEval (meshptr, &datadat, (Gnum) (lnkeptr - linktax), lnkeptr);
+          if (lnkeptr->partval != ~0) {
+            lnkeptr->stateval = KMESHPARTFMSTATELINK;
+            gainTablAdd (tablptr, (GainLink *) lnkeptr, - lnkeptr->gainval);
+          }
+          else
+            lnkeptr->stateval = KMESHPARTFMSTATEFREE;
+        }
+      }
+    }
+
+    while (savenbr > savebst) {                   /* Roll back moves after best partition */
+      Anum                partorg;
+      Gnum                veloval;
+
+      savenbr --;
+      velmnum = savetab[savenbr].velmnum;
+      partorg = savetab[savenbr].partval;
+      veloval = (velotax != NULL) ? velotax[velmnum] : 1;
+      compload[parttax[velmnum]] -= veloval;
+      compload[partorg]          += veloval;
+      parttax[velmnum]            = partorg;
+    }
+    meshptr->commload = commbst;
+    loadovl = loadbst;
+
+    if (savebst == 0)                             /* If pass did not improve partition, stop */
+      break;
+  }
+
+  gainTablExit (tablptr);
+  memFree (linktax + velmbas);
+
+#ifdef SCOTCH_DEBUG_KMESH2
+  if (kmeshCheck (meshptr) != 0) {
+    errorPrint ("kmeshPartFm: inconsistent mesh data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KMESH2 */
+
+  return (0);
+}
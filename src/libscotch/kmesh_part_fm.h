@@ -0,0 +1,115 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_part_fm.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the k-way Fiduccia-Mattheyses mesh  **/
+/**                partitioning refinement method.         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Gain table subbits. +*/
+
+#define KMESHPARTFMSUBBITS          4
+
+/*+ Element states. +*/
+
+#define KMESHPARTFMSTATEFREE        0             /*+ Element not linked in gain table +*/
+#define KMESHPARTFMSTATELINK        1             /*+ Element linked in gain table     +*/
+#define KMESHPARTFMSTATELOCK        2             /*+ Element already moved in pass    +*/
+
+/*+ Part flag values. +*/
+
+#define KMESHPARTFMFLAGNODE         1             /*+ Part already met for current node +*/
+#define KMESHPARTFMFLAGCAND         2             /*+ Part is a candidate destination   +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct KmeshPartFmParam_ {
+  INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
+  INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
+} KmeshPartFmParam;
+
+/*+ The element link structure. +*/
+
+typedef struct KmeshPartFmLink_ {
+  GainLink                  gainlink;             /*+ Gain link: FIRST                      +*/
+  Gnum                      gainval;              /*+ Gain of best move of element          +*/
+  Anum                      partval;              /*+ Destination part of best move, or ~0  +*/
+  int                       stateval;             /*+ Element state                         +*/
+  Gnum                      flagval;              /*+ Number of last moved neighbor element +*/
+} KmeshPartFmLink;
+
+/*+ The move save structure, for rollback. +*/
+
+typedef struct KmeshPartFmSave_ {
+  Gnum                      velmnum;              /*+ Number of moved element +*/
+  Anum                      partval;              /*+ Part before move        +*/
+} KmeshPartFmSave;
+
+/*+ The work data structure for move
+    evaluation. All arrays are of size
+    partnbr.                           +*/
+
+typedef struct KmeshPartFmData_ {
+  Gnum *                    conntab;              /*+ Node loads connected to candidate parts +*/
+  Anum *                    candtab;              /*+ List of candidate parts                 +*/
+  Anum *                    nodetab;              /*+ List of parts met for current node      +*/
+  byte *                    flagtab;              /*+ Part flag array                         +*/
+  Gnum                      loadmax;              /*+ Maximum part load                       +*/
+} KmeshPartFmData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_KMESH_PART_FM
+static void                 kmeshPartFmEval     (const Kmesh * restrict const, const KmeshPartFmData * restrict const, const Gnum, KmeshPartFmLink * restrict const);
+#endif /* SCOTCH_KMESH_PART_FM */
+
+int                         kmeshPartFm         (Kmesh * restrict const, const KmeshPartFmParam * const);
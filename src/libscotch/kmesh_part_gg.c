@@ -0,0 +1,222 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_part_gg.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a k-way partition  **/
+/**                of the elements of a mesh by growing    **/
+/**                parts one after the other, in a breadth-**/
+/**                first way across nodes.                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+#include "kmesh_part_gg.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the k-way partitioning.
+** Each part is grown from a seed element, by
+** adding the unassigned elements adjacent to the
+** nodes of the elements already in the part,
+** until the part reaches its share of the load
+** which remains to distribute. The seed of the
+** next part is the first unassigned element met
+** once the current part is full, so that parts
+** are laid side by side. The best of several
+** passes, with random initial seeds, is kept.
+** It returns:
+** - 0 : if a partition could be computed.
+** - 1 : on error.
+*/
+
+int
+kmeshPartGg (
+Kmesh * restrict const            meshptr,        /*+ Active mesh       +*/
+const KmeshPartGgParam * const    paraptr)        /*+ Method parameters +*/
+{
+  Gnum * restrict     queutab;                    /* Queue of elements to process          */
+  Gnum * restrict     nflgtax;                    /* Part number of last visit of each node */
+  Anum * restrict     pbsttab;                    /* Best partition found so far           */
+  Gnum                commbst;                    /* Communication load of best partition  */
+  INT                 passnbr;
+  INT                 passnum;
+
+  const Genum * restrict const  verttax = meshptr->m.verttax;
+  const Genum * restrict const  vendtax = meshptr->m.vendtax;
+  const Gnum * restrict const   velotax = meshptr->m.velotax;
+  const Gnum * restrict const   edgetax = meshptr->m.edgetax;
+  const Gnum                    velmbas = meshptr->m.velmbas;
+  const Gnum                    velmnbr = meshptr->m.velmnbr;
+  const Anum                    partnbr = meshptr->partnbr;
+  Anum * restrict const         parttax = meshptr->parttax;
+
+  if (velmnbr <= 0) {                             /* Nothing to do for empty meshes */
+    kmeshZero (meshptr);
+    return (0);
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &queutab, (size_t) (velmnbr            * sizeof (Gnum)),
+                     &nflgtax, (size_t) (meshptr->m.vnodnbr * sizeof (Gnum)),
+                     &pbsttab, (size_t) (velmnbr            * sizeof (Anum)), NULL) == NULL) {
+    errorPrint ("kmeshPartGg: out of memory");
+    return (1);
+  }
+  nflgtax -= meshptr->m.vnodbas;
+
+  passnbr = (paraptr->passnbr > 0) ? paraptr->passnbr : 1; /* Perform at least one pass */
+  for (passnum = 0, commbst = GNUMMAX; passnum < passnbr; passnum ++) {
+    Gnum                loadrmn;                  /* Load remaining to distribute       */
+    Gnum                velmrmn;                  /* Number of elements not yet in part */
+    Gnum                randnum;                  /* Index of search for random seeds   */
+    Gnum                seedval;                  /* Seed element for next part, if any */
+    Anum                partnum;
+
+    memSet (parttax + velmbas, ~0, velmnbr * sizeof (Anum));
+    memSet (nflgtax + meshptr->m.vnodbas, ~0, meshptr->m.vnodnbr * sizeof (Gnum));
+
+    loadrmn = meshptr->m.velosum;
+    velmrmn = velmnbr;
+    randnum = contextIntRandVal (meshptr->contptr, velmnbr);
+    seedval = ~0;
+    for (partnum = 0; (partnum < (partnbr - 1)) && (velmrmn > 0); partnum ++) {
+      Gnum                loadtgt;                /* Target load of current part */
+      Gnum                loadval;
+      Gnum                queuhead;
+      Gnum                queutail;
+
+      loadtgt = loadrmn / (partnbr - partnum);
+      for (loadval = queuhead = queutail = 0; (loadval < loadtgt) && (velmrmn > 0); ) {
+        Gnum                velmnum;
+        Genum               eelmnum;
+
+        if (queuhead >= queutail) {               /* If queue empty, seed part */
+          if ((seedval == ~0) || (parttax[seedval] != ~0)) { /* If no valid seed available */
+            while (parttax[velmbas + randnum] != ~0) /* Find next unassigned element       */
+              randnum = (randnum + 1) % velmnbr;
+            seedval = velmbas + randnum;
+          }
+          parttax[seedval] = partnum;
+          loadval += (velotax != NULL) ? velotax[seedval] : 1;
+          velmrmn --;
+          queutab[queutail ++] = seedval;
+          seedval = ~0;
+          continue;
+        }
+
+        velmnum = queutab[queuhead ++];
+        for (eelmnum = verttax[velmnum]; eelmnum < vendtax[velmnum]; eelmnum ++) {
+          Gnum                vnodnum;
+          Genum               enodnum;
+
+          vnodnum = edgetax[eelmnum];
+          if (nflgtax[vnodnum] == partnum)        /* If node already visited for this part */
+            continue;
+          nflgtax[vnodnum] = partnum;
+
+          for (enodnum = verttax[vnodnum]; enodnum < vendtax[vnodnum]; enodnum ++) {
+            Gnum                velmend;
+
+            velmend = edgetax[enodnum];
+            if (parttax[velmend] != ~0)           /* If element already in some part */
+              continue;
+            if (loadval >= loadtgt) {             /* If part is full                 */
+              seedval = velmend;                  /* Neighbor element seeds next part */
+              goto full;
+            }
+            parttax[velmend] = partnum;
+            loadval += (velotax != NULL) ? velotax[velmend] : 1;
+            velmrmn --;
+            queutab[queutail ++] = velmend;
+          }
+        }
+      }
+full:
+      loadrmn -= loadval;
+    }
+    if (velmrmn > 0) {                            /* Last part gets all remaining elements */
+      Gnum                velmnum;
+
+      for (velmnum = velmbas; velmnum < meshptr->m.velmnnd; velmnum ++) {
+        if (parttax[velmnum] == ~0)
+          parttax[velmnum] = partnbr - 1;
+      }
+    }
+
+    if (kmeshCost (meshptr) != 0) {
+      errorPrint ("kmeshPartGg: cannot compute partition cost");
+      memFree    (queutab);
+      return (1);
+    }
+    if (meshptr->commload < commbst) {            /* If better partition found, keep it */
+      commbst = meshptr->commload;
+      memCpy (pbsttab, parttax + velmbas, velmnbr * sizeof (Anum));
+    }
+  }
+
+  memCpy (parttax + velmbas, pbsttab, velmnbr * sizeof (Anum)); /* Restore best partition */
+  memFree (queutab);
+
+  if (kmeshCost (meshptr) != 0) {
+    errorPrint ("kmeshPartGg: cannot compute partition cost");
+    return (1);
+  }
+
+#ifdef SCOTCH_DEBUG_KMESH2
+  if (kmeshCheck (meshptr) != 0) {
+    errorPrint ("kmeshPartGg: inconsistent mesh data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KMESH2 */
+
+  return (0);
+}
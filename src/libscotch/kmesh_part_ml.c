@@ -0,0 +1,231 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_part_ml.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module conducts the multi-level    **/
+/**                framework for the k-way partitioning    **/
+/**                of the elements of a mesh.              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KMESH_PART_ML
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "mesh_coarsen.h"
+#include "kmesh.h"
+#include "kmesh_part_ml.h"
+#include "kmesh_part_st.h"
+
+/*********************************************/
+/*                                           */
+/* The coarsening and uncoarsening routines. */
+/*                                           */
+/*********************************************/
+
+/* This routine builds a coarser mesh from the
+** mesh that is given on input, by merging pairs
+** of elements. Since coarse nodes gather fine
+** nodes which are adjacent to the same coarse
+** elements, the connectivity-minus-one metric
+** of any partition of the coarse mesh is equal
+** to that of its projection on the fine mesh.
+** It returns:
+** - 0  : if the coarse mesh has been built.
+** - 1  : if threshold achieved or on error.
+*/
+
+static
+int
+kmeshPartMlCoarsen (
+const Kmesh * restrict const      finemeshptr,    /*+ Finer mesh                          +*/
+Kmesh * restrict const            coarmeshptr,    /*+ Coarser mesh to build               +*/
+Gnum * restrict * const           finecoarptr,    /*+ Pointer to multinode table to build +*/
+const KmeshPartMlParam * const    paraptr)        /*+ Method parameters                   +*/
+{
+  Gnum                coarnbr;
+
+  coarnbr = (Gnum) paraptr->coarnbr * finemeshptr->partnbr;
+  if (finemeshptr->m.velmnbr <= coarnbr)          /* If mesh small enough, stop coarsening */
+    return (1);
+
+  if (meshCoarsen (&finemeshptr->m, &coarmeshptr->m, finecoarptr, coarnbr,
+                   paraptr->coarval, MESHCOARSENNGB, finemeshptr->contptr) != 0)
+    return (1);                                   /* Return if coarsening failed */
+
+  if (coarmeshptr->m.velmnbr > (Gnum) ((double) finemeshptr->m.velmnbr * paraptr->coarval)) { /* If coarsening not effective enough */
+    meshExit (&coarmeshptr->m);
+    memFree  (*finecoarptr + finemeshptr->m.baseval);
+    return (1);
+  }
+
+  coarmeshptr->parttax     = NULL;                /* Do not allocate partition data yet */
+  coarmeshptr->compload    = NULL;
+  coarmeshptr->partnbr     = finemeshptr->partnbr;
+  coarmeshptr->comploadavg = finemeshptr->comploadavg;
+  coarmeshptr->commload    = 0;
+  coarmeshptr->kbalval     = finemeshptr->kbalval;
+  coarmeshptr->levlnum     = finemeshptr->levlnum + 1; /* Mesh level is coarsening level */
+  coarmeshptr->contptr     = finemeshptr->contptr;
+
+  return (0);
+}
+
+/* This routine propagates the partition of the
+** coarser mesh back to the finer mesh, according
+** to the multinode table of collapsed elements.
+** It returns:
+** - 0   : if coarse mesh data has been propagated to fine mesh.
+** - !0  : on error.
+*/
+
+static
+int
+kmeshPartMlUncoarsen (
+Kmesh * restrict const        finemeshptr,        /*+ Finer mesh      +*/
+const Kmesh * restrict const  coarmeshptr,        /*+ Coarser mesh    +*/
+const Gnum * restrict const   finecoartax)        /*+ Multinode array +*/
+{
+  Gnum                finevelmnum;
+
+  if ((finemeshptr->compload == NULL) &&          /* If partition data not yet allocated */
+      (kmeshAlloc (finemeshptr) != 0)) {
+    errorPrint ("kmeshPartMlUncoarsen: out of memory");
+    return (1);
+  }
+
+  if (coarmeshptr == NULL) {                      /* If no coarse mesh provided */
+    kmeshZero (finemeshptr);                      /* Assign all elements to part 0 */
+    return (0);
+  }
+
+  for (finevelmnum = finemeshptr->m.velmbas; finevelmnum < finemeshptr->m.velmnnd; finevelmnum ++) {
+#ifdef SCOTCH_DEBUG_KMESH2
+    if ((finecoartax[finevelmnum] <  coarmeshptr->m.velmbas) || /* Sons of elements are always elements */
+        (finecoartax[finevelmnum] >= coarmeshptr->m.velmnnd)) {
+      errorPrint ("kmeshPartMlUncoarsen: internal error");
+      return (1);
+    }
+#endif /* SCOTCH_DEBUG_KMESH2 */
+    finemeshptr->parttax[finevelmnum] = coarmeshptr->parttax[finecoartax[finevelmnum]];
+  }
+  memCpy (finemeshptr->compload, coarmeshptr->compload, finemeshptr->partnbr * sizeof (Gnum));
+  finemeshptr->commload = coarmeshptr->commload;  /* Communication load is preserved by coarsening */
+  finemeshptr->kbalval  = coarmeshptr->kbalval;
+
+#ifdef SCOTCH_DEBUG_KMESH2
+  if (kmeshCheck (finemeshptr) != 0) {
+    errorPrint ("kmeshPartMlUncoarsen: inconsistent mesh data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KMESH2 */
+
+  return (0);
+}
+
+/* This routine recursively performs the
+** coarsening recursion.
+** It returns:
+** - 0   : if recursion proceeded well.
+** - !0  : on error.
+*/
+
+static
+int
+kmeshPartMl2 (
+Kmesh * restrict const          finemeshptr,
+const KmeshPartMlParam * const  paraptr)
+{
+  Kmesh               coarmeshdat;
+  Gnum * restrict     finecoartax;
+  int                 o;
+
+  if (kmeshPartMlCoarsen (finemeshptr, &coarmeshdat, &finecoartax, paraptr) == 0) {
+    if (((o = kmeshPartMl2         (&coarmeshdat, paraptr))                  == 0) &&
+        ((o = kmeshPartMlUncoarsen (finemeshptr, &coarmeshdat, finecoartax)) == 0) &&
+        ((o = kmeshPartSt          (finemeshptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
+      errorPrint ("kmeshPartMl2: cannot apply ascending strategy");
+    kmeshExit (&coarmeshdat);
+    memFree   (finecoartax + finemeshptr->m.baseval); /* Free finecoartab as not part of coarse mesh vertex group */
+  }
+  else {                                          /* Cannot coarsen due to lack of memory or error */
+    if (((o = kmeshPartMlUncoarsen (finemeshptr, NULL, NULL)) == 0) && /* Finalize mesh            */
+        ((o = kmeshPartSt          (finemeshptr, paraptr->stratlow)) != 0)) /* Apply low strategy  */
+      errorPrint ("kmeshPartMl2: cannot apply low strategy");
+  }
+
+  return (o);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the multi-level
+** k-way partitioning.
+** It returns:
+** - 0   : if partition could be computed.
+** - !0  : on error.
+*/
+
+int
+kmeshPartMl (
+Kmesh * restrict const          meshptr,          /*+ Active mesh       +*/
+const KmeshPartMlParam * const  paraptr)          /*+ Method parameters +*/
+{
+  INT                 levlnum;                    /* Save value for mesh level */
+  int                 o;
+
+  levlnum = meshptr->levlnum;                     /* Save mesh level                  */
+  meshptr->levlnum = 0;                           /* Initialize coarsening level      */
+  o = kmeshPartMl2 (meshptr, paraptr);            /* Perform multi-level partitioning */
+  meshptr->levlnum = levlnum;                     /* Restore mesh level               */
+
+  return (o);
+}
@@ -0,0 +1,309 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_part_st.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the strategy and   **/
+/**                method tables for k-way mesh partitio-  **/
+/**                ning.                                   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KMESH_PART_ST
+
+#include "module.h"
+#include "common.h"
+#include "gain.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+#include "kmesh_part_fm.h"
+#include "kmesh_part_gg.h"
+#include "kmesh_part_ml.h"
+#include "kmesh_part_st.h"
+
+/*
+**  The static and global variables.
+*/
+
+static Kmesh                kmeshdummy;           /* Dummy active mesh for offset computations */
+
+static union {
+  KmeshPartFmParam          param;
+  StratNodeMethodData       padding;
+} kmeshpartdefaultfm = { { 200, -1, 0.05 } };
+
+static union {
+  KmeshPartGgParam          param;
+  StratNodeMethodData       padding;
+} kmeshpartdefaultgg = { { 5 } };
+
+static union {
+  KmeshPartMlParam          param;
+  StratNodeMethodData       padding;
+} kmeshpartdefaultml = { { 20, 0.8, &stratdummy, &stratdummy } };
+
+static StratMethodTab       kmeshpartstmethtab[] = { /* Mesh partitioning methods array */
+                              { KMESHPARTSTMETHFM, "f",  (StratMethodFunc) kmeshPartFm, &kmeshpartdefaultfm },
+                              { KMESHPARTSTMETHGG, "g",  (StratMethodFunc) kmeshPartGg, &kmeshpartdefaultgg },
+                              { KMESHPARTSTMETHML, "m",  (StratMethodFunc) kmeshPartMl, &kmeshpartdefaultml },
+                              { -1,                NULL, (StratMethodFunc) NULL,        NULL } };
+
+static StratParamTab        kmeshpartstparatab[] = { /* Method parameter list */
+                              { KMESHPARTSTMETHFM,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kmeshpartdefaultfm.param,
+                                (byte *) &kmeshpartdefaultfm.param.deltval,
+                                NULL },
+                              { KMESHPARTSTMETHFM,  STRATPARAMINT,    "move",
+                                (byte *) &kmeshpartdefaultfm.param,
+                                (byte *) &kmeshpartdefaultfm.param.movenbr,
+                                NULL },
+                              { KMESHPARTSTMETHFM,  STRATPARAMINT,    "pass",
+                                (byte *) &kmeshpartdefaultfm.param,
+                                (byte *) &kmeshpartdefaultfm.param.passnbr,
+                                NULL },
+                              { KMESHPARTSTMETHGG,  STRATPARAMINT,    "pass",
+                                (byte *) &kmeshpartdefaultgg.param,
+                                (byte *) &kmeshpartdefaultgg.param.passnbr,
+                                NULL },
+                              { KMESHPARTSTMETHML,  STRATPARAMSTRAT,  "asc",
+                                (byte *) &kmeshpartdefaultml.param,
+                                (byte *) &kmeshpartdefaultml.param.stratasc,
+                                (void *) &kmeshpartststratab },
+                              { KMESHPARTSTMETHML,  STRATPARAMSTRAT,  "low",
+                                (byte *) &kmeshpartdefaultml.param,
+                                (byte *) &kmeshpartdefaultml.param.stratlow,
+                                (void *) &kmeshpartststratab },
+                              { KMESHPARTSTMETHML,  STRATPARAMINT,    "vert",
+                                (byte *) &kmeshpartdefaultml.param,
+                                (byte *) &kmeshpartdefaultml.param.coarnbr,
+                                NULL },
+                              { KMESHPARTSTMETHML,  STRATPARAMDOUBLE, "rat",
+                                (byte *) &kmeshpartdefaultml.param,
+                                (byte *) &kmeshpartdefaultml.param.coarval,
+                                NULL },
+                              { KMESHPARTSTMETHNBR, STRATPARAMINT,    NULL,
+                                NULL, NULL, NULL } };
+
+static StratParamTab        kmeshpartstcondtab[] = { /* Active mesh condition parameter table */
+                              { STRATNODECOND,      STRATPARAMINT,    "edge",
+                                (byte *) &kmeshdummy,
+                                (byte *) &kmeshdummy.m.edgenbr,
+                                NULL },
+                              { STRATNODECOND,      STRATPARAMINT,    "elem",
+                                (byte *) &kmeshdummy,
+                                (byte *) &kmeshdummy.m.velmnbr,
+                                NULL },
+                              { STRATNODECOND,      STRATPARAMINT,    "levl",
+                                (byte *) &kmeshdummy,
+                                (byte *) &kmeshdummy.levlnum,
+                                NULL },
+                              { STRATNODECOND,      STRATPARAMINT,    "node",
+                                (byte *) &kmeshdummy,
+                                (byte *) &kmeshdummy.m.vnodnbr,
+                                NULL },
+                              { STRATNODECOND,      STRATPARAMINT,    "part",
+                                (byte *) &kmeshdummy,
+                                (byte *) &kmeshdummy.partnbr,
+                                NULL },
+                              { STRATNODENBR,       STRATPARAMINT,    NULL,
+                                NULL, NULL, NULL } };
+
+StratTab                    kmeshpartststratab = { /* Strategy tables for mesh partitioning methods */
+                              kmeshpartstmethtab,
+                              kmeshpartstparatab,
+                              kmeshpartstcondtab };
+
+/*********************************************/
+/*                                           */
+/* This is the generic partitioning routine. */
+/*                                           */
+/*********************************************/
+
+/* This routine computes the overload of the
+** given part load array, with respect to the
+** last imbalance ratio used on the mesh.
+** It returns:
+** - the overload, in all cases.
+*/
+
+static
+Gnum
+kmeshPartStOvl (
+const Kmesh * restrict const  meshptr,
+const Gnum * restrict const   compload)
+{
+  Gnum                loadmax;
+  Gnum                loadovl;
+  Anum                partnum;
+
+  loadmax = kmeshLoadMax (meshptr, meshptr->kbalval);
+  for (partnum = 0, loadovl = 0; partnum < meshptr->partnbr; partnum ++) {
+    if (compload[partnum] > loadmax)
+      loadovl += compload[partnum] - loadmax;
+  }
+
+  return (loadovl);
+}
+
+/* This routine computes the partition of
+** the given mesh according to the given
+** strategy.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+kmeshPartSt (
+Kmesh * restrict const        meshptr,            /*+ Active mesh                   +*/
+const Strat * restrict const  straptr)            /*+ Mesh partitioning strategy    +*/
+{
+  StratTest           testdat;                    /* Result of condition evaluation */
+  KmeshStore          savetab[2];                 /* Results of the two strategies  */
+  Gnum                loadovl0;
+  Gnum                loadovl1;
+  int                 o;
+  int                 o0;
+  int                 o1;
+
+#ifdef SCOTCH_DEBUG_KMESH2
+  if (sizeof (Gnum) != sizeof (INT)) {
+    errorPrint ("kmeshPartSt: invalid type specification for parser variables");
+    return (1);
+  }
+  if ((sizeof (KmeshPartFmParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (KmeshPartGgParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (KmeshPartMlParam) > sizeof (StratNodeMethodData))) {
+    errorPrint ("kmeshPartSt: invalid type specification");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KMESH2 */
+#ifdef SCOTCH_DEBUG_KMESH1
+  if ((straptr->tablptr != &kmeshpartststratab) &&
+      (straptr          != &stratdummy)) {
+    errorPrint ("kmeshPartSt: invalid parameter (1)");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KMESH1 */
+
+  o = 0;
+  switch (straptr->typeval) {
+    case STRATNODECONCAT :
+      o = kmeshPartSt (meshptr, straptr->data.concdat.stratab[0]); /* Apply the first strategy      */
+      if (o == 0)                                 /* If it worked all right                         */
+        o |= kmeshPartSt (meshptr, straptr->data.concdat.stratab[1]); /* Then apply second strategy */
+      break;
+    case STRATNODECOND :
+      o = stratTestEval (straptr->data.conddat.testptr, &testdat, (void *) meshptr); /* Evaluate expression */
+      if (o == 0) {                               /* If evaluation was correct */
+#ifdef SCOTCH_DEBUG_KMESH2
+        if ((testdat.testval != STRATTESTVAL) ||
+            (testdat.nodeval != STRATPARAMLOG)) {
+          errorPrint ("kmeshPartSt: invalid test result");
+          o = 1;
+          break;
+        }
+#endif /* SCOTCH_DEBUG_KMESH2 */
+        if (testdat.data.val.vallog == 1)         /* If expression is true                        */
+          o = kmeshPartSt (meshptr, straptr->data.conddat.stratab[0]); /* Apply first strategy    */
+        else {                                    /* Else if expression is false                  */
+          if (straptr->data.conddat.stratab[1] != NULL) /* And if there is an else statement      */
+            o = kmeshPartSt (meshptr, straptr->data.conddat.stratab[1]); /* Apply second strategy */
+        }
+      }
+      break;
+    case STRATNODEEMPTY :
+      break;
+    case STRATNODESELECT :
+      if (((kmeshStoreInit (meshptr, &savetab[0])) != 0) || /* Allocate save areas */
+          ((kmeshStoreInit (meshptr, &savetab[1])) != 0)) {
+        errorPrint     ("kmeshPartSt: out of memory");
+        kmeshStoreExit (&savetab[0]);
+        return (1);
+      }
+
+      kmeshStoreSave   (meshptr, &savetab[1]);    /* Save initial partition                   */
+      o0 = kmeshPartSt (meshptr, straptr->data.seledat.stratab[0]); /* Apply first strategy  */
+      kmeshStoreSave   (meshptr, &savetab[0]);    /* Save its result                          */
+      kmeshStoreUpdt   (meshptr, &savetab[1]);    /* Restore initial partition                */
+      o1 = kmeshPartSt (meshptr, straptr->data.seledat.stratab[1]); /* Apply second strategy */
+
+      if ((o0 | o1) != 0) {                       /* If at least one method failed */
+        if (o0 == 0)                              /* If first succeeded, take it   */
+          goto take0;
+        if (o1 != 0) {                            /* If none succeeded           */
+          kmeshStoreUpdt (meshptr, &savetab[1]);  /* Restore initial partition   */
+          o = 1;                                  /* Indicate error              */
+        }
+        goto take1;                               /* If second succeeded, keep it; anyway, go freeing data structures */
+      }
+
+      loadovl0 = kmeshPartStOvl (meshptr, (Gnum *) savetab[0].datatab); /* TRICK: part loads are first in save area */
+      loadovl1 = kmeshPartStOvl (meshptr, meshptr->compload);
+      if ((loadovl0 > loadovl1) ||                /* If second strategy is better */
+          ((loadovl0 == loadovl1) && (savetab[0].commload >= meshptr->commload)))
+        goto take1;
+
+take0:
+      kmeshStoreUpdt (meshptr, &savetab[0]);      /* Restore first partition          */
+take1:                                            /* Keep second partition by default */
+      kmeshStoreExit (&savetab[1]);               /* Free both save areas             */
+      kmeshStoreExit (&savetab[0]);
+      break;
+#ifdef SCOTCH_DEBUG_KMESH2
+    case STRATNODEMETHOD :
+#else /* SCOTCH_DEBUG_KMESH2 */
+    default :
+#endif /* SCOTCH_DEBUG_KMESH2 */
+      return (((KmeshPartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+              (meshptr, (const void * const) &straptr->data.methdat.datadat));
+#ifdef SCOTCH_DEBUG_KMESH2
+    default :
+      errorPrint ("kmeshPartSt: invalid parameter (2)");
+      return (1);
+#endif /* SCOTCH_DEBUG_KMESH2 */
+  }
+  return (o);
+}
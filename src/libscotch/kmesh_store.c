@@ -0,0 +1,153 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kmesh_store.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the save data      **/
+/**                structure handling routines for k-way   **/
+/**                mesh partitioning.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+
+/*********************************/
+/*                               */
+/* Store mesh handling routines. */
+/*                               */
+/*********************************/
+
+/* This routine builds a save structure
+** for the given active mesh.
+** It returns:
+** - 0   : if allocation succeeded.
+** - !0  : on error.
+*/
+
+int
+kmeshStoreInit (
+const Kmesh * const         meshptr,
+KmeshStore * const          storptr)
+{
+  size_t              savsize;
+
+  savsize = meshptr->partnbr * sizeof (Gnum) +    /* Compute size for part load and part arrays */
+            meshptr->m.velmnbr * sizeof (Anum);
+
+  if ((storptr->datatab = (byte *) memAlloc (savsize)) == NULL) { /* Allocate save structure */
+    errorPrint ("kmeshStoreInit: out of memory");
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine frees a save structure.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kmeshStoreExit (
+KmeshStore * const          storptr)
+{
+  memFree (storptr->datatab);
+#ifdef SCOTCH_DEBUG_KMESH2
+  storptr->datatab = NULL;
+#endif /* SCOTCH_DEBUG_KMESH2 */
+}
+
+/* This routine saves partition data from the
+** given active mesh to the given save structure.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kmeshStoreSave (
+const Kmesh * const         meshptr,
+KmeshStore * const          storptr)
+{
+  byte *              compload;                   /* Pointer to part load data save area */
+  byte *              parttab;                    /* Pointer to partition data save area */
+
+  storptr->commload = meshptr->commload;          /* Save partition parameters */
+
+  compload = storptr->datatab;                    /* Compute data offsets within save structure */
+  parttab  = compload + meshptr->partnbr * sizeof (Gnum);
+
+  memCpy (compload, meshptr->compload, meshptr->partnbr * sizeof (Gnum));
+  memCpy (parttab,  meshptr->parttax + meshptr->m.velmbas, meshptr->m.velmnbr * sizeof (Anum));
+}
+
+/* This routine updates partition data of the
+** given active mesh, using the given save mesh.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kmeshStoreUpdt (
+Kmesh * const               meshptr,
+const KmeshStore * const    storptr)
+{
+  byte *              compload;                   /* Pointer to part load data save area */
+  byte *              parttab;                    /* Pointer to partition data save area */
+
+  meshptr->commload = storptr->commload;          /* Load partition parameters */
+
+  compload = storptr->datatab;                    /* Compute data offsets within save structure */
+  parttab  = compload + meshptr->partnbr * sizeof (Gnum);
+
+  memCpy (meshptr->compload, compload, meshptr->partnbr * sizeof (Gnum));
+  memCpy (meshptr->parttax + meshptr->m.velmbas, parttab, meshptr->m.velmnbr * sizeof (Anum));
+
+#ifdef SCOTCH_DEBUG_KMESH2
+  if (kmeshCheck (meshptr) != 0)
+    errorPrint ("kmeshStoreUpdt: inconsistent mesh data");
+#endif /* SCOTCH_DEBUG_KMESH2 */
+}
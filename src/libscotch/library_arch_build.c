@@ -137,6 +137,11 @@ const SCOTCH_Strat * const  stratptr)             /*+ Bipartitoning strategy
     return (1);
   }
 
+  if ((((const Graph *) CONTEXTOBJECT (libgrafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_archBuild0) ": compressed graphs not supported");
+    return (1);
+  }
+
   if (CONTEXTINIT (libgrafptr) != 0) {
     errorPrint (STRINGIFY (SCOTCH_archBuild0) ": cannot initialize context");
     return     (1);
@@ -175,6 +180,11 @@ const SCOTCH_Num * const    vnumtab)              /*+ Pointer to sublist
     return (1);
   }
 
+  if ((((const Graph *) CONTEXTOBJECT (libgrafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_archBuild2) ": compressed graphs not supported");
+    return (1);
+  }
+
   if (CONTEXTINIT (libgrafptr) != 0) {
     errorPrint (STRINGIFY (SCOTCH_archBuild2) ": cannot initialize context");
     return     (1);
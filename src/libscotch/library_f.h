@@ -74,6 +74,16 @@
         PARAMETER (SCOTCH_OPTIONNUMRANDOMFIXEDSEED = 1)
         PARAMETER (SCOTCH_OPTIONNUMNBR             = 2)
 
+!* Flag definitions for the coloring
+!* routine.
+
+        INTEGER SCOTCH_COLORNONE
+        INTEGER SCOTCH_COLORGREEDY
+        INTEGER SCOTCH_COLORDIST2
+        PARAMETER (SCOTCH_COLORNONE   = 0)
+        PARAMETER (SCOTCH_COLORGREEDY = 1)
+        PARAMETER (SCOTCH_COLORDIST2  = 2)
+
 !* Flag definitions for the coarsening
 !* routines.
 
@@ -117,6 +127,15 @@
         PARAMETER (SCOTCH_STRATSEPASIMPLE   = 32768)
         PARAMETER (SCOTCH_STRATDISCONNECTED = 65536)
 
+!* Flag definitions for the streaming
+!* partitioning routine.
+
+        INTEGER SCOTCH_STREAMFENNEL
+        INTEGER SCOTCH_STREAMLDG
+
+        PARAMETER (SCOTCH_STREAMFENNEL      = 0)
+        PARAMETER (SCOTCH_STREAMLDG         = 1)
+
 !* Size definitions for the SCOTCH opaque
 !* structures. These structures must be
 !* allocated as arrays of DOUBLEPRECISION
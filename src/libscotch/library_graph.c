@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2018,2019,2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2018,2019,2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 31 may 2021     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 11 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -174,7 +174,9 @@ FILE * const                stream,
 const SCOTCH_Num            baseval,
 const SCOTCH_Num            flagval)
 {
+  CONTEXTDECL        (grafptr);
   GraphLoadFlag       flagtmp;                    /* Graph load flags */
+  int                 o;
 
   if ((flagval < 0) || (flagval > 3)) {
     errorPrint (STRINGIFY (SCOTCH_graphLoad) ": invalid flag parameter");
@@ -192,7 +194,15 @@ const SCOTCH_Num            flagval)
   flagtmp = (((flagval & 1) != 0) ? GRAPHIONOLOADVERT : 0) +
             (((flagval & 2) != 0) ? GRAPHIONOLOADEDGE : 0);
 
-  return (graphLoad ((Graph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, flagtmp));
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphLoad) ": cannot initialize context");
+    return (1);
+  }
+
+  o = graphLoadText ((Graph * const) CONTEXTGETOBJECT (grafptr), stream, (Gnum) baseval, flagtmp, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
@@ -207,6 +217,11 @@ SCOTCH_graphSave (
 const SCOTCH_Graph * const  grafptr,
 FILE * const                stream)
 {
+  if ((((const Graph *) CONTEXTOBJECT (grafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphSave) ": compressed graphs not supported");
+    return (1);
+  }
+
   return (graphSave ((const Graph * const) CONTEXTOBJECT (grafptr), stream));
 }
 
@@ -224,11 +239,11 @@ SCOTCH_graphBuild (
 SCOTCH_Graph * const        grafptr,              /* Graph structure to fill             */
 const SCOTCH_Num            baseval,              /* Base value                          */
 const SCOTCH_Num            vertnbr,              /* Number of vertices                  */
-const SCOTCH_Num * const    verttab,              /* Vertex array [vertnbr or vertnbr+1] */
-const SCOTCH_Num * const    vendtab,              /* Vertex end array [vertnbr]          */
+const SCOTCH_Edge * const   verttab,              /* Vertex array [vertnbr or vertnbr+1] */
+const SCOTCH_Edge * const   vendtab,              /* Vertex end array [vertnbr]          */
 const SCOTCH_Num * const    velotab,              /* Vertex load array                   */
 const SCOTCH_Num * const    vlbltab,              /* Vertex label array                  */
-const SCOTCH_Num            edgenbr,              /* Number of edges (arcs)              */
+const SCOTCH_Edge           edgenbr,              /* Number of edges (arcs)              */
 const SCOTCH_Num * const    edgetab,              /* Edge array [edgenbr]                */
 const SCOTCH_Num * const    edlotab)              /* Edge load array                     */
 {
@@ -250,14 +265,16 @@ const SCOTCH_Num * const    edlotab)              /* Edge load array
   srcgrafptr->baseval = baseval;
   srcgrafptr->vertnbr = vertnbr;
   srcgrafptr->vertnnd = vertnbr + baseval;
-  srcgrafptr->verttax = (Gnum *) verttab - baseval;
-  srcgrafptr->vendtax = ((vendtab == NULL) || (vendtab == verttab)) ? srcgrafptr->verttax + 1 : (Gnum *) vendtab - baseval;
-  srcgrafptr->velotax = ((velotab == NULL) || (velotab == verttab)) ? NULL : (Gnum *) velotab - baseval;
+  srcgrafptr->verttax = (Genum *) verttab - baseval;
+  srcgrafptr->vendtax = ((vendtab == NULL) || (vendtab == verttab)) ? srcgrafptr->verttax + 1 : (Genum *) vendtab - baseval;
+  srcgrafptr->velotax = ((velotab == NULL) || ((const void *) velotab == (const void *) verttab)) ? NULL : (Gnum *) velotab - baseval;
   srcgrafptr->vnumtax = NULL;
-  srcgrafptr->vlbltax = ((vlbltab == NULL) || (vlbltab == verttab)) ? NULL : (Gnum *) vlbltab - baseval;
+  srcgrafptr->vlbltax = ((vlbltab == NULL) || ((const void *) vlbltab == (const void *) verttab)) ? NULL : (Gnum *) vlbltab - baseval;
   srcgrafptr->edgenbr = edgenbr;
   srcgrafptr->edgetax = (Gnum *) edgetab - baseval;
   srcgrafptr->edlotax = ((edlotab == NULL) || (edlotab == edgetab)) ? NULL : (Gnum *) edlotab - baseval;
+  srcgrafptr->vconnbr = 0;                        /* No vertex load constraints */
+  srcgrafptr->vcontax = NULL;
 
   if (srcgrafptr->velotax == NULL)                /* Compute vertex load sum */
     srcgrafptr->velosum = vertnbr;
@@ -286,7 +303,7 @@ const SCOTCH_Num * const    edlotab)              /* Edge load array
 
     for (vertnum = srcgrafptr->baseval, edlosum = degrmax = 0;
          vertnum < srcgrafptr->vertnnd; vertnum ++) {
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                degrval;                /* Degree of current vertex */
 
       degrval = srcgrafptr->vendtax[vertnum] - srcgrafptr->verttax[vertnum];
@@ -302,6 +319,113 @@ const SCOTCH_Num * const    edlotab)              /* Edge load array
   return (0);
 }
 
+/*+ This routine fills the contents of the given
+*** opaque graph structure with the data provided
+*** by the user, for graphs carrying several vertex
+*** load constraints. For each vertex, vcontab holds
+*** vconnbr consecutive loads; this array is copied
+*** into the graph. A combined vertex load array, in
+*** which each constraint is normalized with respect
+*** to its overall sum, is also computed and stored
+*** in the graph, so as to drive the graph partitioning
+*** and mapping routines, while per-constraint balance
+*** is enforced by the k-way multi-constraint balancing
+*** method.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphBuildMulti (
+SCOTCH_Graph * const        grafptr,              /* Graph structure to fill             */
+const SCOTCH_Num            baseval,              /* Base value                          */
+const SCOTCH_Num            vertnbr,              /* Number of vertices                  */
+const SCOTCH_Edge * const   verttab,              /* Vertex array [vertnbr or vertnbr+1] */
+const SCOTCH_Edge * const   vendtab,              /* Vertex end array [vertnbr]          */
+const SCOTCH_Num            vconnbr,              /* Number of vertex load constraints   */
+const SCOTCH_Num * const    vcontab,              /* Constraint loads [vconnbr*vertnbr]   */
+const SCOTCH_Num * const    vlbltab,              /* Vertex label array                  */
+const SCOTCH_Edge           edgenbr,              /* Number of edges (arcs)              */
+const SCOTCH_Num * const    edgetab,              /* Edge array [edgenbr]                */
+const SCOTCH_Num * const    edlotab)              /* Edge load array                     */
+{
+  Graph *             srcgrafptr;                 /* Pointer to source graph structure   */
+  Gnum *              vcontab2;                   /* Copy of constraint load array       */
+  Gnum *              velotab;                    /* Combined vertex load array          */
+  double *            scaltab;                    /* Normalization factor of constraints */
+  double              vconmax;                    /* Largest constraint load sum         */
+  double              targval;                    /* Load sum of normalized constraints  */
+  Gnum                velosum;
+  Gnum                vertnum;
+  Gnum                vconnum;
+
+  if ((vconnbr < 1) || (vcontab == NULL)) {
+    errorPrint (STRINGIFY (SCOTCH_graphBuildMulti) ": invalid constraint parameters");
+    return (1);
+  }
+
+  if (SCOTCH_graphBuild (grafptr, baseval, vertnbr, verttab, vendtab, NULL, vlbltab, edgenbr, edgetab, edlotab) != 0)
+    return (1);
+
+  if (memAllocGroup ((void **) (void *)
+                     &vcontab2, (size_t) (MAX (vertnbr * vconnbr, 1) * sizeof (Gnum)),
+                     &velotab,  (size_t) (MAX (vertnbr, 1)           * sizeof (Gnum)),
+                     &scaltab,  (size_t) (vconnbr                    * sizeof (double)), NULL) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_graphBuildMulti) ": out of memory");
+    return (1);
+  }
+
+  for (vconnum = 0; vconnum < vconnbr; vconnum ++) /* Compute constraint load sums */
+    scaltab[vconnum] = 0.0;
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    for (vconnum = 0; vconnum < vconnbr; vconnum ++) {
+      Gnum                vconval;
+
+      vconval = vcontab[vertnum * vconnbr + vconnum];
+      if (vconval < 0) {
+        errorPrint (STRINGIFY (SCOTCH_graphBuildMulti) ": invalid constraint load array");
+        memFree    (vcontab2);                    /* Free group leader */
+        return (1);
+      }
+      scaltab[vconnum] += (double) vconval;
+      vcontab2[vertnum * vconnbr + vconnum] = vconval;
+    }
+  }
+
+  for (vconnum = 0, vconmax = 0.0; vconnum < vconnbr; vconnum ++) {
+    if (scaltab[vconnum] > vconmax)
+      vconmax = scaltab[vconnum];
+  }
+  targval = MIN (vconmax, (double) GNUMMAX / (double) (4 * vconnbr)); /* Keep combined load sum far from overflow */
+  for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+    scaltab[vconnum] = (scaltab[vconnum] > 0.0) ? (targval / scaltab[vconnum]) : 0.0;
+
+  for (vertnum = 0, velosum = 0; vertnum < vertnbr; vertnum ++) {
+    double              veloval;
+    Gnum                velotmp;
+
+    for (vconnum = 0, veloval = 0.0; vconnum < vconnbr; vconnum ++)
+      veloval += (double) vcontab[vertnum * vconnbr + vconnum] * scaltab[vconnum];
+
+    velotmp = (Gnum) (veloval + 0.5);
+    if ((velotmp == 0) &&                         /* Vertices which bear some load must not be neglected */
+        ((veloval > 0.0) || (vconmax <= 0.0)))    /* Vertices are equivalent if no constraint bears load */
+      velotmp = 1;
+    velotab[vertnum] = velotmp;
+    velosum += velotmp;
+  }
+
+  srcgrafptr = (Graph *) CONTEXTOBJECT (grafptr);
+  srcgrafptr->flagval |= GRAPHFREEVCON;           /* Constraint array group belongs to the graph */
+  srcgrafptr->velotax  = velotab - baseval;
+  srcgrafptr->velosum  = velosum;
+  srcgrafptr->vconnbr  = vconnbr;
+  srcgrafptr->vcontax  = vcontab2 - baseval * vconnbr;
+
+  return (0);
+}
+
 /*+ This routine accesses graph size data.
 *** NULL pointers on input indicate unwanted
 *** data.
@@ -313,7 +437,7 @@ void
 SCOTCH_graphSize (
 const SCOTCH_Graph * const  grafptr,
 SCOTCH_Num * const          vertnbr,
-SCOTCH_Num * const          edgenbr)
+SCOTCH_Edge * const         edgenbr)
 {
   const Graph *       srcgrafptr;
 
@@ -322,7 +446,7 @@ SCOTCH_Num * const          edgenbr)
   if (vertnbr != NULL)
     *vertnbr = (SCOTCH_Num) (srcgrafptr->vertnbr);
   if (edgenbr != NULL)
-    *edgenbr = (SCOTCH_Num) srcgrafptr->edgenbr;
+    *edgenbr = (SCOTCH_Edge) srcgrafptr->edgenbr;
 }
 
 /*+ This routine accesses all of the graph data.
@@ -338,11 +462,11 @@ SCOTCH_graphData (
 const SCOTCH_Graph * const  grafptr,              /* Graph structure to read  */
 SCOTCH_Num * const          baseptr,              /* Base value               */
 SCOTCH_Num * const          vertptr,              /* Number of vertices       */
-SCOTCH_Num ** const         verttab,              /* Vertex array [vertnbr+1] */
-SCOTCH_Num ** const         vendtab,              /* Vertex array [vertnbr]   */
+SCOTCH_Edge ** const        verttab,              /* Vertex array [vertnbr+1] */
+SCOTCH_Edge ** const        vendtab,              /* Vertex array [vertnbr]   */
 SCOTCH_Num ** const         velotab,              /* Vertex load array        */
 SCOTCH_Num ** const         vlbltab,              /* Vertex label array       */
-SCOTCH_Num * const          edgeptr,              /* Number of edges (arcs)   */
+SCOTCH_Edge * const         edgeptr,              /* Number of edges (arcs)   */
 SCOTCH_Num ** const         edgetab,              /* Edge array [edgenbr]     */
 SCOTCH_Num ** const         edlotab)              /* Edge load array          */
 {
@@ -365,7 +489,7 @@ SCOTCH_Num ** const         edlotab)              /* Edge load array          */
   if (edgeptr != NULL)
     *edgeptr = srcgrafptr->edgenbr;
   if (edgetab != NULL)
-    *edgetab = srcgrafptr->edgetax + srcgrafptr->baseval;
+    *edgetab = (srcgrafptr->edgetax != NULL) ? srcgrafptr->edgetax + srcgrafptr->baseval : NULL; /* NULL if graph is compressed */
   if (edlotab != NULL)
     *edlotab = (srcgrafptr->edlotax != NULL) ? srcgrafptr->edlotax + srcgrafptr->baseval : NULL;
 }
@@ -406,7 +530,7 @@ double *                    edlodltptr)
   Gnum                degrmax;
   double              degravg;
   double              degrdlt;
-  Gnum                edgenum;
+  Genum               edgenum;
   Gnum                edlomin;
   Gnum                edlomax;
   Gnum                edlosum;
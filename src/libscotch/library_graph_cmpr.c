@@ -0,0 +1,96 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_cmpr.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the source   **/
+/**                graph adjacency compression routines    **/
+/**                of the libSCOTCH library.               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "scotch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* the graph handling routines.     */
+/*                                  */
+/************************************/
+
+/*+ This routine replaces the edge array
+*** of the given graph by a compressed
+*** representation of its adjacency.
+*** Only graph checking, coarsening and
+*** induction routines accept compressed
+*** graphs.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphCompress (
+SCOTCH_Graph * const        grafptr)
+{
+  return (graphCmprBuild ((Graph *) CONTEXTOBJECT (grafptr)));
+}
+
+/*+ This routine restores a plain edge
+*** array for the given compressed graph.
+*** Adjacency lists are sorted by
+*** increasing vertex index.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphUncompress (
+SCOTCH_Graph * const        grafptr)
+{
+  return (graphCmprExpand ((Graph *) CONTEXTOBJECT (grafptr)));
+}
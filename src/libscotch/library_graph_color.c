@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 02 jan 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 24 aug 2019     **/
-/**                                 to   : 16 jan 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,9 +53,8 @@
 #include "module.h"
 #include "common.h"
 #include "context.h"
-#include "arch.h"
 #include "graph.h"
-#include "graph_coarsen.h"
+#include "graph_color.h"
 #include "scotch.h"
 
 /*********************************/
@@ -66,11 +65,20 @@
 /*********************************/
 
 /*+ This routine creates a color array for the
-*** given graph.
+*** given graph, using all the threads of its
+*** context. By default, colors are computed by
+*** Luby rounds, one color per round. Flag
+*** SCOTCH_COLORGREEDY selects speculative greedy
+*** coloring with conflict repair, which uses far
+*** fewer colors, and flag SCOTCH_COLORDIST2 asks
+*** for a distance-2 coloring, in which no two
+*** vertices sharing a neighbor have the same
+*** color. For a given state of the random
+*** generator, colorings do not depend on the
+*** number of threads.
 *** It returns:
-*** - 0  : if the graph has been coarsened.
-*** - 1  : if the graph could not be coarsened.
-*** - 2  : on error.
+*** - 0   : on success.
+*** - !0  : on error.
 +*/
 
 int
@@ -78,96 +86,27 @@ SCOTCH_graphColor (
 const SCOTCH_Graph * const  libgrafptr,           /* Graph to color              */
 SCOTCH_Num * const          colotab,              /* Pointer to color array      */
 SCOTCH_Num * const          coloptr,              /* Pointer to number of colors */
-const SCOTCH_Num            flagval)              /* Flag value (not used)       */
+const SCOTCH_Num            flagval)              /* Coloring flags              */
 {
   CONTEXTDECL        (libgrafptr);
-  Gnum                baseval;
-  Gnum                vertnum;
-  Gnum                vertnbr;
-  Gnum                vertnnd;
-  Gnum                queunnd;
-  Gnum * restrict     queutax;
-  Gnum * restrict     randtax;
-  Gnum                colonum;
-  Gnum * restrict     colotax;
+  Gnum                colonbr;
   int                 o;
 
+  if ((flagval & ~(SCOTCH_COLORGREEDY | SCOTCH_COLORDIST2)) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphColor) ": invalid flags");
+    return (1);
+  }
+
   if (CONTEXTINIT (libgrafptr) != 0) {
     errorPrint (STRINGIFY (SCOTCH_graphColor) ": cannot initialize context");
     return (1);
   }
 
   const Graph * restrict const  grafptr = CONTEXTGETOBJECT (libgrafptr);
-  const Gnum * restrict const   verttax = grafptr->verttax;
-  const Gnum * restrict const   vendtax = grafptr->vendtax;
-  const Gnum * restrict const   edgetax = grafptr->edgetax;
-
-  baseval = grafptr->baseval;
-  vertnbr = grafptr->vertnbr;
-  vertnnd = vertnbr + baseval;
-
-  memSet (colotab, ~0, vertnbr * sizeof (Gnum));
-  colotax = ((Gnum *) colotab) - baseval;
-
-  o = 1;                                          /* Assume an error */
-
-  if (memAllocGroup ((void **) (void *)
-                     &queutax, (size_t) (vertnbr * sizeof (Gnum)),
-                     &randtax, (size_t) (vertnbr * sizeof (Gnum)), NULL) == NULL) {
-    errorPrint (STRINGIFY (SCOTCH_graphColor) ": out of memory");
-    goto abort;
-  }
-  queutax -= baseval;
-  randtax -= baseval;
-
-  for (vertnum = baseval; vertnum < vertnnd; vertnum ++)
-    randtax[vertnum] = contextIntRandVal (CONTEXTGETDATA (libgrafptr), 32768);
-
-  queunnd = vertnnd;
-  for (colonum = 0; queunnd > baseval; colonum ++) { /* Color numbers are not based */
-    Gnum                queuold;
-    Gnum                queunew;
-
-    for (queunew = queuold = baseval; queuold < queunnd; queuold ++) {
-      Gnum                vertnum;
-      Gnum                edgenum;
-      Gnum                edgennd;
-      Gnum                randval;
-
-      vertnum = (queunnd == vertnnd) ? queuold : queutax[queuold];
-      randval = randtax[vertnum];
-      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
-        Gnum                vertend;
-        Gnum                randend;
-        Gnum                coloend;
-
-        vertend = edgetax[edgenum];
-        coloend = colotax[vertend];
-
-        if ((coloend >= 0) &&                     /* If vertex has been colored    */
-            (coloend < colonum))                  /* In a former pass              */
-          continue;                               /* Do not consider it any longer */
-
-        randend = randtax[vertend];
-        if ((randend > randval) ||
-            ((randend == randval) && (vertend > vertnum))) /* Tie breaking when same random value */
-          break;
-      }
-      if (edgenum >= edgennd)
-        colotax[vertnum] = colonum;
-      else
-        queutax[queunew ++] = vertnum;
-    }
-    queunnd = queunew;
-  }
-
-  *coloptr = colonum;                             /* Set number of colors found */
-
-  memFree (queutax + baseval);
 
-  o = 0;
+  o = graphColor (grafptr, ((Gnum *) colotab) - grafptr->baseval, &colonbr, (int) flagval, CONTEXTGETDATA (libgrafptr));
+  *coloptr = (SCOTCH_Num) colonbr;
 
-abort:
   CONTEXTEXIT (libgrafptr);
   return (o);
 }
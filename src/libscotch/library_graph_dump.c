@@ -1,4 +1,4 @@
-/* Copyright 2019,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 28 dec 2019     **/
 /**                                 to   : 09 jan 2020     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -85,8 +85,12 @@ FILE * const                fileptr)
   prefstr = (prefptr != NULL) ? prefptr : "";
   suffstr = (suffptr != NULL) ? suffptr : "";
   grafptr = (const Graph *) libgrafptr;
+  if ((grafptr->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphDump) ": compressed graphs not supported");
+    return (1);
+  }
 
-  o = graphDumpArrays (grafptr, "SCOTCH_Num", prefstr, suffstr, fileptr);
+  o = graphDumpArrays (grafptr, "SCOTCH_Num", "SCOTCH_Edge", prefstr, suffstr, fileptr);
 
   o |= (fprintf (fileptr,
                  "int\n"
@@ -109,7 +113,7 @@ FILE * const                fileptr)
     o |= (fprintf (fileptr, ", NULL") < 0);
 
   o |= (fprintf (fileptr,
-                 ",\n                             " GNUMSTRING ", %sedgetab%s",
+                 ",\n                             " GENUMSTRING ", %sedgetab%s",
                  grafptr->edgenbr, prefstr, suffstr) < 0);
   if (grafptr->edlotax != NULL)
     o |= (fprintf (fileptr, ", %sedlotab%s", prefstr, suffstr) < 0);
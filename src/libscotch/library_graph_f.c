@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 15 mar 2021     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -205,11 +205,11 @@ GRAPHBUILD, graphbuild, (             \
 SCOTCH_Graph * const        grafptr,  \
 const SCOTCH_Num * const    baseval,  \
 const SCOTCH_Num * const    vertnbr,  \
-const SCOTCH_Num * const    verttab,  \
-const SCOTCH_Num * const    vendtab,  \
+const SCOTCH_Edge * const   verttab,  \
+const SCOTCH_Edge * const   vendtab,  \
 const SCOTCH_Num * const    velotab,  \
 const SCOTCH_Num * const    vlbltab,  \
-const SCOTCH_Num * const    edgenbr,  \
+const SCOTCH_Edge * const   edgenbr,  \
 const SCOTCH_Num * const    edgetab,  \
 const SCOTCH_Num * const    edlotab,  \
 int * const                 revaptr), \
@@ -225,11 +225,37 @@ int * const                 revaptr), \
 **
 */
 
+SCOTCH_FORTRAN (                      \
+GRAPHBUILDMULTI, graphbuildmulti, (   \
+SCOTCH_Graph * const        grafptr,  \
+const SCOTCH_Num * const    baseval,  \
+const SCOTCH_Num * const    vertnbr,  \
+const SCOTCH_Edge * const   verttab,  \
+const SCOTCH_Edge * const   vendtab,  \
+const SCOTCH_Num * const    vconnbr,  \
+const SCOTCH_Num * const    vcontab,  \
+const SCOTCH_Num * const    vlbltab,  \
+const SCOTCH_Edge * const   edgenbr,  \
+const SCOTCH_Num * const    edgetab,  \
+const SCOTCH_Num * const    edlotab,  \
+int * const                 revaptr), \
+(grafptr, baseval, vertnbr, verttab, vendtab,     \
+ vconnbr, vcontab, vlbltab, edgenbr, edgetab,     \
+ edlotab, revaptr))
+{
+  *revaptr = SCOTCH_graphBuildMulti (grafptr, *baseval, *vertnbr, verttab, vendtab,
+                                     *vconnbr, vcontab, vlbltab, *edgenbr, edgetab, edlotab);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                      \
 GRAPHSIZE, graphsize, (               \
 const SCOTCH_Graph * const  grafptr,  \
 SCOTCH_Num * const          vertptr,  \
-SCOTCH_Num * const          edgeptr), \
+SCOTCH_Edge * const         edgeptr), \
 (grafptr, vertptr, edgeptr))
 {
   SCOTCH_graphSize (grafptr, vertptr, edgeptr);
@@ -249,15 +275,15 @@ SCOTCH_Idx * const          vertidx,          \
 SCOTCH_Idx * const          vendidx,          \
 SCOTCH_Idx * const          veloidx,          \
 SCOTCH_Idx * const          vlblidx,          \
-SCOTCH_Num * const          edgeptr,          \
+SCOTCH_Edge * const         edgeptr,          \
 SCOTCH_Idx * const          edgeidx,          \
 SCOTCH_Idx * const          edloidx),         \
 (grafptr, indxptr, baseptr,                   \
  vertptr, vertidx, vendidx, veloidx, vlblidx, \
  edgeptr, edgeidx, edloidx))
 {
-  SCOTCH_Num *        verttab;                    /* Pointer to graph arrays */
-  SCOTCH_Num *        vendtab;
+  SCOTCH_Edge *       verttab;                    /* Pointer to graph arrays */
+  SCOTCH_Edge *       vendtab;
   SCOTCH_Num *        velotab;
   SCOTCH_Num *        vlbltab;
   SCOTCH_Num *        edgetab;
@@ -265,8 +291,8 @@ SCOTCH_Idx * const          edloidx),         \
 
   SCOTCH_graphData (grafptr, baseptr, vertptr, &verttab, &vendtab, &velotab, &vlbltab,
                     edgeptr, &edgetab, &edlotab);
-  *vertidx = (SCOTCH_Idx) (verttab - indxptr) + 1; /* Add 1 since Fortran indices start at 1 */
-  *vendidx = (SCOTCH_Idx) (vendtab - indxptr) + 1;
+  *vertidx = (SCOTCH_Idx) ((SCOTCH_Num *) verttab - indxptr) + 1; /* Add 1 since Fortran indices start at 1 */
+  *vendidx = (SCOTCH_Idx) ((SCOTCH_Num *) vendtab - indxptr) + 1;
   *veloidx = (velotab != NULL) ? (SCOTCH_Idx) (velotab - indxptr) + 1 : *vertidx;
   *vlblidx = (vlbltab != NULL) ? (SCOTCH_Idx) (vlbltab - indxptr) + 1 : *vertidx;
   *edgeidx = (SCOTCH_Idx) (edgetab - indxptr) + 1;
@@ -1,4 +1,4 @@
-/* Copyright 2018,2019,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2018,2019,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 14 jan 2018     **/
 /**                                 to   : 21 apr 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 15 oct 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,17 +82,23 @@ const SCOTCH_Num                    vnumnbr,
 const SCOTCH_Num * restrict const   vnumtab,
 SCOTCH_Graph * restrict const       indgrafptr)
 {
+  CONTEXTDECL        (orggrafptr);
   int                 o;
 
-  const Graph * const srcorggrafptr = (Graph *) CONTEXTOBJECT (orggrafptr);
   Graph * const       srcindgrafptr = (Graph *) CONTEXTOBJECT (indgrafptr);
 
-  o = graphInduceList (srcorggrafptr,
-                       (const Gnum) vnumnbr,
-                       (const Gnum * restrict const) vnumtab,
-                       srcindgrafptr);
+  if (CONTEXTINIT (orggrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphInduceList) ": cannot initialize context");
+    return (1);
+  }
+
+  o = graphInduceList2 ((const Graph * const) CONTEXTGETOBJECT (orggrafptr),
+                        (const Gnum) vnumnbr,
+                        (const Gnum * restrict const) vnumtab,
+                        srcindgrafptr, CONTEXTGETDATA (orggrafptr));
   srcindgrafptr->vnumtax = NULL;                  /* Neutralize vnumtax for subsequent operations */
 
+  CONTEXTEXIT (orggrafptr);
   return (o);
 }
 
@@ -116,17 +122,26 @@ const SCOTCH_GraphPart2 * restrict const  parttab,
 const SCOTCH_GraphPart2                   partval,
 SCOTCH_Graph * restrict const             indgrafptr)
 {
+  CONTEXTDECL        (orggrafptr);
+  const Graph *       srcorggrafptr;
   int                 o;
 
-  const Graph * const srcorggrafptr = (Graph *) CONTEXTOBJECT (orggrafptr);
   Graph * const       srcindgrafptr = (Graph *) CONTEXTOBJECT (indgrafptr);
 
-  o = graphInducePart (srcorggrafptr,
-                       ((GraphPart * restrict const) parttab) - srcorggrafptr->baseval,
-                       (const Gnum) vnumnbr,
-                       (const GraphPart) partval,
-                       srcindgrafptr);
+  if (CONTEXTINIT (orggrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphInducePart) ": cannot initialize context");
+    return (1);
+  }
+
+  srcorggrafptr = (const Graph *) CONTEXTGETOBJECT (orggrafptr);
+
+  o = graphInducePart2 (srcorggrafptr,
+                        ((GraphPart * restrict const) parttab) - srcorggrafptr->baseval,
+                        (const Gnum) vnumnbr,
+                        (const GraphPart) partval,
+                        srcindgrafptr, NULL, CONTEXTGETDATA (orggrafptr));
   srcindgrafptr->vnumtax = NULL;                  /* Neutralize vnumtax for subsequent operations */
 
+  CONTEXTEXIT (orggrafptr);
   return (o);
 }
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 5.1  : from : 27 apr 2010     **/
 /**                                 to   : 27 apr 2010     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,7 +81,18 @@ FILE * const                  filegrfptr,
 FILE * const                  filegeoptr,
 const char * const            dataptr)
 {
-  return (graphGeomLoadChac ((Graph *) CONTEXTOBJECT (grafptr), (Geom *) geomptr, filegrfptr, filegeoptr, dataptr));
+  CONTEXTDECL        (grafptr);
+  int                 o;
+
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphGeomLoadChac) ": cannot initialize context");
+    return (1);
+  }
+
+  o = graphGeomLoadChac ((Graph *) CONTEXTGETOBJECT (grafptr), (Geom *) geomptr, filegrfptr, filegeoptr, dataptr, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
@@ -99,5 +110,10 @@ FILE * const                        filegrfptr,
 FILE * const                        filegeoptr,
 const char * const                  dataptr)
 {
+  if ((((const Graph *) CONTEXTOBJECT (grafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphGeomSaveChac) ": compressed graphs not supported");
+    return (1);
+  }
+
   return (graphGeomSaveChac ((Graph *) CONTEXTOBJECT (grafptr), (Geom *) geomptr, filegrfptr, filegeoptr, dataptr));
 }
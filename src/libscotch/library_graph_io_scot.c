@@ -46,7 +46,7 @@
 /**                # Version 5.1  : from : 27 apr 2010     **/
 /**                                 to   : 27 apr 2010     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,7 +83,18 @@ FILE * const                  filegrfptr,
 FILE * const                  filegeoptr,
 const char * const            dataptr)
 {
-  return (graphGeomLoadScot ((Graph *) CONTEXTOBJECT (grafptr), (Geom *) geomptr, filegrfptr, filegeoptr, dataptr));
+  CONTEXTDECL        (grafptr);
+  int                 o;
+
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphGeomLoadScot) ": cannot initialize context");
+    return (1);
+  }
+
+  o = graphGeomLoadScot ((Graph *) CONTEXTGETOBJECT (grafptr), (Geom *) geomptr, filegrfptr, filegeoptr, dataptr, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
@@ -101,5 +112,10 @@ FILE * const                        filegrfptr,
 FILE * const                        filegeoptr,
 const char * const                  dataptr)
 {
+  if ((((const Graph *) CONTEXTOBJECT (grafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphGeomSaveScot) ": compressed graphs not supported");
+    return (1);
+  }
+
   return (graphGeomSaveScot ((Graph *) CONTEXTOBJECT (grafptr), (Geom *) geomptr, filegrfptr, filegeoptr, dataptr));
 }
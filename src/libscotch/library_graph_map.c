@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 08 feb 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,6 +69,7 @@
 #include "arch_dist.h"
 #include "mapping.h"
 #include "kgraph.h"
+#include "kgraph_delta.h"
 #include "kgraph_map_st.h"
 #include "library_mapping.h"
 #include "scotch.h"
@@ -164,6 +165,11 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
   const Gnum *        vmlotax;                    /* Vertex migration cost array          */
   int                 o;
 
+  if ((((const Graph *) CONTEXTOBJECT (actgrafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (graphMapCompute2) ": compressed graphs not supported");
+    return (1);
+  }
+
   o = 1;                                          /* Assume an error */
 
   if (CONTEXTINIT (actgrafptr)) {
@@ -389,6 +395,188 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
   return (graphMapCompute2 (grafptr, mappptr, mapoptr, emraval, vmlotab, vfixnbr, straptr));
 }
 
+/*+ This routine updates a remapping of the
+*** API mapping structure after local changes
+*** of the graph, by refining the old mapping
+*** in a band of given width around the given
+*** changed vertices, with respect to the given
+*** strategy.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphRemapDeltaCompute (
+SCOTCH_Graph * const        actgrafptr,           /*+ Graph to map                          +*/
+SCOTCH_Mapping * const      mappptr,              /*+ Mapping to compute                    +*/
+SCOTCH_Mapping * const      mapoptr,              /*+ Old mapping                           +*/
+const double                emraval,              /*+ Edge migration ratio                  +*/
+const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array           +*/
+const SCOTCH_Num            vdltnbr,              /*+ Number of changed vertices            +*/
+const SCOTCH_Num * const    vdlttab,              /*+ Array of changed vertices             +*/
+const SCOTCH_Num            distval,              /*+ Width of band around changed vertices +*/
+SCOTCH_Strat * const        straptr)              /*+ Band graph mapping strategy           +*/
+{
+  ArchDom             domnorg;                    /* Initial domain                       */
+  Kgraph              mapgrafdat;                 /* Effective mapping graph              */
+  const Strat *       mapstraptr;                 /* Pointer to mapping strategy          */
+  CONTEXTDECL        (actgrafptr);
+  Gnum                crloval;                    /* Coefficient load for regular edges   */
+  Gnum                cmloval;                    /* Coefficient load for migration edges */
+  Gnum                numeval;
+  Gnum                denoval;
+  byte *              flagtax;                    /* Flag array of changed vertices       */
+  Gnum                fronnbr;
+  Gnum                fronnum;
+  Anum                termnum;
+  Gnum                vertnnd;
+  Gnum                vertnum;
+  int                 o;
+
+  if ((((const Graph *) CONTEXTOBJECT (actgrafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": compressed graphs not supported");
+    return (1);
+  }
+
+  o = 1;                                          /* Assume an error */
+
+  if (CONTEXTINIT (actgrafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": cannot initialize context");
+    return (o);
+  }
+
+  const Graph * restrict const      grafptr = (Graph *) CONTEXTGETOBJECT (actgrafptr);
+  LibMapping * restrict const       lmapptr = (LibMapping *) mappptr;
+  const LibMapping * restrict const lmaoptr = (LibMapping *) mapoptr;
+  const Gnum                        baseval = grafptr->baseval;
+  const Genum * restrict const      verttax = grafptr->verttax;
+  const Genum * restrict const      vendtax = grafptr->vendtax;
+  const Gnum * restrict const       edgetax = grafptr->edgetax;
+  Anum * restrict const             termtax = lmapptr->parttab - baseval;
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if ((grafptr != lmapptr->grafptr) ||
+      (grafptr != lmaoptr->grafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": mappings do not correspond to input graph");
+    goto abort;
+  }
+  if (lmapptr->archptr != lmaoptr->archptr) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": output and old mappings do not correspond to same architecture");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+  if ((vdltnbr < 0) || (vdltnbr > grafptr->vertnbr) || (distval < 0)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": invalid parameters");
+    goto abort;
+  }
+  if (archVar (lmapptr->archptr)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": variable-sized architectures not supported");
+    goto abort;
+  }
+
+  archDomFrst (lmapptr->archptr, &domnorg);       /* Compute initial domain to map to */
+
+  if (*((Strat **) straptr) == NULL) {            /* Set default band graph strategy if necessary */
+    if (SCOTCH_stratGraphMap (straptr, "x{bal=0.01}f{bal=0.01,move=80}") != 0)
+      goto abort;
+  }
+
+  mapstraptr = *((Strat **) straptr);
+  if (mapstraptr->tablptr != &kgraphmapststratab) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": not a sequential graph mapping strategy");
+    goto abort;
+  }
+
+  numeval = (INT) ((emraval * 100.0) + 0.5);
+  denoval = intGcd (numeval, 100);
+  cmloval = numeval / denoval;
+  crloval = 100     / denoval;
+
+  if (kgraphInit (&mapgrafdat, grafptr, lmapptr->archptr, &domnorg, 0, NULL, crloval, cmloval,
+                  (vmlotab != NULL) ? vmlotab - baseval : NULL) != 0)
+    goto abort;
+
+  if ((mapAlloc (&mapgrafdat.r.m) != 0) ||        /* Allocate old and current mapping arrays */
+      (mapAlloc (&mapgrafdat.m)   != 0)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": out of memory");
+    goto abort2;
+  }
+
+  memSet (mapgrafdat.r.m.parttax + baseval, ~0, grafptr->vertnbr * sizeof (Anum)); /* Pre-set unknown vertex domains */
+  mapgrafdat.r.m.flagval |= MAPPINGINCOMPLETE;    /* Mapping may contain incomplete information                        */
+  if (mapBuild (&mapgrafdat.r.m, lmaoptr->parttab - baseval) != 0) { /* Merge old part information to incomplete mapping */
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": cannot initialize remapping");
+    goto abort2;
+  }
+
+  if (termtax != (lmaoptr->parttab - baseval))    /* Old mapping is the starting point of the new mapping */
+    memCpy (termtax + baseval, lmaoptr->parttab, grafptr->vertnbr * sizeof (Anum));
+
+  if ((flagtax = (byte *) memAlloc (grafptr->vertnbr * sizeof (byte))) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": out of memory");
+    goto abort2;
+  }
+  memSet (flagtax, 0, grafptr->vertnbr * sizeof (byte));
+  flagtax -= baseval;
+
+  vertnnd = grafptr->vertnnd;
+  for (fronnum = 0; fronnum < vdltnbr; fronnum ++) { /* Flag changed vertices, which will be the seeds of the band graph */
+    vertnum = vdlttab[fronnum];
+    if ((vertnum < baseval) || (vertnum >= vertnnd)) {
+      errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": invalid changed vertex array");
+      goto abort3;
+    }
+    flagtax[vertnum] = 1;
+  }
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+    Genum               edgenum;
+
+    if (termtax[vertnum] >= 0)                    /* Skip vertices that had a part */
+      continue;
+
+    flagtax[vertnum] = 1;                         /* New vertices are changed vertices too     */
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) { /* Put it with a neighbor */
+      if (termtax[edgetax[edgenum]] >= 0) {
+        termtax[vertnum] = termtax[edgetax[edgenum]];
+        break;
+      }
+    }
+  }
+  for (vertnum = baseval, termnum = 0; vertnum < vertnnd; vertnum ++) { /* Put remaining isolated new vertices with last known part */
+    if (termtax[vertnum] >= 0)
+      termnum = termtax[vertnum];
+    else
+      termtax[vertnum] = termnum;
+  }
+  if (mapBuild (&mapgrafdat.m, termtax) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": cannot initialize mapping");
+    goto abort3;
+  }
+
+  for (vertnum = baseval, fronnbr = 0; vertnum < vertnnd; vertnum ++) { /* Gather changed vertices once each, in ascending order */
+    if (flagtax[vertnum] != 0)
+      mapgrafdat.frontab[fronnbr ++] = vertnum;
+  }
+  mapgrafdat.fronnbr = fronnbr;
+  memFree (flagtax + baseval);
+  flagtax = NULL;
+
+  mapgrafdat.contptr = CONTEXTGETDATA (actgrafptr);
+
+  o = kgraphDelta (&mapgrafdat, distval, mapstraptr);
+  mapTerm (&mapgrafdat.m, termtax);               /* Propagate mapping result to part array */
+
+abort3:
+  if (flagtax != NULL)
+    memFree (flagtax + baseval);
+abort2:
+  kgraphExit (&mapgrafdat);
+abort:
+  CONTEXTEXIT (actgrafptr);
+  return (o);
+}
+
 /*+ This routine computes a mapping of the
 *** given graph structure onto the given
 *** target architecture with respect to the
@@ -619,6 +807,45 @@ SCOTCH_Num * const          parttab)              /*+ Partition array
   return (o);
 }
 
+/*+ This routine updates a repartitionning
+*** of the given graph structure after local
+*** changes of the graph, with respect to
+*** the given strategy.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphRepartDelta (
+SCOTCH_Graph * const        grafptr,              /*+ Graph to map                          +*/
+const SCOTCH_Num            partnbr,              /*+ Number of parts                       +*/
+SCOTCH_Num * const          parotab,              /*+ Old partition array                   +*/
+const double                emraval,              /*+ Edge migration ratio                  +*/
+const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array           +*/
+const SCOTCH_Num            vdltnbr,              /*+ Number of changed vertices            +*/
+const SCOTCH_Num * const    vdlttab,              /*+ Array of changed vertices             +*/
+const SCOTCH_Num            distval,              /*+ Width of band around changed vertices +*/
+SCOTCH_Strat * const        straptr,              /*+ Band graph mapping strategy           +*/
+SCOTCH_Num * const          parttab)              /*+ Partition array                       +*/
+{
+  SCOTCH_Arch         archdat;
+  SCOTCH_Mapping      mappdat;
+  SCOTCH_Mapping      mapodat;
+  int                 o;
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archCmplt (&archdat, partnbr);
+  SCOTCH_graphMapInit (grafptr, &mappdat, &archdat, parttab);
+  SCOTCH_graphMapInit (grafptr, &mapodat, &archdat, parotab);
+  o = SCOTCH_graphRemapDeltaCompute (grafptr, &mappdat, &mapodat, emraval, vmlotab, vdltnbr, vdlttab, distval, straptr);
+  SCOTCH_graphMapExit (grafptr, &mapodat);
+  SCOTCH_graphMapExit (grafptr, &mappdat);
+  SCOTCH_archExit  (&archdat);
+
+  return (o);
+}
+
 /*+ This routine parses the given
 *** mapping strategy.
 *** It returns:
@@ -672,8 +899,8 @@ const double                kbalval)              /*+ Desired imbalance ratio
   sprintf (mvrttab, GNUMSTRING, (Gnum) (MAX ((20 * partnbr), 10000)));
 
   strcpy (bufftab, ((flagval & SCOTCH_STRATRECURSIVE) != 0)
-          ? "<RECU>"                              /* Use only the recursive bipartitioning framework */
-          : "m{vert=<MVRT>,low=<RECU>,asc=b{bnd=<DIFK>f{bal=<KBAL>,move=<KMOV>},org=f{bal=<KBAL>,move=<KMOV>}}}<EXAX>");
+          ? "<RECU><VCON>"                        /* Use only the recursive bipartitioning framework */
+          : "m{vert=<MVRT>,low=<RECU>,asc=b{bnd=<DIFK>f{bal=<KBAL>,move=<KMOV>},org=f{bal=<KBAL>,move=<KMOV>}}<VCON>}<EXAX><VCON>");
   stringSubst (bufftab, "<RECU>", "r{job=t,map=t,poli=S,bal=<KBAL>,sep=<BSEP><EXAS>}");
   stringSubst (bufftab, "<BSEP>", ((flagval & SCOTCH_STRATQUALITY) != 0) ?  "<BSEQ>|<BSEQ>|<BSEQ>" :  "<BSEQ>|<BSEQ>");
   stringSubst (bufftab, "<BSEQ>", "m{vert=120,low=h{pass=10}f{bal=<BBAL>,move=120},asc=b{bnd=<DIFS>f{bal=<BBAL>,move=120},org=f{bal=<BBAL>,move=120}}}");
@@ -696,6 +923,7 @@ const double                kbalval)              /*+ Desired imbalance ratio
   stringSubst (bufftab, "<MVRT>", mvrttab);
   stringSubst (bufftab, "<EXAX>", exaxptr);
   stringSubst (bufftab, "<EXAS>", exasptr);
+  stringSubst (bufftab, "<VCON>", "v{bal=<KBAL>}"); /* Multi-constraint balancing; no-op for plain graphs */
   stringSubst (bufftab, "<DIFS>", difsptr);
   stringSubst (bufftab, "<DIFK>", difkptr);
   stringSubst (bufftab, "<KMOV>", kmovtab);
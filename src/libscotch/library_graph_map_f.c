@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 17 apr 2011     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -168,6 +168,27 @@ int * const                 revaptr),             \
 **
 */
 
+SCOTCH_FORTRAN (                                  \
+GRAPHREMAPDELTACOMPUTE, graphremapdeltacompute, ( \
+SCOTCH_Graph * const        grafptr,              \
+SCOTCH_Mapping * const      mappptr,              \
+SCOTCH_Mapping * const      mapoptr,              \
+const double * const        emraptr,              \
+const SCOTCH_Num * const    vmlotab,              \
+const SCOTCH_Num * const    vdltptr,              \
+const SCOTCH_Num * const    vdlttab,              \
+const SCOTCH_Num * const    distptr,              \
+SCOTCH_Strat * const        straptr,              \
+int * const                 revaptr),             \
+(grafptr, mappptr, mapoptr, emraptr, vmlotab, vdltptr, vdlttab, distptr, straptr, revaptr))
+{
+  *revaptr = SCOTCH_graphRemapDeltaCompute (grafptr, mappptr, mapoptr, *emraptr, vmlotab, *vdltptr, vdlttab, *distptr, straptr);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                      \
 GRAPHMAP, graphmap, (                 \
 SCOTCH_Graph * const        grafptr,  \
@@ -304,6 +325,28 @@ int * const                 revaptr), \
   *revaptr = SCOTCH_graphRepartFixed (grafptr, *partptr, parotab, *emraptr, vmlotab, straptr, parttab);
 }
 
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+GRAPHREPARTDELTA, graphrepartdelta, ( \
+SCOTCH_Graph * const        grafptr,  \
+const SCOTCH_Num * const    partptr,  \
+SCOTCH_Num * const          parotab,  \
+const double * const        emraptr,  \
+const SCOTCH_Num * const    vmlotab,  \
+const SCOTCH_Num * const    vdltptr,  \
+const SCOTCH_Num * const    vdlttab,  \
+const SCOTCH_Num * const    distptr,  \
+SCOTCH_Strat * const        straptr,  \
+SCOTCH_Num * const          parttab,  \
+int * const                 revaptr), \
+(grafptr, partptr, parotab, emraptr, vmlotab, vdltptr, vdlttab, distptr, straptr, parttab, revaptr))
+{
+  *revaptr = SCOTCH_graphRepartDelta (grafptr, *partptr, parotab, *emraptr, vmlotab, *vdltptr, vdlttab, *distptr, straptr, parttab);
+}
+
 /* String lengths are passed at the very
 ** end of the argument list.
 */
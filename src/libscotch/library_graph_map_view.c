@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2015,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2015,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 01 jul 2021     **/
 /**                                 to   : 01 jul 2021     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 30 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -105,8 +105,8 @@ const Anum                  partval)              /*+ Part value +*/
   Gnum                          diambase;         /* Base distance for connected components */
   Gnum                          diamdist;         /* Current diameter distance              */
   Gnum                          passnum;          /* Pass number                            */
-  const Gnum * restrict         verttax;          /* Based access to vertex array           */
-  const Gnum * restrict         vendtax;          /* Based access to vertex end array       */
+  const Genum * restrict         verttax;          /* Based access to vertex array           */
+  const Genum * restrict         vendtax;          /* Based access to vertex end array       */
   const Gnum * restrict         edgetax;
 
   if (memAllocGroup ((void **) (void *)
@@ -144,7 +144,7 @@ const Anum                  partval)              /*+ Part value +*/
 
       do {                                        /* Loop on vertices in queue */
         Gnum                vertnum;
-        Gnum                edgenum;
+        Genum               edgenum;
 
         vertnum  = graphMapViewQueueGet (&queudat); /* Get vertex from queue */
         vertdist = vexxtax[vertnum].vertdist;     /* Get vertex distance     */
@@ -220,6 +220,11 @@ FILE * const                  stream)             /*+ Output stream
   Anum                      nghbmin;
   Anum                      nghbmax;
   Anum                      nghbsum;
+  Gnum * restrict           vmrktab;              /* Flag array for parts of current vertex       */
+  Gnum                      volunbr;              /* Communication volume of current subdomain    */
+  Gnum                      volumin;
+  Gnum                      volumax;
+  Gnum                      volusum;
   Gnum                      vertnum;
   Gnum                      vertidx;
   Gnum                      veloval;
@@ -242,8 +247,8 @@ FILE * const                  stream)             /*+ Output stream
 
   const Graph * restrict const  grafptr = (Graph *) CONTEXTOBJECT (libgrafptr);
   LibMapping * restrict const   lmapptr = (LibMapping *) libmappptr;
-  const Gnum * restrict const   verttax = grafptr->verttax;
-  const Gnum * restrict const   vendtax = grafptr->vendtax;
+  const Genum * restrict const   verttax = grafptr->verttax;
+  const Genum * restrict const   vendtax = grafptr->vendtax;
   const Gnum * restrict const   velotax = grafptr->velotax;
   const Gnum * restrict const   edgetax = grafptr->edgetax;
   const Gnum * restrict const   edlotax = grafptr->edlotax;
@@ -254,6 +259,10 @@ FILE * const                  stream)             /*+ Output stream
     return (1);
   }
 #endif /* SCOTCH_DEBUG_LIBRARY1 */
+  if ((grafptr->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapView) ": compressed graphs not supported");
+    return (1);
+  }
 
 #ifdef SCOTCH_DEBUG_LIBRARY1
   if (lmapptr->grafptr != grafptr) {
@@ -291,7 +300,8 @@ FILE * const                  stream)             /*+ Output stream
 
   if (memAllocGroup ((void **) (void *)
                      &domntab, (size_t) ((grafptr->vertnbr + 1) * sizeof (MappingSort)),
-                     &nghbtab, (size_t) ((grafptr->vertnbr + 2) * sizeof (Anum)), NULL) == NULL) {
+                     &nghbtab, (size_t) ((grafptr->vertnbr + 2) * sizeof (Anum)),
+                     &vmrktab, (size_t) (grafptr->vertnbr       * sizeof (Gnum)), NULL) == NULL) {
     errorPrint (STRINGIFY (SCOTCH_graphMapView) ": out of memory");
     return (1);
   }
@@ -379,12 +389,17 @@ FILE * const                  stream)             /*+ Output stream
   nghbmax = 0;
   nghbsum = 0;
   nghbtab[0] = -2;
+  volunbr = 0;
+  volumax = 0;
+  volusum = 0;
+  memSet (vmrktab, ~0, grafptr->vertnbr * sizeof (Gnum));
   if (mapnbr > 0) {
     nghbmin = ANUMMAX;
+    volumin = GNUMMAX;
 
     for (vertidx = 0; domntab[vertidx].labl != ARCHDOMNOTTERM; vertidx ++) {
-      Gnum                edgenum;
-      Gnum                edgennd;
+      Genum               edgenum;
+      Genum               edgennd;
       Anum                partnum;
 
       partnum = parttax[domntab[vertidx].peri];
@@ -394,6 +409,12 @@ FILE * const                  stream)             /*+ Output stream
         Anum                partend;
 
         partend = parttax[edgetax[edgenum]];
+        if ((partend != partnum) &&               /* If end vertex belongs to a part not yet seen for this vertex */
+            (partend != ~0)      &&
+            (vmrktab[partend] != domntab[vertidx].peri)) {
+          vmrktab[partend] = domntab[vertidx].peri;
+          volunbr ++;                             /* Account for one more communication volume unit */
+        }
         if ((partend != partnum) &&               /* If edge is not internal                                      */
             (partend != nghbtab[nghbnbr])) {      /* And neighbor is not sole neighbor or has not just been found */
           Anum                partmin;
@@ -432,19 +453,31 @@ FILE * const                  stream)             /*+ Output stream
         if (nghbnbr > nghbmax)
           nghbmax = nghbnbr;
         nghbsum += nghbnbr;
+        if (volunbr < volumin)
+          volumin = volunbr;
+        if (volunbr > volumax)
+          volumax = volunbr;
+        volusum += volunbr;
 
         nghbnbr = 0;
+        volunbr = 0;
       }
     }
   }
-  else
+  else {
     nghbmin = 0;
+    volumin = 0;
+  }
 
   if (flagval == 0) {
     fprintf (stream, "M\tNeighbors min=" GNUMSTRING "\tmax=" GNUMSTRING "\tsum=" GNUMSTRING "\n",
              (Gnum) nghbmin,
              (Gnum) nghbmax,
              (Gnum) nghbsum);
+    fprintf (stream, "M\tCommVol min=" GNUMSTRING "\tmax=" GNUMSTRING "\tsum=" GNUMSTRING "\n",
+             (Gnum) volumin,
+             (Gnum) volumax,
+             (Gnum) volusum);
   }
 
   memSet (commdist, 0, 256 * sizeof (Gnum));      /* Initialize the data */
@@ -454,7 +487,7 @@ FILE * const                  stream)             /*+ Output stream
 
   edloval = 1;
   for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
-    Gnum                edgenum;
+    Genum               edgenum;
 
     if (parttax[vertnum] == ~0)                   /* Skip unmapped vertices */
       continue;
@@ -701,11 +734,16 @@ FILE * const                        stream)
   double                      comploadavg;
 
   const Graph * restrict const  grafptr = (Graph *) CONTEXTOBJECT (libgrafptr);
-  const Gnum * restrict const   verttax = grafptr->verttax;
+  const Genum * restrict const   verttax = grafptr->verttax;
   const Gnum * restrict const   velotax = grafptr->velotax;
-  const Gnum * restrict const   vendtax = grafptr->vendtax;
+  const Genum * restrict const   vendtax = grafptr->vendtax;
   const Gnum * restrict const   edgetax = grafptr->edgetax;
 
+  if ((grafptr->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartOvlView) ": compressed graphs not supported");
+    return (1);
+  }
+
   if (memAllocGroup ((void **) (void *)
                      &compload, (size_t) (partnbr * sizeof (Gnum)),
                      &compsize, (size_t) (partnbr * sizeof (Gnum)),
@@ -730,7 +768,7 @@ FILE * const                        stream)
     }
     else {                                  /* Vertex is in separator       */
       Gnum          listidx;                /* Index of first neighbor part */
-      Gnum          edgenum;
+      Genum         edgenum;
       Gnum          veloval;
 
       veloval = (velotax != NULL) ? velotax[vertnum] : 1;
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 08 jan 2012     **/
 /**                                 to   : 29 sep 2019     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 08 feb 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +66,7 @@
 #include "parser.h"
 #include "graph.h"
 #include "order.h"
+#include "order_fax.h"
 #include "hgraph.h"
 #include "hgraph_order_st.h"
 #include "library_order.h"
@@ -251,6 +252,11 @@ SCOTCH_Strat * const        straptr)              /*+ Ordering strategy
   OrderCblk *         cblkptr;
   int                 o;
 
+  if ((((const Graph *) CONTEXTOBJECT (libgrafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphOrderComputeList) ": compressed graphs not supported");
+    return (1);
+  }
+
   o = 1;                                          /* Assume an error */
 
   if (CONTEXTINIT (libgrafptr)) {
@@ -466,6 +472,50 @@ const SCOTCH_Ordering * const ordeptr)            /*+ Ordering to check +*/
   return (orderCheck (&((LibOrder *) ordeptr)->o));
 }
 
+/*+ This routine computes the elimination
+*** tree and the column counts of the factored
+*** matrix of the given graph with respect to
+*** the given ordering, as well as the number
+*** of non-zeros and the operation count of
+*** its Cholesky factorization. Arrays are
+*** indexed by permuted column index, and may
+*** be NULL. Independent subtrees of the column
+*** block tree are processed concurrently by
+*** the threads of the context, and results do
+*** not depend on the number of threads.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphOrderFactor (
+const SCOTCH_Graph * const    libgrafptr,
+const SCOTCH_Ordering * const ordeptr,            /*+ Ordering to factor                      +*/
+SCOTCH_Num * const            fathtab,            /*+ Elimination tree array, or NULL         +*/
+SCOTCH_Num * const            cntstab,            /*+ Column count array, or NULL             +*/
+double * const                nnzeptr,            /*+ Pointer to number of non-zeros, or NULL +*/
+double * const                opcoptr)            /*+ Pointer to operation count, or NULL     +*/
+{
+  CONTEXTDECL        (libgrafptr);
+  int                 o;
+
+  if (CONTEXTINIT (libgrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphOrderFactor) ": cannot initialize context");
+    return (1);
+  }
+
+  const Graph * restrict const  grafptr = CONTEXTGETOBJECT (libgrafptr);
+
+  o = orderFax (&((LibOrder *) ordeptr)->o, grafptr,
+                (fathtab != NULL) ? (((Gnum *) fathtab) - grafptr->baseval) : NULL,
+                (cntstab != NULL) ? (((Gnum *) cntstab) - grafptr->baseval) : NULL,
+                nnzeptr, opcoptr, CONTEXTGETDATA (libgrafptr));
+
+  CONTEXTEXIT (libgrafptr);
+  return (o);
+}
+
 /*+ This routine parses the given
 *** graph ordering strategy.
 *** It returns:
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 08 jan 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -301,6 +301,24 @@ int * const                   revaptr), \
 **
 */
 
+SCOTCH_FORTRAN (                        \
+GRAPHORDERFACTOR, graphorderfactor, (   \
+const SCOTCH_Graph * const    grafptr,  \
+const SCOTCH_Ordering * const ordeptr,  \
+SCOTCH_Num * const            fathtab,  \
+SCOTCH_Num * const            cntstab,  \
+double * const                nnzeptr,  \
+double * const                opcoptr,  \
+int * const                   revaptr), \
+(grafptr, ordeptr, fathtab, cntstab, nnzeptr, opcoptr, revaptr))
+{
+  *revaptr = SCOTCH_graphOrderFactor (grafptr, ordeptr, fathtab, cntstab, nnzeptr, opcoptr);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                     \
 STRATGRAPHORDER, stratgraphorder, (  \
 SCOTCH_Strat * const        straptr, \
@@ -0,0 +1,292 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_part_batch.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the batched  **/
+/**                partitioning of many independent small  **/
+/**                graphs of the libSCOTCH library.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Small graphs never reach the sizes at **/
+/**                  which the partitioning routines split **/
+/**                  their work across threads. Hence,     **/
+/**                  rather than running every job with    **/
+/**                  all of the threads of the context,    **/
+/**                  whole jobs are distributed across the **/
+/**                  threads, each of which computes its   **/
+/**                  jobs sequentially.                    **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_LIBRARY_GRAPH_PART_BATCH
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "parser.h"
+#include "graph.h"
+#include "scotch.h"
+#include "library_graph_part_batch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* batched graph partitioning.      */
+/*                                  */
+/************************************/
+
+/* This routine sorts an array of jobs by
+** decreasing number of edges of their graphs,
+** ties being broken by increasing job index.
+** Since edge numbers are of type Genum, which
+** may be wider than Gnum, sort keys are
+** compared explicitly.
+** It returns:
+** - void  : in all cases.
+*/
+
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 graphPartBatchSort
+#define INTSORTSIZE                 (sizeof (GraphPartBatchSort))
+#define INTSORTSWAP(p,q)            do {                                                             \
+                                      GraphPartBatchSort t;                                          \
+                                      t = *((GraphPartBatchSort *) (p));                             \
+                                      *((GraphPartBatchSort *) (p)) = *((GraphPartBatchSort *) (q)); \
+                                      *((GraphPartBatchSort *) (q)) = t;                             \
+                                    } while (0)
+#define INTSORTCMP(p,q)             ((((GraphPartBatchSort *) (p))->edgenbr > ((GraphPartBatchSort *) (q))->edgenbr) || \
+                                     ((((GraphPartBatchSort *) (p))->edgenbr == ((GraphPartBatchSort *) (q))->edgenbr) && \
+                                      (((GraphPartBatchSort *) (p))->jobnum < ((GraphPartBatchSort *) (q))->jobnum)))
+#include "common_sort.c"
+#undef INTSORTQUAL
+#undef INTSORTNAME
+#undef INTSORTSIZE
+#undef INTSORTSWAP
+#undef INTSORTCMP
+
+/* This routine computes the partition of
+** the graph of given index in the batch,
+** within the given single-thread context.
+** The job is given its own pseudo-random
+** generator, so that its result does not
+** depend on the thread which runs it.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphPartBatchJob (
+GraphPartBatchData * const  dataptr,
+const Gnum                  jobnum,
+Context * const             contptr)              /*+ Single-thread context of current thread +*/
+{
+  Context             contdat;                    /* Context of job, with its own generator */
+  IntRandContext      randdat;
+  ContextContainer    cocodat;                    /* Graph bound to job context             */
+
+  randdat = *dataptr->randptr;                    /* Clone generator of initial context */
+  if (dataptr->deteval != 0)                      /* If deterministic behavior wanted   */
+    intRandReset (&randdat);                      /* Start from scratch, as a new context would */
+  else {
+    intRandProc (&randdat, (int) jobnum);         /* Get a distinct stream for every job */
+    intRandSeed (&randdat, dataptr->seedval);
+  }
+
+  contdat         = *contptr;
+  contdat.randptr = &randdat;
+
+  cocodat.flagval = CONTEXTCONTAINERTYPE;         /* Bind job graph to job context */
+  cocodat.contptr = &contdat;
+  cocodat.dataptr = CONTEXTOBJECT (&dataptr->graftab[jobnum]);
+
+  return (SCOTCH_graphPart ((SCOTCH_Graph *) &cocodat, dataptr->partnbrtab[jobnum], dataptr->straptr,
+                            dataptr->parttab + dataptr->vertidxtab[jobnum]));
+}
+
+/* This routine is run by every thread of the
+** initial context, within its own single-thread
+** sub-context. Threads pick jobs one after the
+** other, biggest jobs first, until all jobs
+** have been processed or an error occurred.
+** It returns:
+** - void  : in all cases.
+*/
+
+#ifdef SCOTCH_PTHREAD
+static
+void
+graphPartBatchThread (
+Context * const             contptr,              /*+ Single-thread context of current thread +*/
+ThreadDescriptor * const    descptr,              /*+ Descriptor of initial context           +*/
+GraphPartBatchData * const  dataptr)
+{
+  while (1) {
+    Gnum                sortnum;
+    int                 o;
+
+    pthread_mutex_lock (&dataptr->lockdat);
+    sortnum = dataptr->jobnum ++;
+    pthread_mutex_unlock (&dataptr->lockdat);
+    if ((sortnum >= dataptr->jobnbr) || (dataptr->abrtval != 0)) /* Reading stale abort value only delays termination */
+      break;
+
+    o = graphPartBatchJob (dataptr, dataptr->sorttab[sortnum].jobnum, contptr);
+
+    if (o != 0) {
+      pthread_mutex_lock   (&dataptr->lockdat);
+      dataptr->abrtval = 1;
+      pthread_mutex_unlock (&dataptr->lockdat);
+    }
+  }
+}
+#endif /* SCOTCH_PTHREAD */
+
+/*+ This routine computes partitions of all
+*** the graphs of the given array, into the
+*** number of parts given for each of them,
+*** by distributing the jobs across the threads
+*** of the given context. All partitions are
+*** stored consecutively in parttab, in the
+*** order of the graphs. In deterministic mode,
+*** the partition of every graph is the same as
+*** the one computed by SCOTCH_graphPart() with
+*** a single-thread context whose pseudo-random
+*** generator is a reset clone of the one of
+*** the given context.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphPartBatch (
+SCOTCH_Context * const      libcontptr,           /*+ Context providing the threads     +*/
+const SCOTCH_Num            grafnbr,              /*+ Number of graphs                  +*/
+SCOTCH_Graph * const        graftab,              /*+ Array of graphs                   +*/
+const SCOTCH_Num * const    partnbrtab,           /*+ Number of parts of every graph    +*/
+SCOTCH_Strat * const        straptr,              /*+ Mapping strategy for all graphs   +*/
+SCOTCH_Num * const          parttab)              /*+ Concatenated partition arrays     +*/
+{
+  GraphPartBatchData  datadat;
+  Gnum                jobnum;
+  Gnum                vertidx;
+  int                 o;
+
+  Context * const     contptr = (Context *) libcontptr;
+
+  if (grafnbr < 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartBatch) ": invalid number of graphs");
+    return (1);
+  }
+  if (grafnbr == 0)                               /* Nothing to do */
+    return (0);
+
+  for (jobnum = 0; jobnum < grafnbr; jobnum ++) {
+    if (partnbrtab[jobnum] < 1) {
+      errorPrint (STRINGIFY (SCOTCH_graphPartBatch) ": invalid number of parts");
+      return (1);
+    }
+    if ((((const Graph *) CONTEXTOBJECT (&graftab[jobnum]))->flagval & GRAPHEDGECMPR) != 0) {
+      errorPrint (STRINGIFY (SCOTCH_graphPartBatch) ": compressed graphs not supported");
+      return (1);
+    }
+  }
+
+  if (contextCommit (contptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartBatch) ": cannot commit context");
+    return (1);
+  }
+
+  if (*((Strat **) straptr) == NULL) {            /* Set strategy once, as the first of sequential calls would */
+    if (SCOTCH_stratGraphMapBuild (straptr, SCOTCH_STRATDEFAULT, partnbrtab[0], 0.01) != 0)
+      return (1);
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.vertidxtab, (size_t) (grafnbr * sizeof (Gnum)),
+                     &datadat.sorttab,    (size_t) (grafnbr * sizeof (GraphPartBatchSort)), NULL) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartBatch) ": out of memory");
+    return (1);
+  }
+
+  for (jobnum = 0, vertidx = 0; jobnum < grafnbr; jobnum ++) {
+    const Graph * const grafptr = (Graph *) CONTEXTOBJECT (&graftab[jobnum]);
+
+    datadat.vertidxtab[jobnum]      = vertidx;
+    datadat.sorttab[jobnum].edgenbr = grafptr->edgenbr;
+    datadat.sorttab[jobnum].jobnum  = jobnum;
+    vertidx += grafptr->vertnbr;
+  }
+  graphPartBatchSort (datadat.sorttab, grafnbr);  /* Sort jobs by decreasing size */
+
+  datadat.graftab    = graftab;
+  datadat.partnbrtab = partnbrtab;
+  datadat.straptr    = straptr;
+  datadat.parttab    = parttab;
+  datadat.jobnbr     = grafnbr;
+  datadat.jobnum     = 0;
+  datadat.randptr    = contptr->randptr;
+  datadat.abrtval    = 0;
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMDETERMINISTIC, &datadat.deteval);
+  datadat.seedval    = (datadat.deteval != 0) ? 0 : (INT) intRandVal2 (contptr->randptr); /* Change streams at every call */
+
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_init (&datadat.lockdat, NULL);
+  if ((grafnbr > 1) &&                            /* If jobs can be distributed across threads */
+      (contextThreadLaunchSolo (contptr, (ContextSoloFunc) graphPartBatchThread, (void *) &datadat) == 0))
+    o = datadat.abrtval;
+  else
+#endif /* SCOTCH_PTHREAD */
+  {
+    for (jobnum = 0, o = 0; (jobnum < grafnbr) && (o == 0); jobnum ++) /* Run jobs in order, in current context */
+      o = graphPartBatchJob (&datadat, jobnum, contptr);
+  }
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_destroy (&datadat.lockdat);
+#endif /* SCOTCH_PTHREAD */
+
+  memFree (datadat.vertidxtab);                   /* Free group leader */
+
+  return (o);
+}
@@ -0,0 +1,90 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_part_batch.h              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the declarations for    **/
+/**                the batched graph partitioning          **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type definitions.
+*/
+
+/*+ Job sort structure, by decreasing
+    number of edges of job graphs.    +*/
+
+typedef struct GraphPartBatchSort_ {
+  Genum                     edgenbr;              /*+ Number of edges of job graph +*/
+  Gnum                      jobnum;               /*+ Index of job in batch        +*/
+} GraphPartBatchSort;
+
+/*+ The batch working data, shared
+    by all of the worker threads.  +*/
+
+typedef struct GraphPartBatchData_ {
+  SCOTCH_Graph *            graftab;              /*+ Array of graphs to partition             +*/
+  const SCOTCH_Num *        partnbrtab;           /*+ Array of numbers of parts                +*/
+  SCOTCH_Strat *            straptr;              /*+ Strategy shared by all jobs              +*/
+  SCOTCH_Num *              parttab;              /*+ Concatenated partition arrays            +*/
+  Gnum *                    vertidxtab;           /*+ Start index of each job in part array    +*/
+  GraphPartBatchSort *      sorttab;              /*+ Jobs by decreasing size                  +*/
+  Gnum                      jobnbr;               /*+ Number of jobs                           +*/
+  Gnum                      jobnum;               /*+ Index of next job to run in sort array   +*/
+  const IntRandContext *    randptr;              /*+ Generator of initial context             +*/
+  INT                       seedval;              /*+ Seed of non-deterministic generators     +*/
+  INT                       deteval;              /*+ Flag set if deterministic behavior       +*/
+  int                       abrtval;              /*+ Abort value                              +*/
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_t           lockdat;              /*+ Lock for job index and abort value       +*/
+#endif /* SCOTCH_PTHREAD */
+} GraphPartBatchData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_LIBRARY_GRAPH_PART_BATCH
+static void                 graphPartBatchSort  (void * const, const INT);
+static int                  graphPartBatchJob   (GraphPartBatchData * const, const Gnum, Context * const);
+#ifdef SCOTCH_PTHREAD
+static void                 graphPartBatchThread (Context * const, ThreadDescriptor * const, GraphPartBatchData * const);
+#endif /* SCOTCH_PTHREAD */
+#endif /* SCOTCH_LIBRARY_GRAPH_PART_BATCH */
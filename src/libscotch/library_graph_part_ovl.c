@@ -89,6 +89,11 @@ SCOTCH_Num * const          parttab)              /*+ Partition array       +*/
   CONTEXTDECL        (libgrafptr);
   int                 o;
 
+  if ((((const Graph *) CONTEXTOBJECT (libgrafptr))->flagval & GRAPHEDGECMPR) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartOvl) ": compressed graphs not supported");
+    return (1);
+  }
+
   o = 1;                                          /* Assume an error */
 
   if (CONTEXTINIT (libgrafptr)) {
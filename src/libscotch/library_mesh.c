@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 15 mar 2021     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 24 jan 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -188,12 +188,12 @@ const SCOTCH_Num            velmbas,              /* Base index for element vert
 const SCOTCH_Num            vnodbas,              /* Base index for node vertices         */
 const SCOTCH_Num            velmnbr,              /* Number of elements in mesh graph     */
 const SCOTCH_Num            vnodnbr,              /* Number of vertices in mesh graph     */
-const SCOTCH_Num * const    verttab,              /* Vertex array [vertnbr or vertnbr+1]  */
-const SCOTCH_Num * const    vendtab,              /* Vertex end array [vertnbr]           */
+const SCOTCH_Edge * const   verttab,              /* Vertex array [vertnbr or vertnbr+1]  */
+const SCOTCH_Edge * const   vendtab,              /* Vertex end array [vertnbr]           */
 const SCOTCH_Num * const    velotab,              /* Element vertex load array            */
 const SCOTCH_Num * const    vnlotab,              /* Node vertex load array               */
 const SCOTCH_Num * const    vlbltab,              /* Vertex label array                   */
-const SCOTCH_Num            edgenbr,              /* Number of edges (arcs)               */
+const SCOTCH_Edge           edgenbr,              /* Number of edges (arcs)               */
 const SCOTCH_Num * const    edgetab)              /* Edge array [edgenbr]                 */
 {
   Mesh *              srcmeshptr;                 /* Pointer to source mesh structure    */
@@ -228,12 +228,12 @@ const SCOTCH_Num * const    edgetab)              /* Edge array [edgenbr]
   srcmeshptr->vnodnbr = vnodnbr;
   srcmeshptr->vnodbas = vnodbas;
   srcmeshptr->vnodnnd = vnodbas + vnodnbr;
-  srcmeshptr->verttax = (Gnum *) verttab - srcmeshptr->baseval;
+  srcmeshptr->verttax = (Genum *) verttab - srcmeshptr->baseval;
   srcmeshptr->vendtax = ((vendtab == NULL) || (vendtab == verttab) || (vendtab == verttab + 1))
-                          ? srcmeshptr->verttax + 1 : (Gnum *) vendtab - srcmeshptr->baseval;
-  srcmeshptr->velotax = ((velotab == NULL) || (velotab == verttab)) ? NULL : (Gnum *) velotab - srcmeshptr->velmbas;
-  srcmeshptr->vnlotax = ((vnlotab == NULL) || (vnlotab == verttab)) ? NULL : (Gnum *) vnlotab - srcmeshptr->vnodbas;
-  srcmeshptr->vlbltax = ((vlbltab == NULL) || (vlbltab == verttab)) ? NULL : (Gnum *) vlbltab - srcmeshptr->baseval;
+                          ? srcmeshptr->verttax + 1 : (Genum *) vendtab - srcmeshptr->baseval;
+  srcmeshptr->velotax = ((velotab == NULL) || ((const void *) velotab == (const void *) verttab)) ? NULL : (Gnum *) velotab - srcmeshptr->velmbas;
+  srcmeshptr->vnlotax = ((vnlotab == NULL) || ((const void *) vnlotab == (const void *) verttab)) ? NULL : (Gnum *) vnlotab - srcmeshptr->vnodbas;
+  srcmeshptr->vlbltax = ((vlbltab == NULL) || ((const void *) vlbltab == (const void *) verttab)) ? NULL : (Gnum *) vlbltab - srcmeshptr->baseval;
   srcmeshptr->edgenbr = edgenbr;
   srcmeshptr->edgetax = (Gnum *) edgetab - srcmeshptr->baseval;
 
@@ -311,7 +311,7 @@ SCOTCH_meshSize (
 const SCOTCH_Mesh * const   meshptr,
 SCOTCH_Num * const          velmnbr,
 SCOTCH_Num * const          vnodnbr,
-SCOTCH_Num * const          edgenbr)
+SCOTCH_Edge * const         edgenbr)
 {
   const Mesh *        srcmeshptr;
 
@@ -322,7 +322,7 @@ SCOTCH_Num * const          edgenbr)
   if (vnodnbr != NULL)
     *vnodnbr = (SCOTCH_Num) srcmeshptr->vnodnbr;
   if (edgenbr != NULL)
-    *edgenbr = (SCOTCH_Num) srcmeshptr->edgenbr;
+    *edgenbr = (SCOTCH_Edge) srcmeshptr->edgenbr;
 }
 
 /*+ This routine accesses all of the mesh data.
@@ -340,12 +340,12 @@ SCOTCH_Num * const          velmbas,              /* Base index for elements   *
 SCOTCH_Num * const          vnodbas,              /* Base index for nodes      */
 SCOTCH_Num * const          velmnbr,              /* Number of elements        */
 SCOTCH_Num * const          vnodnbr,              /* Number of nodes           */
-SCOTCH_Num ** const         verttab,              /* Vertex array [vertnbr+1]  */
-SCOTCH_Num ** const         vendtab,              /* Vertex array [vertnbr]    */
+SCOTCH_Edge ** const        verttab,              /* Vertex array [vertnbr+1]  */
+SCOTCH_Edge ** const        vendtab,              /* Vertex array [vertnbr]    */
 SCOTCH_Num ** const         velotab,              /* Element vertex load array */
 SCOTCH_Num ** const         vnlotab,              /* Vertex load array         */
 SCOTCH_Num ** const         vlbltab,              /* Vertex label array        */
-SCOTCH_Num * const          edgenbr,              /* Number of edges (arcs)    */
+SCOTCH_Edge * const         edgenbr,              /* Number of edges (arcs)    */
 SCOTCH_Num ** const         edgetab,              /* Edge array [edgenbr]      */
 SCOTCH_Num * const          degrnbr)              /* Maximum degree            */
 {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 15 mar 2021     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 05 dec 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -190,12 +190,12 @@ const SCOTCH_Num * const    velmbas,          \
 const SCOTCH_Num * const    vnodbas,          \
 const SCOTCH_Num * const    velmnbr,          \
 const SCOTCH_Num * const    vnodnbr,          \
-const SCOTCH_Num * const    verttab,          \
-const SCOTCH_Num * const    vendtab,          \
+const SCOTCH_Edge * const   verttab,          \
+const SCOTCH_Edge * const   vendtab,          \
 const SCOTCH_Num * const    velotab,          \
 const SCOTCH_Num * const    vnlotab,          \
 const SCOTCH_Num * const    vlbltab,          \
-const SCOTCH_Num * const    edgenbr,          \
+const SCOTCH_Edge * const   edgenbr,          \
 const SCOTCH_Num * const    edgetab,          \
 int * const                 revaptr),         \
 (meshptr, velmbas, vnodbas, velmnbr, vnodnbr, \
@@ -229,7 +229,7 @@ MESHSIZE, meshsize, (                 \
 const SCOTCH_Mesh * const   meshptr,  \
 SCOTCH_Num * const          velmnbr,  \
 SCOTCH_Num * const          vnodnbr,  \
-SCOTCH_Num * const          edgenbr), \
+SCOTCH_Edge * const         edgenbr), \
 (meshptr, velmnbr, vnodnbr, edgenbr))
 {
   SCOTCH_meshSize (meshptr, velmnbr, vnodnbr, edgenbr);
@@ -252,15 +252,15 @@ SCOTCH_Idx * const          vendidx,                   \
 SCOTCH_Idx * const          veloidx,                   \
 SCOTCH_Idx * const          vnloidx,                   \
 SCOTCH_Idx * const          vlblidx,                   \
-SCOTCH_Num * const          edgenbr,                   \
+SCOTCH_Edge * const         edgenbr,                   \
 SCOTCH_Idx * const          edgeidx,                   \
 SCOTCH_Num * const          degrnbr),                  \
 (meshptr, indxptr, velmbas, vnodbas, velmnbr, vnodnbr, \
  vertidx, vendidx, veloidx, vnloidx, vlblidx,          \
  edgenbr, edgeidx, degrnbr))
 {
-  SCOTCH_Num *        verttab;                    /* Pointer to mesh arrays */
-  SCOTCH_Num *        vendtab;
+  SCOTCH_Edge *       verttab;                    /* Pointer to mesh arrays */
+  SCOTCH_Edge *       vendtab;
   SCOTCH_Num *        velotab;
   SCOTCH_Num *        vnlotab;
   SCOTCH_Num *        vlbltab;
@@ -269,8 +269,8 @@ SCOTCH_Num * const          degrnbr),                  \
   SCOTCH_meshData (meshptr, velmbas, vnodbas, velmnbr, vnodnbr,
                    &verttab, &vendtab, &velotab, &vnlotab, &vlbltab,
                    edgenbr, &edgetab, degrnbr);
-  *vertidx = (SCOTCH_Idx) (verttab - indxptr) + 1; /* Add 1 since Fortran indices start at 1 */
-  *vendidx = (SCOTCH_Idx) (vendtab - indxptr) + 1;
+  *vertidx = (SCOTCH_Idx) ((SCOTCH_Num *) verttab - indxptr) + 1; /* Add 1 since Fortran indices start at 1 */
+  *vendidx = (SCOTCH_Idx) ((SCOTCH_Num *) vendtab - indxptr) + 1;
   *veloidx = (velotab != NULL) ? (SCOTCH_Idx) (velotab - indxptr) + 1 : *vertidx;
   *vnloidx = (vnlotab != NULL) ? (SCOTCH_Idx) (vnlotab - indxptr) + 1 : *vertidx;
   *vlblidx = (vlbltab != NULL) ? (SCOTCH_Idx) (vlbltab - indxptr) + 1 : *vertidx;
@@ -0,0 +1,190 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_mesh_part.c                     **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the mesh     **/
+/**                partitioning routines of the libSCOTCH  **/
+/**                library.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mesh.h"
+#include "kmesh.h"
+#include "kmesh_part_st.h"
+#include "scotch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* mesh partitioning.               */
+/*                                  */
+/************************************/
+
+/*+ This routine computes a partition of
+*** the elements of the given mesh structure
+*** with respect to the given strategy, so
+*** as to minimize the sum over all nodes of
+*** their load times the number of parts
+*** spanned by their elements, minus one.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_meshPart (
+SCOTCH_Mesh * const         libmeshptr,           /*+ Mesh to partition     +*/
+const SCOTCH_Num            partnbr,              /*+ Number of parts       +*/
+SCOTCH_Strat * const        straptr,              /*+ Partitioning strategy +*/
+SCOTCH_Num * const          parttab)              /*+ Element part array    +*/
+{
+  Kmesh               meshdat;
+  const Strat *       partstraptr;
+  CONTEXTDECL        (libmeshptr);
+  int                 o;
+
+  o = 1;                                          /* Assume an error */
+
+  if (partnbr < 1) {
+    errorPrint (STRINGIFY (SCOTCH_meshPart) ": invalid number of parts");
+    return     (o);
+  }
+
+  if (CONTEXTINIT (libmeshptr)) {
+    errorPrint (STRINGIFY (SCOTCH_meshPart) ": cannot initialize context");
+    return     (o);
+  }
+
+#ifdef SCOTCH_DEBUG_MESH2
+  if (meshCheck ((Mesh *) CONTEXTGETOBJECT (libmeshptr)) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_meshPart) ": invalid input mesh");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_MESH2 */
+
+  if (*((Strat **) straptr) == NULL) {            /* Set default partitioning strategy if necessary */
+    if (SCOTCH_stratMeshPartBuild (straptr, SCOTCH_STRATQUALITY, partnbr, (double) 0.05))
+      goto abort;
+  }
+
+  partstraptr = *((Strat **) straptr);
+  if (partstraptr->tablptr != &kmeshpartststratab) {
+    errorPrint (STRINGIFY (SCOTCH_meshPart) ": not a mesh partitioning strategy");
+    goto abort;
+  }
+
+  kmeshInit (&meshdat, (Mesh *) CONTEXTGETOBJECT (libmeshptr), (Anum) partnbr); /* Initialize active mesh from given mesh */
+  meshdat.parttax = ((Anum *) parttab) - meshdat.m.velmbas; /* Directly use given part array                            */
+  meshdat.contptr = CONTEXTGETDATA (libmeshptr);
+
+  if (kmeshAlloc (&meshdat) != 0) {               /* Always allocate mesh data when calling */
+    errorPrint (STRINGIFY (SCOTCH_meshPart) ": out of memory");
+    goto abort;
+  }
+  kmeshZero (&meshdat);                           /* Start from a valid partition */
+
+  o = kmeshPartSt (&meshdat, partstraptr);
+
+  kmeshExit (&meshdat);
+
+abort:
+  CONTEXTEXIT (libmeshptr);
+  return (o);
+}
+
+/*+ This routine parses the given
+*** mesh partitioning strategy.
+*** It returns:
+*** - 0   : if string successfully scanned.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_stratMeshPart (
+SCOTCH_Strat * const        straptr,
+const char * const          string)
+{
+  if (*((Strat **) straptr) != NULL)
+    stratExit (*((Strat **) straptr));
+
+  if ((*((Strat **) straptr) = stratInit (&kmeshpartststratab, string)) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_stratMeshPart) ": error in mesh partitioning strategy");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*+ This routine provides predefined
+*** mesh partitioning strategies.
+*** It returns:
+*** - 0   : if string successfully initialized.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_stratMeshPartBuild (
+SCOTCH_Strat * const        straptr,              /*+ Strategy to create       +*/
+const SCOTCH_Num            flagval,              /*+ Desired characteristics  +*/
+const SCOTCH_Num            partnbr,              /*+ Number of expected parts +*/
+const double                balrat)               /*+ Desired imbalance ratio  +*/
+{
+  char                bufftab[8192];              /* Should be enough */
+  char                kbaltab[64];
+
+  sprintf (kbaltab, "%lf", balrat);
+
+  if ((flagval & SCOTCH_STRATSPEED) != 0)
+    strcpy (bufftab, "m{vert=20,rat=0.8,low=g{pass=2}f{bal=<KBAL>,move=20,pass=4},asc=f{bal=<KBAL>,move=20,pass=4}}");
+  else
+    strcpy (bufftab, "m{vert=20,rat=0.8,low=g{pass=10}f{bal=<KBAL>,move=200},asc=f{bal=<KBAL>,move=200}}");
+  stringSubst (bufftab, "<KBAL>", kbaltab);
+
+  return (SCOTCH_stratMeshPart (straptr, bufftab));
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -66,7 +66,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 19 jul 2021     **/
-/**                                 to   : 17 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # While Anum and Gnum are different     **/
 /**                  types, because architectures are      **/
@@ -98,6 +98,33 @@
 #define MAPPINGFREEDOMN             0x0002        /* Free domain array    */
 #define MAPPINGFREEPART             0x0004        /* Free partition array */
 
+/*+ Distance cache flags. +*/
+
+#define MAPPINGDISTNONE             0x0000        /* No options set             */
+#define MAPPINGDISTSHARED           0x0001        /* Cache read by many threads */
+
+/*+ Distance cache architecture types, for
+    specialized distance computations.     +*/
+
+#define MAPPINGDISTTYPEGEN          0             /* Generic architecture             */
+#define MAPPINGDISTTYPECMPLT        1             /* Complete graph: inlined distance */
+#define MAPPINGDISTTYPETLEAF        2             /* Tree-leaf: direct distance call  */
+#define MAPPINGDISTTYPEMESH2        3             /* 2D mesh: inlined distance        */
+
+/*+ Maximum number of domains for which
+    distances are cached in a dense matrix. +*/
+
+#define MAPPINGDISTDENSEMAX         2048
+
+/*+ Minimum and maximum numbers of slots of
+    the distance hash table; must be powers
+    of two. No hash table is created when
+    fewer requests than the minimum number
+    of slots are expected.                   +*/
+
+#define MAPPINGDISTHASHMIN          256
+#define MAPPINGDISTHASHMAX          65536
+
 /*
 **  The type definitions.
 */
@@ -127,6 +154,37 @@ typedef struct MappingHash_ {
   Anum                      domnnum;              /*+ Domain number          +*/
 } MappingHash;
 
+/*+ The distance hash table slot structure. +*/
+
+typedef struct MappingDistHash_ {
+  Anum                      domnnum0;             /*+ First domain number, or -1 if slot empty +*/
+  Anum                      domnnum1;             /*+ Second domain number                     +*/
+  Anum                      distval;              /*+ Distance between the two domains         +*/
+} MappingDistHash;
+
+/*+ This structure caches the distances between
+    the domains of a mapping, indexed by domain
+    number. When the number of domains is small
+    enough, distances are stored in a dense
+    matrix; else, they are stored in a fixed-size
+    hash table, colliding entries being replaced.
+    Distances in complete graph architectures
+    are not cached but computed inline.          +*/
+
+typedef struct MappingDist_ {
+  const Arch *              archptr;              /*+ Architecture data                            +*/
+  const ArchDom *           domntab;              /*+ Array of domains of the mapping              +*/
+  Anum                      domnnbr;              /*+ Number of domains when the cache was created +*/
+  int                       typeval;              /*+ Architecture type for specialized paths      +*/
+  Anum *                    disttab;              /*+ Dense distance matrix, -1 if not computed    +*/
+  MappingDistHash *         hashtab;              /*+ Distance hash table                          +*/
+  Gnum                      hashmsk;              /*+ Hash table mask                              +*/
+#ifdef SCOTCH_MAP_DIST_STAT
+  Gnum                      callnbr;              /*+ Number of distance requests                  +*/
+  Gnum                      compnbr;              /*+ Number of actual distance computations       +*/
+#endif /* SCOTCH_MAP_DIST_STAT */
+} MappingDist;
+
 /*+ The target architecture sort structure, used
     to sort vertices by increasing label value.  +*/
 
@@ -155,8 +213,30 @@ int                         mapLoad             (Mapping * restrict const, const
 int                         mapSave             (const Mapping * restrict const, FILE * restrict const);
 int                         mapView             (const Mapping * restrict const, const Graph * restrict const, FILE * const);
 
+void                        mapDistInit         (MappingDist * restrict const, const Mapping * restrict const, const Gnum, const int);
+void                        mapDistExit         (MappingDist * const);
+Anum                        mapDistGet2         (MappingDist * restrict const, const Anum, const Anum);
+
 /*
 **  The macro definitions.
 */
 
 #define mapDomain(map,idx)          (&((map)->domntab[(map)->parttax[(idx)]]))
+
+/*+ When the type argument of mapDistGetType()
+    is a constant, the macro folds into the
+    distance computation of this type, which
+    is how specialized kernels are built.    +*/
+
+#ifdef SCOTCH_MAP_DIST_STAT
+#define mapDistGetType(dist,type,dom0,dom1) mapDistGet2 ((dist), (dom0), (dom1))
+#else /* SCOTCH_MAP_DIST_STAT */
+#define mapDistGetType(dist,type,dom0,dom1) (((type) == MAPPINGDISTTYPECMPLT)                                                   \
+                                             ? archCmpltDomDist2 (&(dist)->domntab[dom0].data.cmplt, &(dist)->domntab[dom1].data.cmplt) \
+                                             : (((type) == MAPPINGDISTTYPEMESH2)                                                 \
+                                                ? archMesh2DomDist2 (&(dist)->domntab[dom0].data.meshx, &(dist)->domntab[dom1].data.meshx) \
+                                                : ((((dist)->disttab != NULL) && ((dist)->disttab[(dom0) * (dist)->domnnbr + (dom1)] >= 0)) \
+                                                   ? (dist)->disttab[(dom0) * (dist)->domnnbr + (dom1)]                            \
+                                                   : mapDistGet2 ((dist), (dom0), (dom1)))))
+#endif /* SCOTCH_MAP_DIST_STAT */
+#define mapDistGet(dist,dom0,dom1)  mapDistGetType ((dist), (dist)->typeval, (dom0), (dom1))
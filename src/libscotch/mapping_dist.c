@@ -0,0 +1,252 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : mapping_dist.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the caching of the  **/
+/**                distances between the domains of a      **/
+/**                mapping, so as to avoid repeated calls  **/
+/**                to the distance routines of target      **/
+/**                architectures.                          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "arch_cmplt.h"
+#include "arch_mesh.h"
+#include "arch_tleaf.h"
+#include "mapping.h"
+
+/*********************************************/
+/*                                           */
+/* These routines handle distance caches.    */
+/*                                           */
+/*********************************************/
+
+/* This routine initializes a distance cache
+** for the current domains of the given mapping.
+** The expected number of distance requests is
+** used to select the kind of cache: a dense
+** matrix is only used when its initialization
+** is cheaper than the requests it will serve.
+** When the cache is to be read concurrently by
+** several threads, the dense matrix is filled
+** beforehand, and no hash table is used, so that
+** the cache is never updated afterwards. Since
+** caching is only an optimization, the cache
+** silently degrades to direct distance
+** computations when memory is lacking.
+** For complete graph and 2D mesh architectures,
+** no cache is created at all, as distances are
+** cheaper to compute inline than to look up; for
+** tree-leaf architectures, cache misses call
+** the distance routine directly rather than
+** through the architecture class.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+mapDistInit (
+MappingDist * restrict const    distptr,
+const Mapping * restrict const  mappptr,
+const Gnum                      callnbr,          /*+ Expected number of distance requests +*/
+const int                       flagval)
+{
+  Gnum                domnnbr;
+  Gnum                hashsiz;
+
+  domnnbr = (Gnum) mappptr->domnnbr;
+
+  distptr->archptr = mappptr->archptr;
+  distptr->domntab = mappptr->domntab;
+  distptr->domnnbr = mappptr->domnnbr;
+  distptr->typeval = MAPPINGDISTTYPEGEN;
+  distptr->disttab = NULL;
+  distptr->hashtab = NULL;
+  distptr->hashmsk = 0;
+#ifdef SCOTCH_MAP_DIST_STAT
+  distptr->callnbr = 0;
+  distptr->compnbr = 0;
+#endif /* SCOTCH_MAP_DIST_STAT */
+
+  if (archDomDistIs (mappptr->archptr, Cmplt)) {  /* If distance computation can be inlined */
+    distptr->typeval = MAPPINGDISTTYPECMPLT;
+    return;
+  }
+  if (archDomDistIs (mappptr->archptr, Mesh2)) {
+    distptr->typeval = MAPPINGDISTTYPEMESH2;
+    return;
+  }
+  if (archDomDistIs (mappptr->archptr, Tleaf))    /* Also catches labeled tree-leaf architectures */
+    distptr->typeval = MAPPINGDISTTYPETLEAF;
+
+  if ((flagval & MAPPINGDISTSHARED) != 0) {       /* If cache has to be filled beforehand */
+    if ((domnnbr <= MAPPINGDISTDENSEMAX) &&       /* Fill it only if it is worth it       */
+        ((domnnbr * domnnbr) <= callnbr) &&
+        ((distptr->disttab = memAlloc (domnnbr * domnnbr * sizeof (Anum))) != NULL)) {
+      Anum                domnnum;
+
+      for (domnnum = 0; domnnum < domnnbr; domnnum ++) {
+        Anum                domntmp;
+
+        distptr->disttab[domnnum * (domnnbr + 1)] = 0;
+        for (domntmp = domnnum + 1; domntmp < domnnbr; domntmp ++)
+          distptr->disttab[domnnum * domnnbr + domntmp] =
+          distptr->disttab[domntmp * domnnbr + domnnum] = archDomDist (mappptr->archptr, &mappptr->domntab[domnnum], &mappptr->domntab[domntmp]);
+      }
+#ifdef SCOTCH_MAP_DIST_STAT
+      distptr->compnbr = domnnbr * (domnnbr - 1) / 2;
+#endif /* SCOTCH_MAP_DIST_STAT */
+    }
+    return;
+  }
+
+  if ((domnnbr <= MAPPINGDISTDENSEMAX) &&         /* If dense matrix is worth it */
+      ((domnnbr * domnnbr) <= callnbr)) {
+    if ((distptr->disttab = memAlloc (domnnbr * domnnbr * sizeof (Anum))) != NULL) {
+      memSet (distptr->disttab, ~0, domnnbr * domnnbr * sizeof (Anum)); /* No distance computed yet */
+      return;
+    }
+  }
+
+  for (hashsiz = MAPPINGDISTHASHMIN; (hashsiz < MAPPINGDISTHASHMAX) && ((hashsiz * 4) < callnbr); hashsiz <<= 1) ; /* Get upper power of two, bounded */
+  if ((domnnbr > 1) && (callnbr >= MAPPINGDISTHASHMIN) && /* If hash table may be useful */
+      ((distptr->hashtab = memAlloc (hashsiz * sizeof (MappingDistHash))) != NULL)) {
+    memSet (distptr->hashtab, ~0, hashsiz * sizeof (MappingDistHash)); /* All slots are empty */
+    distptr->hashmsk = hashsiz - 1;
+  }
+}
+
+/* This routine frees the contents
+** of the given distance cache.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+mapDistExit (
+MappingDist * const         distptr)
+{
+#ifdef SCOTCH_MAP_DIST_STAT
+  if (distptr->callnbr > 0)
+    errorPrintW ("mapDistExit: %ld distance computations saved out of %ld requests (%ld domains)",
+                 (long) (distptr->callnbr - distptr->compnbr), (long) distptr->callnbr, (long) distptr->domnnbr);
+#endif /* SCOTCH_MAP_DIST_STAT */
+
+  if (distptr->disttab != NULL)
+    memFree (distptr->disttab);
+  if (distptr->hashtab != NULL)
+    memFree (distptr->hashtab);
+#ifdef SCOTCH_DEBUG_MAP2
+  distptr->disttab = NULL;
+  distptr->hashtab = NULL;
+#endif /* SCOTCH_DEBUG_MAP2 */
+}
+
+/* This routine returns the distance between
+** the two given domains of the mapping, and
+** records it in the cache when the cache is
+** not shared. It is called by the mapDistGet()
+** macro when the distance is not readily
+** available in the dense matrix.
+** It returns:
+** - the distance : in all cases.
+*/
+
+Anum
+mapDistGet2 (
+MappingDist * restrict const  distptr,
+const Anum                    domnnum0,
+const Anum                    domnnum1)
+{
+  MappingDistHash * restrict  hashptr;
+  Anum                        distval;
+
+#ifdef SCOTCH_DEBUG_MAP2
+  if ((domnnum0 < 0) || (domnnum0 >= distptr->domnnbr) ||
+      (domnnum1 < 0) || (domnnum1 >= distptr->domnnbr)) {
+    errorPrint ("mapDistGet2: invalid domain number");
+    return (0);
+  }
+#endif /* SCOTCH_DEBUG_MAP2 */
+  if (distptr->typeval == MAPPINGDISTTYPECMPLT)  /* No cache for complete graphs */
+    return (archCmpltDomDist2 (&distptr->domntab[domnnum0].data.cmplt, &distptr->domntab[domnnum1].data.cmplt));
+  if (distptr->typeval == MAPPINGDISTTYPEMESH2)  /* No cache for 2D meshes either */
+    return (archMesh2DomDist2 (&distptr->domntab[domnnum0].data.meshx, &distptr->domntab[domnnum1].data.meshx));
+
+#ifdef SCOTCH_MAP_DIST_STAT
+  distptr->callnbr ++;                            /* Not accurate when cache is shared */
+#endif /* SCOTCH_MAP_DIST_STAT */
+
+  if (distptr->disttab != NULL) {
+    distval = distptr->disttab[domnnum0 * distptr->domnnbr + domnnum1];
+    if (distval >= 0)                             /* If distance already known */
+      return (distval);
+  }
+  else if (distptr->hashtab != NULL) {
+    hashptr = &distptr->hashtab[(((Gnum) domnnum0 * (Gnum) distptr->domnnbr + (Gnum) domnnum1) * MAPPINGHASHPRIME) & distptr->hashmsk];
+    if ((hashptr->domnnum0 == domnnum0) &&        /* If distance already known */
+        (hashptr->domnnum1 == domnnum1))
+      return (hashptr->distval);
+  }
+
+#ifdef SCOTCH_MAP_DIST_STAT
+  distptr->compnbr ++;
+#endif /* SCOTCH_MAP_DIST_STAT */
+  distval = (distptr->typeval == MAPPINGDISTTYPETLEAF)
+            ? archTleafDomDist (&distptr->archptr->data.tleaf, &distptr->domntab[domnnum0].data.tleaf, &distptr->domntab[domnnum1].data.tleaf)
+            : archDomDist (distptr->archptr, &distptr->domntab[domnnum0], &distptr->domntab[domnnum1]);
+
+  if (distptr->disttab != NULL)                   /* Only lazily filled matrices can reach here */
+    distptr->disttab[domnnum0 * distptr->domnnbr + domnnum1] = distval;
+  else if (distptr->hashtab != NULL) {            /* Replace colliding entry, if any */
+    hashptr->domnnum0 = domnnum0;
+    hashptr->domnnum1 = domnnum1;
+    hashptr->distval  = distval;
+  }
+
+  return (distval);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 4.0  : from : 29 dec 2001     **/
 /**                                 to   : 05 may 2004     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -152,7 +152,7 @@ const Gnum                  baseval)
   Gnum                baseold;                    /* Old base value  */
   Gnum                baseadj;                    /* Base adjustment */
   Gnum                vertnum;
-  Gnum                edgenum;
+  Genum               edgenum;
 
   if (meshptr->baseval == baseval)                /* If nothing to do */
     return (baseval);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2019,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2019,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 30 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -114,15 +114,15 @@ typedef struct Mesh_ {
   Gnum                      vnodnbr;              /*+ Number of node vertices in mesh          +*/
   Gnum                      vnodbas;              /*+ Based number of first node               +*/
   Gnum                      vnodnnd;              /*+ Based number of first non-node vertex    +*/
-  Gnum *                    verttax;              /*+ Vertex array [based]                     +*/
-  Gnum *                    vendtax;              /*+ End vertex array [based]                 +*/
+  Genum *                   verttax;              /*+ Vertex array [based]                     +*/
+  Genum *                   vendtax;              /*+ End vertex array [based]                 +*/
   Gnum *                    velotax;              /*+ Element vertex load array (if present)   +*/
   Gnum *                    vnlotax;              /*+ Node vertex load array (if present)      +*/
   Gnum                      velosum;              /*+ Sum of element vertex weights            +*/
   Gnum                      vnlosum;              /*+ Sum of node vertex weights               +*/
   Gnum *                    vnumtax;              /*+ Vertex number in ancestor graph          +*/
   Gnum *                    vlbltax;              /*+ Vertex label (from file)                 +*/
-  Gnum                      edgenbr;              /*+ Number of edges (arcs) in graph          +*/
+  Genum                     edgenbr;              /*+ Number of edges (arcs) in graph          +*/
   Gnum *                    edgetax;              /*+ Edge array [based]                       +*/
   Gnum                      degrmax;              /*+ Maximum degree                           +*/
 } Mesh;
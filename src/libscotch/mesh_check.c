@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 6.0  : from : 24 jan 2020     **/
 /**                                 to   : 24 jan 2020     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -95,7 +95,7 @@ const Mesh * const          meshptr)
   veisnbr = 0;
   for (vertnum = meshptr->velmbas; vertnum < meshptr->velmnnd; vertnum ++) { /* For all element vertices */
     Gnum                degrval;
-    Gnum                edgenum;
+    Genum               edgenum;
 
     if ((meshptr->verttax[vertnum] < meshptr->baseval) ||
         (meshptr->vendtax[vertnum] < meshptr->verttax[vertnum])) {
@@ -148,7 +148,7 @@ const Mesh * const          meshptr)
   }
 
   for (vertnum = meshptr->vnodbas; vertnum < meshptr->vnodnnd; vertnum ++) { /* For all node vertices */
-    Gnum                edgenum;
+    Genum               edgenum;
 
     if ((meshptr->verttax[vertnum] < meshptr->baseval)          ||
         (meshptr->vendtax[vertnum] < meshptr->verttax[vertnum])) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2019,2020,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2019,2020,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 23 jan 2020     **/
 /**                                 to   : 23 jan 2020     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 30 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The coarsening process is as follows. **/
 /**                  First, node collapsing is performed,  **/
@@ -105,11 +105,11 @@ Context * restrict const      contptr)            /*+ Execution context
   Gnum                        coarhashmsk;        /* Mask for access to hash table               */
   MeshCoarsenHngb * restrict  coarhngbtab;        /* Table of edges to other multinodes          */
   MeshCoarsenHbdg * restrict  coarhbdgtab;        /* Table of bridge nodes to other multinodes   */
-  Gnum * restrict             coarverttax;        /* Pointer to coarse vertex array              */
+  Genum * restrict            coarverttax;        /* Pointer to coarse vertex array              */
   Gnum * restrict             coarvelotax;        /* Pointer to coarse vertex load array         */
   Gnum * restrict             coaredgetax;        /* Pointer to coarse edge array                */
-  Gnum                        coaredgenbr;        /* (Upper bound of) number of edges in mesh    */
-  Gnum                        coaredgenum;        /* Number of current coarse edge               */
+  Genum                       coaredgenbr;        /* (Upper bound of) number of edges in mesh    */
+  Genum                       coaredgenum;        /* Number of current coarse edge               */
   Gnum                        coarvertnbr;        /* Number of vertices in coarse mesh           */
   Gnum                        coarvelmnbr;        /* Number of coarse element vertices           */
   Gnum                        coarvnodnbr;        /* Number of coarse node vertices              */
@@ -121,7 +121,7 @@ Context * restrict const      contptr)            /*+ Execution context
   Gnum                        coarvnodnum;
   Gnum                        coardegrmax;
   MeshCoarsenMult * restrict  finemulttax;
-  Gnum                        coaredgetmp;
+  Genum                       coaredgetmp;
   size_t                      coarvelooftval;
   size_t                      coaredgeoftval;
 
@@ -149,7 +149,7 @@ Context * restrict const      contptr)            /*+ Execution context
   coarhashsiz = coarhashmsk + 1;
 
   if (memAllocGroup ((void **) (void *)
-        &coarverttax, (size_t) ((finevertnbr + 1)     * sizeof (Gnum)), /* Upper bound on number of coarse vertices */
+        &coarverttax, (size_t) ((finevertnbr + 1)     * sizeof (Genum)), /* Upper bound on number of coarse vertices */
         &coarvelotax, (size_t) ( finevertnbr          * sizeof (Gnum)), /* Upper bound on number of coarse vertices */
         &coaredgetax, (size_t) ( finemeshptr->edgenbr * sizeof (Gnum)),
         &coarhngbtab, (size_t) ( coarhashsiz          * sizeof (MeshCoarsenHngb)),
@@ -172,7 +172,7 @@ Context * restrict const      contptr)            /*+ Execution context
   coarvertnbr = coarvelmnbr + coarvnodnbr;
 
   memOffset ((void *) coarverttax,
-             &coarverttax, (size_t) ((coarvertnbr + 1) * sizeof (Gnum)),
+             &coarverttax, (size_t) ((coarvertnbr + 1) * sizeof (Genum)),
              &coarvelotax, (size_t) ( coarvertnbr      * sizeof (Gnum)),
              &coaredgetax, (size_t) ( coaredgenbr      * sizeof (Gnum)), NULL); /* Hast tables and finemulttax stay in place */
   coarverttax -= coarmeshptr->baseval;
@@ -326,17 +326,18 @@ Context * restrict const      contptr)            /*+ Execution context
   }
   memMov (&coarverttax[coarmeshptr->vnodbas + 1], /* Re-build start indices for node edge sub-arrays */
           &coarverttax[coarmeshptr->vnodbas],
-          coarmeshptr->vnodnbr * sizeof (Gnum));
+          coarmeshptr->vnodnbr * sizeof (Genum));
   coarverttax[coarmeshptr->vnodbas] = coaredgenum;
 
-  coarvelooftval = coarvelotax - coarverttax;
-  coaredgeoftval = coaredgetax - coarverttax;
-  coarverttax = memRealloc (coarverttax + coarmeshptr->baseval, (coaredgeoftval + coarmeshptr->edgenbr) * sizeof (Gnum)); /* Re-allocate array to save space */
+  coarverttax   += coarmeshptr->baseval;          /* Un-base arrays to compute byte offsets, since integer widths may differ */
+  coarvelooftval = (byte *) (coarvelotax + coarmeshptr->baseval) - (byte *) coarverttax;
+  coaredgeoftval = (byte *) (coaredgetax + coarmeshptr->baseval) - (byte *) coarverttax;
+  coarverttax = memRealloc (coarverttax, coaredgeoftval + coarmeshptr->edgenbr * sizeof (Gnum)); /* Re-allocate array to save space */
   coarmeshptr->verttax = coarverttax - coarmeshptr->baseval;
   coarmeshptr->vendtax = coarmeshptr->verttax + 1;
-  coarmeshptr->velotax = coarmeshptr->verttax + coarvelooftval;
+  coarmeshptr->velotax = (Gnum *) ((byte *) coarverttax + coarvelooftval) - coarmeshptr->baseval;
   coarmeshptr->vnlotax = coarmeshptr->velotax;    /* Same array for both vertex load sub-arrays */
-  coarmeshptr->edgetax = coarmeshptr->verttax + coaredgeoftval;
+  coarmeshptr->edgetax = (Gnum *) ((byte *) coarverttax + coaredgeoftval) - coarmeshptr->baseval;
 
 #ifdef SCOTCH_DEBUG_MESH2
   if (meshCheck (coarmeshptr) != 0) {             /* Check mesh consistency */
@@ -379,7 +380,7 @@ MeshCoarsenMult * restrict const  finemulttax,    /* Array of fine multielements
 Gnum * restrict const             finecoartax,    /* Fine to coarse vertex array                                */
 Gnum * restrict const             coarvelmptr,    /* Pointer to number of coarse element vertices               */
 Gnum * restrict const             coarvnodptr,    /* Pointer to (upper bound on) number of coarse node vertices */
-Gnum * restrict const             coaredgeptr,    /* Pointer to (upper bound on) number of edges                */
+Genum * restrict const            coaredgeptr,    /* Pointer to (upper bound on) number of edges                */
 Context * restrict const          contptr)
 {
   Gnum                          coarvelmnum;      /* Number of current coarse element vertex */
@@ -389,7 +390,7 @@ Context * restrict const          contptr)
   Gnum                          finehashsiz;
   Gnum                          finehashmsk;
   Gnum                          coarvnodnbr;
-  Gnum                          coaredgenbr;
+  Genum                         coaredgenbr;
 
   for (finehashmsk = 31, finehashsiz = finemeshptr->degrmax * finemeshptr->degrmax - 1; /* Compute size of hash table */
        finehashmsk < finehashsiz; finehashmsk = finehashmsk * 2 + 1) ;
@@ -428,7 +429,6 @@ Context * restrict const          contptr)
           finecoartax[finevelmnum] = coarvelmnum;
           finemulttax[coarvelmnum].finevelmnum[0] =
           finemulttax[coarvelmnum].finevelmnum[1] = finevelmnum;
-fprintf (stderr, "++ %ld %ld\n", (long) finevelmnum, (long) finemeshptr->velotax[finevelmnum]); /* TODO REMOVE */
           coarvelmnum ++;                         /* One more single vertex created */
         }
         continue;
@@ -606,7 +606,7 @@ fprintf (stderr, "++ %ld %ld\n", (long) finevelmnum, (long) finemeshptr->velotax
 
   memFree (finehashtab);
 
-  *coarvelmptr = coarvelmnum - finemeshptr->velmbas;
+  *coarvelmptr = coarvelmnum - finemeshptr->baseval; /* Coarse elements are numbered from baseval */
   *coarvnodptr = coarvnodnbr;
   *coaredgeptr = coaredgenbr;
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,7 +81,7 @@ typedef struct MeshCoarsenMult_ {
 
 /*+ The prototype of the mesh matching routine. +*/
 
-typedef void (* MeshCoarsenFunc) (const Mesh * const, MeshCoarsenMult * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Context * const);
+typedef void (* MeshCoarsenFunc) (const Mesh * const, MeshCoarsenMult * const, Gnum * const, Gnum * const, Gnum * const, Genum * const, Context * const);
 
 /*+ A table made of such cells is used during
     coarsening to build the edge array of the
@@ -119,7 +119,7 @@ typedef struct MeshCoarsenNgHash_ {
 */
 
 #ifdef SCOTCH_MESH_COARSEN
-static void                 meshCoarsenMatchNg  (const Mesh * restrict const, MeshCoarsenMult * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Context * restrict const);
+static void                 meshCoarsenMatchNg  (const Mesh * restrict const, MeshCoarsenMult * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Genum * restrict const, Context * restrict const);
 #endif /* SCOTCH_MESH_COARSEN */
 
 int                         meshCoarsen         (const Mesh * restrict const, Mesh * restrict const, Gnum * restrict * const, const Gnum, const double, const MeshCoarsenType, Context * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2016,2018,2020,2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2016,2018,2020,2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 20 nov 2020     **/
 /**                                 to   : 07 jun 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 30 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # From a given mesh is created a graph, **/
 /**                  such that all vertices of the graph   **/
@@ -98,9 +98,9 @@ Graph * restrict const        grafptr)            /*+ Graph to build +*/
   Gnum                      hashsiz;              /* Size of hash table                     */
   Gnum                      hashmsk;              /* Mask for access to hash table          */
   MeshGraphHash * restrict  hashtab;              /* Table of edges to other node vertices  */
-  Gnum                      edgemax;              /* Upper bound of number of edges in mesh */
-  Gnum                      edgennd;              /* Based upper bound on number of edges   */
-  Gnum                      edgenum;              /* Number of current graph edge           */
+  Genum                     edgemax;              /* Upper bound of number of edges in mesh */
+  Genum                     edgennd;              /* Based upper bound on number of edges   */
+  Genum                     edgenum;              /* Number of current graph edge           */
   Gnum                      vertnum;              /* Number of current graph vertex         */
   Gnum                      degrmax;
 
@@ -113,7 +113,7 @@ Graph * restrict const        grafptr)            /*+ Graph to build +*/
        hashsiz < hashnbr; hashsiz <<= 1) ;
   hashmsk = hashsiz - 1;
 
-  if (((grafptr->verttax = memAlloc ((meshptr->vnodnbr + 1) * sizeof (Gnum)))          == NULL) ||
+  if (((grafptr->verttax = memAlloc ((meshptr->vnodnbr + 1) * sizeof (Genum)))          == NULL) ||
       ((hashtab          = memAlloc (hashsiz                * sizeof (MeshGraphHash))) == NULL)) {
     errorPrint ("meshGraphNodal: out of memory (1)");
     if (grafptr->verttax != NULL)
@@ -174,7 +174,7 @@ Graph * restrict const        grafptr)            /*+ Graph to build +*/
         for (hnodend = (vnodend * MESHGRAPHHASHPRIME) & hashmsk; ; hnodend = (hnodend + 1) & hashmsk) {
           if (hashtab[hnodend].vertnum != vnodnum) { /* If edge not yet created */
             if (edgenum == edgennd) {             /* If edge array already full */
-              Gnum                edgemax;
+              Genum               edgemax;
               Gnum * restrict     edgetmp;
 
               edgemax = edgennd - grafptr->baseval; /* Increase size by 25 % */
@@ -210,6 +210,8 @@ Graph * restrict const        grafptr)            /*+ Graph to build +*/
   grafptr->edlosum =
   grafptr->edgenbr = edgenum - grafptr->baseval;
   grafptr->degrmax = degrmax;
+  grafptr->vconnbr = 0;
+  grafptr->vcontax = NULL;
 
   memFree (hashtab);
 
@@ -243,9 +245,9 @@ const Gnum                  noconbr)              /*+ number of common points to
   Gnum                          hashsiz;          /* Size of hash table                     */
   Gnum                          hashmsk;          /* Mask for access to hash table          */
   MeshGraphDualHash * restrict  hashtab;          /* Table of edges to other node vertices  */
-  Gnum                          edgemax;          /* Upper bound of number of edges in mesh */
-  Gnum                          edgennd;          /* Based upper bound on number of edges   */
-  Gnum                          edgenum;          /* Number of current graph edge           */
+  Genum                         edgemax;          /* Upper bound of number of edges in mesh */
+  Genum                         edgennd;          /* Based upper bound on number of edges   */
+  Genum                         edgenum;          /* Number of current graph edge           */
   Gnum                          vertnum;          /* Number of current graph vertex         */
   Gnum                          degrmax;
 
@@ -258,7 +260,7 @@ const Gnum                  noconbr)              /*+ number of common points to
        hashsiz < hashnbr; hashsiz <<= 1) ;
   hashmsk = hashsiz - 1;
 
-  if (((grafptr->verttax = memAlloc ((meshptr->velmnbr + 1) * sizeof (Gnum)))              == NULL) ||
+  if (((grafptr->verttax = memAlloc ((meshptr->velmnbr + 1) * sizeof (Genum)))              == NULL) ||
       ((hashtab          = memAlloc (hashsiz                * sizeof (MeshGraphDualHash))) == NULL)) {
     errorPrint ("meshGraphDual: out of memory (1)");
     if (grafptr->verttax != NULL)
@@ -328,7 +330,7 @@ const Gnum                  noconbr)              /*+ number of common points to
               hashtab[helmend].nghbnbr = -- nghbnbr; /* One more instance of neighbor element met */
 test:         if (nghbnbr <= 0) {                 /* If new instance allows us to reach threshold */
                 if (edgenum == edgennd) {         /* If edge array already full                   */
-                  Gnum                edgemax;
+                  Genum               edgemax;
                   Gnum * restrict     edgetmp;
 
                   edgemax = edgennd - grafptr->baseval; /* Increase size by 25 % */
@@ -361,6 +363,8 @@ test:         if (nghbnbr <= 0) {                 /* If new instance allows us t
   grafptr->edlosum =
   grafptr->edgenbr = edgenum - grafptr->baseval;
   grafptr->degrmax = degrmax;
+  grafptr->vconnbr = 0;
+  grafptr->vcontax = NULL;
 
   memFree (hashtab);
 
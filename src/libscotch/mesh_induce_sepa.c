@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 5.0  : from : 12 sep 2007     **/
 /**                                 to   : 03 apr 2008     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This routine differs from the         **/
 /**                  standard mesh induction routine by    **/
@@ -128,8 +128,8 @@ Mesh * restrict const             indmeshptr)     /* Pointer to induced submesh
   Gnum                          indvnlosum;       /* Sum of node vertex load array                              */
   Gnum                          indvelmnum;       /* Number of current element vertex in induced mesh           */
   Gnum * restrict               indedgetax;       /* Based array to edge array of induced mesh                  */
-  Gnum                          indedgenum;       /* Number of current edge to be created in induced mesh       */
-  Gnum                          indedgenbr;       /* (Approximate) number of edges in induced mesh graph        */
+  Genum                         indedgenum;       /* Number of current edge to be created in induced mesh       */
+  Genum                         indedgenbr;       /* (Approximate) number of edges in induced mesh graph        */
   Gnum * restrict               orgindxtax;       /* Original to induced vertex number translation              */
   MeshInduceSepaHash * restrict hashtab;          /* Node hash array                                            */
   Gnum                          hashmsk;          /* Mask for hash array                                        */
@@ -179,16 +179,16 @@ Mesh * restrict const             indmeshptr)     /* Pointer to induced submesh
   indvertnbr = indvelmnbr + orgsepanbr;           /* Upper bound on number of all vertices */
   if (orgmeshptr->velotax != NULL) {
     p = memAllocGroup ((void **) (void *)
-          &indmeshptr->verttax, (size_t) (indvertnbr * sizeof (Gnum)), /* verttab is not compact */
-          &indmeshptr->vendtax, (size_t) (indvertnbr * sizeof (Gnum)),
+          &indmeshptr->verttax, (size_t) (indvertnbr * sizeof (Genum)), /* verttab is not compact */
+          &indmeshptr->vendtax, (size_t) (indvertnbr * sizeof (Genum)),
           &indmeshptr->vnumtax, (size_t) (orgsepanbr * sizeof (Gnum)), /* vnumtab is of size indnodenbr                */
           &indmeshptr->velotax, (size_t) (orgsepanbr * sizeof (Gnum)), NULL); /* Element vertices assumed not weighted */
     indmeshptr->velotax -= indmeshptr->vnodbas;
   }
   else
     p = memAllocGroup ((void **) (void *)
-          &indmeshptr->verttax, (size_t) (indvertnbr * sizeof (Gnum)),
-          &indmeshptr->vendtax, (size_t) (indvertnbr * sizeof (Gnum)),
+          &indmeshptr->verttax, (size_t) (indvertnbr * sizeof (Genum)),
+          &indmeshptr->vendtax, (size_t) (indvertnbr * sizeof (Genum)),
           &indmeshptr->vnumtax, (size_t) (orgsepanbr * sizeof (Gnum)), NULL); /* vnumtab is of size indnodenbr */
   orgvertnbr = orgmeshptr->velmnbr + orgmeshptr->vnodnbr;
   if (p != 0) {
@@ -245,7 +245,7 @@ Mesh * restrict const             indmeshptr)     /* Pointer to induced submesh
       if (orgindxtax[orgvelmnum] == -2)           /* If discarded element       */
         continue;                                 /* Skip to next element       */
       if (orgindxtax[orgvelmnum] == ~0) {         /* If element not yet created */
-        Gnum                indedgetmp;           /* Save value for edge index  */
+        Genum               indedgetmp;           /* Save value for edge index  */
         Gnum                orgeelmnum;
         Gnum                indenodtmp;
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 5.1  : from : 11 aug 2010     **/
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,8 +81,8 @@ Mesh * restrict const       meshptr,              /* Mesh structure to fill
 FILE * restrict const       stream,               /* Stream from which to read graph data */
 const Gnum                  baseval)              /* Base value (-1 means keep file base) */
 {
-  Gnum                edgenum;                    /* Number of edges really allocated */
-  Gnum                edgennd;
+  Genum               edgenum;                    /* Number of edges really allocated */
+  Genum               edgennd;
   Gnum                vertnbr;
   Gnum                velmnbr;                    /* Number of elements in mesh       */
   Gnum                velmbas;                    /* Base index for element vertices  */
@@ -115,7 +115,7 @@ const Gnum                  baseval)              /* Base value (-1 means keep f
 
   if ((intLoad (stream, &velmnbr)          != 1) || /* Read rest of header */
       (intLoad (stream, &vnodnbr)          != 1) ||
-      (intLoad (stream, &meshptr->edgenbr) != 1) ||
+      (intLoadEdge (stream, &meshptr->edgenbr) != 1) ||
       (intLoad (stream, &velmbas)          != 1) ||
       (intLoad (stream, &vnodbas)          != 1) ||
       (intLoad (stream, &propval)          != 1) ||
@@ -157,7 +157,7 @@ const Gnum                  baseval)              /* Base value (-1 means keep f
   vlblnbr = (proptab[0] != 0) ? vertnbr : 0;
 
   if (memAllocGroup ((void **) (void *)
-      &meshptr->verttax, (size_t) ((vertnbr + 1)     * sizeof (Gnum)),
+      &meshptr->verttax, (size_t) ((vertnbr + 1)     * sizeof (Genum)),
       &meshptr->vlbltax, (size_t) ( vlblnbr          * sizeof (Gnum)),
       &meshptr->velotax, (size_t) ( velonbr          * sizeof (Gnum)), /* Allocate single array for both element and node vertices */
       &meshptr->edgetax, (size_t) ( meshptr->edgenbr * sizeof (Gnum)), NULL) == NULL) { /* Edge array grouped with vertex arrays   */
@@ -335,10 +335,10 @@ FILE * restrict const       stream)
   propstr[2] = ((meshptr->velotax != NULL) || (meshptr->vnlotax != NULL)) ? '1' : '0';
   propstr[3] = '\0';
 
-  if (fprintf (stream, "1\n" GNUMSTRING "\t" GNUMSTRING "\t" GNUMSTRING "\n" GNUMSTRING "\t" GNUMSTRING "\t%3s\n", /* Write file header */
+  if (fprintf (stream, "1\n" GNUMSTRING "\t" GNUMSTRING "\t" GENUMSTRING "\n" GNUMSTRING "\t" GNUMSTRING "\t%3s\n", /* Write file header */
                (Gnum) meshptr->velmnbr,
                (Gnum) meshptr->vnodnbr,
-               (Gnum) meshptr->edgenbr,
+               (Genum) meshptr->edgenbr,
                (Gnum) meshptr->velmbas,
                (Gnum) meshptr->vnodbas,
                propstr) == EOF) {
@@ -377,7 +377,7 @@ FILE * restrict const       stream)
     edgeadj = edgeadjtab[i];
 
     for (vertnum = vertbas, o = 0; (vertnum < vertnnd) && (o == 0); vertnum ++) {
-      Gnum                edgenum;
+      Genum               edgenum;
 
       if (meshptr->vlbltax != NULL)               /* Write vertex label if necessary */
         o  = (fprintf (stream, GNUMSTRING "\t", (Gnum) meshptr->vlbltax[vertnum]) == EOF);
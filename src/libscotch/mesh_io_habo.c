@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 15 may 2018     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -86,7 +86,7 @@ const char * const          dataptr)              /* No use           */
   Gnum              habvarnbr;                    /* Number of variables, that is, nodes       */
   Gnum              velmnum;                      /* Number of current element vertex          */
   Gnum              vnodnum;                      /* Number of current node vertex             */
-  Gnum              edgenum;                      /* Number of current edge (arc)              */
+  Genum             edgenum;                      /* Number of current edge (arc)              */
   Gnum              edgesum;                      /* Accumulated number of edges in node part  */
   Gnum              degrmax;                      /* Maximum degree                            */
   int               c;
@@ -161,7 +161,7 @@ const char * const          dataptr)              /* No use           */
     return     (1);
   }
 
-  if (((meshptr->verttax = (Gnum *) memAlloc ((habeltnbr + habvarnbr + 1) * sizeof (Gnum))) == NULL) ||
+  if (((meshptr->verttax = (Genum *) memAlloc ((habeltnbr + habvarnbr + 1) * sizeof (Genum))) == NULL) ||
       ((meshptr->edgetax = (Gnum *) memAlloc (habvixnbr * 2               * sizeof (Gnum))) == NULL)) {
     errorPrint ("meshGeomLoadHabo: out of memory (1)");
     if (meshptr->verttax != NULL) {
@@ -215,7 +215,7 @@ const char * const          dataptr)              /* No use           */
     return     (1);
   }
 
-  memSet (meshptr->verttax + 1, 0, habvarnbr * sizeof (Gnum)); /* Pre-set node adjacency array */
+  memSet (meshptr->verttax + 1, 0, habvarnbr * sizeof (Genum)); /* Pre-set node adjacency array */
 
   for (edgenum = habvixnbr + 1; edgenum <= meshptr->edgenbr; edgenum ++) { /* Read VARIND as second part of edge array */
     Gnum              habnodval;                  /* Current non-zero value                                              */
@@ -286,7 +286,7 @@ const char * const          dataptr)              /* No use           */
   meshptr->degrmax = degrmax;
 
   for (vnodnum = edgesum = 1; vnodnum < meshptr->vnodnnd; vnodnum ++) { /* Restore start indices for node part of vertex array */
-    Gnum                edgenum;
+    Genum               edgenum;
 
     edgenum = meshptr->verttax[vnodnum];
     meshptr->verttax[vnodnum] = edgesum;
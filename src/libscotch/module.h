@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 24 aug 2020     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 19 feb 2018     **/
-/**                                 to   : 08 feb 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -137,6 +137,7 @@
 #define SCOTCH_DEBUG_FIBO3
 #define SCOTCH_DEBUG_GAIN3
 #define SCOTCH_DEBUG_KGRAPH3
+#define SCOTCH_DEBUG_KMESH3
 #define SCOTCH_DEBUG_PARSER3
 #define SCOTCH_DEBUG_VGRAPH3
 #define SCOTCH_DEBUG_VMESH3
@@ -168,6 +169,7 @@
 #define SCOTCH_DEBUG_KDGRAPH2
 #define SCOTCH_DEBUG_KDMAP2
 #define SCOTCH_DEBUG_KGRAPH2
+#define SCOTCH_DEBUG_KMESH2
 #define SCOTCH_DEBUG_LIBRARY2
 #define SCOTCH_DEBUG_MAP2
 #define SCOTCH_DEBUG_MESH2
@@ -199,6 +201,7 @@
 #define SCOTCH_DEBUG_KDGRAPH1
 #define SCOTCH_DEBUG_KDMAP1
 #define SCOTCH_DEBUG_KGRAPH1
+#define SCOTCH_DEBUG_KMESH1
 #define SCOTCH_DEBUG_LIBRARY1
 #define SCOTCH_DEBUG_MAP1
 #define SCOTCH_DEBUG_MESH1
@@ -261,6 +264,9 @@
 #define SCOTCH_VERSION              SCOTCH_NAME_PUBLIC (SCOTCH_VERSION)
 #define SCOTCH_RELEASE              SCOTCH_NAME_PUBLIC (SCOTCH_RELEASE)
 #define SCOTCH_PATCHLEVEL           SCOTCH_NAME_PUBLIC (SCOTCH_PATCHLEVEL)
+#define SCOTCH_COLORNONE            SCOTCH_NAME_PUBLIC (SCOTCH_COLORNONE)
+#define SCOTCH_COLORGREEDY          SCOTCH_NAME_PUBLIC (SCOTCH_COLORGREEDY)
+#define SCOTCH_COLORDIST2           SCOTCH_NAME_PUBLIC (SCOTCH_COLORDIST2)
 #define SCOTCH_COARSENNONE          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENNONE)
 #define SCOTCH_COARSENFOLD          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLD)
 #define SCOTCH_COARSENFOLDDUP       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLDDUP)
@@ -281,6 +287,8 @@
 #define SCOTCH_STRATLEAFSIMPLE      SCOTCH_NAME_PUBLIC (SCOTCH_STRATLEAFSIMPLE)
 #define SCOTCH_STRATSEPASIMPLE      SCOTCH_NAME_PUBLIC (SCOTCH_STRATSEPASIMPLE)
 #define SCOTCH_STRATDISCONNECTED    SCOTCH_NAME_PUBLIC (SCOTCH_STRATDISCONNECTED)
+#define SCOTCH_STREAMFENNEL         SCOTCH_NAME_PUBLIC (SCOTCH_STREAMFENNEL)
+#define SCOTCH_STREAMLDG            SCOTCH_NAME_PUBLIC (SCOTCH_STREAMLDG)
 
 #define SCOTCH_Arch                 SCOTCH_NAME_PUBLIC (SCOTCH_Arch)
 #define SCOTCH_ArchDom              SCOTCH_NAME_PUBLIC (SCOTCH_ArchDom)
@@ -311,6 +319,7 @@
 
 #define commonStubDummy             SCOTCH_NAME_INTERN (commonStubDummy)
 
+#define contextArena                SCOTCH_NAME_INTERN (contextArena)
 #define contextCommit               SCOTCH_NAME_INTERN (contextCommit)
 #define contextExit                 SCOTCH_NAME_INTERN (contextExit)
 #define contextInit                 SCOTCH_NAME_INTERN (contextInit)
@@ -319,6 +328,7 @@
 #define contextThreadInit           SCOTCH_NAME_INTERN (contextThreadInit)
 #define contextThreadInit2          SCOTCH_NAME_INTERN (contextThreadInit2)
 #define contextThreadLaunchSplit    SCOTCH_NAME_INTERN (contextThreadLaunchSplit)
+#define contextThreadLaunchSolo     SCOTCH_NAME_INTERN (contextThreadLaunchSolo)
 
 #define contextValuesGetDbl         SCOTCH_NAME_INTERN (contextValuesGetDbl)
 #define contextValuesGetInt         SCOTCH_NAME_INTERN (contextValuesGetInt)
@@ -341,7 +351,13 @@
 #define fileNameDistExpand          SCOTCH_NAME_INTERN (fileNameDistExpand)
 
 #define intLoad                     SCOTCH_NAME_INTERN (intLoad)
+#ifdef EDGESIZE64
+#define intLoadEdge                 SCOTCH_NAME_INTERN (intLoadEdge)
+#endif /* EDGESIZE64 */
 #define intSave                     SCOTCH_NAME_INTERN (intSave)
+#ifdef EDGESIZE64
+#define intSaveEdge                 SCOTCH_NAME_INTERN (intSaveEdge)
+#endif /* EDGESIZE64 */
 #define intAscn                     SCOTCH_NAME_INTERN (intAscn)
 #define intGcd                      SCOTCH_NAME_INTERN (intGcd)
 #define intPerm                     SCOTCH_NAME_INTERN (intPerm)
@@ -365,6 +381,13 @@
 
 #define memAllocGroup               SCOTCH_NAME_INTERN (memAllocGroup)
 #define memAllocRecord              SCOTCH_NAME_INTERN (memAllocRecord)
+#define memArenaAlloc               SCOTCH_NAME_INTERN (memArenaAlloc)
+#define memArenaAllocGroup          SCOTCH_NAME_INTERN (memArenaAllocGroup)
+#define memArenaExit                SCOTCH_NAME_INTERN (memArenaExit)
+#define memArenaInit                SCOTCH_NAME_INTERN (memArenaInit)
+#define memArenaRealloc             SCOTCH_NAME_INTERN (memArenaRealloc)
+#define memArenaRelease             SCOTCH_NAME_INTERN (memArenaRelease)
+#define memArenaTrim                SCOTCH_NAME_INTERN (memArenaTrim)
 #define memCheck                    SCOTCH_NAME_INTERN (memCheck)
 #define memCheckExists              SCOTCH_NAME_INTERN (memCheckExists)
 #define memCheckSize                SCOTCH_NAME_INTERN (memCheckSize)
@@ -729,6 +752,7 @@
 #define bgraphBipartGg              SCOTCH_NAME_INTERN (bgraphBipartGg)
 #define bgraphBipartGp              SCOTCH_NAME_INTERN (bgraphBipartGp)
 #define bgraphBipartMl              SCOTCH_NAME_INTERN (bgraphBipartMl)
+#define bgraphBipartPf              SCOTCH_NAME_INTERN (bgraphBipartPf)
 #define bgraphBipartSt              SCOTCH_NAME_INTERN (bgraphBipartSt)
 #define bgraphBipartZr              SCOTCH_NAME_INTERN (bgraphBipartZr)
 #define bgraphStoreInit             SCOTCH_NAME_INTERN (bgraphStoreInit)
@@ -839,11 +863,14 @@
 /* #define fiboHeapMin              SCOTCH_NAME_INTERN (fiboHeapMin) Already a macro */
 
 #define gainTablAddLin              SCOTCH_NAME_INTERN (gainTablAddLin)
+#define gainTablAddLinArry          SCOTCH_NAME_INTERN (gainTablAddLinArry)
 #define gainTablAddLog              SCOTCH_NAME_INTERN (gainTablAddLog)
+#define gainTablAddLogArry          SCOTCH_NAME_INTERN (gainTablAddLogArry)
 #define gainTablCheck               SCOTCH_NAME_INTERN (gainTablCheck)
 #ifdef SCOTCH_DEBUG_GAIN1                         /* If not already redefined as accelerated macro */
 #define gainTablDel                 SCOTCH_NAME_INTERN (gainTablDel)
 #endif /* SCOTCH_DEBUG_GAIN1 */
+#define gainTablDelArry             SCOTCH_NAME_INTERN (gainTablDelArry)
 #define gainTablExit                SCOTCH_NAME_INTERN (gainTablExit)
 #define gainTablFree                SCOTCH_NAME_INTERN (gainTablFree)
 #define gainTablFrst                SCOTCH_NAME_INTERN (gainTablFrst)
@@ -857,31 +884,58 @@
 #define graphInit                   SCOTCH_NAME_INTERN (graphInit)
 #define graphExit                   SCOTCH_NAME_INTERN (graphExit)
 #define graphFree                   SCOTCH_NAME_INTERN (graphFree)
+#define graphFreeBin                SCOTCH_NAME_INTERN (graphFreeBin)
 #define graphLoad                   SCOTCH_NAME_INTERN (graphLoad)
 #define graphLoad2                  SCOTCH_NAME_INTERN (graphLoad2)
+#define graphLoadBin                SCOTCH_NAME_INTERN (graphLoadBin)
+#define graphLoadHead               SCOTCH_NAME_INTERN (graphLoadHead)
+#define graphLoadText               SCOTCH_NAME_INTERN (graphLoadText)
 #define graphSave                   SCOTCH_NAME_INTERN (graphSave)
+#define graphSaveBin                SCOTCH_NAME_INTERN (graphSaveBin)
 #define graphBand                   SCOTCH_NAME_INTERN (graphBand)
 #define graphBase                   SCOTCH_NAME_INTERN (graphBase)
+#define graphBfs                    SCOTCH_NAME_INTERN (graphBfs)
 #define graphCheck                  SCOTCH_NAME_INTERN (graphCheck)
 #define graphClone                  SCOTCH_NAME_INTERN (graphClone)
+#define graphCmprBuild              SCOTCH_NAME_INTERN (graphCmprBuild)
+#define graphCmprCheck              SCOTCH_NAME_INTERN (graphCmprCheck)
+#define graphCmprExpand             SCOTCH_NAME_INTERN (graphCmprExpand)
+#define graphCmprVert               SCOTCH_NAME_INTERN (graphCmprVert)
 #define graphCoarsen                SCOTCH_NAME_INTERN (graphCoarsen)
+#define graphColor                  SCOTCH_NAME_INTERN (graphColor)
 #define graphCoarsenBuild           SCOTCH_NAME_INTERN (graphCoarsenBuild)
 #define graphCoarsenMatch           SCOTCH_NAME_INTERN (graphCoarsenMatch)
 #define graphDiamPV                 SCOTCH_NAME_INTERN (graphDiamPV)
 #define graphDump                   SCOTCH_NAME_INTERN (graphDump)
 #define graphDump2                  SCOTCH_NAME_INTERN (graphDump2)
 #define graphDumpArray              SCOTCH_NAME_INTERN (graphDumpArray)
+#define graphDumpArrayEdge          SCOTCH_NAME_INTERN (graphDumpArrayEdge)
 #define graphDumpArrays             SCOTCH_NAME_INTERN (graphDumpArrays)
 #define graphIelo                   SCOTCH_NAME_INTERN (graphIelo)
+#define graphIoTextBlank            SCOTCH_NAME_INTERN (graphIoTextBlank)
+#define graphIoTextExit             SCOTCH_NAME_INTERN (graphIoTextExit)
+#define graphIoTextInt              SCOTCH_NAME_INTERN (graphIoTextInt)
+#define graphIoTextLine             SCOTCH_NAME_INTERN (graphIoTextLine)
+#define graphIoTextPart             SCOTCH_NAME_INTERN (graphIoTextPart)
+#define graphIoTextPartNbr          SCOTCH_NAME_INTERN (graphIoTextPartNbr)
+#define graphIoTextRead             SCOTCH_NAME_INTERN (graphIoTextRead)
+#define graphIoTextSpace            SCOTCH_NAME_INTERN (graphIoTextSpace)
 #define graphInduceList             SCOTCH_NAME_INTERN (graphInduceList)
+#define graphInduceList2            SCOTCH_NAME_INTERN (graphInduceList2)
 #define graphInducePart             SCOTCH_NAME_INTERN (graphInducePart)
+#define graphInducePart2            SCOTCH_NAME_INTERN (graphInducePart2)
 #define graphMatch                  SCOTCH_NAME_INTERN (graphMatch)
 #define graphMatchInit              SCOTCH_NAME_INTERN (graphMatchInit)
 #define graphMatchNone              SCOTCH_NAME_INTERN (graphMatchNone)
+#define graphPartStream             SCOTCH_NAME_INTERN (graphPartStream)
+#define graphPerm                   SCOTCH_NAME_INTERN (graphPerm)
+#define graphPermCompute            SCOTCH_NAME_INTERN (graphPermCompute)
+#define graphGeomLoadBin            SCOTCH_NAME_INTERN (graphGeomLoadBin)
 #define graphGeomLoadChac           SCOTCH_NAME_INTERN (graphGeomLoadChac)
 #define graphGeomLoadHabo           SCOTCH_NAME_INTERN (graphGeomLoadHabo)
 #define graphGeomLoadMmkt           SCOTCH_NAME_INTERN (graphGeomLoadMmkt)
 #define graphGeomLoadScot           SCOTCH_NAME_INTERN (graphGeomLoadScot)
+#define graphGeomSaveBin            SCOTCH_NAME_INTERN (graphGeomSaveBin)
 #define graphGeomSaveChac           SCOTCH_NAME_INTERN (graphGeomSaveChac)
 #define graphGeomSaveScot           SCOTCH_NAME_INTERN (graphGeomSaveScot)
 #define graphGeomSaveMmkt           SCOTCH_NAME_INTERN (graphGeomSaveMmkt)
@@ -889,6 +943,7 @@
 
 #define hallOrderHdR2Halmd          SCOTCH_NAME_INTERN (hallOrderHdR2Halmd)
 #define hallOrderHfR3Hamdf4         SCOTCH_NAME_INTERN (hallOrderHfR3Hamdf4)
+#define hallOrderHmHamx             SCOTCH_NAME_INTERN (hallOrderHmHamx)
 #define hallOrderHxBuild            SCOTCH_NAME_INTERN (hallOrderHxBuild)
 #define hallOrderHxTree             SCOTCH_NAME_INTERN (hallOrderHxTree)
 
@@ -924,6 +979,7 @@
 #define hgraphOrderHxFill           SCOTCH_NAME_INTERN (hgraphOrderHxFill)
 #define hgraphOrderKp               SCOTCH_NAME_INTERN (hgraphOrderKp)
 #define hgraphOrderNd               SCOTCH_NAME_INTERN (hgraphOrderNd)
+#define hgraphOrderRl               SCOTCH_NAME_INTERN (hgraphOrderRl)
 #define hgraphOrderSi               SCOTCH_NAME_INTERN (hgraphOrderSi)
 #define hgraphOrderSt               SCOTCH_NAME_INTERN (hgraphOrderSt)
 #define hgraphUnhalo                SCOTCH_NAME_INTERN (hgraphUnhalo)
@@ -966,6 +1022,8 @@
 #define kgraphCheck                 SCOTCH_NAME_INTERN (kgraphCheck)
 #define kgraphBand                  SCOTCH_NAME_INTERN (kgraphBand)
 #define kgraphCost                  SCOTCH_NAME_INTERN (kgraphCost)
+#define kgraphCostVol               SCOTCH_NAME_INTERN (kgraphCostVol)
+#define kgraphDelta                 SCOTCH_NAME_INTERN (kgraphDelta)
 #define kgraphFron                  SCOTCH_NAME_INTERN (kgraphFron)
 #define kgraphFrst                  SCOTCH_NAME_INTERN (kgraphFrst)
 #define kgraphMapBd                 SCOTCH_NAME_INTERN (kgraphMapBd)
@@ -973,6 +1031,7 @@
 #define kgraphMapDf                 SCOTCH_NAME_INTERN (kgraphMapDf)
 #define kgraphMapEx                 SCOTCH_NAME_INTERN (kgraphMapEx)
 #define kgraphMapFm                 SCOTCH_NAME_INTERN (kgraphMapFm)
+#define kgraphMapJt                 SCOTCH_NAME_INTERN (kgraphMapJt)
 #define kgraphMapMl                 SCOTCH_NAME_INTERN (kgraphMapMl)
 #define kgraphMapRb                 SCOTCH_NAME_INTERN (kgraphMapRb)
 #define kgraphMapRbMap              SCOTCH_NAME_INTERN (kgraphMapRbMap)
@@ -981,12 +1040,31 @@
 #define kgraphMapRbVfloBuild        SCOTCH_NAME_INTERN (kgraphMapRbVfloBuild)
 #define kgraphMapRbVfloMerge        SCOTCH_NAME_INTERN (kgraphMapRbVfloMerge)
 #define kgraphMapRbVfloSplit        SCOTCH_NAME_INTERN (kgraphMapRbVfloSplit)
+#define kgraphMapRl                 SCOTCH_NAME_INTERN (kgraphMapRl)
 #define kgraphMapSt                 SCOTCH_NAME_INTERN (kgraphMapSt)
+#define kgraphMapVc                 SCOTCH_NAME_INTERN (kgraphMapVc)
 #define kgraphStoreInit             SCOTCH_NAME_INTERN (kgraphStoreInit)
 #define kgraphStoreExit             SCOTCH_NAME_INTERN (kgraphStoreExit)
 #define kgraphStoreSave             SCOTCH_NAME_INTERN (kgraphStoreSave)
 #define kgraphStoreUpdt             SCOTCH_NAME_INTERN (kgraphStoreUpdt)
 
+#define kmeshpartststratab          SCOTCH_NAME_INTERN (kmeshpartststratab)
+#define kmeshAlloc                  SCOTCH_NAME_INTERN (kmeshAlloc)
+#define kmeshInit                   SCOTCH_NAME_INTERN (kmeshInit)
+#define kmeshExit                   SCOTCH_NAME_INTERN (kmeshExit)
+#define kmeshCheck                  SCOTCH_NAME_INTERN (kmeshCheck)
+#define kmeshCost                   SCOTCH_NAME_INTERN (kmeshCost)
+#define kmeshLoadMax                SCOTCH_NAME_INTERN (kmeshLoadMax)
+#define kmeshZero                   SCOTCH_NAME_INTERN (kmeshZero)
+#define kmeshPartFm                 SCOTCH_NAME_INTERN (kmeshPartFm)
+#define kmeshPartGg                 SCOTCH_NAME_INTERN (kmeshPartGg)
+#define kmeshPartMl                 SCOTCH_NAME_INTERN (kmeshPartMl)
+#define kmeshPartSt                 SCOTCH_NAME_INTERN (kmeshPartSt)
+#define kmeshStoreInit              SCOTCH_NAME_INTERN (kmeshStoreInit)
+#define kmeshStoreExit              SCOTCH_NAME_INTERN (kmeshStoreExit)
+#define kmeshStoreSave              SCOTCH_NAME_INTERN (kmeshStoreSave)
+#define kmeshStoreUpdt              SCOTCH_NAME_INTERN (kmeshStoreUpdt)
+
 #define listInit                    SCOTCH_NAME_INTERN (listInit)
 #define listExit                    SCOTCH_NAME_INTERN (listExit)
 #define listAlloc                   SCOTCH_NAME_INTERN (listAlloc)
@@ -1002,6 +1080,9 @@
 #define mapAlloc                    SCOTCH_NAME_INTERN (mapAlloc)
 #define mapBuild                    SCOTCH_NAME_INTERN (mapBuild)
 #define mapCopy                     SCOTCH_NAME_INTERN (mapCopy)
+#define mapDistInit                 SCOTCH_NAME_INTERN (mapDistInit)
+#define mapDistExit                 SCOTCH_NAME_INTERN (mapDistExit)
+#define mapDistGet2                 SCOTCH_NAME_INTERN (mapDistGet2)
 #define mapCheck                    SCOTCH_NAME_INTERN (mapCheck)
 #define mapFree                     SCOTCH_NAME_INTERN (mapFree)
 #define mapFrst                     SCOTCH_NAME_INTERN (mapFrst)
@@ -1035,6 +1116,7 @@
 #define orderSaveMap                SCOTCH_NAME_INTERN (orderSaveMap)
 #define orderSaveTree               SCOTCH_NAME_INTERN (orderSaveTree)
 #define orderCheck                  SCOTCH_NAME_INTERN (orderCheck)
+#define orderFax                    SCOTCH_NAME_INTERN (orderFax)
 #define orderPeri                   SCOTCH_NAME_INTERN (orderPeri)
 #define orderRang                   SCOTCH_NAME_INTERN (orderRang)
 #define orderTree                   SCOTCH_NAME_INTERN (orderTree)
@@ -1270,20 +1352,24 @@
 #define SCOTCH_graphAlloc           SCOTCH_NAME_PUBLIC (SCOTCH_graphAlloc)
 #define SCOTCH_graphBase            SCOTCH_NAME_PUBLIC (SCOTCH_graphBase)
 #define SCOTCH_graphBuild           SCOTCH_NAME_PUBLIC (SCOTCH_graphBuild)
+#define SCOTCH_graphBuildMulti      SCOTCH_NAME_PUBLIC (SCOTCH_graphBuildMulti)
 #define SCOTCH_graphCheck           SCOTCH_NAME_PUBLIC (SCOTCH_graphCheck)
 #define SCOTCH_graphCoarsen         SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsen)
 #define SCOTCH_graphCoarsenBuild    SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsenBuild)
 #define SCOTCH_graphCoarsenMatch    SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsenMatch)
 #define SCOTCH_graphColor           SCOTCH_NAME_PUBLIC (SCOTCH_graphColor)
+#define SCOTCH_graphCompress        SCOTCH_NAME_PUBLIC (SCOTCH_graphCompress)
 #define SCOTCH_graphData            SCOTCH_NAME_PUBLIC (SCOTCH_graphData)
 #define SCOTCH_graphDiamPV          SCOTCH_NAME_PUBLIC (SCOTCH_graphDiamPV)
 #define SCOTCH_graphDump            SCOTCH_NAME_PUBLIC (SCOTCH_graphDump)
 #define SCOTCH_graphExit            SCOTCH_NAME_PUBLIC (SCOTCH_graphExit)
 #define SCOTCH_graphFree            SCOTCH_NAME_PUBLIC (SCOTCH_graphFree)
+#define SCOTCH_graphGeomLoadBin     SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadBin)
 #define SCOTCH_graphGeomLoadChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadChac)
 #define SCOTCH_graphGeomLoadHabo    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadHabo)
 #define SCOTCH_graphGeomLoadMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadMmkt)
 #define SCOTCH_graphGeomLoadScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadScot)
+#define SCOTCH_graphGeomSaveBin     SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveBin)
 #define SCOTCH_graphGeomSaveChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveChac)
 #define SCOTCH_graphGeomSaveMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveMmkt)
 #define SCOTCH_graphGeomSaveScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveScot)
@@ -1303,6 +1389,7 @@
 #define SCOTCH_graphMapViewRaw      SCOTCH_NAME_PUBLIC (SCOTCH_graphMapViewRaw)
 #define SCOTCH_graphOrder           SCOTCH_NAME_PUBLIC (SCOTCH_graphOrder)
 #define SCOTCH_graphOrderCheck      SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderCheck)
+#define SCOTCH_graphOrderFactor     SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderFactor)
 #define SCOTCH_graphOrderCompute    SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderCompute)
 #define SCOTCH_graphOrderComputeList SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderComputeList)
 #define SCOTCH_graphOrderExit       SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderExit)
@@ -1313,16 +1400,20 @@
 #define SCOTCH_graphOrderSaveMap    SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSaveMap)
 #define SCOTCH_graphOrderSaveTree   SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSaveTree)
 #define SCOTCH_graphPart            SCOTCH_NAME_PUBLIC (SCOTCH_graphPart)
+#define SCOTCH_graphPartBatch       SCOTCH_NAME_PUBLIC (SCOTCH_graphPartBatch)
 #define SCOTCH_graphPartFixed       SCOTCH_NAME_PUBLIC (SCOTCH_graphPartFixed)
 #define SCOTCH_graphPartOvl         SCOTCH_NAME_PUBLIC (SCOTCH_graphPartOvl)
 #define SCOTCH_graphPartOvlView     SCOTCH_NAME_PUBLIC (SCOTCH_graphPartOvlView)
+#define SCOTCH_graphPartStream      SCOTCH_NAME_PUBLIC (SCOTCH_graphPartStream)
 #define SCOTCH_graphRemap           SCOTCH_NAME_PUBLIC (SCOTCH_graphRemap)
 #define SCOTCH_graphRemapCompute    SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapCompute)
+#define SCOTCH_graphRemapDeltaCompute SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapDeltaCompute)
 #define SCOTCH_graphRemapFixed      SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapFixed)
 #define SCOTCH_graphRemapFixedCompute SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapFixedCompute)
 #define SCOTCH_graphRemapView       SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapView)
 #define SCOTCH_graphRemapViewRaw    SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapViewRaw)
 #define SCOTCH_graphRepart          SCOTCH_NAME_PUBLIC (SCOTCH_graphRepart)
+#define SCOTCH_graphRepartDelta     SCOTCH_NAME_PUBLIC (SCOTCH_graphRepartDelta)
 #define SCOTCH_graphRepartFixed     SCOTCH_NAME_PUBLIC (SCOTCH_graphRepartFixed)
 #define SCOTCH_graphSave            SCOTCH_NAME_PUBLIC (SCOTCH_graphSave)
 #define SCOTCH_graphSize            SCOTCH_NAME_PUBLIC (SCOTCH_graphSize)
@@ -1330,6 +1421,7 @@
 #define SCOTCH_graphStat            SCOTCH_NAME_PUBLIC (SCOTCH_graphStat)
 #define SCOTCH_graphTabLoad         SCOTCH_NAME_PUBLIC (SCOTCH_graphTabLoad)
 #define SCOTCH_graphTabSave         SCOTCH_NAME_PUBLIC (SCOTCH_graphTabSave)
+#define SCOTCH_graphUncompress      SCOTCH_NAME_PUBLIC (SCOTCH_graphUncompress)
 #define SCOTCH_mapAlloc             SCOTCH_NAME_PUBLIC (SCOTCH_mapAlloc)
 #define SCOTCH_mapSizeof            SCOTCH_NAME_PUBLIC (SCOTCH_mapSizeof)
 #define SCOTCH_memCur               SCOTCH_NAME_PUBLIC (SCOTCH_memCur)
@@ -1356,6 +1448,7 @@
 #define SCOTCH_meshOrderSave        SCOTCH_NAME_PUBLIC (SCOTCH_meshOrderSave)
 #define SCOTCH_meshOrderSaveMap     SCOTCH_NAME_PUBLIC (SCOTCH_meshOrderSaveMap)
 #define SCOTCH_meshOrderSaveTree    SCOTCH_NAME_PUBLIC (SCOTCH_meshOrderSaveTree)
+#define SCOTCH_meshPart             SCOTCH_NAME_PUBLIC (SCOTCH_meshPart)
 #define SCOTCH_meshSave             SCOTCH_NAME_PUBLIC (SCOTCH_meshSave)
 #define SCOTCH_meshSize             SCOTCH_NAME_PUBLIC (SCOTCH_meshSize)
 #define SCOTCH_meshSizeof           SCOTCH_NAME_PUBLIC (SCOTCH_meshSizeof)
@@ -1388,6 +1481,8 @@
 #define SCOTCH_stratInit            SCOTCH_NAME_PUBLIC (SCOTCH_stratInit)
 #define SCOTCH_stratMeshOrder       SCOTCH_NAME_PUBLIC (SCOTCH_stratMeshOrder)
 #define SCOTCH_stratMeshOrderBuild  SCOTCH_NAME_PUBLIC (SCOTCH_stratMeshOrderBuild)
+#define SCOTCH_stratMeshPart        SCOTCH_NAME_PUBLIC (SCOTCH_stratMeshPart)
+#define SCOTCH_stratMeshPartBuild   SCOTCH_NAME_PUBLIC (SCOTCH_stratMeshPartBuild)
 #define SCOTCH_stratSave            SCOTCH_NAME_PUBLIC (SCOTCH_stratSave)
 #define SCOTCH_stratSizeof          SCOTCH_NAME_PUBLIC (SCOTCH_stratSizeof)
 #define SCOTCH_version              SCOTCH_NAME_PUBLIC (SCOTCH_version)
@@ -0,0 +1,647 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : order_fax.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes the elimination    **/
+/**                tree, the column counts and the         **/
+/**                operation count of the factored matrix  **/
+/**                of a graph with respect to an ordering, **/
+/**                using all the threads of the given      **/
+/**                context.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_ORDER_FAX
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "order.h"
+#include "order_fax.h"
+
+/*************************************/
+/*                                   */
+/* These routines perform symbolic   */
+/* factorization without computing   */
+/* the structure of the factor.      */
+/*                                   */
+/*************************************/
+
+/* The column block tree is cut into independent
+** subtrees, which are ranges of columns such that
+** no column of a range has a neighbor of lower
+** index outside of it, and into the ranges of the
+** separators above them. Subtrees are assigned to
+** threads, which compute the elimination tree of
+** their columns by means of Liu's algorithm with
+** path compression, after which the first thread
+** completes the elimination tree with the columns
+** of the separators. Column counts are computed
+** by traversing the row subtrees of the factor:
+** every thread handles the rows of its subtrees,
+** then the part of the row subtrees of separator
+** rows which lies within its subtrees, recording
+** the separator columns at which these row subtrees
+** leave its subtrees. The remaining parts of the
+** row subtrees of separator rows are eventually
+** traversed sequentially. Subtree independence is
+** checked when computing the elimination tree; if
+** it does not hold, the whole computation is
+** performed as a single subtree.
+*/
+
+/* This routine merges the abort flags
+** of multiple threads.
+*/
+
+static
+void
+orderFaxReduce (
+OrderFaxThread * restrict const tlocptr,          /* Pointer to local thread block  */
+OrderFaxThread * restrict const tremptr,          /* Pointer to remote thread block */
+const void * const              globptr)          /* Unused                         */
+{
+  tlocptr->abrtval |= tremptr->abrtval;
+}
+
+/* This routine enlarges the given array of
+** pairs so that it can hold more than the
+** given number of pairs.
+** It returns:
+** - 0   : if the array could be enlarged.
+** - !0  : on error.
+*/
+
+static
+int
+orderFaxPair (
+Gnum ** const               pairptr,
+Gnum * const                sizeptr,
+const Gnum                  pairnbr)
+{
+  Gnum *              pairtmp;
+  Gnum                pairsiz;
+
+  pairsiz = MAX (*sizeptr * 2, MAX (pairnbr + 1, ORDERFAXPAIRMIN));
+  pairtmp = (*pairptr == NULL) ? memAlloc (pairsiz * 2 * sizeof (Gnum)) : memRealloc (*pairptr, pairsiz * 2 * sizeof (Gnum));
+  if (pairtmp == NULL) {
+    errorPrint ("orderFaxPair: out of memory");
+    return (1);
+  }
+  *pairptr = pairtmp;
+  *sizeptr = pairsiz;
+
+  return (0);
+}
+
+/* This routine cuts the given column block
+** subtree into independent subtrees of size
+** at most the given size, whenever possible,
+** and into the ranges of the separators above
+** them. Both range arrays are filled by
+** ascending column indices.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+orderFaxTree (
+const OrderCblk * const     cblkptr,
+const Gnum                  fnumval,              /* Index of first column of subtree */
+const Gnum                  taskmax,              /* Maximum size of subtree ranges   */
+OrderFaxRange * const       tasktab,
+Gnum * const                taskptr,
+OrderFaxRange * const       toprtab,
+Gnum * const                toprptr)
+{
+  if (cblkptr->vnodnbr <= 0)
+    return;
+
+  if ((cblkptr->vnodnbr > taskmax) &&             /* If subtree too large and made of independent subtrees */
+      (cblkptr->cblknbr >= 2) &&
+      ((cblkptr->typeval & (ORDERCBLKNEDI | ORDERCBLKDICO)) != 0)) {
+    Gnum                cblknbr;
+    Gnum                cblknum;
+    Gnum                fnumtmp;
+
+    cblknbr = (((cblkptr->typeval & ORDERCBLKNEDI) != 0) && (cblkptr->cblknbr == 3)) ? 2 : cblkptr->cblknbr; /* Do not account for separator */
+    for (cblknum = 0, fnumtmp = fnumval; cblknum < cblknbr; cblknum ++) {
+      orderFaxTree (&cblkptr->cblktab[cblknum], fnumtmp, taskmax, tasktab, taskptr, toprtab, toprptr);
+      fnumtmp += cblkptr->cblktab[cblknum].vnodnbr;
+    }
+    if (fnumtmp < (fnumval + cblkptr->vnodnbr)) { /* If separator present, it is above subtrees */
+      toprtab[*toprptr].fnumval = fnumtmp;
+      toprtab[*toprptr].lnumval = fnumval + cblkptr->vnodnbr;
+      (*toprptr) ++;
+    }
+    return;
+  }
+
+  tasktab[*taskptr].fnumval = fnumval;
+  tasktab[*taskptr].lnumval = fnumval + cblkptr->vnodnbr;
+  (*taskptr) ++;
+}
+
+/* This routine computes the elimination tree
+** of the given range of columns, by means of
+** Liu's algorithm with path compression.
+** It returns:
+** - 0   : on success.
+** - !0  : if a column has a neighbor of index
+**         lower than the given minimum index.
+*/
+
+static
+int
+orderFaxLiu (
+const OrderFaxData * restrict const dataptr,
+const Gnum                          fnumval,      /* First column of range           */
+const Gnum                          lnumval,      /* After last column of range      */
+const Gnum                          lowval,       /* Smallest allowed neighbor index */
+Gnum * restrict const               edgetab)      /* Decoding buffer, if compressed  */
+{
+  Gnum                colnum;
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  const Gnum * restrict const   peritax = dataptr->peritax;
+  const Gnum * restrict const   permtax = dataptr->permtax;
+  Gnum * restrict const         fathtax = dataptr->fathtax;
+  Gnum * restrict const         ancetax = dataptr->ancetax;
+
+  for (colnum = fnumval; colnum < lnumval; colnum ++) {
+    const Gnum * restrict edgetax;
+    Gnum                  vertnum;
+    Genum                 edgenum;
+
+    vertnum = peritax[colnum];
+    edgetax = graphEdgeTax (grafptr, vertnum, edgetab);
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                rownum;
+
+      rownum = permtax[edgetax[edgenum]];
+      if (rownum >= colnum)                       /* Only consider upper triangular part */
+        continue;
+      if (rownum < lowval)                        /* If column depends on column outside of range */
+        return (1);
+
+      while (1) {                                 /* Climb to root of virtual tree, compressing path */
+        Gnum                ancenum;
+
+        ancenum = ancetax[rownum];
+        if (ancenum == colnum)
+          break;
+        ancetax[rownum] = colnum;
+        if (ancenum == -1) {                      /* If root reached, link it to current column */
+          fathtax[rownum] = colnum;
+          break;
+        }
+        rownum = ancenum;
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* This routine is the threaded core of the
+** symbolic factorization routine.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+orderFaxThrd (
+ThreadDescriptor * restrict const descptr,
+OrderFaxData * restrict const     dataptr)
+{
+  Gnum                vertbas;                    /* Start of slice of columns */
+  Gnum                vertnnd;                    /* End of slice of columns   */
+  Gnum                colnum;
+  Gnum                taskidx;
+
+  const Graph * restrict const      grafptr = dataptr->grafptr;
+  const Genum * restrict const      verttax = grafptr->verttax;
+  const Genum * restrict const      vendtax = grafptr->vendtax;
+  const Gnum * restrict const       velotax = grafptr->velotax;
+  const Gnum * restrict const       peritax = dataptr->peritax;
+  Gnum * restrict const             permtax = dataptr->permtax;
+  Gnum * restrict const             fathtax = dataptr->fathtax;
+  Gnum * restrict const             ancetax = dataptr->ancetax;
+  Gnum * restrict const             cntstax = dataptr->cntstax;
+  const OrderFaxRange * restrict const tasktab = dataptr->tasktab;
+  const Gnum * restrict const       tidxtab = dataptr->tidxtab;
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  OrderFaxThread * restrict const   thrdptr = &dataptr->thrdtab[thrdnum];
+
+  vertbas = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum);
+  vertnnd = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum + 1);
+  for (colnum = vertbas; colnum < vertnnd; colnum ++) {
+    permtax[peritax[colnum]] = colnum;
+    fathtax[colnum] = -1;
+    ancetax[colnum] = -1;
+    cntstax[colnum] = 0;
+  }
+  threadBarrier (descptr);                        /* Direct permutation must be complete */
+
+  for (taskidx = thrdptr->taskbas; taskidx < thrdptr->tasknnd; taskidx ++) {
+    const OrderFaxRange * const taskptr = &tasktab[tidxtab[taskidx]];
+
+    if (orderFaxLiu (dataptr, taskptr->fnumval, taskptr->lnumval, taskptr->fnumval, thrdptr->edgetab) != 0) {
+      thrdptr->abrtval |= ORDERFAXABRTDEP;
+      break;
+    }
+  }
+  threadReduce (descptr, (void *) thrdptr, sizeof (OrderFaxThread), (ThreadReduceFunc) orderFaxReduce, 0, NULL);
+  if (dataptr->thrdtab[0].abrtval != 0)           /* If subtrees are not independent, give up */
+    return;
+
+  if (thrdnum == 0) {                             /* First thread completes elimination tree with separators */
+    Gnum                toprnum;
+
+    for (toprnum = 0; toprnum < dataptr->toprnbr; toprnum ++)
+      orderFaxLiu (dataptr, dataptr->toprtab[toprnum].fnumval, dataptr->toprtab[toprnum].lnumval, grafptr->baseval, thrdptr->edgetab);
+  }
+  threadBarrier (descptr);                        /* Elimination tree must be complete */
+
+  for (taskidx = thrdptr->taskbas; taskidx < thrdptr->tasknnd; taskidx ++) {
+    const OrderFaxRange * const taskptr = &tasktab[tidxtab[taskidx]];
+    const Gnum                  fnumval = taskptr->fnumval;
+    const Gnum                  lnumval = taskptr->lnumval;
+    Gnum                        rownum;
+    Gnum                        pairnbr;
+    Gnum                        pairnum;
+
+    for (colnum = fnumval; colnum < lnumval; colnum ++) /* Ancestor array is now used as row marker array */
+      ancetax[colnum] = -1;
+
+    for (rownum = fnumval, pairnbr = 0; rownum < lnumval; rownum ++) { /* For all rows of subtree */
+      const Gnum * restrict edgetax;
+      Gnum                  vertnum;
+      Gnum                  veloval;
+      Genum                 edgenum;
+
+      vertnum = peritax[rownum];
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      edgetax = graphEdgeTax (grafptr, vertnum, thrdptr->edgetab);
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                colend;
+
+        colend = permtax[edgetax[edgenum]];
+        if (colend >= rownum) {                   /* If term in upper triangular part */
+          if (colend >= lnumval) {                /* If separator row, record it for later processing */
+            if ((pairnbr >= thrdptr->pairsiz) &&
+                (orderFaxPair (&thrdptr->pairtab, &thrdptr->pairsiz, pairnbr) != 0)) {
+              thrdptr->abrtval |= ORDERFAXABRTMEM;
+              return;
+            }
+            thrdptr->pairtab[2 * pairnbr]     = colend;
+            thrdptr->pairtab[2 * pairnbr + 1] = rownum;
+            pairnbr ++;
+          }
+          continue;
+        }
+
+        for ( ; (colend != rownum) && (ancetax[colend] != rownum); colend = fathtax[colend]) { /* Traverse row subtree up to marked column */
+          ancetax[colend]  = rownum;
+          cntstax[colend] += veloval;
+        }
+      }
+    }
+
+    intSort2asc1 (thrdptr->pairtab, pairnbr);     /* Group pairs by separator row */
+    for (pairnum = 0; pairnum < pairnbr; pairnum ++) {
+      Gnum                rownum;
+      Gnum                veloval;
+
+      rownum  = thrdptr->pairtab[2 * pairnum];
+      colnum  = thrdptr->pairtab[2 * pairnum + 1];
+      veloval = (velotax != NULL) ? velotax[peritax[rownum]] : 1;
+      for ( ; (colnum < lnumval) && (ancetax[colnum] != rownum); colnum = fathtax[colnum]) { /* Traverse row subtree within subtree */
+        ancetax[colnum]  = rownum;
+        cntstax[colnum] += veloval;
+      }
+      if ((colnum >= lnumval) && (colnum != rownum)) { /* If row subtree goes on in separators, record exit column */
+        if ((thrdptr->exitnbr >= thrdptr->exitsiz) &&
+            (orderFaxPair (&thrdptr->exittab, &thrdptr->exitsiz, thrdptr->exitnbr) != 0)) {
+          thrdptr->abrtval |= ORDERFAXABRTMEM;
+          return;
+        }
+        thrdptr->exittab[2 * thrdptr->exitnbr]     = rownum;
+        thrdptr->exittab[2 * thrdptr->exitnbr + 1] = colnum;
+        thrdptr->exitnbr ++;
+      }
+    }
+
+    for (colnum = fnumval; colnum < lnumval; colnum ++) /* Flag columns of subtree as fully processed */
+      ancetax[colnum] = -2;
+  }
+}
+
+/* This routine computes the elimination tree
+** and the column counts of the factored matrix
+** of the given graph with respect to the given
+** ordering, as well as the number of non-zeros
+** and the operation count of its Cholesky
+** factorization. When the graph has vertex
+** loads, every vertex stands for as many
+** matrix columns as its load. Elimination tree
+** and column count arrays are indexed by
+** permuted column, may be NULL, and receive,
+** respectively, the based index of the father
+** column, or -1 for roots, and the weighted sum
+** of the rows of the factored column, including
+** the diagonal. Results do not depend on the
+** number of threads.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+orderFax (
+const Order * restrict const  ordeptr,            /* Ordering                                 */
+const Graph * restrict const  grafptr,            /* Graph to factor                          */
+Gnum * restrict const         fathtax,            /* Elimination tree array [based], or NULL  */
+Gnum * restrict const         cntstax,            /* Column count array [based], or NULL      */
+double * restrict const       nnzeptr,            /* Pointer to number of non-zeros, or NULL  */
+double * restrict const       opcoptr,            /* Pointer to operation count, or NULL      */
+Context * restrict const      contptr)            /* Execution context                        */
+{
+  OrderFaxData        datadat;
+  OrderFaxThread *    thrdtab;
+  OrderFaxRange *     tasktab;
+  OrderFaxRange *     toprtab;
+  Gnum *              tidxtab;
+  Gnum *              sorttab;                    /* Array for sorting subtrees by size */
+  Gnum *              loadtab;                    /* Load of threads, in columns        */
+  Gnum *              permtab;
+  Gnum *              ancetab;
+  Gnum *              fathtab;
+  Gnum *              cntstab;
+  Gnum *              edgetab;
+  Gnum *              exittab;
+  Gnum                edgesiz;                    /* Size of decoding buffer of each thread */
+  Gnum                tasknbr;
+  Gnum                tasknum;
+  Gnum                taskmax;
+  Gnum                toprnbr;
+  Gnum                toprnum;
+  Gnum                exitnbr;
+  Gnum                exitnum;
+  Gnum                colnum;
+  double              nnzeval;
+  double              opcoval;
+  int                 thrdnum;
+  int                 abrtval;
+
+  const Gnum                    baseval = grafptr->baseval;
+  const Gnum                    vertnbr = grafptr->vertnbr;
+  const Genum * restrict const  verttax = grafptr->verttax;
+  const Genum * restrict const  vendtax = grafptr->vendtax;
+  const Gnum * restrict const   velotax = grafptr->velotax;
+  const Gnum * restrict const   peritax = ordeptr->peritab - baseval;
+  const int                     thrdnbr = contextThreadNbr (contptr);
+
+  if ((ordeptr->vnodnbr != vertnbr) || (ordeptr->baseval != baseval)) {
+    errorPrint ("orderFax: ordering does not match graph");
+    return (1);
+  }
+
+  edgesiz = (grafptr->edgetax == NULL) ? (grafptr->degrmax + 1) : 0;
+  if (memAllocGroup ((void **) (void *)
+                     &thrdtab, (size_t) (thrdnbr * sizeof (OrderFaxThread)),
+                     &tasktab, (size_t) ((ordeptr->treenbr + 1) * sizeof (OrderFaxRange)),
+                     &toprtab, (size_t) ((ordeptr->treenbr + 1) * sizeof (OrderFaxRange)),
+                     &tidxtab, (size_t) ((ordeptr->treenbr + 1) * sizeof (Gnum)),
+                     &sorttab, (size_t) ((ordeptr->treenbr + 1) * 2 * sizeof (Gnum)),
+                     &loadtab, (size_t) (thrdnbr * sizeof (Gnum)),
+                     &permtab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &ancetab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &fathtab, (size_t) (((fathtax == NULL) ? vertnbr : 0) * sizeof (Gnum)),
+                     &cntstab, (size_t) (((cntstax == NULL) ? vertnbr : 0) * sizeof (Gnum)),
+                     &edgetab, (size_t) (thrdnbr * edgesiz * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("orderFax: out of memory (1)");
+    return (1);
+  }
+
+  tasknbr =
+  toprnbr = 0;
+  taskmax = (thrdnbr > 1) ? MAX (1, vertnbr / (thrdnbr * ORDERFAXTASKRAT)) : vertnbr;
+  orderFaxTree (&ordeptr->rootdat, baseval, taskmax, tasktab, &tasknbr, toprtab, &toprnbr);
+
+  for (tasknum = 0; tasknum < tasknbr; tasknum ++) { /* Sort subtrees by decreasing size */
+    sorttab[2 * tasknum]     = tasktab[tasknum].fnumval - tasktab[tasknum].lnumval;
+    sorttab[2 * tasknum + 1] = tasknum;
+  }
+  intSort2asc1 (sorttab, tasknbr);
+  memSet (loadtab, 0, thrdnbr * sizeof (Gnum));
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    thrdtab[thrdnum].tasknnd = 0;
+  for (tasknum = 0; tasknum < tasknbr; tasknum ++) { /* Give every subtree to least loaded thread */
+    int                 thrdtmp;
+
+    for (thrdnum = 0, thrdtmp = 1; thrdtmp < thrdnbr; thrdtmp ++) {
+      if (loadtab[thrdtmp] < loadtab[thrdnum])
+        thrdnum = thrdtmp;
+    }
+    loadtab[thrdnum] -= sorttab[2 * tasknum];
+    sorttab[2 * tasknum] = thrdnum;               /* Record thread of subtree */
+    thrdtab[thrdnum].tasknnd ++;
+  }
+  for (thrdnum = 0, tasknum = 0; thrdnum < thrdnbr; thrdnum ++) { /* Compute start indices of task indices of threads */
+    thrdtab[thrdnum].taskbas = tasknum;
+    tasknum += thrdtab[thrdnum].tasknnd;
+    thrdtab[thrdnum].tasknnd = thrdtab[thrdnum].taskbas;
+  }
+  for (tasknum = 0; tasknum < tasknbr; tasknum ++) {
+    thrdnum = (int) sorttab[2 * tasknum];
+    tidxtab[thrdtab[thrdnum].tasknnd ++] = sorttab[2 * tasknum + 1];
+  }
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    thrdtab[thrdnum].edgetab = (edgesiz > 0) ? (edgetab + thrdnum * edgesiz) : NULL;
+    thrdtab[thrdnum].pairtab = NULL;
+    thrdtab[thrdnum].pairsiz = 0;
+    thrdtab[thrdnum].exittab = NULL;
+    thrdtab[thrdnum].exitnbr =
+    thrdtab[thrdnum].exitsiz = 0;
+    thrdtab[thrdnum].abrtval = 0;
+  }
+
+  datadat.grafptr = grafptr;
+  datadat.peritax = peritax;
+  datadat.permtax = permtab - baseval;
+  datadat.fathtax = (fathtax != NULL) ? fathtax : (fathtab - baseval);
+  datadat.ancetax = ancetab - baseval;
+  datadat.cntstax = (cntstax != NULL) ? cntstax : (cntstab - baseval);
+  datadat.tasktab = tasktab;
+  datadat.tidxtab = tidxtab;
+  datadat.toprtab = toprtab;
+  datadat.toprnbr = toprnbr;
+  datadat.thrdtab = thrdtab;
+
+  contextThreadLaunch (contptr, (ThreadFunc) orderFaxThrd, (void *) &datadat);
+
+  abrtval = 0;
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    abrtval |= thrdtab[thrdnum].abrtval;
+  if (abrtval == ORDERFAXABRTDEP) {               /* If subtrees not independent, process whole matrix as a single subtree */
+    tasktab[0].fnumval = baseval;
+    tasktab[0].lnumval = baseval + vertnbr;
+    tidxtab[0] = 0;
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+      thrdtab[thrdnum].taskbas =
+      thrdtab[thrdnum].tasknnd = (thrdnum == 0) ? 0 : 1;
+      thrdtab[thrdnum].abrtval = 0;
+    }
+    thrdtab[0].tasknnd = 1;
+    datadat.toprnbr =
+    toprnbr         = 0;
+
+    contextThreadLaunch (contptr, (ThreadFunc) orderFaxThrd, (void *) &datadat);
+
+    abrtval = 0;
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+      abrtval |= thrdtab[thrdnum].abrtval;
+  }
+
+  for (thrdnum = 0, exitnbr = 0; thrdnum < thrdnbr; thrdnum ++) {
+    exitnbr += thrdtab[thrdnum].exitnbr;
+    if (thrdtab[thrdnum].pairtab != NULL)
+      memFree (thrdtab[thrdnum].pairtab);
+  }
+  exittab = NULL;
+  if ((abrtval == 0) && (exitnbr > 0)) {          /* Gather exit pairs of all threads */
+    if ((exittab = memAlloc (exitnbr * 2 * sizeof (Gnum))) == NULL) {
+      errorPrint ("orderFax: out of memory (2)");
+      abrtval = ORDERFAXABRTMEM;
+    }
+    else {
+      for (thrdnum = 0, exitnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+        memCpy (exittab + 2 * exitnum, thrdtab[thrdnum].exittab, thrdtab[thrdnum].exitnbr * 2 * sizeof (Gnum));
+        exitnum += thrdtab[thrdnum].exitnbr;
+      }
+      intSort2asc1 (exittab, exitnbr);            /* Group exit pairs by separator row */
+    }
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (thrdtab[thrdnum].exittab != NULL)
+      memFree (thrdtab[thrdnum].exittab);
+  }
+
+  if (abrtval != 0) {
+    if ((abrtval & ORDERFAXABRTMEM) == 0)         /* Memory errors have already been reported */
+      errorPrint ("orderFax: internal error");
+    memFree (thrdtab);                            /* Free group leader */
+    return (1);
+  }
+
+  {
+    const Gnum * restrict const permtax = datadat.permtax;
+    Gnum * restrict const       fathtax = datadat.fathtax;
+    Gnum * restrict const       ancetax = datadat.ancetax;
+    Gnum * restrict const       cntstax = datadat.cntstax;
+
+    for (toprnum = 0; toprnum < toprnbr; toprnum ++) { /* Reset row markers of separator columns */
+      for (colnum = toprtab[toprnum].fnumval; colnum < toprtab[toprnum].lnumval; colnum ++)
+        ancetax[colnum] = -1;
+    }
+
+    for (toprnum = 0, exitnum = 0; toprnum < toprnbr; toprnum ++) { /* Traverse remaining parts of row subtrees of separator rows */
+      Gnum                rownum;
+
+      for (rownum = toprtab[toprnum].fnumval; rownum < toprtab[toprnum].lnumval; rownum ++) {
+        const Gnum * restrict edgetax;
+        Gnum                  vertnum;
+        Gnum                  veloval;
+        Genum                 edgenum;
+
+        vertnum = peritax[rownum];
+        veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+        edgetax = graphEdgeTax (grafptr, vertnum, thrdtab[0].edgetab);
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+          colnum = permtax[edgetax[edgenum]];
+          if (ancetax[colnum] == -2)              /* Parts in subtrees have already been processed */
+            continue;
+          for ( ; (colnum < rownum) && (ancetax[colnum] != rownum); colnum = fathtax[colnum]) {
+            ancetax[colnum]  = rownum;
+            cntstax[colnum] += veloval;
+          }
+        }
+        for ( ; (exitnum < exitnbr) && (exittab[2 * exitnum] == rownum); exitnum ++) {
+          for (colnum = exittab[2 * exitnum + 1]; (colnum != rownum) && (ancetax[colnum] != rownum); colnum = fathtax[colnum]) {
+            ancetax[colnum]  = rownum;
+            cntstax[colnum] += veloval;
+          }
+        }
+      }
+    }
+
+    for (colnum = baseval, nnzeval = opcoval = 0.0; colnum < (baseval + vertnbr); colnum ++) {
+      Gnum                veloval;
+      double              cntsval;
+
+      veloval = (velotax != NULL) ? velotax[peritax[colnum]] : 1;
+      cntstax[colnum] += veloval;                 /* Account for diagonal */
+      cntsval  = (double) cntstax[colnum] * (double) veloval;
+      nnzeval += cntsval;
+      opcoval += cntsval * (double) cntstax[colnum];
+    }
+  }
+
+  if (nnzeptr != NULL)
+    *nnzeptr = nnzeval;
+  if (opcoptr != NULL)
+    *opcoptr = opcoval;
+
+  if (exittab != NULL)
+    memFree (exittab);
+  memFree (thrdtab);                              /* Free group leader */
+
+  return (0);
+}
@@ -0,0 +1,122 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : order_fax.h                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the multithreaded symbolic          **/
+/**                factorization routine.                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Number of independent subtrees of
+    the column block tree to extract per
+    thread, for load balancing.          +*/
+
+#define ORDERFAXTASKRAT             8
+
+/*+ Minimum size of growable pair arrays. +*/
+
+#define ORDERFAXPAIRMIN             1024
+
+/*+ Abort flags. +*/
+
+#define ORDERFAXABRTMEM             1             /* Out of memory                      */
+#define ORDERFAXABRTDEP             2             /* Subtrees are not independent       */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The column range structure. It is used
+    both for independent subtrees of the
+    column block tree and for the separators
+    above them.                               +*/
+
+typedef struct OrderFaxRange_ {
+  Gnum                      fnumval;              /*+ First permuted column index +*/
+  Gnum                      lnumval;              /*+ After last column index     +*/
+} OrderFaxRange;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct OrderFaxThread_ {
+  Gnum                      taskbas;              /*+ Start index of tasks in task index array +*/
+  Gnum                      tasknnd;              /*+ End index of tasks in task index array   +*/
+  Gnum *                    edgetab;              /*+ Decoding buffer for compressed graph     +*/
+  Gnum *                    pairtab;              /*+ Pairs of top rows and subtree columns    +*/
+  Gnum                      pairsiz;              /*+ Size of pair array, in pairs             +*/
+  Gnum *                    exittab;              /*+ Pairs of top rows and top exit columns   +*/
+  Gnum                      exitnbr;              /*+ Number of exit pairs                     +*/
+  Gnum                      exitsiz;              /*+ Size of exit array, in pairs             +*/
+  int                       abrtval;              /*+ Abort flags                              +*/
+} OrderFaxThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct OrderFaxData_ {
+  const Graph *             grafptr;              /*+ Graph to factor                          +*/
+  const Gnum *              peritax;              /*+ Inverse permutation array                +*/
+  Gnum *                    permtax;              /*+ Direct permutation array                 +*/
+  Gnum *                    fathtax;              /*+ Elimination tree array                   +*/
+  Gnum *                    ancetax;              /*+ Ancestor array, then row marker array    +*/
+  Gnum *                    cntstax;              /*+ Weighted counts of extra-diagonal terms  +*/
+  const OrderFaxRange *     tasktab;              /*+ Array of independent subtree ranges      +*/
+  const Gnum *              tidxtab;              /*+ Indices of tasks, grouped by thread      +*/
+  const OrderFaxRange *     toprtab;              /*+ Array of separator ranges above subtrees +*/
+  Gnum                      toprnbr;              /*+ Number of separator ranges               +*/
+  OrderFaxThread *          thrdtab;              /*+ Array of thread-specific data blocks     +*/
+} OrderFaxData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_ORDER_FAX
+static void                 orderFaxReduce      (OrderFaxThread * restrict const, OrderFaxThread * restrict const, const void * const);
+static int                  orderFaxPair        (Gnum ** const, Gnum * const, const Gnum);
+static void                 orderFaxTree        (const OrderCblk * const, const Gnum, const Gnum, OrderFaxRange * const, Gnum * const, OrderFaxRange * const, Gnum * const);
+static int                  orderFaxLiu         (const OrderFaxData * restrict const, const Gnum, const Gnum, const Gnum, Gnum * restrict const);
+static void                 orderFaxThrd        (ThreadDescriptor * restrict const, OrderFaxData * restrict const);
+#endif /* SCOTCH_ORDER_FAX */
+
+int                         orderFax            (const Order * restrict const, const Graph * restrict const, Gnum * restrict const, Gnum * restrict const, double * restrict const, double * restrict const, Context * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.1  : from : 02 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -91,15 +91,15 @@ const VgraphSeparateBdParam * const paraptr)      /*+ Method parameters +*/
   Gnum                        bndvertnum;
   Gnum                        bndvelosum;         /* Load of regular vertices in band graph                       */
   Gnum * restrict             bndedgetax;
-  Gnum                        bndedgenbr;         /* Upper bound on the number of edges, including anchor edges   */
+  Genum                       bndedgenbr;         /* Upper bound on the number of edges, including anchor edges   */
   Gnum                        bndeancnbr;         /* Number of anchor edges                                       */
-  Gnum                        bndedgenum;
-  Gnum                        bndedgetmp;
+  Genum                       bndedgenum;
+  Genum                       bndedgetmp;
   Gnum                        bnddegrmax;
   Gnum                        fronnum;
 
-  const Gnum * restrict const orgverttax = orggrafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
+  const Genum * restrict const orgverttax = orggrafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const orgvendtax = orggrafptr->s.vendtax;
   const Gnum * restrict const orgvelotax = orggrafptr->s.velotax;
   const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
 
@@ -153,7 +153,7 @@ const VgraphSeparateBdParam * const paraptr)      /*+ Method parameters +*/
   bndcompload1 = 0;
   do {                                            /* Loop on vertices in queue */
     Gnum                orgvertnum;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
     Gnum                orgdistval;
 
     orgvertnum = vgraphSeparateBdQueueGet (&queudat);
@@ -233,7 +233,7 @@ const VgraphSeparateBdParam * const paraptr)      /*+ Method parameters +*/
   bndgrafdat.s.vertnnd = bndvertnnd + 2;
 
   if (memAllocGroup ((void **) (void *)           /* Do not allocate vnumtab but keep queudat.qtab instead */
-                     &bndgrafdat.s.verttax, (size_t) ((bndvertnbr + 3) * sizeof (Gnum)),
+                     &bndgrafdat.s.verttax, (size_t) ((bndvertnbr + 3) * sizeof (Genum)),
                      &bndgrafdat.s.velotax, (size_t) ((bndvertnbr + 2) * sizeof (Gnum)), NULL) == NULL) {
     errorPrint ("vgraphSeparateBd: out of memory (2)");
     memFree    (queudat.qtab);
@@ -262,7 +262,7 @@ const VgraphSeparateBdParam * const paraptr)      /*+ Method parameters +*/
   for (bndvertnum = bndedgenum = orggrafptr->s.baseval, bnddegrmax = 0; /* Fill index array for vertices not belonging to last level */
        bndvertnum < bndvlvlnum; bndvertnum ++) {
     Gnum                orgvertnum;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
 
     orgvertnum = bndvnumtax[bndvertnum];
     bndgrafdat.s.verttax[bndvertnum] = bndedgenum;
@@ -289,7 +289,7 @@ const VgraphSeparateBdParam * const paraptr)      /*+ Method parameters +*/
   bndeancnbr = 0;
   for ( ; bndvertnum < bndvertnnd; bndvertnum ++) { /* Fill index array for vertices belonging to last level */
     Gnum                orgvertnum;
-    Gnum                orgedgenum;
+    Genum               orgedgenum;
     GraphPart           orgpartval;
     Gnum                bnddegrval;
 
@@ -1,4 +1,4 @@
-/* Copyright 2007,2013,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2013,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.1  : from : 27 nov 2021     **/
 /**                                 to   : 27 nov 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -105,8 +105,8 @@ const VgraphSeparateDfParam * const paraptr)      /*+ Method parameters +*/
   INT                   movenum;
   INT                   passnum;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   Gnum * restrict const       frontab = grafptr->frontab;
   GraphPart *  restrict const parttax = grafptr->parttax;
@@ -132,7 +132,7 @@ const VgraphSeparateDfParam * const paraptr)      /*+ Method parameters +*/
     Gnum                vertnum;
 
     for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                edlosum;
 
       for (edgenum = verttax[vertnum], edlosum = 0;
@@ -184,8 +184,8 @@ const VgraphSeparateDfParam * const paraptr)      /*+ Method parameters +*/
       vertnnd = grafptr->s.vertnnd - 2;
       while (1) {
         for ( ; vertnum < vertnnd; vertnum ++) {
-          Gnum                edgenum;
-          Gnum                edgennd;
+          Genum               edgenum;
+          Genum               edgennd;
           float               diffval;
 
           edgenum = verttax[vertnum];
@@ -254,7 +254,7 @@ abort :                                           /* If overflow occured, resume
       compsize1 += partval;                       /* Here, part is 0 or 1 only */
       compload1 += partval * veloval;
       if (partval == (Gnum) rootval) {            /* Only vertices of aggregated part can be in separator */
-        Gnum                edgenum;
+        Genum               edgenum;
 
         for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
           if (parttax[edgetax[edgenum]] == partend) { /* If end vertex is in other part (and not in separator) */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2013,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2013,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 01 nov 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This algorithm comes from:            **/
 /**                  "Computing the Block Triangular form  **/
@@ -168,7 +168,7 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
   memSet (matetax + (partnbr + grafptr->baseval), ~0, (grafptr->vertnbr - partnbr) * sizeof (Gnum));
   for (vertnum = grafptr->baseval;                /* Compute a cheap matching */
        vertnum < (partnbr + grafptr->baseval); vertnum ++) {
-    Gnum              edgenum;
+    Genum             edgenum;
     Gnum              matenum;
 
     for (edgenum = grafptr->verttax[vertnum], matenum = ~0; /* Search a matching end vertex */
@@ -206,7 +206,7 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
 
       vertcol = *queutail ++;                     /* Get the free column vertex */
       if (levltax[vertcol] < levlmax) {
-        Gnum              edgenum;
+        Genum             edgenum;
 
         travtax[vertcol] = VGRAPHSEPAESTRAVUSED;  /* Column has been reached */
 
@@ -364,12 +364,12 @@ const Gnum * restrict const           levltax,
 const Gnum                            levlcur,    /* Current backtracking level */
 Gnum * restrict const                 matetax,
 VgraphSeparateEsTrav * restrict const travtax,
-const Gnum * restrict const           verttax,
-const Gnum * restrict const           vendtax,
+const Genum * restrict const          verttax,
+const Genum * restrict const          vendtax,
 const Gnum * restrict const           edgetax,
 const Gnum                            vertrow)    /* Row vertex to backtrack from */
 {
-  Gnum                edgenum;
+  Genum               edgenum;
 
   travtax[vertrow] = VGRAPHSEPAESTRAVDRTY;        /* Never re-use this row */
 
@@ -407,12 +407,12 @@ void
 vgraphSeparateEsCoverCol (
 const Gnum * restrict const           matetax,
 VgraphSeparateEsType * restrict const typetax,
-const Gnum * restrict const           verttax,
-const Gnum * restrict const           vendtax,
+const Genum * restrict const          verttax,
+const Genum * restrict const          vendtax,
 const Gnum * restrict const           edgetax,
 const Gnum                            vertcol)    /* Column vertex index */
 {
-  Gnum              edgenum;
+  Genum             edgenum;
 
   if (typetax[vertcol] == VGRAPHSEPAESTYPEHC)     /* If vertex already traversed */
     return;
@@ -436,12 +436,12 @@ void
 vgraphSeparateEsCoverRow (
 const Gnum * restrict const           matetax,
 VgraphSeparateEsType * restrict const typetax,
-const Gnum * restrict const           verttax,
-const Gnum * restrict const           vendtax,
+const Genum * restrict const          verttax,
+const Genum * restrict const          vendtax,
 const Gnum * restrict const           edgetax,
 const Gnum                            vertrow)    /* Row vertex index */
 {
-  Gnum              edgenum;
+  Genum             edgenum;
 
   if (typetax[vertrow] == VGRAPHSEPAESTYPEVR)     /* If vertex already traversed */
     return;
@@ -507,9 +507,9 @@ const VgraphSeparateEsParam * const paraptr)      /*+ Method parameters +*/
       Gnum * restrict   actvnumtax;
       Gnum              actfronnum;
       Gnum              bipvelosum;
-      Gnum              bipedgenbr;               /* Number of edges in bipartite graph (i.e. arcs)   */
-      Gnum              bipedgenbr0;              /* Number of edges adjacent to part 0               */
-      Gnum              bipedgenbr1;              /* Number of edges adjacent to part 1               */
+      Genum             bipedgenbr;               /* Number of edges in bipartite graph (i.e. arcs)   */
+      Genum             bipedgenbr0;              /* Number of edges adjacent to part 0               */
+      Genum             bipedgenbr1;              /* Number of edges adjacent to part 1               */
       Gnum              bipvertnbr0;              /* Number of vertices in part 0                     */
       Gnum              bipvertnbr1;              /* Number of vertices in part 1                     */
       Gnum              bipvertnbrp;              /* Number of vertices in part put in first place    */
@@ -533,7 +533,7 @@ const VgraphSeparateEsParam * const paraptr)      /*+ Method parameters +*/
       for (actfronnum = 0; actfronnum < actgrafdat.fronnbr; actfronnum ++) { /* For all frontier vertices */
         Gnum              actvertnum;
         int               actpartval;
-        Gnum              actedgenum;
+        Genum             actedgenum;
 
         actvertnum = grafptr->frontab[actfronnum];
         actpartval = grafptr->parttax[actvertnum];
@@ -555,7 +555,7 @@ const VgraphSeparateEsParam * const paraptr)      /*+ Method parameters +*/
       bipgrafdat.vertnbr =
       bipgrafdat.vertnnd = bipvertnbr0 + bipvertnbr1;
       if (memAllocGroup ((void **) (void *)
-                         &bipgrafdat.verttax, (size_t) ((bipgrafdat.vertnbr + 1) * sizeof (Gnum)),
+                         &bipgrafdat.verttax, (size_t) ((bipgrafdat.vertnbr + 1) * sizeof (Genum)),
                          &bipgrafdat.velotax, (size_t) ((actgrafdat.s.velotax != NULL) ? (bipgrafdat.vertnbr * sizeof (Gnum)) : 0),
                          &bipgrafdat.vnumtax, (size_t) (bipgrafdat.vertnbr * sizeof (Gnum)),
                          &bipgrafdat.edgetax, (size_t) (bipedgenbr * sizeof (Gnum)), NULL) == NULL) {
@@ -571,6 +571,8 @@ const VgraphSeparateEsParam * const paraptr)      /*+ Method parameters +*/
       bipgrafdat.edlotax = NULL;
       bipgrafdat.edlosum = bipedgenbr;
       bipgrafdat.degrmax = grafptr->s.degrmax;
+      bipgrafdat.vconnbr = 0;
+      bipgrafdat.vcontax = NULL;
 
       bippartval = (bipvertnbr0 <= bipvertnbr1) ? 0 : 1; /* Select smallest part to be placed first */
       if (bippartval == 0) {
@@ -589,7 +591,7 @@ const VgraphSeparateEsParam * const paraptr)      /*+ Method parameters +*/
         Gnum              actvertnum;
         int               actpartval;
         Gnum              bipvertnum;
-        Gnum              actedgenum;
+        Genum             actedgenum;
 
         actvertnum = grafptr->frontab[actfronnum];
         actpartval = grafptr->parttax[actvertnum];
@@ -614,7 +616,7 @@ const VgraphSeparateEsParam * const paraptr)      /*+ Method parameters +*/
           actvertend = actgrafdat.s.edgetax[actedgenum];
           actpartend = grafptr->parttax[actvertend];
           if (actpartend != actpartval) {
-            Gnum              bipedgenum;
+            Genum             bipedgenum;
            
 #ifdef SCOTCH_DEBUG_VGRAPH2
             if (actvnumtax[actvertend] == ~0) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2014,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2014,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 27 nov 2021     **/
 /**                                 to   : 01 dec 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -179,8 +179,8 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   Gnum                            compsize1add;   /* Number of vertices to add to counters   */
   Gnum                            compsize1sub;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   GraphPart * restrict const  parttax = grafptr->parttax;
@@ -215,7 +215,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;                         /* Use hash table at 1/4 of its capacity */
 
-  if (((tablptr = gainTablInit (GAINMAX, VGRAPHSEPAFMGAINBITS)) == NULL) || /* Use logarithmic array only */
+  if (((tablptr = gainTablInit (GAINMAX, VGRAPHSEPAFMGAINBITS, GAINTABLTYPEFM, contextArena (grafptr->contptr))) == NULL) || /* Use logarithmic array only */
       (memAllocGroup ((void **) (void *)
                       &hashtab, (size_t) (hashsiz * sizeof (VgraphSeparateFmVertex)),
                       &savetab, (size_t) (hashsiz * sizeof (VgraphSeparateFmSave)), NULL) == NULL)) {
@@ -242,7 +242,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
     for (hashnum = (vertnum * VGRAPHSEPAFMHASHPRIME) & hashmsk; hashtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ;
 
     if (velotax != NULL) {                        /* If vertex loads present */
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                veloval;
       Gnum                compgain0;
       Gnum                compgain01;
@@ -266,7 +266,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
       hashtab[hashnum].compgain[1] = (compgain01 >> 1) - compgain0 - veloval;
     }
     else {                                        /* No vertex loads */
-      Gnum                edgenum;
+      Genum               edgenum;
       Gnum                compgain0;
       Gnum                compgain2;
 
@@ -375,7 +375,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
       Gnum                comploadabsdlt;
       int                 partval;                /* Part of current vertex */
       Gnum                vertnum;
-      Gnum                edgenum;
+      Genum               edgenum;
 
       partval = 0;                                /* Assume we point to gainlink0     */
       if (vexxptr->veloval >= 0) {                /* If in fact we point to gainlink1 */
@@ -878,7 +878,7 @@ const Gnum                                    comploaddlt)
     }
     else {                                        /* Separator vertex */
       Gnum                compload[3];
-      Gnum                edgenum;
+      Genum               edgenum;
 
       if (hashtab[hashnum].gainlink0.next == VGRAPHSEPAFMSTATEFREE) {
         errorPrint ("vgraphSeparateFmCheck: free separator vertex");
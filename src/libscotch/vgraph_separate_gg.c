@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 21 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -106,15 +106,15 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
   Gnum                              compsize1;
   Gnum                              compsize2;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   GraphPart * restrict const  parttax = grafptr->parttax;
   Gnum * restrict const       frontab = grafptr->frontab;
   const Gnum                  dwg0val = grafptr->dwgttab[0]; /* Part weights */
   const Gnum                  dwg1val = grafptr->dwgttab[1];
 
-  if (((tablptr = gainTablInit (GAIN_LINMAX, VGRAPHSEPAGGSUBBITS)) == NULL) || /* Use logarithmic array only */
+  if (((tablptr = gainTablInit (GAIN_LINMAX, VGRAPHSEPAGGSUBBITS, GAINTABLTYPELIST, NULL)) == NULL) || /* Use logarithmic array only */
       ((vexxtax = (VgraphSeparateGgVertex *) memAlloc (grafptr->s.vertnbr * sizeof (VgraphSeparateGgVertex))) == NULL)) {
     errorPrint ("vgraphSeparateGg: out of memory (1)");
     if (tablptr != NULL)
@@ -161,7 +161,7 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
         compgain2 = vendtax[vertnum] - verttax[vertnum] - 1;
       }
       else {                                      /* Graph vertices are weighted */
-        Gnum                        edgenum;
+        Genum                       edgenum;
 
         veloval   = velobax[vertnum];
         compgain2 = - veloval;
@@ -175,7 +175,7 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
       do {                                        /* While vertices can be retrieved */
         VgraphSeparateGgVertex *    sepaptr;      /* List of vertices in separator   */
         Gnum                        veloval;      /* Load of selected vertex         */
-        Gnum                        edgenum;
+        Genum                       edgenum;
         Gnum                        cmpldlt;      /* Temporary delta value */
 
         vertnum = (Gnum) (vexxptr - vexxtax);     /* Get number of selected vertex */
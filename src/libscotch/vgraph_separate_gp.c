@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2016,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2016,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -51,7 +51,7 @@
 /**                # Version 6.1  : from : 27 nov 2021     **/
 /**                                 to   : 27 nov 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,8 +92,8 @@ const VgraphSeparateGpParam * const paraptr)      /*+ Method parameters +*/
   Gnum                              compload2;
   Gnum                              comploaddlt;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   GraphPart * restrict const  parttax = grafptr->parttax;
@@ -137,7 +137,7 @@ const VgraphSeparateGpParam * const paraptr)      /*+ Method parameters +*/
       do {                                        /* Loop on vertices in queue */
         Gnum                vertnum;
         Gnum                distval;
-        Gnum                edgenum;
+        Genum               edgenum;
 
         vertnum = vgraphSeparateGpQueueGet (&queudat); /* Get vertex from queue */
         distval = vexxtax[vertnum].distval;       /* Get vertex distance        */
@@ -178,7 +178,7 @@ const VgraphSeparateGpParam * const paraptr)      /*+ Method parameters +*/
       Gnum                vertnum;
       Gnum                veloval;
       Gnum                distval;
-      Gnum                edgenum;
+      Genum               edgenum;
 
       vertnum = vgraphSeparateGpQueueGet (&queudat); /* Get vertex from queue */
       veloval = (velotax != NULL) ? velotax[vertnum] : 1;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2014,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2014,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 01 may 2014     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -60,6 +60,8 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_VGRAPH_SEPARATE_ST
+
 #include "module.h"
 #include "common.h"
 #include "gain.h"
@@ -218,6 +220,106 @@ StratTab                    vgraphseparateststratab = { /* Strategy tables for v
                               vgraphseparatestparatab,
                               vgraphseparatestcondtab };
 
+/**********************************************/
+/*                                            */
+/* These routines run the two branches of a   */
+/* selection operator in parallel.            */
+/*                                            */
+/**********************************************/
+
+/* This routine applies the strategy of the
+** given branch to its own copy of the
+** separation graph, within the given
+** sub-context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+vgraphSeparateSt2 (
+Context * restrict const                contptr,  /*+ (Sub-)context                          +*/
+const int                               spltnum,  /*+ Rank of sub-context in initial context +*/
+VgraphSeparateStSplit * restrict const  spltptr)
+{
+  Vgraph * restrict const grafptr = spltptr->splttab[spltnum].grafptr;
+  Context * const         contsav = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Assign new context to work graph */
+  spltptr->splttab[spltnum].revaval = vgraphSeparateSt (grafptr, spltptr->splttab[spltnum].straptr);
+  grafptr->contptr = contsav;
+}
+
+/* This routine runs concurrently the two
+** strategies of a selection operator, the
+** first one on the separation graph and the
+** second one on a copy of it, built from the
+** initial separator held in the given save
+** area. A strategy which fails yields the
+** initial separator as its result. On return,
+** the result of the first strategy is saved
+** in the other save area, and the separation
+** graph holds the result of the second one,
+** like in the sequential case.
+** It returns:
+** - 0 : if the strategies were run concurrently.
+** - 1 : if they have to be run sequentially.
+*/
+
+static
+int
+vgraphSeparateSt3 (
+Vgraph * restrict const       grafptr,            /*+ Separation graph                 +*/
+const Strat * restrict const  straptr,            /*+ Selection strategy               +*/
+VgraphStore * restrict const  savetab)            /*+ Save areas; initial state in [1] +*/
+{
+  Vgraph                grafdat;                  /* Copy of separation graph for second strategy */
+  VgraphSeparateStSplit spltdat;                  /* Parameters for context splitting              */
+
+  if (contextThreadNbr (grafptr->contptr) <= 1)   /* If context cannot be split, run in sequence */
+    return (1);
+
+  grafdat = *grafptr;                             /* Clone separation graph with its own partition arrays */
+  if (memAllocGroup ((void **) (void *)
+                     &grafdat.parttax, (size_t) (grafptr->s.vertnbr * sizeof (GraphPart)),
+                     &grafdat.frontab, (size_t) (grafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL)
+    return (1);                                   /* Not enough memory: fall back to sequential processing */
+  grafdat.parttax -= grafptr->s.baseval;
+  vgraphStoreUpdt (&grafdat, &savetab[1]);        /* Set initial separator */
+
+  spltdat.splttab[0].grafptr = grafptr;
+  spltdat.splttab[0].straptr = straptr->data.seledat.stratab[0];
+  spltdat.splttab[1].grafptr = &grafdat;
+  spltdat.splttab[1].straptr = straptr->data.seledat.stratab[1];
+
+  if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) vgraphSeparateSt2, &spltdat) != 0) {
+    memFree (grafdat.parttax + grafptr->s.baseval);
+    return (1);
+  }
+
+  if (spltdat.splttab[0].revaval != 0)            /* If first strategy didn't work */
+    vgraphStoreUpdt (grafptr, &savetab[1]);       /* Restore initial separator     */
+  vgraphStoreSave (grafptr, &savetab[0]);         /* Save result of first strategy */
+
+  if (spltdat.splttab[1].revaval != 0)            /* If second strategy didn't work  */
+    vgraphStoreUpdt (grafptr, &savetab[1]);       /* Restore initial separator as its result */
+  else {                                          /* Else get result of second strategy     */
+    grafptr->compload[0] = grafdat.compload[0];
+    grafptr->compload[1] = grafdat.compload[1];
+    grafptr->compload[2] = grafdat.compload[2];
+    grafptr->comploaddlt = grafdat.comploaddlt;
+    grafptr->compsize[0] = grafdat.compsize[0];
+    grafptr->compsize[1] = grafdat.compsize[1];
+    grafptr->fronnbr     = grafdat.fronnbr;
+    memCpy (grafptr->frontab, grafdat.frontab, grafdat.fronnbr * sizeof (Gnum));
+    memCpy (grafptr->parttax + grafptr->s.baseval, grafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+  }
+
+  memFree (grafdat.parttax + grafptr->s.baseval); /* Free group leader */
+
+  return (0);
+}
+
 /*******************************************/
 /*                                         */
 /* This is the generic separation routine. */
@@ -299,17 +401,22 @@ const Strat * restrict const  straptr)            /*+ Separation strategy +*/
         return (1);
       }
 
-      vgraphStoreSave (grafptr, &savetab[1]);     /* Save initial bipartition                                   */
-      if (vgraphSeparateSt (grafptr, straptr->data.seledat.stratab[0]) != 0) { /* If first strategy didn't work */
-        vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition                                */
-        vgraphStoreSave (grafptr, &savetab[0]);   /* Save it as result                                          */
-      }
-      else {                                      /* First strategy worked       */
-        vgraphStoreSave (grafptr, &savetab[0]);   /* Save its result             */
-        vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition */
+      vgraphStoreSave (grafptr, &savetab[1]);     /* Save initial bipartition */
+#ifndef VGRAPHSEPARATESTNOTHREAD
+      if (vgraphSeparateSt3 (grafptr, straptr, savetab) != 0) /* If both strategies could not be run concurrently */
+#endif /* VGRAPHSEPARATESTNOTHREAD */
+      {
+        if (vgraphSeparateSt (grafptr, straptr->data.seledat.stratab[0]) != 0) { /* If first strategy didn't work */
+          vgraphStoreUpdt (grafptr, &savetab[1]); /* Restore initial bipartition                                  */
+          vgraphStoreSave (grafptr, &savetab[0]); /* Save it as result                                            */
+        }
+        else {                                    /* First strategy worked       */
+          vgraphStoreSave (grafptr, &savetab[0]); /* Save its result             */
+          vgraphStoreUpdt (grafptr, &savetab[1]); /* Restore initial bipartition */
+        }
+        if (vgraphSeparateSt (grafptr, straptr->data.seledat.stratab[1]) != 0) /* If second strategy didn't work */
+          vgraphStoreUpdt (grafptr, &savetab[1]); /* Restore initial bipartition as its result                     */
       }
-      if (vgraphSeparateSt (grafptr, straptr->data.seledat.stratab[1]) != 0) /* If second strategy didn't work */
-        vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition as its result                 */
 
       compload2 = grafptr->s.velosum - savetab[0].compload[0] - savetab[0].compload[1]; /* Compute saved separator load */
       if ( (compload2 <  grafptr->compload[2]) || /* If first strategy is better */
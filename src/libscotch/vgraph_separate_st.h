@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 30 apr 2018     **/
 /**                                 to   : 30 apr 2018     **/
 /**                # Version 7.0  : from : 07 nov 2024     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -74,6 +74,20 @@ typedef enum VgraphSeparateStMethodType_ {
   VGRAPHSEPASTMETHNBR                             /*+ Number of methods        +*/
 } VgraphSeparateStMethodType;
 
+/*+ This structure holds the splitting
+    parameters for running concurrently
+    both branches of a selection operator. +*/
+
+typedef struct VgraphSeparateStSplit2_ {
+  Vgraph *                  grafptr;              /*+ Separation graph to work on +*/
+  const Strat *             straptr;              /*+ Strategy to apply           +*/
+  int                       revaval;              /*+ Return value of strategy    +*/
+} VgraphSeparateStSplit2;
+
+typedef struct VgraphSeparateStSplit_ {
+  VgraphSeparateStSplit2    splttab[2];           /*+ Data for both branches +*/
+} VgraphSeparateStSplit;
+
 /*+ Method function pointer type. +*/
 
 typedef int (* VgraphSeparateFunc) (Vgraph * restrict const, const void * const);
@@ -88,4 +102,9 @@ extern StratTab             vgraphseparateststratab;
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_VGRAPH_SEPARATE_ST
+static void                 vgraphSeparateSt2   (Context * restrict const, const int, VgraphSeparateStSplit * restrict const);
+static int                  vgraphSeparateSt3   (Vgraph * restrict const, const Strat * restrict const, VgraphStore * restrict const);
+#endif /* SCOTCH_VGRAPH_SEPARATE_ST */
+
 int                         vgraphSeparateSt    (Vgraph * const, const Strat * const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 27 nov 2021     **/
 /**                                 to   : 27 nov 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,8 +78,8 @@ Vgraph * const              grafptr)
   Gnum                fronnum;                    /* Number of current frontier vertex   */
   Gnum                commcut[3];                 /* Cut count array ([3] for halo)      */
 
-  const Gnum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax; /* Fast accesses */
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   Gnum * restrict const       frontab = grafptr->frontab;
   GraphPart *  restrict const parttax = grafptr->parttax;
@@ -87,7 +87,7 @@ Vgraph * const              grafptr)
   fronnbr = grafptr->fronnbr;                     /* Get current number of frontier vertices */
   for (fronnum = 0; fronnum < fronnbr; ) {
     Gnum                vertnum;
-    Gnum                edgenum;
+    Genum               edgenum;
 
     vertnum    = frontab[fronnum];                /* Get vertex number */
     commcut[0] =
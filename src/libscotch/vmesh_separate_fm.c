@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 05 dec 2021     **/
 /**                                 to   : 05 dec 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 30 aug 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -363,7 +363,7 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
   hashsiz = 4 * hashmax;
   hashmsk = hashsiz - 1;
 
-  if (((tablptr = gainTablInit (meshptr->m.vnlosum, VMESHSEPAFMGAINBITS)) == NULL) ||
+  if (((tablptr = gainTablInit (meshptr->m.vnlosum, VMESHSEPAFMGAINBITS, GAINTABLTYPELIST, NULL)) == NULL) ||
       (memAllocGroup ((void **) (void *)
                       &helmtab, (size_t) (hashsiz * sizeof (VmeshSeparateFmElement)),
                       &hnodtab, (size_t) (hashsiz * sizeof (VmeshSeparateFmNode)),
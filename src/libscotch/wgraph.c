@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 01 sep 2020     **/
 /**                                 to   : 02 dec 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -172,8 +172,8 @@ Wgraph * restrict const     grafptr)
   Gnum                vertnum;
 
   const Gnum * restrict const velotax  = grafptr->s.velotax;
-  const Gnum * restrict const verttax  = grafptr->s.verttax;
-  const Gnum * restrict const vendtax  = grafptr->s.vendtax;
+  const Genum * restrict const verttax  = grafptr->s.verttax;
+  const Genum * restrict const vendtax  = grafptr->s.vendtax;
   const Gnum * restrict const edgetax  = grafptr->s.edgetax;
   const Anum * restrict const parttax  = grafptr->parttax;
   Gnum * restrict const       compload = grafptr->compload;
@@ -201,7 +201,7 @@ Wgraph * restrict const     grafptr)
       compsize[partval] ++;
     }
     else {                                        /* Vertex is in separator */
-      Gnum                edgenum;
+      Genum               edgenum;
 
       frlosum += veloval;
 
@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 09 aug 2020     **/
 /**                                 to   : 02 dec 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -139,7 +139,7 @@ const Wgraph * const        grafptr)
     partnum = grafptr->parttax[vertnum];
 
     if (partnum == -1) {
-      Gnum                edgenum;
+      Genum               edgenum;
 
       frlosum += veloval;
       fronnbr ++;
@@ -1,4 +1,4 @@
-/* Copyright 2020,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2020,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.1  : from : 25 aug 2020     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 28 aug 2020     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,8 +82,8 @@ const WgraphPartEsParam * const paraptr)          /*+ Method parameters +*/
   Gnum                frlosum;
   Gnum                vertnum;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Gnum                  partnbr = grafptr->partnbr;
@@ -144,7 +144,7 @@ const WgraphPartEsParam * const paraptr)          /*+ Method parameters +*/
   for (fronnum = 0; fronnum < actgrafdat.fronnbr; fronnum ++) { /* Update part array to set frontier vertices as such */
     Gnum                vertnum;
     Gnum                veloval;
-    Gnum                edgenum;
+    Genum               edgenum;
 
     vertnum = grafptr->frontab[fronnum];
     veloval = (velotax != NULL) ? velotax[vertnum] : 1;
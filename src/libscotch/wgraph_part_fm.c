@@ -1,4 +1,4 @@
-/* Copyright 2007-2013,2018,2020,2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2013,2018,2020,2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 30 jul 2020     **/
 /**                                 to   : 18 dec 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 09 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -119,10 +119,10 @@ WgraphPartFmVertex * const            vexxptr)
   Gnum                linkidx;                    /* Index of first link structure for vertex                  */
   Gnum                gainval;
   Gnum                vertnum;
-  Gnum                edgenum;
+  Genum               edgenum;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   const Gnum * restrict const parttax = grafptr->parttax;
@@ -319,8 +319,8 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
   WgraphPartFmPartList * restrict nplstab;        /* Array of neighboring parts of frontier vertex */
   int                             o;
 
-  const Gnum * restrict const verttax = grafptr->s.verttax;
-  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Genum * restrict const verttax = grafptr->s.verttax;
+  const Genum * restrict const vendtax = grafptr->s.vendtax;
   const Gnum * restrict const velotax = grafptr->s.velotax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
   Gnum * restrict const       parttax = grafptr->parttax;
@@ -382,7 +382,7 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
 #endif /* SCOTCH_DEBUG_WGRAPH2 */
   savedat.savenbr = 0;                            /* No moves saved (yet) */
 
-  if (((tablptr = gainTablInit (GAINMAX, WGRAPHPARTFMGAINBITS)) == NULL) || /* Use logarithmic array only         */
+  if (((tablptr = gainTablInit (GAINMAX, WGRAPHPARTFMGAINBITS, GAINTABLTYPEFM, NULL)) == NULL) || /* Use logarithmic array only         */
       ((nplstab = memAlloc ((partnbr + 1) * sizeof (WgraphPartFmPartList))) == NULL) || /* TRICK: +1 for frontier */
       ((hashdat.hashtab = memAlloc (hashdat.hashsiz * sizeof (WgraphPartFmVertex))) == NULL) ||
       ((linkdat.linktab = memAlloc (linkdat.linksiz * sizeof (WgraphPartFmLink)))   == NULL) ||
@@ -511,7 +511,7 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
       Anum                  partnum;
       Anum                  pminnum;
       Anum                  partend;
-      Gnum                  edgenum;
+      Genum                 edgenum;
       Anum                  nplsidx;
       Gnum                  linknum;
 
@@ -1096,7 +1096,7 @@ const Gnum                                  cplosum)
     }
 
     if (partnum == -1) {
-      Gnum                edgenum;
+      Genum               edgenum;
 
       frlosum += veloval;
       fronnbr ++;
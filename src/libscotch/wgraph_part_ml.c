@@ -1,4 +1,4 @@
-/* Copyright 2007-2011,2014,2015,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2011,2014,2015,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 05 nov 2009     **/
 /**                                 to   : 16 aug 2015     **/
 /**                # Version 7.0  : from : 23 aug 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -144,8 +144,8 @@ const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode ar
   Gnum * restrict               finecompload;
   Gnum * restrict               finecompsize;
 
-  const Gnum * restrict const fineverttax = finegrafptr->s.verttax;
-  const Gnum * restrict const finevendtax = finegrafptr->s.vendtax;
+  const Genum * restrict const fineverttax = finegrafptr->s.verttax;
+  const Genum * restrict const finevendtax = finegrafptr->s.vendtax;
   const Gnum * restrict const fineedgetax = finegrafptr->s.edgetax;
 
   if ((finegrafptr->levlnum > 0) &&               /* If partition data not yet allocated */
@@ -221,7 +221,7 @@ const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode ar
     }
     else {                                        /* Fine vertex is in separator  */
       Gnum                finelistidx;            /* Index of first neighbor part */
-      Gnum                fineedgenum;
+      Genum               fineedgenum;
       Gnum                fineveloval;
 
       finelistidx = -1;                           /* No neighboring parts recorded yet          */
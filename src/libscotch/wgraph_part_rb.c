@@ -1,4 +1,4 @@
-/* Copyright 2010,2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 25 nov 2021     **/
 /**                # Version 7.0  : from : 23 aug 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code originally derived from     **/
 /**                  the code of kgraph_map_rb_part.c,     **/
@@ -309,7 +309,7 @@ const WgraphPartRbSplit * const spltptr)
     actgrafdat.s.vlbltax  = NULL;                 /* Vertex labels are no use           */
   }
   else {                                          /* If not the case, build induced subgraph */
-    if (graphInducePart (orggrafptr, orgparttax, indvertnbr, indpartval, &actgrafdat.s) != 0) {
+    if (graphInducePart2 (orggrafptr, orgparttax, indvertnbr, indpartval, &actgrafdat.s, NULL, contptr) != 0) {
       errorPrint ("wgraphPartRb2: cannot induce graph");
       goto abort;
     }
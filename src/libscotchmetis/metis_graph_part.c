@@ -1,4 +1,4 @@
-/* Copyright 2007-2012,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2012,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 20 jun 2021     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 11 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -271,7 +271,7 @@ const double * const        kbalval)
       free   (twintab);
       return (METIS_ERROR_MEMORY);
     }
-    for (i = 0; i < *nparts; i ++)                /* Gather first target constraint; only this one is used */
+    for (i = 0; i < *nparts; i ++)                /* Gather target weights of first constraint, which apply to all */
       twdbtab[i] = tpwgts[i * *ncon];
     _SCOTCH_METIS_doubleToInt (*nparts, twdbtab, twintab); /* Convert balance array to integers */
 
@@ -283,9 +283,14 @@ const double * const        kbalval)
   baseval = *numflag;
   vertnbr = *n;
 
-  o = 1;                                          /* Assume something will go wrong */
-  if (SCOTCH_graphBuild (&grafdat, baseval, vertnbr, xadj, xadj + 1, vwgt, NULL,
-                         xadj[vertnbr] - baseval, adjncy, adjwgt) == 0) {
+  if ((vwgt != NULL) && (ncon != NULL) && (*ncon > 1)) /* If multi-constraint vertex weights */
+    o = SCOTCH_graphBuildMulti (&grafdat, baseval, vertnbr, xadj, xadj + 1, *ncon, vwgt, NULL,
+                                xadj[vertnbr] - baseval, adjncy, adjwgt);
+  else
+    o = SCOTCH_graphBuild (&grafdat, baseval, vertnbr, xadj, xadj + 1, vwgt, NULL,
+                           xadj[vertnbr] - baseval, adjncy, adjwgt);
+  if (o == 0) {
+    o = 1;                                        /* Assume something will go wrong */
     SCOTCH_stratInit          (&stradat);
     SCOTCH_stratGraphMapBuild (&stradat, flagval, *nparts, *kbalval);
 #ifdef SCOTCH_DEBUG_ALL
@@ -1,4 +1,4 @@
-/* Copyright 2008-2010,2012,2018,2019,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008-2010,2012,2018,2019,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 13 sep 2012     **/
 /**                                 to   : 18 may 2019     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 13 dec 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -118,6 +118,76 @@ SCOTCH_Num * const          intetab)
   }
 }
 
+/* This routine folds the multi-constraint
+** vertex weights of the local vertices into
+** a single load per vertex, each constraint
+** being normalized with respect to its global
+** sum, so that all constraints weigh equally.
+** It returns:
+** - METIS_OK : on success.
+** - !0       : on error.
+*/
+
+static
+int
+_SCOTCH_ParMETIS_vconCombine (
+const SCOTCH_Num            vertlocnbr,
+const SCOTCH_Num            vconnbr,
+const SCOTCH_Num * const    vcontab,
+SCOTCH_Num * const          velotab,
+MPI_Comm                    proccomm)
+{
+  double *            vsumtab;                    /* Local and global constraint load sums */
+  double              vconmax;
+  double              targval;
+  SCOTCH_Num          vertlocnum;
+  SCOTCH_Num          vconnum;
+
+  if ((vsumtab = malloc (2 * vconnbr * sizeof (double))) == NULL)
+    return (METIS_ERROR_MEMORY);
+
+  for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+    vsumtab[vconnum] = 0.0;
+  for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) {
+    for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+      vsumtab[vconnum] += (double) vcontab[vertlocnum * vconnbr + vconnum];
+  }
+  if (MPI_Allreduce (vsumtab, vsumtab + vconnbr, vconnbr, MPI_DOUBLE, MPI_SUM, proccomm) != MPI_SUCCESS) {
+    free (vsumtab);
+    return (METIS_ERROR);
+  }
+
+  for (vconnum = 0, vconmax = 0.0; vconnum < vconnbr; vconnum ++) {
+    if (vsumtab[vconnbr + vconnum] > vconmax)
+      vconmax = vsumtab[vconnbr + vconnum];
+  }
+  targval = MIN (vconmax, (double) SCOTCH_NUMMAX / (double) (4 * vconnbr)); /* Keep combined load sum far from overflow */
+  for (vconnum = 0; vconnum < vconnbr; vconnum ++)
+    vsumtab[vconnum] = (vsumtab[vconnbr + vconnum] > 0.0) ? (targval / vsumtab[vconnbr + vconnum]) : 0.0;
+
+  for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) {
+    double              veloval;
+    SCOTCH_Num          velotmp;
+
+    for (vconnum = 0, veloval = 0.0; vconnum < vconnbr; vconnum ++)
+      veloval += (double) vcontab[vertlocnum * vconnbr + vconnum] * vsumtab[vconnum];
+
+    velotmp = (SCOTCH_Num) (veloval + 0.5);
+    if ((velotmp == 0) &&                         /* Vertices which bear some load must not be neglected */
+        ((veloval > 0.0) || (vconmax <= 0.0)))
+      velotmp = 1;
+    velotab[vertlocnum] = velotmp;
+  }
+
+  free (vsumtab);
+
+  return (METIS_OK);
+}
+
+/*
+**
+*/
+
 int
 SCOTCHMETISNAMES (ParMETIS_V3_PartKway) (
 const SCOTCH_Num * const    vtxdist,
@@ -127,7 +197,7 @@ SCOTCH_Num * const          vwgt,
 SCOTCH_Num * const          adjwgt,
 const SCOTCH_Num * const    wgtflag,
 const SCOTCH_Num * const    numflag,
-const SCOTCH_Num * const    ncon,                 /* Not used */
+const SCOTCH_Num * const    ncon,
 const SCOTCH_Num * const    nparts,
 const float * const         tpwgts,
 const float * const         ubvec,                /* Not used */
@@ -146,14 +216,31 @@ MPI_Comm *                  commptr)
   SCOTCH_Strat        stradat;
   SCOTCH_Num          vertlocnbr;
   SCOTCH_Num *        veloloctab;
+  SCOTCH_Num *        vcmbloctab;                 /* Combined vertex load array for multi-constraint graphs        */
   SCOTCH_Num          edgelocnbr;
   SCOTCH_Num *        edloloctab;
   SCOTCH_Num *        twintab;                    /* Integer array of target weights                               */
+  SCOTCH_Num          vconnbr;
   int                 o;
 
+  vconnbr = ((ncon != NULL) && (*ncon > 1)) ? *ncon : 1;
   if ((twintab = malloc (*nparts * sizeof (SCOTCH_Num))) == NULL)
     return (METIS_ERROR_MEMORY);
-  _SCOTCH_ParMETIS_floatToInt (*nparts, tpwgts, twintab);
+  if (vconnbr > 1) {                              /* If several constraints, target weights interleaved */
+    float *             twfltab;
+    SCOTCH_Num          i;
+
+    if ((twfltab = malloc (*nparts * sizeof (float))) == NULL) {
+      free (twintab);
+      return (METIS_ERROR_MEMORY);
+    }
+    for (i = 0; i < *nparts; i ++)                /* Gather target weights of first constraint, which apply to all */
+      twfltab[i] = tpwgts[i * vconnbr];
+    _SCOTCH_ParMETIS_floatToInt (*nparts, twfltab, twintab);
+    free (twfltab);
+  }
+  else
+    _SCOTCH_ParMETIS_floatToInt (*nparts, tpwgts, twintab);
 
   proccomm = *commptr;
   if (SCOTCH_dgraphInit (&grafdat, proccomm) != 0) {
@@ -169,6 +256,22 @@ MPI_Comm *                  commptr)
   veloloctab = ((vwgt   != NULL) && ((*wgtflag & 2) != 0)) ? vwgt   : NULL;
   edloloctab = ((adjwgt != NULL) && ((*wgtflag & 1) != 0)) ? adjwgt : NULL;
 
+  vcmbloctab = NULL;
+  if ((veloloctab != NULL) && (vconnbr > 1)) {    /* If multi-constraint vertex weights, fold them */
+    if ((vcmbloctab = malloc ((vertlocnbr + 1) * sizeof (SCOTCH_Num))) == NULL) {
+      SCOTCH_dgraphExit (&grafdat);
+      free (twintab);
+      return (METIS_ERROR_MEMORY);
+    }
+    if ((o = _SCOTCH_ParMETIS_vconCombine (vertlocnbr, vconnbr, veloloctab, vcmbloctab, proccomm)) != METIS_OK) {
+      free (vcmbloctab);
+      SCOTCH_dgraphExit (&grafdat);
+      free (twintab);
+      return (o);
+    }
+    veloloctab = vcmbloctab;
+  }
+
   *edgecut = 0;
   o = METIS_ERROR;                                /* Assume an error */
 
@@ -200,6 +303,8 @@ MPI_Comm *                  commptr)
   }
   SCOTCH_dgraphExit (&grafdat);
 
+  if (vcmbloctab != NULL)
+    free (vcmbloctab);
   free (twintab);
 
   if ((baseval != 0) &&                           /* MeTiS part array is based, unlike for Scotch */
@@ -228,7 +333,7 @@ const SCOTCH_Num * const    wgtflag,
 const SCOTCH_Num * const    numflag,
 const SCOTCH_Num * const    ndims,                /* Not used */
 const float * const         xyz,                  /* Not used */
-const SCOTCH_Num * const    ncon,                 /* Not used */
+const SCOTCH_Num * const    ncon,
 const SCOTCH_Num * const    nparts,
 const float * const         tpwgts,
 const float * const         ubvec,
@@ -258,7 +363,7 @@ SCOTCH_Num * const          vwgt,
 SCOTCH_Num * const          adjwgt,
 const SCOTCH_Num * const    wgtflag,
 const SCOTCH_Num * const    numflag,
-const SCOTCH_Num * const    ncon,                 /* Not used */
+const SCOTCH_Num * const    ncon,
 const SCOTCH_Num * const    nparts,
 const float * const         tpwgts,
 const float * const         ubvec,                /* Not used */
@@ -286,7 +391,7 @@ const SCOTCH_Num * const    wgtflag,
 const SCOTCH_Num * const    numflag,
 const SCOTCH_Num * const    ndims,                /* Not used */
 const float * const         xyz,                  /* Not used */
-const SCOTCH_Num * const    ncon,                 /* Not used */
+const SCOTCH_Num * const    ncon,
 const SCOTCH_Num * const    nparts,
 const float * const         tpwgts,
 const float * const         ubvec,
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2019,2023,2024 Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2019,2023,2024,2026 Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -62,7 +62,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 24 sep 2019     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 10 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -90,6 +90,8 @@ static const C_FormatInp    C_inpFormatTab[] = {  /* Table of input formats
                               { 'm',  SCOTCH_graphGeomLoadMmkt },
                               { 'S',  SCOTCH_graphGeomLoadScot },
                               { 's',  SCOTCH_graphGeomLoadScot },
+                              { 'N',  SCOTCH_graphGeomLoadBin },
+                              { 'n',  SCOTCH_graphGeomLoadBin },
                               { '\0', NULL } };
 
 static int                  C_outFormatType  = 4; /* Output graph format          */
@@ -101,6 +103,8 @@ static C_FormatOut          C_outFormatTab[] = {  /* Table of output formats
                               { 'm',  SCOTCH_graphGeomSaveMmkt },
                               { 'S',  SCOTCH_graphGeomSaveScot },
                               { 's',  SCOTCH_graphGeomSaveScot },
+                              { 'N',  SCOTCH_graphGeomSaveBin },
+                              { 'n',  SCOTCH_graphGeomSaveBin },
                               { '\0', NULL } };
 
 static int                  C_fileNum    = 0;     /* Number of file in arg list  */
@@ -116,10 +120,12 @@ static const char *         C_usageList[] = {
   "                  b  : Boeing-Harwell format (matrices)",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market format (edges, symmetrized)",
+  "                  n  : Scotch native binary format (adjacency)",
   "                  s  : Scotch v3.0 format (adjacency)",
   "  -o<format>  : Select output file format",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market symmetric pattern format (edges)",
+  "                  n  : Scotch native binary format (adjacency)",
   "                  s  : Scotch v3.0 format (adjacency)",
   "  -V          : Print program version and copyright",
   "",
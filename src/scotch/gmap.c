@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -68,7 +68,7 @@
 /**                # Version 6.0  : from : 29 may 2010     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 10 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -117,6 +117,10 @@ static const char *         C_usageList[] = {     /* Usage */
   "                 t  : enforce safety",
   "  -f<file>   : Fixed vertices input file",
   "  -h         : Display this help",
+  "  -l<opt>    : Stream graph file instead of loading it (only for gpart), with <opt>:",
+  "                 f  : use Fennel objective function (default)",
+  "                 l  : use linear deterministic greedy objective function",
+  "                 <n>: number of passes over graph file (default: 1)",
   "  -m<strat>  : Set mapping strategy (see user's manual)",
   "  -o         : Use partitioning with overlap (only for gpart)",
   "  -q         : Do graph clustering instead of graph partitioning (for gpart)",
@@ -164,6 +168,8 @@ char *                      argv[])
   int                   flagval;
   double                kbalval;                  /* Imbalance tolerance value      */
   double                emraval;                  /* Edge migration ratio           */
+  SCOTCH_Num            strmval;                  /* Streaming objective function   */
+  SCOTCH_Num            strmnbr;                  /* Number of streaming passes     */
   int                   i, j;
 
   flagval = C_FLAGNONE;                           /* Default behavior               */
@@ -171,6 +177,8 @@ char *                      argv[])
   emraval = 1;                                    /* Default edge migration ratio   */
   straval = 0;                                    /* No strategy flags              */
   straptr = NULL;
+  strmval = SCOTCH_STREAMFENNEL;                  /* Default streaming objective    */
+  strmnbr = 1;                                    /* Default number of passes       */
 
   vmlotab = NULL;
 
@@ -260,6 +268,29 @@ char *                      argv[])
         case 'h' :
           usagePrint (stdout, C_usageList);
           return     (EXIT_SUCCESS);
+        case 'L' :
+        case 'l' :                                /* Streaming partitioning parameters */
+          flagval |= C_FLAGSTREAM;
+          for (j = 2; argv[i][j] != '\0'; j ++) {
+            switch (argv[i][j]) {
+              case 'F' :
+              case 'f' :
+                strmval = SCOTCH_STREAMFENNEL;
+                break;
+              case 'L' :
+              case 'l' :
+                strmval = SCOTCH_STREAMLDG;
+                break;
+              default :
+                if ((argv[i][j] < '0') || (argv[i][j] > '9'))
+                  errorPrint ("main: invalid streaming option '%c' after '-l'", argv[i][j]);
+                if ((strmnbr = (SCOTCH_Num) atoi (&argv[i][j])) < 1)
+                  errorPrint ("main: invalid number of streaming passes");
+                while ((argv[i][j + 1] >= '0') && (argv[i][j + 1] <= '9'))
+                  j ++;
+            }
+          }
+          break;
         case 'M' :
         case 'm' :
           straptr = &argv[i][2];
@@ -360,6 +391,34 @@ char *                      argv[])
     fileBlockName (C_fileTab, 1) = "-";
   }
 
+  if ((flagval & C_FLAGSTREAM) != 0) {            /* If streaming partitioning wanted, graph is never loaded */
+    if ((flagval & C_FLAGPART) == 0)
+      errorPrint ("main: option '-l' only valid for graph partitioning");
+    if ((flagval & (C_FLAGPARTOVL | C_FLAGCLUSTER | C_FLAGFIXED | C_FLAGRMAPOLD | C_FLAGRMAPRAT | C_FLAGRMAPCST | C_FLAGVERBMAP)) != 0)
+      errorPrint ("main: option '-l' is exclusive of options '-f', '-o', '-q', '-r' and '-vm'");
+    if ((straval != 0) || (straptr != NULL) || (grafflag != 0))
+      errorPrint ("main: option '-l' is exclusive of options '-c', '-m' and '-s'");
+
+    fileBlockOpen (C_fileTab, C_FILENBR);         /* Open all files */
+
+    clockInit  (&runtime[1]);
+    clockStart (&runtime[1]);
+
+    SCOTCH_graphPartStream (C_filepntrsrcinp, C_filepntrmapout, (SCOTCH_Num) C_partNbr, strmnbr, kbalval, strmval);
+
+    clockStop (&runtime[1]);
+
+    if (flagval & C_FLAGVERBTIM)
+      fprintf (C_filepntrlogout, "T\tStreaming\t%g\n",
+               (double) clockVal (&runtime[1]));
+
+    fileBlockClose     (C_fileTab, C_FILENBR);
+    SCOTCH_stratExit   (&stradat);
+    SCOTCH_contextExit (&contdat);
+
+    return (EXIT_SUCCESS);
+  }
+
   fileBlockOpen (C_fileTab, C_FILENBR);           /* Open all files */
 
   clockInit  (&runtime[0]);
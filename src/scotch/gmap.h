@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2019 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2019,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,6 +64,8 @@
 /**                                 to   : 18 jul 2011     **/
 /**                # Version 6.0  : from : 29 may 2010     **/
 /**                                 to   : 24 sep 2019     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -105,3 +107,4 @@
 #define C_FLAGRMAPOLD               0x0100        /* Old mapping file           */
 #define C_FLAGRMAPRAT               0x0200        /* Edge migration ratio       */
 #define C_FLAGRMAPCST               0x0400        /* Vertex migration cost file */
+#define C_FLAGSTREAM                0x0800        /* Streaming partitioning     */
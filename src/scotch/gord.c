@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 30 oct 2019     **/
 /**                                 to   : 30 oct 2019     **/
 /**                # Version 7.0  : from : 23 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -100,6 +100,7 @@ static const char *         C_usageList[] = {
   "  -t<file>   : Save partitioning tree data to <file>",
   "  -V         : Print program version and copyright",
   "  -v<verb>   : Set verbose mode to <verb> :",
+  "                 f  : factorization information",
   "                 s  : strategy information",
   "                 t  : timing information",
   "",
@@ -213,6 +214,10 @@ char *                      argv[])
         case 'v' :                               /* Output control info */
           for (j = 2; argv[i][j] != '\0'; j ++) {
             switch (argv[i][j]) {
+              case 'F' :
+              case 'f' :
+                flagval |= C_FLAGVERBFAX;
+                break;
               case 'S' :
               case 's' :
                 flagval |= C_FLAGVERBSTR;
@@ -281,6 +286,15 @@ char *                      argv[])
     SCOTCH_stratSave (&stradat, C_filepntrlogout);
     putc ('\n', C_filepntrlogout);
   }
+  if (flagval & C_FLAGVERBFAX) {
+    double              nnzeval;
+    double              opcoval;
+
+    if (SCOTCH_graphOrderFactor (&cogrdat, &ordedat, NULL, NULL, &nnzeval, &opcoval) != 0)
+      errorPrint ("main: cannot compute factorization data");
+    fprintf (C_filepntrlogout, "O\tNNZ=%e\nO\tOPC=%e\n",
+             nnzeval, opcoval);
+  }
   if (flagval & C_FLAGVERBTIM) {
     fprintf (C_filepntrlogout, "T\tOrder\t\t%g\nT\tI/O\t\t%g\nT\tTotal\t\t%g\n",
              (double) clockVal (&runtime[1]),
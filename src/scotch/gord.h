@@ -47,6 +47,8 @@
 /**                                 to   : 27 dec 2004     **/
 /**                # Version 6.0  : from : 12 nov 2014     **/
 /**                                 to   : 12 nov 2014     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,3 +80,4 @@
 #define C_FLAGTREOUT                0x0002        /* Output separator tree data */
 #define C_FLAGVERBSTR               0x0004        /* Output strategy string     */
 #define C_FLAGVERBTIM               0x0008        /* Output timing information  */
+#define C_FLAGVERBFAX               0x0010        /* Output factorization data  */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,13 +50,7 @@
 /**                # Version 6.1  : from : 01 jun 2020     **/
 /**                                 to   : 14 jun 2020     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
-/**                                                        **/
-/**   NOTES      : # The cost analysis routine leaves the  **/
-/**                  memory management to malloc and free  **/
-/**                  because it is assumed to be the most  **/
-/**                  efficient to merge free blocks and    **/
-/**                  reallocate them.                      **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,9 +75,10 @@ static File                 C_fileTab[3] = {      /* File array
 
 static const char *         C_usageList[] = {
   "gotst [<input graph file> [<input ordering file> [<output data file>]]] <options>",
-  "  -h  : Display this help",
-  "  -v  : Do not account for vertex weights",
-  "  -V  : Print program version and copyright",
+  "  -h       : Display this help",
+  "  -p<nbr>  : Estimate factorization time on <nbr> cores",
+  "  -v       : Do not account for vertex weights",
+  "  -V       : Print program version and copyright",
   NULL };
 
 /*****************************/
@@ -99,19 +94,21 @@ char *                      argv[])
 {
   SCOTCH_Graph        grafdat;
   SCOTCH_Num          vertnbr;
-  SCOTCH_Num *        verttab;
-  SCOTCH_Num *        vendtab;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
   SCOTCH_Num *        velotab;
-  SCOTCH_Num          edgenbr;
+  SCOTCH_Edge         edgenbr;
   SCOTCH_Num *        edgetab;
   SCOTCH_Num          baseval;
   SCOTCH_Ordering     ordedat;
   SCOTCH_Num *        permtab;
   SCOTCH_Num *        peritab;
+  SCOTCH_Num          procnbr;
   int                 flagval;
   int                 i;
 
   flagval = C_FLAGNONE;                           /* Default behavior */
+  procnbr = 1;
 
   errorProg ("gotst");
 
@@ -135,6 +132,11 @@ char *                      argv[])
         case 'h' :
           usagePrint (stdout, C_usageList);
           return     (EXIT_SUCCESS);
+        case 'P' :                               /* Number of cores */
+        case 'p' :
+          if ((procnbr = atoi (&argv[i][2])) < 1)
+            errorPrint ("main: invalid number of cores '%s'", &argv[i][2]);
+          break;
         case 'v' :
           flagval |= C_FLAGNOVERT;
           break;
@@ -168,7 +170,7 @@ char *                      argv[])
   if (SCOTCH_graphOrderCheck (&grafdat, &ordedat) != 0)
     errorPrint ("main: invalid ordering");
 
-  factorView (baseval, vertnbr, verttab, velotab, edgenbr, edgetab, permtab, peritab, C_filepntrdatout);
+  factorView (&grafdat, &ordedat, baseval, vertnbr, velotab, peritab, procnbr, C_filepntrdatout);
 
   fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end eventual (un)compression tasks */
 
@@ -189,22 +191,27 @@ char *                      argv[])
 static
 int
 factorView (
+const SCOTCH_Graph * const    grafptr,
+const SCOTCH_Ordering * const ordeptr,
 const SCOTCH_Num              baseval,
 const SCOTCH_Num              vertnbr,
-const SCOTCH_Num * const      verttab,
 const SCOTCH_Num * const      velotab,
-const SCOTCH_Num              edgenbr,
-const SCOTCH_Num * const      edgetab,
-const SCOTCH_Num * const      permtab,
 const SCOTCH_Num * const      peritab,
+const SCOTCH_Num              procnbr,
 FILE * restrict const         stream)
 {
   FactorStat          statdat;                    /* Structure holding data for performing elimination tree statistics              */
   SCOTCH_Num *        ldadtab;                    /* Array of permuted indices of parent column in factored matrix                  */
   SCOTCH_Num *        lsontab;                    /* Array of permuted indices of first child column in factored matrix             */
   SCOTCH_Num *        lbrotab;                    /* Array of permuted indices of sibling column in factored matrix                 */
-  SCOTCH_Num *        fnnztab;                    /* Array of number of row indices, then of weighted factors, in factored matrix   */
-  double              fopcsum;                    /* Sum of OPC values for all independent elimination trees in factored matrix     */
+  SCOTCH_Num *        cntstab;                    /* Array of column counts in factored matrix                                      */
+  double *            cpthtab;                    /* Array of operation counts of heaviest paths from leaves to columns             */
+  double *            subttab;                    /* Array of operation counts of subtrees rooted at columns                        */
+  SCOTCH_Num *        proctab;                    /* Array of numbers of cores assigned to columns                                  */
+  double              cpthmax;                    /* Operation count of critical path of elimination tree                           */
+  SCOTCH_Num          rootnum;                    /* Index of first root column, roots being linked as siblings                     */
+  double              fnnzsum;                    /* Number of non-zeros in factored matrix                                         */
+  double              fopcsum;                    /* Operation count of factorization                                               */
   double              heigsum;                    /* Sum of branch heights for all independent elimination trees in factored matrix */
   SCOTCH_Num          fcolnum;                    /* Index of permuted column in factored matrix                                    */
   int                 o;
@@ -213,7 +220,10 @@ FILE * restrict const         stream)
                      &ldadtab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
                      &lsontab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
                      &lbrotab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
-                     &fnnztab, (size_t) (vertnbr * sizeof (SCOTCH_Num)), NULL) == NULL) {
+                     &cntstab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &proctab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &cpthtab, (size_t) (vertnbr * sizeof (double)),
+                     &subttab, (size_t) (vertnbr * sizeof (double)), NULL) == NULL) {
     errorPrint ("factorView: out of memory");
     return     (1);
   }
@@ -222,16 +232,29 @@ FILE * restrict const         stream)
   statdat.ldadtax = ldadtab - baseval;
   statdat.lsontax = lsontab - baseval;
   statdat.lbrotax = lbrotab - baseval;
-  statdat.fnnztax = fnnztab - baseval;
+  statdat.cntstax = cntstab - baseval;
 
-  if (factorView2 (baseval, vertnbr, verttab - baseval, statdat.velotax,
-                   edgetab - baseval, permtab - baseval, peritab - baseval,
-                   ldadtab - baseval, lsontab - baseval, lbrotab - baseval, fnnztab - baseval) != 0) {
-    errorPrint ("factorView: factored matrix too large");
+  if (SCOTCH_graphOrderFactor (grafptr, ordeptr, ldadtab, cntstab, &fnnzsum, &fopcsum) != 0) {
+    errorPrint ("factorView: cannot factor matrix");
     memFree    (ldadtab);                         /* Free group leader */
     return     (1);
   }
 
+  memSet (lsontab, ~0, vertnbr * sizeof (SCOTCH_Num)); /* Assume columns have no sons at all */
+  for (fcolnum = 0, rootnum = -1; fcolnum < vertnbr; fcolnum ++) { /* Link sons to their fathers */
+    SCOTCH_Num          dcolnum;
+
+    dcolnum = ldadtab[fcolnum];
+    if (dcolnum != -1) {
+      lbrotab[fcolnum] = lsontab[dcolnum - baseval];
+      lsontab[dcolnum - baseval] = fcolnum + baseval;
+    }
+    else {                                        /* Link roots together */
+      lbrotab[fcolnum] = rootnum;
+      rootnum = fcolnum + baseval;
+    }
+  }
+
   statdat.heigmin = SCOTCH_NUMMAX;
   statdat.heigmax =
   statdat.heignbr = 0;
@@ -242,22 +265,53 @@ FILE * restrict const         stream)
   }
   statdat.heigavg = heigsum / (double) statdat.heignbr;
   statdat.heigdlt = 0.0L;
-  statdat.fnnzsum = 0.0L;
-  fopcsum         = 0.0L;
   for (fcolnum = 0; fcolnum < vertnbr; fcolnum ++) { /* Get delta        */
     if (ldadtab[fcolnum] == -1)                   /* If column is a root */
-      factorView4 (&statdat, 1, fcolnum + baseval, &fopcsum);
+      factorView4 (&statdat, 1, fcolnum + baseval);
   }
   statdat.heigdlt /= (double) statdat.heignbr;
 
+  memSet (cpthtab, 0, vertnbr * sizeof (double)); /* Heaviest paths from sons are accumulated in fathers */
+  memSet (subttab, 0, vertnbr * sizeof (double));
+  for (fcolnum = 0, cpthmax = 0.0; fcolnum < vertnbr; fcolnum ++) { /* Fathers always come after sons */
+    SCOTCH_Num          dcolnum;
+    double              fopcval;
+
+    fopcval = factorViewOpc (&statdat, fcolnum + baseval);
+    cpthtab[fcolnum] += fopcval;
+    subttab[fcolnum] += fopcval;
+    dcolnum = ldadtab[fcolnum];
+    if (dcolnum != -1) {
+      if (cpthtab[dcolnum - baseval] < cpthtab[fcolnum])
+        cpthtab[dcolnum - baseval] = cpthtab[fcolnum];
+      subttab[dcolnum - baseval] += subttab[fcolnum];
+    }
+    else if (cpthmax < cpthtab[fcolnum])
+      cpthmax = cpthtab[fcolnum];
+  }
+
   o = (fprintf (stream, "O\tLeaf=" SCOTCH_NUMSTRING "\nO\tHeight min=" SCOTCH_NUMSTRING "\tmax=" SCOTCH_NUMSTRING "\tavg=%f\tdlt=%f (%5.2f)\n", /* Write tree height statistics */
                 (SCOTCH_Num) statdat.heignbr, (SCOTCH_Num) statdat.heigmin, (SCOTCH_Num) statdat.heigmax,
                 statdat.heigavg, statdat.heigdlt, ((statdat.heigdlt / statdat.heigavg) * (double) 100.0L)) == EOF);
 
   o |= (fprintf (stream, "O\tNNZ=%e\nO\tOPC=%e\n",
-                 statdat.fnnzsum,
+                 fnnzsum,
                  fopcsum) == EOF);
 
+  o |= (fprintf (stream, "O\tCPC=%e\nO\tPar=%f\n", /* Write critical path and tree parallelism */
+                 cpthmax,
+                 (cpthmax > 0.0) ? (fopcsum / cpthmax) : 1.0) == EOF);
+
+  if (procnbr > 1) {                              /* If time on several cores requested */
+    double              ftimval;
+
+    ftimval = factorView5 (&statdat, baseval, vertnbr, rootnum, procnbr, subttab - baseval, cpthtab - baseval, proctab - baseval);
+    o |= (fprintf (stream, "O\tTPC=%e\tproc=" SCOTCH_NUMSTRING "\nO\tSpeedup=%f\n",
+                   ftimval,
+                   (SCOTCH_Num) procnbr,
+                   (ftimval > 0.0) ? (fopcsum / ftimval) : 1.0) == EOF);
+  }
+
   if (o != 0)
     errorPrint ("factorView: bad output");
 
@@ -266,152 +320,139 @@ FILE * restrict const         stream)
   return (o);
 }
 
-/* This routine performs the symbolic factorization
-** and creates the elimination tree structure. Also,
-** it computes the (possibly weighted) sum of factors
-** for each permuted column.
+/* This routine returns the operation count
+** of a column, in the same model as OPC.
 */
 
 static
-int
-factorView2 (
-const SCOTCH_Num              baseval,
-const SCOTCH_Num              vertnbr,
-const SCOTCH_Num * const      verttax,
-const SCOTCH_Num * const      velotax,
-const SCOTCH_Num * const      edgetax,
-const SCOTCH_Num * const      permtax,
-const SCOTCH_Num * const      peritax,
-SCOTCH_Num * restrict         ldadtax,
-SCOTCH_Num * restrict         lsontax,
-SCOTCH_Num * restrict         lbrotax,
-SCOTCH_Num * restrict         fnnztax)
+double
+factorViewOpc (
+const FactorStat * restrict const statptr,
+SCOTCH_Num                        fcolnum)
 {
-  SCOTCH_Num * restrict         frowtab;          /* Array for sorting permuted row indices in column being factored */
-  SCOTCH_Num * restrict         fnxttab;          /* Index array for chaining permuted row indices in frowtab        */
-  SCOTCH_Num ** restrict        facttax;          /* Array of row index arrays for all factored colums to date       */
-  SCOTCH_Num                    vertnnd;
-  SCOTCH_Num                    pcolnum;
+  SCOTCH_Num              veloval;
 
-  memSet (lsontax + baseval, ~0, vertnbr * sizeof (SCOTCH_Num)); /* Assume columns have no sons at all */
+  veloval = (statptr->velotax != NULL) ? statptr->velotax[statptr->peritax[fcolnum]] : 1;
+  return ((double) statptr->cntstax[fcolnum] * (double) statptr->cntstax[fcolnum] * (double) veloval);
+}
 
-  if (memAllocGroup ((void **) (void *)
-                     &frowtab, (size_t) ((vertnbr + 1) * sizeof (SCOTCH_Num)),
-                     &fnxttab, (size_t) ((vertnbr + 1) * sizeof (SCOTCH_Num)),
-                     &facttax, (size_t) (vertnbr       * sizeof (SCOTCH_Num *)), NULL) == NULL) {
-    errorPrint ("factorView2: out of memory (1)");
-    return     (1);
-  }
-  memSet (facttax, 0, vertnbr * sizeof (SCOTCH_Num *)); /* Set all factored column pointers to NULL */
-  facttax -= baseval;
-
-  vertnnd = vertnbr + baseval;
-  for (pcolnum = baseval; pcolnum < vertnnd; pcolnum ++) { /* For all columns of the permuted matrix */
-    SCOTCH_Num *        fcoltab;
-    SCOTCH_Num *        fcolptr;
-    SCOTCH_Num          frownbr;
-    SCOTCH_Num          frowidx;
-    SCOTCH_Num          frowidd;
-    SCOTCH_Num          scolnum;
-    SCOTCH_Num          icolnum;                  /* Based non-permuted column index */
-    SCOTCH_Num          edgenum;
-    SCOTCH_Num          edgennd;
-    SCOTCH_Num          dcolnum;
+/* This routine estimates the time of the
+** factorization on a given number of cores,
+** expressed as an operation count, using
+** a proportional mapping of the elimination
+** tree: the cores of a column are shared
+** among its sons in proportion of the work
+** of their subtrees. Columns are processed
+** by all the cores that are assigned to them.
+** It returns:
+** - the estimated time : in all cases.
+*/
 
-    icolnum = peritax[pcolnum];                   /* Get the un-permuted index of the column */
+static
+double
+factorView5 (
+const FactorStat * restrict const statptr,
+const SCOTCH_Num                  baseval,
+const SCOTCH_Num                  vertnbr,
+const SCOTCH_Num                  rootnum,
+const SCOTCH_Num                  procnbr,
+const double * restrict const     subttax,
+double * restrict const           ftimtax,        /* Time of subtree, first holding sequential part */
+SCOTCH_Num * restrict const       proctax)
+{
+  SCOTCH_Num              fcolnum;
+  double                  ftimmax;
 
-    frownbr    = 1;                               /* Start array of factored terms for column   */
-    frowtab[0] = pcolnum;                         /* Add diagonal element as unmoveable starter */
-    for (edgenum = verttax[icolnum], edgennd = verttax[icolnum + 1]; edgenum < edgennd; edgenum ++) {
-      SCOTCH_Num          prownum;
+  memSet (proctax + baseval, 0, vertnbr * sizeof (SCOTCH_Num)); /* No cores assigned yet */
 
-      prownum = permtax[edgetax[edgenum]];        /* Get permuted row */
+  ftimmax = factorView6 (statptr, subttax, proctax, rootnum, procnbr); /* Share cores among roots */
+  for (fcolnum = baseval + vertnbr - 1; fcolnum >= baseval; fcolnum --) { /* Fathers always come before sons */
+    if (proctax[fcolnum] > 1)                     /* If column is processed in parallel            */
+      ftimtax[fcolnum] = (statptr->lsontax[fcolnum] != -1) ? factorView6 (statptr, subttax, proctax, statptr->lsontax[fcolnum], proctax[fcolnum]) : 0.0;
+  }
 
-      if (prownum >= pcolnum)                     /* Include only permuted row indices of higher rank (lower triangular matrix) */
-        frowtab[frownbr ++] = prownum;
-    }
-    intSort1asc1 (frowtab + 1, frownbr - 1);      /* Sort rows in ascending order */
-
-    frowtab[frownbr ++] = vertnnd;                /* Add trailer                   */
-    for (frowidx = 0; frowidx < (frownbr - 1); frowidx ++) /* Create initial links */
-      fnxttab[frowidx] = frowidx + 1;
-    frowidd = frowidx;                            /* Save index of trailer */
-
-    for (scolnum = lsontax[pcolnum]; scolnum != -1; scolnum = lbrotax[scolnum]) { /* For all son columns in elimination tree */
-      const SCOTCH_Num * restrict srowtab;        /* Array of factored indices for son column                                */
-      SCOTCH_Num                  srownbr;
-      SCOTCH_Num                  srowidx;
-      SCOTCH_Num                  frowidx;        /* Index of current factor in singly-linked list        */
-      SCOTCH_Num                  foldidx;        /* Index of before-current factor in singly-linked list */
-      SCOTCH_Num                  frownum;        /* Value of current factor in singly-linked list        */
-      SCOTCH_Num                  fnnzsum;
-
-      srowtab = facttax[scolnum];                 /* Point to array of factors for son column                    */
-      srownbr = fnnztax[scolnum];                 /* Get size of array                                           */
-      if (velotax != NULL)                        /* If needed, accumulate weight of first extra-diagonal factor */
-        fnnzsum = velotax[peritax[srowtab[0]]];
-
-      for (srowidx = 1, frowidx = 0, foldidx = -1, frownum = frowtab[frowidx];
-           srowidx < srownbr; srowidx ++) {
-        SCOTCH_Num                  srownum;
-
-        srownum = srowtab[srowidx];
-        if (velotax != NULL)                      /* If needed, accumulate loads before freeing factored son column */
-          fnnzsum += velotax[peritax[srownum]];
-
-        while (frownum < srownum) {               /* While factor to add not in place */
-          foldidx = frowidx;                      /* Skip to next position            */
-          frowidx = fnxttab[frowidx];
-          frownum = frowtab[frowidx];
-        }
-        if (srownum == frownum)                   /* If factor already in column, skip it */
-          continue;
-
-        frowtab[frownbr] = srownum;               /* Add new slot  */
-        fnxttab[frownbr] = frowidx;               /* Link new slot */
-        fnxttab[foldidx] = frownbr;
-        foldidx          = frownbr ++;
-      }
+  for (fcolnum = baseval; fcolnum < (baseval + vertnbr); fcolnum ++) { /* Sons always come before fathers */
+    SCOTCH_Num              dcolnum;
 
-      if (velotax != NULL)                        /* If needed, accumulate sum of extra-diagonal factors in column */
-        fnnztax[scolnum] = fnnzsum;
+    if (proctax[fcolnum] <= 1)                    /* Sequential subtrees already accounted for */
+      continue;
 
-      memFree (srowtab);                          /* Free now useless son factored column */
-#ifdef SCOTCH_DEBUG_ALL
-      facttax[scolnum] = NULL;
-#endif /* SCOTCH_DEBUG_ALL */
+    ftimtax[fcolnum] += factorViewOpc (statptr, fcolnum) / (double) proctax[fcolnum];
+    dcolnum = statptr->ldadtax[fcolnum];
+    if (dcolnum != -1) {
+      if (ftimtax[dcolnum] < ftimtax[fcolnum])
+        ftimtax[dcolnum] = ftimtax[fcolnum];
     }
+    else if (ftimmax < ftimtax[fcolnum])
+      ftimmax = ftimtax[fcolnum];
+  }
 
-    frownbr -= 2;                                 /* Remove markers from number of extra-diagonals */
-    fnnztax[pcolnum] = frownbr;                   /* Save number of extra-diagonals                */
-
-    if (frownbr <= 0) {                           /* If factored column has no extra-diagonals */
-      ldadtax[pcolnum] = -1;                      /* Column has no father                      */
-#ifdef SCOTCH_DEBUG_ALL
-      lbrotax[pcolnum] = -1;
-#endif /* SCOTCH_DEBUG_ALL */
-      continue;                                   /* Skip to next column without allocating or linking */
-    }
+  return (ftimmax);
+}
 
-    if ((fcoltab = memAlloc (frownbr * sizeof (SCOTCH_Num))) == NULL) { /* Allocate array for factored column */
-      errorPrint ("factorView2: out of memory (2)");
-      return     (1);
-    }
+/* This routine shares the given number of
+** cores among a list of sibling columns, in
+** proportion of the work of their subtrees,
+** by the largest remainder method. Subtrees
+** which receive at most one core form a pool
+** of sequential subtrees, which are shared
+** among the cores of the pool.
+** It returns:
+** - the time of the pool of subtrees
+**   processed sequentially : in all cases.
+*/
 
-    for (frowidx = fnxttab[0], fcolptr = fcoltab; frowidx != frowidd; frowidx = fnxttab[frowidx]) /* Fill factored array for column */
-      *fcolptr ++ = frowtab[frowidx];
+static
+double
+factorView6 (
+const FactorStat * restrict const statptr,
+const double * restrict const     subttax,
+SCOTCH_Num * restrict const       proctax,
+const SCOTCH_Num                  csonnum,
+const SCOTCH_Num                  procnbr)
+{
+  SCOTCH_Num              cbronum;
+  SCOTCH_Num              procsum;
+  SCOTCH_Num              poolnbr;
+  double                  subtsum;
+  double                  poolsum;
+  double                  poolmax;
+
+  for (cbronum = csonnum, subtsum = 0.0; cbronum != -1; cbronum = statptr->lbrotax[cbronum])
+    subtsum += subttax[cbronum];
+
+  for (cbronum = csonnum, procsum = 0; cbronum != -1; cbronum = statptr->lbrotax[cbronum]) {
+    proctax[cbronum] = (SCOTCH_Num) ((double) procnbr * subttax[cbronum] / subtsum);
+    procsum += proctax[cbronum];
+  }
+  for ( ; procsum < procnbr; procsum ++) {        /* Deal remaining cores to largest remainders */
+    SCOTCH_Num              cbrobst;
+    double                  rembst;
 
-    dcolnum = fcoltab[0];                         /* Get number of father, that it, first extra-diagonal */
-    ldadtax[pcolnum] = dcolnum;                   /* Link factored column to the separation tree         */
-    lbrotax[pcolnum] = lsontax[dcolnum];
-    lsontax[dcolnum] = pcolnum;
+    for (cbronum = csonnum, cbrobst = -1, rembst = 0.0; cbronum != -1; cbronum = statptr->lbrotax[cbronum]) {
+      double                  remval;
 
-    facttax[pcolnum] = fcoltab;                   /* Save factored array */
+      remval = (double) procnbr * subttax[cbronum] / subtsum - (double) proctax[cbronum];
+      if ((cbrobst == -1) || (remval > rembst)) {
+        cbrobst = cbronum;
+        rembst  = remval;
+      }
+    }
+    proctax[cbrobst] ++;
   }
 
-  memFree (frowtab);                              /* Free group leader */
+  for (cbronum = csonnum, poolnbr = 0, poolsum = poolmax = 0.0; cbronum != -1; cbronum = statptr->lbrotax[cbronum]) {
+    if (proctax[cbronum] > 1)                     /* Skip subtrees processed in parallel */
+      continue;
 
-  return (0);
+    poolnbr += proctax[cbronum];
+    poolsum += subttax[cbronum];
+    if (poolmax < subttax[cbronum])
+      poolmax = subttax[cbronum];
+    proctax[cbronum] = 1;                         /* Subtree is sequential */
+  }
+
+  return ((poolnbr > 0) ? MAX (poolsum / (double) poolnbr, poolmax) : (poolsum / (double) procnbr)); /* Pool without cores is processed by all cores */
 }
 
 /* This routine traverses the elimination tree from the root(s),
@@ -447,8 +488,9 @@ double * restrict const       hsumptr)
 
   *hsumptr += hsumtmp;
 }
+
 /* This routine traverses the elimination tree from the root(s),
-** so as to compute minimum, maximum, and sum of tree branches.
+** so as to compute the deviation of tree branches.
 */
 
 static
@@ -456,27 +498,14 @@ void
 factorView4 (
 FactorStat * restrict const   statptr,
 SCOTCH_Num                    levlnum,
-SCOTCH_Num                    fcolnum,
-double * restrict const       fopcptr)
+SCOTCH_Num                    fcolnum)
 {
-  SCOTCH_Num              veloval;
-  SCOTCH_Num              fnnztmp;
-  double                  fopctmp;
-
-  veloval = (statptr->velotax == NULL) ? 1 : statptr->velotax[statptr->peritax[fcolnum]];
-  fnnztmp = statptr->fnnztax[fcolnum] + veloval;  /* Get extra-diagonals, plus diagonal */
-  fopctmp = (double) (fnnztmp * veloval);
-  statptr->fnnzsum += fopctmp;
-  fopctmp *= (double) fnnztmp;
-
   if (statptr->lsontax[fcolnum] != -1) {          /* If node has descendants */
     SCOTCH_Num              csonnum;
 
     for (csonnum = statptr->lsontax[fcolnum]; csonnum != -1; csonnum = statptr->lbrotax[csonnum])
-      factorView4 (statptr, levlnum + 1, csonnum, &fopctmp); /* Accumulate OPC on local sum */
+      factorView4 (statptr, levlnum + 1, csonnum);
   }
   else
     statptr->heigdlt += fabs ((double) levlnum - statptr->heigavg);
-
-  *fopcptr += fopctmp;                            /* Aggregate local sum at higher level */
 }
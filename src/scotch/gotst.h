@@ -47,6 +47,8 @@
 /**                                 to   : 12 nov 2014     **/
 /**                # Version 6.1  : from : 01 jun 2020     **/
 /**                                 to   : 14 jun 2020     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,20 +94,21 @@ typedef struct FactorStat_ {
   const SCOTCH_Num *      ldadtax;                /*+ Array of permuted indices of parent column                                    +*/
   const SCOTCH_Num *      lsontax;                /*+ Array of permuted indices of first child column                               +*/
   const SCOTCH_Num *      lbrotax;                /*+ Array of permuted indices of sibling column                                   +*/
+  const SCOTCH_Num *      cntstax;                /*+ Array of column counts                                                        +*/
   SCOTCH_Num              heigmin;
   SCOTCH_Num              heigmax;
   SCOTCH_Num              heignbr;
   double                  heigavg;
   double                  heigdlt;
-  const SCOTCH_Num *      fnnztax;                /*+ Array of number of factored rows, then sum of vertex weights of factored rows +*/
-  double                  fnnzsum;
 } FactorStat;
 
 /*
 **  The function prototypes.
 */
 
-static int                  factorView          (const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, FILE * restrict const);
-static int                  factorView2         (const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, SCOTCH_Num * restrict, SCOTCH_Num * restrict, SCOTCH_Num * restrict, SCOTCH_Num * restrict);
+static int                  factorView          (const SCOTCH_Graph * const, const SCOTCH_Ordering * const, const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num, FILE * restrict const);
+static double               factorViewOpc       (const FactorStat * restrict const, SCOTCH_Num);
+static double               factorView5         (const FactorStat * restrict const, const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num, const double * restrict const, double * restrict const, SCOTCH_Num * restrict const);
+static double               factorView6         (const FactorStat * restrict const, const double * restrict const, SCOTCH_Num * restrict const, const SCOTCH_Num, const SCOTCH_Num);
 static void                 factorView3         (FactorStat * restrict const, SCOTCH_Num, SCOTCH_Num, double * restrict const);
-static void                 factorView4         (FactorStat * restrict const, SCOTCH_Num, SCOTCH_Num, double * restrict const);
+static void                 factorView4         (FactorStat * restrict const, SCOTCH_Num, SCOTCH_Num);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2014,2024,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2014,2024,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.0  : from : 12 nov 2014     **/
 /**                                 to   : 12 nov 2014     **/
 /**                # Version 7.0  : from : 10 sep 2024     **/
-/**                                 to   : 13 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -102,10 +102,10 @@ typedef struct C_Graph_ {
   SCOTCH_Graph              grafdat;              /*+ Source graph data  +*/
   SCOTCH_Num                baseval;              /*+ Base value         +*/
   SCOTCH_Num                vertnbr;              /*+ Number of vertices +*/
-  SCOTCH_Num *              verttax;              /*+ Vertex array       +*/
-  SCOTCH_Num *              vendtax;              /*+ Vertex end array   +*/
+  SCOTCH_Edge *             verttax;              /*+ Vertex array       +*/
+  SCOTCH_Edge *             vendtax;              /*+ Vertex end array   +*/
   SCOTCH_Num *              vlbltab;              /*+ Vertex label array +*/
-  SCOTCH_Num                edgenbr;              /*+ Number of edges    +*/
+  SCOTCH_Edge               edgenbr;              /*+ Number of edges    +*/
   SCOTCH_Num *              edgetax;              /*+ Edge array         +*/
 } C_Graph;
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2012,2018,2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2012,2018,2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.1  : from : 04 apr 2021     **/
 /**                                 to   : 28 aug 2021     **/
 /**                # Version 7.0  : from : 31 aug 2021     **/
-/**                                 to   : 13 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -275,8 +275,8 @@ FILE * const                fileptr)              /* Output stream
 
   const SCOTCH_Num                  baseval = grafptr->baseval;
   const SCOTCH_Num                  vertnnd = grafptr->vertnbr + grafptr->baseval;
-  const SCOTCH_Num * restrict const verttax = grafptr->verttax;
-  const SCOTCH_Num * restrict const vendtax = grafptr->vendtax;
+  const SCOTCH_Edge * restrict const verttax = grafptr->verttax;
+  const SCOTCH_Edge * restrict const vendtax = grafptr->vendtax;
   const SCOTCH_Num * restrict const edgetax = grafptr->edgetax;
   const C_GeoVert * restrict const  coortax = geomptr->coortab - baseval;
   const SCOTCH_Num * restrict const parttax = mappptr->labltab - baseval;
@@ -301,8 +301,8 @@ FILE * const                fileptr)              /* Output stream
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) { /* For all vertices */
     SCOTCH_Num          pathnbr;
     SCOTCH_Num          partval;
-    SCOTCH_Num          edgennd;
-    SCOTCH_Num          edgenum;
+    SCOTCH_Edge         edgennd;
+    SCOTCH_Edge         edgenum;
 
     partval = parttax[vertnum];
     edgenum = verttax[vertnum];
@@ -334,8 +334,8 @@ FILE * const                fileptr)              /* Output stream
     do {                                          /* Build path from current vertex */
       SCOTCH_Num          parttmp;
       SCOTCH_Num          vertend;
-      SCOTCH_Num          edgennd;
-      SCOTCH_Num          edgetmp;
+      SCOTCH_Edge         edgennd;
+      SCOTCH_Edge         edgetmp;
 
       parttmp = parttax[verttmp];
       edgetmp = pathtax[verttmp].edgenum;
@@ -439,8 +439,8 @@ FILE * const                fileptr)              /* Output stream
 
   const SCOTCH_Num                  baseval = grafptr->baseval;
   const SCOTCH_Num                  vertnnd = grafptr->vertnbr + grafptr->baseval;
-  const SCOTCH_Num * restrict const verttax = grafptr->verttax;
-  const SCOTCH_Num * restrict const vendtax = grafptr->vendtax;
+  const SCOTCH_Edge * restrict const verttax = grafptr->verttax;
+  const SCOTCH_Edge * restrict const vendtax = grafptr->vendtax;
   const SCOTCH_Num * restrict const edgetax = grafptr->edgetax;
   const SCOTCH_Num * restrict const labltax = mappptr->labltab - baseval;
 
@@ -494,8 +494,8 @@ FILE * const                fileptr)              /* Output stream
 
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
     SCOTCH_Num          colunum;
-    SCOTCH_Num          edgennd;
-    SCOTCH_Num          edgenum;
+    SCOTCH_Edge         edgennd;
+    SCOTCH_Edge         edgenum;
 
     colunum = (labltax[vertnum] == ~0) ? vertnum : labltax[vertnum];
 
@@ -564,8 +564,8 @@ FILE * const                fileptr)              /* Output stream
 
   const SCOTCH_Num                  baseval = grafptr->baseval;
   const SCOTCH_Num                  vertnnd = grafptr->vertnbr + grafptr->baseval;
-  const SCOTCH_Num * restrict const verttax = grafptr->verttax;
-  const SCOTCH_Num * restrict const vendtax = grafptr->vendtax;
+  const SCOTCH_Edge * restrict const verttax = grafptr->verttax;
+  const SCOTCH_Edge * restrict const vendtax = grafptr->vendtax;
   const SCOTCH_Num * restrict const edgetax = grafptr->edgetax;
   const C_GeoVert * restrict const  coortax = geomptr->coortab - baseval;
   const SCOTCH_Num * restrict const parttax = mappptr->labltab - baseval;
@@ -601,8 +601,8 @@ FILE * const                fileptr)              /* Output stream
   if (O_outParam.PosMesh.clipval == 'l') {        /* If clipping encompasses disks */
     for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
       double              sradmin;                /* Minimum square of circle radius */
-      SCOTCH_Num          edgennd;
-      SCOTCH_Num          edgenum;
+      SCOTCH_Edge         edgennd;
+      SCOTCH_Edge         edgenum;
 
       sradmin = 1e30;                             /* Assume a huge square of radius */
       for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
@@ -671,8 +671,8 @@ FILE * const                fileptr)              /* Output stream
   if (O_outParam.PosMesh.diskval == 'd') {        /* If disks wanted */
     for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
       double              sradmin;                /* Minimum square of circle radius */
-      SCOTCH_Num          edgennd;
-      SCOTCH_Num          edgenum;
+      SCOTCH_Edge         edgennd;
+      SCOTCH_Edge         edgenum;
 
       sradmin = 1e30;                             /* Assume huge square of radius */
       for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
@@ -736,8 +736,8 @@ FILE * const                fileptr)              /* Output stream
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) { /* For all vertices */
     SCOTCH_Num          pathnbr;
     SCOTCH_Num          partval;
-    SCOTCH_Num          edgennd;
-    SCOTCH_Num          edgenum;
+    SCOTCH_Edge         edgennd;
+    SCOTCH_Edge         edgenum;
 
     partval = parttax[vertnum];
     edgenum = verttax[vertnum];
@@ -770,8 +770,8 @@ FILE * const                fileptr)              /* Output stream
     do {                                          /* Build path from current vertex */
       SCOTCH_Num          parttmp;
       SCOTCH_Num          vertend;
-      SCOTCH_Num          edgennd;
-      SCOTCH_Num          edgetmp;
+      SCOTCH_Edge         edgennd;
+      SCOTCH_Edge         edgetmp;
 
       parttmp = parttax[verttmp];
       edgetmp = pathtax[verttmp].edgenum;
@@ -915,8 +915,8 @@ FILE * const                fileptr)              /* Output stream
 
   const SCOTCH_Num                  baseval = grafptr->baseval;
   const SCOTCH_Num                  vertnnd = grafptr->vertnbr + grafptr->baseval;
-  const SCOTCH_Num * restrict const verttax = grafptr->verttax;
-  const SCOTCH_Num * restrict const vendtax = grafptr->vendtax;
+  const SCOTCH_Edge * restrict const verttax = grafptr->verttax;
+  const SCOTCH_Edge * restrict const vendtax = grafptr->vendtax;
   const SCOTCH_Num * restrict const edgetax = grafptr->edgetax;
   const C_GeoVert * restrict const  coortax = geomptr->coortab - baseval;
   const SCOTCH_Num * restrict const parttax = mappptr->labltab - baseval;
@@ -949,8 +949,8 @@ FILE * const                fileptr)              /* Output stream
            vertnum);
 
   for (vertnum = baseval, edgeidx = 0; vertnum < vertnnd; vertnum ++) {
-    SCOTCH_Num          edgennd;
-    SCOTCH_Num          edgenum;
+    SCOTCH_Edge         edgennd;
+    SCOTCH_Edge         edgenum;
 
     for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
       SCOTCH_Num          vertend;
@@ -1002,8 +1002,8 @@ FILE * const                fileptr)              /* Output stream
     fprintf (fileptr, "\n");
     c = '\n';
     for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
-      SCOTCH_Num          edgenum;
-      SCOTCH_Num          edgennd;
+      SCOTCH_Edge         edgenum;
+      SCOTCH_Edge         edgennd;
       double              sradmin;                /* Minimum square value of disk radius */
       double              dradmin;
 
@@ -1062,8 +1062,8 @@ FILE * const                fileptr)              /* Output stream
 
   const SCOTCH_Num                  baseval = grafptr->baseval;
   const SCOTCH_Num                  vertnnd = grafptr->vertnbr + grafptr->baseval;
-  const SCOTCH_Num * restrict const verttax = grafptr->verttax;
-  const SCOTCH_Num * restrict const vendtax = grafptr->vendtax;
+  const SCOTCH_Edge * restrict const verttax = grafptr->verttax;
+  const SCOTCH_Edge * restrict const vendtax = grafptr->vendtax;
   const SCOTCH_Num * restrict const edgetax = grafptr->edgetax;
   const C_GeoVert * restrict const  coortax = geomptr->coortab - baseval;
   const SCOTCH_Num * restrict const parttax = mappptr->labltab - baseval;
@@ -1086,8 +1086,8 @@ FILE * const                fileptr)              /* Output stream
   for (vertnum = baseval; vertnum < vertnnd; vertnum ++) { /* For all vertices */
     SCOTCH_Num          pathnbr;
     SCOTCH_Num          partval;
-    SCOTCH_Num          edgennd;
-    SCOTCH_Num          edgenum;
+    SCOTCH_Edge         edgennd;
+    SCOTCH_Edge         edgenum;
 
     partval = parttax[vertnum];
     edgenum = verttax[vertnum];
@@ -1122,8 +1122,8 @@ FILE * const                fileptr)              /* Output stream
     do {                                          /* Build path from current vertex  */
       SCOTCH_Num          parttmp;
       SCOTCH_Num          vertend;
-      SCOTCH_Num          edgennd;
-      SCOTCH_Num          edgetmp;
+      SCOTCH_Edge         edgennd;
+      SCOTCH_Edge         edgetmp;
 
       parttmp = parttax[verttmp];
       edgetmp = pathtax[verttmp].edgenum;
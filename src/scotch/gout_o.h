@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 28 aug 2021     **/
 /**                                 to   : 28 aug 2021     **/
 /**                # Version 7.0  : from : 13 jul 2025     **/
-/**                                 to   : 13 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -141,14 +141,14 @@ typedef struct O_OutParam_ {
 
 typedef struct O_InvMeshPath_ {
   SCOTCH_Num                pathnbr;              /*+ Number of output paths     +*/
-  SCOTCH_Num                edgenum;              /*+ Index from which to search +*/
+  SCOTCH_Edge               edgenum;              /*+ Index from which to search +*/
 } O_InvMeshPath;
 
 /*+ The PostScript path array element. +*/
 
 typedef struct O_PosMeshPath_ {
   SCOTCH_Num                pathnbr;              /*+ Number of output paths     +*/
-  SCOTCH_Num                edgenum;              /*+ Index from which to search +*/
+  SCOTCH_Edge               edgenum;              /*+ Index from which to search +*/
 } O_PosMeshPath;
 
 /*+ The PostScript mesh graph vertex. +*/
@@ -164,7 +164,7 @@ typedef struct O_PosMeshVertex_ {
 
 typedef struct O_VtkMeshPath_ {
   SCOTCH_Num                pathnbr;              /*+ Number of output paths     +*/
-  SCOTCH_Num                edgenum;              /*+ Index from which to search +*/
+  SCOTCH_Edge               edgenum;              /*+ Index from which to search +*/
 } O_VtkMeshPath;
 
 /*
@@ -0,0 +1,382 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : mpart.c                                 **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : Part of a mesh partitioning software.   **/
+/**                This module contains the main function. **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "scotch.h"
+#include "mpart.h"
+
+/*
+**  The static and global definitions.
+*/
+
+static int                  C_partNbr = 2;        /* Default number of parts */
+static int                  C_paraNum = 0;        /* Number of parameters    */
+static int                  C_paraNbr = 1;        /* Number of parameters    */
+static int                  C_fileNum = 0;        /* Number of file in arg list */
+static File                 C_fileTab[C_FILENBR] = { /* File array              */
+                              { FILEMODER },
+                              { FILEMODEW },
+                              { FILEMODEW } };
+
+static const char *         C_usageList[] = {
+  "mpart [<nparts>] [<input source mesh file> [<output partition file> [<output log file>]]] <options>",
+  "  -b<val>    : Load imbalance tolerance (default: 0.05)",
+  "  -c<opt>    : Choose default partitioning strategy according to one or several of <opt>:",
+  "                 q  : privilege quality over speed (default)",
+  "                 s  : privilege speed over quality",
+  "  -h         : Display this help",
+  "  -m<strat>  : Use mesh partitioning strategy <strat> (see user's manual)",
+  "               (see default strategy with option '-vs')",
+  "  -V         : Print program version and copyright",
+  "  -v<verb>   : Set verbose mode to <verb> :",
+  "                 m  : partition information",
+  "                 s  : strategy information",
+  "                 t  : timing information",
+  NULL };
+
+/******************************/
+/*                            */
+/* Partition quality display. */
+/*                            */
+/******************************/
+
+/* This routine computes and writes the
+** element load distribution of the given
+** partition, as well as its connectivity
+** cost, that is, the sum over all nodes
+** of their load times their number of
+** spanned parts minus one.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+C_partView (
+const SCOTCH_Mesh * const   meshptr,
+const SCOTCH_Num            partnbr,
+const SCOTCH_Num * const    parttab,
+FILE * const                stream)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          velmbas;
+  SCOTCH_Num          vnodbas;
+  SCOTCH_Num          velmnbr;
+  SCOTCH_Num          vnodnbr;
+  SCOTCH_Edge *       verttab;
+  SCOTCH_Edge *       vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        vnlotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        compload;                   /* Load of every part                 */
+  SCOTCH_Num *        flagtab;                    /* Last node having flagged each part */
+  SCOTCH_Num          loadmin;
+  SCOTCH_Num          loadmax;
+  SCOTCH_Num          loadsum;
+  double              loadavg;
+  SCOTCH_Num          commload;                   /* Connectivity (lambda - 1) cost */
+  SCOTCH_Num          cutnbr;                     /* Number of cut nodes            */
+  SCOTCH_Num          velmnum;
+  SCOTCH_Num          vnodnum;
+  SCOTCH_Num          partnum;
+
+  SCOTCH_meshData (meshptr, &velmbas, &vnodbas, &velmnbr, &vnodnbr,
+                   &verttab, &vendtab, &velotab, &vnlotab, NULL, NULL, &edgetab, NULL);
+  baseval = MIN (velmbas, vnodbas);
+
+  if (memAllocGroup ((void **) (void *)
+                     &compload, (size_t) (partnbr * sizeof (SCOTCH_Num)),
+                     &flagtab,  (size_t) (partnbr * sizeof (SCOTCH_Num)), NULL) == NULL) {
+    errorPrint ("C_partView: out of memory");
+    return;
+  }
+  memSet (compload, 0, partnbr * sizeof (SCOTCH_Num));
+  memSet (flagtab, ~0, partnbr * sizeof (SCOTCH_Num));
+
+  for (velmnum = 0; velmnum < velmnbr; velmnum ++)
+    compload[parttab[velmnum]] += (velotab != NULL) ? velotab[velmnum] : 1;
+
+  for (partnum = 0, loadsum = 0, loadmin = SCOTCH_NUMMAX, loadmax = 0; partnum < partnbr; partnum ++) {
+    loadsum += compload[partnum];
+    if (compload[partnum] < loadmin)
+      loadmin = compload[partnum];
+    if (compload[partnum] > loadmax)
+      loadmax = compload[partnum];
+  }
+  loadavg = (double) loadsum / (double) partnbr;
+
+  for (vnodnum = 0, commload = cutnbr = 0; vnodnum < vnodnbr; vnodnum ++) {
+    SCOTCH_Num          vertnum;
+    SCOTCH_Edge         edgenum;
+    SCOTCH_Num          spannbr;
+
+    vertnum = vnodnum + vnodbas - baseval;        /* Un-based index of node vertex */
+    for (edgenum = verttab[vertnum], spannbr = 0; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          partend;
+
+      partend = parttab[edgetab[edgenum - baseval] - velmbas];
+      if (flagtab[partend] != vnodnum) {          /* If part not yet spanned by node */
+        flagtab[partend] = vnodnum;
+        spannbr ++;
+      }
+    }
+    if (spannbr > 1) {
+      commload += (spannbr - 1) * ((vnlotab != NULL) ? vnlotab[vnodnum] : 1);
+      cutnbr ++;
+    }
+  }
+
+  fprintf (stream, "M\tParts " SCOTCH_NUMSTRING "\n",
+           (SCOTCH_Num) partnbr);
+  fprintf (stream, "M\tLoad min=" SCOTCH_NUMSTRING "\tmax=" SCOTCH_NUMSTRING "\tavg=%g\tmaxavg=%g\n",
+           (SCOTCH_Num) loadmin,
+           (SCOTCH_Num) loadmax,
+           loadavg,
+           (double) loadmax / loadavg);
+  fprintf (stream, "M\tCommVol=" SCOTCH_NUMSTRING "\tCutNodes=" SCOTCH_NUMSTRING "\n",
+           (SCOTCH_Num) commload,
+           (SCOTCH_Num) cutnbr);
+
+  memFree (compload);                             /* Free group leader */
+}
+
+/******************************/
+/*                            */
+/* This is the main function. */
+/*                            */
+/******************************/
+
+int
+main (
+int                         argc,
+char *                      argv[])
+{
+  SCOTCH_Mesh         meshdat;                    /* Source mesh        */
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          velmbas;
+  SCOTCH_Num          vnodbas;
+  SCOTCH_Num          velmnbr;
+  SCOTCH_Num *        vlbltab;
+  SCOTCH_Num *        parttab;                    /* Element part array */
+  SCOTCH_Strat        stradat;                    /* Partitioning strategy */
+  SCOTCH_Num          straval;
+  char *              straptr;
+  double              kbalval;
+  int                 flagval;
+  Clock               runtime[2];                 /* Timing variables  */
+  SCOTCH_Num          velmnum;
+  int                 i, j;
+
+  errorProg ("mpart");
+
+  if ((argc >= 2) && (argv[1][0] == '?')) {       /* If need for help */
+    usagePrint (stdout, C_usageList);
+    return     (EXIT_SUCCESS);
+  }
+
+  flagval = C_FLAGNONE;                           /* Default behavior  */
+  kbalval = 0.05;                                 /* Default imbalance */
+  straval = 0;                                    /* No strategy flags */
+  straptr = NULL;
+  SCOTCH_stratInit (&stradat);
+
+  fileBlockInit (C_fileTab, C_FILENBR);           /* Set default stream pointers */
+
+  for (i = 1; i < argc; i ++) {                   /* Loop for all option codes                        */
+    if ((argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][1] == '.')) { /* If found a file name */
+      if (C_paraNum < C_paraNbr) {                /* If number of parameters not reached              */
+        if ((C_partNbr = atoi (argv[i])) < 1)     /* Get the number of parts                          */
+          errorPrint ("main: invalid number of parts '%s'", argv[i]);
+        C_paraNum ++;
+        continue;                                 /* Process the other parameters */
+      }
+      if (C_fileNum < C_FILEARGNBR)               /* File name has been given */
+        fileBlockName (C_fileTab, C_fileNum ++) = argv[i];
+      else
+        errorPrint ("main: too many file names given");
+    }
+    else {                                        /* If found an option name */
+      switch (argv[i][1]) {
+        case 'B' :
+        case 'b' :
+          flagval |= C_FLAGKBALVAL;
+          kbalval = atof (&argv[i][2]);
+          if ((kbalval < 0.0) ||
+              (kbalval > 1.0) ||
+              ((kbalval == 0.0) &&
+               ((argv[i][2] != '0') && (argv[i][2] != '.'))))
+            errorPrint ("main: invalid load imbalance ratio");
+          break;
+        case 'C' :
+        case 'c' :                                /* Strategy selection parameters */
+          for (j = 2; argv[i][j] != '\0'; j ++) {
+            switch (argv[i][j]) {
+              case 'Q' :
+              case 'q' :
+                straval |= SCOTCH_STRATQUALITY;
+                break;
+              case 'S' :
+              case 's' :
+                straval |= SCOTCH_STRATSPEED;
+                break;
+              default :
+                errorPrint ("main: invalid strategy selection option '%c'", argv[i][j]);
+            }
+          }
+          break;
+        case 'H' :                                /* Give the usage message */
+        case 'h' :
+          usagePrint (stdout, C_usageList);
+          return     (EXIT_SUCCESS);
+        case 'M' :                                /* Partitioning strategy */
+        case 'm' :
+          straptr = &argv[i][2];
+          SCOTCH_stratExit (&stradat);
+          SCOTCH_stratInit (&stradat);
+          if ((SCOTCH_stratMeshPart (&stradat, straptr)) != 0)
+            errorPrint ("main: invalid partitioning strategy");
+          break;
+        case 'V' :
+          fprintf (stderr, "mpart, version " SCOTCH_VERSION_STRING "\n");
+          fprintf (stderr, SCOTCH_COPYRIGHT_STRING "\n");
+          fprintf (stderr, SCOTCH_LICENSE_STRING "\n");
+          return  (EXIT_SUCCESS);
+        case 'v' :                               /* Output control info */
+          for (j = 2; argv[i][j] != '\0'; j ++) {
+            switch (argv[i][j]) {
+              case 'M' :
+              case 'm' :
+                flagval |= C_FLAGVERBMAP;
+                break;
+              case 'S' :
+              case 's' :
+                flagval |= C_FLAGVERBSTR;
+                break;
+              case 'T' :
+              case 't' :
+                flagval |= C_FLAGVERBTIM;
+                break;
+              default :
+                errorPrint ("main: unprocessed parameter '%c' in '%s'", argv[i][j], argv[i]);
+            }
+          }
+          break;
+        default :
+          errorPrint ("main: unprocessed option '%s'", argv[i]);
+      }
+    }
+  }
+
+  fileBlockOpen (C_fileTab, C_FILENBR);           /* Open all files */
+
+  clockInit  (&runtime[0]);
+  clockStart (&runtime[0]);
+
+  SCOTCH_meshInit (&meshdat);                     /* Create mesh structure                  */
+  SCOTCH_meshLoad (&meshdat, C_filepntrsrcinp, -1); /* Read source mesh with vertex weights */
+  SCOTCH_meshData (&meshdat, &velmbas, &vnodbas, &velmnbr, NULL, NULL, NULL, NULL, NULL, &vlbltab, NULL, NULL, NULL);
+  baseval = MIN (velmbas, vnodbas);
+
+  if ((straval != 0) || ((flagval & C_FLAGKBALVAL) != 0)) {
+    if (straptr != NULL)
+      errorPrint ("main: options '-b' / '-c' and '-m' are exclusive");
+
+    SCOTCH_stratMeshPartBuild (&stradat, straval, (SCOTCH_Num) C_partNbr, kbalval);
+  }
+
+  clockStop  (&runtime[0]);                       /* Get input time */
+  clockInit  (&runtime[1]);
+  clockStart (&runtime[1]);
+
+  if ((parttab = (SCOTCH_Num *) memAlloc (velmnbr * sizeof (SCOTCH_Num))) == NULL)
+    errorPrint ("main: out of memory");
+
+  if (SCOTCH_meshPart (&meshdat, (SCOTCH_Num) C_partNbr, &stradat, parttab) != 0) /* Perform partitioning */
+    errorPrint ("main: cannot compute partition");
+
+  clockStop  (&runtime[1]);                       /* Get partitioning time */
+  clockStart (&runtime[0]);
+
+  fprintf (C_filepntrmapout, SCOTCH_NUMSTRING "\n", /* Write partition */
+           (SCOTCH_Num) velmnbr);
+  for (velmnum = 0; velmnum < velmnbr; velmnum ++) {
+    SCOTCH_Num          vertnum;
+
+    vertnum = velmnum + velmbas;
+    fprintf (C_filepntrmapout, SCOTCH_NUMSTRING "\t" SCOTCH_NUMSTRING "\n",
+             (SCOTCH_Num) ((vlbltab != NULL) ? vlbltab[vertnum - baseval] : vertnum),
+             (SCOTCH_Num) parttab[velmnum]);
+  }
+
+  clockStop  (&runtime[0]);                       /* Get output time */
+
+  if (flagval & C_FLAGVERBSTR) {
+    fprintf (C_filepntrlogout, "S\tStrat=");
+    SCOTCH_stratSave (&stradat, C_filepntrlogout);
+    putc ('\n', C_filepntrlogout);
+  }
+  if (flagval & C_FLAGVERBTIM) {
+    fprintf (C_filepntrlogout, "T\tPartition\t%g\nT\tI/O\t\t%g\nT\tTotal\t\t%g\n",
+             (double) clockVal (&runtime[1]),
+             (double) clockVal (&runtime[0]),
+             (double) clockVal (&runtime[0]) +
+             (double) clockVal (&runtime[1]));
+  }
+  if (flagval & C_FLAGVERBMAP)
+    C_partView (&meshdat, (SCOTCH_Num) C_partNbr, parttab, C_filepntrlogout);
+
+  fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end eventual (un)compression tasks */
+
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_meshExit  (&meshdat);
+  memFree          (parttab);
+
+  return (EXIT_SUCCESS);
+}